@@ -0,0 +1,1130 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ai_activity.proto
+
+#include "ai_activity.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_ai_5factivity_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ai_5factivity_2eproto = nullptr;
+const uint32_t TableStruct_ai_5factivity_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_ai_5factivity_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021ai_activity.proto*\335\210\001\n\010Activity\022\030\n\013ACT"
+  "_INVALID\020\377\377\377\377\377\377\377\377\377\001\022\r\n\tACT_RESET\020\000\022\014\n\010AC"
+  "T_IDLE\020\001\022\022\n\016ACT_TRANSITION\020\002\022\r\n\tACT_COVE"
+  "R\020\003\022\021\n\rACT_COVER_MED\020\004\022\021\n\rACT_COVER_LOW\020"
+  "\005\022\014\n\010ACT_WALK\020\006\022\020\n\014ACT_WALK_AIM\020\007\022\023\n\017ACT"
+  "_WALK_CROUCH\020\010\022\027\n\023ACT_WALK_CROUCH_AIM\020\t\022"
+  "\013\n\007ACT_RUN\020\n\022\017\n\013ACT_RUN_AIM\020\013\022\022\n\016ACT_RUN"
+  "_CROUCH\020\014\022\026\n\022ACT_RUN_CROUCH_AIM\020\r\022\025\n\021ACT"
+  "_RUN_PROTECTED\020\016\022\032\n\026ACT_SCRIPT_CUSTOM_MO"
+  "VE\020\017\022\025\n\021ACT_RANGE_ATTACK1\020\020\022\025\n\021ACT_RANGE"
+  "_ATTACK2\020\021\022\031\n\025ACT_RANGE_ATTACK1_LOW\020\022\022\031\n"
+  "\025ACT_RANGE_ATTACK2_LOW\020\023\022\021\n\rACT_DIESIMPL"
+  "E\020\024\022\023\n\017ACT_DIEBACKWARD\020\025\022\022\n\016ACT_DIEFORWA"
+  "RD\020\026\022\022\n\016ACT_DIEVIOLENT\020\027\022\022\n\016ACT_DIERAGDO"
+  "LL\020\030\022\013\n\007ACT_FLY\020\031\022\r\n\tACT_HOVER\020\032\022\r\n\tACT_"
+  "GLIDE\020\033\022\014\n\010ACT_SWIM\020\034\022\014\n\010ACT_JUMP\020\035\022\013\n\007A"
+  "CT_HOP\020\036\022\014\n\010ACT_LEAP\020\037\022\014\n\010ACT_LAND\020 \022\020\n\014"
+  "ACT_CLIMB_UP\020!\022\022\n\016ACT_CLIMB_DOWN\020\"\022\026\n\022AC"
+  "T_CLIMB_DISMOUNT\020#\022\025\n\021ACT_SHIPLADDER_UP\020"
+  "$\022\027\n\023ACT_SHIPLADDER_DOWN\020%\022\023\n\017ACT_STRAFE"
+  "_LEFT\020&\022\024\n\020ACT_STRAFE_RIGHT\020\'\022\021\n\rACT_ROL"
+  "L_LEFT\020(\022\022\n\016ACT_ROLL_RIGHT\020)\022\021\n\rACT_TURN"
+  "_LEFT\020*\022\022\n\016ACT_TURN_RIGHT\020+\022\016\n\nACT_CROUC"
+  "H\020,\022\022\n\016ACT_CROUCHIDLE\020-\022\r\n\tACT_STAND\020.\022\013"
+  "\n\007ACT_USE\020/\022\031\n\025ACT_ALIEN_BURROW_IDLE\0200\022\030"
+  "\n\024ACT_ALIEN_BURROW_OUT\0201\022\017\n\013ACT_SIGNAL1\020"
+  "2\022\017\n\013ACT_SIGNAL2\0203\022\017\n\013ACT_SIGNAL3\0204\022\026\n\022A"
+  "CT_SIGNAL_ADVANCE\0205\022\026\n\022ACT_SIGNAL_FORWAR"
+  "D\0206\022\024\n\020ACT_SIGNAL_GROUP\0207\022\023\n\017ACT_SIGNAL_"
+  "HALT\0208\022\023\n\017ACT_SIGNAL_LEFT\0209\022\024\n\020ACT_SIGNA"
+  "L_RIGHT\020:\022\030\n\024ACT_SIGNAL_TAKECOVER\020;\022\026\n\022A"
+  "CT_LOOKBACK_RIGHT\020<\022\025\n\021ACT_LOOKBACK_LEFT"
+  "\020=\022\r\n\tACT_COWER\020>\022\024\n\020ACT_SMALL_FLINCH\020\?\022"
+  "\022\n\016ACT_BIG_FLINCH\020@\022\025\n\021ACT_MELEE_ATTACK1"
+  "\020A\022\025\n\021ACT_MELEE_ATTACK2\020B\022\016\n\nACT_RELOAD\020"
+  "C\022\024\n\020ACT_RELOAD_START\020D\022\025\n\021ACT_RELOAD_FI"
+  "NISH\020E\022\022\n\016ACT_RELOAD_LOW\020F\022\013\n\007ACT_ARM\020G\022"
+  "\016\n\nACT_DISARM\020H\022\023\n\017ACT_DROP_WEAPON\020I\022\033\n\027"
+  "ACT_DROP_WEAPON_SHOTGUN\020J\022\025\n\021ACT_PICKUP_"
+  "GROUND\020K\022\023\n\017ACT_PICKUP_RACK\020L\022\022\n\016ACT_IDL"
+  "E_ANGRY\020M\022\024\n\020ACT_IDLE_RELAXED\020N\022\027\n\023ACT_I"
+  "DLE_STIMULATED\020O\022\025\n\021ACT_IDLE_AGITATED\020P\022"
+  "\024\n\020ACT_IDLE_STEALTH\020Q\022\021\n\rACT_IDLE_HURT\020R"
+  "\022\024\n\020ACT_WALK_RELAXED\020S\022\027\n\023ACT_WALK_STIMU"
+  "LATED\020T\022\025\n\021ACT_WALK_AGITATED\020U\022\024\n\020ACT_WA"
+  "LK_STEALTH\020V\022\023\n\017ACT_RUN_RELAXED\020W\022\026\n\022ACT"
+  "_RUN_STIMULATED\020X\022\024\n\020ACT_RUN_AGITATED\020Y\022"
+  "\023\n\017ACT_RUN_STEALTH\020Z\022\030\n\024ACT_IDLE_AIM_REL"
+  "AXED\020[\022\033\n\027ACT_IDLE_AIM_STIMULATED\020\\\022\031\n\025A"
+  "CT_IDLE_AIM_AGITATED\020]\022\030\n\024ACT_IDLE_AIM_S"
+  "TEALTH\020^\022\030\n\024ACT_WALK_AIM_RELAXED\020_\022\033\n\027AC"
+  "T_WALK_AIM_STIMULATED\020`\022\031\n\025ACT_WALK_AIM_"
+  "AGITATED\020a\022\030\n\024ACT_WALK_AIM_STEALTH\020b\022\027\n\023"
+  "ACT_RUN_AIM_RELAXED\020c\022\032\n\026ACT_RUN_AIM_STI"
+  "MULATED\020d\022\030\n\024ACT_RUN_AIM_AGITATED\020e\022\027\n\023A"
+  "CT_RUN_AIM_STEALTH\020f\022\035\n\031ACT_CROUCHIDLE_S"
+  "TIMULATED\020g\022!\n\035ACT_CROUCHIDLE_AIM_STIMUL"
+  "ATED\020h\022\033\n\027ACT_CROUCHIDLE_AGITATED\020i\022\021\n\rA"
+  "CT_WALK_HURT\020j\022\020\n\014ACT_RUN_HURT\020k\022\027\n\023ACT_"
+  "SPECIAL_ATTACK1\020l\022\027\n\023ACT_SPECIAL_ATTACK2"
+  "\020m\022\023\n\017ACT_COMBAT_IDLE\020n\022\023\n\017ACT_WALK_SCAR"
+  "ED\020o\022\022\n\016ACT_RUN_SCARED\020p\022\025\n\021ACT_VICTORY_"
+  "DANCE\020q\022\024\n\020ACT_DIE_HEADSHOT\020r\022\025\n\021ACT_DIE"
+  "_CHESTSHOT\020s\022\023\n\017ACT_DIE_GUTSHOT\020t\022\024\n\020ACT"
+  "_DIE_BACKSHOT\020u\022\023\n\017ACT_FLINCH_HEAD\020v\022\024\n\020"
+  "ACT_FLINCH_CHEST\020w\022\026\n\022ACT_FLINCH_STOMACH"
+  "\020x\022\026\n\022ACT_FLINCH_LEFTARM\020y\022\027\n\023ACT_FLINCH"
+  "_RIGHTARM\020z\022\026\n\022ACT_FLINCH_LEFTLEG\020{\022\027\n\023A"
+  "CT_FLINCH_RIGHTLEG\020|\022\026\n\022ACT_FLINCH_PHYSI"
+  "CS\020}\022\030\n\024ACT_FLINCH_HEAD_BACK\020~\022\031\n\025ACT_FL"
+  "INCH_CHEST_BACK\020\177\022\034\n\027ACT_FLINCH_STOMACH_"
+  "BACK\020\200\001\022\034\n\027ACT_FLINCH_CROUCH_FRONT\020\201\001\022\033\n"
+  "\026ACT_FLINCH_CROUCH_BACK\020\202\001\022\033\n\026ACT_FLINCH"
+  "_CROUCH_LEFT\020\203\001\022\034\n\027ACT_FLINCH_CROUCH_RIG"
+  "HT\020\204\001\022\025\n\020ACT_IDLE_ON_FIRE\020\205\001\022\025\n\020ACT_WALK"
+  "_ON_FIRE\020\206\001\022\024\n\017ACT_RUN_ON_FIRE\020\207\001\022\024\n\017ACT"
+  "_RAPPEL_LOOP\020\210\001\022\021\n\014ACT_180_LEFT\020\211\001\022\022\n\rAC"
+  "T_180_RIGHT\020\212\001\022\020\n\013ACT_90_LEFT\020\213\001\022\021\n\014ACT_"
+  "90_RIGHT\020\214\001\022\022\n\rACT_STEP_LEFT\020\215\001\022\023\n\016ACT_S"
+  "TEP_RIGHT\020\216\001\022\022\n\rACT_STEP_BACK\020\217\001\022\022\n\rACT_"
+  "STEP_FORE\020\220\001\022\036\n\031ACT_GESTURE_RANGE_ATTACK"
+  "1\020\221\001\022\036\n\031ACT_GESTURE_RANGE_ATTACK2\020\222\001\022\036\n\031"
+  "ACT_GESTURE_MELEE_ATTACK1\020\223\001\022\036\n\031ACT_GEST"
+  "URE_MELEE_ATTACK2\020\224\001\022\"\n\035ACT_GESTURE_RANG"
+  "E_ATTACK1_LOW\020\225\001\022\"\n\035ACT_GESTURE_RANGE_AT"
+  "TACK2_LOW\020\226\001\022#\n\036ACT_MELEE_ATTACK_SWING_G"
+  "ESTURE\020\227\001\022\035\n\030ACT_GESTURE_SMALL_FLINCH\020\230\001"
+  "\022\033\n\026ACT_GESTURE_BIG_FLINCH\020\231\001\022\035\n\030ACT_GES"
+  "TURE_FLINCH_BLAST\020\232\001\022%\n ACT_GESTURE_FLIN"
+  "CH_BLAST_SHOTGUN\020\233\001\022%\n ACT_GESTURE_FLINC"
+  "H_BLAST_DAMAGED\020\234\001\022-\n(ACT_GESTURE_FLINCH"
+  "_BLAST_DAMAGED_SHOTGUN\020\235\001\022\034\n\027ACT_GESTURE"
+  "_FLINCH_HEAD\020\236\001\022\035\n\030ACT_GESTURE_FLINCH_CH"
+  "EST\020\237\001\022\037\n\032ACT_GESTURE_FLINCH_STOMACH\020\240\001\022"
+  "\037\n\032ACT_GESTURE_FLINCH_LEFTARM\020\241\001\022 \n\033ACT_"
+  "GESTURE_FLINCH_RIGHTARM\020\242\001\022\037\n\032ACT_GESTUR"
+  "E_FLINCH_LEFTLEG\020\243\001\022 \n\033ACT_GESTURE_FLINC"
+  "H_RIGHTLEG\020\244\001\022\032\n\025ACT_GESTURE_TURN_LEFT\020\245"
+  "\001\022\033\n\026ACT_GESTURE_TURN_RIGHT\020\246\001\022\034\n\027ACT_GE"
+  "STURE_TURN_LEFT45\020\247\001\022\035\n\030ACT_GESTURE_TURN"
+  "_RIGHT45\020\250\001\022\034\n\027ACT_GESTURE_TURN_LEFT90\020\251"
+  "\001\022\035\n\030ACT_GESTURE_TURN_RIGHT90\020\252\001\022!\n\034ACT_"
+  "GESTURE_TURN_LEFT45_FLAT\020\253\001\022\"\n\035ACT_GESTU"
+  "RE_TURN_RIGHT45_FLAT\020\254\001\022!\n\034ACT_GESTURE_T"
+  "URN_LEFT90_FLAT\020\255\001\022\"\n\035ACT_GESTURE_TURN_R"
+  "IGHT90_FLAT\020\256\001\022\025\n\020ACT_BARNACLE_HIT\020\257\001\022\026\n"
+  "\021ACT_BARNACLE_PULL\020\260\001\022\027\n\022ACT_BARNACLE_CH"
+  "OMP\020\261\001\022\026\n\021ACT_BARNACLE_CHEW\020\262\001\022\027\n\022ACT_DO"
+  "_NOT_DISTURB\020\263\001\022\032\n\025ACT_SPECIFIC_SEQUENCE"
+  "\020\264\001\022\020\n\013ACT_VM_DRAW\020\265\001\022\023\n\016ACT_VM_HOLSTER\020"
+  "\266\001\022\020\n\013ACT_VM_IDLE\020\267\001\022\022\n\rACT_VM_FIDGET\020\270\001"
+  "\022\024\n\017ACT_VM_PULLBACK\020\271\001\022\031\n\024ACT_VM_PULLBAC"
+  "K_HIGH\020\272\001\022\030\n\023ACT_VM_PULLBACK_LOW\020\273\001\022\021\n\014A"
+  "CT_VM_THROW\020\274\001\022\023\n\016ACT_VM_PULLPIN\020\275\001\022\031\n\024A"
+  "CT_VM_PRIMARYATTACK\020\276\001\022\033\n\026ACT_VM_SECONDA"
+  "RYATTACK\020\277\001\022\022\n\rACT_VM_RELOAD\020\300\001\022\023\n\016ACT_V"
+  "M_DRYFIRE\020\301\001\022\023\n\016ACT_VM_HITLEFT\020\302\001\022\024\n\017ACT"
+  "_VM_HITLEFT2\020\303\001\022\024\n\017ACT_VM_HITRIGHT\020\304\001\022\025\n"
+  "\020ACT_VM_HITRIGHT2\020\305\001\022\025\n\020ACT_VM_HITCENTER"
+  "\020\306\001\022\026\n\021ACT_VM_HITCENTER2\020\307\001\022\024\n\017ACT_VM_MI"
+  "SSLEFT\020\310\001\022\025\n\020ACT_VM_MISSLEFT2\020\311\001\022\025\n\020ACT_"
+  "VM_MISSRIGHT\020\312\001\022\026\n\021ACT_VM_MISSRIGHT2\020\313\001\022"
+  "\026\n\021ACT_VM_MISSCENTER\020\314\001\022\027\n\022ACT_VM_MISSCE"
+  "NTER2\020\315\001\022\024\n\017ACT_VM_HAULBACK\020\316\001\022\025\n\020ACT_VM"
+  "_SWINGHARD\020\317\001\022\025\n\020ACT_VM_SWINGMISS\020\320\001\022\024\n\017"
+  "ACT_VM_SWINGHIT\020\321\001\022\033\n\026ACT_VM_IDLE_TO_LOW"
+  "ERED\020\322\001\022\030\n\023ACT_VM_IDLE_LOWERED\020\323\001\022\033\n\026ACT"
+  "_VM_LOWERED_TO_IDLE\020\324\001\022\023\n\016ACT_VM_RECOIL1"
+  "\020\325\001\022\023\n\016ACT_VM_RECOIL2\020\326\001\022\023\n\016ACT_VM_RECOI"
+  "L3\020\327\001\022\022\n\rACT_VM_PICKUP\020\330\001\022\023\n\016ACT_VM_RELE"
+  "ASE\020\331\001\022\033\n\026ACT_VM_ATTACH_SILENCER\020\332\001\022\033\n\026A"
+  "CT_VM_DETACH_SILENCER\020\333\001\022\034\n\027ACT_SLAM_STI"
+  "CKWALL_IDLE\020\334\001\022\037\n\032ACT_SLAM_STICKWALL_ND_"
+  "IDLE\020\335\001\022\036\n\031ACT_SLAM_STICKWALL_ATTACH\020\336\001\022"
+  "\037\n\032ACT_SLAM_STICKWALL_ATTACH2\020\337\001\022!\n\034ACT_"
+  "SLAM_STICKWALL_ND_ATTACH\020\340\001\022\"\n\035ACT_SLAM_"
+  "STICKWALL_ND_ATTACH2\020\341\001\022 \n\033ACT_SLAM_STIC"
+  "KWALL_DETONATE\020\342\001\022)\n$ACT_SLAM_STICKWALL_"
+  "DETONATOR_HOLSTER\020\343\001\022\034\n\027ACT_SLAM_STICKWA"
+  "LL_DRAW\020\344\001\022\037\n\032ACT_SLAM_STICKWALL_ND_DRAW"
+  "\020\345\001\022 \n\033ACT_SLAM_STICKWALL_TO_THROW\020\346\001\022#\n"
+  "\036ACT_SLAM_STICKWALL_TO_THROW_ND\020\347\001\022&\n!AC"
+  "T_SLAM_STICKWALL_TO_TRIPMINE_ND\020\350\001\022\030\n\023AC"
+  "T_SLAM_THROW_IDLE\020\351\001\022\033\n\026ACT_SLAM_THROW_N"
+  "D_IDLE\020\352\001\022\031\n\024ACT_SLAM_THROW_THROW\020\353\001\022\032\n\025"
+  "ACT_SLAM_THROW_THROW2\020\354\001\022\034\n\027ACT_SLAM_THR"
+  "OW_THROW_ND\020\355\001\022\035\n\030ACT_SLAM_THROW_THROW_N"
+  "D2\020\356\001\022\030\n\023ACT_SLAM_THROW_DRAW\020\357\001\022\033\n\026ACT_S"
+  "LAM_THROW_ND_DRAW\020\360\001\022 \n\033ACT_SLAM_THROW_T"
+  "O_STICKWALL\020\361\001\022#\n\036ACT_SLAM_THROW_TO_STIC"
+  "KWALL_ND\020\362\001\022\034\n\027ACT_SLAM_THROW_DETONATE\020\363"
+  "\001\022%\n ACT_SLAM_THROW_DETONATOR_HOLSTER\020\364\001"
+  "\022\"\n\035ACT_SLAM_THROW_TO_TRIPMINE_ND\020\365\001\022\033\n\026"
+  "ACT_SLAM_TRIPMINE_IDLE\020\366\001\022\033\n\026ACT_SLAM_TR"
+  "IPMINE_DRAW\020\367\001\022\035\n\030ACT_SLAM_TRIPMINE_ATTA"
+  "CH\020\370\001\022\036\n\031ACT_SLAM_TRIPMINE_ATTACH2\020\371\001\022&\n"
+  "!ACT_SLAM_TRIPMINE_TO_STICKWALL_ND\020\372\001\022\"\n"
+  "\035ACT_SLAM_TRIPMINE_TO_THROW_ND\020\373\001\022\034\n\027ACT"
+  "_SLAM_DETONATOR_IDLE\020\374\001\022\034\n\027ACT_SLAM_DETO"
+  "NATOR_DRAW\020\375\001\022 \n\033ACT_SLAM_DETONATOR_DETO"
+  "NATE\020\376\001\022\037\n\032ACT_SLAM_DETONATOR_HOLSTER\020\377\001"
+  "\022&\n!ACT_SLAM_DETONATOR_STICKWALL_DRAW\020\200\002"
+  "\022\"\n\035ACT_SLAM_DETONATOR_THROW_DRAW\020\201\002\022\035\n\030"
+  "ACT_SHOTGUN_RELOAD_START\020\202\002\022\036\n\031ACT_SHOTG"
+  "UN_RELOAD_FINISH\020\203\002\022\025\n\020ACT_SHOTGUN_PUMP\020"
+  "\204\002\022\023\n\016ACT_SMG2_IDLE2\020\205\002\022\023\n\016ACT_SMG2_FIRE"
+  "2\020\206\002\022\023\n\016ACT_SMG2_DRAW2\020\207\002\022\025\n\020ACT_SMG2_RE"
+  "LOAD2\020\210\002\022\026\n\021ACT_SMG2_DRYFIRE2\020\211\002\022\024\n\017ACT_"
+  "SMG2_TOAUTO\020\212\002\022\025\n\020ACT_SMG2_TOBURST\020\213\002\022\033\n"
+  "\026ACT_PHYSCANNON_UPGRADE\020\214\002\022\031\n\024ACT_RANGE_"
+  "ATTACK_AR1\020\215\002\022\031\n\024ACT_RANGE_ATTACK_AR2\020\216\002"
+  "\022\035\n\030ACT_RANGE_ATTACK_AR2_LOW\020\217\002\022!\n\034ACT_R"
+  "ANGE_ATTACK_AR2_GRENADE\020\220\002\022\032\n\025ACT_RANGE_"
+  "ATTACK_HMG1\020\221\002\022\030\n\023ACT_RANGE_ATTACK_ML\020\222\002"
+  "\022\032\n\025ACT_RANGE_ATTACK_SMG1\020\223\002\022\036\n\031ACT_RANG"
+  "E_ATTACK_SMG1_LOW\020\224\002\022\032\n\025ACT_RANGE_ATTACK"
+  "_SMG2\020\225\002\022\035\n\030ACT_RANGE_ATTACK_SHOTGUN\020\226\002\022"
+  "!\n\034ACT_RANGE_ATTACK_SHOTGUN_LOW\020\227\002\022\034\n\027AC"
+  "T_RANGE_ATTACK_PISTOL\020\230\002\022 \n\033ACT_RANGE_AT"
+  "TACK_PISTOL_LOW\020\231\002\022\032\n\025ACT_RANGE_ATTACK_S"
+  "LAM\020\232\002\022\036\n\031ACT_RANGE_ATTACK_TRIPWIRE\020\233\002\022\033"
+  "\n\026ACT_RANGE_ATTACK_THROW\020\234\002\022\"\n\035ACT_RANGE"
+  "_ATTACK_SNIPER_RIFLE\020\235\002\022\031\n\024ACT_RANGE_ATT"
+  "ACK_RPG\020\236\002\022\033\n\026ACT_MELEE_ATTACK_SWING\020\237\002\022"
+  "\026\n\021ACT_RANGE_AIM_LOW\020\240\002\022\033\n\026ACT_RANGE_AIM"
+  "_SMG1_LOW\020\241\002\022\035\n\030ACT_RANGE_AIM_PISTOL_LOW"
+  "\020\242\002\022\032\n\025ACT_RANGE_AIM_AR2_LOW\020\243\002\022\031\n\024ACT_C"
+  "OVER_PISTOL_LOW\020\244\002\022\027\n\022ACT_COVER_SMG1_LOW"
+  "\020\245\002\022!\n\034ACT_GESTURE_RANGE_ATTACK_AR1\020\246\002\022!"
+  "\n\034ACT_GESTURE_RANGE_ATTACK_AR2\020\247\002\022)\n$ACT"
+  "_GESTURE_RANGE_ATTACK_AR2_GRENADE\020\250\002\022\"\n\035"
+  "ACT_GESTURE_RANGE_ATTACK_HMG1\020\251\002\022 \n\033ACT_"
+  "GESTURE_RANGE_ATTACK_ML\020\252\002\022\"\n\035ACT_GESTUR"
+  "E_RANGE_ATTACK_SMG1\020\253\002\022&\n!ACT_GESTURE_RA"
+  "NGE_ATTACK_SMG1_LOW\020\254\002\022\"\n\035ACT_GESTURE_RA"
+  "NGE_ATTACK_SMG2\020\255\002\022%\n ACT_GESTURE_RANGE_"
+  "ATTACK_SHOTGUN\020\256\002\022$\n\037ACT_GESTURE_RANGE_A"
+  "TTACK_PISTOL\020\257\002\022(\n#ACT_GESTURE_RANGE_ATT"
+  "ACK_PISTOL_LOW\020\260\002\022\"\n\035ACT_GESTURE_RANGE_A"
+  "TTACK_SLAM\020\261\002\022&\n!ACT_GESTURE_RANGE_ATTAC"
+  "K_TRIPWIRE\020\262\002\022#\n\036ACT_GESTURE_RANGE_ATTAC"
+  "K_THROW\020\263\002\022*\n%ACT_GESTURE_RANGE_ATTACK_S"
+  "NIPER_RIFLE\020\264\002\022#\n\036ACT_GESTURE_MELEE_ATTA"
+  "CK_SWING\020\265\002\022\023\n\016ACT_IDLE_RIFLE\020\266\002\022\022\n\rACT_"
+  "IDLE_SMG1\020\267\002\022\030\n\023ACT_IDLE_ANGRY_SMG1\020\270\002\022\024"
+  "\n\017ACT_IDLE_PISTOL\020\271\002\022\032\n\025ACT_IDLE_ANGRY_P"
+  "ISTOL\020\272\002\022\033\n\026ACT_IDLE_ANGRY_SHOTGUN\020\273\002\022\034\n"
+  "\027ACT_IDLE_STEALTH_PISTOL\020\274\002\022\025\n\020ACT_IDLE_"
+  "PACKAGE\020\275\002\022\025\n\020ACT_WALK_PACKAGE\020\276\002\022\026\n\021ACT"
+  "_IDLE_SUITCASE\020\277\002\022\026\n\021ACT_WALK_SUITCASE\020\300"
+  "\002\022\032\n\025ACT_IDLE_SMG1_RELAXED\020\301\002\022\035\n\030ACT_IDL"
+  "E_SMG1_STIMULATED\020\302\002\022\033\n\026ACT_WALK_RIFLE_R"
+  "ELAXED\020\303\002\022\032\n\025ACT_RUN_RIFLE_RELAXED\020\304\002\022\036\n"
+  "\031ACT_WALK_RIFLE_STIMULATED\020\305\002\022\035\n\030ACT_RUN"
+  "_RIFLE_STIMULATED\020\306\002\022\"\n\035ACT_IDLE_AIM_RIF"
+  "LE_STIMULATED\020\307\002\022\"\n\035ACT_WALK_AIM_RIFLE_S"
+  "TIMULATED\020\310\002\022!\n\034ACT_RUN_AIM_RIFLE_STIMUL"
+  "ATED\020\311\002\022\035\n\030ACT_IDLE_SHOTGUN_RELAXED\020\312\002\022 "
+  "\n\033ACT_IDLE_SHOTGUN_STIMULATED\020\313\002\022\036\n\031ACT_"
+  "IDLE_SHOTGUN_AGITATED\020\314\002\022\023\n\016ACT_WALK_ANG"
+  "RY\020\315\002\022\027\n\022ACT_POLICE_HARASS1\020\316\002\022\027\n\022ACT_PO"
+  "LICE_HARASS2\020\317\002\022\027\n\022ACT_IDLE_MANNEDGUN\020\320\002"
+  "\022\023\n\016ACT_IDLE_MELEE\020\321\002\022\031\n\024ACT_IDLE_ANGRY_"
+  "MELEE\020\322\002\022\031\n\024ACT_IDLE_RPG_RELAXED\020\323\002\022\021\n\014A"
+  "CT_IDLE_RPG\020\324\002\022\027\n\022ACT_IDLE_ANGRY_RPG\020\325\002\022"
+  "\026\n\021ACT_COVER_LOW_RPG\020\326\002\022\021\n\014ACT_WALK_RPG\020"
+  "\327\002\022\020\n\013ACT_RUN_RPG\020\330\002\022\030\n\023ACT_WALK_CROUCH_"
+  "RPG\020\331\002\022\027\n\022ACT_RUN_CROUCH_RPG\020\332\002\022\031\n\024ACT_W"
+  "ALK_RPG_RELAXED\020\333\002\022\030\n\023ACT_RUN_RPG_RELAXE"
+  "D\020\334\002\022\023\n\016ACT_WALK_RIFLE\020\335\002\022\027\n\022ACT_WALK_AI"
+  "M_RIFLE\020\336\002\022\032\n\025ACT_WALK_CROUCH_RIFLE\020\337\002\022\036"
+  "\n\031ACT_WALK_CROUCH_AIM_RIFLE\020\340\002\022\022\n\rACT_RU"
+  "N_RIFLE\020\341\002\022\026\n\021ACT_RUN_AIM_RIFLE\020\342\002\022\031\n\024AC"
+  "T_RUN_CROUCH_RIFLE\020\343\002\022\035\n\030ACT_RUN_CROUCH_"
+  "AIM_RIFLE\020\344\002\022\033\n\026ACT_RUN_STEALTH_PISTOL\020\345"
+  "\002\022\031\n\024ACT_WALK_AIM_SHOTGUN\020\346\002\022\030\n\023ACT_RUN_"
+  "AIM_SHOTGUN\020\347\002\022\024\n\017ACT_WALK_PISTOL\020\350\002\022\023\n\016"
+  "ACT_RUN_PISTOL\020\351\002\022\030\n\023ACT_WALK_AIM_PISTOL"
+  "\020\352\002\022\027\n\022ACT_RUN_AIM_PISTOL\020\353\002\022\034\n\027ACT_WALK"
+  "_STEALTH_PISTOL\020\354\002\022 \n\033ACT_WALK_AIM_STEAL"
+  "TH_PISTOL\020\355\002\022\037\n\032ACT_RUN_AIM_STEALTH_PIST"
+  "OL\020\356\002\022\026\n\021ACT_RELOAD_PISTOL\020\357\002\022\032\n\025ACT_REL"
+  "OAD_PISTOL_LOW\020\360\002\022\024\n\017ACT_RELOAD_SMG1\020\361\002\022"
+  "\030\n\023ACT_RELOAD_SMG1_LOW\020\362\002\022\027\n\022ACT_RELOAD_"
+  "SHOTGUN\020\363\002\022\033\n\026ACT_RELOAD_SHOTGUN_LOW\020\364\002\022"
+  "\027\n\022ACT_GESTURE_RELOAD\020\365\002\022\036\n\031ACT_GESTURE_"
+  "RELOAD_PISTOL\020\366\002\022\034\n\027ACT_GESTURE_RELOAD_S"
+  "MG1\020\367\002\022\037\n\032ACT_GESTURE_RELOAD_SHOTGUN\020\370\002\022"
+  "\027\n\022ACT_BUSY_LEAN_LEFT\020\371\002\022\035\n\030ACT_BUSY_LEA"
+  "N_LEFT_ENTRY\020\372\002\022\034\n\027ACT_BUSY_LEAN_LEFT_EX"
+  "IT\020\373\002\022\027\n\022ACT_BUSY_LEAN_BACK\020\374\002\022\035\n\030ACT_BU"
+  "SY_LEAN_BACK_ENTRY\020\375\002\022\034\n\027ACT_BUSY_LEAN_B"
+  "ACK_EXIT\020\376\002\022\030\n\023ACT_BUSY_SIT_GROUND\020\377\002\022\036\n"
+  "\031ACT_BUSY_SIT_GROUND_ENTRY\020\200\003\022\035\n\030ACT_BUS"
+  "Y_SIT_GROUND_EXIT\020\201\003\022\027\n\022ACT_BUSY_SIT_CHA"
+  "IR\020\202\003\022\035\n\030ACT_BUSY_SIT_CHAIR_ENTRY\020\203\003\022\034\n\027"
+  "ACT_BUSY_SIT_CHAIR_EXIT\020\204\003\022\023\n\016ACT_BUSY_S"
+  "TAND\020\205\003\022\023\n\016ACT_BUSY_QUEUE\020\206\003\022\023\n\016ACT_DUCK"
+  "_DODGE\020\207\003\022\035\n\030ACT_DIE_BARNACLE_SWALLOW\020\210\003"
+  "\022\"\n\035ACT_GESTURE_BARNACLE_STRANGLE\020\211\003\022\032\n\025"
+  "ACT_PHYSCANNON_DETACH\020\212\003\022\033\n\026ACT_PHYSCANN"
+  "ON_ANIMATE\020\213\003\022\037\n\032ACT_PHYSCANNON_ANIMATE_"
+  "PRE\020\214\003\022 \n\033ACT_PHYSCANNON_ANIMATE_POST\020\215\003"
+  "\022\026\n\021ACT_DIE_FRONTSIDE\020\216\003\022\026\n\021ACT_DIE_RIGH"
+  "TSIDE\020\217\003\022\025\n\020ACT_DIE_BACKSIDE\020\220\003\022\025\n\020ACT_D"
+  "IE_LEFTSIDE\020\221\003\022\022\n\rACT_OPEN_DOOR\020\222\003\022\035\n\030AC"
+  "T_DI_ALYX_ZOMBIE_MELEE\020\223\003\022#\n\036ACT_DI_ALYX"
+  "_ZOMBIE_TORSO_MELEE\020\224\003\022\037\n\032ACT_DI_ALYX_HE"
+  "ADCRAB_MELEE\020\225\003\022\030\n\023ACT_DI_ALYX_ANTLION\020\226"
+  "\003\022!\n\034ACT_DI_ALYX_ZOMBIE_SHOTGUN64\020\227\003\022!\n\034"
+  "ACT_DI_ALYX_ZOMBIE_SHOTGUN26\020\230\003\022(\n#ACT_R"
+  "EADINESS_RELAXED_TO_STIMULATED\020\231\003\022-\n(ACT"
+  "_READINESS_RELAXED_TO_STIMULATED_WALK\020\232\003"
+  "\022)\n$ACT_READINESS_AGITATED_TO_STIMULATED"
+  "\020\233\003\022(\n#ACT_READINESS_STIMULATED_TO_RELAX"
+  "ED\020\234\003\022/\n*ACT_READINESS_PISTOL_RELAXED_TO"
+  "_STIMULATED\020\235\003\0224\n/ACT_READINESS_PISTOL_R"
+  "ELAXED_TO_STIMULATED_WALK\020\236\003\0220\n+ACT_READ"
+  "INESS_PISTOL_AGITATED_TO_STIMULATED\020\237\003\022/"
+  "\n*ACT_READINESS_PISTOL_STIMULATED_TO_REL"
+  "AXED\020\240\003\022\023\n\016ACT_IDLE_CARRY\020\241\003\022\023\n\016ACT_WALK"
+  "_CARRY\020\242\003\022\022\n\rACT_DOTA_IDLE\020\243\003\022\027\n\022ACT_DOT"
+  "A_IDLE_RARE\020\245\003\022\021\n\014ACT_DOTA_RUN\020\246\003\022\024\n\017ACT"
+  "_DOTA_ATTACK\020\250\003\022\025\n\020ACT_DOTA_ATTACK2\020\251\003\022\032"
+  "\n\025ACT_DOTA_ATTACK_EVENT\020\252\003\022\021\n\014ACT_DOTA_D"
+  "IE\020\253\003\022\024\n\017ACT_DOTA_FLINCH\020\254\003\022\023\n\016ACT_DOTA_"
+  "FLAIL\020\255\003\022\026\n\021ACT_DOTA_DISABLED\020\256\003\022\034\n\027ACT_"
+  "DOTA_CAST_ABILITY_1\020\257\003\022\034\n\027ACT_DOTA_CAST_"
+  "ABILITY_2\020\260\003\022\034\n\027ACT_DOTA_CAST_ABILITY_3\020"
+  "\261\003\022\034\n\027ACT_DOTA_CAST_ABILITY_4\020\262\003\022\034\n\027ACT_"
+  "DOTA_CAST_ABILITY_5\020\263\003\022\034\n\027ACT_DOTA_CAST_"
+  "ABILITY_6\020\264\003\022 \n\033ACT_DOTA_OVERRIDE_ABILIT"
+  "Y_1\020\265\003\022 \n\033ACT_DOTA_OVERRIDE_ABILITY_2\020\266\003"
+  "\022 \n\033ACT_DOTA_OVERRIDE_ABILITY_3\020\267\003\022 \n\033AC"
+  "T_DOTA_OVERRIDE_ABILITY_4\020\270\003\022\037\n\032ACT_DOTA"
+  "_CHANNEL_ABILITY_1\020\271\003\022\037\n\032ACT_DOTA_CHANNE"
+  "L_ABILITY_2\020\272\003\022\037\n\032ACT_DOTA_CHANNEL_ABILI"
+  "TY_3\020\273\003\022\037\n\032ACT_DOTA_CHANNEL_ABILITY_4\020\274\003"
+  "\022\037\n\032ACT_DOTA_CHANNEL_ABILITY_5\020\275\003\022\037\n\032ACT"
+  "_DOTA_CHANNEL_ABILITY_6\020\276\003\022#\n\036ACT_DOTA_C"
+  "HANNEL_END_ABILITY_1\020\277\003\022#\n\036ACT_DOTA_CHAN"
+  "NEL_END_ABILITY_2\020\300\003\022#\n\036ACT_DOTA_CHANNEL"
+  "_END_ABILITY_3\020\301\003\022#\n\036ACT_DOTA_CHANNEL_EN"
+  "D_ABILITY_4\020\302\003\022#\n\036ACT_DOTA_CHANNEL_END_A"
+  "BILITY_5\020\303\003\022#\n\036ACT_DOTA_CHANNEL_END_ABIL"
+  "ITY_6\020\304\003\022\034\n\027ACT_DOTA_CONSTANT_LAYER\020\305\003\022\025"
+  "\n\020ACT_DOTA_CAPTURE\020\306\003\022\023\n\016ACT_DOTA_SPAWN\020"
+  "\307\003\022\027\n\022ACT_DOTA_KILLTAUNT\020\310\003\022\023\n\016ACT_DOTA_"
+  "TAUNT\020\311\003\022\024\n\017ACT_DOTA_THIRST\020\312\003\022\037\n\032ACT_DO"
+  "TA_CAST_DRAGONBREATH\020\313\003\022\027\n\022ACT_DOTA_ECHO"
+  "_SLAM\020\314\003\022 \n\033ACT_DOTA_CAST_ABILITY_1_END\020"
+  "\315\003\022 \n\033ACT_DOTA_CAST_ABILITY_2_END\020\316\003\022 \n\033"
+  "ACT_DOTA_CAST_ABILITY_3_END\020\317\003\022 \n\033ACT_DO"
+  "TA_CAST_ABILITY_4_END\020\320\003\022\030\n\023ACT_MIRANA_L"
+  "EAP_END\020\321\003\022\027\n\022ACT_WAVEFORM_START\020\322\003\022\025\n\020A"
+  "CT_WAVEFORM_END\020\323\003\022\036\n\031ACT_DOTA_CAST_ABIL"
+  "ITY_ROT\020\324\003\022\031\n\024ACT_DOTA_DIE_SPECIAL\020\325\003\022\'\n"
+  "\"ACT_DOTA_RATTLETRAP_BATTERYASSAULT\020\326\003\022\""
+  "\n\035ACT_DOTA_RATTLETRAP_POWERCOGS\020\327\003\022\'\n\"AC"
+  "T_DOTA_RATTLETRAP_HOOKSHOT_START\020\330\003\022&\n!A"
+  "CT_DOTA_RATTLETRAP_HOOKSHOT_LOOP\020\331\003\022%\n A"
+  "CT_DOTA_RATTLETRAP_HOOKSHOT_END\020\332\003\022+\n&AC"
+  "T_STORM_SPIRIT_OVERLOAD_RUN_OVERRIDE\020\333\003\022"
+  "\033\n\026ACT_DOTA_TINKER_REARM1\020\334\003\022\033\n\026ACT_DOTA"
+  "_TINKER_REARM2\020\335\003\022\033\n\026ACT_DOTA_TINKER_REA"
+  "RM3\020\336\003\022\027\n\022ACT_TINY_AVALANCHE\020\337\003\022\022\n\rACT_T"
+  "INY_TOSS\020\340\003\022\023\n\016ACT_TINY_GROWL\020\341\003\022\036\n\031ACT_"
+  "DOTA_WEAVERBUG_ATTACH\020\342\003\022 \n\033ACT_DOTA_CAS"
+  "T_WILD_AXES_END\020\343\003\022#\n\036ACT_DOTA_CAST_LIFE"
+  "_BREAK_START\020\344\003\022!\n\034ACT_DOTA_CAST_LIFE_BR"
+  "EAK_END\020\345\003\022%\n ACT_DOTA_NIGHTSTALKER_TRAN"
+  "SITION\020\346\003\022\036\n\031ACT_DOTA_LIFESTEALER_RAGE\020\347"
+  "\003\022%\n ACT_DOTA_LIFESTEALER_OPEN_WOUNDS\020\350\003"
+  "\022!\n\034ACT_DOTA_SAND_KING_BURROW_IN\020\351\003\022\"\n\035A"
+  "CT_DOTA_SAND_KING_BURROW_OUT\020\352\003\022&\n!ACT_D"
+  "OTA_EARTHSHAKER_TOTEM_ATTACK\020\353\003\022\031\n\024ACT_D"
+  "OTA_WHEEL_LAYER\020\354\003\022+\n&ACT_DOTA_ALCHEMIST"
+  "_CHEMICAL_RAGE_START\020\355\003\022\"\n\035ACT_DOTA_ALCH"
+  "EMIST_CONCOCTION\020\356\003\022%\n ACT_DOTA_JAKIRO_L"
+  "IQUIDFIRE_START\020\357\003\022$\n\037ACT_DOTA_JAKIRO_LI"
+  "QUIDFIRE_LOOP\020\360\003\022 \n\033ACT_DOTA_LIFESTEALER"
+  "_INFEST\020\361\003\022$\n\037ACT_DOTA_LIFESTEALER_INFES"
+  "T_END\020\362\003\022\030\n\023ACT_DOTA_LASSO_LOOP\020\363\003\022(\n#AC"
+  "T_DOTA_ALCHEMIST_CONCOCTION_THROW\020\364\003\022)\n$"
+  "ACT_DOTA_ALCHEMIST_CHEMICAL_RAGE_END\020\365\003\022"
+  "\034\n\027ACT_DOTA_CAST_COLD_SNAP\020\366\003\022\035\n\030ACT_DOT"
+  "A_CAST_GHOST_WALK\020\367\003\022\032\n\025ACT_DOTA_CAST_TO"
+  "RNADO\020\370\003\022\026\n\021ACT_DOTA_CAST_EMP\020\371\003\022\033\n\026ACT_"
+  "DOTA_CAST_ALACRITY\020\372\003\022\037\n\032ACT_DOTA_CAST_C"
+  "HAOS_METEOR\020\373\003\022\035\n\030ACT_DOTA_CAST_SUN_STRI"
+  "KE\020\374\003\022\037\n\032ACT_DOTA_CAST_FORGE_SPIRIT\020\375\003\022\033"
+  "\n\026ACT_DOTA_CAST_ICE_WALL\020\376\003\022\"\n\035ACT_DOTA_"
+  "CAST_DEAFENING_BLAST\020\377\003\022\025\n\020ACT_DOTA_VICT"
+  "ORY\020\200\004\022\024\n\017ACT_DOTA_DEFEAT\020\201\004\022(\n#ACT_DOTA"
+  "_SPIRIT_BREAKER_CHARGE_POSE\020\202\004\022\'\n\"ACT_DO"
+  "TA_SPIRIT_BREAKER_CHARGE_END\020\203\004\022\026\n\021ACT_D"
+  "OTA_TELEPORT\020\204\004\022\032\n\025ACT_DOTA_TELEPORT_END"
+  "\020\205\004\022\035\n\030ACT_DOTA_CAST_REFRACTION\020\206\004\022\034\n\027AC"
+  "T_DOTA_CAST_ABILITY_7\020\207\004\022\037\n\032ACT_DOTA_CAN"
+  "CEL_SIREN_SONG\020\210\004\022\037\n\032ACT_DOTA_CHANNEL_AB"
+  "ILITY_7\020\211\004\022\025\n\020ACT_DOTA_LOADOUT\020\212\004\022\034\n\027ACT"
+  "_DOTA_FORCESTAFF_END\020\213\004\022\026\n\021ACT_DOTA_POOF"
+  "_END\020\214\004\022\032\n\025ACT_DOTA_SLARK_POUNCE\020\215\004\022!\n\034A"
+  "CT_DOTA_MAGNUS_SKEWER_START\020\216\004\022\037\n\032ACT_DO"
+  "TA_MAGNUS_SKEWER_END\020\217\004\022\037\n\032ACT_DOTA_MEDU"
+  "SA_STONE_GAZE\020\220\004\022\031\n\024ACT_DOTA_RELAX_START"
+  "\020\221\004\022\030\n\023ACT_DOTA_RELAX_LOOP\020\222\004\022\027\n\022ACT_DOT"
+  "A_RELAX_END\020\223\004\022\036\n\031ACT_DOTA_CENTAUR_STAMP"
+  "EDE\020\224\004\022\035\n\030ACT_DOTA_BELLYACHE_START\020\225\004\022\034\n"
+  "\027ACT_DOTA_BELLYACHE_LOOP\020\226\004\022\033\n\026ACT_DOTA_"
+  "BELLYACHE_END\020\227\004\022\035\n\030ACT_DOTA_ROQUELAIRE_"
+  "LAND\020\230\004\022\"\n\035ACT_DOTA_ROQUELAIRE_LAND_IDLE"
+  "\020\231\004\022\032\n\025ACT_DOTA_GREEVIL_CAST\020\232\004\022&\n!ACT_D"
+  "OTA_GREEVIL_OVERRIDE_ABILITY\020\233\004\022 \n\033ACT_D"
+  "OTA_GREEVIL_HOOK_START\020\234\004\022\036\n\031ACT_DOTA_GR"
+  "EEVIL_HOOK_END\020\235\004\022 \n\033ACT_DOTA_GREEVIL_BL"
+  "INK_BONE\020\236\004\022\033\n\026ACT_DOTA_IDLE_SLEEPING\020\237\004"
+  "\022\023\n\016ACT_DOTA_INTRO\020\240\004\022\033\n\026ACT_DOTA_GESTUR"
+  "E_POINT\020\241\004\022\034\n\027ACT_DOTA_GESTURE_ACCENT\020\242\004"
+  "\022\032\n\025ACT_DOTA_SLEEPING_END\020\243\004\022\024\n\017ACT_DOTA"
+  "_AMBUSH\020\244\004\022\027\n\022ACT_DOTA_ITEM_LOOK\020\245\004\022\025\n\020A"
+  "CT_DOTA_STARTLE\020\246\004\022\031\n\024ACT_DOTA_FRUSTRATI"
+  "ON\020\247\004\022\034\n\027ACT_DOTA_TELEPORT_REACT\020\250\004\022 \n\033A"
+  "CT_DOTA_TELEPORT_END_REACT\020\251\004\022\023\n\016ACT_DOT"
+  "A_SHRUG\020\252\004\022\034\n\027ACT_DOTA_RELAX_LOOP_END\020\253\004"
+  "\022\032\n\025ACT_DOTA_PRESENT_ITEM\020\254\004\022\034\n\027ACT_DOTA"
+  "_IDLE_IMPATIENT\020\255\004\022\034\n\027ACT_DOTA_SHARPEN_W"
+  "EAPON\020\256\004\022 \n\033ACT_DOTA_SHARPEN_WEAPON_OUT\020"
+  "\257\004\022\037\n\032ACT_DOTA_IDLE_SLEEPING_END\020\260\004\022\034\n\027A"
+  "CT_DOTA_BRIDGE_DESTROY\020\261\004\022\032\n\025ACT_DOTA_TA"
+  "UNT_SNIPER\020\262\004\022\035\n\030ACT_DOTA_DEATH_BY_SNIPE"
+  "R\020\263\004\022\031\n\024ACT_DOTA_LOOK_AROUND\020\264\004\022\036\n\031ACT_D"
+  "OTA_CAGED_CREEP_RAGE\020\265\004\022\"\n\035ACT_DOTA_CAGE"
+  "D_CREEP_RAGE_OUT\020\266\004\022\037\n\032ACT_DOTA_CAGED_CR"
+  "EEP_SMASH\020\267\004\022#\n\036ACT_DOTA_CAGED_CREEP_SMA"
+  "SH_OUT\020\270\004\022&\n!ACT_DOTA_IDLE_IMPATIENT_SWO"
+  "RD_TAP\020\271\004\022\030\n\023ACT_DOTA_INTRO_LOOP\020\272\004\022\033\n\026A"
+  "CT_DOTA_BRIDGE_THREAT\020\273\004\022\023\n\016ACT_DOTA_DAG"
+  "ON\020\274\004\022*\n%ACT_DOTA_CAST_ABILITY_2_ES_ROLL"
+  "_START\020\275\004\022$\n\037ACT_DOTA_CAST_ABILITY_2_ES_"
+  "ROLL\020\276\004\022(\n#ACT_DOTA_CAST_ABILITY_2_ES_RO"
+  "LL_END\020\277\004\022\034\n\027ACT_DOTA_NIAN_PIN_START\020\300\004\022"
+  "\033\n\026ACT_DOTA_NIAN_PIN_LOOP\020\301\004\022\032\n\025ACT_DOTA"
+  "_NIAN_PIN_END\020\302\004\022\027\n\022ACT_DOTA_LEAP_STUN\020\303"
+  "\004\022\030\n\023ACT_DOTA_LEAP_SWIPE\020\304\004\022\035\n\030ACT_DOTA_"
+  "NIAN_INTRO_LEAP\020\305\004\022\027\n\022ACT_DOTA_AREA_DENY"
+  "\020\306\004\022\036\n\031ACT_DOTA_NIAN_PIN_TO_STUN\020\307\004\022\024\n\017A"
+  "CT_DOTA_RAZE_1\020\310\004\022\024\n\017ACT_DOTA_RAZE_2\020\311\004\022"
+  "\024\n\017ACT_DOTA_RAZE_3\020\312\004\022\033\n\026ACT_DOTA_UNDYIN"
+  "G_DECAY\020\313\004\022\036\n\031ACT_DOTA_UNDYING_SOUL_RIP\020"
+  "\314\004\022\037\n\032ACT_DOTA_UNDYING_TOMBSTONE\020\315\004\022\"\n\035A"
+  "CT_DOTA_WHIRLING_AXES_RANGED\020\316\004\022\033\n\026ACT_D"
+  "OTA_SHALLOW_GRAVE\020\317\004\022\027\n\022ACT_DOTA_COLD_FE"
+  "ET\020\320\004\022\030\n\023ACT_DOTA_ICE_VORTEX\020\321\004\022\034\n\027ACT_D"
+  "OTA_CHILLING_TOUCH\020\322\004\022\026\n\021ACT_DOTA_ENFEEB"
+  "LE\020\323\004\022\031\n\024ACT_DOTA_FATAL_BONDS\020\324\004\022\034\n\027ACT_"
+  "DOTA_MIDNIGHT_PULSE\020\325\004\022\036\n\031ACT_DOTA_ANCES"
+  "TRAL_SPIRIT\020\326\004\022\034\n\027ACT_DOTA_THUNDER_STRIK"
+  "E\020\327\004\022\033\n\026ACT_DOTA_KINETIC_FIELD\020\330\004\022\032\n\025ACT"
+  "_DOTA_STATIC_STORM\020\331\004\022\030\n\023ACT_DOTA_MINI_T"
+  "AUNT\020\332\004\022\035\n\030ACT_DOTA_ARCTIC_BURN_END\020\333\004\022\032"
+  "\n\025ACT_DOTA_LOADOUT_RARE\020\334\004\022\022\n\rACT_DOTA_S"
+  "WIM\020\335\004\022\022\n\rACT_DOTA_FLEE\020\336\004\022\022\n\rACT_DOTA_T"
+  "ROT\020\337\004\022\023\n\016ACT_DOTA_SHAKE\020\340\004\022\027\n\022ACT_DOTA_"
+  "SWIM_IDLE\020\341\004\022\027\n\022ACT_DOTA_WAIT_IDLE\020\342\004\022\023\n"
+  "\016ACT_DOTA_GREET\020\343\004\022!\n\034ACT_DOTA_TELEPORT_"
+  "COOP_START\020\344\004\022 \n\033ACT_DOTA_TELEPORT_COOP_"
+  "WAIT\020\345\004\022\037\n\032ACT_DOTA_TELEPORT_COOP_END\020\346\004"
+  "\022 \n\033ACT_DOTA_TELEPORT_COOP_EXIT\020\347\004\022%\n AC"
+  "T_DOTA_SHOPKEEPER_PET_INTERACT\020\350\004\022\031\n\024ACT"
+  "_DOTA_ITEM_PICKUP\020\351\004\022\027\n\022ACT_DOTA_ITEM_DR"
+  "OP\020\352\004\022\031\n\024ACT_DOTA_CAPTURE_PET\020\353\004\022\037\n\032ACT_"
+  "DOTA_PET_WARD_OBSERVER\020\354\004\022\035\n\030ACT_DOTA_PE"
+  "T_WARD_SENTRY\020\355\004\022\027\n\022ACT_DOTA_PET_LEVEL\020\356"
+  "\004\022\035\n\030ACT_DOTA_CAST_BURROW_END\020\357\004\022$\n\037ACT_"
+  "DOTA_LIFESTEALER_ASSIMILATE\020\360\004\022\037\n\032ACT_DO"
+  "TA_LIFESTEALER_EJECT\020\361\004\022\037\n\032ACT_DOTA_ATTA"
+  "CK_EVENT_BASH\020\362\004\022\032\n\025ACT_DOTA_CAPTURE_RAR"
+  "E\020\363\004B\005H\001\200\001\000"
+  ;
+static ::_pbi::once_flag descriptor_table_ai_5factivity_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ai_5factivity_2eproto = {
+    false, false, 17531, descriptor_table_protodef_ai_5factivity_2eproto,
+    "ai_activity.proto",
+    &descriptor_table_ai_5factivity_2eproto_once, nullptr, 0, 0,
+    schemas, file_default_instances, TableStruct_ai_5factivity_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_ai_5factivity_2eproto,
+    file_level_service_descriptors_ai_5factivity_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ai_5factivity_2eproto_getter() {
+  return &descriptor_table_ai_5factivity_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ai_5factivity_2eproto(&descriptor_table_ai_5factivity_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Activity_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ai_5factivity_2eproto);
+  return file_level_enum_descriptors_ai_5factivity_2eproto[0];
+}
+bool Activity_IsValid(int value) {
+  switch (value) {
+    case -1:
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+    case 30:
+    case 31:
+    case 32:
+    case 33:
+    case 34:
+    case 35:
+    case 36:
+    case 37:
+    case 38:
+    case 39:
+    case 40:
+    case 41:
+    case 42:
+    case 43:
+    case 44:
+    case 45:
+    case 46:
+    case 47:
+    case 48:
+    case 49:
+    case 50:
+    case 51:
+    case 52:
+    case 53:
+    case 54:
+    case 55:
+    case 56:
+    case 57:
+    case 58:
+    case 59:
+    case 60:
+    case 61:
+    case 62:
+    case 63:
+    case 64:
+    case 65:
+    case 66:
+    case 67:
+    case 68:
+    case 69:
+    case 70:
+    case 71:
+    case 72:
+    case 73:
+    case 74:
+    case 75:
+    case 76:
+    case 77:
+    case 78:
+    case 79:
+    case 80:
+    case 81:
+    case 82:
+    case 83:
+    case 84:
+    case 85:
+    case 86:
+    case 87:
+    case 88:
+    case 89:
+    case 90:
+    case 91:
+    case 92:
+    case 93:
+    case 94:
+    case 95:
+    case 96:
+    case 97:
+    case 98:
+    case 99:
+    case 100:
+    case 101:
+    case 102:
+    case 103:
+    case 104:
+    case 105:
+    case 106:
+    case 107:
+    case 108:
+    case 109:
+    case 110:
+    case 111:
+    case 112:
+    case 113:
+    case 114:
+    case 115:
+    case 116:
+    case 117:
+    case 118:
+    case 119:
+    case 120:
+    case 121:
+    case 122:
+    case 123:
+    case 124:
+    case 125:
+    case 126:
+    case 127:
+    case 128:
+    case 129:
+    case 130:
+    case 131:
+    case 132:
+    case 133:
+    case 134:
+    case 135:
+    case 136:
+    case 137:
+    case 138:
+    case 139:
+    case 140:
+    case 141:
+    case 142:
+    case 143:
+    case 144:
+    case 145:
+    case 146:
+    case 147:
+    case 148:
+    case 149:
+    case 150:
+    case 151:
+    case 152:
+    case 153:
+    case 154:
+    case 155:
+    case 156:
+    case 157:
+    case 158:
+    case 159:
+    case 160:
+    case 161:
+    case 162:
+    case 163:
+    case 164:
+    case 165:
+    case 166:
+    case 167:
+    case 168:
+    case 169:
+    case 170:
+    case 171:
+    case 172:
+    case 173:
+    case 174:
+    case 175:
+    case 176:
+    case 177:
+    case 178:
+    case 179:
+    case 180:
+    case 181:
+    case 182:
+    case 183:
+    case 184:
+    case 185:
+    case 186:
+    case 187:
+    case 188:
+    case 189:
+    case 190:
+    case 191:
+    case 192:
+    case 193:
+    case 194:
+    case 195:
+    case 196:
+    case 197:
+    case 198:
+    case 199:
+    case 200:
+    case 201:
+    case 202:
+    case 203:
+    case 204:
+    case 205:
+    case 206:
+    case 207:
+    case 208:
+    case 209:
+    case 210:
+    case 211:
+    case 212:
+    case 213:
+    case 214:
+    case 215:
+    case 216:
+    case 217:
+    case 218:
+    case 219:
+    case 220:
+    case 221:
+    case 222:
+    case 223:
+    case 224:
+    case 225:
+    case 226:
+    case 227:
+    case 228:
+    case 229:
+    case 230:
+    case 231:
+    case 232:
+    case 233:
+    case 234:
+    case 235:
+    case 236:
+    case 237:
+    case 238:
+    case 239:
+    case 240:
+    case 241:
+    case 242:
+    case 243:
+    case 244:
+    case 245:
+    case 246:
+    case 247:
+    case 248:
+    case 249:
+    case 250:
+    case 251:
+    case 252:
+    case 253:
+    case 254:
+    case 255:
+    case 256:
+    case 257:
+    case 258:
+    case 259:
+    case 260:
+    case 261:
+    case 262:
+    case 263:
+    case 264:
+    case 265:
+    case 266:
+    case 267:
+    case 268:
+    case 269:
+    case 270:
+    case 271:
+    case 272:
+    case 273:
+    case 274:
+    case 275:
+    case 276:
+    case 277:
+    case 278:
+    case 279:
+    case 280:
+    case 281:
+    case 282:
+    case 283:
+    case 284:
+    case 285:
+    case 286:
+    case 287:
+    case 288:
+    case 289:
+    case 290:
+    case 291:
+    case 292:
+    case 293:
+    case 294:
+    case 295:
+    case 296:
+    case 297:
+    case 298:
+    case 299:
+    case 300:
+    case 301:
+    case 302:
+    case 303:
+    case 304:
+    case 305:
+    case 306:
+    case 307:
+    case 308:
+    case 309:
+    case 310:
+    case 311:
+    case 312:
+    case 313:
+    case 314:
+    case 315:
+    case 316:
+    case 317:
+    case 318:
+    case 319:
+    case 320:
+    case 321:
+    case 322:
+    case 323:
+    case 324:
+    case 325:
+    case 326:
+    case 327:
+    case 328:
+    case 329:
+    case 330:
+    case 331:
+    case 332:
+    case 333:
+    case 334:
+    case 335:
+    case 336:
+    case 337:
+    case 338:
+    case 339:
+    case 340:
+    case 341:
+    case 342:
+    case 343:
+    case 344:
+    case 345:
+    case 346:
+    case 347:
+    case 348:
+    case 349:
+    case 350:
+    case 351:
+    case 352:
+    case 353:
+    case 354:
+    case 355:
+    case 356:
+    case 357:
+    case 358:
+    case 359:
+    case 360:
+    case 361:
+    case 362:
+    case 363:
+    case 364:
+    case 365:
+    case 366:
+    case 367:
+    case 368:
+    case 369:
+    case 370:
+    case 371:
+    case 372:
+    case 373:
+    case 374:
+    case 375:
+    case 376:
+    case 377:
+    case 378:
+    case 379:
+    case 380:
+    case 381:
+    case 382:
+    case 383:
+    case 384:
+    case 385:
+    case 386:
+    case 387:
+    case 388:
+    case 389:
+    case 390:
+    case 391:
+    case 392:
+    case 393:
+    case 394:
+    case 395:
+    case 396:
+    case 397:
+    case 398:
+    case 399:
+    case 400:
+    case 401:
+    case 402:
+    case 403:
+    case 404:
+    case 405:
+    case 406:
+    case 407:
+    case 408:
+    case 409:
+    case 410:
+    case 411:
+    case 412:
+    case 413:
+    case 414:
+    case 415:
+    case 416:
+    case 417:
+    case 418:
+    case 419:
+    case 421:
+    case 422:
+    case 424:
+    case 425:
+    case 426:
+    case 427:
+    case 428:
+    case 429:
+    case 430:
+    case 431:
+    case 432:
+    case 433:
+    case 434:
+    case 435:
+    case 436:
+    case 437:
+    case 438:
+    case 439:
+    case 440:
+    case 441:
+    case 442:
+    case 443:
+    case 444:
+    case 445:
+    case 446:
+    case 447:
+    case 448:
+    case 449:
+    case 450:
+    case 451:
+    case 452:
+    case 453:
+    case 454:
+    case 455:
+    case 456:
+    case 457:
+    case 458:
+    case 459:
+    case 460:
+    case 461:
+    case 462:
+    case 463:
+    case 464:
+    case 465:
+    case 466:
+    case 467:
+    case 468:
+    case 469:
+    case 470:
+    case 471:
+    case 472:
+    case 473:
+    case 474:
+    case 475:
+    case 476:
+    case 477:
+    case 478:
+    case 479:
+    case 480:
+    case 481:
+    case 482:
+    case 483:
+    case 484:
+    case 485:
+    case 486:
+    case 487:
+    case 488:
+    case 489:
+    case 490:
+    case 491:
+    case 492:
+    case 493:
+    case 494:
+    case 495:
+    case 496:
+    case 497:
+    case 498:
+    case 499:
+    case 500:
+    case 501:
+    case 502:
+    case 503:
+    case 504:
+    case 505:
+    case 506:
+    case 507:
+    case 508:
+    case 509:
+    case 510:
+    case 511:
+    case 512:
+    case 513:
+    case 514:
+    case 515:
+    case 516:
+    case 517:
+    case 518:
+    case 519:
+    case 520:
+    case 521:
+    case 522:
+    case 523:
+    case 524:
+    case 525:
+    case 526:
+    case 527:
+    case 528:
+    case 529:
+    case 530:
+    case 531:
+    case 532:
+    case 533:
+    case 534:
+    case 535:
+    case 536:
+    case 537:
+    case 538:
+    case 539:
+    case 540:
+    case 541:
+    case 542:
+    case 543:
+    case 544:
+    case 545:
+    case 546:
+    case 547:
+    case 548:
+    case 549:
+    case 550:
+    case 551:
+    case 552:
+    case 553:
+    case 554:
+    case 555:
+    case 556:
+    case 557:
+    case 558:
+    case 559:
+    case 560:
+    case 561:
+    case 562:
+    case 563:
+    case 564:
+    case 565:
+    case 566:
+    case 567:
+    case 568:
+    case 569:
+    case 570:
+    case 571:
+    case 572:
+    case 573:
+    case 574:
+    case 575:
+    case 576:
+    case 577:
+    case 578:
+    case 579:
+    case 580:
+    case 581:
+    case 582:
+    case 583:
+    case 584:
+    case 585:
+    case 586:
+    case 587:
+    case 588:
+    case 589:
+    case 590:
+    case 591:
+    case 592:
+    case 593:
+    case 594:
+    case 595:
+    case 596:
+    case 597:
+    case 598:
+    case 599:
+    case 600:
+    case 601:
+    case 602:
+    case 603:
+    case 604:
+    case 605:
+    case 606:
+    case 607:
+    case 608:
+    case 609:
+    case 610:
+    case 611:
+    case 612:
+    case 613:
+    case 614:
+    case 615:
+    case 616:
+    case 617:
+    case 618:
+    case 619:
+    case 620:
+    case 621:
+    case 622:
+    case 623:
+    case 624:
+    case 625:
+    case 626:
+    case 627:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -25,22 +25,32 @@
 
 // Core
 #include <alice/config.hpp>
+#include <alice/async.hpp>
+#include <alice/batch.hpp>
 #include <alice/bitstream.hpp>
+#include <alice/columns.hpp>
 #include <alice/delegate.hpp>
 #include <alice/dem.hpp>
+#include <alice/dem_index.hpp>
+#include <alice/dem_stream_buffer.hpp>
 #include <alice/dem_stream_bzip2.hpp>
+#include <alice/dem_stream_compressed.hpp>
 #include <alice/dem_stream_file.hpp>
 #include <alice/dem_stream_memory.hpp>
+#include <alice/dem_stream_mmap.hpp>
 #include <alice/entity.hpp>
 #include <alice/exception.hpp>
 #include <alice/handler.hpp>
+#include <alice/message_registry.hpp>
 #include <alice/multiindex.hpp>
 #include <alice/parser.hpp>
 #include <alice/property.hpp>
 #include <alice/sendprop.hpp>
 #include <alice/sendtable.hpp>
 #include <alice/settings.hpp>
+#include <alice/stats.hpp>
 #include <alice/stringtable.hpp>
+#include <alice/tick_batch.hpp>
 
 // Protobuf objects
 #include <alice/ai_activity.pb.h>
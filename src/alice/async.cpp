@@ -0,0 +1,190 @@
+/**
+ * @file async.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chrono>
+
+#include <alice/async.hpp>
+
+namespace dota {
+    async_consumer::async_consumer(handler_t* h, consumer_t fn, std::size_t capacity, overflow_policy policy)
+        : h(h), fn(std::move(fn)), ring(capacity), policy(policy), done(false), dropped(0)
+    {
+        worker = std::thread(&async_consumer::work, this);
+    }
+
+    async_consumer::~async_consumer() {
+        for (auto &s : subs) {
+            switch (s.first) {
+                case msgStatus::id:
+                    handlerRemoveCallback(h, msgStatus, s.second, async_consumer, onStatus)
+                    break;
+                case msgDem::id:
+                    handlerRemoveCallback(h, msgDem, s.second, async_consumer, onDem)
+                    break;
+                case msgUser::id:
+                    handlerRemoveCallback(h, msgUser, s.second, async_consumer, onUser)
+                    break;
+                case msgNet::id:
+                    handlerRemoveCallback(h, msgNet, s.second, async_consumer, onNet)
+                    break;
+                case msgEntity::id:
+                    handlerRemoveCallback(h, msgEntity, s.second, async_consumer, onEntity)
+                    break;
+                case msgEntityDelta::id:
+                    handlerRemoveCallback(h, msgEntityDelta, s.second, async_consumer, onDelta)
+                    break;
+            }
+        }
+
+        stop();
+    }
+
+    void async_consumer::stop() {
+        if (!worker.joinable())
+            return;
+
+        done.store(true, std::memory_order_release);
+        worker.join();
+    }
+
+    void async_consumer::subscribe(msgStatus, uint32_t id) {
+        handlerRegisterCallback(h, msgStatus, id, async_consumer, onStatus)
+    }
+
+    void async_consumer::subscribe(msgDem, uint32_t id) {
+        handlerRegisterCallback(h, msgDem, id, async_consumer, onDem)
+    }
+
+    void async_consumer::subscribe(msgUser, uint32_t id) {
+        handlerRegisterCallback(h, msgUser, id, async_consumer, onUser)
+    }
+
+    void async_consumer::subscribe(msgNet, uint32_t id) {
+        handlerRegisterCallback(h, msgNet, id, async_consumer, onNet)
+    }
+
+    void async_consumer::subscribe(msgEntity, uint32_t id) {
+        handlerRegisterCallback(h, msgEntity, id, async_consumer, onEntity)
+    }
+
+    void async_consumer::subscribe(msgEntityDelta, uint32_t id) {
+        handlerRegisterCallback(h, msgEntityDelta, id, async_consumer, onDelta)
+    }
+
+    void async_consumer::onStatus(handlerCbType(msgStatus) msg) {
+        async_event e = header(msgStatus::id, msg->id, msg->tick);
+        e.status = msg->msg;
+        publish(std::move(e));
+    }
+
+    void async_consumer::onDem(handlerCbType(msgDem) msg) {
+        async_event e = header(msgDem::id, msg->id, msg->tick);
+        e.msg.reset(copy(msg->get<google::protobuf::Message>()));
+        publish(std::move(e));
+    }
+
+    void async_consumer::onUser(handlerCbType(msgUser) msg) {
+        async_event e = header(msgUser::id, msg->id, msg->tick);
+        e.msg.reset(copy(msg->get<google::protobuf::Message>()));
+        publish(std::move(e));
+    }
+
+    void async_consumer::onNet(handlerCbType(msgNet) msg) {
+        async_event e = header(msgNet::id, msg->id, msg->tick);
+        e.msg.reset(copy(msg->get<google::protobuf::Message>()));
+        publish(std::move(e));
+    }
+
+    void async_consumer::onEntity(handlerCbType(msgEntity) msg) {
+        async_event e = header(msgEntity::id, msg->id, msg->tick);
+        e.ent.reset(new entity(*msg->msg));
+        publish(std::move(e));
+    }
+
+    void async_consumer::onDelta(handlerCbType(msgEntityDelta) msg) {
+        async_event e = header(msgEntityDelta::id, msg->id, msg->tick);
+        e.delta.reset(new entity_delta(*msg->msg));
+        publish(std::move(e));
+    }
+
+    async_event async_consumer::header(uint32_t type, uint32_t id, uint32_t tick) {
+        async_event e;
+        e.type = type;
+        e.id = id;
+        e.tick = tick;
+        e.status = 0;
+        return e;
+    }
+
+    google::protobuf::Message* async_consumer::copy(google::protobuf::Message* msg) {
+        google::protobuf::Message* ret = msg->New();
+        ret->CopyFrom(*msg);
+        return ret;
+    }
+
+    void async_consumer::publish(async_event &&e) {
+        if (ring.push(std::move(e)))
+            return;
+
+        if (policy == overflow_drop) {
+            ++dropped;
+            return;
+        }
+
+        // wait for the consumer to make room
+        uint32_t idle = 0;
+        while (!ring.push(std::move(e))) {
+            backoff(idle);
+        }
+    }
+
+    void async_consumer::backoff(uint32_t &idle) {
+        // spin for a bit before going to sleep
+        if (++idle < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    void async_consumer::work() {
+        async_event e;
+        uint32_t idle = 0;
+
+        while (true) {
+            // read before popping, an empty ring after done is set means everything was consumed
+            const bool finished = done.load(std::memory_order_acquire);
+
+            if (ring.pop(e)) {
+                fn(e);
+                e = async_event();
+                idle = 0;
+                continue;
+            }
+
+            if (finished)
+                break;
+
+            backoff(idle);
+        }
+    }
+}
@@ -0,0 +1,243 @@
+/**
+ * @file async.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef _DOTA_ASYNC_HPP_
+#define _DOTA_ASYNC_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <google/protobuf/message.h>
+
+#include <alice/entity.hpp>
+#include <alice/handler.hpp>
+
+/// Default number of events an async_consumer can queue
+#define DOTA_ASYNC_CAPACITY 4096
+
+namespace dota {
+    /// @defgroup CORE Core
+    /// @{
+
+    /**
+     * Lock-free ring buffer for a single producer and a single consumer.
+     *
+     * The capacity is rounded up to the next power of two.
+     */
+    template <typename T>
+    class spsc_ring {
+        public:
+            /** Constructor, allocates all slots */
+            spsc_ring(std::size_t capacity) : slots(roundUp(capacity)), mask(slots.size() - 1), head(0), tail(0) {}
+
+            /** Copy constructor, don't allow copying */
+            spsc_ring(const spsc_ring&) = delete;
+
+            /** Adds an entry, returns false and leaves v untouched if the ring is full. Producer only. */
+            bool push(T&& v) {
+                const std::size_t h = head.load(std::memory_order_relaxed);
+                if (h - tail.load(std::memory_order_acquire) == slots.size())
+                    return false;
+
+                slots[h & mask] = std::move(v);
+                head.store(h + 1, std::memory_order_release);
+                return true;
+            }
+
+            /** Removes the oldest entry, returns false if the ring is empty. Consumer only. */
+            bool pop(T& v) {
+                const std::size_t t = tail.load(std::memory_order_relaxed);
+                if (t == head.load(std::memory_order_acquire))
+                    return false;
+
+                v = std::move(slots[t & mask]);
+                tail.store(t + 1, std::memory_order_release);
+                return true;
+            }
+
+            /** Returns the number of queued entries */
+            std::size_t size() const {
+                return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+            }
+
+            /** Returns the maximum number of entries */
+            std::size_t capacity() const {
+                return slots.size();
+            }
+        private:
+            /** Entries */
+            std::vector<T> slots;
+            /** Size - 1, used to wrap positions */
+            std::size_t mask;
+            /** Next position to write, only changed by the producer */
+            alignas(64) std::atomic<std::size_t> head;
+            /** Next position to read, only changed by the consumer */
+            alignas(64) std::atomic<std::size_t> tail;
+
+            /** Returns the next power of two */
+            static std::size_t roundUp(std::size_t n) {
+                std::size_t r = 1;
+                while (r < n)
+                    r <<= 1;
+
+                return r;
+            }
+    };
+
+    /**
+     * Copy of a callback payload that can be handed to another thread.
+     *
+     * Only the member matching type is set. Messages, entities and deltas are owned by the event.
+     */
+    struct async_event {
+        /** Handler type, e.g. msgNet::id */
+        uint32_t type;
+        /** Message id or entity class id */
+        uint32_t id;
+        /** Tick the event happened at */
+        uint32_t tick;
+        /** Status for msgStatus */
+        uint32_t status;
+        /** Copy of the message for msgDem, msgUser and msgNet */
+        std::unique_ptr<google::protobuf::Message> msg;
+        /** Snapshot of the entity for msgEntity */
+        std::unique_ptr<entity> ent;
+        /** Copy of the delta for msgEntityDelta */
+        std::unique_ptr<entity_delta> delta;
+
+        /** Casts message into the specified type and returns it. */
+        template <typename T>
+        T* get() {
+            return static_cast<T*>(msg.get());
+        }
+    };
+
+    /**
+     * Runs a callback on its own thread for all messages it is subscribed to.
+     *
+     * The parse thread copies each payload into an event and publishes it into a ring buffer owned
+     * by this consumer. Entities are copied as a whole, the copy is not affected by later updates.
+     * When the ring is full, the parse thread either waits for the consumer or drops the event,
+     * depending on the overflow policy.
+     *
+     * The consumer subscribes to the handler of a parser and has to be destroyed before it.
+     * msgTick subscriptions are not supported.
+     */
+    class async_consumer {
+        public:
+            /** Callback run on the consumer thread */
+            typedef std::function<void (async_event&)> consumer_t;
+
+            /** What to do when the ring is full */
+            enum overflow_policy {
+                overflow_block = 0, // wait for the consumer, parsing pauses
+                overflow_drop       // discard the event and count it
+            };
+
+            /** Constructor, starts the consumer thread */
+            async_consumer(handler_t* h, consumer_t fn, std::size_t capacity = DOTA_ASYNC_CAPACITY,
+                overflow_policy policy = overflow_block);
+
+            /** Copy constructor, don't allow copying */
+            async_consumer(const async_consumer&) = delete;
+
+            /** Destructor, unsubscribes and waits for all events to be consumed */
+            ~async_consumer();
+
+            /** Publish all messages of the given type and id */
+            template <typename Type>
+            void subscribe(uint32_t id) {
+                subscribe(Type(), id);
+                subs.push_back(std::make_pair((uint32_t)Type::id, id));
+            }
+
+            /** Waits until all published events are consumed and stops the consumer thread */
+            void stop();
+
+            /** Returns the number of events waiting to be consumed */
+            std::size_t getPending() const {
+                return ring.size();
+            }
+
+            /** Returns the number of events dropped because the ring was full */
+            uint64_t getDropped() const {
+                return dropped.load();
+            }
+        private:
+            /** Handler we are subscribed to */
+            handler_t* h;
+            /** User callback */
+            consumer_t fn;
+            /** Events waiting to be consumed */
+            spsc_ring<async_event> ring;
+            /** Overflow policy */
+            overflow_policy policy;
+            /** Set once no more events are published */
+            std::atomic<bool> done;
+            /** Number of dropped events */
+            std::atomic<uint64_t> dropped;
+            /** Subscriptions as type / id */
+            std::vector<std::pair<uint32_t, uint32_t>> subs;
+            /** Consumer thread */
+            std::thread worker;
+
+            /** Subscribe implementation per type */
+            void subscribe(msgStatus, uint32_t id);
+            void subscribe(msgDem, uint32_t id);
+            void subscribe(msgUser, uint32_t id);
+            void subscribe(msgNet, uint32_t id);
+            void subscribe(msgEntity, uint32_t id);
+            void subscribe(msgEntityDelta, uint32_t id);
+
+            /** Callbacks, copy the payload and publish it */
+            void onStatus(handlerCbType(msgStatus) msg);
+            void onDem(handlerCbType(msgDem) msg);
+            void onUser(handlerCbType(msgUser) msg);
+            void onNet(handlerCbType(msgNet) msg);
+            void onEntity(handlerCbType(msgEntity) msg);
+            void onDelta(handlerCbType(msgEntityDelta) msg);
+
+            /** Returns an event with only the header set */
+            static async_event header(uint32_t type, uint32_t id, uint32_t tick);
+
+            /** Returns a heap copy of the message */
+            static google::protobuf::Message* copy(google::protobuf::Message* msg);
+
+            /** Puts an event into the ring according to the overflow policy */
+            void publish(async_event &&e);
+
+            /** Waits for the other thread, yields first and sleeps once idle gets larger */
+            static void backoff(uint32_t &idle);
+
+            /** Consumer loop */
+            void work();
+    };
+
+    /// @}
+}
+
+#endif // _DOTA_ASYNC_HPP_
@@ -0,0 +1,174 @@
+/**
+ * @file batch.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <thread>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/exception/diagnostic_information.hpp>
+
+#include <alice/config.hpp>
+#include <alice/batch.hpp>
+#include <alice/dem_stream_file.hpp>
+
+#if DOTA_DECOMPRESS
+#include <alice/dem_stream_compressed.hpp>
+#endif // DOTA_DECOMPRESS
+
+namespace dota {
+    batch::batch(const settings s, setup_t setup, uint32_t threads)
+        : set(s), setup(std::move(setup)), threads(threads)
+    {
+        if (this->threads == 0)
+            this->threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    void batch::add(std::string path) {
+        // determine the size, unreadable files are sorted last and fail when opened
+        uint64_t size = 0;
+        std::ifstream f(path.c_str(), std::ifstream::in | std::ifstream::binary | std::ifstream::ate);
+        if (f.is_open())
+            size = f.tellg();
+
+        pending.push_back(task{std::move(path), size});
+    }
+
+    void batch::add(std::istream &paths) {
+        std::string path;
+        while (std::getline(paths, path)) {
+            if (!path.empty())
+                add(path);
+        }
+    }
+
+    std::vector<batch_result> batch::run() {
+        results.clear();
+        results.reserve(pending.size());
+
+        // largest first
+        std::stable_sort(pending.begin(), pending.end(), [](const task &a, const task &b) {
+            return a.size > b.size;
+        });
+
+        // deal the replays round-robin so each worker starts with a similar amount of work
+        std::vector<worker_queue> queues(threads);
+        for (std::size_t i = 0; i < pending.size(); ++i) {
+            queues[i % threads].tasks.push_back(std::move(pending[i]));
+        }
+        pending.clear();
+
+        std::vector<std::thread> workers;
+        for (uint32_t i = 0; i < threads; ++i) {
+            workers.push_back(std::thread(&batch::work, this, std::ref(queues), i));
+        }
+
+        for (auto &w : workers) {
+            w.join();
+        }
+
+        return std::move(results);
+    }
+
+    void batch::work(std::vector<worker_queue> &queues, uint32_t id) {
+        task t;
+        while (next(queues, id, t)) {
+            batch_result r = parse(t, id);
+
+            std::lock_guard<std::mutex> lock(resultLock);
+            if (report)
+                report(r);
+
+            results.push_back(std::move(r));
+        }
+    }
+
+    bool batch::next(std::vector<worker_queue> &queues, uint32_t id, task &t) {
+        // own queue, largest remaining replay
+        {
+            std::lock_guard<std::mutex> lock(queues[id].lock);
+            if (!queues[id].tasks.empty()) {
+                t = std::move(queues[id].tasks.front());
+                queues[id].tasks.pop_front();
+                return true;
+            }
+        }
+
+        // steal from the back of the others, starting with our neighbour
+        for (uint32_t i = 1; i < queues.size(); ++i) {
+            worker_queue &q = queues[(id + i) % queues.size()];
+
+            std::lock_guard<std::mutex> lock(q.lock);
+            if (!q.tasks.empty()) {
+                t = std::move(q.tasks.back());
+                q.tasks.pop_back();
+                return true;
+            }
+        }
+
+        // tasks are never added during a run, nothing left
+        return false;
+    }
+
+    batch_result batch::parse(const task &t, uint32_t id) {
+        batch_result r {t.path, t.size, false, "", 0, 0, 0, id};
+        const auto start = std::chrono::steady_clock::now();
+
+        try {
+            dem_stream* stream;
+            if (streams) {
+                stream = streams(t.path);
+            }
+            #if DOTA_DECOMPRESS
+            else if (!boost::algorithm::ends_with(t.path, ".dem")) {
+                stream = new dem_stream_compressed;
+            }
+            #endif // DOTA_DECOMPRESS
+            else {
+                stream = new dem_stream_file;
+            }
+
+            parser p(set, stream);
+            if (setup)
+                setup(&p, t.path);
+
+            p.open(t.path);
+            p.handle();
+
+            r.success = true;
+            r.ticks = p.getTick();
+            r.msgs = p.getMsgCount();
+        } catch (boost::exception &e) {
+            r.error = boost::diagnostic_information(e);
+        } catch (std::exception &e) {
+            r.error = e.what();
+        }
+
+        r.usec = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+
+        return r;
+    }
+}
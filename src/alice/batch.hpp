@@ -0,0 +1,158 @@
+/**
+ * @file batch.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef _DOTA_BATCH_HPP_
+#define _DOTA_BATCH_HPP_
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <istream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <alice/dem.hpp>
+#include <alice/parser.hpp>
+#include <alice/settings.hpp>
+
+namespace dota {
+    /// @defgroup CORE Core
+    /// @{
+
+    /** Outcome of parsing a single replay in a batch */
+    struct batch_result {
+        /** Path of the replay */
+        std::string path;
+        /** Size of the file in bytes */
+        uint64_t size;
+        /** Whether the replay was parsed completely */
+        bool success;
+        /** Error description if parsing failed */
+        std::string error;
+        /** Number of ticks parsed */
+        uint32_t ticks;
+        /** Number of messages parsed */
+        uint32_t msgs;
+        /** Time spent parsing in microseconds, including open */
+        uint64_t usec;
+        /** Worker that parsed the replay */
+        uint32_t worker;
+    };
+
+    /**
+     * Parses a set of replays in parallel.
+     *
+     * Replays are sorted by file size and handed out largest first so a big replay does not end up
+     * being parsed alone after everything else is done. Each worker owns a queue and takes from
+     * its front; idle workers steal from the back of the other queues.
+     *
+     * Every replay gets its own parser. The setup function is called with it before parsing starts
+     * and should register all callbacks. It is called from the worker threads and must be safe to
+     * call concurrently.
+     */
+    class batch {
+        public:
+            /** Called with a fresh parser before the replay is parsed */
+            typedef std::function<void (parser*, const std::string&)> setup_t;
+            /** Called after each replay, calls are serialized */
+            typedef std::function<void (const batch_result&)> report_t;
+            /** Creates the stream for a replay */
+            typedef std::function<dem_stream* (const std::string&)> stream_t;
+
+            /** Constructor, a thread count of 0 uses the number of cores */
+            batch(const settings s, setup_t setup, uint32_t threads = 0);
+
+            /** Add a single replay */
+            void add(std::string path);
+
+            /** Add all replays from a stream, one path per line */
+            void add(std::istream &paths);
+
+            /** Add a range of replay paths */
+            template <typename It>
+            void add(It begin, It end) {
+                for (; begin != end; ++begin)
+                    add(*begin);
+            }
+
+            /** Set a function that gets called after each replay */
+            void setReport(report_t r) {
+                report = std::move(r);
+            }
+
+            /** Set a function that creates the stream for a replay, overrides the default choice */
+            void setStreams(stream_t s) {
+                streams = std::move(s);
+            }
+
+            /** Parse all added replays, blocks until done and returns the results in completion order */
+            std::vector<batch_result> run();
+        private:
+            /** A replay waiting to be parsed */
+            struct task {
+                /** Path of the replay */
+                std::string path;
+                /** Size of the file in bytes */
+                uint64_t size;
+            };
+
+            /** Queue owned by a worker */
+            struct worker_queue {
+                /** Pending replays, largest at the front */
+                std::deque<task> tasks;
+                /** Synchronisation for tasks */
+                std::mutex lock;
+            };
+
+            /** Settings for each parser */
+            const settings set;
+            /** Parser setup */
+            setup_t setup;
+            /** Result reporting */
+            report_t report;
+            /** Stream factory */
+            stream_t streams;
+            /** Number of workers */
+            uint32_t threads;
+            /** Replays added but not yet run */
+            std::vector<task> pending;
+
+            /** Results of the current run */
+            std::vector<batch_result> results;
+            /** Synchronisation for results and report */
+            std::mutex resultLock;
+
+            /** Worker loop */
+            void work(std::vector<worker_queue> &queues, uint32_t id);
+
+            /** Get the next task for worker id, false if all queues are empty */
+            bool next(std::vector<worker_queue> &queues, uint32_t id, task &t);
+
+            /** Parse a single replay */
+            batch_result parse(const task &t, uint32_t id);
+    };
+
+    /// @}
+}
+
+#endif // _DOTA_BATCH_HPP_
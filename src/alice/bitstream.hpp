@@ -115,15 +115,19 @@ namespace dota {
             bitstream() : data{}, pos{0}, size{0} { }
 
             /** Creates a bitstream from a std::string */
-            bitstream(const std::string &str) : data{}, pos{0}, size{str.size()*8} {
-                if (str.size() > DOTA_BITSTREAM_MAX_SIZE)
-                    BOOST_THROW_EXCEPTION( bitstreamDataSize() << (EArgT<1, std::size_t>::info(str.size())) );
+            bitstream(const std::string &str) : bitstream(str.c_str(), str.size()) {}
+
+            /** Creates a bitstream from n bytes of raw data */
+            bitstream(const char* str, const std::size_t n) : data{}, pos{0}, size{n*8} {
+                if (n > DOTA_BITSTREAM_MAX_SIZE)
+                    BOOST_THROW_EXCEPTION( bitstreamDataSize() << (EArgT<1, std::size_t>::info(n)) );
 
                 // Reserve the memory in beforehand so we can just memcpy everything
-                data.resize((str.size() + 3) / 4 + 1);
-                memcpy(&data[0], str.c_str(), str.size());
+                data.resize((n + 3) / 4 + 1);
+                if (n)
+                    memcpy(&data[0], str, n);
 
-                D_( std::cout << "[bitstream] Reserving " << (str.size() + 3) / 4 + 1 << " bytes of memory " << D_FILE << " " << __LINE__ << std::endl;, 2 )
+                D_( std::cout << "[bitstream] Reserving " << (n + 3) / 4 + 1 << " bytes of memory " << D_FILE << " " << __LINE__ << std::endl;, 2 )
             }
 
             /** Copy-Constructor */
@@ -0,0 +1,204 @@
+/**
+ * @file columns.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <alice/bitstream.hpp>
+#include <alice/columns.hpp>
+
+namespace dota {
+    /** Returns the column type for a decoder, matching the type property::update stores */
+    column_type columnFor(const decode_op &op) {
+        switch (op.code) {
+            case decode_int:
+            case decode_varint:
+                return column_int;
+            case decode_uint:
+            case decode_varuint:
+                return column_uint;
+            case decode_coord:
+            case decode_coord_mp:
+            case decode_noscale:
+            case decode_normal:
+            case decode_cell_coord:
+            case decode_float:
+                return column_float;
+            case decode_vector:
+            case decode_vector_normal:
+                return column_vector;
+            case decode_vector_xy:
+                return column_vectorxy;
+            case decode_int64:
+            case decode_varint64:
+                return column_int64;
+            case decode_varuint64:
+                return column_uint64;
+            default:
+                return column_side;
+        }
+    }
+
+    column_table::column_table(const flatsendtable &flat) : flat(&flat) {
+        uint32_t counts[column_side + 1] = {0};
+
+        layout.reserve(flat.plan.size());
+        for (auto &op : flat.plan) {
+            const column_type type = columnFor(op);
+            layout.push_back(column_ref{type, counts[type]++});
+        }
+
+        ints.resize(counts[column_int]);
+        uints.resize(counts[column_uint]);
+        floats.resize(counts[column_float]);
+        vectors.resize(counts[column_vector]);
+        vectorsXY.resize(counts[column_vectorxy]);
+        ints64.resize(counts[column_int64]);
+        uints64.resize(counts[column_uint64]);
+        side.resize(counts[column_side]);
+    }
+
+    uint32_t column_table::allocate(uint32_t entityId) {
+        if (!freeRows.empty()) {
+            const uint32_t row = freeRows.back();
+            freeRows.pop_back();
+
+            reset(ints, row);
+            reset(uints, row);
+            reset(floats, row);
+            reset(vectors, row);
+            reset(vectorsXY, row);
+            reset(ints64, row);
+            reset(uints64, row);
+            reset(side, row);
+
+            ids[row] = entityId;
+            return row;
+        }
+
+        grow(ints);
+        grow(uints);
+        grow(floats);
+        grow(vectors);
+        grow(vectorsXY);
+        grow(ints64);
+        grow(uints64);
+        grow(side);
+
+        ids.push_back(entityId);
+        return ids.size() - 1;
+    }
+
+    void column_table::release(uint32_t row) {
+        ids.at(row) = -1;
+        freeRows.push_back(row);
+    }
+
+    void column_table::clear() {
+        ids.clear();
+        freeRows.clear();
+
+        for (auto &c : ints)      c.clear();
+        for (auto &c : uints)     c.clear();
+        for (auto &c : floats)    c.clear();
+        for (auto &c : vectors)   c.clear();
+        for (auto &c : vectorsXY) c.clear();
+        for (auto &c : ints64)    c.clear();
+        for (auto &c : uints64)   c.clear();
+        for (auto &c : side)      c.clear();
+    }
+
+    void column_table::update(uint32_t row, bitstream &bstream, entity_delta* delta) {
+        entity::readFields(bstream, updated);
+
+        for (auto &it : updated) {
+            if (it >= layout.size())
+                BOOST_THROW_EXCEPTION(entityUnkownSendprop()
+                    << (EArgT<1, std::size_t>::info(layout.size()))
+                    << (EArgT<2, std::size_t>::info(ids[row]))
+                );
+
+            // decode into the typed column, only strings and arrays need a property
+            const decode_op &op = flat->plan[it];
+            const column_ref &ref = layout[it];
+
+            switch (ref.type) {
+                case column_int:
+                    ints[ref.column][row] = op.readInt(bstream);
+                    break;
+                case column_uint:
+                    uints[ref.column][row] = op.readUInt(bstream);
+                    break;
+                case column_float:
+                    floats[ref.column][row] = op.readFloat(bstream);
+                    break;
+                case column_vector:
+                    vectors[ref.column][row] = op.readVector(bstream);
+                    break;
+                case column_vectorxy:
+                    vectorsXY[ref.column][row] = op.readVectorXY(bstream);
+                    break;
+                case column_int64:
+                    ints64[ref.column][row] = op.readInt64(bstream);
+                    break;
+                case column_uint64:
+                    uints64[ref.column][row] = op.readUInt64(bstream);
+                    break;
+                case column_side:
+                    set(row, it, property::create(bstream, op));
+                    break;
+            }
+        }
+
+        if (delta != nullptr)
+            delta->entity_fields.assign(updated.begin(), updated.end());
+    }
+
+    void column_table::set(uint32_t row, uint32_t field, property p) {
+        const column_ref &ref = getColumn(field);
+
+        switch (ref.type) {
+            case column_int:
+                ints[ref.column][row] = p.as<IntProperty>();
+                break;
+            case column_uint:
+                uints[ref.column][row] = p.as<UIntProperty>();
+                break;
+            case column_float:
+                floats[ref.column][row] = p.as<FloatProperty>();
+                break;
+            case column_vector:
+                vectors[ref.column][row] = p.as<VectorProperty>();
+                break;
+            case column_vectorxy:
+                vectorsXY[ref.column][row] = p.as<VectorXYProperty>();
+                break;
+            case column_int64:
+                ints64[ref.column][row] = p.as<Int64Property>();
+                break;
+            case column_uint64:
+                uints64[ref.column][row] = p.as<UInt64Property>();
+                break;
+            case column_side:
+                side[ref.column][row] = std::move(p);
+                side[ref.column][row].setName(&flat->properties[field].name);
+                break;
+        }
+    }
+}
@@ -0,0 +1,228 @@
+/**
+ * @file columns.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef _DOTA_COLUMNS_HPP_
+#define _DOTA_COLUMNS_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <alice/entity.hpp>
+#include <alice/exception.hpp>
+#include <alice/property.hpp>
+#include <alice/sendtable.hpp>
+
+namespace dota {
+    /// @defgroup EXCEPTIONS Exceptions
+    /// @{
+
+    /// Thrown when a field is requested as a different type than the column it is stored in
+    CREATE_EXCEPTION( columnBadCast, "Field requested as wrong column type" )
+    /// Thrown when accessing a field or row that doesn't exist
+    CREATE_EXCEPTION( columnUnkownIndex, "Column field / row out of range" )
+
+    /// @}
+
+    // forward declaration
+    class bitstream;
+
+    /// @defgroup CORE Core
+    /// @{
+
+    /** Type of the column a field is stored in */
+    enum column_type : uint8_t {
+        column_int = 0, // IntProperty
+        column_uint,    // UIntProperty
+        column_float,   // FloatProperty
+        column_vector,  // VectorProperty
+        column_vectorxy,// VectorXYProperty
+        column_int64,   // Int64Property
+        column_uint64,  // UInt64Property
+        column_side     // strings and arrays, stored as property
+    };
+
+    /** Location of a field in a column_table */
+    struct column_ref {
+        /** Column type */
+        column_type type;
+        /** Index of the column among those with the same type */
+        uint32_t column;
+    };
+
+    namespace detail {
+        /** Maps a property type to its column type */
+        template <typename T>
+        struct column_of;
+
+        template <> struct column_of<IntProperty>      { static const column_type type = column_int; };
+        template <> struct column_of<UIntProperty>     { static const column_type type = column_uint; };
+        template <> struct column_of<FloatProperty>    { static const column_type type = column_float; };
+        template <> struct column_of<VectorProperty>   { static const column_type type = column_vector; };
+        template <> struct column_of<VectorXYProperty> { static const column_type type = column_vectorxy; };
+        template <> struct column_of<Int64Property>    { static const column_type type = column_int64; };
+        template <> struct column_of<UInt64Property>   { static const column_type type = column_uint64; };
+        template <> struct column_of<property>         { static const column_type type = column_side; };
+    }
+
+    /**
+     * Properties of all entities of a single class, stored as one packed column per field.
+     *
+     * Each entity occupies a row. Ints, floats and vectors are kept in typed columns, strings and
+     * arrays in a side table of properties. The column of each field is computed once from the
+     * decode plan of the class. Columns can be read as a whole, rows of deleted entities are
+     * reused and have their id set to -1.
+     *
+     * Values of fields an entity hasn't received yet are zero.
+     */
+    class column_table {
+        public:
+            /** Constructor, computes the column layout for a flattable */
+            column_table(const flatsendtable &flat);
+
+            /** Copy constructor, don't allow copying */
+            column_table(const column_table&) = delete;
+
+            /** Returns a zeroed row for an entity */
+            uint32_t allocate(uint32_t entityId);
+
+            /** Frees the row for reuse */
+            void release(uint32_t row);
+
+            /** Removes all rows */
+            void clear();
+
+            /** Reads updated fields from the bitstream into a row, fills delta if set */
+            void update(uint32_t row, bitstream &bstream, entity_delta* delta = nullptr);
+
+            /** Stores a decoded property in a row */
+            void set(uint32_t row, uint32_t field, property p);
+
+            /** Returns the number of rows, including free ones */
+            uint32_t size() const {
+                return ids.size();
+            }
+
+            /** Returns the number of fields */
+            uint32_t fields() const {
+                return layout.size();
+            }
+
+            /** Returns the entity id a row belongs to, -1 for free rows */
+            uint32_t getEntityId(uint32_t row) const {
+                return ids.at(row);
+            }
+
+            /** Returns where a field is stored */
+            const column_ref& getColumn(uint32_t field) const {
+                if (field >= layout.size())
+                    BOOST_THROW_EXCEPTION( columnUnkownIndex()
+                        << (EArgT<1, uint32_t>::info(field))
+                    );
+
+                return layout[field];
+            }
+
+            /** Returns the flattable this table has been created for */
+            const flatsendtable* getFlattable() const {
+                return flat;
+            }
+
+            /** Returns all values of a field indexed by row, throws if the field isn't stored as T */
+            template <typename T>
+            std::vector<T>& column(uint32_t field) {
+                const column_ref &ref = getColumn(field);
+                if (ref.type != detail::column_of<T>::type)
+                    BOOST_THROW_EXCEPTION( columnBadCast()
+                        << (EArgT<1, uint32_t>::info(field))
+                        << (EArgT<2, uint32_t>::info(ref.type))
+                    );
+
+                return storage<T>()[ref.column];
+            }
+
+            /** Returns the value of a field in a row, throws if the field isn't stored as T */
+            template <typename T>
+            T& get(uint32_t row, uint32_t field) {
+                if (row >= ids.size())
+                    BOOST_THROW_EXCEPTION( columnUnkownIndex()
+                        << (EArgT<1, uint32_t>::info(row))
+                    );
+
+                return column<T>(field)[row];
+            }
+        private:
+            /** Flattable of the class */
+            const flatsendtable* flat;
+            /** Column per field */
+            std::vector<column_ref> layout;
+            /** Entity id per row */
+            std::vector<uint32_t> ids;
+            /** Rows that can be reused */
+            std::vector<uint32_t> freeRows;
+            /** Field ids read during an update */
+            std::vector<uint32_t> updated;
+
+            /** Typed columns */
+            std::vector<std::vector<IntProperty>> ints;
+            std::vector<std::vector<UIntProperty>> uints;
+            std::vector<std::vector<FloatProperty>> floats;
+            std::vector<std::vector<VectorProperty>> vectors;
+            std::vector<std::vector<VectorXYProperty>> vectorsXY;
+            std::vector<std::vector<Int64Property>> ints64;
+            std::vector<std::vector<UInt64Property>> uints64;
+            /** Strings and arrays */
+            std::vector<std::vector<property>> side;
+
+            /** Returns the columns for type T */
+            template <typename T>
+            std::vector<std::vector<T>>& storage();
+
+            /** Resets a row of every column in list */
+            template <typename T>
+            static void reset(std::vector<std::vector<T>> &list, uint32_t row) {
+                for (auto &c : list) {
+                    c[row] = T();
+                }
+            }
+
+            /** Adds a row to every column in list */
+            template <typename T>
+            static void grow(std::vector<std::vector<T>> &list) {
+                for (auto &c : list) {
+                    c.emplace_back();
+                }
+            }
+    };
+
+    template <> inline std::vector<std::vector<IntProperty>>& column_table::storage() { return ints; }
+    template <> inline std::vector<std::vector<UIntProperty>>& column_table::storage() { return uints; }
+    template <> inline std::vector<std::vector<FloatProperty>>& column_table::storage() { return floats; }
+    template <> inline std::vector<std::vector<VectorProperty>>& column_table::storage() { return vectors; }
+    template <> inline std::vector<std::vector<VectorXYProperty>>& column_table::storage() { return vectorsXY; }
+    template <> inline std::vector<std::vector<Int64Property>>& column_table::storage() { return ints64; }
+    template <> inline std::vector<std::vector<UInt64Property>>& column_table::storage() { return uints64; }
+    template <> inline std::vector<std::vector<property>>& column_table::storage() { return side; }
+
+    /// @}
+}
+
+#endif // _DOTA_COLUMNS_HPP_
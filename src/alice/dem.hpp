@@ -26,8 +26,18 @@
 /// Defines the first 7 bytes to check as the header ID
 #define DOTA_DEMHEADERID "PBUFDEM"
 
+/// Default number of milliseconds between two checks for new data when following a replay
+#define DOTA_DEM_FOLLOW_INTERVAL 100
+
+/// Message types skipped by default when reading with skip set, one bit per type (1, 2, 3, 9 - 14)
+#define DOTA_DEM_SKIP 0x7E0E
+
+#include <string>
+
 #include <alice/exception.hpp>
 #include <alice/config.hpp>
+#include <alice/demo.pb.h>
+#include <alice/dem_index.hpp>
 
 namespace dota {
     /// @defgroup EXCEPTIONS Exceptions
@@ -63,6 +73,9 @@ namespace dota {
         int32_t offset;
     };
 
+    // forward declaration
+    class dem_stream;
+
     /** DEM message read from the file */
     struct demMessage_t {
         /** Was this message compressed? */
@@ -75,6 +88,13 @@ namespace dota {
         const char* msg;
         /** Size of the message */
         std::size_t size;
+        /** Set if msg still points to snappy compressed data, the stream to uncompress it with */
+        dem_stream* source;
+        /** Size before uncompressing, 0 if the message has not been uncompressed */
+        std::size_t compressedSize;
+
+        /** Uncompresses the message if that has been deferred, msg stays valid until the next read */
+        void decompress();
     };
 
     /** Reading status, announces when certain parts of the replay become available */
@@ -91,7 +111,7 @@ namespace dota {
     class dem_stream {
         public:
             /** Constructor */
-            dem_stream() {}
+            dem_stream() : skipMask(DOTA_DEM_SKIP), lazy(false), indexStore(nullptr) {}
 
             /** Destructor */
             virtual ~dem_stream() {};
@@ -105,13 +125,128 @@ namespace dota {
             /** Opens a dem file from given path */
             virtual void open(std::string path) = 0;
 
-            /** Returns a message */
+            /**
+             * Returns a message.
+             *
+             * If skip is set, messages whose type is part of the skip mask are seeked past without
+             * being read or uncompressed. They are returned with msg set to nullptr.
+             */
             virtual demMessage_t read(const bool skip = false) = 0;
 
             /** Move to the desired minute in the replay */
             virtual void move(uint32_t minute) = 0;
+
+            /** Move to the last fullpacket before the given tick, generates the index if required */
+            void moveTick(uint32_t tick) {
+                if (index.empty())
+                    move(0);
+
+                move(index.fullpacket(tick));
+            }
+
+            /** Uncompresses a message returned by read with deferred decompression */
+            virtual void decompress(demMessage_t &msg) {}
+
+            /**
+             * Whether to defer snappy decompression until demMessage_t::decompress is called.
+             *
+             * Messages nobody parses are never uncompressed. Not supported by all streams,
+             * messages from those are always uncompressed.
+             */
+            void setLazy(bool l) {
+                lazy = l;
+            }
+
+            /** Sets the types to skip, bit n set means messages of type n are skipped */
+            void setSkipped(uint32_t mask) {
+                skipMask = mask;
+            }
+
+            /** Returns the types to skip */
+            uint32_t getSkipped() const {
+                return skipMask;
+            }
+
+            /**
+             * Sets where the index of fullpackets is loaded from and saved to.
+             *
+             * The index is loaded on open and saved once it has been generated by move. The store
+             * is not owned by the stream and has to outlive it. Set before calling open.
+             */
+            void setIndexStore(dem_index_store* store) {
+                indexStore = store;
+            }
+
+            /** Returns the index, empty until it has been loaded or generated */
+            const dem_index& getIndex() const {
+                return index;
+            }
+        protected:
+            /** Types to skip, one bit per type */
+            uint32_t skipMask;
+            /** Whether to defer decompression */
+            bool lazy;
+            /** Fullpacket positions and tick samples */
+            dem_index index;
+            /** Optional store for the index */
+            dem_index_store* indexStore;
+
+            /** Whether messages of this type are skipped with the given mask */
+            static bool isSkipped(uint32_t mask, uint32_t type) {
+                return (type < 32) && ((mask >> type) & 1);
+            }
+
+            /** Resets the index and loads it from the store if it matches the file size */
+            void loadIndex(const std::string &path, uint64_t size) {
+                index.clear();
+
+                if (indexStore && (!indexStore->load(path, index) || index.size != size))
+                    index.clear();
+
+                index.size = size;
+            }
+
+            /**
+             * Adds all messages up to and including the stop message to the index.
+             *
+             * start is the position of the first message, tell returns the current position,
+             * readVarInt reads a varint32 and skip seeks forward the given number of bytes.
+             */
+            template <typename Tell, typename ReadVarInt, typename Skip>
+            void buildIndex(uint32_t start, Tell tell, ReadVarInt readVarInt, Skip skip) {
+                index.fullpackets.push_back(start); // 0 min start
+
+                // Get type / tick / size
+                uint32_t type = 0;
+
+                do {
+                    uint32_t p = tell();
+                    type = readVarInt() & ~DEM_IsCompressed;
+                    uint32_t tick = readVarInt();
+                    uint32_t size = readVarInt();
+
+                    index.add(type, tick, p);
+
+                    if (type == 13) {
+                        D_( std::cout << "[dem_stream] Adding fullpacket at position " << " " << p << D_FILE << " " << __LINE__ << std::endl;, 3 )
+                    }
+
+                    skip(size);
+                } while (type != 0);
+            }
+
+            /** Saves the index to the store */
+            void saveIndex(const std::string &path) {
+                if (indexStore)
+                    indexStore->save(path, index);
+            }
     };
 
+    inline void demMessage_t::decompress() {
+        if (source != nullptr)
+            source->decompress(*this);
+    }
+
     /// @}
 }
 
@@ -0,0 +1,160 @@
+/**
+ * @file dem_index.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License. *
+ */
+
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+#include <alice/dem_index.hpp>
+
+namespace dota {
+    namespace {
+        /** Writes a single value in host byte order */
+        template <typename T>
+        void put(std::ostream &out, const T &v) {
+            out.write((const char*) &v, sizeof(T));
+        }
+
+        /** Reads a single value in host byte order */
+        template <typename T>
+        bool get(std::istream &in, T &v) {
+            in.read((char*) &v, sizeof(T));
+            return in.gcount() == sizeof(T);
+        }
+    }
+
+    void dem_index::add(uint32_t type, uint32_t tick, uint32_t pos) {
+        if (type == 13)
+            fullpackets.push_back(pos);
+
+        if (ticks.empty() || tick >= ticks.back().first + DOTA_INDEX_INTERVAL)
+            ticks.push_back(std::make_pair(tick, pos));
+    }
+
+    uint32_t dem_index::position(uint32_t tick) const {
+        if (ticks.empty())
+            return fullpackets.empty() ? 0 : fullpackets[0];
+
+        // first sample after tick
+        auto it = std::upper_bound(ticks.begin(), ticks.end(), tick,
+            [](uint32_t t, const std::pair<uint32_t, uint32_t> &s) { return t < s.first; }
+        );
+
+        if (it != ticks.begin())
+            --it;
+
+        return it->second;
+    }
+
+    uint32_t dem_index::fullpacket(uint32_t tick) const {
+        if (fullpackets.empty())
+            return 0;
+
+        // first fullpacket after the sample
+        auto it = std::upper_bound(fullpackets.begin(), fullpackets.end(), position(tick));
+
+        if (it != fullpackets.begin())
+            --it;
+
+        return it - fullpackets.begin();
+    }
+
+    void dem_index::serialize(std::ostream &out) const {
+        out.write(DOTA_INDEX_MAGIC, 4);
+        put<uint32_t>(out, DOTA_INDEX_VERSION);
+        put<uint64_t>(out, size);
+
+        put<uint32_t>(out, fullpackets.size());
+        for (auto &f : fullpackets) {
+            put<uint32_t>(out, f);
+        }
+
+        put<uint32_t>(out, ticks.size());
+        for (auto &t : ticks) {
+            put<uint32_t>(out, t.first);
+            put<uint32_t>(out, t.second);
+        }
+    }
+
+    bool dem_index::deserialize(std::istream &in) {
+        clear();
+
+        char magic[4];
+        uint32_t version = 0;
+        uint32_t count = 0;
+
+        in.read(magic, 4);
+        if (in.gcount() != 4 || memcmp(magic, DOTA_INDEX_MAGIC, 4) != 0)
+            return false;
+
+        if (!get(in, version) || version != DOTA_INDEX_VERSION || !get(in, size) || !get(in, count)) {
+            clear();
+            return false;
+        }
+
+        // read one by one, count might be corrupt
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t f;
+            if (!get(in, f)) {
+                clear();
+                return false;
+            }
+
+            fullpackets.push_back(f);
+        }
+
+        if (!get(in, count)) {
+            clear();
+            return false;
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            std::pair<uint32_t, uint32_t> t;
+            if (!get(in, t.first) || !get(in, t.second)) {
+                clear();
+                return false;
+            }
+
+            ticks.push_back(t);
+        }
+
+        return !fullpackets.empty();
+    }
+
+    bool dem_index_sidecar::load(const std::string &replay, dem_index &index) {
+        std::ifstream in((replay+DOTA_INDEX_EXTENSION).c_str(), std::ifstream::in | std::ifstream::binary);
+        if (!in.is_open())
+            return false;
+
+        D_( std::cout << "[dem_index] Loading index for " << replay << " " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+        return index.deserialize(in);
+    }
+
+    void dem_index_sidecar::save(const std::string &replay, const dem_index &index) {
+        std::ofstream out((replay+DOTA_INDEX_EXTENSION).c_str(), std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+        if (!out.is_open())
+            return;
+
+        D_( std::cout << "[dem_index] Saving index for " << replay << " " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+        index.serialize(out);
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * @file dem_index.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License. *
+ */
+
+#ifndef _DOTA_DEM_INDEX_HPP_
+#define _DOTA_DEM_INDEX_HPP_
+
+/// First bytes of a serialized index
+#define DOTA_INDEX_MAGIC "AIDX"
+/// Version of the index format, bumped on incompatible changes
+#define DOTA_INDEX_VERSION 1
+/// Minimum number of ticks between two tick samples
+#define DOTA_INDEX_INTERVAL 30
+/// Extension appended to the replay path by dem_index_sidecar
+#define DOTA_INDEX_EXTENSION ".aidx"
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <istream>
+#include <ostream>
+#include <cstdint>
+
+#include <alice/config.hpp>
+
+namespace dota {
+    /// @defgroup CORE Core
+    /// @{
+
+    /**
+     * Positions of fullpackets and tick samples of a single replay.
+     *
+     * Positions are relative to the start of the uncompressed replay data. The first fullpacket
+     * entry is the position of the first message, each following entry is a fullpacket.
+     * The serialized format is in host byte order.
+     */
+    struct dem_index {
+        /** Size of the indexed file, used to detect stale indices */
+        uint64_t size;
+        /** Positions of fullpackets */
+        std::vector<uint32_t> fullpackets;
+        /** Tick / position samples, at least #DOTA_INDEX_INTERVAL ticks apart */
+        std::vector<std::pair<uint32_t, uint32_t>> ticks;
+
+        /** Constructor */
+        dem_index() : size(0) {}
+
+        /** Whether the index has been generated or loaded */
+        bool empty() const {
+            return fullpackets.empty();
+        }
+
+        /** Resets the index */
+        void clear() {
+            size = 0;
+            fullpackets.clear();
+            ticks.clear();
+        }
+
+        /** Records a message at the given position, called for each message in order */
+        void add(uint32_t type, uint32_t tick, uint32_t pos);
+
+        /** Returns the position of the last sample at or before tick */
+        uint32_t position(uint32_t tick) const;
+
+        /** Returns the number of the last fullpacket before the sample for tick, as passed to dem_stream::move */
+        uint32_t fullpacket(uint32_t tick) const;
+
+        /** Writes the index to the stream */
+        void serialize(std::ostream &out) const;
+
+        /** Reads the index from the stream, returns false and clears it if the data is invalid */
+        bool deserialize(std::istream &in);
+    };
+
+    /** Baseclass for places to persist indices in */
+    class dem_index_store {
+        public:
+            /** Destructor */
+            virtual ~dem_index_store() {}
+
+            /** Loads the index for the replay, returns false if none is available */
+            virtual bool load(const std::string &replay, dem_index &index) = 0;
+
+            /** Saves the index for the replay */
+            virtual void save(const std::string &replay, const dem_index &index) = 0;
+    };
+
+    /** Stores indices next to the replay, with #DOTA_INDEX_EXTENSION appended to the path */
+    class dem_index_sidecar : public dem_index_store {
+        public:
+            /** Loads the index for the replay, returns false if none is available */
+            virtual bool load(const std::string &replay, dem_index &index);
+
+            /** Saves the index for the replay, failures are ignored */
+            virtual void save(const std::string &replay, const dem_index &index);
+    };
+
+    /// @}
+}
+
+#endif // _DOTA_DEM_INDEX_HPP_
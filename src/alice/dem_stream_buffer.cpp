@@ -0,0 +1,204 @@
+/**
+ * @file dem_stream_buffer.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License. *
+ */
+
+#include <snappy.h>
+
+#include <alice/demo.pb.h>
+#include <alice/dem_stream_buffer.hpp>
+
+namespace dota {
+    void dem_stream_buffer::open(std::string path) {
+        D_( std::cout << "[dem_stream] Opening replay: " << path << " " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+        D_( std::cout << "[dem_stream] Filesize: " << size << " " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+
+        // check size
+        if (size < sizeof(demHeader_t) && !wait(sizeof(demHeader_t)))
+            BOOST_THROW_EXCEPTION((demFileTooSmall()
+                << EArg<1>::info(path)
+                << EArgT<2, std::size_t>::info(this->size)
+                << EArgT<3, std::size_t>::info(sizeof(demHeader_t))
+            ));
+
+        // verify the header
+        demHeader_t head;
+        memcpy((char*) &head, data, sizeof(demHeader_t));
+        if(strcmp(head.headerid, DOTA_DEMHEADERID))
+            BOOST_THROW_EXCEPTION(demHeaderMismatch()
+                << EArg<1>::info(path)
+                << EArg<2>::info(std::string(head.headerid, 8))
+                << EArg<3>::info(std::string(DOTA_DEMHEADERID))
+            );
+
+        // save path for later
+        file = path;
+
+        // load a previously generated index
+        loadIndex(path, size);
+
+        // current position
+        pos = sizeof(demHeader_t);
+        parsingState = 0;
+    }
+
+    demMessage_t dem_stream_buffer::read(const bool skip) {
+        // Make sure the data has been attached
+        assert(data != nullptr);
+        assert(bufferSnappy != nullptr);
+
+        // Get type / tick / size
+        uint32_t type = readVarInt();
+        const bool compressed = type & DEM_IsCompressed;
+        type = (type & ~DEM_IsCompressed);
+
+        uint32_t tick = readVarInt();
+        uint32_t size = readVarInt();
+
+        // Check if this is the last message
+        if (parsingState == 1) parsingState = 2;
+        if (type == 0)         parsingState = 1; // marks the message before the laste one
+
+        // Make sure the message is inside the data, we hand out pointers to it
+        if (size > this->size - pos && !wait(pos + size))
+            BOOST_THROW_EXCEPTION((demUnexpectedEOF()
+                << EArg<1>::info(file)
+                << EArgT<2, std::size_t>::info(size)
+                << EArgT<3, std::size_t>::info(this->size - pos)
+            ));
+
+        // skip messages if skip is set
+        if (skip && isSkipped(skipMask, type)) {
+            pos += size; // seek forward
+            D_( std::cout << "[dem_stream] Skipping Message: " << " " << type << D_FILE << " " << __LINE__ << std::endl;, 2 )
+            return demMessage_t{false, 0, 0, nullptr, 0}; // return empty msg
+        }
+
+        D_( std::cout << "[dem_stream] Reading Message: " << type << D_FILE << " " << __LINE__ << std::endl;, 3 )
+
+        // point straight into the data
+        demMessage_t msg {compressed, tick, type, &this->data[pos], size, nullptr}; // return msg
+        pos += size;
+
+        // Check if we need to uncompress
+        if (compressed) {
+            msg.source = this;
+
+            if (!lazy)
+                decompress(msg);
+        }
+
+        return msg;
+    }
+
+    void dem_stream_buffer::decompress(demMessage_t &msg) {
+        msg.source = nullptr;
+
+        // not compressed after all, use as is
+        if (!snappy::IsValidCompressedBuffer(msg.msg, msg.size))
+            return;
+
+        D_( std::cout << "[dem_stream] Uncompressing Message: " << " " << msg.type << D_FILE << " " << __LINE__ << std::endl;, 3 )
+        std::size_t uSize;
+
+        // Check if we can get the output length
+        if (!snappy::GetUncompressedLength(msg.msg, msg.size, &uSize)) {
+            BOOST_THROW_EXCEPTION((demInvalidCompression()
+                << EArg<1>::info(file)
+                << EArgT<2, std::size_t>::info(pos)
+                << EArgT<3, std::size_t>::info(msg.size)
+                << EArgT<4, uint32_t>::info(msg.type)
+            ));
+        }
+
+        // Check if it fits in the buffer
+        if (uSize > DOTA_SNAPPY_BUFSIZE)
+            BOOST_THROW_EXCEPTION((demMessageToBig()
+                << EArgT<1, std::size_t>::info(uSize)
+            ));
+
+        // Make sure its uncompressed
+        if (!snappy::RawUncompress(msg.msg, msg.size, bufferSnappy))
+            BOOST_THROW_EXCEPTION((demInvalidCompression()
+                << EArg<1>::info(file)
+                << EArgT<2, std::size_t>::info(pos)
+                << EArgT<3, std::size_t>::info(msg.size)
+                << EArgT<4, uint32_t>::info(msg.type)
+            ));
+
+        msg.compressedSize = msg.size;
+        msg.msg = bufferSnappy;
+        msg.size = uSize;
+    }
+
+    void dem_stream_buffer::move(uint32_t min) {
+        // generate the cache
+        if (index.empty()) {
+            pos = sizeof(demHeader_t);
+            buildIndex(pos,
+                [this]() { return (uint32_t) pos; },
+                [this]() { return readVarInt(); },
+                [this](uint32_t size) { pos += size; }
+            );
+
+            saveIndex(file);
+        }
+
+        // seek to the fullpacket at the desired position
+        if (index.fullpackets.size() <= min)
+            min = index.fullpackets.size() - 1;
+
+        pos = index.fullpackets[min];
+        parsingState = 0;
+    }
+
+    void dem_stream_buffer::attach(const char* data, std::size_t size) {
+        this->data = data;
+        this->size = size;
+
+        pos = 0;
+        parsingState = 0;
+    }
+
+    uint32_t dem_stream_buffer::readVarInt() {
+        char buf;
+        uint32_t count = 0;
+        uint32_t result = 0;
+
+        do {
+            if (count == 5) {
+                BOOST_THROW_EXCEPTION(demCorrupted()
+                    << EArg<1>::info(file)
+                );
+            } else if (pos >= size && !wait(pos + 1)) {
+                BOOST_THROW_EXCEPTION(demUnexpectedEOF()
+                    << EArg<1>::info(file)
+                );
+            } else {
+                buf = data[pos];
+                result |= (uint32_t)(buf & 0x7F) << ( 7 * count );
+                ++count;
+                ++pos;
+            }
+        } while (buf & 0x80);
+
+        return result;
+    }
+}
@@ -0,0 +1,128 @@
+/**
+ * @file dem_stream_buffer.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License. *
+ */
+
+#ifndef _DOTA_DEM_STREAM_BUFFER_HPP_
+#define _DOTA_DEM_STREAM_BUFFER_HPP_
+
+/// Defines a fixed amount of memory to allocate for the internal buffer for snappy
+#define DOTA_SNAPPY_BUFSIZE 0x100000 // 1 MB
+
+#include <string>
+#include <memory>
+#include <utility>
+
+#include <alice/exception.hpp>
+#include <alice/dem.hpp>
+
+namespace dota {
+    /// @defgroup CORE Core
+    /// @{
+
+    /**
+     * Read the contents of a demo file (Dota 2 Replay) that is already in memory.
+     *
+     * The data is parsed in place, uncompressed messages point directly into it. The data
+     * has to stay valid until the stream is destroyed, either by keeping it alive or by
+     * handing a shared pointer to the stream. Compressed messages are uncompressed into a
+     * fixed 1MB buffer.
+     *
+     * open() verifies the header, the path passed only names the replay in errors and
+     * the index store.
+     */
+    class dem_stream_buffer : public dem_stream {
+        public:
+            /** Constructor, parses data owned by the caller */
+            dem_stream_buffer(const char* data, std::size_t size) : dem_stream_buffer() {
+                attach(data, size);
+            }
+
+            /** Constructor, keeps a reference to data until the stream is destroyed */
+            dem_stream_buffer(std::shared_ptr<const char> data, std::size_t size) : dem_stream_buffer() {
+                attach(data.get(), size);
+                owner = std::move(data);
+            }
+
+            /** Copy constructor, don't allow copying */
+            dem_stream_buffer(const dem_stream_buffer &s) = delete;
+
+            /** Move constructor, don't allow moving */
+            dem_stream_buffer(dem_stream_buffer &&stream) = delete;
+
+            /** Destructor, free's allocated memory */
+            virtual ~dem_stream_buffer() {
+                delete[] bufferSnappy;
+            }
+
+            /** Whether there are still messages left to be parsed */
+            virtual bool good() {
+                return (pos < size) && (parsingState != 2);
+            }
+
+            /** Verifies the header of the data, path is used to identify the replay */
+            virtual void open(std::string path);
+
+            /** Returns a message */
+            virtual demMessage_t read(const bool skip = false);
+
+            /** Move to the desired minute in the replay */
+            virtual void move(uint32_t min);
+
+            /** Uncompresses a message returned by read with deferred decompression */
+            virtual void decompress(demMessage_t &msg);
+        protected:
+            /** Constructor for streams that attach their data on open */
+            dem_stream_buffer() : data(nullptr), bufferSnappy(nullptr), pos(0), size(0), parsingState(0) {
+                bufferSnappy = new char[DOTA_SNAPPY_BUFSIZE];
+            }
+
+            /** Start of the data */
+            const char* data;
+            /** Keeps shared data alive */
+            std::shared_ptr<const char> owner;
+            /** Internal buffer (uncompressed message) */
+            char* bufferSnappy;
+
+            /** Path to opened replay */
+            std::string file;
+            /** Position in the data */
+            std::size_t pos;
+            /** Size of the data */
+            std::size_t size;
+            /** Parsing state */
+            uint32_t parsingState;
+
+            /** Sets the data to parse and resets the position */
+            void attach(const char* data, std::size_t size);
+
+            /** Called when data up to end is not available, returns true once it is */
+            virtual bool wait(std::size_t end) {
+                return false;
+            }
+
+            /** Reads a varint32 from the data (protobuf serialization format) */
+            uint32_t readVarInt();
+    };
+
+    /// @}
+}
+
+#endif // _DOTA_DEM_STREAM_BUFFER_HPP_
@@ -27,15 +27,7 @@
 
 #if DOTA_BZIP2
 
-/// Defines a fixed amount of memory to allocate for the internal buffer for snappy
-#define DOTA_SNAPPY_BUFSIZE 0x100000 // 1 MB
-
-#include <string>
-#include <fstream>
-#include <utility>
-
-#include <alice/exception.hpp>
-#include <alice/dem.hpp>
+#include <alice/dem_stream_compressed.hpp>
 
 namespace dota {
     /// @defgroup CORE Core
@@ -44,60 +36,12 @@ namespace dota {
     /**
      * Read the contents of a bzip2-compressed demo file (Dota 2 Replay) from the harddrive.
      *
-     * This class copies the entire contents of the replay into the memory.
-     * It addition it allocates 1MB of fixed space to take care of decompressing
-     * messages with snappy.
+     * Only accepts bzip2 files, use dem_stream_compressed to detect the format.
      */
-    class dem_stream_bzip2 : public dem_stream {
+    class dem_stream_bzip2 : public dem_stream_compressed {
         public:
-            /** Constructor, allocates memory to buffer file contents */
-            dem_stream_bzip2() : buffer(""), bufferSnappy(nullptr), pos(0), size(0), parsingState(0) {
-                bufferSnappy = new char[DOTA_SNAPPY_BUFSIZE];
-            }
-
-            /** Copy constructor, don't allow copying */
-            dem_stream_bzip2(const dem_stream_bzip2 &s) = delete;
-
-            /** Move constructor, don't allow moving */
-            dem_stream_bzip2(dem_stream_bzip2 &&stream) = delete;
-
-            /** Destructor, free's allocated memory */
-            virtual ~dem_stream_bzip2() {
-                delete[] bufferSnappy;
-            }
-
-            /** Whether there are still messages left to be parsed */
-            virtual bool good() {
-                return (pos < size) && (parsingState != 2);
-            }
-
-            /** Opens a DEM file from the given path */
-            virtual void open(std::string path);
-
-            /** Returns a message */
-            virtual demMessage_t read(const bool skip = false);
-
-            /** Move to the desired minute in the replay */
-            virtual void move(uint32_t min);
-        private:
-            /** Internal buffer (message) */
-            std::string buffer;
-            /** Internal buffer (uncompressed message) */
-            char* bufferSnappy;
-
-            /** Path to opened replay */
-            std::string file;
-            /** Position in the array */
-            uint32_t pos;
-            /** Maximum size */
-            uint32_t size;
-            /** Parsing state */
-            uint32_t parsingState;
-            /** Position cache for fullpackets */
-            std::vector<uint32_t> fpackcache;
-
-            /** Reads a varint32 from the array (protobuf serialization format) */
-            uint32_t readVarInt();
+            /** Constructor, allocates memory to buffer messages */
+            dem_stream_bzip2() : dem_stream_compressed("bzip2") {}
     };
 
     /// @}
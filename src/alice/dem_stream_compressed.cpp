@@ -0,0 +1,321 @@
+/**
+ * @file dem_stream_compressed.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License. *
+ */
+
+#include <alice/config.hpp>
+
+#if DOTA_DECOMPRESS
+
+#include <snappy.h>
+
+#include <alice/demo.pb.h>
+#include <alice/dem_stream_compressed.hpp>
+
+#if DOTA_BZIP2
+#include <boost/iostreams/filter/bzip2.hpp>
+#endif // DOTA_BZIP2
+
+#if DOTA_GZIP
+#include <boost/iostreams/filter/gzip.hpp>
+#endif // DOTA_GZIP
+
+#if DOTA_XZ
+#include <boost/iostreams/filter/lzma.hpp>
+#endif // DOTA_XZ
+
+#if DOTA_ZSTD
+#include <boost/iostreams/filter/zstd.hpp>
+#endif // DOTA_ZSTD
+
+namespace dota {
+    std::vector<dem_stream_compressed::format>& dem_stream_compressed::formats() {
+        static std::vector<format> f {
+            {"plain", std::string(DOTA_DEMHEADERID), [](boost::iostreams::filtering_istream&){}},
+            #if DOTA_BZIP2
+            {"bzip2", std::string("BZh"), [](boost::iostreams::filtering_istream &in){
+                in.push(boost::iostreams::bzip2_decompressor());
+            }},
+            #endif // DOTA_BZIP2
+            #if DOTA_GZIP
+            {"gzip", std::string("\x1F\x8B", 2), [](boost::iostreams::filtering_istream &in){
+                in.push(boost::iostreams::gzip_decompressor());
+            }},
+            #endif // DOTA_GZIP
+            #if DOTA_XZ
+            {"xz", std::string("\xFD" "7zXZ\x00", 6), [](boost::iostreams::filtering_istream &in){
+                in.push(boost::iostreams::lzma_decompressor());
+            }},
+            #endif // DOTA_XZ
+            #if DOTA_ZSTD
+            {"zstd", std::string("\x28\xB5\x2F\xFD", 4), [](boost::iostreams::filtering_istream &in){
+                in.push(boost::iostreams::zstd_decompressor());
+            }},
+            #endif // DOTA_ZSTD
+        };
+
+        return f;
+    }
+
+    void dem_stream_compressed::addFormat(format f) {
+        formats().push_back(std::move(f));
+    }
+
+    void dem_stream_compressed::open(std::string path) {
+        D_( std::cout << "[dem_stream] Opening replay: " << path << " " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+
+        // save path for later
+        file = path;
+        rewind();
+
+        // load a previously generated index, the size of the compressed file identifies it
+        std::ifstream f(path.c_str(), std::ifstream::in | std::ifstream::binary | std::ifstream::ate);
+        loadIndex(path, f.tellg());
+    }
+
+    demMessage_t dem_stream_compressed::read(const bool skip) {
+        // Make sure the buffers has been allocated
+        assert(buffer != nullptr);
+        assert(bufferSnappy != nullptr);
+
+        // Get type / tick / size
+        uint32_t type = readVarInt();
+        const bool compressed = type & DEM_IsCompressed;
+        type = (type & ~DEM_IsCompressed);
+
+        uint32_t tick = readVarInt();
+        uint32_t size = readVarInt();
+
+        // Check if this is the last message
+        if (parsingState == 1) parsingState = 2;
+        if (type == 0)         parsingState = 1; // marks the message before the laste one
+
+        // skip messages if skip is set
+        if (skip && isSkipped(skipMask, type)) {
+            skipTo(pos + size); // seek forward
+            D_( std::cout << "[dem_stream] Skipping Message: " << " " << type << D_FILE << " " << __LINE__ << std::endl;, 2 )
+            return demMessage_t{false, 0, 0, nullptr, 0}; // return empty msg
+        }
+
+        D_( std::cout << "[dem_stream] Reading Message: " << type << D_FILE << " " << __LINE__ << std::endl;, 3 )
+
+        // read into char array
+        if (size > DOTA_SNAPPY_BUFSIZE)
+            BOOST_THROW_EXCEPTION((demMessageToBig()
+                << EArgT<1, std::size_t>::info(size)
+            ));
+
+        in.read(buffer, size);
+        pos += in.gcount();
+
+        if (in.gcount() != size)
+            BOOST_THROW_EXCEPTION((demUnexpectedEOF()
+                << EArg<1>::info(file)
+                << EArgT<2, std::streamsize>::info(in.gcount())
+                << EArgT<3, std::size_t>::info(size)
+            ));
+
+        demMessage_t msg {compressed, tick, type, buffer, size, nullptr}; // return msg
+
+        // Check if we need to uncompress
+        if (compressed) {
+            msg.source = this;
+
+            if (!lazy)
+                decompress(msg);
+        }
+
+        return msg;
+    }
+
+    void dem_stream_compressed::decompress(demMessage_t &msg) {
+        msg.source = nullptr;
+
+        // not compressed after all, use as is
+        if (!snappy::IsValidCompressedBuffer(msg.msg, msg.size))
+            return;
+
+        D_( std::cout << "[dem_stream] Uncompressing Message: " << " " << msg.type << D_FILE << " " << __LINE__ << std::endl;, 3 )
+        std::size_t uSize;
+
+        // Check if we can get the output length
+        if (!snappy::GetUncompressedLength(msg.msg, msg.size, &uSize)) {
+            BOOST_THROW_EXCEPTION((demInvalidCompression()
+                << EArg<1>::info(file)
+                << EArgT<2, std::size_t>::info(pos)
+                << EArgT<3, std::size_t>::info(msg.size)
+                << EArgT<4, uint32_t>::info(msg.type)
+            ));
+        }
+
+        // Check if it fits in the buffer
+        if (uSize > DOTA_SNAPPY_BUFSIZE)
+            BOOST_THROW_EXCEPTION((demMessageToBig()
+                << EArgT<1, std::size_t>::info(uSize)
+            ));
+
+        // Make sure its uncompressed
+        if (!snappy::RawUncompress(msg.msg, msg.size, bufferSnappy))
+            BOOST_THROW_EXCEPTION((demInvalidCompression()
+                << EArg<1>::info(file)
+                << EArgT<2, std::size_t>::info(pos)
+                << EArgT<3, std::size_t>::info(msg.size)
+                << EArgT<4, uint32_t>::info(msg.type)
+            ));
+
+        msg.compressedSize = msg.size;
+        msg.msg = bufferSnappy;
+        msg.size = uSize;
+    }
+
+    void dem_stream_compressed::move(uint32_t min) {
+        // generate the cache
+        if (index.empty()) {
+            rewind();
+            buildIndex(pos,
+                [this]() { return (uint32_t) pos; },
+                [this]() { return readVarInt(); },
+                [this](uint32_t size) { skipTo(pos + size); }
+            );
+
+            saveIndex(file);
+        }
+
+        // seek to the fullpacket at the desired position
+        if (index.fullpackets.size() <= min)
+            min = index.fullpackets.size() - 1;
+
+        // decompressors can't seek, start from the beginning when going backwards
+        if (index.fullpackets[min] < pos)
+            rewind();
+
+        skipTo(index.fullpackets[min]);
+    }
+
+    void dem_stream_compressed::rewind() {
+        // drop the previous chain before closing the file it reads from
+        in.reset();
+        in.clear();
+        parsingState = 0;
+
+        if (stream.is_open())
+            stream.close();
+
+        stream.clear();
+        stream.open(file.c_str(), std::ifstream::in | std::ifstream::binary);
+
+        // check if it was successful
+        if (!stream.is_open())
+            BOOST_THROW_EXCEPTION(demFileNotAccessible()
+                << EArg<1>::info(file)
+            );
+
+        // detect the format from the first bytes
+        char magic[8];
+        stream.read(magic, sizeof(magic));
+        const std::string start(magic, stream.gcount());
+
+        stream.clear();
+        stream.seekg(0);
+
+        const format* f = nullptr;
+        for (auto &fmt : formats()) {
+            if (start.compare(0, fmt.magic.size(), fmt.magic) == 0) {
+                f = &fmt;
+                break;
+            }
+        }
+
+        if (f == nullptr || (!only.empty() && only != f->name))
+            BOOST_THROW_EXCEPTION(demUnknownCompression()
+                << EArg<1>::info(file)
+                << EArg<2>::info(only)
+            );
+
+        current = f->name;
+        D_( std::cout << "[dem_stream] Format: " << current << " " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+
+        // uncompress file as it is read
+        f->push(in);
+        in.push(stream);
+
+        // check filesize
+        demHeader_t head;
+        in.read((char*) &head, sizeof(demHeader_t));
+
+        if (in.gcount() != sizeof(demHeader_t))
+            BOOST_THROW_EXCEPTION((demFileTooSmall()
+                << EArg<1>::info(file)
+                << EArgT<2, std::streamsize>::info(in.gcount())
+                << EArgT<3, std::size_t>::info(sizeof(demHeader_t))
+            ));
+
+        // verify the header
+        if(strcmp(head.headerid, DOTA_DEMHEADERID))
+            BOOST_THROW_EXCEPTION(demHeaderMismatch()
+                << EArg<1>::info(file)
+                << EArg<2>::info(std::string(head.headerid, 8))
+                << EArg<3>::info(std::string(DOTA_DEMHEADERID))
+            );
+
+        // current position
+        pos = sizeof(demHeader_t);
+    }
+
+    void dem_stream_compressed::skipTo(std::size_t target) {
+        assert(target >= pos);
+
+        in.ignore(target - pos);
+        pos += in.gcount();
+
+        if (pos != target)
+            BOOST_THROW_EXCEPTION((demUnexpectedEOF()
+                << EArg<1>::info(file)
+                << EArgT<2, std::size_t>::info(pos)
+                << EArgT<3, std::size_t>::info(target)
+            ));
+    }
+
+    uint32_t dem_stream_compressed::readVarInt() {
+        char buf;
+        uint32_t count = 0;
+        uint32_t result = 0;
+
+        do {
+            if (count == 5) {
+                BOOST_THROW_EXCEPTION(demCorrupted()
+                    << EArg<1>::info(file)
+                );
+            } else if (!in.get(buf)) {
+                BOOST_THROW_EXCEPTION(demUnexpectedEOF()
+                    << EArg<1>::info(file)
+                );
+            } else {
+                result |= (uint32_t)(buf & 0x7F) << ( 7 * count );
+                ++count;
+                ++pos;
+            }
+        } while (buf & 0x80);
+
+        return result;
+    }
+}
+
+#endif // DOTA_DECOMPRESS
\ No newline at end of file
@@ -0,0 +1,170 @@
+/**
+ * @file dem_stream_compressed.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License. *
+ */
+
+#ifndef _DOTA_DEM_STREAM_COMPRESSED_HPP_
+#define _DOTA_DEM_STREAM_COMPRESSED_HPP_
+
+#include <alice/config.hpp>
+
+#if DOTA_DECOMPRESS
+
+/// Defines a fixed amount of memory to allocate for the internal buffer for snappy
+#define DOTA_SNAPPY_BUFSIZE 0x100000 // 1 MB
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <utility>
+#include <functional>
+
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <alice/exception.hpp>
+#include <alice/dem.hpp>
+
+namespace dota {
+    /// @defgroup EXCEPTIONS Exceptions
+    /// @{
+
+    /// Thrown when the file does not start with the magic bytes of a known format
+    CREATE_EXCEPTION( demUnknownCompression, "Unknown or disabled compression format." )
+
+    /// @}
+    /// @defgroup CORE Core
+    /// @{
+
+    /**
+     * Read the contents of a compressed demo file (Dota 2 Replay) from the harddrive.
+     *
+     * The format is chosen by the magic bytes at the start of the file. Formats are compiled in
+     * via the BZIP2, GZIP, XZ and ZSTD build options, uncompressed replays are always accepted.
+     * Additional formats can be added with addFormat.
+     *
+     * The replay is decompressed block by block while it is read, only the current message is
+     * kept in memory. This class allocates 1MB for the raw message and 1MB of fixed space to
+     * take care of decompressing messages with snappy.
+     *
+     * Seeking backwards with move() reopens the file and decompresses it up to the
+     * requested position.
+     */
+    class dem_stream_compressed : public dem_stream {
+        public:
+            /** A decompressor that can be put in front of the file */
+            struct format {
+                /** Name of the format, e.g. "gzip" */
+                std::string name;
+                /** Bytes the compressed file starts with */
+                std::string magic;
+                /** Pushes the decompressor on the chain, does nothing for uncompressed data */
+                std::function<void (boost::iostreams::filtering_istream&)> push;
+            };
+
+            /**
+             * Constructor, allocates memory to buffer messages.
+             *
+             * If name is set, only files in that format are accepted.
+             */
+            dem_stream_compressed(std::string name = "") : buffer(nullptr), bufferSnappy(nullptr), only(name),
+                pos(0), parsingState(0)
+            {
+                buffer = new char[DOTA_SNAPPY_BUFSIZE];
+                bufferSnappy = new char[DOTA_SNAPPY_BUFSIZE];
+            }
+
+            /** Copy constructor, don't allow copying */
+            dem_stream_compressed(const dem_stream_compressed &s) = delete;
+
+            /** Move constructor, don't allow moving */
+            dem_stream_compressed(dem_stream_compressed &&stream) = delete;
+
+            /** Destructor, free's allocated memory */
+            virtual ~dem_stream_compressed() {
+                in.reset();
+
+                delete[] buffer;
+                delete[] bufferSnappy;
+            }
+
+            /** Whether there are still messages left to be parsed */
+            virtual bool good() {
+                return in.good() && (parsingState != 2);
+            }
+
+            /** Opens a DEM file from the given path */
+            virtual void open(std::string path);
+
+            /** Returns a message */
+            virtual demMessage_t read(const bool skip = false);
+
+            /** Move to the desired minute in the replay */
+            virtual void move(uint32_t min);
+
+            /** Uncompresses a message returned by read with deferred decompression */
+            virtual void decompress(demMessage_t &msg);
+
+            /** Returns the name of the format of the opened file */
+            const std::string& getFormat() const {
+                return current;
+            }
+
+            /** Registers an additional format, not thread-safe, call before opening any streams */
+            static void addFormat(format f);
+        private:
+            /** Internal buffer (message) */
+            char* buffer;
+            /** Internal buffer (uncompressed message) */
+            char* bufferSnappy;
+
+            /** Compressed file */
+            std::ifstream stream;
+            /** Decompressed view of the file */
+            boost::iostreams::filtering_istream in;
+
+            /** Path to opened replay */
+            std::string file;
+            /** Format to restrict to, empty if any format is accepted */
+            std::string only;
+            /** Format of the opened file */
+            std::string current;
+            /** Position in the decompressed data */
+            std::size_t pos;
+            /** Parsing state */
+            uint32_t parsingState;
+
+            /** Returns all known formats */
+            static std::vector<format>& formats();
+
+            /** Opens the file from the start and verifies the header */
+            void rewind();
+
+            /** Decompresses and discards data up to the given position */
+            void skipTo(std::size_t target);
+
+            /** Reads a varint32 from the stream (protobuf serialization format) */
+            uint32_t readVarInt();
+    };
+
+    /// @}
+}
+
+#endif // DOTA_DECOMPRESS
+#endif // _DOTA_DEM_STREAM_COMPRESSED_HPP_
@@ -21,7 +21,8 @@
  */
 
 
-#include <set>
+#include <cstring>
+
 #include <snappy.h>
 
 #include <alice/demo.pb.h>
@@ -29,6 +30,10 @@
 
 namespace dota {
     void dem_stream_file::open(std::string path) {
+        // make sure nothing is read from a previous replay
+        stopReadAhead();
+        nextPos = sizeof(demHeader_t);
+
         // open stream
         stream.open(path.c_str(), std::ifstream::in | std::ifstream::binary);
         D_( std::cout << "[dem_stream] Opening replay: " << path << " " << D_FILE << " " << __LINE__ << std::endl;, 1 )
@@ -39,6 +44,10 @@ namespace dota {
                 << EArg<1>::info(path)
             );
 
+        // the header might not have been written yet
+        followEnd = 0;
+        wait(sizeof(demHeader_t));
+
         // check filesize
         const std::streampos fstart = stream.tellg();
         stream.seekg (0, std::ios::end);
@@ -66,6 +75,18 @@ namespace dota {
 
         // save path for later
         file = path;
+
+        // load a previously generated index
+        loadIndex(path, fsize);
+    }
+
+    bool dem_stream_file::good() {
+        if (!producer.joinable())
+            return stream.good() && (parsingState != 2);
+
+        // data is still buffered or on it's way
+        std::lock_guard<std::mutex> lock(ringLock);
+        return (parsingState != 2) && ((ringCount > (ringHeld ? 1 : 0)) || !ringDone);
     }
 
     demMessage_t dem_stream_file::read(const bool skip) {
@@ -73,25 +94,30 @@ namespace dota {
         assert(buffer != nullptr);
         assert(bufferSnappy != nullptr);
 
-        // Static default list of packages that are not parsed
-        static std::set<uint32_t> skips {
-            1, 2, 3, 9, 10, 11, 12, 13, 14
-        };
+        if (!ring.empty())
+            return readAhead(skip);
 
+        uint32_t type;
+        demMessage_t msg = fetch(skip ? skipMask : 0, type, bufferSnappy);
+
+        // Check if this is the last message
+        if (parsingState == 1) parsingState = 2;
+        if (type == 0)         parsingState = 1; // marks the message before the laste one
+
+        return msg;
+    }
+
+    demMessage_t dem_stream_file::fetch(const uint32_t mask, uint32_t &type, char* out) {
         // Get type / tick / size
-        uint32_t type = readVarInt();
+        type = readVarInt();
         const bool compressed = type & DEM_IsCompressed;
         type = (type & ~DEM_IsCompressed);
 
         uint32_t tick = readVarInt();
         uint32_t size = readVarInt();
 
-        // Check if this is the last message
-        if (parsingState == 1) parsingState = 2;
-        if (type == 0)         parsingState = 1; // marks the message before the laste one
-
         // skip messages if skip is set
-        if (skip && skips.count(type)) {
+        if (isSkipped(mask, type)) {
             stream.seekg(size, std::ios::cur); // seek forward
             D_( std::cout << "[dem_stream] Skipping Message: " << " " << type << D_FILE << " " << __LINE__ << std::endl;, 2 )
             return demMessage_t{false, 0, 0, nullptr, 0}; // return empty msg
@@ -105,78 +131,218 @@ namespace dota {
                 << EArgT<1, std::size_t>::info(size)
             ));
 
-        demMessage_t msg {compressed, tick, type, nullptr, 0}; // return msg
-        stream.read(buffer, size);
+        // uncompressed messages are read into the output buffer directly
+        char* raw = compressed ? buffer : out;
 
-        // Check if we need to uncompress
-        if (compressed && snappy::IsValidCompressedBuffer(buffer, size)) {
-            D_( std::cout << "[dem_stream] Uncompressing Message: " << " " << type << D_FILE << " " << __LINE__ << std::endl;, 3 )
-            std::size_t uSize;
+        wait(size);
+        stream.read(raw, size);
 
-            // Check if we can get the output length
-            if (!snappy::GetUncompressedLength(buffer, size, &uSize)) {
-                BOOST_THROW_EXCEPTION((demInvalidCompression()
-                    << EArg<1>::info(file)
-                    << EArgT<2, std::streampos>::info(stream.gcount())
-                    << EArgT<3, std::size_t>::info(size)
-                    << EArgT<4, uint32_t>::info(type)
-                ));
-            }
+        if (stream.gcount() != size)
+            BOOST_THROW_EXCEPTION((demUnexpectedEOF()
+                << EArg<1>::info(file)
+                << EArgT<2, std::streamsize>::info(stream.gcount())
+                << EArgT<3, std::size_t>::info(size)
+            ));
 
-            // Check if it fits in the buffer
-            if (uSize > DOTA_DEM_BUFSIZE)
-                BOOST_THROW_EXCEPTION((demMessageToBig()
-                    << EArgT<1, std::size_t>::info(uSize)
-                ));
+        demMessage_t msg {compressed, tick, type, raw, size, nullptr}; // return msg
 
-            // Make sure its uncompressed
-            if (!snappy::RawUncompress(buffer, size, bufferSnappy))
-                BOOST_THROW_EXCEPTION((demInvalidCompression()
-                    << EArg<1>::info(file)
-                    << EArgT<2, std::streampos>::info(stream.gcount())
-                    << EArgT<3, std::size_t>::info(size)
-                    << EArgT<4, uint32_t>::info(type)
-                ));
-
-            msg.msg = bufferSnappy;
-            msg.size = uSize;
-        } else {
-            msg.msg = buffer;
-            msg.size = size;
+        // Check if we need to uncompress, the read-ahead thread always does it in the background
+        if (compressed) {
+            msg.source = this;
+
+            if (!lazy || !ring.empty())
+                uncompress(msg, out);
         }
 
         return msg;
     }
 
-    void dem_stream_file::move(uint32_t min) {
-        // generate the cache
-        if (fpackcache.empty()) {
-            stream.seekg (sizeof(demHeader_t), std::ios::beg);
-            fpackcache.push_back(sizeof(demHeader_t)); // 0 min start
+    void dem_stream_file::decompress(demMessage_t &msg) {
+        uncompress(msg, bufferSnappy);
+    }
+
+    void dem_stream_file::uncompress(demMessage_t &msg, char* out) {
+        msg.source = nullptr;
+
+        // not compressed after all, use as is but move it out of the shared buffer, the read-ahead
+        // thread reuses it for the next message
+        if (!snappy::IsValidCompressedBuffer(msg.msg, msg.size)) {
+            memcpy(out, msg.msg, msg.size);
+            msg.msg = out;
+            return;
+        }
+
+        D_( std::cout << "[dem_stream] Uncompressing Message: " << " " << msg.type << D_FILE << " " << __LINE__ << std::endl;, 3 )
+        std::size_t uSize;
+
+        // Check if we can get the output length
+        if (!snappy::GetUncompressedLength(msg.msg, msg.size, &uSize)) {
+            BOOST_THROW_EXCEPTION((demInvalidCompression()
+                << EArg<1>::info(file)
+                << EArgT<2, uint32_t>::info(msg.tick)
+                << EArgT<3, std::size_t>::info(msg.size)
+                << EArgT<4, uint32_t>::info(msg.type)
+            ));
+        }
+
+        // Check if it fits in the buffer
+        if (uSize > DOTA_DEM_BUFSIZE)
+            BOOST_THROW_EXCEPTION((demMessageToBig()
+                << EArgT<1, std::size_t>::info(uSize)
+            ));
+
+        // Make sure its uncompressed
+        if (!snappy::RawUncompress(msg.msg, msg.size, out))
+            BOOST_THROW_EXCEPTION((demInvalidCompression()
+                << EArg<1>::info(file)
+                << EArgT<2, uint32_t>::info(msg.tick)
+                << EArgT<3, std::size_t>::info(msg.size)
+                << EArgT<4, uint32_t>::info(msg.type)
+            ));
+
+        msg.compressedSize = msg.size;
+        msg.msg = out;
+        msg.size = uSize;
+    }
+
+    demMessage_t dem_stream_file::readAhead(const bool skip) {
+        // the read-ahead thread can only skip what it has been told to skip
+        const uint32_t mask = skip ? skipMask : 0;
+        if (producer.joinable() && ringMask != mask)
+            stopReadAhead();
 
-            // Get type / tick / size
-            uint32_t type = 0;
+        // start reading ahead from the next message we are going to return
+        if (!producer.joinable()) {
+            D_( std::cout << "[dem_stream] Starting read-ahead at " << nextPos << " " << D_FILE << " " << __LINE__ << std::endl;, 2 )
+            stream.clear();
+            stream.seekg(nextPos);
 
-            do {
-                uint32_t p = stream.tellg();
-                type = readVarInt() & ~DEM_IsCompressed;
-                uint32_t tick = readVarInt();
-                uint32_t size = readVarInt();
+            ringMask = mask;
+            producer = std::thread(&dem_stream_file::produce, this);
+        }
+
+        std::unique_lock<std::mutex> lock(ringLock);
+
+        // hand the slot returned last time back to the read-ahead thread
+        if (ringHeld) {
+            ringHeld = false;
+            ringRead = (ringRead + 1) % ring.size();
+            --ringCount;
+            ringFreed.notify_one();
+        }
+
+        while (ringCount == 0 && !ringDone) {
+            ringFilled.wait(lock);
+        }
 
-                if (type == 13) {
-                    fpackcache.push_back(p);
-                    D_( std::cout << "[dem_stream] Adding fullpacket at position " << " " << p << D_FILE << " " << __LINE__ << std::endl;, 3 )
+        if (ringCount == 0) {
+            if (ringError)
+                std::rethrow_exception(ringError);
+
+            BOOST_THROW_EXCEPTION(demUnexpectedEOF()
+                << EArg<1>::info(file)
+            );
+        }
+
+        slot &s = ring[ringRead];
+        ringHeld = true;
+        nextPos = s.end;
+
+        // Check if this is the last message
+        if (parsingState == 1) parsingState = 2;
+        if (s.type == 0)       parsingState = 1; // marks the message before the laste one
+
+        return s.msg;
+    }
+
+    void dem_stream_file::produce() {
+        try {
+            bool last = false;
+
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(ringLock);
+                    while (ringCount == ring.size() && !ringStop) {
+                        ringFreed.wait(lock);
+                    }
+
+                    if (ringStop)
+                        break;
                 }
 
-                stream.seekg(size, std::ios::cur);
-            } while (type != 0);
+                // the slot at ringWrite is not visible to the reader until ringCount is increased
+                slot &s = ring[ringWrite];
+                s.msg = fetch(ringMask, s.type, s.buffer);
+                s.end = stream.tellg();
+
+                {
+                    std::lock_guard<std::mutex> lock(ringLock);
+                    ringWrite = (ringWrite + 1) % ring.size();
+                    ++ringCount;
+                }
+                ringFilled.notify_one();
+
+                // the message after the stop message is the last one
+                if (last)
+                    break;
+
+                if (s.type == 0)
+                    last = true;
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(ringLock);
+            ringError = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(ringLock);
+            ringDone = true;
+        }
+        ringFilled.notify_one();
+    }
+
+    void dem_stream_file::stopReadAhead() {
+        if (!producer.joinable())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(ringLock);
+            ringStop = true;
+        }
+        ringFreed.notify_one();
+        producer.join();
+
+        // drop everything that has been buffered
+        ringRead = ringWrite = ringCount = 0;
+        ringHeld = ringDone = ringStop = false;
+        ringError = nullptr;
+
+        stream.clear();
+    }
+
+    void dem_stream_file::move(uint32_t min) {
+        // the read-ahead thread restarts from the new position on the next read
+        stopReadAhead();
+
+        // generate the cache
+        if (index.empty()) {
+            stream.seekg (sizeof(demHeader_t), std::ios::beg);
+            buildIndex(sizeof(demHeader_t),
+                [this]() { return (uint32_t) stream.tellg(); },
+                [this]() { return readVarInt(); },
+                [this](uint32_t size) { stream.seekg(size, std::ios::cur); }
+            );
+
+            saveIndex(file);
         }
 
         // seek to the fullpacket at the desired position
-        if (fpackcache.size() <= min)
-            min = fpackcache.size() - 1;
+        if (index.fullpackets.size() <= min)
+            min = index.fullpackets.size() - 1;
 
-        stream.seekg(fpackcache[min]);
+        stream.seekg(index.fullpackets[min]);
+        nextPos = index.fullpackets[min];
+        parsingState = 0;
     }
 
     uint32_t dem_stream_file::readVarInt() {
@@ -189,11 +355,12 @@ namespace dota {
                 BOOST_THROW_EXCEPTION(demCorrupted()
                     << EArg<1>::info(file)
                 );
-            } else if (!good()) {
+            } else if (!stream.good()) {
                 BOOST_THROW_EXCEPTION(demUnexpectedEOF()
                     << EArg<1>::info(file)
                 );
             } else {
+                wait(1);
                 buffer = stream.get();
                 result |= (uint32_t)(buffer & 0x7F) << ( 7 * count );
                 ++count;
@@ -202,4 +369,48 @@ namespace dota {
 
         return result;
     }
+
+    void dem_stream_file::wait(std::streamoff bytes) {
+        if (followTimeout == 0)
+            return;
+
+        const std::streampos pos = stream.tellg();
+        const std::streampos target = pos + bytes;
+
+        // enough data the last time we checked
+        if (target <= followEnd)
+            return;
+
+        auto idle = std::chrono::steady_clock::now();
+
+        while (true) {
+            stream.seekg(0, std::ios::end);
+            const std::streampos end = stream.tellg();
+            stream.seekg(pos);
+
+            if (end >= target) {
+                followEnd = end;
+                return;
+            }
+
+            // restart the timeout each time the file grows
+            const auto now = std::chrono::steady_clock::now();
+            if (end != followEnd) {
+                followEnd = end;
+                idle = now;
+            } else if (now - idle > std::chrono::milliseconds(followTimeout)) {
+                D_( std::cout << "[dem_stream] No new data after " << followTimeout << " ms " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+                return;
+            }
+
+            // don't hold up stopping the read-ahead thread
+            {
+                std::lock_guard<std::mutex> lock(ringLock);
+                if (ringStop)
+                    return;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(followInterval));
+        }
+    }
 }
\ No newline at end of file
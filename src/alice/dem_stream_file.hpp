@@ -26,9 +26,18 @@
 /// Defines a fixed amount of memory to allocate for the internal buffer of the stream
 #define DOTA_DEM_BUFSIZE 0x100000 // 1 MB
 
+/// Defines the default number of messages buffered ahead when read-ahead is enabled
+#define DOTA_DEM_READAHEAD 8
+
 #include <string>
 #include <fstream>
 #include <utility>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <chrono>
 
 #include <alice/exception.hpp>
 #include <alice/dem.hpp>
@@ -49,13 +58,28 @@ namespace dota {
      *
      * This class allocates a fixed buffer of 2 MB to be used for copy-less
      * message return as well as uncompressing the data.
+     *
+     * If constructed with a read-ahead greater than 0, a background thread reads and uncompresses
+     * up to that many messages ahead of the parser. Each buffered message requires another 1 MB.
+     * Pointers returned by read() stay valid until the next call to read() in both modes.
+     *
+     * Replays that are still being written can be read by calling follow() before open. Reads
+     * then wait for the file to grow instead of failing at the end of the file.
      */
     class dem_stream_file : public dem_stream {
         public:
-            /** Constructor, allocates memory to buffer file contents */
-            dem_stream_file() : buffer(nullptr), bufferSnappy(nullptr), parsingState(0) {
+            /** Constructor, allocates memory to buffer file contents, readAhead > 0 enables the read-ahead thread */
+            dem_stream_file(uint32_t readAhead = 0) : buffer(nullptr), bufferSnappy(nullptr), parsingState(0),
+                ring(readAhead), ringRead(0), ringWrite(0), ringCount(0), ringHeld(false), ringDone(false),
+                ringStop(false), ringMask(0), nextPos(sizeof(demHeader_t)),
+                followTimeout(0), followInterval(DOTA_DEM_FOLLOW_INTERVAL), followEnd(0)
+            {
                 buffer = new char[DOTA_DEM_BUFSIZE];
                 bufferSnappy = new char[DOTA_DEM_BUFSIZE];
+
+                for (auto &s : ring) {
+                    s.buffer = new char[DOTA_DEM_BUFSIZE];
+                }
             }
 
             /** Copy constructor, don't allow copying */
@@ -66,17 +90,21 @@ namespace dota {
 
             /** Destructor, free's allocated memory */
             virtual ~dem_stream_file() {
+                stopReadAhead();
+
                 delete[] buffer;
                 delete[] bufferSnappy;
 
+                for (auto &s : ring) {
+                    delete[] s.buffer;
+                }
+
                 if (stream.is_open())
                     stream.close();
             }
 
             /** Whether there are still messages left to be parsed */
-            virtual bool good() {
-                return stream.good() && (parsingState != 2);
-            }
+            virtual bool good();
 
             /** Opens a DEM file from the given path */
             virtual void open(std::string path);
@@ -86,7 +114,33 @@ namespace dota {
 
             /** Move to the desired minute in the replay */
             virtual void move(uint32_t min);
+
+            /** Uncompresses a message returned by read with deferred decompression, not used with read-ahead */
+            virtual void decompress(demMessage_t &msg);
+
+            /**
+             * Wait for data that has not been written yet.
+             *
+             * Reads block until the file grows, polling every interval ms. If the file has not grown
+             * for timeout ms, reading fails as usual. A timeout of 0 disables following.
+             */
+            void follow(uint32_t timeout, uint32_t interval = DOTA_DEM_FOLLOW_INTERVAL) {
+                followTimeout = timeout;
+                followInterval = interval;
+            }
         private:
+            /** A single message buffered by the read-ahead thread */
+            struct slot {
+                /** Message, points into buffer */
+                demMessage_t msg;
+                /** Message type, also set for skipped messages */
+                uint32_t type;
+                /** Stream position after the message */
+                std::streampos end;
+                /** Uncompressed message data */
+                char* buffer;
+            };
+
             /** Internal buffer (message) */
             char* buffer;
             /** Internal buffer (uncompressed message) */
@@ -98,8 +152,60 @@ namespace dota {
             std::ifstream stream;
             /** Parsing state */
             uint32_t parsingState;
-            /** Position cache for fullpackets */
-            std::vector<uint32_t> fpackcache;
+
+            /** Messages read ahead, empty if read-ahead is disabled */
+            std::vector<slot> ring;
+            /** Index of the next slot to return */
+            std::size_t ringRead;
+            /** Index of the next slot to fill */
+            std::size_t ringWrite;
+            /** Number of filled slots, including the one held by the caller */
+            std::size_t ringCount;
+            /** Whether the slot at ringRead has been returned and is still in use */
+            bool ringHeld;
+            /** Set by the read-ahead thread once it stops producing */
+            bool ringDone;
+            /** Tells the read-ahead thread to stop */
+            bool ringStop;
+            /** Skip mask the read-ahead thread was started with */
+            uint32_t ringMask;
+            /** Exception thrown in the read-ahead thread, rethrown on read */
+            std::exception_ptr ringError;
+            /** Protects the ring state */
+            std::mutex ringLock;
+            /** Signaled when a slot is filled or the thread stops */
+            std::condition_variable ringFilled;
+            /** Signaled when a slot is freed or the thread should stop */
+            std::condition_variable ringFreed;
+            /** Read-ahead thread */
+            std::thread producer;
+            /** Stream position of the next message returned to the caller */
+            std::streampos nextPos;
+
+            /** Milliseconds to wait for the file to grow, 0 if not following */
+            uint32_t followTimeout;
+            /** Milliseconds between two checks of the file size */
+            uint32_t followInterval;
+            /** Last known size of the file */
+            std::streampos followEnd;
+
+            /** Reads the next message, skipping types in mask, uncompressed data is written to out */
+            demMessage_t fetch(const uint32_t mask, uint32_t &type, char* out);
+
+            /** Uncompresses the message into out */
+            void uncompress(demMessage_t &msg, char* out);
+
+            /** Returns the next message buffered by the read-ahead thread */
+            demMessage_t readAhead(const bool skip);
+
+            /** Read-ahead thread, fills the ring until the end of the replay */
+            void produce();
+
+            /** Stops the read-ahead thread and drops all buffered messages */
+            void stopReadAhead();
+
+            /** Waits until the given number of bytes after the current position are available if following */
+            void wait(std::streamoff bytes);
 
             /** Reads a varint32 from the stream (protobuf serialization format) */
             uint32_t readVarInt();
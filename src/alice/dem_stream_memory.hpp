@@ -23,15 +23,13 @@
 #ifndef _DOTA_DEM_STREAM_MEMORY_HPP_
 #define _DOTA_DEM_STREAM_MEMORY_HPP_
 
-/// Defines a fixed amount of memory to allocate for the internal buffer for snappy
-#define DOTA_SNAPPY_BUFSIZE 0x100000 // 1 MB
-
 #include <string>
 #include <fstream>
 #include <utility>
 
 #include <alice/exception.hpp>
 #include <alice/dem.hpp>
+#include <alice/dem_stream_buffer.hpp>
 
 namespace dota {
     /// @defgroup CORE Core
@@ -44,12 +42,10 @@ namespace dota {
      * It addition it allocates 1MB of fixed space to take care of decompressing
      * messages with snappy.
      */
-    class dem_stream_memory : public dem_stream {
+    class dem_stream_memory : public dem_stream_buffer {
         public:
             /** Constructor, allocates memory to buffer file contents */
-            dem_stream_memory() : buffer(nullptr), bufferSnappy(nullptr), pos(0), size(0), parsingState(0) {
-                bufferSnappy = new char[DOTA_SNAPPY_BUFSIZE];
-            }
+            dem_stream_memory() : buffer(nullptr) {}
 
             /** Copy constructor, don't allow copying */
             dem_stream_memory(const dem_stream_memory &s) = delete;
@@ -61,42 +57,13 @@ namespace dota {
             virtual ~dem_stream_memory() {
                 if (buffer != nullptr)
                     delete[] buffer;
-
-                delete[] bufferSnappy;
-            }
-
-            /** Whether there are still messages left to be parsed */
-            virtual bool good() {
-                return (pos < size) && (parsingState != 2);
             }
 
             /** Opens a DEM file from the given path */
             virtual void open(std::string path);
-
-            /** Returns a message */
-            virtual demMessage_t read(const bool skip = false);
-
-            /** Move to the desired minute in the replay */
-            virtual void move(uint32_t min);
         private:
-            /** Internal buffer (message) */
+            /** File contents */
             char* buffer;
-            /** Internal buffer (uncompressed message) */
-            char* bufferSnappy;
-
-            /** Path to opened replay */
-            std::string file;
-            /** Position in the array */
-            uint32_t pos;
-            /** Maximum size */
-            uint32_t size;
-            /** Parsing state */
-            uint32_t parsingState;
-            /** Position cache for fullpackets */
-            std::vector<uint32_t> fpackcache;
-
-            /** Reads a varint32 from the array (protobuf serialization format) */
-            uint32_t readVarInt();
     };
 
     /// @}
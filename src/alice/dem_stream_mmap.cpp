@@ -0,0 +1,153 @@
+/**
+ * @file dem_stream_mmap.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License. *
+ */
+
+#include <alice/config.hpp>
+
+#if DOTA_MMAP
+
+#include <cerrno>
+#include <chrono>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <alice/dem_stream_mmap.hpp>
+
+namespace dota {
+    void dem_stream_mmap::open(std::string path) {
+        // drop a previous mapping
+        close();
+
+        // open file
+        fd = ::open(path.c_str(), O_RDONLY);
+
+        // check if it was successful
+        if (fd < 0)
+            BOOST_THROW_EXCEPTION(demFileNotAccessible()
+                << EArg<1>::info(path)
+            );
+
+        // save path for later
+        file = path;
+
+        // check filesize
+        struct stat fstat;
+        if (::fstat(fd, &fstat) != 0)
+            BOOST_THROW_EXCEPTION((demFileNotAccessible()
+                << EArg<1>::info(path)
+                << EArgT<2, int>::info(errno)
+            ));
+
+        // map the whole file
+        map(fstat.st_size);
+
+        // verify the header
+        dem_stream_buffer::open(path);
+    }
+
+    void dem_stream_mmap::move(uint32_t min) {
+        dem_stream_buffer::move(min);
+
+        // we are going to read from here on, ask the kernel to page it in
+        const std::size_t page = sysconf(_SC_PAGESIZE);
+        const std::size_t start = pos - (pos % page);
+        madvise(const_cast<char*>(data) + start, size - start, MADV_WILLNEED);
+    }
+
+    void dem_stream_mmap::close() {
+        if (data != nullptr)
+            munmap(const_cast<char*>(data), size);
+
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+
+        attach(nullptr, 0);
+    }
+
+    void dem_stream_mmap::map(std::size_t fsize) {
+        if (data != nullptr)
+            munmap(const_cast<char*>(data), size);
+
+        data = nullptr;
+        size = 0;
+
+        // can't map empty files
+        if (fsize == 0)
+            return;
+
+        void* m = mmap(nullptr, fsize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m == MAP_FAILED)
+            BOOST_THROW_EXCEPTION((demMappingFailed()
+                << EArg<1>::info(file)
+                << EArgT<2, int>::info(errno)
+            ));
+
+        data = static_cast<const char*>(m);
+        size = fsize;
+
+        // we read front to back, let the kernel read ahead and drop pages behind us
+        const std::size_t page = sysconf(_SC_PAGESIZE);
+        const std::size_t start = pos - (pos % page);
+        madvise(m, size, MADV_SEQUENTIAL);
+        madvise(static_cast<char*>(m) + start, size - start, MADV_WILLNEED);
+    }
+
+    bool dem_stream_mmap::wait(std::size_t end) {
+        if (followTimeout == 0 || fd < 0)
+            return false;
+
+        std::size_t last = size;
+        auto idle = std::chrono::steady_clock::now();
+
+        while (true) {
+            struct stat fstat;
+            if (::fstat(fd, &fstat) != 0)
+                return false;
+
+            // map everything that is available now
+            const std::size_t fsize = fstat.st_size;
+            if (fsize >= end) {
+                map(fsize);
+                return true;
+            }
+
+            // restart the timeout each time the file grows
+            const auto now = std::chrono::steady_clock::now();
+            if (fsize != last) {
+                last = fsize;
+                idle = now;
+            } else if (now - idle > std::chrono::milliseconds(followTimeout)) {
+                D_( std::cout << "[dem_stream] No new data after " << followTimeout << " ms " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(followInterval));
+        }
+    }
+}
+
+#endif // DOTA_MMAP
@@ -0,0 +1,117 @@
+/**
+ * @file dem_stream_mmap.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License. *
+ */
+
+#ifndef _DOTA_DEM_STREAM_MMAP_HPP_
+#define _DOTA_DEM_STREAM_MMAP_HPP_
+
+#include <alice/config.hpp>
+
+#if DOTA_MMAP
+
+#include <string>
+#include <utility>
+
+#include <alice/exception.hpp>
+#include <alice/dem.hpp>
+#include <alice/dem_stream_buffer.hpp>
+
+namespace dota {
+    /// @defgroup EXCEPTIONS Exceptions
+    /// @{
+
+    /// Thrown when the replay cannot be mapped into memory
+    CREATE_EXCEPTION( demMappingFailed, "Unable to map file into memory." )
+
+    /// @}
+    /// @defgroup CORE Core
+    /// @{
+
+    /**
+     * Read the contents of a demo file (Dota 2 Replay) by mapping it into memory.
+     *
+     * Uncompressed messages point directly into the mapping, no copy is made. The kernel is
+     * told that the file is read sequentially so it can read ahead and drop pages behind us.
+     * Compressed messages are uncompressed into a fixed 1MB buffer.
+     *
+     * Replays that are still being written can be read by calling follow() before open. The file
+     * is mapped again each time it grows.
+     */
+    class dem_stream_mmap : public dem_stream_buffer {
+        public:
+            /** Constructor */
+            dem_stream_mmap() : fd(-1), followTimeout(0), followInterval(DOTA_DEM_FOLLOW_INTERVAL) {}
+
+            /** Copy constructor, don't allow copying */
+            dem_stream_mmap(const dem_stream_mmap &s) = delete;
+
+            /** Move constructor, don't allow moving */
+            dem_stream_mmap(dem_stream_mmap &&stream) = delete;
+
+            /** Destructor, unmaps the file */
+            virtual ~dem_stream_mmap() {
+                close();
+            }
+
+            /** Whether there are still messages left to be parsed */
+            virtual bool good() {
+                return ((pos < size) || followTimeout) && (parsingState != 2);
+            }
+
+            /** Opens a DEM file from the given path */
+            virtual void open(std::string path);
+
+            /** Move to the desired minute in the replay */
+            virtual void move(uint32_t min);
+
+            /**
+             * Wait for data that has not been written yet.
+             *
+             * Reads block until the file grows, polling every interval ms. If the file has not grown
+             * for timeout ms, reading fails as usual. A timeout of 0 disables following.
+             */
+            void follow(uint32_t timeout, uint32_t interval = DOTA_DEM_FOLLOW_INTERVAL) {
+                followTimeout = timeout;
+                followInterval = interval;
+            }
+        protected:
+            /** Waits for the file to grow if following */
+            virtual bool wait(std::size_t end);
+        private:
+            /** File descriptor of the mapped file */
+            int fd;
+            /** Milliseconds to wait for the file to grow, 0 if not following */
+            uint32_t followTimeout;
+            /** Milliseconds between two checks of the file size */
+            uint32_t followInterval;
+
+            /** Maps the first size bytes of the file */
+            void map(std::size_t size);
+
+            /** Unmaps the file and closes the descriptor */
+            void close();
+    };
+
+    /// @}
+}
+
+#endif // DOTA_MMAP
+#endif // _DOTA_DEM_STREAM_MMAP_HPP_
@@ -0,0 +1,2270 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: dota_commonmessages.proto
+
+#include "dota_commonmessages.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR CDOTAMsg_LocationPing::CDOTAMsg_LocationPing(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.target_)*/0
+  , /*decltype(_impl_.direct_ping_)*/false
+  , /*decltype(_impl_.type_)*/0} {}
+struct CDOTAMsg_LocationPingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CDOTAMsg_LocationPingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CDOTAMsg_LocationPingDefaultTypeInternal() {}
+  union {
+    CDOTAMsg_LocationPing _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CDOTAMsg_LocationPingDefaultTypeInternal _CDOTAMsg_LocationPing_default_instance_;
+PROTOBUF_CONSTEXPR CDOTAMsg_ItemAlert::CDOTAMsg_ItemAlert(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.itemid_)*/0} {}
+struct CDOTAMsg_ItemAlertDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CDOTAMsg_ItemAlertDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CDOTAMsg_ItemAlertDefaultTypeInternal() {}
+  union {
+    CDOTAMsg_ItemAlert _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CDOTAMsg_ItemAlertDefaultTypeInternal _CDOTAMsg_ItemAlert_default_instance_;
+PROTOBUF_CONSTEXPR CDOTAMsg_MapLine::CDOTAMsg_MapLine(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.initial_)*/false} {}
+struct CDOTAMsg_MapLineDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CDOTAMsg_MapLineDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CDOTAMsg_MapLineDefaultTypeInternal() {}
+  union {
+    CDOTAMsg_MapLine _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CDOTAMsg_MapLineDefaultTypeInternal _CDOTAMsg_MapLine_default_instance_;
+PROTOBUF_CONSTEXPR CDOTAMsg_WorldLine::CDOTAMsg_WorldLine(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.z_)*/0
+  , /*decltype(_impl_.initial_)*/false
+  , /*decltype(_impl_.end_)*/false} {}
+struct CDOTAMsg_WorldLineDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CDOTAMsg_WorldLineDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CDOTAMsg_WorldLineDefaultTypeInternal() {}
+  union {
+    CDOTAMsg_WorldLine _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CDOTAMsg_WorldLineDefaultTypeInternal _CDOTAMsg_WorldLine_default_instance_;
+PROTOBUF_CONSTEXPR CDOTAMsg_SendStatPopup::CDOTAMsg_SendStatPopup(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.stat_strings_)*/{}
+  , /*decltype(_impl_.stat_images_)*/{}
+  , /*decltype(_impl_.style_)*/0} {}
+struct CDOTAMsg_SendStatPopupDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CDOTAMsg_SendStatPopupDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CDOTAMsg_SendStatPopupDefaultTypeInternal() {}
+  union {
+    CDOTAMsg_SendStatPopup _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CDOTAMsg_SendStatPopupDefaultTypeInternal _CDOTAMsg_SendStatPopup_default_instance_;
+PROTOBUF_CONSTEXPR CDOTAMsg_CoachHUDPing::CDOTAMsg_CoachHUDPing(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tgtpath_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.x_)*/0u
+  , /*decltype(_impl_.y_)*/0u} {}
+struct CDOTAMsg_CoachHUDPingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CDOTAMsg_CoachHUDPingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CDOTAMsg_CoachHUDPingDefaultTypeInternal() {}
+  union {
+    CDOTAMsg_CoachHUDPing _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CDOTAMsg_CoachHUDPingDefaultTypeInternal _CDOTAMsg_CoachHUDPing_default_instance_;
+static ::_pb::Metadata file_level_metadata_dota_5fcommonmessages_2eproto[6];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_dota_5fcommonmessages_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_dota_5fcommonmessages_2eproto = nullptr;
+
+const uint32_t TableStruct_dota_5fcommonmessages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_LocationPing, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_LocationPing, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_LocationPing, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_LocationPing, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_LocationPing, _impl_.target_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_LocationPing, _impl_.direct_ping_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_LocationPing, _impl_.type_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_ItemAlert, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_ItemAlert, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_ItemAlert, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_ItemAlert, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_ItemAlert, _impl_.itemid_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_MapLine, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_MapLine, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_MapLine, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_MapLine, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_MapLine, _impl_.initial_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_WorldLine, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_WorldLine, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_WorldLine, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_WorldLine, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_WorldLine, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_WorldLine, _impl_.initial_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_WorldLine, _impl_.end_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_SendStatPopup, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_SendStatPopup, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_SendStatPopup, _impl_.style_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_SendStatPopup, _impl_.stat_strings_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_SendStatPopup, _impl_.stat_images_),
+  0,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_CoachHUDPing, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_CoachHUDPing, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_CoachHUDPing, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_CoachHUDPing, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::CDOTAMsg_CoachHUDPing, _impl_.tgtpath_),
+  1,
+  2,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 11, -1, sizeof(::CDOTAMsg_LocationPing)},
+  { 16, 25, -1, sizeof(::CDOTAMsg_ItemAlert)},
+  { 28, 37, -1, sizeof(::CDOTAMsg_MapLine)},
+  { 40, 51, -1, sizeof(::CDOTAMsg_WorldLine)},
+  { 56, 65, -1, sizeof(::CDOTAMsg_SendStatPopup)},
+  { 68, 77, -1, sizeof(::CDOTAMsg_CoachHUDPing)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_CDOTAMsg_LocationPing_default_instance_._instance,
+  &::_CDOTAMsg_ItemAlert_default_instance_._instance,
+  &::_CDOTAMsg_MapLine_default_instance_._instance,
+  &::_CDOTAMsg_WorldLine_default_instance_._instance,
+  &::_CDOTAMsg_SendStatPopup_default_instance_._instance,
+  &::_CDOTAMsg_CoachHUDPing_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_dota_5fcommonmessages_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\031dota_commonmessages.proto\"`\n\025CDOTAMsg_"
+  "LocationPing\022\t\n\001x\030\001 \001(\005\022\t\n\001y\030\002 \001(\005\022\016\n\006ta"
+  "rget\030\003 \001(\005\022\023\n\013direct_ping\030\004 \001(\010\022\014\n\004type\030"
+  "\005 \001(\005\":\n\022CDOTAMsg_ItemAlert\022\t\n\001x\030\001 \001(\005\022\t"
+  "\n\001y\030\002 \001(\005\022\016\n\006itemid\030\003 \001(\005\"9\n\020CDOTAMsg_Ma"
+  "pLine\022\t\n\001x\030\001 \001(\005\022\t\n\001y\030\002 \001(\005\022\017\n\007initial\030\003"
+  " \001(\010\"S\n\022CDOTAMsg_WorldLine\022\t\n\001x\030\001 \001(\005\022\t\n"
+  "\001y\030\002 \001(\005\022\t\n\001z\030\003 \001(\005\022\017\n\007initial\030\004 \001(\010\022\013\n\003"
+  "end\030\005 \001(\010\"~\n\026CDOTAMsg_SendStatPopup\0229\n\005s"
+  "tyle\030\001 \001(\0162\024.EDOTAStatPopupTypes:\024k_EDOT"
+  "A_SPT_Textline\022\024\n\014stat_strings\030\002 \003(\t\022\023\n\013"
+  "stat_images\030\003 \003(\005\">\n\025CDOTAMsg_CoachHUDPi"
+  "ng\022\t\n\001x\030\001 \001(\r\022\t\n\001y\030\002 \001(\r\022\017\n\007tgtpath\030\003 \001("
+  "\t*\305\021\n\025EDOTAChatWheelMessage\022\021\n\rk_EDOTA_C"
+  "W_Ok\020\000\022\023\n\017k_EDOTA_CW_Care\020\001\022\026\n\022k_EDOTA_C"
+  "W_GetBack\020\002\022\030\n\024k_EDOTA_CW_NeedWards\020\003\022\023\n"
+  "\017k_EDOTA_CW_Stun\020\004\022\023\n\017k_EDOTA_CW_Help\020\005\022"
+  "\023\n\017k_EDOTA_CW_Push\020\006\022\026\n\022k_EDOTA_CW_GoodJ"
+  "ob\020\007\022\026\n\022k_EDOTA_CW_Missing\020\010\022\032\n\026k_EDOTA_"
+  "CW_Missing_Top\020\t\022\032\n\026k_EDOTA_CW_Missing_M"
+  "id\020\n\022\035\n\031k_EDOTA_CW_Missing_Bottom\020\013\022\021\n\rk"
+  "_EDOTA_CW_Go\020\014\022\027\n\023k_EDOTA_CW_Initiate\020\r\022"
+  "\025\n\021k_EDOTA_CW_Follow\020\016\022\027\n\023k_EDOTA_CW_Gro"
+  "up_Up\020\017\022\031\n\025k_EDOTA_CW_Spread_Out\020\020\022\031\n\025k_"
+  "EDOTA_CW_Split_Farm\020\021\022\025\n\021k_EDOTA_CW_Atta"
+  "ck\020\022\022\022\n\016k_EDOTA_CW_BRB\020\023\022\023\n\017k_EDOTA_CW_D"
+  "ive\020\024\022\022\n\016k_EDOTA_CW_OMW\020\025\022\030\n\024k_EDOTA_CW_"
+  "Get_Ready\020\026\022\023\n\017k_EDOTA_CW_Bait\020\027\022\023\n\017k_ED"
+  "OTA_CW_Heal\020\030\022\023\n\017k_EDOTA_CW_Mana\020\031\022\022\n\016k_"
+  "EDOTA_CW_OOM\020\032\022\035\n\031k_EDOTA_CW_Skill_Coold"
+  "own\020\033\022\031\n\025k_EDOTA_CW_Ulti_Ready\020\034\022\035\n\031k_ED"
+  "OTA_CW_Enemy_Returned\020\035\022\032\n\026k_EDOTA_CW_Al"
+  "l_Missing\020\036\022\035\n\031k_EDOTA_CW_Enemy_Incoming"
+  "\020\037\022\032\n\026k_EDOTA_CW_Invis_Enemy\020 \022\035\n\031k_EDOT"
+  "A_CW_Enemy_Had_Rune\020!\022\031\n\025k_EDOTA_CW_Spli"
+  "t_Push\020\"\022\035\n\031k_EDOTA_CW_Coming_To_Gank\020#\022"
+  "\033\n\027k_EDOTA_CW_Request_Gank\020$\022 \n\034k_EDOTA_"
+  "CW_Fight_Under_Tower\020%\022\031\n\025k_EDOTA_CW_Den"
+  "y_Tower\020&\022\032\n\026k_EDOTA_CW_Buy_Courier\020\'\022\036\n"
+  "\032k_EDOTA_CW_Upgrade_Courier\020(\022\035\n\031k_EDOTA"
+  "_CW_Need_Detection\020)\022\"\n\036k_EDOTA_CW_They_"
+  "Have_Detection\020*\022\025\n\021k_EDOTA_CW_Buy_TP\020+\022"
+  "\034\n\030k_EDOTA_CW_Reuse_Courier\020,\022\025\n\021k_EDOTA"
+  "_CW_Deward\020-\022\033\n\027k_EDOTA_CW_Building_Mek\020"
+  ".\022\034\n\030k_EDOTA_CW_Building_Pipe\020/\022\035\n\031k_EDO"
+  "TA_CW_Stack_And_Pull\0200\022\023\n\017k_EDOTA_CW_Pul"
+  "l\0201\022\026\n\022k_EDOTA_CW_Pulling\0202\022\024\n\020k_EDOTA_C"
+  "W_Stack\0203\022\027\n\023k_EDOTA_CW_Jungling\0204\022\025\n\021k_"
+  "EDOTA_CW_Roshan\0205\022\032\n\026k_EDOTA_CW_Affirmat"
+  "ive\0206\022\023\n\017k_EDOTA_CW_Wait\0207\022\024\n\020k_EDOTA_CW"
+  "_Pause\0208\022\033\n\027k_EDOTA_CW_Current_Time\0209\022\032\n"
+  "\026k_EDOTA_CW_Check_Runes\020:\022\031\n\025k_EDOTA_CW_"
+  "Smoke_Gank\020;\022\023\n\017k_EDOTA_CW_GLHF\020<\022\023\n\017k_E"
+  "DOTA_CW_Nice\020=\022\025\n\021k_EDOTA_CW_Thanks\020>\022\024\n"
+  "\020k_EDOTA_CW_Sorry\020\?\022\031\n\025k_EDOTA_CW_No_Giv"
+  "e_Up\020@\022\034\n\030k_EDOTA_CW_Just_Happened\020A\022\033\n\027"
+  "k_EDOTA_CW_Game_Is_Hard\020B\022\027\n\023k_EDOTA_CW_"
+  "New_Meta\020C\022\025\n\021k_EDOTA_CW_My_Bad\020D\022\025\n\021k_E"
+  "DOTA_CW_Regret\020E\022\024\n\020k_EDOTA_CW_Relax\020F\022\032"
+  "\n\026k_EDOTA_CW_MissingHero\020G\022\033\n\027k_EDOTA_CW"
+  "_ReturnedHero\020H\022\021\n\rk_EDOTA_CW_GG\020I\022\023\n\017k_"
+  "EDOTA_CW_GGWP\020J\022\025\n\021k_EDOTA_CW_All_GG\020K\022\027"
+  "\n\023k_EDOTA_CW_All_GGWP\020L\022\032\n\026k_EDOTA_CW_Wh"
+  "at_To_Buy\020M\022\034\n\030k_EDOTA_CW_Im_Retreating\020"
+  "N\022\034\n\030k_EDOTA_CW_Space_Created\020O\022\025\n\021k_EDO"
+  "TA_CW_Whoops\020P\022\036\n\032k_EDOTA_CW_Tower_then_"
+  "Back\020Q\022!\n\035k_EDOTA_CW_Barracks_then_Back\020"
+  "R\022\037\n\033k_EDOTA_CW_Ward_Bottom_Rune\020S\022\034\n\030k_"
+  "EDOTA_CW_Ward_Top_Rune\020T\022\027\n\023k_EDOTA_CW_Z"
+  "eus_Ult\020U*r\n\023EDOTAStatPopupTypes\022\030\n\024k_ED"
+  "OTA_SPT_Textline\020\000\022\025\n\021k_EDOTA_SPT_Basic\020"
+  "\001\022\024\n\020k_EDOTA_SPT_Poll\020\002\022\024\n\020k_EDOTA_SPT_G"
+  "rid\020\003*\333\007\n\017dotaunitorder_t\022\030\n\024DOTA_UNIT_O"
+  "RDER_NONE\020\000\022$\n DOTA_UNIT_ORDER_MOVE_TO_P"
+  "OSITION\020\001\022\"\n\036DOTA_UNIT_ORDER_MOVE_TO_TAR"
+  "GET\020\002\022\037\n\033DOTA_UNIT_ORDER_ATTACK_MOVE\020\003\022!"
+  "\n\035DOTA_UNIT_ORDER_ATTACK_TARGET\020\004\022!\n\035DOT"
+  "A_UNIT_ORDER_CAST_POSITION\020\005\022\037\n\033DOTA_UNI"
+  "T_ORDER_CAST_TARGET\020\006\022$\n DOTA_UNIT_ORDER"
+  "_CAST_TARGET_TREE\020\007\022\"\n\036DOTA_UNIT_ORDER_C"
+  "AST_NO_TARGET\020\010\022\037\n\033DOTA_UNIT_ORDER_CAST_"
+  "TOGGLE\020\t\022!\n\035DOTA_UNIT_ORDER_HOLD_POSITIO"
+  "N\020\n\022!\n\035DOTA_UNIT_ORDER_TRAIN_ABILITY\020\013\022\035"
+  "\n\031DOTA_UNIT_ORDER_DROP_ITEM\020\014\022\035\n\031DOTA_UN"
+  "IT_ORDER_GIVE_ITEM\020\r\022\037\n\033DOTA_UNIT_ORDER_"
+  "PICKUP_ITEM\020\016\022\037\n\033DOTA_UNIT_ORDER_PICKUP_"
+  "RUNE\020\017\022!\n\035DOTA_UNIT_ORDER_PURCHASE_ITEM\020"
+  "\020\022\035\n\031DOTA_UNIT_ORDER_SELL_ITEM\020\021\022$\n DOTA"
+  "_UNIT_ORDER_DISASSEMBLE_ITEM\020\022\022\035\n\031DOTA_U"
+  "NIT_ORDER_MOVE_ITEM\020\023\022$\n DOTA_UNIT_ORDER"
+  "_CAST_TOGGLE_AUTO\020\024\022\030\n\024DOTA_UNIT_ORDER_S"
+  "TOP\020\025\022\031\n\025DOTA_UNIT_ORDER_TAUNT\020\026\022\033\n\027DOTA"
+  "_UNIT_ORDER_BUYBACK\020\027\022\031\n\025DOTA_UNIT_ORDER"
+  "_GLYPH\020\030\022)\n%DOTA_UNIT_ORDER_EJECT_ITEM_F"
+  "ROM_STASH\020\031\022\035\n\031DOTA_UNIT_ORDER_CAST_RUNE"
+  "\020\032\022 \n\034DOTA_UNIT_ORDER_PING_ABILITY\020\033\022%\n!"
+  "DOTA_UNIT_ORDER_MOVE_TO_DIRECTION\020\034B\005H\001\200"
+  "\001\000"
+  ;
+static ::_pbi::once_flag descriptor_table_dota_5fcommonmessages_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_dota_5fcommonmessages_2eproto = {
+    false, false, 3882, descriptor_table_protodef_dota_5fcommonmessages_2eproto,
+    "dota_commonmessages.proto",
+    &descriptor_table_dota_5fcommonmessages_2eproto_once, nullptr, 0, 6,
+    schemas, file_default_instances, TableStruct_dota_5fcommonmessages_2eproto::offsets,
+    file_level_metadata_dota_5fcommonmessages_2eproto, file_level_enum_descriptors_dota_5fcommonmessages_2eproto,
+    file_level_service_descriptors_dota_5fcommonmessages_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_dota_5fcommonmessages_2eproto_getter() {
+  return &descriptor_table_dota_5fcommonmessages_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_dota_5fcommonmessages_2eproto(&descriptor_table_dota_5fcommonmessages_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EDOTAChatWheelMessage_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_dota_5fcommonmessages_2eproto);
+  return file_level_enum_descriptors_dota_5fcommonmessages_2eproto[0];
+}
+bool EDOTAChatWheelMessage_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+    case 30:
+    case 31:
+    case 32:
+    case 33:
+    case 34:
+    case 35:
+    case 36:
+    case 37:
+    case 38:
+    case 39:
+    case 40:
+    case 41:
+    case 42:
+    case 43:
+    case 44:
+    case 45:
+    case 46:
+    case 47:
+    case 48:
+    case 49:
+    case 50:
+    case 51:
+    case 52:
+    case 53:
+    case 54:
+    case 55:
+    case 56:
+    case 57:
+    case 58:
+    case 59:
+    case 60:
+    case 61:
+    case 62:
+    case 63:
+    case 64:
+    case 65:
+    case 66:
+    case 67:
+    case 68:
+    case 69:
+    case 70:
+    case 71:
+    case 72:
+    case 73:
+    case 74:
+    case 75:
+    case 76:
+    case 77:
+    case 78:
+    case 79:
+    case 80:
+    case 81:
+    case 82:
+    case 83:
+    case 84:
+    case 85:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EDOTAStatPopupTypes_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_dota_5fcommonmessages_2eproto);
+  return file_level_enum_descriptors_dota_5fcommonmessages_2eproto[1];
+}
+bool EDOTAStatPopupTypes_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* dotaunitorder_t_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_dota_5fcommonmessages_2eproto);
+  return file_level_enum_descriptors_dota_5fcommonmessages_2eproto[2];
+}
+bool dotaunitorder_t_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class CDOTAMsg_LocationPing::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CDOTAMsg_LocationPing>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_target(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_direct_ping(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+CDOTAMsg_LocationPing::CDOTAMsg_LocationPing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CDOTAMsg_LocationPing)
+}
+CDOTAMsg_LocationPing::CDOTAMsg_LocationPing(const CDOTAMsg_LocationPing& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CDOTAMsg_LocationPing* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.target_){}
+    , decltype(_impl_.direct_ping_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:CDOTAMsg_LocationPing)
+}
+
+inline void CDOTAMsg_LocationPing::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.target_){0}
+    , decltype(_impl_.direct_ping_){false}
+    , decltype(_impl_.type_){0}
+  };
+}
+
+CDOTAMsg_LocationPing::~CDOTAMsg_LocationPing() {
+  // @@protoc_insertion_point(destructor:CDOTAMsg_LocationPing)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CDOTAMsg_LocationPing::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CDOTAMsg_LocationPing::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CDOTAMsg_LocationPing::Clear() {
+// @@protoc_insertion_point(message_clear_start:CDOTAMsg_LocationPing)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CDOTAMsg_LocationPing::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 target = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_target(&has_bits);
+          _impl_.target_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool direct_ping = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_direct_ping(&has_bits);
+          _impl_.direct_ping_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 type = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CDOTAMsg_LocationPing::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CDOTAMsg_LocationPing)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_x(), target);
+  }
+
+  // optional int32 y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_y(), target);
+  }
+
+  // optional int32 target = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_target(), target);
+  }
+
+  // optional bool direct_ping = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_direct_ping(), target);
+  }
+
+  // optional int32 type = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CDOTAMsg_LocationPing)
+  return target;
+}
+
+size_t CDOTAMsg_LocationPing::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CDOTAMsg_LocationPing)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional int32 x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+    }
+
+    // optional int32 y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
+    }
+
+    // optional int32 target = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_target());
+    }
+
+    // optional bool direct_ping = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 type = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CDOTAMsg_LocationPing::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CDOTAMsg_LocationPing::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CDOTAMsg_LocationPing::GetClassData() const { return &_class_data_; }
+
+
+void CDOTAMsg_LocationPing::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CDOTAMsg_LocationPing*>(&to_msg);
+  auto& from = static_cast<const CDOTAMsg_LocationPing&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CDOTAMsg_LocationPing)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.target_ = from._impl_.target_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.direct_ping_ = from._impl_.direct_ping_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CDOTAMsg_LocationPing::CopyFrom(const CDOTAMsg_LocationPing& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CDOTAMsg_LocationPing)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CDOTAMsg_LocationPing::IsInitialized() const {
+  return true;
+}
+
+void CDOTAMsg_LocationPing::InternalSwap(CDOTAMsg_LocationPing* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CDOTAMsg_LocationPing, _impl_.type_)
+      + sizeof(CDOTAMsg_LocationPing::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(CDOTAMsg_LocationPing, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CDOTAMsg_LocationPing::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dota_5fcommonmessages_2eproto_getter, &descriptor_table_dota_5fcommonmessages_2eproto_once,
+      file_level_metadata_dota_5fcommonmessages_2eproto[0]);
+}
+
+// ===================================================================
+
+class CDOTAMsg_ItemAlert::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CDOTAMsg_ItemAlert>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_itemid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CDOTAMsg_ItemAlert::CDOTAMsg_ItemAlert(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CDOTAMsg_ItemAlert)
+}
+CDOTAMsg_ItemAlert::CDOTAMsg_ItemAlert(const CDOTAMsg_ItemAlert& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CDOTAMsg_ItemAlert* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.itemid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.itemid_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.itemid_));
+  // @@protoc_insertion_point(copy_constructor:CDOTAMsg_ItemAlert)
+}
+
+inline void CDOTAMsg_ItemAlert::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.itemid_){0}
+  };
+}
+
+CDOTAMsg_ItemAlert::~CDOTAMsg_ItemAlert() {
+  // @@protoc_insertion_point(destructor:CDOTAMsg_ItemAlert)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CDOTAMsg_ItemAlert::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CDOTAMsg_ItemAlert::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CDOTAMsg_ItemAlert::Clear() {
+// @@protoc_insertion_point(message_clear_start:CDOTAMsg_ItemAlert)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.itemid_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.itemid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CDOTAMsg_ItemAlert::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 itemid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_itemid(&has_bits);
+          _impl_.itemid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CDOTAMsg_ItemAlert::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CDOTAMsg_ItemAlert)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_x(), target);
+  }
+
+  // optional int32 y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_y(), target);
+  }
+
+  // optional int32 itemid = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_itemid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CDOTAMsg_ItemAlert)
+  return target;
+}
+
+size_t CDOTAMsg_ItemAlert::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CDOTAMsg_ItemAlert)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+    }
+
+    // optional int32 y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
+    }
+
+    // optional int32 itemid = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_itemid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CDOTAMsg_ItemAlert::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CDOTAMsg_ItemAlert::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CDOTAMsg_ItemAlert::GetClassData() const { return &_class_data_; }
+
+
+void CDOTAMsg_ItemAlert::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CDOTAMsg_ItemAlert*>(&to_msg);
+  auto& from = static_cast<const CDOTAMsg_ItemAlert&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CDOTAMsg_ItemAlert)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.itemid_ = from._impl_.itemid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CDOTAMsg_ItemAlert::CopyFrom(const CDOTAMsg_ItemAlert& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CDOTAMsg_ItemAlert)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CDOTAMsg_ItemAlert::IsInitialized() const {
+  return true;
+}
+
+void CDOTAMsg_ItemAlert::InternalSwap(CDOTAMsg_ItemAlert* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CDOTAMsg_ItemAlert, _impl_.itemid_)
+      + sizeof(CDOTAMsg_ItemAlert::_impl_.itemid_)
+      - PROTOBUF_FIELD_OFFSET(CDOTAMsg_ItemAlert, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CDOTAMsg_ItemAlert::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dota_5fcommonmessages_2eproto_getter, &descriptor_table_dota_5fcommonmessages_2eproto_once,
+      file_level_metadata_dota_5fcommonmessages_2eproto[1]);
+}
+
+// ===================================================================
+
+class CDOTAMsg_MapLine::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CDOTAMsg_MapLine>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_initial(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CDOTAMsg_MapLine::CDOTAMsg_MapLine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CDOTAMsg_MapLine)
+}
+CDOTAMsg_MapLine::CDOTAMsg_MapLine(const CDOTAMsg_MapLine& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CDOTAMsg_MapLine* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.initial_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.initial_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.initial_));
+  // @@protoc_insertion_point(copy_constructor:CDOTAMsg_MapLine)
+}
+
+inline void CDOTAMsg_MapLine::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.initial_){false}
+  };
+}
+
+CDOTAMsg_MapLine::~CDOTAMsg_MapLine() {
+  // @@protoc_insertion_point(destructor:CDOTAMsg_MapLine)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CDOTAMsg_MapLine::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CDOTAMsg_MapLine::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CDOTAMsg_MapLine::Clear() {
+// @@protoc_insertion_point(message_clear_start:CDOTAMsg_MapLine)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.initial_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.initial_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CDOTAMsg_MapLine::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool initial = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_initial(&has_bits);
+          _impl_.initial_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CDOTAMsg_MapLine::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CDOTAMsg_MapLine)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_x(), target);
+  }
+
+  // optional int32 y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_y(), target);
+  }
+
+  // optional bool initial = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_initial(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CDOTAMsg_MapLine)
+  return target;
+}
+
+size_t CDOTAMsg_MapLine::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CDOTAMsg_MapLine)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+    }
+
+    // optional int32 y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
+    }
+
+    // optional bool initial = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CDOTAMsg_MapLine::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CDOTAMsg_MapLine::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CDOTAMsg_MapLine::GetClassData() const { return &_class_data_; }
+
+
+void CDOTAMsg_MapLine::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CDOTAMsg_MapLine*>(&to_msg);
+  auto& from = static_cast<const CDOTAMsg_MapLine&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CDOTAMsg_MapLine)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.initial_ = from._impl_.initial_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CDOTAMsg_MapLine::CopyFrom(const CDOTAMsg_MapLine& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CDOTAMsg_MapLine)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CDOTAMsg_MapLine::IsInitialized() const {
+  return true;
+}
+
+void CDOTAMsg_MapLine::InternalSwap(CDOTAMsg_MapLine* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CDOTAMsg_MapLine, _impl_.initial_)
+      + sizeof(CDOTAMsg_MapLine::_impl_.initial_)
+      - PROTOBUF_FIELD_OFFSET(CDOTAMsg_MapLine, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CDOTAMsg_MapLine::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dota_5fcommonmessages_2eproto_getter, &descriptor_table_dota_5fcommonmessages_2eproto_once,
+      file_level_metadata_dota_5fcommonmessages_2eproto[2]);
+}
+
+// ===================================================================
+
+class CDOTAMsg_WorldLine::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CDOTAMsg_WorldLine>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_z(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_initial(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+CDOTAMsg_WorldLine::CDOTAMsg_WorldLine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CDOTAMsg_WorldLine)
+}
+CDOTAMsg_WorldLine::CDOTAMsg_WorldLine(const CDOTAMsg_WorldLine& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CDOTAMsg_WorldLine* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.z_){}
+    , decltype(_impl_.initial_){}
+    , decltype(_impl_.end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:CDOTAMsg_WorldLine)
+}
+
+inline void CDOTAMsg_WorldLine::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.z_){0}
+    , decltype(_impl_.initial_){false}
+    , decltype(_impl_.end_){false}
+  };
+}
+
+CDOTAMsg_WorldLine::~CDOTAMsg_WorldLine() {
+  // @@protoc_insertion_point(destructor:CDOTAMsg_WorldLine)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CDOTAMsg_WorldLine::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CDOTAMsg_WorldLine::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CDOTAMsg_WorldLine::Clear() {
+// @@protoc_insertion_point(message_clear_start:CDOTAMsg_WorldLine)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CDOTAMsg_WorldLine::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 z = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_z(&has_bits);
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool initial = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_initial(&has_bits);
+          _impl_.initial_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool end = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CDOTAMsg_WorldLine::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CDOTAMsg_WorldLine)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_x(), target);
+  }
+
+  // optional int32 y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_y(), target);
+  }
+
+  // optional int32 z = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_z(), target);
+  }
+
+  // optional bool initial = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_initial(), target);
+  }
+
+  // optional bool end = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_end(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CDOTAMsg_WorldLine)
+  return target;
+}
+
+size_t CDOTAMsg_WorldLine::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CDOTAMsg_WorldLine)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional int32 x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+    }
+
+    // optional int32 y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
+    }
+
+    // optional int32 z = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_z());
+    }
+
+    // optional bool initial = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool end = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CDOTAMsg_WorldLine::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CDOTAMsg_WorldLine::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CDOTAMsg_WorldLine::GetClassData() const { return &_class_data_; }
+
+
+void CDOTAMsg_WorldLine::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CDOTAMsg_WorldLine*>(&to_msg);
+  auto& from = static_cast<const CDOTAMsg_WorldLine&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CDOTAMsg_WorldLine)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.z_ = from._impl_.z_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.initial_ = from._impl_.initial_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.end_ = from._impl_.end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CDOTAMsg_WorldLine::CopyFrom(const CDOTAMsg_WorldLine& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CDOTAMsg_WorldLine)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CDOTAMsg_WorldLine::IsInitialized() const {
+  return true;
+}
+
+void CDOTAMsg_WorldLine::InternalSwap(CDOTAMsg_WorldLine* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CDOTAMsg_WorldLine, _impl_.end_)
+      + sizeof(CDOTAMsg_WorldLine::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(CDOTAMsg_WorldLine, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CDOTAMsg_WorldLine::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dota_5fcommonmessages_2eproto_getter, &descriptor_table_dota_5fcommonmessages_2eproto_once,
+      file_level_metadata_dota_5fcommonmessages_2eproto[3]);
+}
+
+// ===================================================================
+
+class CDOTAMsg_SendStatPopup::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CDOTAMsg_SendStatPopup>()._impl_._has_bits_);
+  static void set_has_style(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CDOTAMsg_SendStatPopup::CDOTAMsg_SendStatPopup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CDOTAMsg_SendStatPopup)
+}
+CDOTAMsg_SendStatPopup::CDOTAMsg_SendStatPopup(const CDOTAMsg_SendStatPopup& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CDOTAMsg_SendStatPopup* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stat_strings_){from._impl_.stat_strings_}
+    , decltype(_impl_.stat_images_){from._impl_.stat_images_}
+    , decltype(_impl_.style_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.style_ = from._impl_.style_;
+  // @@protoc_insertion_point(copy_constructor:CDOTAMsg_SendStatPopup)
+}
+
+inline void CDOTAMsg_SendStatPopup::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stat_strings_){arena}
+    , decltype(_impl_.stat_images_){arena}
+    , decltype(_impl_.style_){0}
+  };
+}
+
+CDOTAMsg_SendStatPopup::~CDOTAMsg_SendStatPopup() {
+  // @@protoc_insertion_point(destructor:CDOTAMsg_SendStatPopup)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CDOTAMsg_SendStatPopup::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stat_strings_.~RepeatedPtrField();
+  _impl_.stat_images_.~RepeatedField();
+}
+
+void CDOTAMsg_SendStatPopup::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CDOTAMsg_SendStatPopup::Clear() {
+// @@protoc_insertion_point(message_clear_start:CDOTAMsg_SendStatPopup)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stat_strings_.Clear();
+  _impl_.stat_images_.Clear();
+  _impl_.style_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CDOTAMsg_SendStatPopup::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .EDOTAStatPopupTypes style = 1 [default = k_EDOTA_SPT_Textline];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::EDOTAStatPopupTypes_IsValid(val))) {
+            _internal_set_style(static_cast<::EDOTAStatPopupTypes>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string stat_strings = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_stat_strings();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "CDOTAMsg_SendStatPopup.stat_strings");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 stat_images = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_stat_images(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_stat_images(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CDOTAMsg_SendStatPopup::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CDOTAMsg_SendStatPopup)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .EDOTAStatPopupTypes style = 1 [default = k_EDOTA_SPT_Textline];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_style(), target);
+  }
+
+  // repeated string stat_strings = 2;
+  for (int i = 0, n = this->_internal_stat_strings_size(); i < n; i++) {
+    const auto& s = this->_internal_stat_strings(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CDOTAMsg_SendStatPopup.stat_strings");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // repeated int32 stat_images = 3;
+  for (int i = 0, n = this->_internal_stat_images_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_stat_images(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CDOTAMsg_SendStatPopup)
+  return target;
+}
+
+size_t CDOTAMsg_SendStatPopup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CDOTAMsg_SendStatPopup)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string stat_strings = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.stat_strings_.size());
+  for (int i = 0, n = _impl_.stat_strings_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.stat_strings_.Get(i));
+  }
+
+  // repeated int32 stat_images = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.stat_images_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_stat_images_size());
+    total_size += data_size;
+  }
+
+  // optional .EDOTAStatPopupTypes style = 1 [default = k_EDOTA_SPT_Textline];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_style());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CDOTAMsg_SendStatPopup::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CDOTAMsg_SendStatPopup::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CDOTAMsg_SendStatPopup::GetClassData() const { return &_class_data_; }
+
+
+void CDOTAMsg_SendStatPopup::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CDOTAMsg_SendStatPopup*>(&to_msg);
+  auto& from = static_cast<const CDOTAMsg_SendStatPopup&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CDOTAMsg_SendStatPopup)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stat_strings_.MergeFrom(from._impl_.stat_strings_);
+  _this->_impl_.stat_images_.MergeFrom(from._impl_.stat_images_);
+  if (from._internal_has_style()) {
+    _this->_internal_set_style(from._internal_style());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CDOTAMsg_SendStatPopup::CopyFrom(const CDOTAMsg_SendStatPopup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CDOTAMsg_SendStatPopup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CDOTAMsg_SendStatPopup::IsInitialized() const {
+  return true;
+}
+
+void CDOTAMsg_SendStatPopup::InternalSwap(CDOTAMsg_SendStatPopup* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.stat_strings_.InternalSwap(&other->_impl_.stat_strings_);
+  _impl_.stat_images_.InternalSwap(&other->_impl_.stat_images_);
+  swap(_impl_.style_, other->_impl_.style_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CDOTAMsg_SendStatPopup::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dota_5fcommonmessages_2eproto_getter, &descriptor_table_dota_5fcommonmessages_2eproto_once,
+      file_level_metadata_dota_5fcommonmessages_2eproto[4]);
+}
+
+// ===================================================================
+
+class CDOTAMsg_CoachHUDPing::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CDOTAMsg_CoachHUDPing>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_tgtpath(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CDOTAMsg_CoachHUDPing::CDOTAMsg_CoachHUDPing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CDOTAMsg_CoachHUDPing)
+}
+CDOTAMsg_CoachHUDPing::CDOTAMsg_CoachHUDPing(const CDOTAMsg_CoachHUDPing& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CDOTAMsg_CoachHUDPing* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tgtpath_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.tgtpath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tgtpath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_tgtpath()) {
+    _this->_impl_.tgtpath_.Set(from._internal_tgtpath(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  // @@protoc_insertion_point(copy_constructor:CDOTAMsg_CoachHUDPing)
+}
+
+inline void CDOTAMsg_CoachHUDPing::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tgtpath_){}
+    , decltype(_impl_.x_){0u}
+    , decltype(_impl_.y_){0u}
+  };
+  _impl_.tgtpath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tgtpath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CDOTAMsg_CoachHUDPing::~CDOTAMsg_CoachHUDPing() {
+  // @@protoc_insertion_point(destructor:CDOTAMsg_CoachHUDPing)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CDOTAMsg_CoachHUDPing::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tgtpath_.Destroy();
+}
+
+void CDOTAMsg_CoachHUDPing::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CDOTAMsg_CoachHUDPing::Clear() {
+// @@protoc_insertion_point(message_clear_start:CDOTAMsg_CoachHUDPing)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.tgtpath_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.y_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CDOTAMsg_CoachHUDPing::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string tgtpath = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_tgtpath();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CDOTAMsg_CoachHUDPing.tgtpath");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CDOTAMsg_CoachHUDPing::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CDOTAMsg_CoachHUDPing)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 x = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_x(), target);
+  }
+
+  // optional uint32 y = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_y(), target);
+  }
+
+  // optional string tgtpath = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_tgtpath().data(), static_cast<int>(this->_internal_tgtpath().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CDOTAMsg_CoachHUDPing.tgtpath");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_tgtpath(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CDOTAMsg_CoachHUDPing)
+  return target;
+}
+
+size_t CDOTAMsg_CoachHUDPing::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CDOTAMsg_CoachHUDPing)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string tgtpath = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_tgtpath());
+    }
+
+    // optional uint32 x = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_x());
+    }
+
+    // optional uint32 y = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_y());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CDOTAMsg_CoachHUDPing::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CDOTAMsg_CoachHUDPing::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CDOTAMsg_CoachHUDPing::GetClassData() const { return &_class_data_; }
+
+
+void CDOTAMsg_CoachHUDPing::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CDOTAMsg_CoachHUDPing*>(&to_msg);
+  auto& from = static_cast<const CDOTAMsg_CoachHUDPing&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CDOTAMsg_CoachHUDPing)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_tgtpath(from._internal_tgtpath());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CDOTAMsg_CoachHUDPing::CopyFrom(const CDOTAMsg_CoachHUDPing& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CDOTAMsg_CoachHUDPing)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CDOTAMsg_CoachHUDPing::IsInitialized() const {
+  return true;
+}
+
+void CDOTAMsg_CoachHUDPing::InternalSwap(CDOTAMsg_CoachHUDPing* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.tgtpath_, lhs_arena,
+      &other->_impl_.tgtpath_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CDOTAMsg_CoachHUDPing, _impl_.y_)
+      + sizeof(CDOTAMsg_CoachHUDPing::_impl_.y_)
+      - PROTOBUF_FIELD_OFFSET(CDOTAMsg_CoachHUDPing, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CDOTAMsg_CoachHUDPing::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_dota_5fcommonmessages_2eproto_getter, &descriptor_table_dota_5fcommonmessages_2eproto_once,
+      file_level_metadata_dota_5fcommonmessages_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::CDOTAMsg_LocationPing*
+Arena::CreateMaybeMessage< ::CDOTAMsg_LocationPing >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CDOTAMsg_LocationPing >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CDOTAMsg_ItemAlert*
+Arena::CreateMaybeMessage< ::CDOTAMsg_ItemAlert >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CDOTAMsg_ItemAlert >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CDOTAMsg_MapLine*
+Arena::CreateMaybeMessage< ::CDOTAMsg_MapLine >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CDOTAMsg_MapLine >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CDOTAMsg_WorldLine*
+Arena::CreateMaybeMessage< ::CDOTAMsg_WorldLine >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CDOTAMsg_WorldLine >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CDOTAMsg_SendStatPopup*
+Arena::CreateMaybeMessage< ::CDOTAMsg_SendStatPopup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CDOTAMsg_SendStatPopup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CDOTAMsg_CoachHUDPing*
+Arena::CreateMaybeMessage< ::CDOTAMsg_CoachHUDPing >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CDOTAMsg_CoachHUDPing >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,2276 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: dota_commonmessages.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_dota_5fcommonmessages_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_dota_5fcommonmessages_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_dota_5fcommonmessages_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_dota_5fcommonmessages_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_dota_5fcommonmessages_2eproto;
+class CDOTAMsg_CoachHUDPing;
+struct CDOTAMsg_CoachHUDPingDefaultTypeInternal;
+extern CDOTAMsg_CoachHUDPingDefaultTypeInternal _CDOTAMsg_CoachHUDPing_default_instance_;
+class CDOTAMsg_ItemAlert;
+struct CDOTAMsg_ItemAlertDefaultTypeInternal;
+extern CDOTAMsg_ItemAlertDefaultTypeInternal _CDOTAMsg_ItemAlert_default_instance_;
+class CDOTAMsg_LocationPing;
+struct CDOTAMsg_LocationPingDefaultTypeInternal;
+extern CDOTAMsg_LocationPingDefaultTypeInternal _CDOTAMsg_LocationPing_default_instance_;
+class CDOTAMsg_MapLine;
+struct CDOTAMsg_MapLineDefaultTypeInternal;
+extern CDOTAMsg_MapLineDefaultTypeInternal _CDOTAMsg_MapLine_default_instance_;
+class CDOTAMsg_SendStatPopup;
+struct CDOTAMsg_SendStatPopupDefaultTypeInternal;
+extern CDOTAMsg_SendStatPopupDefaultTypeInternal _CDOTAMsg_SendStatPopup_default_instance_;
+class CDOTAMsg_WorldLine;
+struct CDOTAMsg_WorldLineDefaultTypeInternal;
+extern CDOTAMsg_WorldLineDefaultTypeInternal _CDOTAMsg_WorldLine_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::CDOTAMsg_CoachHUDPing* Arena::CreateMaybeMessage<::CDOTAMsg_CoachHUDPing>(Arena*);
+template<> ::CDOTAMsg_ItemAlert* Arena::CreateMaybeMessage<::CDOTAMsg_ItemAlert>(Arena*);
+template<> ::CDOTAMsg_LocationPing* Arena::CreateMaybeMessage<::CDOTAMsg_LocationPing>(Arena*);
+template<> ::CDOTAMsg_MapLine* Arena::CreateMaybeMessage<::CDOTAMsg_MapLine>(Arena*);
+template<> ::CDOTAMsg_SendStatPopup* Arena::CreateMaybeMessage<::CDOTAMsg_SendStatPopup>(Arena*);
+template<> ::CDOTAMsg_WorldLine* Arena::CreateMaybeMessage<::CDOTAMsg_WorldLine>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+enum EDOTAChatWheelMessage : int {
+  k_EDOTA_CW_Ok = 0,
+  k_EDOTA_CW_Care = 1,
+  k_EDOTA_CW_GetBack = 2,
+  k_EDOTA_CW_NeedWards = 3,
+  k_EDOTA_CW_Stun = 4,
+  k_EDOTA_CW_Help = 5,
+  k_EDOTA_CW_Push = 6,
+  k_EDOTA_CW_GoodJob = 7,
+  k_EDOTA_CW_Missing = 8,
+  k_EDOTA_CW_Missing_Top = 9,
+  k_EDOTA_CW_Missing_Mid = 10,
+  k_EDOTA_CW_Missing_Bottom = 11,
+  k_EDOTA_CW_Go = 12,
+  k_EDOTA_CW_Initiate = 13,
+  k_EDOTA_CW_Follow = 14,
+  k_EDOTA_CW_Group_Up = 15,
+  k_EDOTA_CW_Spread_Out = 16,
+  k_EDOTA_CW_Split_Farm = 17,
+  k_EDOTA_CW_Attack = 18,
+  k_EDOTA_CW_BRB = 19,
+  k_EDOTA_CW_Dive = 20,
+  k_EDOTA_CW_OMW = 21,
+  k_EDOTA_CW_Get_Ready = 22,
+  k_EDOTA_CW_Bait = 23,
+  k_EDOTA_CW_Heal = 24,
+  k_EDOTA_CW_Mana = 25,
+  k_EDOTA_CW_OOM = 26,
+  k_EDOTA_CW_Skill_Cooldown = 27,
+  k_EDOTA_CW_Ulti_Ready = 28,
+  k_EDOTA_CW_Enemy_Returned = 29,
+  k_EDOTA_CW_All_Missing = 30,
+  k_EDOTA_CW_Enemy_Incoming = 31,
+  k_EDOTA_CW_Invis_Enemy = 32,
+  k_EDOTA_CW_Enemy_Had_Rune = 33,
+  k_EDOTA_CW_Split_Push = 34,
+  k_EDOTA_CW_Coming_To_Gank = 35,
+  k_EDOTA_CW_Request_Gank = 36,
+  k_EDOTA_CW_Fight_Under_Tower = 37,
+  k_EDOTA_CW_Deny_Tower = 38,
+  k_EDOTA_CW_Buy_Courier = 39,
+  k_EDOTA_CW_Upgrade_Courier = 40,
+  k_EDOTA_CW_Need_Detection = 41,
+  k_EDOTA_CW_They_Have_Detection = 42,
+  k_EDOTA_CW_Buy_TP = 43,
+  k_EDOTA_CW_Reuse_Courier = 44,
+  k_EDOTA_CW_Deward = 45,
+  k_EDOTA_CW_Building_Mek = 46,
+  k_EDOTA_CW_Building_Pipe = 47,
+  k_EDOTA_CW_Stack_And_Pull = 48,
+  k_EDOTA_CW_Pull = 49,
+  k_EDOTA_CW_Pulling = 50,
+  k_EDOTA_CW_Stack = 51,
+  k_EDOTA_CW_Jungling = 52,
+  k_EDOTA_CW_Roshan = 53,
+  k_EDOTA_CW_Affirmative = 54,
+  k_EDOTA_CW_Wait = 55,
+  k_EDOTA_CW_Pause = 56,
+  k_EDOTA_CW_Current_Time = 57,
+  k_EDOTA_CW_Check_Runes = 58,
+  k_EDOTA_CW_Smoke_Gank = 59,
+  k_EDOTA_CW_GLHF = 60,
+  k_EDOTA_CW_Nice = 61,
+  k_EDOTA_CW_Thanks = 62,
+  k_EDOTA_CW_Sorry = 63,
+  k_EDOTA_CW_No_Give_Up = 64,
+  k_EDOTA_CW_Just_Happened = 65,
+  k_EDOTA_CW_Game_Is_Hard = 66,
+  k_EDOTA_CW_New_Meta = 67,
+  k_EDOTA_CW_My_Bad = 68,
+  k_EDOTA_CW_Regret = 69,
+  k_EDOTA_CW_Relax = 70,
+  k_EDOTA_CW_MissingHero = 71,
+  k_EDOTA_CW_ReturnedHero = 72,
+  k_EDOTA_CW_GG = 73,
+  k_EDOTA_CW_GGWP = 74,
+  k_EDOTA_CW_All_GG = 75,
+  k_EDOTA_CW_All_GGWP = 76,
+  k_EDOTA_CW_What_To_Buy = 77,
+  k_EDOTA_CW_Im_Retreating = 78,
+  k_EDOTA_CW_Space_Created = 79,
+  k_EDOTA_CW_Whoops = 80,
+  k_EDOTA_CW_Tower_then_Back = 81,
+  k_EDOTA_CW_Barracks_then_Back = 82,
+  k_EDOTA_CW_Ward_Bottom_Rune = 83,
+  k_EDOTA_CW_Ward_Top_Rune = 84,
+  k_EDOTA_CW_Zeus_Ult = 85
+};
+bool EDOTAChatWheelMessage_IsValid(int value);
+constexpr EDOTAChatWheelMessage EDOTAChatWheelMessage_MIN = k_EDOTA_CW_Ok;
+constexpr EDOTAChatWheelMessage EDOTAChatWheelMessage_MAX = k_EDOTA_CW_Zeus_Ult;
+constexpr int EDOTAChatWheelMessage_ARRAYSIZE = EDOTAChatWheelMessage_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EDOTAChatWheelMessage_descriptor();
+template<typename T>
+inline const std::string& EDOTAChatWheelMessage_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, EDOTAChatWheelMessage>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function EDOTAChatWheelMessage_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    EDOTAChatWheelMessage_descriptor(), enum_t_value);
+}
+inline bool EDOTAChatWheelMessage_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EDOTAChatWheelMessage* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<EDOTAChatWheelMessage>(
+    EDOTAChatWheelMessage_descriptor(), name, value);
+}
+enum EDOTAStatPopupTypes : int {
+  k_EDOTA_SPT_Textline = 0,
+  k_EDOTA_SPT_Basic = 1,
+  k_EDOTA_SPT_Poll = 2,
+  k_EDOTA_SPT_Grid = 3
+};
+bool EDOTAStatPopupTypes_IsValid(int value);
+constexpr EDOTAStatPopupTypes EDOTAStatPopupTypes_MIN = k_EDOTA_SPT_Textline;
+constexpr EDOTAStatPopupTypes EDOTAStatPopupTypes_MAX = k_EDOTA_SPT_Grid;
+constexpr int EDOTAStatPopupTypes_ARRAYSIZE = EDOTAStatPopupTypes_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EDOTAStatPopupTypes_descriptor();
+template<typename T>
+inline const std::string& EDOTAStatPopupTypes_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, EDOTAStatPopupTypes>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function EDOTAStatPopupTypes_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    EDOTAStatPopupTypes_descriptor(), enum_t_value);
+}
+inline bool EDOTAStatPopupTypes_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EDOTAStatPopupTypes* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<EDOTAStatPopupTypes>(
+    EDOTAStatPopupTypes_descriptor(), name, value);
+}
+enum dotaunitorder_t : int {
+  DOTA_UNIT_ORDER_NONE = 0,
+  DOTA_UNIT_ORDER_MOVE_TO_POSITION = 1,
+  DOTA_UNIT_ORDER_MOVE_TO_TARGET = 2,
+  DOTA_UNIT_ORDER_ATTACK_MOVE = 3,
+  DOTA_UNIT_ORDER_ATTACK_TARGET = 4,
+  DOTA_UNIT_ORDER_CAST_POSITION = 5,
+  DOTA_UNIT_ORDER_CAST_TARGET = 6,
+  DOTA_UNIT_ORDER_CAST_TARGET_TREE = 7,
+  DOTA_UNIT_ORDER_CAST_NO_TARGET = 8,
+  DOTA_UNIT_ORDER_CAST_TOGGLE = 9,
+  DOTA_UNIT_ORDER_HOLD_POSITION = 10,
+  DOTA_UNIT_ORDER_TRAIN_ABILITY = 11,
+  DOTA_UNIT_ORDER_DROP_ITEM = 12,
+  DOTA_UNIT_ORDER_GIVE_ITEM = 13,
+  DOTA_UNIT_ORDER_PICKUP_ITEM = 14,
+  DOTA_UNIT_ORDER_PICKUP_RUNE = 15,
+  DOTA_UNIT_ORDER_PURCHASE_ITEM = 16,
+  DOTA_UNIT_ORDER_SELL_ITEM = 17,
+  DOTA_UNIT_ORDER_DISASSEMBLE_ITEM = 18,
+  DOTA_UNIT_ORDER_MOVE_ITEM = 19,
+  DOTA_UNIT_ORDER_CAST_TOGGLE_AUTO = 20,
+  DOTA_UNIT_ORDER_STOP = 21,
+  DOTA_UNIT_ORDER_TAUNT = 22,
+  DOTA_UNIT_ORDER_BUYBACK = 23,
+  DOTA_UNIT_ORDER_GLYPH = 24,
+  DOTA_UNIT_ORDER_EJECT_ITEM_FROM_STASH = 25,
+  DOTA_UNIT_ORDER_CAST_RUNE = 26,
+  DOTA_UNIT_ORDER_PING_ABILITY = 27,
+  DOTA_UNIT_ORDER_MOVE_TO_DIRECTION = 28
+};
+bool dotaunitorder_t_IsValid(int value);
+constexpr dotaunitorder_t dotaunitorder_t_MIN = DOTA_UNIT_ORDER_NONE;
+constexpr dotaunitorder_t dotaunitorder_t_MAX = DOTA_UNIT_ORDER_MOVE_TO_DIRECTION;
+constexpr int dotaunitorder_t_ARRAYSIZE = dotaunitorder_t_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* dotaunitorder_t_descriptor();
+template<typename T>
+inline const std::string& dotaunitorder_t_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, dotaunitorder_t>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function dotaunitorder_t_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    dotaunitorder_t_descriptor(), enum_t_value);
+}
+inline bool dotaunitorder_t_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, dotaunitorder_t* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<dotaunitorder_t>(
+    dotaunitorder_t_descriptor(), name, value);
+}
+// ===================================================================
+
+class CDOTAMsg_LocationPing final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CDOTAMsg_LocationPing) */ {
+ public:
+  inline CDOTAMsg_LocationPing() : CDOTAMsg_LocationPing(nullptr) {}
+  ~CDOTAMsg_LocationPing() override;
+  explicit PROTOBUF_CONSTEXPR CDOTAMsg_LocationPing(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CDOTAMsg_LocationPing(const CDOTAMsg_LocationPing& from);
+  CDOTAMsg_LocationPing(CDOTAMsg_LocationPing&& from) noexcept
+    : CDOTAMsg_LocationPing() {
+    *this = ::std::move(from);
+  }
+
+  inline CDOTAMsg_LocationPing& operator=(const CDOTAMsg_LocationPing& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CDOTAMsg_LocationPing& operator=(CDOTAMsg_LocationPing&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CDOTAMsg_LocationPing& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CDOTAMsg_LocationPing* internal_default_instance() {
+    return reinterpret_cast<const CDOTAMsg_LocationPing*>(
+               &_CDOTAMsg_LocationPing_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CDOTAMsg_LocationPing& a, CDOTAMsg_LocationPing& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CDOTAMsg_LocationPing* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CDOTAMsg_LocationPing* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CDOTAMsg_LocationPing* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CDOTAMsg_LocationPing>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CDOTAMsg_LocationPing& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CDOTAMsg_LocationPing& from) {
+    CDOTAMsg_LocationPing::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CDOTAMsg_LocationPing* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CDOTAMsg_LocationPing";
+  }
+  protected:
+  explicit CDOTAMsg_LocationPing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kTargetFieldNumber = 3,
+    kDirectPingFieldNumber = 4,
+    kTypeFieldNumber = 5,
+  };
+  // optional int32 x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional int32 y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // optional int32 target = 3;
+  bool has_target() const;
+  private:
+  bool _internal_has_target() const;
+  public:
+  void clear_target();
+  int32_t target() const;
+  void set_target(int32_t value);
+  private:
+  int32_t _internal_target() const;
+  void _internal_set_target(int32_t value);
+  public:
+
+  // optional bool direct_ping = 4;
+  bool has_direct_ping() const;
+  private:
+  bool _internal_has_direct_ping() const;
+  public:
+  void clear_direct_ping();
+  bool direct_ping() const;
+  void set_direct_ping(bool value);
+  private:
+  bool _internal_direct_ping() const;
+  void _internal_set_direct_ping(bool value);
+  public:
+
+  // optional int32 type = 5;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CDOTAMsg_LocationPing)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t x_;
+    int32_t y_;
+    int32_t target_;
+    bool direct_ping_;
+    int32_t type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_dota_5fcommonmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CDOTAMsg_ItemAlert final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CDOTAMsg_ItemAlert) */ {
+ public:
+  inline CDOTAMsg_ItemAlert() : CDOTAMsg_ItemAlert(nullptr) {}
+  ~CDOTAMsg_ItemAlert() override;
+  explicit PROTOBUF_CONSTEXPR CDOTAMsg_ItemAlert(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CDOTAMsg_ItemAlert(const CDOTAMsg_ItemAlert& from);
+  CDOTAMsg_ItemAlert(CDOTAMsg_ItemAlert&& from) noexcept
+    : CDOTAMsg_ItemAlert() {
+    *this = ::std::move(from);
+  }
+
+  inline CDOTAMsg_ItemAlert& operator=(const CDOTAMsg_ItemAlert& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CDOTAMsg_ItemAlert& operator=(CDOTAMsg_ItemAlert&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CDOTAMsg_ItemAlert& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CDOTAMsg_ItemAlert* internal_default_instance() {
+    return reinterpret_cast<const CDOTAMsg_ItemAlert*>(
+               &_CDOTAMsg_ItemAlert_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(CDOTAMsg_ItemAlert& a, CDOTAMsg_ItemAlert& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CDOTAMsg_ItemAlert* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CDOTAMsg_ItemAlert* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CDOTAMsg_ItemAlert* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CDOTAMsg_ItemAlert>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CDOTAMsg_ItemAlert& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CDOTAMsg_ItemAlert& from) {
+    CDOTAMsg_ItemAlert::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CDOTAMsg_ItemAlert* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CDOTAMsg_ItemAlert";
+  }
+  protected:
+  explicit CDOTAMsg_ItemAlert(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kItemidFieldNumber = 3,
+  };
+  // optional int32 x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional int32 y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // optional int32 itemid = 3;
+  bool has_itemid() const;
+  private:
+  bool _internal_has_itemid() const;
+  public:
+  void clear_itemid();
+  int32_t itemid() const;
+  void set_itemid(int32_t value);
+  private:
+  int32_t _internal_itemid() const;
+  void _internal_set_itemid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CDOTAMsg_ItemAlert)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t x_;
+    int32_t y_;
+    int32_t itemid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_dota_5fcommonmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CDOTAMsg_MapLine final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CDOTAMsg_MapLine) */ {
+ public:
+  inline CDOTAMsg_MapLine() : CDOTAMsg_MapLine(nullptr) {}
+  ~CDOTAMsg_MapLine() override;
+  explicit PROTOBUF_CONSTEXPR CDOTAMsg_MapLine(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CDOTAMsg_MapLine(const CDOTAMsg_MapLine& from);
+  CDOTAMsg_MapLine(CDOTAMsg_MapLine&& from) noexcept
+    : CDOTAMsg_MapLine() {
+    *this = ::std::move(from);
+  }
+
+  inline CDOTAMsg_MapLine& operator=(const CDOTAMsg_MapLine& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CDOTAMsg_MapLine& operator=(CDOTAMsg_MapLine&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CDOTAMsg_MapLine& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CDOTAMsg_MapLine* internal_default_instance() {
+    return reinterpret_cast<const CDOTAMsg_MapLine*>(
+               &_CDOTAMsg_MapLine_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CDOTAMsg_MapLine& a, CDOTAMsg_MapLine& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CDOTAMsg_MapLine* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CDOTAMsg_MapLine* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CDOTAMsg_MapLine* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CDOTAMsg_MapLine>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CDOTAMsg_MapLine& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CDOTAMsg_MapLine& from) {
+    CDOTAMsg_MapLine::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CDOTAMsg_MapLine* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CDOTAMsg_MapLine";
+  }
+  protected:
+  explicit CDOTAMsg_MapLine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kInitialFieldNumber = 3,
+  };
+  // optional int32 x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional int32 y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // optional bool initial = 3;
+  bool has_initial() const;
+  private:
+  bool _internal_has_initial() const;
+  public:
+  void clear_initial();
+  bool initial() const;
+  void set_initial(bool value);
+  private:
+  bool _internal_initial() const;
+  void _internal_set_initial(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CDOTAMsg_MapLine)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t x_;
+    int32_t y_;
+    bool initial_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_dota_5fcommonmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CDOTAMsg_WorldLine final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CDOTAMsg_WorldLine) */ {
+ public:
+  inline CDOTAMsg_WorldLine() : CDOTAMsg_WorldLine(nullptr) {}
+  ~CDOTAMsg_WorldLine() override;
+  explicit PROTOBUF_CONSTEXPR CDOTAMsg_WorldLine(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CDOTAMsg_WorldLine(const CDOTAMsg_WorldLine& from);
+  CDOTAMsg_WorldLine(CDOTAMsg_WorldLine&& from) noexcept
+    : CDOTAMsg_WorldLine() {
+    *this = ::std::move(from);
+  }
+
+  inline CDOTAMsg_WorldLine& operator=(const CDOTAMsg_WorldLine& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CDOTAMsg_WorldLine& operator=(CDOTAMsg_WorldLine&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CDOTAMsg_WorldLine& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CDOTAMsg_WorldLine* internal_default_instance() {
+    return reinterpret_cast<const CDOTAMsg_WorldLine*>(
+               &_CDOTAMsg_WorldLine_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CDOTAMsg_WorldLine& a, CDOTAMsg_WorldLine& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CDOTAMsg_WorldLine* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CDOTAMsg_WorldLine* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CDOTAMsg_WorldLine* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CDOTAMsg_WorldLine>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CDOTAMsg_WorldLine& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CDOTAMsg_WorldLine& from) {
+    CDOTAMsg_WorldLine::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CDOTAMsg_WorldLine* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CDOTAMsg_WorldLine";
+  }
+  protected:
+  explicit CDOTAMsg_WorldLine(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kZFieldNumber = 3,
+    kInitialFieldNumber = 4,
+    kEndFieldNumber = 5,
+  };
+  // optional int32 x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
+  // optional int32 y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
+  // optional int32 z = 3;
+  bool has_z() const;
+  private:
+  bool _internal_has_z() const;
+  public:
+  void clear_z();
+  int32_t z() const;
+  void set_z(int32_t value);
+  private:
+  int32_t _internal_z() const;
+  void _internal_set_z(int32_t value);
+  public:
+
+  // optional bool initial = 4;
+  bool has_initial() const;
+  private:
+  bool _internal_has_initial() const;
+  public:
+  void clear_initial();
+  bool initial() const;
+  void set_initial(bool value);
+  private:
+  bool _internal_initial() const;
+  void _internal_set_initial(bool value);
+  public:
+
+  // optional bool end = 5;
+  bool has_end() const;
+  private:
+  bool _internal_has_end() const;
+  public:
+  void clear_end();
+  bool end() const;
+  void set_end(bool value);
+  private:
+  bool _internal_end() const;
+  void _internal_set_end(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CDOTAMsg_WorldLine)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t x_;
+    int32_t y_;
+    int32_t z_;
+    bool initial_;
+    bool end_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_dota_5fcommonmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CDOTAMsg_SendStatPopup final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CDOTAMsg_SendStatPopup) */ {
+ public:
+  inline CDOTAMsg_SendStatPopup() : CDOTAMsg_SendStatPopup(nullptr) {}
+  ~CDOTAMsg_SendStatPopup() override;
+  explicit PROTOBUF_CONSTEXPR CDOTAMsg_SendStatPopup(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CDOTAMsg_SendStatPopup(const CDOTAMsg_SendStatPopup& from);
+  CDOTAMsg_SendStatPopup(CDOTAMsg_SendStatPopup&& from) noexcept
+    : CDOTAMsg_SendStatPopup() {
+    *this = ::std::move(from);
+  }
+
+  inline CDOTAMsg_SendStatPopup& operator=(const CDOTAMsg_SendStatPopup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CDOTAMsg_SendStatPopup& operator=(CDOTAMsg_SendStatPopup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CDOTAMsg_SendStatPopup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CDOTAMsg_SendStatPopup* internal_default_instance() {
+    return reinterpret_cast<const CDOTAMsg_SendStatPopup*>(
+               &_CDOTAMsg_SendStatPopup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CDOTAMsg_SendStatPopup& a, CDOTAMsg_SendStatPopup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CDOTAMsg_SendStatPopup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CDOTAMsg_SendStatPopup* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CDOTAMsg_SendStatPopup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CDOTAMsg_SendStatPopup>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CDOTAMsg_SendStatPopup& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CDOTAMsg_SendStatPopup& from) {
+    CDOTAMsg_SendStatPopup::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CDOTAMsg_SendStatPopup* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CDOTAMsg_SendStatPopup";
+  }
+  protected:
+  explicit CDOTAMsg_SendStatPopup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatStringsFieldNumber = 2,
+    kStatImagesFieldNumber = 3,
+    kStyleFieldNumber = 1,
+  };
+  // repeated string stat_strings = 2;
+  int stat_strings_size() const;
+  private:
+  int _internal_stat_strings_size() const;
+  public:
+  void clear_stat_strings();
+  const std::string& stat_strings(int index) const;
+  std::string* mutable_stat_strings(int index);
+  void set_stat_strings(int index, const std::string& value);
+  void set_stat_strings(int index, std::string&& value);
+  void set_stat_strings(int index, const char* value);
+  void set_stat_strings(int index, const char* value, size_t size);
+  std::string* add_stat_strings();
+  void add_stat_strings(const std::string& value);
+  void add_stat_strings(std::string&& value);
+  void add_stat_strings(const char* value);
+  void add_stat_strings(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& stat_strings() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_stat_strings();
+  private:
+  const std::string& _internal_stat_strings(int index) const;
+  std::string* _internal_add_stat_strings();
+  public:
+
+  // repeated int32 stat_images = 3;
+  int stat_images_size() const;
+  private:
+  int _internal_stat_images_size() const;
+  public:
+  void clear_stat_images();
+  private:
+  int32_t _internal_stat_images(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_stat_images() const;
+  void _internal_add_stat_images(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_stat_images();
+  public:
+  int32_t stat_images(int index) const;
+  void set_stat_images(int index, int32_t value);
+  void add_stat_images(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      stat_images() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_stat_images();
+
+  // optional .EDOTAStatPopupTypes style = 1 [default = k_EDOTA_SPT_Textline];
+  bool has_style() const;
+  private:
+  bool _internal_has_style() const;
+  public:
+  void clear_style();
+  ::EDOTAStatPopupTypes style() const;
+  void set_style(::EDOTAStatPopupTypes value);
+  private:
+  ::EDOTAStatPopupTypes _internal_style() const;
+  void _internal_set_style(::EDOTAStatPopupTypes value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CDOTAMsg_SendStatPopup)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> stat_strings_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > stat_images_;
+    int style_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_dota_5fcommonmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CDOTAMsg_CoachHUDPing final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CDOTAMsg_CoachHUDPing) */ {
+ public:
+  inline CDOTAMsg_CoachHUDPing() : CDOTAMsg_CoachHUDPing(nullptr) {}
+  ~CDOTAMsg_CoachHUDPing() override;
+  explicit PROTOBUF_CONSTEXPR CDOTAMsg_CoachHUDPing(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CDOTAMsg_CoachHUDPing(const CDOTAMsg_CoachHUDPing& from);
+  CDOTAMsg_CoachHUDPing(CDOTAMsg_CoachHUDPing&& from) noexcept
+    : CDOTAMsg_CoachHUDPing() {
+    *this = ::std::move(from);
+  }
+
+  inline CDOTAMsg_CoachHUDPing& operator=(const CDOTAMsg_CoachHUDPing& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CDOTAMsg_CoachHUDPing& operator=(CDOTAMsg_CoachHUDPing&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CDOTAMsg_CoachHUDPing& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CDOTAMsg_CoachHUDPing* internal_default_instance() {
+    return reinterpret_cast<const CDOTAMsg_CoachHUDPing*>(
+               &_CDOTAMsg_CoachHUDPing_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(CDOTAMsg_CoachHUDPing& a, CDOTAMsg_CoachHUDPing& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CDOTAMsg_CoachHUDPing* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CDOTAMsg_CoachHUDPing* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CDOTAMsg_CoachHUDPing* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CDOTAMsg_CoachHUDPing>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CDOTAMsg_CoachHUDPing& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CDOTAMsg_CoachHUDPing& from) {
+    CDOTAMsg_CoachHUDPing::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CDOTAMsg_CoachHUDPing* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CDOTAMsg_CoachHUDPing";
+  }
+  protected:
+  explicit CDOTAMsg_CoachHUDPing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTgtpathFieldNumber = 3,
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+  };
+  // optional string tgtpath = 3;
+  bool has_tgtpath() const;
+  private:
+  bool _internal_has_tgtpath() const;
+  public:
+  void clear_tgtpath();
+  const std::string& tgtpath() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tgtpath(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_tgtpath();
+  PROTOBUF_NODISCARD std::string* release_tgtpath();
+  void set_allocated_tgtpath(std::string* tgtpath);
+  private:
+  const std::string& _internal_tgtpath() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tgtpath(const std::string& value);
+  std::string* _internal_mutable_tgtpath();
+  public:
+
+  // optional uint32 x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  uint32_t x() const;
+  void set_x(uint32_t value);
+  private:
+  uint32_t _internal_x() const;
+  void _internal_set_x(uint32_t value);
+  public:
+
+  // optional uint32 y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  uint32_t y() const;
+  void set_y(uint32_t value);
+  private:
+  uint32_t _internal_y() const;
+  void _internal_set_y(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CDOTAMsg_CoachHUDPing)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tgtpath_;
+    uint32_t x_;
+    uint32_t y_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_dota_5fcommonmessages_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CDOTAMsg_LocationPing
+
+// optional int32 x = 1;
+inline bool CDOTAMsg_LocationPing::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_LocationPing::has_x() const {
+  return _internal_has_x();
+}
+inline void CDOTAMsg_LocationPing::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CDOTAMsg_LocationPing::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t CDOTAMsg_LocationPing::x() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_LocationPing.x)
+  return _internal_x();
+}
+inline void CDOTAMsg_LocationPing::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void CDOTAMsg_LocationPing::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_LocationPing.x)
+}
+
+// optional int32 y = 2;
+inline bool CDOTAMsg_LocationPing::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_LocationPing::has_y() const {
+  return _internal_has_y();
+}
+inline void CDOTAMsg_LocationPing::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CDOTAMsg_LocationPing::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t CDOTAMsg_LocationPing::y() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_LocationPing.y)
+  return _internal_y();
+}
+inline void CDOTAMsg_LocationPing::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void CDOTAMsg_LocationPing::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_LocationPing.y)
+}
+
+// optional int32 target = 3;
+inline bool CDOTAMsg_LocationPing::_internal_has_target() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_LocationPing::has_target() const {
+  return _internal_has_target();
+}
+inline void CDOTAMsg_LocationPing::clear_target() {
+  _impl_.target_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CDOTAMsg_LocationPing::_internal_target() const {
+  return _impl_.target_;
+}
+inline int32_t CDOTAMsg_LocationPing::target() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_LocationPing.target)
+  return _internal_target();
+}
+inline void CDOTAMsg_LocationPing::_internal_set_target(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.target_ = value;
+}
+inline void CDOTAMsg_LocationPing::set_target(int32_t value) {
+  _internal_set_target(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_LocationPing.target)
+}
+
+// optional bool direct_ping = 4;
+inline bool CDOTAMsg_LocationPing::_internal_has_direct_ping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_LocationPing::has_direct_ping() const {
+  return _internal_has_direct_ping();
+}
+inline void CDOTAMsg_LocationPing::clear_direct_ping() {
+  _impl_.direct_ping_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool CDOTAMsg_LocationPing::_internal_direct_ping() const {
+  return _impl_.direct_ping_;
+}
+inline bool CDOTAMsg_LocationPing::direct_ping() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_LocationPing.direct_ping)
+  return _internal_direct_ping();
+}
+inline void CDOTAMsg_LocationPing::_internal_set_direct_ping(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.direct_ping_ = value;
+}
+inline void CDOTAMsg_LocationPing::set_direct_ping(bool value) {
+  _internal_set_direct_ping(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_LocationPing.direct_ping)
+}
+
+// optional int32 type = 5;
+inline bool CDOTAMsg_LocationPing::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_LocationPing::has_type() const {
+  return _internal_has_type();
+}
+inline void CDOTAMsg_LocationPing::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t CDOTAMsg_LocationPing::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t CDOTAMsg_LocationPing::type() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_LocationPing.type)
+  return _internal_type();
+}
+inline void CDOTAMsg_LocationPing::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.type_ = value;
+}
+inline void CDOTAMsg_LocationPing::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_LocationPing.type)
+}
+
+// -------------------------------------------------------------------
+
+// CDOTAMsg_ItemAlert
+
+// optional int32 x = 1;
+inline bool CDOTAMsg_ItemAlert::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_ItemAlert::has_x() const {
+  return _internal_has_x();
+}
+inline void CDOTAMsg_ItemAlert::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CDOTAMsg_ItemAlert::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t CDOTAMsg_ItemAlert::x() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_ItemAlert.x)
+  return _internal_x();
+}
+inline void CDOTAMsg_ItemAlert::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void CDOTAMsg_ItemAlert::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_ItemAlert.x)
+}
+
+// optional int32 y = 2;
+inline bool CDOTAMsg_ItemAlert::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_ItemAlert::has_y() const {
+  return _internal_has_y();
+}
+inline void CDOTAMsg_ItemAlert::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CDOTAMsg_ItemAlert::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t CDOTAMsg_ItemAlert::y() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_ItemAlert.y)
+  return _internal_y();
+}
+inline void CDOTAMsg_ItemAlert::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void CDOTAMsg_ItemAlert::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_ItemAlert.y)
+}
+
+// optional int32 itemid = 3;
+inline bool CDOTAMsg_ItemAlert::_internal_has_itemid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_ItemAlert::has_itemid() const {
+  return _internal_has_itemid();
+}
+inline void CDOTAMsg_ItemAlert::clear_itemid() {
+  _impl_.itemid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CDOTAMsg_ItemAlert::_internal_itemid() const {
+  return _impl_.itemid_;
+}
+inline int32_t CDOTAMsg_ItemAlert::itemid() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_ItemAlert.itemid)
+  return _internal_itemid();
+}
+inline void CDOTAMsg_ItemAlert::_internal_set_itemid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.itemid_ = value;
+}
+inline void CDOTAMsg_ItemAlert::set_itemid(int32_t value) {
+  _internal_set_itemid(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_ItemAlert.itemid)
+}
+
+// -------------------------------------------------------------------
+
+// CDOTAMsg_MapLine
+
+// optional int32 x = 1;
+inline bool CDOTAMsg_MapLine::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_MapLine::has_x() const {
+  return _internal_has_x();
+}
+inline void CDOTAMsg_MapLine::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CDOTAMsg_MapLine::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t CDOTAMsg_MapLine::x() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_MapLine.x)
+  return _internal_x();
+}
+inline void CDOTAMsg_MapLine::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void CDOTAMsg_MapLine::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_MapLine.x)
+}
+
+// optional int32 y = 2;
+inline bool CDOTAMsg_MapLine::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_MapLine::has_y() const {
+  return _internal_has_y();
+}
+inline void CDOTAMsg_MapLine::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CDOTAMsg_MapLine::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t CDOTAMsg_MapLine::y() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_MapLine.y)
+  return _internal_y();
+}
+inline void CDOTAMsg_MapLine::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void CDOTAMsg_MapLine::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_MapLine.y)
+}
+
+// optional bool initial = 3;
+inline bool CDOTAMsg_MapLine::_internal_has_initial() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_MapLine::has_initial() const {
+  return _internal_has_initial();
+}
+inline void CDOTAMsg_MapLine::clear_initial() {
+  _impl_.initial_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CDOTAMsg_MapLine::_internal_initial() const {
+  return _impl_.initial_;
+}
+inline bool CDOTAMsg_MapLine::initial() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_MapLine.initial)
+  return _internal_initial();
+}
+inline void CDOTAMsg_MapLine::_internal_set_initial(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.initial_ = value;
+}
+inline void CDOTAMsg_MapLine::set_initial(bool value) {
+  _internal_set_initial(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_MapLine.initial)
+}
+
+// -------------------------------------------------------------------
+
+// CDOTAMsg_WorldLine
+
+// optional int32 x = 1;
+inline bool CDOTAMsg_WorldLine::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_WorldLine::has_x() const {
+  return _internal_has_x();
+}
+inline void CDOTAMsg_WorldLine::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CDOTAMsg_WorldLine::_internal_x() const {
+  return _impl_.x_;
+}
+inline int32_t CDOTAMsg_WorldLine::x() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_WorldLine.x)
+  return _internal_x();
+}
+inline void CDOTAMsg_WorldLine::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void CDOTAMsg_WorldLine::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_WorldLine.x)
+}
+
+// optional int32 y = 2;
+inline bool CDOTAMsg_WorldLine::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_WorldLine::has_y() const {
+  return _internal_has_y();
+}
+inline void CDOTAMsg_WorldLine::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CDOTAMsg_WorldLine::_internal_y() const {
+  return _impl_.y_;
+}
+inline int32_t CDOTAMsg_WorldLine::y() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_WorldLine.y)
+  return _internal_y();
+}
+inline void CDOTAMsg_WorldLine::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void CDOTAMsg_WorldLine::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_WorldLine.y)
+}
+
+// optional int32 z = 3;
+inline bool CDOTAMsg_WorldLine::_internal_has_z() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_WorldLine::has_z() const {
+  return _internal_has_z();
+}
+inline void CDOTAMsg_WorldLine::clear_z() {
+  _impl_.z_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CDOTAMsg_WorldLine::_internal_z() const {
+  return _impl_.z_;
+}
+inline int32_t CDOTAMsg_WorldLine::z() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_WorldLine.z)
+  return _internal_z();
+}
+inline void CDOTAMsg_WorldLine::_internal_set_z(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.z_ = value;
+}
+inline void CDOTAMsg_WorldLine::set_z(int32_t value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_WorldLine.z)
+}
+
+// optional bool initial = 4;
+inline bool CDOTAMsg_WorldLine::_internal_has_initial() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_WorldLine::has_initial() const {
+  return _internal_has_initial();
+}
+inline void CDOTAMsg_WorldLine::clear_initial() {
+  _impl_.initial_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool CDOTAMsg_WorldLine::_internal_initial() const {
+  return _impl_.initial_;
+}
+inline bool CDOTAMsg_WorldLine::initial() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_WorldLine.initial)
+  return _internal_initial();
+}
+inline void CDOTAMsg_WorldLine::_internal_set_initial(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.initial_ = value;
+}
+inline void CDOTAMsg_WorldLine::set_initial(bool value) {
+  _internal_set_initial(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_WorldLine.initial)
+}
+
+// optional bool end = 5;
+inline bool CDOTAMsg_WorldLine::_internal_has_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_WorldLine::has_end() const {
+  return _internal_has_end();
+}
+inline void CDOTAMsg_WorldLine::clear_end() {
+  _impl_.end_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool CDOTAMsg_WorldLine::_internal_end() const {
+  return _impl_.end_;
+}
+inline bool CDOTAMsg_WorldLine::end() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_WorldLine.end)
+  return _internal_end();
+}
+inline void CDOTAMsg_WorldLine::_internal_set_end(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.end_ = value;
+}
+inline void CDOTAMsg_WorldLine::set_end(bool value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_WorldLine.end)
+}
+
+// -------------------------------------------------------------------
+
+// CDOTAMsg_SendStatPopup
+
+// optional .EDOTAStatPopupTypes style = 1 [default = k_EDOTA_SPT_Textline];
+inline bool CDOTAMsg_SendStatPopup::_internal_has_style() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_SendStatPopup::has_style() const {
+  return _internal_has_style();
+}
+inline void CDOTAMsg_SendStatPopup::clear_style() {
+  _impl_.style_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::EDOTAStatPopupTypes CDOTAMsg_SendStatPopup::_internal_style() const {
+  return static_cast< ::EDOTAStatPopupTypes >(_impl_.style_);
+}
+inline ::EDOTAStatPopupTypes CDOTAMsg_SendStatPopup::style() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_SendStatPopup.style)
+  return _internal_style();
+}
+inline void CDOTAMsg_SendStatPopup::_internal_set_style(::EDOTAStatPopupTypes value) {
+  assert(::EDOTAStatPopupTypes_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.style_ = value;
+}
+inline void CDOTAMsg_SendStatPopup::set_style(::EDOTAStatPopupTypes value) {
+  _internal_set_style(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_SendStatPopup.style)
+}
+
+// repeated string stat_strings = 2;
+inline int CDOTAMsg_SendStatPopup::_internal_stat_strings_size() const {
+  return _impl_.stat_strings_.size();
+}
+inline int CDOTAMsg_SendStatPopup::stat_strings_size() const {
+  return _internal_stat_strings_size();
+}
+inline void CDOTAMsg_SendStatPopup::clear_stat_strings() {
+  _impl_.stat_strings_.Clear();
+}
+inline std::string* CDOTAMsg_SendStatPopup::add_stat_strings() {
+  std::string* _s = _internal_add_stat_strings();
+  // @@protoc_insertion_point(field_add_mutable:CDOTAMsg_SendStatPopup.stat_strings)
+  return _s;
+}
+inline const std::string& CDOTAMsg_SendStatPopup::_internal_stat_strings(int index) const {
+  return _impl_.stat_strings_.Get(index);
+}
+inline const std::string& CDOTAMsg_SendStatPopup::stat_strings(int index) const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_SendStatPopup.stat_strings)
+  return _internal_stat_strings(index);
+}
+inline std::string* CDOTAMsg_SendStatPopup::mutable_stat_strings(int index) {
+  // @@protoc_insertion_point(field_mutable:CDOTAMsg_SendStatPopup.stat_strings)
+  return _impl_.stat_strings_.Mutable(index);
+}
+inline void CDOTAMsg_SendStatPopup::set_stat_strings(int index, const std::string& value) {
+  _impl_.stat_strings_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_SendStatPopup.stat_strings)
+}
+inline void CDOTAMsg_SendStatPopup::set_stat_strings(int index, std::string&& value) {
+  _impl_.stat_strings_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:CDOTAMsg_SendStatPopup.stat_strings)
+}
+inline void CDOTAMsg_SendStatPopup::set_stat_strings(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.stat_strings_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:CDOTAMsg_SendStatPopup.stat_strings)
+}
+inline void CDOTAMsg_SendStatPopup::set_stat_strings(int index, const char* value, size_t size) {
+  _impl_.stat_strings_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:CDOTAMsg_SendStatPopup.stat_strings)
+}
+inline std::string* CDOTAMsg_SendStatPopup::_internal_add_stat_strings() {
+  return _impl_.stat_strings_.Add();
+}
+inline void CDOTAMsg_SendStatPopup::add_stat_strings(const std::string& value) {
+  _impl_.stat_strings_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:CDOTAMsg_SendStatPopup.stat_strings)
+}
+inline void CDOTAMsg_SendStatPopup::add_stat_strings(std::string&& value) {
+  _impl_.stat_strings_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:CDOTAMsg_SendStatPopup.stat_strings)
+}
+inline void CDOTAMsg_SendStatPopup::add_stat_strings(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.stat_strings_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:CDOTAMsg_SendStatPopup.stat_strings)
+}
+inline void CDOTAMsg_SendStatPopup::add_stat_strings(const char* value, size_t size) {
+  _impl_.stat_strings_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:CDOTAMsg_SendStatPopup.stat_strings)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CDOTAMsg_SendStatPopup::stat_strings() const {
+  // @@protoc_insertion_point(field_list:CDOTAMsg_SendStatPopup.stat_strings)
+  return _impl_.stat_strings_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CDOTAMsg_SendStatPopup::mutable_stat_strings() {
+  // @@protoc_insertion_point(field_mutable_list:CDOTAMsg_SendStatPopup.stat_strings)
+  return &_impl_.stat_strings_;
+}
+
+// repeated int32 stat_images = 3;
+inline int CDOTAMsg_SendStatPopup::_internal_stat_images_size() const {
+  return _impl_.stat_images_.size();
+}
+inline int CDOTAMsg_SendStatPopup::stat_images_size() const {
+  return _internal_stat_images_size();
+}
+inline void CDOTAMsg_SendStatPopup::clear_stat_images() {
+  _impl_.stat_images_.Clear();
+}
+inline int32_t CDOTAMsg_SendStatPopup::_internal_stat_images(int index) const {
+  return _impl_.stat_images_.Get(index);
+}
+inline int32_t CDOTAMsg_SendStatPopup::stat_images(int index) const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_SendStatPopup.stat_images)
+  return _internal_stat_images(index);
+}
+inline void CDOTAMsg_SendStatPopup::set_stat_images(int index, int32_t value) {
+  _impl_.stat_images_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_SendStatPopup.stat_images)
+}
+inline void CDOTAMsg_SendStatPopup::_internal_add_stat_images(int32_t value) {
+  _impl_.stat_images_.Add(value);
+}
+inline void CDOTAMsg_SendStatPopup::add_stat_images(int32_t value) {
+  _internal_add_stat_images(value);
+  // @@protoc_insertion_point(field_add:CDOTAMsg_SendStatPopup.stat_images)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CDOTAMsg_SendStatPopup::_internal_stat_images() const {
+  return _impl_.stat_images_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CDOTAMsg_SendStatPopup::stat_images() const {
+  // @@protoc_insertion_point(field_list:CDOTAMsg_SendStatPopup.stat_images)
+  return _internal_stat_images();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CDOTAMsg_SendStatPopup::_internal_mutable_stat_images() {
+  return &_impl_.stat_images_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CDOTAMsg_SendStatPopup::mutable_stat_images() {
+  // @@protoc_insertion_point(field_mutable_list:CDOTAMsg_SendStatPopup.stat_images)
+  return _internal_mutable_stat_images();
+}
+
+// -------------------------------------------------------------------
+
+// CDOTAMsg_CoachHUDPing
+
+// optional uint32 x = 1;
+inline bool CDOTAMsg_CoachHUDPing::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_CoachHUDPing::has_x() const {
+  return _internal_has_x();
+}
+inline void CDOTAMsg_CoachHUDPing::clear_x() {
+  _impl_.x_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CDOTAMsg_CoachHUDPing::_internal_x() const {
+  return _impl_.x_;
+}
+inline uint32_t CDOTAMsg_CoachHUDPing::x() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_CoachHUDPing.x)
+  return _internal_x();
+}
+inline void CDOTAMsg_CoachHUDPing::_internal_set_x(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.x_ = value;
+}
+inline void CDOTAMsg_CoachHUDPing::set_x(uint32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_CoachHUDPing.x)
+}
+
+// optional uint32 y = 2;
+inline bool CDOTAMsg_CoachHUDPing::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_CoachHUDPing::has_y() const {
+  return _internal_has_y();
+}
+inline void CDOTAMsg_CoachHUDPing::clear_y() {
+  _impl_.y_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CDOTAMsg_CoachHUDPing::_internal_y() const {
+  return _impl_.y_;
+}
+inline uint32_t CDOTAMsg_CoachHUDPing::y() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_CoachHUDPing.y)
+  return _internal_y();
+}
+inline void CDOTAMsg_CoachHUDPing::_internal_set_y(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.y_ = value;
+}
+inline void CDOTAMsg_CoachHUDPing::set_y(uint32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:CDOTAMsg_CoachHUDPing.y)
+}
+
+// optional string tgtpath = 3;
+inline bool CDOTAMsg_CoachHUDPing::_internal_has_tgtpath() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CDOTAMsg_CoachHUDPing::has_tgtpath() const {
+  return _internal_has_tgtpath();
+}
+inline void CDOTAMsg_CoachHUDPing::clear_tgtpath() {
+  _impl_.tgtpath_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CDOTAMsg_CoachHUDPing::tgtpath() const {
+  // @@protoc_insertion_point(field_get:CDOTAMsg_CoachHUDPing.tgtpath)
+  return _internal_tgtpath();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CDOTAMsg_CoachHUDPing::set_tgtpath(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.tgtpath_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CDOTAMsg_CoachHUDPing.tgtpath)
+}
+inline std::string* CDOTAMsg_CoachHUDPing::mutable_tgtpath() {
+  std::string* _s = _internal_mutable_tgtpath();
+  // @@protoc_insertion_point(field_mutable:CDOTAMsg_CoachHUDPing.tgtpath)
+  return _s;
+}
+inline const std::string& CDOTAMsg_CoachHUDPing::_internal_tgtpath() const {
+  return _impl_.tgtpath_.Get();
+}
+inline void CDOTAMsg_CoachHUDPing::_internal_set_tgtpath(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.tgtpath_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CDOTAMsg_CoachHUDPing::_internal_mutable_tgtpath() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.tgtpath_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CDOTAMsg_CoachHUDPing::release_tgtpath() {
+  // @@protoc_insertion_point(field_release:CDOTAMsg_CoachHUDPing.tgtpath)
+  if (!_internal_has_tgtpath()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.tgtpath_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tgtpath_.IsDefault()) {
+    _impl_.tgtpath_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CDOTAMsg_CoachHUDPing::set_allocated_tgtpath(std::string* tgtpath) {
+  if (tgtpath != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.tgtpath_.SetAllocated(tgtpath, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tgtpath_.IsDefault()) {
+    _impl_.tgtpath_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CDOTAMsg_CoachHUDPing.tgtpath)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::EDOTAChatWheelMessage> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::EDOTAChatWheelMessage>() {
+  return ::EDOTAChatWheelMessage_descriptor();
+}
+template <> struct is_proto_enum< ::EDOTAStatPopupTypes> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::EDOTAStatPopupTypes>() {
+  return ::EDOTAStatPopupTypes_descriptor();
+}
+template <> struct is_proto_enum< ::dotaunitorder_t> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::dotaunitorder_t>() {
+  return ::dotaunitorder_t_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_dota_5fcommonmessages_2eproto
@@ -0,0 +1,1902 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: dota_modifiers.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_dota_5fmodifiers_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_dota_5fmodifiers_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "networkbasetypes.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_dota_5fmodifiers_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_dota_5fmodifiers_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_dota_5fmodifiers_2eproto;
+class CDOTAModifierBuffTableEntry;
+struct CDOTAModifierBuffTableEntryDefaultTypeInternal;
+extern CDOTAModifierBuffTableEntryDefaultTypeInternal _CDOTAModifierBuffTableEntry_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::CDOTAModifierBuffTableEntry* Arena::CreateMaybeMessage<::CDOTAModifierBuffTableEntry>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+enum DOTA_MODIFIER_ENTRY_TYPE : int {
+  DOTA_MODIFIER_ENTRY_TYPE_ACTIVE = 1,
+  DOTA_MODIFIER_ENTRY_TYPE_REMOVED = 2
+};
+bool DOTA_MODIFIER_ENTRY_TYPE_IsValid(int value);
+constexpr DOTA_MODIFIER_ENTRY_TYPE DOTA_MODIFIER_ENTRY_TYPE_MIN = DOTA_MODIFIER_ENTRY_TYPE_ACTIVE;
+constexpr DOTA_MODIFIER_ENTRY_TYPE DOTA_MODIFIER_ENTRY_TYPE_MAX = DOTA_MODIFIER_ENTRY_TYPE_REMOVED;
+constexpr int DOTA_MODIFIER_ENTRY_TYPE_ARRAYSIZE = DOTA_MODIFIER_ENTRY_TYPE_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DOTA_MODIFIER_ENTRY_TYPE_descriptor();
+template<typename T>
+inline const std::string& DOTA_MODIFIER_ENTRY_TYPE_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DOTA_MODIFIER_ENTRY_TYPE>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DOTA_MODIFIER_ENTRY_TYPE_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DOTA_MODIFIER_ENTRY_TYPE_descriptor(), enum_t_value);
+}
+inline bool DOTA_MODIFIER_ENTRY_TYPE_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DOTA_MODIFIER_ENTRY_TYPE* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DOTA_MODIFIER_ENTRY_TYPE>(
+    DOTA_MODIFIER_ENTRY_TYPE_descriptor(), name, value);
+}
+// ===================================================================
+
+class CDOTAModifierBuffTableEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CDOTAModifierBuffTableEntry) */ {
+ public:
+  inline CDOTAModifierBuffTableEntry() : CDOTAModifierBuffTableEntry(nullptr) {}
+  ~CDOTAModifierBuffTableEntry() override;
+  explicit PROTOBUF_CONSTEXPR CDOTAModifierBuffTableEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CDOTAModifierBuffTableEntry(const CDOTAModifierBuffTableEntry& from);
+  CDOTAModifierBuffTableEntry(CDOTAModifierBuffTableEntry&& from) noexcept
+    : CDOTAModifierBuffTableEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline CDOTAModifierBuffTableEntry& operator=(const CDOTAModifierBuffTableEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CDOTAModifierBuffTableEntry& operator=(CDOTAModifierBuffTableEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CDOTAModifierBuffTableEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CDOTAModifierBuffTableEntry* internal_default_instance() {
+    return reinterpret_cast<const CDOTAModifierBuffTableEntry*>(
+               &_CDOTAModifierBuffTableEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CDOTAModifierBuffTableEntry& a, CDOTAModifierBuffTableEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CDOTAModifierBuffTableEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CDOTAModifierBuffTableEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CDOTAModifierBuffTableEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CDOTAModifierBuffTableEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CDOTAModifierBuffTableEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CDOTAModifierBuffTableEntry& from) {
+    CDOTAModifierBuffTableEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CDOTAModifierBuffTableEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CDOTAModifierBuffTableEntry";
+  }
+  protected:
+  explicit CDOTAModifierBuffTableEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPortalLoopAppearFieldNumber = 18,
+    kPortalLoopDisappearFieldNumber = 19,
+    kHeroLoopAppearFieldNumber = 20,
+    kHeroLoopDisappearFieldNumber = 21,
+    kIllusionLabelFieldNumber = 29,
+    kVStartFieldNumber = 16,
+    kVEndFieldNumber = 17,
+    kParentFieldNumber = 2,
+    kIndexFieldNumber = 3,
+    kSerialNumFieldNumber = 4,
+    kModifierClassFieldNumber = 5,
+    kAbilityLevelFieldNumber = 6,
+    kStackCountFieldNumber = 7,
+    kCreationTimeFieldNumber = 8,
+    kCasterFieldNumber = 10,
+    kAbilityFieldNumber = 11,
+    kArmorFieldNumber = 12,
+    kFadeTimeFieldNumber = 13,
+    kChannelTimeFieldNumber = 15,
+    kMovementSpeedFieldNumber = 22,
+    kSubtleFieldNumber = 14,
+    kAuraFieldNumber = 23,
+    kActiveFieldNumber = 30,
+    kActivityFieldNumber = 24,
+    kDamageFieldNumber = 25,
+    kRangeFieldNumber = 26,
+    kDdModifierIndexFieldNumber = 27,
+    kDdAbilityIndexFieldNumber = 28,
+    kEntryTypeFieldNumber = 1,
+    kDurationFieldNumber = 9,
+  };
+  // optional string portal_loop_appear = 18;
+  bool has_portal_loop_appear() const;
+  private:
+  bool _internal_has_portal_loop_appear() const;
+  public:
+  void clear_portal_loop_appear();
+  const std::string& portal_loop_appear() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_portal_loop_appear(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_portal_loop_appear();
+  PROTOBUF_NODISCARD std::string* release_portal_loop_appear();
+  void set_allocated_portal_loop_appear(std::string* portal_loop_appear);
+  private:
+  const std::string& _internal_portal_loop_appear() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_portal_loop_appear(const std::string& value);
+  std::string* _internal_mutable_portal_loop_appear();
+  public:
+
+  // optional string portal_loop_disappear = 19;
+  bool has_portal_loop_disappear() const;
+  private:
+  bool _internal_has_portal_loop_disappear() const;
+  public:
+  void clear_portal_loop_disappear();
+  const std::string& portal_loop_disappear() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_portal_loop_disappear(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_portal_loop_disappear();
+  PROTOBUF_NODISCARD std::string* release_portal_loop_disappear();
+  void set_allocated_portal_loop_disappear(std::string* portal_loop_disappear);
+  private:
+  const std::string& _internal_portal_loop_disappear() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_portal_loop_disappear(const std::string& value);
+  std::string* _internal_mutable_portal_loop_disappear();
+  public:
+
+  // optional string hero_loop_appear = 20;
+  bool has_hero_loop_appear() const;
+  private:
+  bool _internal_has_hero_loop_appear() const;
+  public:
+  void clear_hero_loop_appear();
+  const std::string& hero_loop_appear() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hero_loop_appear(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hero_loop_appear();
+  PROTOBUF_NODISCARD std::string* release_hero_loop_appear();
+  void set_allocated_hero_loop_appear(std::string* hero_loop_appear);
+  private:
+  const std::string& _internal_hero_loop_appear() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hero_loop_appear(const std::string& value);
+  std::string* _internal_mutable_hero_loop_appear();
+  public:
+
+  // optional string hero_loop_disappear = 21;
+  bool has_hero_loop_disappear() const;
+  private:
+  bool _internal_has_hero_loop_disappear() const;
+  public:
+  void clear_hero_loop_disappear();
+  const std::string& hero_loop_disappear() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hero_loop_disappear(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hero_loop_disappear();
+  PROTOBUF_NODISCARD std::string* release_hero_loop_disappear();
+  void set_allocated_hero_loop_disappear(std::string* hero_loop_disappear);
+  private:
+  const std::string& _internal_hero_loop_disappear() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hero_loop_disappear(const std::string& value);
+  std::string* _internal_mutable_hero_loop_disappear();
+  public:
+
+  // optional string illusion_label = 29;
+  bool has_illusion_label() const;
+  private:
+  bool _internal_has_illusion_label() const;
+  public:
+  void clear_illusion_label();
+  const std::string& illusion_label() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_illusion_label(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_illusion_label();
+  PROTOBUF_NODISCARD std::string* release_illusion_label();
+  void set_allocated_illusion_label(std::string* illusion_label);
+  private:
+  const std::string& _internal_illusion_label() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_illusion_label(const std::string& value);
+  std::string* _internal_mutable_illusion_label();
+  public:
+
+  // optional .CMsgVector v_start = 16;
+  bool has_v_start() const;
+  private:
+  bool _internal_has_v_start() const;
+  public:
+  void clear_v_start();
+  const ::CMsgVector& v_start() const;
+  PROTOBUF_NODISCARD ::CMsgVector* release_v_start();
+  ::CMsgVector* mutable_v_start();
+  void set_allocated_v_start(::CMsgVector* v_start);
+  private:
+  const ::CMsgVector& _internal_v_start() const;
+  ::CMsgVector* _internal_mutable_v_start();
+  public:
+  void unsafe_arena_set_allocated_v_start(
+      ::CMsgVector* v_start);
+  ::CMsgVector* unsafe_arena_release_v_start();
+
+  // optional .CMsgVector v_end = 17;
+  bool has_v_end() const;
+  private:
+  bool _internal_has_v_end() const;
+  public:
+  void clear_v_end();
+  const ::CMsgVector& v_end() const;
+  PROTOBUF_NODISCARD ::CMsgVector* release_v_end();
+  ::CMsgVector* mutable_v_end();
+  void set_allocated_v_end(::CMsgVector* v_end);
+  private:
+  const ::CMsgVector& _internal_v_end() const;
+  ::CMsgVector* _internal_mutable_v_end();
+  public:
+  void unsafe_arena_set_allocated_v_end(
+      ::CMsgVector* v_end);
+  ::CMsgVector* unsafe_arena_release_v_end();
+
+  // required int32 parent = 2;
+  bool has_parent() const;
+  private:
+  bool _internal_has_parent() const;
+  public:
+  void clear_parent();
+  int32_t parent() const;
+  void set_parent(int32_t value);
+  private:
+  int32_t _internal_parent() const;
+  void _internal_set_parent(int32_t value);
+  public:
+
+  // required int32 index = 3;
+  bool has_index() const;
+  private:
+  bool _internal_has_index() const;
+  public:
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
+  private:
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
+  public:
+
+  // required int32 serial_num = 4;
+  bool has_serial_num() const;
+  private:
+  bool _internal_has_serial_num() const;
+  public:
+  void clear_serial_num();
+  int32_t serial_num() const;
+  void set_serial_num(int32_t value);
+  private:
+  int32_t _internal_serial_num() const;
+  void _internal_set_serial_num(int32_t value);
+  public:
+
+  // optional int32 modifier_class = 5;
+  bool has_modifier_class() const;
+  private:
+  bool _internal_has_modifier_class() const;
+  public:
+  void clear_modifier_class();
+  int32_t modifier_class() const;
+  void set_modifier_class(int32_t value);
+  private:
+  int32_t _internal_modifier_class() const;
+  void _internal_set_modifier_class(int32_t value);
+  public:
+
+  // optional int32 ability_level = 6;
+  bool has_ability_level() const;
+  private:
+  bool _internal_has_ability_level() const;
+  public:
+  void clear_ability_level();
+  int32_t ability_level() const;
+  void set_ability_level(int32_t value);
+  private:
+  int32_t _internal_ability_level() const;
+  void _internal_set_ability_level(int32_t value);
+  public:
+
+  // optional int32 stack_count = 7;
+  bool has_stack_count() const;
+  private:
+  bool _internal_has_stack_count() const;
+  public:
+  void clear_stack_count();
+  int32_t stack_count() const;
+  void set_stack_count(int32_t value);
+  private:
+  int32_t _internal_stack_count() const;
+  void _internal_set_stack_count(int32_t value);
+  public:
+
+  // optional float creation_time = 8;
+  bool has_creation_time() const;
+  private:
+  bool _internal_has_creation_time() const;
+  public:
+  void clear_creation_time();
+  float creation_time() const;
+  void set_creation_time(float value);
+  private:
+  float _internal_creation_time() const;
+  void _internal_set_creation_time(float value);
+  public:
+
+  // optional int32 caster = 10;
+  bool has_caster() const;
+  private:
+  bool _internal_has_caster() const;
+  public:
+  void clear_caster();
+  int32_t caster() const;
+  void set_caster(int32_t value);
+  private:
+  int32_t _internal_caster() const;
+  void _internal_set_caster(int32_t value);
+  public:
+
+  // optional int32 ability = 11;
+  bool has_ability() const;
+  private:
+  bool _internal_has_ability() const;
+  public:
+  void clear_ability();
+  int32_t ability() const;
+  void set_ability(int32_t value);
+  private:
+  int32_t _internal_ability() const;
+  void _internal_set_ability(int32_t value);
+  public:
+
+  // optional int32 armor = 12;
+  bool has_armor() const;
+  private:
+  bool _internal_has_armor() const;
+  public:
+  void clear_armor();
+  int32_t armor() const;
+  void set_armor(int32_t value);
+  private:
+  int32_t _internal_armor() const;
+  void _internal_set_armor(int32_t value);
+  public:
+
+  // optional float fade_time = 13;
+  bool has_fade_time() const;
+  private:
+  bool _internal_has_fade_time() const;
+  public:
+  void clear_fade_time();
+  float fade_time() const;
+  void set_fade_time(float value);
+  private:
+  float _internal_fade_time() const;
+  void _internal_set_fade_time(float value);
+  public:
+
+  // optional float channel_time = 15;
+  bool has_channel_time() const;
+  private:
+  bool _internal_has_channel_time() const;
+  public:
+  void clear_channel_time();
+  float channel_time() const;
+  void set_channel_time(float value);
+  private:
+  float _internal_channel_time() const;
+  void _internal_set_channel_time(float value);
+  public:
+
+  // optional int32 movement_speed = 22;
+  bool has_movement_speed() const;
+  private:
+  bool _internal_has_movement_speed() const;
+  public:
+  void clear_movement_speed();
+  int32_t movement_speed() const;
+  void set_movement_speed(int32_t value);
+  private:
+  int32_t _internal_movement_speed() const;
+  void _internal_set_movement_speed(int32_t value);
+  public:
+
+  // optional bool subtle = 14;
+  bool has_subtle() const;
+  private:
+  bool _internal_has_subtle() const;
+  public:
+  void clear_subtle();
+  bool subtle() const;
+  void set_subtle(bool value);
+  private:
+  bool _internal_subtle() const;
+  void _internal_set_subtle(bool value);
+  public:
+
+  // optional bool aura = 23;
+  bool has_aura() const;
+  private:
+  bool _internal_has_aura() const;
+  public:
+  void clear_aura();
+  bool aura() const;
+  void set_aura(bool value);
+  private:
+  bool _internal_aura() const;
+  void _internal_set_aura(bool value);
+  public:
+
+  // optional bool active = 30;
+  bool has_active() const;
+  private:
+  bool _internal_has_active() const;
+  public:
+  void clear_active();
+  bool active() const;
+  void set_active(bool value);
+  private:
+  bool _internal_active() const;
+  void _internal_set_active(bool value);
+  public:
+
+  // optional int32 activity = 24;
+  bool has_activity() const;
+  private:
+  bool _internal_has_activity() const;
+  public:
+  void clear_activity();
+  int32_t activity() const;
+  void set_activity(int32_t value);
+  private:
+  int32_t _internal_activity() const;
+  void _internal_set_activity(int32_t value);
+  public:
+
+  // optional int32 damage = 25;
+  bool has_damage() const;
+  private:
+  bool _internal_has_damage() const;
+  public:
+  void clear_damage();
+  int32_t damage() const;
+  void set_damage(int32_t value);
+  private:
+  int32_t _internal_damage() const;
+  void _internal_set_damage(int32_t value);
+  public:
+
+  // optional int32 range = 26;
+  bool has_range() const;
+  private:
+  bool _internal_has_range() const;
+  public:
+  void clear_range();
+  int32_t range() const;
+  void set_range(int32_t value);
+  private:
+  int32_t _internal_range() const;
+  void _internal_set_range(int32_t value);
+  public:
+
+  // optional int32 dd_modifier_index = 27;
+  bool has_dd_modifier_index() const;
+  private:
+  bool _internal_has_dd_modifier_index() const;
+  public:
+  void clear_dd_modifier_index();
+  int32_t dd_modifier_index() const;
+  void set_dd_modifier_index(int32_t value);
+  private:
+  int32_t _internal_dd_modifier_index() const;
+  void _internal_set_dd_modifier_index(int32_t value);
+  public:
+
+  // optional int32 dd_ability_index = 28;
+  bool has_dd_ability_index() const;
+  private:
+  bool _internal_has_dd_ability_index() const;
+  public:
+  void clear_dd_ability_index();
+  int32_t dd_ability_index() const;
+  void set_dd_ability_index(int32_t value);
+  private:
+  int32_t _internal_dd_ability_index() const;
+  void _internal_set_dd_ability_index(int32_t value);
+  public:
+
+  // required .DOTA_MODIFIER_ENTRY_TYPE entry_type = 1 [default = DOTA_MODIFIER_ENTRY_TYPE_ACTIVE];
+  bool has_entry_type() const;
+  private:
+  bool _internal_has_entry_type() const;
+  public:
+  void clear_entry_type();
+  ::DOTA_MODIFIER_ENTRY_TYPE entry_type() const;
+  void set_entry_type(::DOTA_MODIFIER_ENTRY_TYPE value);
+  private:
+  ::DOTA_MODIFIER_ENTRY_TYPE _internal_entry_type() const;
+  void _internal_set_entry_type(::DOTA_MODIFIER_ENTRY_TYPE value);
+  public:
+
+  // optional float duration = 9 [default = -1];
+  bool has_duration() const;
+  private:
+  bool _internal_has_duration() const;
+  public:
+  void clear_duration();
+  float duration() const;
+  void set_duration(float value);
+  private:
+  float _internal_duration() const;
+  void _internal_set_duration(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CDOTAModifierBuffTableEntry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr portal_loop_appear_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr portal_loop_disappear_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hero_loop_appear_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hero_loop_disappear_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr illusion_label_;
+    ::CMsgVector* v_start_;
+    ::CMsgVector* v_end_;
+    int32_t parent_;
+    int32_t index_;
+    int32_t serial_num_;
+    int32_t modifier_class_;
+    int32_t ability_level_;
+    int32_t stack_count_;
+    float creation_time_;
+    int32_t caster_;
+    int32_t ability_;
+    int32_t armor_;
+    float fade_time_;
+    float channel_time_;
+    int32_t movement_speed_;
+    bool subtle_;
+    bool aura_;
+    bool active_;
+    int32_t activity_;
+    int32_t damage_;
+    int32_t range_;
+    int32_t dd_modifier_index_;
+    int32_t dd_ability_index_;
+    int entry_type_;
+    float duration_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_dota_5fmodifiers_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CDOTAModifierBuffTableEntry
+
+// required .DOTA_MODIFIER_ENTRY_TYPE entry_type = 1 [default = DOTA_MODIFIER_ENTRY_TYPE_ACTIVE];
+inline bool CDOTAModifierBuffTableEntry::_internal_has_entry_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x10000000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_entry_type() const {
+  return _internal_has_entry_type();
+}
+inline void CDOTAModifierBuffTableEntry::clear_entry_type() {
+  _impl_.entry_type_ = 1;
+  _impl_._has_bits_[0] &= ~0x10000000u;
+}
+inline ::DOTA_MODIFIER_ENTRY_TYPE CDOTAModifierBuffTableEntry::_internal_entry_type() const {
+  return static_cast< ::DOTA_MODIFIER_ENTRY_TYPE >(_impl_.entry_type_);
+}
+inline ::DOTA_MODIFIER_ENTRY_TYPE CDOTAModifierBuffTableEntry::entry_type() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.entry_type)
+  return _internal_entry_type();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_entry_type(::DOTA_MODIFIER_ENTRY_TYPE value) {
+  assert(::DOTA_MODIFIER_ENTRY_TYPE_IsValid(value));
+  _impl_._has_bits_[0] |= 0x10000000u;
+  _impl_.entry_type_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_entry_type(::DOTA_MODIFIER_ENTRY_TYPE value) {
+  _internal_set_entry_type(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.entry_type)
+}
+
+// required int32 parent = 2;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_parent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_parent() const {
+  return _internal_has_parent();
+}
+inline void CDOTAModifierBuffTableEntry::clear_parent() {
+  _impl_.parent_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_parent() const {
+  return _impl_.parent_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::parent() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.parent)
+  return _internal_parent();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_parent(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.parent_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_parent(int32_t value) {
+  _internal_set_parent(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.parent)
+}
+
+// required int32 index = 3;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_index() const {
+  return _internal_has_index();
+}
+inline void CDOTAModifierBuffTableEntry::clear_index() {
+  _impl_.index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_index() const {
+  return _impl_.index_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::index() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.index)
+  return _internal_index();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.index_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_index(int32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.index)
+}
+
+// required int32 serial_num = 4;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_serial_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_serial_num() const {
+  return _internal_has_serial_num();
+}
+inline void CDOTAModifierBuffTableEntry::clear_serial_num() {
+  _impl_.serial_num_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_serial_num() const {
+  return _impl_.serial_num_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::serial_num() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.serial_num)
+  return _internal_serial_num();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_serial_num(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.serial_num_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_serial_num(int32_t value) {
+  _internal_set_serial_num(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.serial_num)
+}
+
+// optional int32 modifier_class = 5;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_modifier_class() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_modifier_class() const {
+  return _internal_has_modifier_class();
+}
+inline void CDOTAModifierBuffTableEntry::clear_modifier_class() {
+  _impl_.modifier_class_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_modifier_class() const {
+  return _impl_.modifier_class_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::modifier_class() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.modifier_class)
+  return _internal_modifier_class();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_modifier_class(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.modifier_class_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_modifier_class(int32_t value) {
+  _internal_set_modifier_class(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.modifier_class)
+}
+
+// optional int32 ability_level = 6;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_ability_level() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_ability_level() const {
+  return _internal_has_ability_level();
+}
+inline void CDOTAModifierBuffTableEntry::clear_ability_level() {
+  _impl_.ability_level_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_ability_level() const {
+  return _impl_.ability_level_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::ability_level() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.ability_level)
+  return _internal_ability_level();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_ability_level(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.ability_level_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_ability_level(int32_t value) {
+  _internal_set_ability_level(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.ability_level)
+}
+
+// optional int32 stack_count = 7;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_stack_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_stack_count() const {
+  return _internal_has_stack_count();
+}
+inline void CDOTAModifierBuffTableEntry::clear_stack_count() {
+  _impl_.stack_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_stack_count() const {
+  return _impl_.stack_count_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::stack_count() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.stack_count)
+  return _internal_stack_count();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_stack_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.stack_count_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_stack_count(int32_t value) {
+  _internal_set_stack_count(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.stack_count)
+}
+
+// optional float creation_time = 8;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_creation_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_creation_time() const {
+  return _internal_has_creation_time();
+}
+inline void CDOTAModifierBuffTableEntry::clear_creation_time() {
+  _impl_.creation_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline float CDOTAModifierBuffTableEntry::_internal_creation_time() const {
+  return _impl_.creation_time_;
+}
+inline float CDOTAModifierBuffTableEntry::creation_time() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.creation_time)
+  return _internal_creation_time();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_creation_time(float value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.creation_time_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_creation_time(float value) {
+  _internal_set_creation_time(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.creation_time)
+}
+
+// optional float duration = 9 [default = -1];
+inline bool CDOTAModifierBuffTableEntry::_internal_has_duration() const {
+  bool value = (_impl_._has_bits_[0] & 0x20000000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_duration() const {
+  return _internal_has_duration();
+}
+inline void CDOTAModifierBuffTableEntry::clear_duration() {
+  _impl_.duration_ = -1;
+  _impl_._has_bits_[0] &= ~0x20000000u;
+}
+inline float CDOTAModifierBuffTableEntry::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline float CDOTAModifierBuffTableEntry::duration() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.duration)
+  return _internal_duration();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_duration(float value) {
+  _impl_._has_bits_[0] |= 0x20000000u;
+  _impl_.duration_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_duration(float value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.duration)
+}
+
+// optional int32 caster = 10;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_caster() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_caster() const {
+  return _internal_has_caster();
+}
+inline void CDOTAModifierBuffTableEntry::clear_caster() {
+  _impl_.caster_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_caster() const {
+  return _impl_.caster_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::caster() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.caster)
+  return _internal_caster();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_caster(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.caster_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_caster(int32_t value) {
+  _internal_set_caster(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.caster)
+}
+
+// optional int32 ability = 11;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_ability() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_ability() const {
+  return _internal_has_ability();
+}
+inline void CDOTAModifierBuffTableEntry::clear_ability() {
+  _impl_.ability_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_ability() const {
+  return _impl_.ability_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::ability() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.ability)
+  return _internal_ability();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_ability(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.ability_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_ability(int32_t value) {
+  _internal_set_ability(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.ability)
+}
+
+// optional int32 armor = 12;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_armor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_armor() const {
+  return _internal_has_armor();
+}
+inline void CDOTAModifierBuffTableEntry::clear_armor() {
+  _impl_.armor_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_armor() const {
+  return _impl_.armor_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::armor() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.armor)
+  return _internal_armor();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_armor(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.armor_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_armor(int32_t value) {
+  _internal_set_armor(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.armor)
+}
+
+// optional float fade_time = 13;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_fade_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_fade_time() const {
+  return _internal_has_fade_time();
+}
+inline void CDOTAModifierBuffTableEntry::clear_fade_time() {
+  _impl_.fade_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline float CDOTAModifierBuffTableEntry::_internal_fade_time() const {
+  return _impl_.fade_time_;
+}
+inline float CDOTAModifierBuffTableEntry::fade_time() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.fade_time)
+  return _internal_fade_time();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_fade_time(float value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.fade_time_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_fade_time(float value) {
+  _internal_set_fade_time(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.fade_time)
+}
+
+// optional bool subtle = 14;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_subtle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_subtle() const {
+  return _internal_has_subtle();
+}
+inline void CDOTAModifierBuffTableEntry::clear_subtle() {
+  _impl_.subtle_ = false;
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline bool CDOTAModifierBuffTableEntry::_internal_subtle() const {
+  return _impl_.subtle_;
+}
+inline bool CDOTAModifierBuffTableEntry::subtle() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.subtle)
+  return _internal_subtle();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_subtle(bool value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.subtle_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_subtle(bool value) {
+  _internal_set_subtle(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.subtle)
+}
+
+// optional float channel_time = 15;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_channel_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_channel_time() const {
+  return _internal_has_channel_time();
+}
+inline void CDOTAModifierBuffTableEntry::clear_channel_time() {
+  _impl_.channel_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline float CDOTAModifierBuffTableEntry::_internal_channel_time() const {
+  return _impl_.channel_time_;
+}
+inline float CDOTAModifierBuffTableEntry::channel_time() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.channel_time)
+  return _internal_channel_time();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_channel_time(float value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.channel_time_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_channel_time(float value) {
+  _internal_set_channel_time(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.channel_time)
+}
+
+// optional .CMsgVector v_start = 16;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_v_start() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.v_start_ != nullptr);
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_v_start() const {
+  return _internal_has_v_start();
+}
+inline const ::CMsgVector& CDOTAModifierBuffTableEntry::_internal_v_start() const {
+  const ::CMsgVector* p = _impl_.v_start_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgVector&>(
+      ::_CMsgVector_default_instance_);
+}
+inline const ::CMsgVector& CDOTAModifierBuffTableEntry::v_start() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.v_start)
+  return _internal_v_start();
+}
+inline void CDOTAModifierBuffTableEntry::unsafe_arena_set_allocated_v_start(
+    ::CMsgVector* v_start) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.v_start_);
+  }
+  _impl_.v_start_ = v_start;
+  if (v_start) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CDOTAModifierBuffTableEntry.v_start)
+}
+inline ::CMsgVector* CDOTAModifierBuffTableEntry::release_v_start() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::CMsgVector* temp = _impl_.v_start_;
+  _impl_.v_start_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgVector* CDOTAModifierBuffTableEntry::unsafe_arena_release_v_start() {
+  // @@protoc_insertion_point(field_release:CDOTAModifierBuffTableEntry.v_start)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::CMsgVector* temp = _impl_.v_start_;
+  _impl_.v_start_ = nullptr;
+  return temp;
+}
+inline ::CMsgVector* CDOTAModifierBuffTableEntry::_internal_mutable_v_start() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.v_start_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgVector>(GetArenaForAllocation());
+    _impl_.v_start_ = p;
+  }
+  return _impl_.v_start_;
+}
+inline ::CMsgVector* CDOTAModifierBuffTableEntry::mutable_v_start() {
+  ::CMsgVector* _msg = _internal_mutable_v_start();
+  // @@protoc_insertion_point(field_mutable:CDOTAModifierBuffTableEntry.v_start)
+  return _msg;
+}
+inline void CDOTAModifierBuffTableEntry::set_allocated_v_start(::CMsgVector* v_start) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.v_start_);
+  }
+  if (v_start) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(v_start));
+    if (message_arena != submessage_arena) {
+      v_start = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, v_start, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.v_start_ = v_start;
+  // @@protoc_insertion_point(field_set_allocated:CDOTAModifierBuffTableEntry.v_start)
+}
+
+// optional .CMsgVector v_end = 17;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_v_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.v_end_ != nullptr);
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_v_end() const {
+  return _internal_has_v_end();
+}
+inline const ::CMsgVector& CDOTAModifierBuffTableEntry::_internal_v_end() const {
+  const ::CMsgVector* p = _impl_.v_end_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgVector&>(
+      ::_CMsgVector_default_instance_);
+}
+inline const ::CMsgVector& CDOTAModifierBuffTableEntry::v_end() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.v_end)
+  return _internal_v_end();
+}
+inline void CDOTAModifierBuffTableEntry::unsafe_arena_set_allocated_v_end(
+    ::CMsgVector* v_end) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.v_end_);
+  }
+  _impl_.v_end_ = v_end;
+  if (v_end) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CDOTAModifierBuffTableEntry.v_end)
+}
+inline ::CMsgVector* CDOTAModifierBuffTableEntry::release_v_end() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::CMsgVector* temp = _impl_.v_end_;
+  _impl_.v_end_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgVector* CDOTAModifierBuffTableEntry::unsafe_arena_release_v_end() {
+  // @@protoc_insertion_point(field_release:CDOTAModifierBuffTableEntry.v_end)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::CMsgVector* temp = _impl_.v_end_;
+  _impl_.v_end_ = nullptr;
+  return temp;
+}
+inline ::CMsgVector* CDOTAModifierBuffTableEntry::_internal_mutable_v_end() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.v_end_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgVector>(GetArenaForAllocation());
+    _impl_.v_end_ = p;
+  }
+  return _impl_.v_end_;
+}
+inline ::CMsgVector* CDOTAModifierBuffTableEntry::mutable_v_end() {
+  ::CMsgVector* _msg = _internal_mutable_v_end();
+  // @@protoc_insertion_point(field_mutable:CDOTAModifierBuffTableEntry.v_end)
+  return _msg;
+}
+inline void CDOTAModifierBuffTableEntry::set_allocated_v_end(::CMsgVector* v_end) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.v_end_);
+  }
+  if (v_end) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(v_end));
+    if (message_arena != submessage_arena) {
+      v_end = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, v_end, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.v_end_ = v_end;
+  // @@protoc_insertion_point(field_set_allocated:CDOTAModifierBuffTableEntry.v_end)
+}
+
+// optional string portal_loop_appear = 18;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_portal_loop_appear() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_portal_loop_appear() const {
+  return _internal_has_portal_loop_appear();
+}
+inline void CDOTAModifierBuffTableEntry::clear_portal_loop_appear() {
+  _impl_.portal_loop_appear_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::portal_loop_appear() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.portal_loop_appear)
+  return _internal_portal_loop_appear();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CDOTAModifierBuffTableEntry::set_portal_loop_appear(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.portal_loop_appear_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.portal_loop_appear)
+}
+inline std::string* CDOTAModifierBuffTableEntry::mutable_portal_loop_appear() {
+  std::string* _s = _internal_mutable_portal_loop_appear();
+  // @@protoc_insertion_point(field_mutable:CDOTAModifierBuffTableEntry.portal_loop_appear)
+  return _s;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::_internal_portal_loop_appear() const {
+  return _impl_.portal_loop_appear_.Get();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_portal_loop_appear(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.portal_loop_appear_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::_internal_mutable_portal_loop_appear() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.portal_loop_appear_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::release_portal_loop_appear() {
+  // @@protoc_insertion_point(field_release:CDOTAModifierBuffTableEntry.portal_loop_appear)
+  if (!_internal_has_portal_loop_appear()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.portal_loop_appear_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.portal_loop_appear_.IsDefault()) {
+    _impl_.portal_loop_appear_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CDOTAModifierBuffTableEntry::set_allocated_portal_loop_appear(std::string* portal_loop_appear) {
+  if (portal_loop_appear != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.portal_loop_appear_.SetAllocated(portal_loop_appear, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.portal_loop_appear_.IsDefault()) {
+    _impl_.portal_loop_appear_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CDOTAModifierBuffTableEntry.portal_loop_appear)
+}
+
+// optional string portal_loop_disappear = 19;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_portal_loop_disappear() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_portal_loop_disappear() const {
+  return _internal_has_portal_loop_disappear();
+}
+inline void CDOTAModifierBuffTableEntry::clear_portal_loop_disappear() {
+  _impl_.portal_loop_disappear_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::portal_loop_disappear() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.portal_loop_disappear)
+  return _internal_portal_loop_disappear();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CDOTAModifierBuffTableEntry::set_portal_loop_disappear(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.portal_loop_disappear_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.portal_loop_disappear)
+}
+inline std::string* CDOTAModifierBuffTableEntry::mutable_portal_loop_disappear() {
+  std::string* _s = _internal_mutable_portal_loop_disappear();
+  // @@protoc_insertion_point(field_mutable:CDOTAModifierBuffTableEntry.portal_loop_disappear)
+  return _s;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::_internal_portal_loop_disappear() const {
+  return _impl_.portal_loop_disappear_.Get();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_portal_loop_disappear(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.portal_loop_disappear_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::_internal_mutable_portal_loop_disappear() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.portal_loop_disappear_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::release_portal_loop_disappear() {
+  // @@protoc_insertion_point(field_release:CDOTAModifierBuffTableEntry.portal_loop_disappear)
+  if (!_internal_has_portal_loop_disappear()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.portal_loop_disappear_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.portal_loop_disappear_.IsDefault()) {
+    _impl_.portal_loop_disappear_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CDOTAModifierBuffTableEntry::set_allocated_portal_loop_disappear(std::string* portal_loop_disappear) {
+  if (portal_loop_disappear != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.portal_loop_disappear_.SetAllocated(portal_loop_disappear, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.portal_loop_disappear_.IsDefault()) {
+    _impl_.portal_loop_disappear_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CDOTAModifierBuffTableEntry.portal_loop_disappear)
+}
+
+// optional string hero_loop_appear = 20;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_hero_loop_appear() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_hero_loop_appear() const {
+  return _internal_has_hero_loop_appear();
+}
+inline void CDOTAModifierBuffTableEntry::clear_hero_loop_appear() {
+  _impl_.hero_loop_appear_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::hero_loop_appear() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.hero_loop_appear)
+  return _internal_hero_loop_appear();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CDOTAModifierBuffTableEntry::set_hero_loop_appear(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.hero_loop_appear_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.hero_loop_appear)
+}
+inline std::string* CDOTAModifierBuffTableEntry::mutable_hero_loop_appear() {
+  std::string* _s = _internal_mutable_hero_loop_appear();
+  // @@protoc_insertion_point(field_mutable:CDOTAModifierBuffTableEntry.hero_loop_appear)
+  return _s;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::_internal_hero_loop_appear() const {
+  return _impl_.hero_loop_appear_.Get();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_hero_loop_appear(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.hero_loop_appear_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::_internal_mutable_hero_loop_appear() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.hero_loop_appear_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::release_hero_loop_appear() {
+  // @@protoc_insertion_point(field_release:CDOTAModifierBuffTableEntry.hero_loop_appear)
+  if (!_internal_has_hero_loop_appear()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.hero_loop_appear_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hero_loop_appear_.IsDefault()) {
+    _impl_.hero_loop_appear_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CDOTAModifierBuffTableEntry::set_allocated_hero_loop_appear(std::string* hero_loop_appear) {
+  if (hero_loop_appear != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.hero_loop_appear_.SetAllocated(hero_loop_appear, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hero_loop_appear_.IsDefault()) {
+    _impl_.hero_loop_appear_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CDOTAModifierBuffTableEntry.hero_loop_appear)
+}
+
+// optional string hero_loop_disappear = 21;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_hero_loop_disappear() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_hero_loop_disappear() const {
+  return _internal_has_hero_loop_disappear();
+}
+inline void CDOTAModifierBuffTableEntry::clear_hero_loop_disappear() {
+  _impl_.hero_loop_disappear_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::hero_loop_disappear() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.hero_loop_disappear)
+  return _internal_hero_loop_disappear();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CDOTAModifierBuffTableEntry::set_hero_loop_disappear(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.hero_loop_disappear_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.hero_loop_disappear)
+}
+inline std::string* CDOTAModifierBuffTableEntry::mutable_hero_loop_disappear() {
+  std::string* _s = _internal_mutable_hero_loop_disappear();
+  // @@protoc_insertion_point(field_mutable:CDOTAModifierBuffTableEntry.hero_loop_disappear)
+  return _s;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::_internal_hero_loop_disappear() const {
+  return _impl_.hero_loop_disappear_.Get();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_hero_loop_disappear(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.hero_loop_disappear_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::_internal_mutable_hero_loop_disappear() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.hero_loop_disappear_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::release_hero_loop_disappear() {
+  // @@protoc_insertion_point(field_release:CDOTAModifierBuffTableEntry.hero_loop_disappear)
+  if (!_internal_has_hero_loop_disappear()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.hero_loop_disappear_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hero_loop_disappear_.IsDefault()) {
+    _impl_.hero_loop_disappear_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CDOTAModifierBuffTableEntry::set_allocated_hero_loop_disappear(std::string* hero_loop_disappear) {
+  if (hero_loop_disappear != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.hero_loop_disappear_.SetAllocated(hero_loop_disappear, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hero_loop_disappear_.IsDefault()) {
+    _impl_.hero_loop_disappear_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CDOTAModifierBuffTableEntry.hero_loop_disappear)
+}
+
+// optional int32 movement_speed = 22;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_movement_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_movement_speed() const {
+  return _internal_has_movement_speed();
+}
+inline void CDOTAModifierBuffTableEntry::clear_movement_speed() {
+  _impl_.movement_speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_movement_speed() const {
+  return _impl_.movement_speed_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::movement_speed() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.movement_speed)
+  return _internal_movement_speed();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_movement_speed(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.movement_speed_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_movement_speed(int32_t value) {
+  _internal_set_movement_speed(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.movement_speed)
+}
+
+// optional bool aura = 23;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_aura() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_aura() const {
+  return _internal_has_aura();
+}
+inline void CDOTAModifierBuffTableEntry::clear_aura() {
+  _impl_.aura_ = false;
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline bool CDOTAModifierBuffTableEntry::_internal_aura() const {
+  return _impl_.aura_;
+}
+inline bool CDOTAModifierBuffTableEntry::aura() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.aura)
+  return _internal_aura();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_aura(bool value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.aura_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_aura(bool value) {
+  _internal_set_aura(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.aura)
+}
+
+// optional int32 activity = 24;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_activity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00800000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_activity() const {
+  return _internal_has_activity();
+}
+inline void CDOTAModifierBuffTableEntry::clear_activity() {
+  _impl_.activity_ = 0;
+  _impl_._has_bits_[0] &= ~0x00800000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_activity() const {
+  return _impl_.activity_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::activity() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.activity)
+  return _internal_activity();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_activity(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00800000u;
+  _impl_.activity_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_activity(int32_t value) {
+  _internal_set_activity(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.activity)
+}
+
+// optional int32 damage = 25;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_damage() const {
+  bool value = (_impl_._has_bits_[0] & 0x01000000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_damage() const {
+  return _internal_has_damage();
+}
+inline void CDOTAModifierBuffTableEntry::clear_damage() {
+  _impl_.damage_ = 0;
+  _impl_._has_bits_[0] &= ~0x01000000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_damage() const {
+  return _impl_.damage_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::damage() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.damage)
+  return _internal_damage();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_damage(int32_t value) {
+  _impl_._has_bits_[0] |= 0x01000000u;
+  _impl_.damage_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_damage(int32_t value) {
+  _internal_set_damage(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.damage)
+}
+
+// optional int32 range = 26;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x02000000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_range() const {
+  return _internal_has_range();
+}
+inline void CDOTAModifierBuffTableEntry::clear_range() {
+  _impl_.range_ = 0;
+  _impl_._has_bits_[0] &= ~0x02000000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_range() const {
+  return _impl_.range_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::range() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.range)
+  return _internal_range();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_range(int32_t value) {
+  _impl_._has_bits_[0] |= 0x02000000u;
+  _impl_.range_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_range(int32_t value) {
+  _internal_set_range(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.range)
+}
+
+// optional int32 dd_modifier_index = 27;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_dd_modifier_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x04000000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_dd_modifier_index() const {
+  return _internal_has_dd_modifier_index();
+}
+inline void CDOTAModifierBuffTableEntry::clear_dd_modifier_index() {
+  _impl_.dd_modifier_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x04000000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_dd_modifier_index() const {
+  return _impl_.dd_modifier_index_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::dd_modifier_index() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.dd_modifier_index)
+  return _internal_dd_modifier_index();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_dd_modifier_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x04000000u;
+  _impl_.dd_modifier_index_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_dd_modifier_index(int32_t value) {
+  _internal_set_dd_modifier_index(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.dd_modifier_index)
+}
+
+// optional int32 dd_ability_index = 28;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_dd_ability_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x08000000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_dd_ability_index() const {
+  return _internal_has_dd_ability_index();
+}
+inline void CDOTAModifierBuffTableEntry::clear_dd_ability_index() {
+  _impl_.dd_ability_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x08000000u;
+}
+inline int32_t CDOTAModifierBuffTableEntry::_internal_dd_ability_index() const {
+  return _impl_.dd_ability_index_;
+}
+inline int32_t CDOTAModifierBuffTableEntry::dd_ability_index() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.dd_ability_index)
+  return _internal_dd_ability_index();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_dd_ability_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x08000000u;
+  _impl_.dd_ability_index_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_dd_ability_index(int32_t value) {
+  _internal_set_dd_ability_index(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.dd_ability_index)
+}
+
+// optional string illusion_label = 29;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_illusion_label() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_illusion_label() const {
+  return _internal_has_illusion_label();
+}
+inline void CDOTAModifierBuffTableEntry::clear_illusion_label() {
+  _impl_.illusion_label_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::illusion_label() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.illusion_label)
+  return _internal_illusion_label();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CDOTAModifierBuffTableEntry::set_illusion_label(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.illusion_label_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.illusion_label)
+}
+inline std::string* CDOTAModifierBuffTableEntry::mutable_illusion_label() {
+  std::string* _s = _internal_mutable_illusion_label();
+  // @@protoc_insertion_point(field_mutable:CDOTAModifierBuffTableEntry.illusion_label)
+  return _s;
+}
+inline const std::string& CDOTAModifierBuffTableEntry::_internal_illusion_label() const {
+  return _impl_.illusion_label_.Get();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_illusion_label(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.illusion_label_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::_internal_mutable_illusion_label() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.illusion_label_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CDOTAModifierBuffTableEntry::release_illusion_label() {
+  // @@protoc_insertion_point(field_release:CDOTAModifierBuffTableEntry.illusion_label)
+  if (!_internal_has_illusion_label()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.illusion_label_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.illusion_label_.IsDefault()) {
+    _impl_.illusion_label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CDOTAModifierBuffTableEntry::set_allocated_illusion_label(std::string* illusion_label) {
+  if (illusion_label != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.illusion_label_.SetAllocated(illusion_label, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.illusion_label_.IsDefault()) {
+    _impl_.illusion_label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CDOTAModifierBuffTableEntry.illusion_label)
+}
+
+// optional bool active = 30;
+inline bool CDOTAModifierBuffTableEntry::_internal_has_active() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
+}
+inline bool CDOTAModifierBuffTableEntry::has_active() const {
+  return _internal_has_active();
+}
+inline void CDOTAModifierBuffTableEntry::clear_active() {
+  _impl_.active_ = false;
+  _impl_._has_bits_[0] &= ~0x00400000u;
+}
+inline bool CDOTAModifierBuffTableEntry::_internal_active() const {
+  return _impl_.active_;
+}
+inline bool CDOTAModifierBuffTableEntry::active() const {
+  // @@protoc_insertion_point(field_get:CDOTAModifierBuffTableEntry.active)
+  return _internal_active();
+}
+inline void CDOTAModifierBuffTableEntry::_internal_set_active(bool value) {
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.active_ = value;
+}
+inline void CDOTAModifierBuffTableEntry::set_active(bool value) {
+  _internal_set_active(value);
+  // @@protoc_insertion_point(field_set:CDOTAModifierBuffTableEntry.active)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::DOTA_MODIFIER_ENTRY_TYPE> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::DOTA_MODIFIER_ENTRY_TYPE>() {
+  return ::DOTA_MODIFIER_ENTRY_TYPE_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_dota_5fmodifiers_2eproto
@@ -41,12 +41,13 @@ namespace dota {
         return true;
     }
 
-    void entity::updateFromBitstream(bitstream& bstream, entity_delta* delta) {
-        // use this static vector so we don't realocate memory all the time
-        static std::mutex fieldLock;
-        static std::vector<uint32_t> fields(1000, 0);
+    /** Returns the scratch list for field ids, one per thread so parsers on different threads don't share it */
+    inline std::vector<uint32_t>& fieldScratch() {
+        static thread_local std::vector<uint32_t> fields(1000, 0);
+        return fields;
+    }
 
-        std::unique_lock<std::mutex> lock(fieldLock);
+    void entity::readFields(bitstream &bstream, std::vector<uint32_t> &fields) {
         fields.clear();
 
         uint32_t fieldId = -1;
@@ -54,6 +55,12 @@ namespace dota {
             D_( std::cout << "[entity] Read field: " << fieldId << " " << D_FILE << " " << __LINE__ << std::endl;, 4 )
             fields.push_back(fieldId);
         }
+    }
+
+    void entity::updateFromBitstream(bitstream& bstream, entity_delta* delta) {
+        // reuse the scratch list so we don't realocate memory all the time
+        std::vector<uint32_t> &fields = fieldScratch();
+        readFields(bstream, fields);
 
         for (auto &it : fields) {
             if (it >= properties.size())
@@ -65,10 +72,10 @@ namespace dota {
             property &p = properties[it];
             if (p.isInitialized()) {
                 D_( std::cout << "[entity] Updating property at " << it << " " << D_FILE << " " << __LINE__ << std::endl;, 4 )
-                p.update(bstream);
+                p.update(bstream, flat->plan[it]);
             } else {
                 D_( std::cout << "[entity] Creating property at " << it << " " << D_FILE << " " << __LINE__ << std::endl;, 4 )
-                properties[it] = property::create(bstream, flat->properties[it].prop);
+                properties[it] = property::create(bstream, flat->plan[it]);
                 properties[it].setName(&flat->properties[it].name); // set hierarchial name of property
             }
         }
@@ -82,15 +89,9 @@ namespace dota {
     }
 
     void entity::skip(bitstream& bstream) {
-        // use this static vector so we don't realocate memory all the time
-        static std::vector<uint32_t> fields(1000, 0);
-        fields.clear();
-
-        uint32_t fieldId = -1;
-        while (readFieldId(bstream, fieldId)) {
-            D_( std::cout << "[entity] Read field: " << fieldId << " " << D_FILE << " " << __LINE__ << std::endl;, 4 )
-            fields.push_back(fieldId);
-        }
+        // reuse the scratch list so we don't realocate memory all the time
+        std::vector<uint32_t> &fields = fieldScratch();
+        readFields(bstream, fields);
 
         for (auto &it : fields) {
             if (it >= properties.size())
@@ -100,7 +101,7 @@ namespace dota {
                 );
 
             D_( std::cout << "[entity] Skipping property at " << it << " " << D_FILE << " " << __LINE__ << std::endl;, 4 )
-            property::skip(bstream, flat->properties[it].prop);
+            property::skip(bstream, flat->plan[it]);
         }
     }
 
@@ -26,7 +26,6 @@
 #include <unordered_map>
 #include <string>
 #include <utility>
-#include <mutex>
 
 #include <boost/functional/hash.hpp>
 
@@ -199,8 +198,7 @@ namespace dota {
 
             /** Allow copying */
             entity(const entity& e) : initialized(e.initialized), id(e.id), cls(e.cls),
-                flat(e.flat), properties(e.properties), currentState(e.currentState),
-                stringIndex(e.stringIndex)
+                flat(e.flat), properties(e.properties), currentState(e.currentState)
             {
                 if (cls == nullptr || flat == nullptr)
                     initialized = false;
@@ -209,7 +207,7 @@ namespace dota {
             /** Allow moving */
             entity(entity&& e) : initialized(e.initialized), id(e.id), cls(e.cls),
                 flat(e.flat), properties(std::move(e.properties)),
-                currentState(e.currentState), stringIndex(std::move(e.stringIndex))
+                currentState(e.currentState)
             {
                 if (cls == nullptr || flat == nullptr)
                     initialized = false;
@@ -236,7 +234,6 @@ namespace dota {
                 std::swap(flat, b.flat);
                 std::swap(properties, b.properties);
                 std::swap(currentState, b.currentState);
-                std::swap(stringIndex, b.stringIndex);
             }
 
             /** Returns whether this entity has been initialized */
@@ -257,17 +254,14 @@ namespace dota {
             /**
              * Returns iterator pointing to the element request or one element behind the last if none can be found
              *
-             * The first time this function is called a search index is build to cache the ID -> Name relation.
-             * This is only nessecary ones and happens automatically. Subsequent access will be a lot faster.
+             * Names are looked up in the index of the flattable, which is shared by all entities of a class.
              */
             inline iterator find(const std::string& needle) {
-                buildIndex();
-
-                auto it = stringIndex.find(needle);
-                if (it == stringIndex.end()) {
+                const int32_t idx = indexOf(needle);
+                if (idx == -1) {
                     return properties.end();
                 } else {
-                    return properties.begin() + it->second;
+                    return properties.begin() + idx;
                 }
             }
 
@@ -279,15 +273,13 @@ namespace dota {
             /** Returns property value by name, throws if property doesn't exist */
             template <typename T>
             inline T prop(const std::string& needle) {
-                buildIndex();
-
-                auto it = stringIndex.find(needle);
-                if (it == stringIndex.end()) {
+                const int32_t idx = indexOf(needle);
+                if (idx == -1) {
                     BOOST_THROW_EXCEPTION(entityUnkownProperty()
                         << EArg<1>::info(needle)
                     );
                 } else {
-                    return properties[it->second].as<T>();
+                    return properties[idx].as<T>();
                 }
             }
 
@@ -306,33 +298,23 @@ namespace dota {
             /** Returns property value by name, returns default value if property doesn't exist */
             template <typename T>
             inline T prop(const std::string& needle, T def) {
-                buildIndex();
-
-                auto it = stringIndex.find(needle);
-                if (it == stringIndex.end()) {
+                const int32_t idx = indexOf(needle);
+                if (idx == -1) {
                     return def;
                 } else {
-                    return properties[it->second].as<T>();
+                    return properties[idx].as<T>();
                 }
             }
 
             /** Returns the index of the specified property in the flattable */
             inline int32_t getPropIndex(const std::string& needle) {
-                buildIndex();
-
-                auto it = stringIndex.find(needle);
-                if (it == stringIndex.end()) {
-                    return -1;
-                } else {
-                    return it->second;
-                }
+                return indexOf(needle);
             }
 
             /** Checks if a property exists by name */
             template <typename T>
             inline T hasProp(const std::string& needle) {
-                buildIndex();
-                return (stringIndex.find(needle) != stringIndex.end());
+                return (indexOf(needle) != -1);
             }
 
             /** Returns this entities ID */
@@ -350,11 +332,21 @@ namespace dota {
                 return cls->networkName;
             }
 
+            /** Returns the entity description of this entity's class */
+            inline const entity_list::value_type* getClass() const {
+                return cls;
+            }
+
             /** Returns the flattened sendtable for this entity */
             inline const flatsendtable* getRecvTable() const {
                 return flat;
             }
 
+            /** Returns the list of properties accessed by their field id */
+            inline map_type& getProperties() {
+                return properties;
+            }
+
             /** Returns the last entity state. */
             inline state_type getState() const {
                 return currentState;
@@ -367,6 +359,9 @@ namespace dota {
 
             /** Prints a debug string containing all the properties and their values. */
             std::string DebugString();
+
+            /** Reads the ids of all fields updated, the values follow in the same order */
+            static void readFields(bitstream &bstream, std::vector<uint32_t> &fields);
         protected:
             /**
              * Constructor filling the initial state.
@@ -425,16 +420,17 @@ namespace dota {
             map_type properties;
             /** Last set entity state. */
             state_type currentState;
-            /** Search index to allow getting properties by their respective name. */
-            std::unordered_map<std::string, uint32_t, boost::hash<std::string>> stringIndex;
-
-            /** Builds the string index */
-            void buildIndex() {
-                if (stringIndex.empty())
-                    for (uint32_t i = 0; i < properties.size(); ++i) {
-                        if (properties[i].isInitialized())
-                            stringIndex[properties[i].getName()] = i;
-                    }
+
+            /** Returns the index of an initialized property by name, -1 if there is none */
+            int32_t indexOf(const std::string& needle) {
+                if (!initialized)
+                    return -1;
+
+                auto it = flat->index.find(needle);
+                if (it == flat->index.end() || it->second >= properties.size() || !properties[it->second].isInitialized())
+                    return -1;
+
+                return it->second;
             }
     };
 
@@ -0,0 +1,13616 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: gcsdk_gcmessages.proto
+
+#include "gcsdk_gcmessages.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR CMsgSHA1Digest::CMsgSHA1Digest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.block1_)*/uint64_t{0u}
+  , /*decltype(_impl_.block2_)*/uint64_t{0u}
+  , /*decltype(_impl_.block3_)*/0u} {}
+struct CMsgSHA1DigestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSHA1DigestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSHA1DigestDefaultTypeInternal() {}
+  union {
+    CMsgSHA1Digest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSHA1DigestDefaultTypeInternal _CMsgSHA1Digest_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOIDOwner::CMsgSOIDOwner(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0u} {}
+struct CMsgSOIDOwnerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOIDOwnerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOIDOwnerDefaultTypeInternal() {}
+  union {
+    CMsgSOIDOwner _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOIDOwnerDefaultTypeInternal _CMsgSOIDOwner_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOSingleObject::CMsgSOSingleObject(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.object_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.owner_soid_)*/nullptr
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_id_)*/0
+  , /*decltype(_impl_.service_id_)*/0u} {}
+struct CMsgSOSingleObjectDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOSingleObjectDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOSingleObjectDefaultTypeInternal() {}
+  union {
+    CMsgSOSingleObject _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOSingleObjectDefaultTypeInternal _CMsgSOSingleObject_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOMultipleObjects_SingleObject::CMsgSOMultipleObjects_SingleObject(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.object_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_id_)*/0} {}
+struct CMsgSOMultipleObjects_SingleObjectDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOMultipleObjects_SingleObjectDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOMultipleObjects_SingleObjectDefaultTypeInternal() {}
+  union {
+    CMsgSOMultipleObjects_SingleObject _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOMultipleObjects_SingleObjectDefaultTypeInternal _CMsgSOMultipleObjects_SingleObject_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOMultipleObjects::CMsgSOMultipleObjects(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.objects_modified_)*/{}
+  , /*decltype(_impl_.objects_added_)*/{}
+  , /*decltype(_impl_.objects_removed_)*/{}
+  , /*decltype(_impl_.owner_soid_)*/nullptr
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.service_id_)*/0u} {}
+struct CMsgSOMultipleObjectsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOMultipleObjectsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOMultipleObjectsDefaultTypeInternal() {}
+  union {
+    CMsgSOMultipleObjects _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOMultipleObjectsDefaultTypeInternal _CMsgSOMultipleObjects_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOCacheSubscribed_SubscribedType::CMsgSOCacheSubscribed_SubscribedType(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.object_data_)*/{}
+  , /*decltype(_impl_.type_id_)*/0} {}
+struct CMsgSOCacheSubscribed_SubscribedTypeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOCacheSubscribed_SubscribedTypeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOCacheSubscribed_SubscribedTypeDefaultTypeInternal() {}
+  union {
+    CMsgSOCacheSubscribed_SubscribedType _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOCacheSubscribed_SubscribedTypeDefaultTypeInternal _CMsgSOCacheSubscribed_SubscribedType_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOCacheSubscribed::CMsgSOCacheSubscribed(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.objects_)*/{}
+  , /*decltype(_impl_.service_list_)*/{}
+  , /*decltype(_impl_.owner_soid_)*/nullptr
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.sync_version_)*/uint64_t{0u}
+  , /*decltype(_impl_.service_id_)*/0u} {}
+struct CMsgSOCacheSubscribedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOCacheSubscribedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOCacheSubscribedDefaultTypeInternal() {}
+  union {
+    CMsgSOCacheSubscribed _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOCacheSubscribedDefaultTypeInternal _CMsgSOCacheSubscribed_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOCacheSubscribedUpToDate::CMsgSOCacheSubscribedUpToDate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.service_list_)*/{}
+  , /*decltype(_impl_.owner_soid_)*/nullptr
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.sync_version_)*/uint64_t{0u}
+  , /*decltype(_impl_.service_id_)*/0u} {}
+struct CMsgSOCacheSubscribedUpToDateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOCacheSubscribedUpToDateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOCacheSubscribedUpToDateDefaultTypeInternal() {}
+  union {
+    CMsgSOCacheSubscribedUpToDate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOCacheSubscribedUpToDateDefaultTypeInternal _CMsgSOCacheSubscribedUpToDate_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOCacheUnsubscribed::CMsgSOCacheUnsubscribed(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.owner_soid_)*/nullptr} {}
+struct CMsgSOCacheUnsubscribedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOCacheUnsubscribedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOCacheUnsubscribedDefaultTypeInternal() {}
+  union {
+    CMsgSOCacheUnsubscribed _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOCacheUnsubscribedDefaultTypeInternal _CMsgSOCacheUnsubscribed_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOCacheSubscriptionCheck::CMsgSOCacheSubscriptionCheck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.service_list_)*/{}
+  , /*decltype(_impl_.owner_soid_)*/nullptr
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.sync_version_)*/uint64_t{0u}
+  , /*decltype(_impl_.service_id_)*/0u} {}
+struct CMsgSOCacheSubscriptionCheckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOCacheSubscriptionCheckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOCacheSubscriptionCheckDefaultTypeInternal() {}
+  union {
+    CMsgSOCacheSubscriptionCheck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOCacheSubscriptionCheckDefaultTypeInternal _CMsgSOCacheSubscriptionCheck_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOCacheSubscriptionRefresh::CMsgSOCacheSubscriptionRefresh(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.owner_soid_)*/nullptr} {}
+struct CMsgSOCacheSubscriptionRefreshDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOCacheSubscriptionRefreshDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOCacheSubscriptionRefreshDefaultTypeInternal() {}
+  union {
+    CMsgSOCacheSubscriptionRefresh _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOCacheSubscriptionRefreshDefaultTypeInternal _CMsgSOCacheSubscriptionRefresh_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOCacheVersion::CMsgSOCacheVersion(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}} {}
+struct CMsgSOCacheVersionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOCacheVersionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOCacheVersionDefaultTypeInternal() {}
+  union {
+    CMsgSOCacheVersion _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOCacheVersionDefaultTypeInternal _CMsgSOCacheVersion_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCMultiplexMessage::CMsgGCMultiplexMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.steamids_)*/{}
+  , /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msgtype_)*/0u} {}
+struct CMsgGCMultiplexMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCMultiplexMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCMultiplexMessageDefaultTypeInternal() {}
+  union {
+    CMsgGCMultiplexMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCMultiplexMessageDefaultTypeInternal _CMsgGCMultiplexMessage_default_instance_;
+PROTOBUF_CONSTEXPR CGCToGCMsgMasterAck_Process::CGCToGCMsgMasterAck_Process(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.type_instances_)*/{}
+  , /*decltype(_impl_.dir_index_)*/0u} {}
+struct CGCToGCMsgMasterAck_ProcessDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CGCToGCMsgMasterAck_ProcessDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CGCToGCMsgMasterAck_ProcessDefaultTypeInternal() {}
+  union {
+    CGCToGCMsgMasterAck_Process _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CGCToGCMsgMasterAck_ProcessDefaultTypeInternal _CGCToGCMsgMasterAck_Process_default_instance_;
+PROTOBUF_CONSTEXPR CGCToGCMsgMasterAck::CGCToGCMsgMasterAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.directory_)*/{}
+  , /*decltype(_impl_.machine_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.process_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.dir_index_)*/0u} {}
+struct CGCToGCMsgMasterAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CGCToGCMsgMasterAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CGCToGCMsgMasterAckDefaultTypeInternal() {}
+  union {
+    CGCToGCMsgMasterAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CGCToGCMsgMasterAckDefaultTypeInternal _CGCToGCMsgMasterAck_default_instance_;
+PROTOBUF_CONSTEXPR CGCToGCMsgMasterAck_Response::CGCToGCMsgMasterAck_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.eresult_)*/2} {}
+struct CGCToGCMsgMasterAck_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CGCToGCMsgMasterAck_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CGCToGCMsgMasterAck_ResponseDefaultTypeInternal() {}
+  union {
+    CGCToGCMsgMasterAck_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CGCToGCMsgMasterAck_ResponseDefaultTypeInternal _CGCToGCMsgMasterAck_Response_default_instance_;
+PROTOBUF_CONSTEXPR CGCToGCMsgMasterStartupComplete_GCInfo::CGCToGCMsgMasterStartupComplete_GCInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.machine_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.dir_index_)*/0u} {}
+struct CGCToGCMsgMasterStartupComplete_GCInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CGCToGCMsgMasterStartupComplete_GCInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CGCToGCMsgMasterStartupComplete_GCInfoDefaultTypeInternal() {}
+  union {
+    CGCToGCMsgMasterStartupComplete_GCInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CGCToGCMsgMasterStartupComplete_GCInfoDefaultTypeInternal _CGCToGCMsgMasterStartupComplete_GCInfo_default_instance_;
+PROTOBUF_CONSTEXPR CGCToGCMsgMasterStartupComplete::CGCToGCMsgMasterStartupComplete(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.gc_info_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CGCToGCMsgMasterStartupCompleteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CGCToGCMsgMasterStartupCompleteDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CGCToGCMsgMasterStartupCompleteDefaultTypeInternal() {}
+  union {
+    CGCToGCMsgMasterStartupComplete _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CGCToGCMsgMasterStartupCompleteDefaultTypeInternal _CGCToGCMsgMasterStartupComplete_default_instance_;
+PROTOBUF_CONSTEXPR CGCToGCMsgRouted::CGCToGCMsgRouted(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.net_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sender_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.msg_type_)*/0u} {}
+struct CGCToGCMsgRoutedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CGCToGCMsgRoutedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CGCToGCMsgRoutedDefaultTypeInternal() {}
+  union {
+    CGCToGCMsgRouted _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CGCToGCMsgRoutedDefaultTypeInternal _CGCToGCMsgRouted_default_instance_;
+PROTOBUF_CONSTEXPR CGCToGCMsgRoutedReply::CGCToGCMsgRoutedReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.net_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_type_)*/0u} {}
+struct CGCToGCMsgRoutedReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CGCToGCMsgRoutedReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CGCToGCMsgRoutedReplyDefaultTypeInternal() {}
+  union {
+    CGCToGCMsgRoutedReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CGCToGCMsgRoutedReplyDefaultTypeInternal _CGCToGCMsgRoutedReply_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.steamid_)*/uint64_t{0u}
+  , /*decltype(_impl_.ip_)*/0u
+  , /*decltype(_impl_.trusted_)*/false} {}
+struct CMsgGCUpdateSubGCSessionInfo_CMsgUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCUpdateSubGCSessionInfo_CMsgUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCUpdateSubGCSessionInfo_CMsgUpdateDefaultTypeInternal() {}
+  union {
+    CMsgGCUpdateSubGCSessionInfo_CMsgUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCUpdateSubGCSessionInfo_CMsgUpdateDefaultTypeInternal _CMsgGCUpdateSubGCSessionInfo_CMsgUpdate_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCUpdateSubGCSessionInfo::CMsgGCUpdateSubGCSessionInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.updates_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CMsgGCUpdateSubGCSessionInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCUpdateSubGCSessionInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCUpdateSubGCSessionInfoDefaultTypeInternal() {}
+  union {
+    CMsgGCUpdateSubGCSessionInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCUpdateSubGCSessionInfoDefaultTypeInternal _CMsgGCUpdateSubGCSessionInfo_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCRequestSubGCSessionInfo::CMsgGCRequestSubGCSessionInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.steamid_)*/uint64_t{0u}} {}
+struct CMsgGCRequestSubGCSessionInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCRequestSubGCSessionInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCRequestSubGCSessionInfoDefaultTypeInternal() {}
+  union {
+    CMsgGCRequestSubGCSessionInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCRequestSubGCSessionInfoDefaultTypeInternal _CMsgGCRequestSubGCSessionInfo_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCRequestSubGCSessionInfoResponse::CMsgGCRequestSubGCSessionInfoResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ip_)*/0u
+  , /*decltype(_impl_.trusted_)*/false} {}
+struct CMsgGCRequestSubGCSessionInfoResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCRequestSubGCSessionInfoResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCRequestSubGCSessionInfoResponseDefaultTypeInternal() {}
+  union {
+    CMsgGCRequestSubGCSessionInfoResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCRequestSubGCSessionInfoResponseDefaultTypeInternal _CMsgGCRequestSubGCSessionInfoResponse_default_instance_;
+PROTOBUF_CONSTEXPR CMsgSOCacheHaveVersion::CMsgSOCacheHaveVersion(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.soid_)*/nullptr
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.service_id_)*/0u
+  , /*decltype(_impl_.cached_file_version_)*/0u} {}
+struct CMsgSOCacheHaveVersionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgSOCacheHaveVersionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgSOCacheHaveVersionDefaultTypeInternal() {}
+  union {
+    CMsgSOCacheHaveVersion _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgSOCacheHaveVersionDefaultTypeInternal _CMsgSOCacheHaveVersion_default_instance_;
+PROTOBUF_CONSTEXPR CMsgClientHello::CMsgClientHello(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.socache_have_versions_)*/{}
+  , /*decltype(_impl_.secret_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_)*/0u
+  , /*decltype(_impl_.client_session_need_)*/0u
+  , /*decltype(_impl_.client_launcher_)*/0
+  , /*decltype(_impl_.client_language_)*/0u
+  , /*decltype(_impl_.engine_)*/0} {}
+struct CMsgClientHelloDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgClientHelloDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgClientHelloDefaultTypeInternal() {}
+  union {
+    CMsgClientHello _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgClientHelloDefaultTypeInternal _CMsgClientHello_default_instance_;
+PROTOBUF_CONSTEXPR CMsgClientWelcome_Location::CMsgClientWelcome_Location(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.country_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.latitude_)*/0
+  , /*decltype(_impl_.longitude_)*/0} {}
+struct CMsgClientWelcome_LocationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgClientWelcome_LocationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgClientWelcome_LocationDefaultTypeInternal() {}
+  union {
+    CMsgClientWelcome_Location _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgClientWelcome_LocationDefaultTypeInternal _CMsgClientWelcome_Location_default_instance_;
+PROTOBUF_CONSTEXPR CMsgClientWelcome::CMsgClientWelcome(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.outofdate_subscribed_caches_)*/{}
+  , /*decltype(_impl_.uptodate_subscribed_caches_)*/{}
+  , /*decltype(_impl_.game_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.save_game_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.location_)*/nullptr
+  , /*decltype(_impl_.version_)*/0u} {}
+struct CMsgClientWelcomeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgClientWelcomeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgClientWelcomeDefaultTypeInternal() {}
+  union {
+    CMsgClientWelcome _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgClientWelcomeDefaultTypeInternal _CMsgClientWelcome_default_instance_;
+PROTOBUF_CONSTEXPR CMsgConnectionStatus::CMsgConnectionStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.client_session_need_)*/0u
+  , /*decltype(_impl_.queue_position_)*/0
+  , /*decltype(_impl_.queue_size_)*/0
+  , /*decltype(_impl_.wait_seconds_)*/0
+  , /*decltype(_impl_.estimated_wait_seconds_remaining_)*/0} {}
+struct CMsgConnectionStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgConnectionStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgConnectionStatusDefaultTypeInternal() {}
+  union {
+    CMsgConnectionStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgConnectionStatusDefaultTypeInternal _CMsgConnectionStatus_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.service_id_)*/0u} {}
+struct CMsgGCToGCSOCacheSubscribe_CMsgHaveVersionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCToGCSOCacheSubscribe_CMsgHaveVersionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCToGCSOCacheSubscribe_CMsgHaveVersionsDefaultTypeInternal() {}
+  union {
+    CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCToGCSOCacheSubscribe_CMsgHaveVersionsDefaultTypeInternal _CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCToGCSOCacheSubscribe::CMsgGCToGCSOCacheSubscribe(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.have_versions_)*/{}
+  , /*decltype(_impl_.subscriber_)*/uint64_t{0u}
+  , /*decltype(_impl_.subscribe_to_)*/uint64_t{0u}
+  , /*decltype(_impl_.sync_version_)*/uint64_t{0u}} {}
+struct CMsgGCToGCSOCacheSubscribeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCToGCSOCacheSubscribeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCToGCSOCacheSubscribeDefaultTypeInternal() {}
+  union {
+    CMsgGCToGCSOCacheSubscribe _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCToGCSOCacheSubscribeDefaultTypeInternal _CMsgGCToGCSOCacheSubscribe_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCToGCSOCacheUnsubscribe::CMsgGCToGCSOCacheUnsubscribe(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.subscriber_)*/uint64_t{0u}
+  , /*decltype(_impl_.unsubscribe_from_)*/uint64_t{0u}} {}
+struct CMsgGCToGCSOCacheUnsubscribeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCToGCSOCacheUnsubscribeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCToGCSOCacheUnsubscribeDefaultTypeInternal() {}
+  union {
+    CMsgGCToGCSOCacheUnsubscribe _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCToGCSOCacheUnsubscribeDefaultTypeInternal _CMsgGCToGCSOCacheUnsubscribe_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCClientPing::CMsgGCClientPing(
+    ::_pbi::ConstantInitialized) {}
+struct CMsgGCClientPingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCClientPingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCClientPingDefaultTypeInternal() {}
+  union {
+    CMsgGCClientPing _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCClientPingDefaultTypeInternal _CMsgGCClientPing_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCToGCLoadSessionSOCache::CMsgGCToGCLoadSessionSOCache(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.account_id_)*/0u} {}
+struct CMsgGCToGCLoadSessionSOCacheDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCToGCLoadSessionSOCacheDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCToGCLoadSessionSOCacheDefaultTypeInternal() {}
+  union {
+    CMsgGCToGCLoadSessionSOCache _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCToGCLoadSessionSOCacheDefaultTypeInternal _CMsgGCToGCLoadSessionSOCache_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCToGCLoadSessionSOCacheResponse::CMsgGCToGCLoadSessionSOCacheResponse(
+    ::_pbi::ConstantInitialized) {}
+struct CMsgGCToGCLoadSessionSOCacheResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCToGCLoadSessionSOCacheResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCToGCLoadSessionSOCacheResponseDefaultTypeInternal() {}
+  union {
+    CMsgGCToGCLoadSessionSOCacheResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCToGCLoadSessionSOCacheResponseDefaultTypeInternal _CMsgGCToGCLoadSessionSOCacheResponse_default_instance_;
+PROTOBUF_CONSTEXPR CMsgGCToGCUpdateSessionStats::CMsgGCToGCUpdateSessionStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.user_sessions_)*/0u
+  , /*decltype(_impl_.server_sessions_)*/0u
+  , /*decltype(_impl_.in_logon_surge_)*/false} {}
+struct CMsgGCToGCUpdateSessionStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgGCToGCUpdateSessionStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgGCToGCUpdateSessionStatsDefaultTypeInternal() {}
+  union {
+    CMsgGCToGCUpdateSessionStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgGCToGCUpdateSessionStatsDefaultTypeInternal _CMsgGCToGCUpdateSessionStats_default_instance_;
+PROTOBUF_CONSTEXPR CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.item_description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.gameitemid_)*/0u} {}
+struct CWorkshop_PopulateItemDescriptions_Request_SingleItemDescriptionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CWorkshop_PopulateItemDescriptions_Request_SingleItemDescriptionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CWorkshop_PopulateItemDescriptions_Request_SingleItemDescriptionDefaultTypeInternal() {}
+  union {
+    CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CWorkshop_PopulateItemDescriptions_Request_SingleItemDescriptionDefaultTypeInternal _CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription_default_instance_;
+PROTOBUF_CONSTEXPR CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.descriptions_)*/{}
+  , /*decltype(_impl_.language_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlockDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlockDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlockDefaultTypeInternal() {}
+  union {
+    CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlockDefaultTypeInternal _CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock_default_instance_;
+PROTOBUF_CONSTEXPR CWorkshop_PopulateItemDescriptions_Request::CWorkshop_PopulateItemDescriptions_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.languages_)*/{}
+  , /*decltype(_impl_.appid_)*/0u} {}
+struct CWorkshop_PopulateItemDescriptions_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CWorkshop_PopulateItemDescriptions_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CWorkshop_PopulateItemDescriptions_RequestDefaultTypeInternal() {}
+  union {
+    CWorkshop_PopulateItemDescriptions_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CWorkshop_PopulateItemDescriptions_RequestDefaultTypeInternal _CWorkshop_PopulateItemDescriptions_Request_default_instance_;
+PROTOBUF_CONSTEXPR CWorkshop_GetContributors_Request::CWorkshop_GetContributors_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.appid_)*/0u
+  , /*decltype(_impl_.gameitemid_)*/0u} {}
+struct CWorkshop_GetContributors_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CWorkshop_GetContributors_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CWorkshop_GetContributors_RequestDefaultTypeInternal() {}
+  union {
+    CWorkshop_GetContributors_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CWorkshop_GetContributors_RequestDefaultTypeInternal _CWorkshop_GetContributors_Request_default_instance_;
+PROTOBUF_CONSTEXPR CWorkshop_GetContributors_Response::CWorkshop_GetContributors_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.contributors_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CWorkshop_GetContributors_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CWorkshop_GetContributors_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CWorkshop_GetContributors_ResponseDefaultTypeInternal() {}
+  union {
+    CWorkshop_GetContributors_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CWorkshop_GetContributors_ResponseDefaultTypeInternal _CWorkshop_GetContributors_Response_default_instance_;
+PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.rule_description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.workshop_file_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.revenue_percentage_)*/0} {}
+struct CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRuleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRuleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRuleDefaultTypeInternal() {}
+  union {
+    CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRuleDefaultTypeInternal _CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule_default_instance_;
+PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.rule_description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.account_id_)*/0u
+  , /*decltype(_impl_.revenue_percentage_)*/0} {}
+struct CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRuleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRuleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRuleDefaultTypeInternal() {}
+  union {
+    CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRuleDefaultTypeInternal _CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule_default_instance_;
+PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Request::CWorkshop_SetItemPaymentRules_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.associated_workshop_files_)*/{}
+  , /*decltype(_impl_.partner_accounts_)*/{}
+  , /*decltype(_impl_.appid_)*/0u
+  , /*decltype(_impl_.gameitemid_)*/0u} {}
+struct CWorkshop_SetItemPaymentRules_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CWorkshop_SetItemPaymentRules_RequestDefaultTypeInternal() {}
+  union {
+    CWorkshop_SetItemPaymentRules_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CWorkshop_SetItemPaymentRules_RequestDefaultTypeInternal _CWorkshop_SetItemPaymentRules_Request_default_instance_;
+PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Response::CWorkshop_SetItemPaymentRules_Response(
+    ::_pbi::ConstantInitialized) {}
+struct CWorkshop_SetItemPaymentRules_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CWorkshop_SetItemPaymentRules_ResponseDefaultTypeInternal() {}
+  union {
+    CWorkshop_SetItemPaymentRules_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CWorkshop_SetItemPaymentRules_ResponseDefaultTypeInternal _CWorkshop_SetItemPaymentRules_Response_default_instance_;
+PROTOBUF_CONSTEXPR CBroadcast_PostGameDataFrame_Request::CBroadcast_PostGameDataFrame_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.frame_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.steamid_)*/uint64_t{0u}
+  , /*decltype(_impl_.broadcast_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.appid_)*/0u} {}
+struct CBroadcast_PostGameDataFrame_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CBroadcast_PostGameDataFrame_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CBroadcast_PostGameDataFrame_RequestDefaultTypeInternal() {}
+  union {
+    CBroadcast_PostGameDataFrame_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CBroadcast_PostGameDataFrame_RequestDefaultTypeInternal _CBroadcast_PostGameDataFrame_Request_default_instance_;
+static ::_pb::Metadata file_level_metadata_gcsdk_5fgcmessages_2eproto[46];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_gcsdk_5fgcmessages_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_gcsdk_5fgcmessages_2eproto = nullptr;
+
+const uint32_t TableStruct_gcsdk_5fgcmessages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::CMsgSHA1Digest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSHA1Digest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSHA1Digest, _impl_.block1_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSHA1Digest, _impl_.block2_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSHA1Digest, _impl_.block3_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOIDOwner, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOIDOwner, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOIDOwner, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOIDOwner, _impl_.id_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOSingleObject, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOSingleObject, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOSingleObject, _impl_.type_id_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOSingleObject, _impl_.object_data_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOSingleObject, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOSingleObject, _impl_.owner_soid_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOSingleObject, _impl_.service_id_),
+  3,
+  0,
+  2,
+  1,
+  4,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects_SingleObject, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects_SingleObject, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects_SingleObject, _impl_.type_id_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects_SingleObject, _impl_.object_data_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects, _impl_.objects_modified_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects, _impl_.objects_added_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects, _impl_.objects_removed_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects, _impl_.owner_soid_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOMultipleObjects, _impl_.service_id_),
+  ~0u,
+  1,
+  ~0u,
+  ~0u,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed_SubscribedType, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed_SubscribedType, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed_SubscribedType, _impl_.type_id_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed_SubscribedType, _impl_.object_data_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed, _impl_.objects_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed, _impl_.owner_soid_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed, _impl_.service_id_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed, _impl_.service_list_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribed, _impl_.sync_version_),
+  ~0u,
+  1,
+  0,
+  3,
+  ~0u,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribedUpToDate, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribedUpToDate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribedUpToDate, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribedUpToDate, _impl_.owner_soid_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribedUpToDate, _impl_.service_id_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribedUpToDate, _impl_.service_list_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscribedUpToDate, _impl_.sync_version_),
+  1,
+  0,
+  3,
+  ~0u,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheUnsubscribed, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheUnsubscribed, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheUnsubscribed, _impl_.owner_soid_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionCheck, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionCheck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionCheck, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionCheck, _impl_.owner_soid_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionCheck, _impl_.service_id_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionCheck, _impl_.service_list_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionCheck, _impl_.sync_version_),
+  1,
+  0,
+  3,
+  ~0u,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionRefresh, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionRefresh, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheSubscriptionRefresh, _impl_.owner_soid_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheVersion, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheVersion, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheVersion, _impl_.version_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CMsgGCMultiplexMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCMultiplexMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCMultiplexMessage, _impl_.msgtype_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCMultiplexMessage, _impl_.payload_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCMultiplexMessage, _impl_.steamids_),
+  1,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck_Process, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck_Process, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck_Process, _impl_.dir_index_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck_Process, _impl_.type_instances_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck, _impl_.dir_index_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck, _impl_.machine_name_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck, _impl_.process_name_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck, _impl_.directory_),
+  2,
+  0,
+  1,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterAck_Response, _impl_.eresult_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterStartupComplete_GCInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterStartupComplete_GCInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterStartupComplete_GCInfo, _impl_.dir_index_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterStartupComplete_GCInfo, _impl_.machine_name_),
+  1,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterStartupComplete, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgMasterStartupComplete, _impl_.gc_info_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgRouted, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgRouted, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgRouted, _impl_.msg_type_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgRouted, _impl_.sender_id_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgRouted, _impl_.net_message_),
+  2,
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgRoutedReply, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgRoutedReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgRoutedReply, _impl_.msg_type_),
+  PROTOBUF_FIELD_OFFSET(::CGCToGCMsgRoutedReply, _impl_.net_message_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate, _impl_.steamid_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate, _impl_.trusted_),
+  0,
+  1,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCUpdateSubGCSessionInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCUpdateSubGCSessionInfo, _impl_.updates_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCRequestSubGCSessionInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCRequestSubGCSessionInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCRequestSubGCSessionInfo, _impl_.steamid_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CMsgGCRequestSubGCSessionInfoResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCRequestSubGCSessionInfoResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCRequestSubGCSessionInfoResponse, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCRequestSubGCSessionInfoResponse, _impl_.trusted_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheHaveVersion, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheHaveVersion, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheHaveVersion, _impl_.soid_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheHaveVersion, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheHaveVersion, _impl_.service_id_),
+  PROTOBUF_FIELD_OFFSET(::CMsgSOCacheHaveVersion, _impl_.cached_file_version_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::CMsgClientHello, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientHello, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgClientHello, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientHello, _impl_.socache_have_versions_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientHello, _impl_.client_session_need_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientHello, _impl_.client_launcher_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientHello, _impl_.secret_key_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientHello, _impl_.client_language_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientHello, _impl_.engine_),
+  1,
+  ~0u,
+  2,
+  3,
+  0,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome_Location, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome_Location, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome_Location, _impl_.latitude_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome_Location, _impl_.longitude_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome_Location, _impl_.country_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome, _impl_.game_data_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome, _impl_.outofdate_subscribed_caches_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome, _impl_.uptodate_subscribed_caches_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome, _impl_.location_),
+  PROTOBUF_FIELD_OFFSET(::CMsgClientWelcome, _impl_.save_game_key_),
+  3,
+  0,
+  ~0u,
+  ~0u,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CMsgConnectionStatus, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgConnectionStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgConnectionStatus, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::CMsgConnectionStatus, _impl_.client_session_need_),
+  PROTOBUF_FIELD_OFFSET(::CMsgConnectionStatus, _impl_.queue_position_),
+  PROTOBUF_FIELD_OFFSET(::CMsgConnectionStatus, _impl_.queue_size_),
+  PROTOBUF_FIELD_OFFSET(::CMsgConnectionStatus, _impl_.wait_seconds_),
+  PROTOBUF_FIELD_OFFSET(::CMsgConnectionStatus, _impl_.estimated_wait_seconds_remaining_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions, _impl_.service_id_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions, _impl_.version_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe, _impl_.subscriber_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe, _impl_.subscribe_to_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe, _impl_.sync_version_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheSubscribe, _impl_.have_versions_),
+  0,
+  1,
+  2,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheUnsubscribe, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheUnsubscribe, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheUnsubscribe, _impl_.subscriber_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCSOCacheUnsubscribe, _impl_.unsubscribe_from_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCClientPing, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCLoadSessionSOCache, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCLoadSessionSOCache, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCLoadSessionSOCache, _impl_.account_id_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCLoadSessionSOCacheResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCUpdateSessionStats, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCUpdateSessionStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCUpdateSessionStats, _impl_.user_sessions_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCUpdateSessionStats, _impl_.server_sessions_),
+  PROTOBUF_FIELD_OFFSET(::CMsgGCToGCUpdateSessionStats, _impl_.in_logon_surge_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription, _impl_.gameitemid_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription, _impl_.item_description_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock, _impl_.language_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock, _impl_.descriptions_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request, _impl_.appid_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_PopulateItemDescriptions_Request, _impl_.languages_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_GetContributors_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_GetContributors_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_GetContributors_Request, _impl_.appid_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_GetContributors_Request, _impl_.gameitemid_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_GetContributors_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_GetContributors_Response, _impl_.contributors_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule, _impl_.workshop_file_id_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule, _impl_.revenue_percentage_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule, _impl_.rule_description_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule, _impl_.account_id_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule, _impl_.revenue_percentage_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule, _impl_.rule_description_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request, _impl_.appid_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request, _impl_.gameitemid_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request, _impl_.associated_workshop_files_),
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Request, _impl_.partner_accounts_),
+  0,
+  1,
+  ~0u,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CWorkshop_SetItemPaymentRules_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CBroadcast_PostGameDataFrame_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CBroadcast_PostGameDataFrame_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CBroadcast_PostGameDataFrame_Request, _impl_.appid_),
+  PROTOBUF_FIELD_OFFSET(::CBroadcast_PostGameDataFrame_Request, _impl_.steamid_),
+  PROTOBUF_FIELD_OFFSET(::CBroadcast_PostGameDataFrame_Request, _impl_.broadcast_id_),
+  PROTOBUF_FIELD_OFFSET(::CBroadcast_PostGameDataFrame_Request, _impl_.frame_data_),
+  3,
+  1,
+  2,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::CMsgSHA1Digest)},
+  { 12, 20, -1, sizeof(::CMsgSOIDOwner)},
+  { 22, 33, -1, sizeof(::CMsgSOSingleObject)},
+  { 38, 46, -1, sizeof(::CMsgSOMultipleObjects_SingleObject)},
+  { 48, 60, -1, sizeof(::CMsgSOMultipleObjects)},
+  { 66, 74, -1, sizeof(::CMsgSOCacheSubscribed_SubscribedType)},
+  { 76, 88, -1, sizeof(::CMsgSOCacheSubscribed)},
+  { 94, 105, -1, sizeof(::CMsgSOCacheSubscribedUpToDate)},
+  { 110, 117, -1, sizeof(::CMsgSOCacheUnsubscribed)},
+  { 118, 129, -1, sizeof(::CMsgSOCacheSubscriptionCheck)},
+  { 134, 141, -1, sizeof(::CMsgSOCacheSubscriptionRefresh)},
+  { 142, 149, -1, sizeof(::CMsgSOCacheVersion)},
+  { 150, 159, -1, sizeof(::CMsgGCMultiplexMessage)},
+  { 162, 170, -1, sizeof(::CGCToGCMsgMasterAck_Process)},
+  { 172, 182, -1, sizeof(::CGCToGCMsgMasterAck)},
+  { 186, 193, -1, sizeof(::CGCToGCMsgMasterAck_Response)},
+  { 194, 202, -1, sizeof(::CGCToGCMsgMasterStartupComplete_GCInfo)},
+  { 204, -1, -1, sizeof(::CGCToGCMsgMasterStartupComplete)},
+  { 211, 220, -1, sizeof(::CGCToGCMsgRouted)},
+  { 223, 231, -1, sizeof(::CGCToGCMsgRoutedReply)},
+  { 233, 242, -1, sizeof(::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate)},
+  { 245, -1, -1, sizeof(::CMsgGCUpdateSubGCSessionInfo)},
+  { 252, 259, -1, sizeof(::CMsgGCRequestSubGCSessionInfo)},
+  { 260, 268, -1, sizeof(::CMsgGCRequestSubGCSessionInfoResponse)},
+  { 270, 280, -1, sizeof(::CMsgSOCacheHaveVersion)},
+  { 284, 297, -1, sizeof(::CMsgClientHello)},
+  { 304, 313, -1, sizeof(::CMsgClientWelcome_Location)},
+  { 316, 328, -1, sizeof(::CMsgClientWelcome)},
+  { 334, 346, -1, sizeof(::CMsgConnectionStatus)},
+  { 352, 360, -1, sizeof(::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions)},
+  { 362, 372, -1, sizeof(::CMsgGCToGCSOCacheSubscribe)},
+  { 376, 384, -1, sizeof(::CMsgGCToGCSOCacheUnsubscribe)},
+  { 386, -1, -1, sizeof(::CMsgGCClientPing)},
+  { 392, 399, -1, sizeof(::CMsgGCToGCLoadSessionSOCache)},
+  { 400, -1, -1, sizeof(::CMsgGCToGCLoadSessionSOCacheResponse)},
+  { 406, 415, -1, sizeof(::CMsgGCToGCUpdateSessionStats)},
+  { 418, 426, -1, sizeof(::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription)},
+  { 428, 436, -1, sizeof(::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock)},
+  { 438, 446, -1, sizeof(::CWorkshop_PopulateItemDescriptions_Request)},
+  { 448, 456, -1, sizeof(::CWorkshop_GetContributors_Request)},
+  { 458, -1, -1, sizeof(::CWorkshop_GetContributors_Response)},
+  { 465, 474, -1, sizeof(::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule)},
+  { 477, 486, -1, sizeof(::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule)},
+  { 489, 499, -1, sizeof(::CWorkshop_SetItemPaymentRules_Request)},
+  { 503, -1, -1, sizeof(::CWorkshop_SetItemPaymentRules_Response)},
+  { 509, 519, -1, sizeof(::CBroadcast_PostGameDataFrame_Request)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_CMsgSHA1Digest_default_instance_._instance,
+  &::_CMsgSOIDOwner_default_instance_._instance,
+  &::_CMsgSOSingleObject_default_instance_._instance,
+  &::_CMsgSOMultipleObjects_SingleObject_default_instance_._instance,
+  &::_CMsgSOMultipleObjects_default_instance_._instance,
+  &::_CMsgSOCacheSubscribed_SubscribedType_default_instance_._instance,
+  &::_CMsgSOCacheSubscribed_default_instance_._instance,
+  &::_CMsgSOCacheSubscribedUpToDate_default_instance_._instance,
+  &::_CMsgSOCacheUnsubscribed_default_instance_._instance,
+  &::_CMsgSOCacheSubscriptionCheck_default_instance_._instance,
+  &::_CMsgSOCacheSubscriptionRefresh_default_instance_._instance,
+  &::_CMsgSOCacheVersion_default_instance_._instance,
+  &::_CMsgGCMultiplexMessage_default_instance_._instance,
+  &::_CGCToGCMsgMasterAck_Process_default_instance_._instance,
+  &::_CGCToGCMsgMasterAck_default_instance_._instance,
+  &::_CGCToGCMsgMasterAck_Response_default_instance_._instance,
+  &::_CGCToGCMsgMasterStartupComplete_GCInfo_default_instance_._instance,
+  &::_CGCToGCMsgMasterStartupComplete_default_instance_._instance,
+  &::_CGCToGCMsgRouted_default_instance_._instance,
+  &::_CGCToGCMsgRoutedReply_default_instance_._instance,
+  &::_CMsgGCUpdateSubGCSessionInfo_CMsgUpdate_default_instance_._instance,
+  &::_CMsgGCUpdateSubGCSessionInfo_default_instance_._instance,
+  &::_CMsgGCRequestSubGCSessionInfo_default_instance_._instance,
+  &::_CMsgGCRequestSubGCSessionInfoResponse_default_instance_._instance,
+  &::_CMsgSOCacheHaveVersion_default_instance_._instance,
+  &::_CMsgClientHello_default_instance_._instance,
+  &::_CMsgClientWelcome_Location_default_instance_._instance,
+  &::_CMsgClientWelcome_default_instance_._instance,
+  &::_CMsgConnectionStatus_default_instance_._instance,
+  &::_CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions_default_instance_._instance,
+  &::_CMsgGCToGCSOCacheSubscribe_default_instance_._instance,
+  &::_CMsgGCToGCSOCacheUnsubscribe_default_instance_._instance,
+  &::_CMsgGCClientPing_default_instance_._instance,
+  &::_CMsgGCToGCLoadSessionSOCache_default_instance_._instance,
+  &::_CMsgGCToGCLoadSessionSOCacheResponse_default_instance_._instance,
+  &::_CMsgGCToGCUpdateSessionStats_default_instance_._instance,
+  &::_CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription_default_instance_._instance,
+  &::_CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock_default_instance_._instance,
+  &::_CWorkshop_PopulateItemDescriptions_Request_default_instance_._instance,
+  &::_CWorkshop_GetContributors_Request_default_instance_._instance,
+  &::_CWorkshop_GetContributors_Response_default_instance_._instance,
+  &::_CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule_default_instance_._instance,
+  &::_CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule_default_instance_._instance,
+  &::_CWorkshop_SetItemPaymentRules_Request_default_instance_._instance,
+  &::_CWorkshop_SetItemPaymentRules_Response_default_instance_._instance,
+  &::_CBroadcast_PostGameDataFrame_Request_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_gcsdk_5fgcmessages_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026gcsdk_gcmessages.proto\032\023steammessages."
+  "proto\"@\n\016CMsgSHA1Digest\022\016\n\006block1\030\001 \002(\006\022"
+  "\016\n\006block2\030\002 \002(\006\022\016\n\006block3\030\003 \002(\007\")\n\rCMsgS"
+  "OIDOwner\022\014\n\004type\030\001 \001(\r\022\n\n\002id\030\002 \001(\004\"\203\001\n\022C"
+  "MsgSOSingleObject\022\017\n\007type_id\030\002 \001(\005\022\023\n\013ob"
+  "ject_data\030\003 \001(\014\022\017\n\007version\030\004 \001(\006\022\"\n\nowne"
+  "r_soid\030\005 \001(\0132\016.CMsgSOIDOwner\022\022\n\nservice_"
+  "id\030\006 \001(\r\"\333\002\n\025CMsgSOMultipleObjects\022=\n\020ob"
+  "jects_modified\030\002 \003(\0132#.CMsgSOMultipleObj"
+  "ects.SingleObject\022\017\n\007version\030\003 \001(\006\022:\n\rob"
+  "jects_added\030\004 \003(\0132#.CMsgSOMultipleObject"
+  "s.SingleObject\022<\n\017objects_removed\030\005 \003(\0132"
+  "#.CMsgSOMultipleObjects.SingleObject\022\"\n\n"
+  "owner_soid\030\006 \001(\0132\016.CMsgSOIDOwner\022\022\n\nserv"
+  "ice_id\030\007 \001(\r\032@\n\014SingleObject\022\017\n\007type_id\030"
+  "\001 \001(\005\022\023\n\013object_data\030\002 \001(\014:\n\200\246\035\200\002\210\246\035\200\010\"\374"
+  "\001\n\025CMsgSOCacheSubscribed\0226\n\007objects\030\002 \003("
+  "\0132%.CMsgSOCacheSubscribed.SubscribedType"
+  "\022\017\n\007version\030\003 \001(\006\022\"\n\nowner_soid\030\004 \001(\0132\016."
+  "CMsgSOIDOwner\022\022\n\nservice_id\030\005 \001(\r\022\024\n\014ser"
+  "vice_list\030\006 \003(\r\022\024\n\014sync_version\030\007 \001(\006\0326\n"
+  "\016SubscribedType\022\017\n\007type_id\030\001 \001(\005\022\023\n\013obje"
+  "ct_data\030\002 \003(\014\"\224\001\n\035CMsgSOCacheSubscribedU"
+  "pToDate\022\017\n\007version\030\001 \001(\006\022\"\n\nowner_soid\030\002"
+  " \001(\0132\016.CMsgSOIDOwner\022\022\n\nservice_id\030\003 \001(\r"
+  "\022\024\n\014service_list\030\004 \003(\r\022\024\n\014sync_version\030\005"
+  " \001(\006\"=\n\027CMsgSOCacheUnsubscribed\022\"\n\nowner"
+  "_soid\030\002 \001(\0132\016.CMsgSOIDOwner\"\223\001\n\034CMsgSOCa"
+  "cheSubscriptionCheck\022\017\n\007version\030\002 \001(\006\022\"\n"
+  "\nowner_soid\030\003 \001(\0132\016.CMsgSOIDOwner\022\022\n\nser"
+  "vice_id\030\004 \001(\r\022\024\n\014service_list\030\005 \003(\r\022\024\n\014s"
+  "ync_version\030\006 \001(\006\"D\n\036CMsgSOCacheSubscrip"
+  "tionRefresh\022\"\n\nowner_soid\030\002 \001(\0132\016.CMsgSO"
+  "IDOwner\"%\n\022CMsgSOCacheVersion\022\017\n\007version"
+  "\030\001 \001(\006\"L\n\026CMsgGCMultiplexMessage\022\017\n\007msgt"
+  "ype\030\001 \001(\r\022\017\n\007payload\030\002 \001(\014\022\020\n\010steamids\030\003"
+  " \003(\006\"\273\001\n\023CGCToGCMsgMasterAck\022\021\n\tdir_inde"
+  "x\030\001 \001(\r\022\024\n\014machine_name\030\003 \001(\t\022\024\n\014process"
+  "_name\030\004 \001(\t\022/\n\tdirectory\030\006 \003(\0132\034.CGCToGC"
+  "MsgMasterAck.Process\0324\n\007Process\022\021\n\tdir_i"
+  "ndex\030\001 \001(\r\022\026\n\016type_instances\030\002 \003(\r\"2\n\034CG"
+  "CToGCMsgMasterAck_Response\022\022\n\007eresult\030\001 "
+  "\001(\005:\0012\"\216\001\n\037CGCToGCMsgMasterStartupComple"
+  "te\0228\n\007gc_info\030\001 \003(\0132\'.CGCToGCMsgMasterSt"
+  "artupComplete.GCInfo\0321\n\006GCInfo\022\021\n\tdir_in"
+  "dex\030\001 \001(\r\022\024\n\014machine_name\030\002 \001(\t\"L\n\020CGCTo"
+  "GCMsgRouted\022\020\n\010msg_type\030\001 \001(\r\022\021\n\tsender_"
+  "id\030\002 \001(\006\022\023\n\013net_message\030\003 \001(\014\">\n\025CGCToGC"
+  "MsgRoutedReply\022\020\n\010msg_type\030\001 \001(\r\022\023\n\013net_"
+  "message\030\002 \001(\014\"\225\001\n\034CMsgGCUpdateSubGCSessi"
+  "onInfo\0229\n\007updates\030\001 \003(\0132(.CMsgGCUpdateSu"
+  "bGCSessionInfo.CMsgUpdate\032:\n\nCMsgUpdate\022"
+  "\017\n\007steamid\030\001 \001(\006\022\n\n\002ip\030\002 \001(\007\022\017\n\007trusted\030"
+  "\003 \001(\010\"0\n\035CMsgGCRequestSubGCSessionInfo\022\017"
+  "\n\007steamid\030\001 \001(\006\"D\n%CMsgGCRequestSubGCSes"
+  "sionInfoResponse\022\n\n\002ip\030\001 \001(\007\022\017\n\007trusted\030"
+  "\002 \001(\010\"x\n\026CMsgSOCacheHaveVersion\022\034\n\004soid\030"
+  "\001 \001(\0132\016.CMsgSOIDOwner\022\017\n\007version\030\002 \001(\006\022\022"
+  "\n\nservice_id\030\003 \001(\r\022\033\n\023cached_file_versio"
+  "n\030\004 \001(\r\"\217\002\n\017CMsgClientHello\022\017\n\007version\030\001"
+  " \001(\r\0226\n\025socache_have_versions\030\002 \003(\0132\027.CM"
+  "sgSOCacheHaveVersion\022\033\n\023client_session_n"
+  "eed\030\003 \001(\r\022:\n\017client_launcher\030\004 \001(\0162\023.Par"
+  "tnerAccountType:\014PARTNER_NONE\022\022\n\nsecret_"
+  "key\030\005 \001(\t\022\027\n\017client_language\030\006 \001(\r\022-\n\006en"
+  "gine\030\007 \001(\0162\016.ESourceEngine:\rk_ESE_Source"
+  "1\"\277\002\n\021CMsgClientWelcome\022\017\n\007version\030\001 \001(\r"
+  "\022\021\n\tgame_data\030\002 \001(\014\022;\n\033outofdate_subscri"
+  "bed_caches\030\003 \003(\0132\026.CMsgSOCacheSubscribed"
+  "\022A\n\032uptodate_subscribed_caches\030\004 \003(\0132\035.C"
+  "MsgSOCacheSubscriptionCheck\022-\n\010location\030"
+  "\005 \001(\0132\033.CMsgClientWelcome.Location\022\025\n\rsa"
+  "ve_game_key\030\006 \001(\014\032@\n\010Location\022\020\n\010latitud"
+  "e\030\001 \001(\002\022\021\n\tlongitude\030\002 \001(\002\022\017\n\007country\030\003 "
+  "\001(\t\"\345\001\n\024CMsgConnectionStatus\022D\n\006status\030\001"
+  " \001(\0162\023.GCConnectionStatus:\037GCConnectionS"
+  "tatus_HAVE_SESSION\022\033\n\023client_session_nee"
+  "d\030\002 \001(\r\022\026\n\016queue_position\030\003 \001(\005\022\022\n\nqueue"
+  "_size\030\004 \001(\005\022\024\n\014wait_seconds\030\005 \001(\005\022(\n est"
+  "imated_wait_seconds_remaining\030\006 \001(\005\"\332\001\n\032"
+  "CMsgGCToGCSOCacheSubscribe\022\022\n\nsubscriber"
+  "\030\001 \001(\006\022\024\n\014subscribe_to\030\002 \001(\006\022\024\n\014sync_ver"
+  "sion\030\003 \001(\006\022C\n\rhave_versions\030\004 \003(\0132,.CMsg"
+  "GCToGCSOCacheSubscribe.CMsgHaveVersions\032"
+  "7\n\020CMsgHaveVersions\022\022\n\nservice_id\030\001 \001(\r\022"
+  "\017\n\007version\030\002 \001(\004\"L\n\034CMsgGCToGCSOCacheUns"
+  "ubscribe\022\022\n\nsubscriber\030\001 \001(\006\022\030\n\020unsubscr"
+  "ibe_from\030\002 \001(\006\"\022\n\020CMsgGCClientPing\"2\n\034CM"
+  "sgGCToGCLoadSessionSOCache\022\022\n\naccount_id"
+  "\030\001 \001(\r\"&\n$CMsgGCToGCLoadSessionSOCacheRe"
+  "sponse\"f\n\034CMsgGCToGCUpdateSessionStats\022\025"
+  "\n\ruser_sessions\030\001 \001(\r\022\027\n\017server_sessions"
+  "\030\002 \001(\r\022\026\n\016in_logon_surge\030\003 \001(\010\"\355\002\n*CWork"
+  "shop_PopulateItemDescriptions_Request\022\r\n"
+  "\005appid\030\001 \001(\r\022\\\n\tlanguages\030\002 \003(\0132I.CWorks"
+  "hop_PopulateItemDescriptions_Request.Ite"
+  "mDescriptionsLanguageBlock\032E\n\025SingleItem"
+  "Description\022\022\n\ngameitemid\030\001 \001(\r\022\030\n\020item_"
+  "description\030\002 \001(\t\032\212\001\n\035ItemDescriptionsLa"
+  "nguageBlock\022\020\n\010language\030\001 \001(\t\022W\n\014descrip"
+  "tions\030\002 \003(\0132A.CWorkshop_PopulateItemDesc"
+  "riptions_Request.SingleItemDescription\"F"
+  "\n!CWorkshop_GetContributors_Request\022\r\n\005a"
+  "ppid\030\001 \001(\r\022\022\n\ngameitemid\030\002 \001(\r\":\n\"CWorks"
+  "hop_GetContributors_Response\022\024\n\014contribu"
+  "tors\030\001 \003(\006\"\325\003\n%CWorkshop_SetItemPaymentR"
+  "ules_Request\022\r\n\005appid\030\001 \001(\r\022\022\n\ngameitemi"
+  "d\030\002 \001(\r\022a\n\031associated_workshop_files\030\003 \003"
+  "(\0132>.CWorkshop_SetItemPaymentRules_Reque"
+  "st.WorkshopItemPaymentRule\022W\n\020partner_ac"
+  "counts\030\004 \003(\0132=.CWorkshop_SetItemPaymentR"
+  "ules_Request.PartnerItemPaymentRule\032i\n\027W"
+  "orkshopItemPaymentRule\022\030\n\020workshop_file_"
+  "id\030\001 \001(\004\022\032\n\022revenue_percentage\030\002 \001(\002\022\030\n\020"
+  "rule_description\030\003 \001(\t\032b\n\026PartnerItemPay"
+  "mentRule\022\022\n\naccount_id\030\001 \001(\r\022\032\n\022revenue_"
+  "percentage\030\002 \001(\002\022\030\n\020rule_description\030\003 \001"
+  "(\t\"(\n&CWorkshop_SetItemPaymentRules_Resp"
+  "onse\"p\n$CBroadcast_PostGameDataFrame_Req"
+  "uest\022\r\n\005appid\030\001 \001(\r\022\017\n\007steamid\030\002 \001(\006\022\024\n\014"
+  "broadcast_id\030\003 \001(\006\022\022\n\nframe_data\030\004 \001(\014*5"
+  "\n\rESourceEngine\022\021\n\rk_ESE_Source1\020\000\022\021\n\rk_"
+  "ESE_Source2\020\001*i\n\022PartnerAccountType\022\020\n\014P"
+  "ARTNER_NONE\020\000\022\031\n\025PARTNER_PERFECT_WORLD\020\001"
+  "\022\021\n\rPARTNER_NEXON\020\002\022\023\n\017PARTNER_INVALID\020\003"
+  "*\367\001\n\022GCConnectionStatus\022#\n\037GCConnectionS"
+  "tatus_HAVE_SESSION\020\000\022$\n GCConnectionStat"
+  "us_GC_GOING_DOWN\020\001\022!\n\035GCConnectionStatus"
+  "_NO_SESSION\020\002\0220\n,GCConnectionStatus_NO_S"
+  "ESSION_IN_LOGON_QUEUE\020\003\022\037\n\033GCConnectionS"
+  "tatus_NO_STEAM\020\004\022 \n\034GCConnectionStatus_S"
+  "USPENDED\020\005B\005H\001\200\001\000"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_gcsdk_5fgcmessages_2eproto_deps[1] = {
+  &::descriptor_table_steammessages_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_gcsdk_5fgcmessages_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_gcsdk_5fgcmessages_2eproto = {
+    false, false, 5257, descriptor_table_protodef_gcsdk_5fgcmessages_2eproto,
+    "gcsdk_gcmessages.proto",
+    &descriptor_table_gcsdk_5fgcmessages_2eproto_once, descriptor_table_gcsdk_5fgcmessages_2eproto_deps, 1, 46,
+    schemas, file_default_instances, TableStruct_gcsdk_5fgcmessages_2eproto::offsets,
+    file_level_metadata_gcsdk_5fgcmessages_2eproto, file_level_enum_descriptors_gcsdk_5fgcmessages_2eproto,
+    file_level_service_descriptors_gcsdk_5fgcmessages_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_gcsdk_5fgcmessages_2eproto_getter() {
+  return &descriptor_table_gcsdk_5fgcmessages_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_gcsdk_5fgcmessages_2eproto(&descriptor_table_gcsdk_5fgcmessages_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ESourceEngine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gcsdk_5fgcmessages_2eproto);
+  return file_level_enum_descriptors_gcsdk_5fgcmessages_2eproto[0];
+}
+bool ESourceEngine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PartnerAccountType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gcsdk_5fgcmessages_2eproto);
+  return file_level_enum_descriptors_gcsdk_5fgcmessages_2eproto[1];
+}
+bool PartnerAccountType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GCConnectionStatus_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gcsdk_5fgcmessages_2eproto);
+  return file_level_enum_descriptors_gcsdk_5fgcmessages_2eproto[2];
+}
+bool GCConnectionStatus_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class CMsgSHA1Digest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSHA1Digest>()._impl_._has_bits_);
+  static void set_has_block1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_block2(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_block3(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+CMsgSHA1Digest::CMsgSHA1Digest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSHA1Digest)
+}
+CMsgSHA1Digest::CMsgSHA1Digest(const CMsgSHA1Digest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSHA1Digest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.block1_){}
+    , decltype(_impl_.block2_){}
+    , decltype(_impl_.block3_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.block1_, &from._impl_.block1_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.block3_) -
+    reinterpret_cast<char*>(&_impl_.block1_)) + sizeof(_impl_.block3_));
+  // @@protoc_insertion_point(copy_constructor:CMsgSHA1Digest)
+}
+
+inline void CMsgSHA1Digest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.block1_){uint64_t{0u}}
+    , decltype(_impl_.block2_){uint64_t{0u}}
+    , decltype(_impl_.block3_){0u}
+  };
+}
+
+CMsgSHA1Digest::~CMsgSHA1Digest() {
+  // @@protoc_insertion_point(destructor:CMsgSHA1Digest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSHA1Digest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgSHA1Digest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSHA1Digest::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSHA1Digest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.block1_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.block3_) -
+        reinterpret_cast<char*>(&_impl_.block1_)) + sizeof(_impl_.block3_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSHA1Digest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 block1 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_block1(&has_bits);
+          _impl_.block1_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 block2 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_block2(&has_bits);
+          _impl_.block2_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 block3 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_block3(&has_bits);
+          _impl_.block3_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSHA1Digest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSHA1Digest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 block1 = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_block1(), target);
+  }
+
+  // required fixed64 block2 = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_block2(), target);
+  }
+
+  // required fixed32 block3 = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(3, this->_internal_block3(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSHA1Digest)
+  return target;
+}
+
+size_t CMsgSHA1Digest::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:CMsgSHA1Digest)
+  size_t total_size = 0;
+
+  if (_internal_has_block1()) {
+    // required fixed64 block1 = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_block2()) {
+    // required fixed64 block2 = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_block3()) {
+    // required fixed32 block3 = 3;
+    total_size += 1 + 4;
+  }
+
+  return total_size;
+}
+size_t CMsgSHA1Digest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSHA1Digest)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required fixed64 block1 = 1;
+    total_size += 1 + 8;
+
+    // required fixed64 block2 = 2;
+    total_size += 1 + 8;
+
+    // required fixed32 block3 = 3;
+    total_size += 1 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSHA1Digest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSHA1Digest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSHA1Digest::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSHA1Digest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSHA1Digest*>(&to_msg);
+  auto& from = static_cast<const CMsgSHA1Digest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSHA1Digest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.block1_ = from._impl_.block1_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.block2_ = from._impl_.block2_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.block3_ = from._impl_.block3_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSHA1Digest::CopyFrom(const CMsgSHA1Digest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSHA1Digest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSHA1Digest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CMsgSHA1Digest::InternalSwap(CMsgSHA1Digest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgSHA1Digest, _impl_.block3_)
+      + sizeof(CMsgSHA1Digest::_impl_.block3_)
+      - PROTOBUF_FIELD_OFFSET(CMsgSHA1Digest, _impl_.block1_)>(
+          reinterpret_cast<char*>(&_impl_.block1_),
+          reinterpret_cast<char*>(&other->_impl_.block1_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSHA1Digest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[0]);
+}
+
+// ===================================================================
+
+class CMsgSOIDOwner::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOIDOwner>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CMsgSOIDOwner::CMsgSOIDOwner(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOIDOwner)
+}
+CMsgSOIDOwner::CMsgSOIDOwner(const CMsgSOIDOwner& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOIDOwner* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:CMsgSOIDOwner)
+}
+
+inline void CMsgSOIDOwner::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.type_){0u}
+  };
+}
+
+CMsgSOIDOwner::~CMsgSOIDOwner() {
+  // @@protoc_insertion_point(destructor:CMsgSOIDOwner)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOIDOwner::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgSOIDOwner::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOIDOwner::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOIDOwner)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOIDOwner::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOIDOwner::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOIDOwner)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_type(), target);
+  }
+
+  // optional uint64 id = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOIDOwner)
+  return target;
+}
+
+size_t CMsgSOIDOwner::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOIDOwner)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint64 id = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+    }
+
+    // optional uint32 type = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOIDOwner::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOIDOwner::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOIDOwner::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOIDOwner::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOIDOwner*>(&to_msg);
+  auto& from = static_cast<const CMsgSOIDOwner&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOIDOwner)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOIDOwner::CopyFrom(const CMsgSOIDOwner& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOIDOwner)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOIDOwner::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOIDOwner::InternalSwap(CMsgSOIDOwner* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgSOIDOwner, _impl_.type_)
+      + sizeof(CMsgSOIDOwner::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(CMsgSOIDOwner, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOIDOwner::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[1]);
+}
+
+// ===================================================================
+
+class CMsgSOSingleObject::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOSingleObject>()._impl_._has_bits_);
+  static void set_has_type_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_object_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::CMsgSOIDOwner& owner_soid(const CMsgSOSingleObject* msg);
+  static void set_has_owner_soid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_service_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::CMsgSOIDOwner&
+CMsgSOSingleObject::_Internal::owner_soid(const CMsgSOSingleObject* msg) {
+  return *msg->_impl_.owner_soid_;
+}
+CMsgSOSingleObject::CMsgSOSingleObject(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOSingleObject)
+}
+CMsgSOSingleObject::CMsgSOSingleObject(const CMsgSOSingleObject& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOSingleObject* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.object_data_){}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.type_id_){}
+    , decltype(_impl_.service_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.object_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.object_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_object_data()) {
+    _this->_impl_.object_data_.Set(from._internal_object_data(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_owner_soid()) {
+    _this->_impl_.owner_soid_ = new ::CMsgSOIDOwner(*from._impl_.owner_soid_);
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.service_id_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  // @@protoc_insertion_point(copy_constructor:CMsgSOSingleObject)
+}
+
+inline void CMsgSOSingleObject::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.object_data_){}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.type_id_){0}
+    , decltype(_impl_.service_id_){0u}
+  };
+  _impl_.object_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.object_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CMsgSOSingleObject::~CMsgSOSingleObject() {
+  // @@protoc_insertion_point(destructor:CMsgSOSingleObject)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOSingleObject::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.object_data_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.owner_soid_;
+}
+
+void CMsgSOSingleObject::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOSingleObject::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOSingleObject)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.object_data_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.owner_soid_ != nullptr);
+      _impl_.owner_soid_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000001cu) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.service_id_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOSingleObject::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 type_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_type_id(&has_bits);
+          _impl_.type_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes object_data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_object_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 version = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CMsgSOIDOwner owner_soid = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_owner_soid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 service_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_service_id(&has_bits);
+          _impl_.service_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOSingleObject::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOSingleObject)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 type_id = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_type_id(), target);
+  }
+
+  // optional bytes object_data = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_object_data(), target);
+  }
+
+  // optional fixed64 version = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_version(), target);
+  }
+
+  // optional .CMsgSOIDOwner owner_soid = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::owner_soid(this),
+        _Internal::owner_soid(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 service_id = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_service_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOSingleObject)
+  return target;
+}
+
+size_t CMsgSOSingleObject::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOSingleObject)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional bytes object_data = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_object_data());
+    }
+
+    // optional .CMsgSOIDOwner owner_soid = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.owner_soid_);
+    }
+
+    // optional fixed64 version = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 type_id = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type_id());
+    }
+
+    // optional uint32 service_id = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_service_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOSingleObject::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOSingleObject::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOSingleObject::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOSingleObject::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOSingleObject*>(&to_msg);
+  auto& from = static_cast<const CMsgSOSingleObject&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOSingleObject)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_object_data(from._internal_object_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_owner_soid()->::CMsgSOIDOwner::MergeFrom(
+          from._internal_owner_soid());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.type_id_ = from._impl_.type_id_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.service_id_ = from._impl_.service_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOSingleObject::CopyFrom(const CMsgSOSingleObject& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOSingleObject)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOSingleObject::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOSingleObject::InternalSwap(CMsgSOSingleObject* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.object_data_, lhs_arena,
+      &other->_impl_.object_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgSOSingleObject, _impl_.service_id_)
+      + sizeof(CMsgSOSingleObject::_impl_.service_id_)
+      - PROTOBUF_FIELD_OFFSET(CMsgSOSingleObject, _impl_.owner_soid_)>(
+          reinterpret_cast<char*>(&_impl_.owner_soid_),
+          reinterpret_cast<char*>(&other->_impl_.owner_soid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOSingleObject::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[2]);
+}
+
+// ===================================================================
+
+class CMsgSOMultipleObjects_SingleObject::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOMultipleObjects_SingleObject>()._impl_._has_bits_);
+  static void set_has_type_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_object_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CMsgSOMultipleObjects_SingleObject::CMsgSOMultipleObjects_SingleObject(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOMultipleObjects.SingleObject)
+}
+CMsgSOMultipleObjects_SingleObject::CMsgSOMultipleObjects_SingleObject(const CMsgSOMultipleObjects_SingleObject& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOMultipleObjects_SingleObject* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.object_data_){}
+    , decltype(_impl_.type_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.object_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.object_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_object_data()) {
+    _this->_impl_.object_data_.Set(from._internal_object_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_id_ = from._impl_.type_id_;
+  // @@protoc_insertion_point(copy_constructor:CMsgSOMultipleObjects.SingleObject)
+}
+
+inline void CMsgSOMultipleObjects_SingleObject::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.object_data_){}
+    , decltype(_impl_.type_id_){0}
+  };
+  _impl_.object_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.object_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CMsgSOMultipleObjects_SingleObject::~CMsgSOMultipleObjects_SingleObject() {
+  // @@protoc_insertion_point(destructor:CMsgSOMultipleObjects.SingleObject)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOMultipleObjects_SingleObject::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.object_data_.Destroy();
+}
+
+void CMsgSOMultipleObjects_SingleObject::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOMultipleObjects_SingleObject::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOMultipleObjects.SingleObject)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.object_data_.ClearNonDefaultToEmpty();
+  }
+  _impl_.type_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOMultipleObjects_SingleObject::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 type_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type_id(&has_bits);
+          _impl_.type_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes object_data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_object_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOMultipleObjects_SingleObject::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOMultipleObjects.SingleObject)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 type_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_type_id(), target);
+  }
+
+  // optional bytes object_data = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_object_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOMultipleObjects.SingleObject)
+  return target;
+}
+
+size_t CMsgSOMultipleObjects_SingleObject::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOMultipleObjects.SingleObject)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes object_data = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_object_data());
+    }
+
+    // optional int32 type_id = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOMultipleObjects_SingleObject::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOMultipleObjects_SingleObject::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOMultipleObjects_SingleObject::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOMultipleObjects_SingleObject::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOMultipleObjects_SingleObject*>(&to_msg);
+  auto& from = static_cast<const CMsgSOMultipleObjects_SingleObject&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOMultipleObjects.SingleObject)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_object_data(from._internal_object_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_id_ = from._impl_.type_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOMultipleObjects_SingleObject::CopyFrom(const CMsgSOMultipleObjects_SingleObject& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOMultipleObjects.SingleObject)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOMultipleObjects_SingleObject::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOMultipleObjects_SingleObject::InternalSwap(CMsgSOMultipleObjects_SingleObject* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.object_data_, lhs_arena,
+      &other->_impl_.object_data_, rhs_arena
+  );
+  swap(_impl_.type_id_, other->_impl_.type_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOMultipleObjects_SingleObject::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[3]);
+}
+
+// ===================================================================
+
+class CMsgSOMultipleObjects::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOMultipleObjects>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::CMsgSOIDOwner& owner_soid(const CMsgSOMultipleObjects* msg);
+  static void set_has_owner_soid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_service_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::CMsgSOIDOwner&
+CMsgSOMultipleObjects::_Internal::owner_soid(const CMsgSOMultipleObjects* msg) {
+  return *msg->_impl_.owner_soid_;
+}
+CMsgSOMultipleObjects::CMsgSOMultipleObjects(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOMultipleObjects)
+}
+CMsgSOMultipleObjects::CMsgSOMultipleObjects(const CMsgSOMultipleObjects& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOMultipleObjects* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.objects_modified_){from._impl_.objects_modified_}
+    , decltype(_impl_.objects_added_){from._impl_.objects_added_}
+    , decltype(_impl_.objects_removed_){from._impl_.objects_removed_}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.service_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_owner_soid()) {
+    _this->_impl_.owner_soid_ = new ::CMsgSOIDOwner(*from._impl_.owner_soid_);
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.service_id_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  // @@protoc_insertion_point(copy_constructor:CMsgSOMultipleObjects)
+}
+
+inline void CMsgSOMultipleObjects::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.objects_modified_){arena}
+    , decltype(_impl_.objects_added_){arena}
+    , decltype(_impl_.objects_removed_){arena}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.service_id_){0u}
+  };
+}
+
+CMsgSOMultipleObjects::~CMsgSOMultipleObjects() {
+  // @@protoc_insertion_point(destructor:CMsgSOMultipleObjects)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOMultipleObjects::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.objects_modified_.~RepeatedPtrField();
+  _impl_.objects_added_.~RepeatedPtrField();
+  _impl_.objects_removed_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.owner_soid_;
+}
+
+void CMsgSOMultipleObjects::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOMultipleObjects::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOMultipleObjects)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.objects_modified_.Clear();
+  _impl_.objects_added_.Clear();
+  _impl_.objects_removed_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.owner_soid_ != nullptr);
+    _impl_.owner_soid_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.service_id_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOMultipleObjects::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CMsgSOMultipleObjects.SingleObject objects_modified = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_objects_modified(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CMsgSOMultipleObjects.SingleObject objects_added = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_objects_added(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CMsgSOMultipleObjects.SingleObject objects_removed = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_objects_removed(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CMsgSOIDOwner owner_soid = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_owner_soid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 service_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_service_id(&has_bits);
+          _impl_.service_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOMultipleObjects::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOMultipleObjects)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CMsgSOMultipleObjects.SingleObject objects_modified = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_objects_modified_size()); i < n; i++) {
+    const auto& repfield = this->_internal_objects_modified(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed64 version = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_version(), target);
+  }
+
+  // repeated .CMsgSOMultipleObjects.SingleObject objects_added = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_objects_added_size()); i < n; i++) {
+    const auto& repfield = this->_internal_objects_added(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .CMsgSOMultipleObjects.SingleObject objects_removed = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_objects_removed_size()); i < n; i++) {
+    const auto& repfield = this->_internal_objects_removed(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .CMsgSOIDOwner owner_soid = 6;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::owner_soid(this),
+        _Internal::owner_soid(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 service_id = 7;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_service_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOMultipleObjects)
+  return target;
+}
+
+size_t CMsgSOMultipleObjects::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOMultipleObjects)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CMsgSOMultipleObjects.SingleObject objects_modified = 2;
+  total_size += 1UL * this->_internal_objects_modified_size();
+  for (const auto& msg : this->_impl_.objects_modified_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .CMsgSOMultipleObjects.SingleObject objects_added = 4;
+  total_size += 1UL * this->_internal_objects_added_size();
+  for (const auto& msg : this->_impl_.objects_added_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .CMsgSOMultipleObjects.SingleObject objects_removed = 5;
+  total_size += 1UL * this->_internal_objects_removed_size();
+  for (const auto& msg : this->_impl_.objects_removed_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .CMsgSOIDOwner owner_soid = 6;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.owner_soid_);
+    }
+
+    // optional fixed64 version = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 service_id = 7;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_service_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOMultipleObjects::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOMultipleObjects::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOMultipleObjects::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOMultipleObjects::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOMultipleObjects*>(&to_msg);
+  auto& from = static_cast<const CMsgSOMultipleObjects&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOMultipleObjects)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.objects_modified_.MergeFrom(from._impl_.objects_modified_);
+  _this->_impl_.objects_added_.MergeFrom(from._impl_.objects_added_);
+  _this->_impl_.objects_removed_.MergeFrom(from._impl_.objects_removed_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_owner_soid()->::CMsgSOIDOwner::MergeFrom(
+          from._internal_owner_soid());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.service_id_ = from._impl_.service_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOMultipleObjects::CopyFrom(const CMsgSOMultipleObjects& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOMultipleObjects)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOMultipleObjects::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOMultipleObjects::InternalSwap(CMsgSOMultipleObjects* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.objects_modified_.InternalSwap(&other->_impl_.objects_modified_);
+  _impl_.objects_added_.InternalSwap(&other->_impl_.objects_added_);
+  _impl_.objects_removed_.InternalSwap(&other->_impl_.objects_removed_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgSOMultipleObjects, _impl_.service_id_)
+      + sizeof(CMsgSOMultipleObjects::_impl_.service_id_)
+      - PROTOBUF_FIELD_OFFSET(CMsgSOMultipleObjects, _impl_.owner_soid_)>(
+          reinterpret_cast<char*>(&_impl_.owner_soid_),
+          reinterpret_cast<char*>(&other->_impl_.owner_soid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOMultipleObjects::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[4]);
+}
+
+// ===================================================================
+
+class CMsgSOCacheSubscribed_SubscribedType::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOCacheSubscribed_SubscribedType>()._impl_._has_bits_);
+  static void set_has_type_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CMsgSOCacheSubscribed_SubscribedType::CMsgSOCacheSubscribed_SubscribedType(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOCacheSubscribed.SubscribedType)
+}
+CMsgSOCacheSubscribed_SubscribedType::CMsgSOCacheSubscribed_SubscribedType(const CMsgSOCacheSubscribed_SubscribedType& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOCacheSubscribed_SubscribedType* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.object_data_){from._impl_.object_data_}
+    , decltype(_impl_.type_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.type_id_ = from._impl_.type_id_;
+  // @@protoc_insertion_point(copy_constructor:CMsgSOCacheSubscribed.SubscribedType)
+}
+
+inline void CMsgSOCacheSubscribed_SubscribedType::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.object_data_){arena}
+    , decltype(_impl_.type_id_){0}
+  };
+}
+
+CMsgSOCacheSubscribed_SubscribedType::~CMsgSOCacheSubscribed_SubscribedType() {
+  // @@protoc_insertion_point(destructor:CMsgSOCacheSubscribed.SubscribedType)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOCacheSubscribed_SubscribedType::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.object_data_.~RepeatedPtrField();
+}
+
+void CMsgSOCacheSubscribed_SubscribedType::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOCacheSubscribed_SubscribedType::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOCacheSubscribed.SubscribedType)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.object_data_.Clear();
+  _impl_.type_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOCacheSubscribed_SubscribedType::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 type_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type_id(&has_bits);
+          _impl_.type_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes object_data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_object_data();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOCacheSubscribed_SubscribedType::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOCacheSubscribed.SubscribedType)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 type_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_type_id(), target);
+  }
+
+  // repeated bytes object_data = 2;
+  for (int i = 0, n = this->_internal_object_data_size(); i < n; i++) {
+    const auto& s = this->_internal_object_data(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOCacheSubscribed.SubscribedType)
+  return target;
+}
+
+size_t CMsgSOCacheSubscribed_SubscribedType::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOCacheSubscribed.SubscribedType)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes object_data = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.object_data_.size());
+  for (int i = 0, n = _impl_.object_data_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.object_data_.Get(i));
+  }
+
+  // optional int32 type_id = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOCacheSubscribed_SubscribedType::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOCacheSubscribed_SubscribedType::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOCacheSubscribed_SubscribedType::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOCacheSubscribed_SubscribedType::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOCacheSubscribed_SubscribedType*>(&to_msg);
+  auto& from = static_cast<const CMsgSOCacheSubscribed_SubscribedType&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOCacheSubscribed.SubscribedType)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.object_data_.MergeFrom(from._impl_.object_data_);
+  if (from._internal_has_type_id()) {
+    _this->_internal_set_type_id(from._internal_type_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOCacheSubscribed_SubscribedType::CopyFrom(const CMsgSOCacheSubscribed_SubscribedType& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOCacheSubscribed.SubscribedType)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOCacheSubscribed_SubscribedType::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOCacheSubscribed_SubscribedType::InternalSwap(CMsgSOCacheSubscribed_SubscribedType* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.object_data_.InternalSwap(&other->_impl_.object_data_);
+  swap(_impl_.type_id_, other->_impl_.type_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOCacheSubscribed_SubscribedType::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[5]);
+}
+
+// ===================================================================
+
+class CMsgSOCacheSubscribed::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOCacheSubscribed>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::CMsgSOIDOwner& owner_soid(const CMsgSOCacheSubscribed* msg);
+  static void set_has_owner_soid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_service_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_sync_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::CMsgSOIDOwner&
+CMsgSOCacheSubscribed::_Internal::owner_soid(const CMsgSOCacheSubscribed* msg) {
+  return *msg->_impl_.owner_soid_;
+}
+CMsgSOCacheSubscribed::CMsgSOCacheSubscribed(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOCacheSubscribed)
+}
+CMsgSOCacheSubscribed::CMsgSOCacheSubscribed(const CMsgSOCacheSubscribed& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOCacheSubscribed* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.objects_){from._impl_.objects_}
+    , decltype(_impl_.service_list_){from._impl_.service_list_}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.sync_version_){}
+    , decltype(_impl_.service_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_owner_soid()) {
+    _this->_impl_.owner_soid_ = new ::CMsgSOIDOwner(*from._impl_.owner_soid_);
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.service_id_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  // @@protoc_insertion_point(copy_constructor:CMsgSOCacheSubscribed)
+}
+
+inline void CMsgSOCacheSubscribed::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.objects_){arena}
+    , decltype(_impl_.service_list_){arena}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.sync_version_){uint64_t{0u}}
+    , decltype(_impl_.service_id_){0u}
+  };
+}
+
+CMsgSOCacheSubscribed::~CMsgSOCacheSubscribed() {
+  // @@protoc_insertion_point(destructor:CMsgSOCacheSubscribed)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOCacheSubscribed::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.objects_.~RepeatedPtrField();
+  _impl_.service_list_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.owner_soid_;
+}
+
+void CMsgSOCacheSubscribed::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOCacheSubscribed::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOCacheSubscribed)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.objects_.Clear();
+  _impl_.service_list_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.owner_soid_ != nullptr);
+    _impl_.owner_soid_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.service_id_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOCacheSubscribed::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CMsgSOCacheSubscribed.SubscribedType objects = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_objects(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CMsgSOIDOwner owner_soid = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_owner_soid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 service_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_service_id(&has_bits);
+          _impl_.service_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 service_list = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_service_list(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_service_list(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 sync_version = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_sync_version(&has_bits);
+          _impl_.sync_version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOCacheSubscribed::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOCacheSubscribed)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CMsgSOCacheSubscribed.SubscribedType objects = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_objects_size()); i < n; i++) {
+    const auto& repfield = this->_internal_objects(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed64 version = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_version(), target);
+  }
+
+  // optional .CMsgSOIDOwner owner_soid = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::owner_soid(this),
+        _Internal::owner_soid(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 service_id = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_service_id(), target);
+  }
+
+  // repeated uint32 service_list = 6;
+  for (int i = 0, n = this->_internal_service_list_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_service_list(i), target);
+  }
+
+  // optional fixed64 sync_version = 7;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_sync_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOCacheSubscribed)
+  return target;
+}
+
+size_t CMsgSOCacheSubscribed::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOCacheSubscribed)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CMsgSOCacheSubscribed.SubscribedType objects = 2;
+  total_size += 1UL * this->_internal_objects_size();
+  for (const auto& msg : this->_impl_.objects_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated uint32 service_list = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.service_list_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_service_list_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional .CMsgSOIDOwner owner_soid = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.owner_soid_);
+    }
+
+    // optional fixed64 version = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed64 sync_version = 7;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 service_id = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_service_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOCacheSubscribed::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOCacheSubscribed::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOCacheSubscribed::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOCacheSubscribed::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOCacheSubscribed*>(&to_msg);
+  auto& from = static_cast<const CMsgSOCacheSubscribed&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOCacheSubscribed)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.objects_.MergeFrom(from._impl_.objects_);
+  _this->_impl_.service_list_.MergeFrom(from._impl_.service_list_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_owner_soid()->::CMsgSOIDOwner::MergeFrom(
+          from._internal_owner_soid());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sync_version_ = from._impl_.sync_version_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.service_id_ = from._impl_.service_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOCacheSubscribed::CopyFrom(const CMsgSOCacheSubscribed& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOCacheSubscribed)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOCacheSubscribed::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOCacheSubscribed::InternalSwap(CMsgSOCacheSubscribed* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.objects_.InternalSwap(&other->_impl_.objects_);
+  _impl_.service_list_.InternalSwap(&other->_impl_.service_list_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgSOCacheSubscribed, _impl_.service_id_)
+      + sizeof(CMsgSOCacheSubscribed::_impl_.service_id_)
+      - PROTOBUF_FIELD_OFFSET(CMsgSOCacheSubscribed, _impl_.owner_soid_)>(
+          reinterpret_cast<char*>(&_impl_.owner_soid_),
+          reinterpret_cast<char*>(&other->_impl_.owner_soid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOCacheSubscribed::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[6]);
+}
+
+// ===================================================================
+
+class CMsgSOCacheSubscribedUpToDate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOCacheSubscribedUpToDate>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::CMsgSOIDOwner& owner_soid(const CMsgSOCacheSubscribedUpToDate* msg);
+  static void set_has_owner_soid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_service_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_sync_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::CMsgSOIDOwner&
+CMsgSOCacheSubscribedUpToDate::_Internal::owner_soid(const CMsgSOCacheSubscribedUpToDate* msg) {
+  return *msg->_impl_.owner_soid_;
+}
+CMsgSOCacheSubscribedUpToDate::CMsgSOCacheSubscribedUpToDate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOCacheSubscribedUpToDate)
+}
+CMsgSOCacheSubscribedUpToDate::CMsgSOCacheSubscribedUpToDate(const CMsgSOCacheSubscribedUpToDate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOCacheSubscribedUpToDate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_list_){from._impl_.service_list_}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.sync_version_){}
+    , decltype(_impl_.service_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_owner_soid()) {
+    _this->_impl_.owner_soid_ = new ::CMsgSOIDOwner(*from._impl_.owner_soid_);
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.service_id_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  // @@protoc_insertion_point(copy_constructor:CMsgSOCacheSubscribedUpToDate)
+}
+
+inline void CMsgSOCacheSubscribedUpToDate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_list_){arena}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.sync_version_){uint64_t{0u}}
+    , decltype(_impl_.service_id_){0u}
+  };
+}
+
+CMsgSOCacheSubscribedUpToDate::~CMsgSOCacheSubscribedUpToDate() {
+  // @@protoc_insertion_point(destructor:CMsgSOCacheSubscribedUpToDate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOCacheSubscribedUpToDate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_list_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.owner_soid_;
+}
+
+void CMsgSOCacheSubscribedUpToDate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOCacheSubscribedUpToDate::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOCacheSubscribedUpToDate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_list_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.owner_soid_ != nullptr);
+    _impl_.owner_soid_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.service_id_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOCacheSubscribedUpToDate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed64 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CMsgSOIDOwner owner_soid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_owner_soid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 service_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_service_id(&has_bits);
+          _impl_.service_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 service_list = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_service_list(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<32>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_service_list(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 sync_version = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_sync_version(&has_bits);
+          _impl_.sync_version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOCacheSubscribedUpToDate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOCacheSubscribedUpToDate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed64 version = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_version(), target);
+  }
+
+  // optional .CMsgSOIDOwner owner_soid = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::owner_soid(this),
+        _Internal::owner_soid(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 service_id = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_service_id(), target);
+  }
+
+  // repeated uint32 service_list = 4;
+  for (int i = 0, n = this->_internal_service_list_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_service_list(i), target);
+  }
+
+  // optional fixed64 sync_version = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(5, this->_internal_sync_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOCacheSubscribedUpToDate)
+  return target;
+}
+
+size_t CMsgSOCacheSubscribedUpToDate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOCacheSubscribedUpToDate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 service_list = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.service_list_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_service_list_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional .CMsgSOIDOwner owner_soid = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.owner_soid_);
+    }
+
+    // optional fixed64 version = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed64 sync_version = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 service_id = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_service_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOCacheSubscribedUpToDate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOCacheSubscribedUpToDate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOCacheSubscribedUpToDate::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOCacheSubscribedUpToDate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOCacheSubscribedUpToDate*>(&to_msg);
+  auto& from = static_cast<const CMsgSOCacheSubscribedUpToDate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOCacheSubscribedUpToDate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.service_list_.MergeFrom(from._impl_.service_list_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_owner_soid()->::CMsgSOIDOwner::MergeFrom(
+          from._internal_owner_soid());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sync_version_ = from._impl_.sync_version_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.service_id_ = from._impl_.service_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOCacheSubscribedUpToDate::CopyFrom(const CMsgSOCacheSubscribedUpToDate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOCacheSubscribedUpToDate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOCacheSubscribedUpToDate::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOCacheSubscribedUpToDate::InternalSwap(CMsgSOCacheSubscribedUpToDate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.service_list_.InternalSwap(&other->_impl_.service_list_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgSOCacheSubscribedUpToDate, _impl_.service_id_)
+      + sizeof(CMsgSOCacheSubscribedUpToDate::_impl_.service_id_)
+      - PROTOBUF_FIELD_OFFSET(CMsgSOCacheSubscribedUpToDate, _impl_.owner_soid_)>(
+          reinterpret_cast<char*>(&_impl_.owner_soid_),
+          reinterpret_cast<char*>(&other->_impl_.owner_soid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOCacheSubscribedUpToDate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[7]);
+}
+
+// ===================================================================
+
+class CMsgSOCacheUnsubscribed::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOCacheUnsubscribed>()._impl_._has_bits_);
+  static const ::CMsgSOIDOwner& owner_soid(const CMsgSOCacheUnsubscribed* msg);
+  static void set_has_owner_soid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::CMsgSOIDOwner&
+CMsgSOCacheUnsubscribed::_Internal::owner_soid(const CMsgSOCacheUnsubscribed* msg) {
+  return *msg->_impl_.owner_soid_;
+}
+CMsgSOCacheUnsubscribed::CMsgSOCacheUnsubscribed(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOCacheUnsubscribed)
+}
+CMsgSOCacheUnsubscribed::CMsgSOCacheUnsubscribed(const CMsgSOCacheUnsubscribed& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOCacheUnsubscribed* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.owner_soid_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_owner_soid()) {
+    _this->_impl_.owner_soid_ = new ::CMsgSOIDOwner(*from._impl_.owner_soid_);
+  }
+  // @@protoc_insertion_point(copy_constructor:CMsgSOCacheUnsubscribed)
+}
+
+inline void CMsgSOCacheUnsubscribed::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.owner_soid_){nullptr}
+  };
+}
+
+CMsgSOCacheUnsubscribed::~CMsgSOCacheUnsubscribed() {
+  // @@protoc_insertion_point(destructor:CMsgSOCacheUnsubscribed)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOCacheUnsubscribed::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.owner_soid_;
+}
+
+void CMsgSOCacheUnsubscribed::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOCacheUnsubscribed::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOCacheUnsubscribed)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.owner_soid_ != nullptr);
+    _impl_.owner_soid_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOCacheUnsubscribed::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .CMsgSOIDOwner owner_soid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_owner_soid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOCacheUnsubscribed::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOCacheUnsubscribed)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .CMsgSOIDOwner owner_soid = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::owner_soid(this),
+        _Internal::owner_soid(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOCacheUnsubscribed)
+  return target;
+}
+
+size_t CMsgSOCacheUnsubscribed::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOCacheUnsubscribed)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .CMsgSOIDOwner owner_soid = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.owner_soid_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOCacheUnsubscribed::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOCacheUnsubscribed::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOCacheUnsubscribed::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOCacheUnsubscribed::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOCacheUnsubscribed*>(&to_msg);
+  auto& from = static_cast<const CMsgSOCacheUnsubscribed&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOCacheUnsubscribed)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_owner_soid()) {
+    _this->_internal_mutable_owner_soid()->::CMsgSOIDOwner::MergeFrom(
+        from._internal_owner_soid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOCacheUnsubscribed::CopyFrom(const CMsgSOCacheUnsubscribed& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOCacheUnsubscribed)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOCacheUnsubscribed::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOCacheUnsubscribed::InternalSwap(CMsgSOCacheUnsubscribed* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.owner_soid_, other->_impl_.owner_soid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOCacheUnsubscribed::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[8]);
+}
+
+// ===================================================================
+
+class CMsgSOCacheSubscriptionCheck::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOCacheSubscriptionCheck>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::CMsgSOIDOwner& owner_soid(const CMsgSOCacheSubscriptionCheck* msg);
+  static void set_has_owner_soid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_service_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_sync_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::CMsgSOIDOwner&
+CMsgSOCacheSubscriptionCheck::_Internal::owner_soid(const CMsgSOCacheSubscriptionCheck* msg) {
+  return *msg->_impl_.owner_soid_;
+}
+CMsgSOCacheSubscriptionCheck::CMsgSOCacheSubscriptionCheck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOCacheSubscriptionCheck)
+}
+CMsgSOCacheSubscriptionCheck::CMsgSOCacheSubscriptionCheck(const CMsgSOCacheSubscriptionCheck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOCacheSubscriptionCheck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_list_){from._impl_.service_list_}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.sync_version_){}
+    , decltype(_impl_.service_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_owner_soid()) {
+    _this->_impl_.owner_soid_ = new ::CMsgSOIDOwner(*from._impl_.owner_soid_);
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.service_id_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  // @@protoc_insertion_point(copy_constructor:CMsgSOCacheSubscriptionCheck)
+}
+
+inline void CMsgSOCacheSubscriptionCheck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.service_list_){arena}
+    , decltype(_impl_.owner_soid_){nullptr}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.sync_version_){uint64_t{0u}}
+    , decltype(_impl_.service_id_){0u}
+  };
+}
+
+CMsgSOCacheSubscriptionCheck::~CMsgSOCacheSubscriptionCheck() {
+  // @@protoc_insertion_point(destructor:CMsgSOCacheSubscriptionCheck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOCacheSubscriptionCheck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_list_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.owner_soid_;
+}
+
+void CMsgSOCacheSubscriptionCheck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOCacheSubscriptionCheck::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOCacheSubscriptionCheck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_list_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.owner_soid_ != nullptr);
+    _impl_.owner_soid_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.service_id_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOCacheSubscriptionCheck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CMsgSOIDOwner owner_soid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_owner_soid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 service_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_service_id(&has_bits);
+          _impl_.service_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 service_list = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_service_list(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<40>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 42) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_service_list(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 sync_version = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_sync_version(&has_bits);
+          _impl_.sync_version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOCacheSubscriptionCheck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOCacheSubscriptionCheck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed64 version = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_version(), target);
+  }
+
+  // optional .CMsgSOIDOwner owner_soid = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::owner_soid(this),
+        _Internal::owner_soid(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 service_id = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_service_id(), target);
+  }
+
+  // repeated uint32 service_list = 5;
+  for (int i = 0, n = this->_internal_service_list_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_service_list(i), target);
+  }
+
+  // optional fixed64 sync_version = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(6, this->_internal_sync_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOCacheSubscriptionCheck)
+  return target;
+}
+
+size_t CMsgSOCacheSubscriptionCheck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOCacheSubscriptionCheck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 service_list = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.service_list_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_service_list_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional .CMsgSOIDOwner owner_soid = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.owner_soid_);
+    }
+
+    // optional fixed64 version = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed64 sync_version = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 service_id = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_service_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOCacheSubscriptionCheck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOCacheSubscriptionCheck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOCacheSubscriptionCheck::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOCacheSubscriptionCheck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOCacheSubscriptionCheck*>(&to_msg);
+  auto& from = static_cast<const CMsgSOCacheSubscriptionCheck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOCacheSubscriptionCheck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.service_list_.MergeFrom(from._impl_.service_list_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_owner_soid()->::CMsgSOIDOwner::MergeFrom(
+          from._internal_owner_soid());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sync_version_ = from._impl_.sync_version_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.service_id_ = from._impl_.service_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOCacheSubscriptionCheck::CopyFrom(const CMsgSOCacheSubscriptionCheck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOCacheSubscriptionCheck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOCacheSubscriptionCheck::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOCacheSubscriptionCheck::InternalSwap(CMsgSOCacheSubscriptionCheck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.service_list_.InternalSwap(&other->_impl_.service_list_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgSOCacheSubscriptionCheck, _impl_.service_id_)
+      + sizeof(CMsgSOCacheSubscriptionCheck::_impl_.service_id_)
+      - PROTOBUF_FIELD_OFFSET(CMsgSOCacheSubscriptionCheck, _impl_.owner_soid_)>(
+          reinterpret_cast<char*>(&_impl_.owner_soid_),
+          reinterpret_cast<char*>(&other->_impl_.owner_soid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOCacheSubscriptionCheck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[9]);
+}
+
+// ===================================================================
+
+class CMsgSOCacheSubscriptionRefresh::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOCacheSubscriptionRefresh>()._impl_._has_bits_);
+  static const ::CMsgSOIDOwner& owner_soid(const CMsgSOCacheSubscriptionRefresh* msg);
+  static void set_has_owner_soid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::CMsgSOIDOwner&
+CMsgSOCacheSubscriptionRefresh::_Internal::owner_soid(const CMsgSOCacheSubscriptionRefresh* msg) {
+  return *msg->_impl_.owner_soid_;
+}
+CMsgSOCacheSubscriptionRefresh::CMsgSOCacheSubscriptionRefresh(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOCacheSubscriptionRefresh)
+}
+CMsgSOCacheSubscriptionRefresh::CMsgSOCacheSubscriptionRefresh(const CMsgSOCacheSubscriptionRefresh& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOCacheSubscriptionRefresh* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.owner_soid_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_owner_soid()) {
+    _this->_impl_.owner_soid_ = new ::CMsgSOIDOwner(*from._impl_.owner_soid_);
+  }
+  // @@protoc_insertion_point(copy_constructor:CMsgSOCacheSubscriptionRefresh)
+}
+
+inline void CMsgSOCacheSubscriptionRefresh::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.owner_soid_){nullptr}
+  };
+}
+
+CMsgSOCacheSubscriptionRefresh::~CMsgSOCacheSubscriptionRefresh() {
+  // @@protoc_insertion_point(destructor:CMsgSOCacheSubscriptionRefresh)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOCacheSubscriptionRefresh::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.owner_soid_;
+}
+
+void CMsgSOCacheSubscriptionRefresh::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOCacheSubscriptionRefresh::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOCacheSubscriptionRefresh)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.owner_soid_ != nullptr);
+    _impl_.owner_soid_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOCacheSubscriptionRefresh::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .CMsgSOIDOwner owner_soid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_owner_soid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOCacheSubscriptionRefresh::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOCacheSubscriptionRefresh)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .CMsgSOIDOwner owner_soid = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::owner_soid(this),
+        _Internal::owner_soid(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOCacheSubscriptionRefresh)
+  return target;
+}
+
+size_t CMsgSOCacheSubscriptionRefresh::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOCacheSubscriptionRefresh)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .CMsgSOIDOwner owner_soid = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.owner_soid_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOCacheSubscriptionRefresh::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOCacheSubscriptionRefresh::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOCacheSubscriptionRefresh::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOCacheSubscriptionRefresh::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOCacheSubscriptionRefresh*>(&to_msg);
+  auto& from = static_cast<const CMsgSOCacheSubscriptionRefresh&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOCacheSubscriptionRefresh)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_owner_soid()) {
+    _this->_internal_mutable_owner_soid()->::CMsgSOIDOwner::MergeFrom(
+        from._internal_owner_soid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOCacheSubscriptionRefresh::CopyFrom(const CMsgSOCacheSubscriptionRefresh& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOCacheSubscriptionRefresh)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOCacheSubscriptionRefresh::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOCacheSubscriptionRefresh::InternalSwap(CMsgSOCacheSubscriptionRefresh* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.owner_soid_, other->_impl_.owner_soid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOCacheSubscriptionRefresh::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[10]);
+}
+
+// ===================================================================
+
+class CMsgSOCacheVersion::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOCacheVersion>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CMsgSOCacheVersion::CMsgSOCacheVersion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOCacheVersion)
+}
+CMsgSOCacheVersion::CMsgSOCacheVersion(const CMsgSOCacheVersion& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOCacheVersion* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:CMsgSOCacheVersion)
+}
+
+inline void CMsgSOCacheVersion::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){uint64_t{0u}}
+  };
+}
+
+CMsgSOCacheVersion::~CMsgSOCacheVersion() {
+  // @@protoc_insertion_point(destructor:CMsgSOCacheVersion)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOCacheVersion::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgSOCacheVersion::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOCacheVersion::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOCacheVersion)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOCacheVersion::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed64 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOCacheVersion::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOCacheVersion)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed64 version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOCacheVersion)
+  return target;
+}
+
+size_t CMsgSOCacheVersion::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOCacheVersion)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional fixed64 version = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOCacheVersion::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOCacheVersion::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOCacheVersion::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOCacheVersion::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOCacheVersion*>(&to_msg);
+  auto& from = static_cast<const CMsgSOCacheVersion&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOCacheVersion)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_version()) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOCacheVersion::CopyFrom(const CMsgSOCacheVersion& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOCacheVersion)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOCacheVersion::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOCacheVersion::InternalSwap(CMsgSOCacheVersion* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.version_, other->_impl_.version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOCacheVersion::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[11]);
+}
+
+// ===================================================================
+
+class CMsgGCMultiplexMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgGCMultiplexMessage>()._impl_._has_bits_);
+  static void set_has_msgtype(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_payload(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CMsgGCMultiplexMessage::CMsgGCMultiplexMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCMultiplexMessage)
+}
+CMsgGCMultiplexMessage::CMsgGCMultiplexMessage(const CMsgGCMultiplexMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCMultiplexMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.steamids_){from._impl_.steamids_}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.msgtype_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_payload()) {
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.msgtype_ = from._impl_.msgtype_;
+  // @@protoc_insertion_point(copy_constructor:CMsgGCMultiplexMessage)
+}
+
+inline void CMsgGCMultiplexMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.steamids_){arena}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.msgtype_){0u}
+  };
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CMsgGCMultiplexMessage::~CMsgGCMultiplexMessage() {
+  // @@protoc_insertion_point(destructor:CMsgGCMultiplexMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCMultiplexMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.steamids_.~RepeatedField();
+  _impl_.payload_.Destroy();
+}
+
+void CMsgGCMultiplexMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCMultiplexMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCMultiplexMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.steamids_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.payload_.ClearNonDefaultToEmpty();
+  }
+  _impl_.msgtype_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCMultiplexMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 msgtype = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_msgtype(&has_bits);
+          _impl_.msgtype_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes payload = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_payload();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed64 steamids = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_steamids(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<25>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_steamids(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCMultiplexMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCMultiplexMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 msgtype = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_msgtype(), target);
+  }
+
+  // optional bytes payload = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_payload(), target);
+  }
+
+  // repeated fixed64 steamids = 3;
+  for (int i = 0, n = this->_internal_steamids_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_steamids(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCMultiplexMessage)
+  return target;
+}
+
+size_t CMsgGCMultiplexMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCMultiplexMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 steamids = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_steamids_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_steamids_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes payload = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_payload());
+    }
+
+    // optional uint32 msgtype = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_msgtype());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCMultiplexMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCMultiplexMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCMultiplexMessage::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCMultiplexMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCMultiplexMessage*>(&to_msg);
+  auto& from = static_cast<const CMsgGCMultiplexMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCMultiplexMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.steamids_.MergeFrom(from._impl_.steamids_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_payload(from._internal_payload());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.msgtype_ = from._impl_.msgtype_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCMultiplexMessage::CopyFrom(const CMsgGCMultiplexMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCMultiplexMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCMultiplexMessage::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCMultiplexMessage::InternalSwap(CMsgGCMultiplexMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.steamids_.InternalSwap(&other->_impl_.steamids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
+  swap(_impl_.msgtype_, other->_impl_.msgtype_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCMultiplexMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[12]);
+}
+
+// ===================================================================
+
+class CGCToGCMsgMasterAck_Process::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CGCToGCMsgMasterAck_Process>()._impl_._has_bits_);
+  static void set_has_dir_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CGCToGCMsgMasterAck_Process::CGCToGCMsgMasterAck_Process(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CGCToGCMsgMasterAck.Process)
+}
+CGCToGCMsgMasterAck_Process::CGCToGCMsgMasterAck_Process(const CGCToGCMsgMasterAck_Process& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CGCToGCMsgMasterAck_Process* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_instances_){from._impl_.type_instances_}
+    , decltype(_impl_.dir_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.dir_index_ = from._impl_.dir_index_;
+  // @@protoc_insertion_point(copy_constructor:CGCToGCMsgMasterAck.Process)
+}
+
+inline void CGCToGCMsgMasterAck_Process::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_instances_){arena}
+    , decltype(_impl_.dir_index_){0u}
+  };
+}
+
+CGCToGCMsgMasterAck_Process::~CGCToGCMsgMasterAck_Process() {
+  // @@protoc_insertion_point(destructor:CGCToGCMsgMasterAck.Process)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CGCToGCMsgMasterAck_Process::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.type_instances_.~RepeatedField();
+}
+
+void CGCToGCMsgMasterAck_Process::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CGCToGCMsgMasterAck_Process::Clear() {
+// @@protoc_insertion_point(message_clear_start:CGCToGCMsgMasterAck.Process)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.type_instances_.Clear();
+  _impl_.dir_index_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CGCToGCMsgMasterAck_Process::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 dir_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_dir_index(&has_bits);
+          _impl_.dir_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 type_instances = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_type_instances(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_type_instances(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CGCToGCMsgMasterAck_Process::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CGCToGCMsgMasterAck.Process)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 dir_index = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_dir_index(), target);
+  }
+
+  // repeated uint32 type_instances = 2;
+  for (int i = 0, n = this->_internal_type_instances_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_type_instances(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CGCToGCMsgMasterAck.Process)
+  return target;
+}
+
+size_t CGCToGCMsgMasterAck_Process::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CGCToGCMsgMasterAck.Process)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 type_instances = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.type_instances_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_type_instances_size());
+    total_size += data_size;
+  }
+
+  // optional uint32 dir_index = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dir_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CGCToGCMsgMasterAck_Process::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CGCToGCMsgMasterAck_Process::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CGCToGCMsgMasterAck_Process::GetClassData() const { return &_class_data_; }
+
+
+void CGCToGCMsgMasterAck_Process::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CGCToGCMsgMasterAck_Process*>(&to_msg);
+  auto& from = static_cast<const CGCToGCMsgMasterAck_Process&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CGCToGCMsgMasterAck.Process)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.type_instances_.MergeFrom(from._impl_.type_instances_);
+  if (from._internal_has_dir_index()) {
+    _this->_internal_set_dir_index(from._internal_dir_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CGCToGCMsgMasterAck_Process::CopyFrom(const CGCToGCMsgMasterAck_Process& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CGCToGCMsgMasterAck.Process)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CGCToGCMsgMasterAck_Process::IsInitialized() const {
+  return true;
+}
+
+void CGCToGCMsgMasterAck_Process::InternalSwap(CGCToGCMsgMasterAck_Process* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.type_instances_.InternalSwap(&other->_impl_.type_instances_);
+  swap(_impl_.dir_index_, other->_impl_.dir_index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CGCToGCMsgMasterAck_Process::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[13]);
+}
+
+// ===================================================================
+
+class CGCToGCMsgMasterAck::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CGCToGCMsgMasterAck>()._impl_._has_bits_);
+  static void set_has_dir_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_machine_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_process_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CGCToGCMsgMasterAck::CGCToGCMsgMasterAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CGCToGCMsgMasterAck)
+}
+CGCToGCMsgMasterAck::CGCToGCMsgMasterAck(const CGCToGCMsgMasterAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CGCToGCMsgMasterAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.directory_){from._impl_.directory_}
+    , decltype(_impl_.machine_name_){}
+    , decltype(_impl_.process_name_){}
+    , decltype(_impl_.dir_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_machine_name()) {
+    _this->_impl_.machine_name_.Set(from._internal_machine_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.process_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.process_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_process_name()) {
+    _this->_impl_.process_name_.Set(from._internal_process_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.dir_index_ = from._impl_.dir_index_;
+  // @@protoc_insertion_point(copy_constructor:CGCToGCMsgMasterAck)
+}
+
+inline void CGCToGCMsgMasterAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.directory_){arena}
+    , decltype(_impl_.machine_name_){}
+    , decltype(_impl_.process_name_){}
+    , decltype(_impl_.dir_index_){0u}
+  };
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.process_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.process_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CGCToGCMsgMasterAck::~CGCToGCMsgMasterAck() {
+  // @@protoc_insertion_point(destructor:CGCToGCMsgMasterAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CGCToGCMsgMasterAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.directory_.~RepeatedPtrField();
+  _impl_.machine_name_.Destroy();
+  _impl_.process_name_.Destroy();
+}
+
+void CGCToGCMsgMasterAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CGCToGCMsgMasterAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:CGCToGCMsgMasterAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.directory_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.machine_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.process_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.dir_index_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CGCToGCMsgMasterAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 dir_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_dir_index(&has_bits);
+          _impl_.dir_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string machine_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_machine_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CGCToGCMsgMasterAck.machine_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string process_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_process_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CGCToGCMsgMasterAck.process_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CGCToGCMsgMasterAck.Process directory = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_directory(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CGCToGCMsgMasterAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CGCToGCMsgMasterAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 dir_index = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_dir_index(), target);
+  }
+
+  // optional string machine_name = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_machine_name().data(), static_cast<int>(this->_internal_machine_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CGCToGCMsgMasterAck.machine_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_machine_name(), target);
+  }
+
+  // optional string process_name = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_process_name().data(), static_cast<int>(this->_internal_process_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CGCToGCMsgMasterAck.process_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_process_name(), target);
+  }
+
+  // repeated .CGCToGCMsgMasterAck.Process directory = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_directory_size()); i < n; i++) {
+    const auto& repfield = this->_internal_directory(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CGCToGCMsgMasterAck)
+  return target;
+}
+
+size_t CGCToGCMsgMasterAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CGCToGCMsgMasterAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CGCToGCMsgMasterAck.Process directory = 6;
+  total_size += 1UL * this->_internal_directory_size();
+  for (const auto& msg : this->_impl_.directory_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string machine_name = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_machine_name());
+    }
+
+    // optional string process_name = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_process_name());
+    }
+
+    // optional uint32 dir_index = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dir_index());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CGCToGCMsgMasterAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CGCToGCMsgMasterAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CGCToGCMsgMasterAck::GetClassData() const { return &_class_data_; }
+
+
+void CGCToGCMsgMasterAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CGCToGCMsgMasterAck*>(&to_msg);
+  auto& from = static_cast<const CGCToGCMsgMasterAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CGCToGCMsgMasterAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.directory_.MergeFrom(from._impl_.directory_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_machine_name(from._internal_machine_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_process_name(from._internal_process_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.dir_index_ = from._impl_.dir_index_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CGCToGCMsgMasterAck::CopyFrom(const CGCToGCMsgMasterAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CGCToGCMsgMasterAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CGCToGCMsgMasterAck::IsInitialized() const {
+  return true;
+}
+
+void CGCToGCMsgMasterAck::InternalSwap(CGCToGCMsgMasterAck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.directory_.InternalSwap(&other->_impl_.directory_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.machine_name_, lhs_arena,
+      &other->_impl_.machine_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.process_name_, lhs_arena,
+      &other->_impl_.process_name_, rhs_arena
+  );
+  swap(_impl_.dir_index_, other->_impl_.dir_index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CGCToGCMsgMasterAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[14]);
+}
+
+// ===================================================================
+
+class CGCToGCMsgMasterAck_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CGCToGCMsgMasterAck_Response>()._impl_._has_bits_);
+  static void set_has_eresult(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CGCToGCMsgMasterAck_Response::CGCToGCMsgMasterAck_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CGCToGCMsgMasterAck_Response)
+}
+CGCToGCMsgMasterAck_Response::CGCToGCMsgMasterAck_Response(const CGCToGCMsgMasterAck_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CGCToGCMsgMasterAck_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.eresult_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.eresult_ = from._impl_.eresult_;
+  // @@protoc_insertion_point(copy_constructor:CGCToGCMsgMasterAck_Response)
+}
+
+inline void CGCToGCMsgMasterAck_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.eresult_){2}
+  };
+}
+
+CGCToGCMsgMasterAck_Response::~CGCToGCMsgMasterAck_Response() {
+  // @@protoc_insertion_point(destructor:CGCToGCMsgMasterAck_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CGCToGCMsgMasterAck_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CGCToGCMsgMasterAck_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CGCToGCMsgMasterAck_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:CGCToGCMsgMasterAck_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.eresult_ = 2;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CGCToGCMsgMasterAck_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 eresult = 1 [default = 2];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_eresult(&has_bits);
+          _impl_.eresult_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CGCToGCMsgMasterAck_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CGCToGCMsgMasterAck_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 eresult = 1 [default = 2];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_eresult(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CGCToGCMsgMasterAck_Response)
+  return target;
+}
+
+size_t CGCToGCMsgMasterAck_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CGCToGCMsgMasterAck_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 eresult = 1 [default = 2];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_eresult());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CGCToGCMsgMasterAck_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CGCToGCMsgMasterAck_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CGCToGCMsgMasterAck_Response::GetClassData() const { return &_class_data_; }
+
+
+void CGCToGCMsgMasterAck_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CGCToGCMsgMasterAck_Response*>(&to_msg);
+  auto& from = static_cast<const CGCToGCMsgMasterAck_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CGCToGCMsgMasterAck_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_eresult()) {
+    _this->_internal_set_eresult(from._internal_eresult());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CGCToGCMsgMasterAck_Response::CopyFrom(const CGCToGCMsgMasterAck_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CGCToGCMsgMasterAck_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CGCToGCMsgMasterAck_Response::IsInitialized() const {
+  return true;
+}
+
+void CGCToGCMsgMasterAck_Response::InternalSwap(CGCToGCMsgMasterAck_Response* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.eresult_, other->_impl_.eresult_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CGCToGCMsgMasterAck_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[15]);
+}
+
+// ===================================================================
+
+class CGCToGCMsgMasterStartupComplete_GCInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CGCToGCMsgMasterStartupComplete_GCInfo>()._impl_._has_bits_);
+  static void set_has_dir_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_machine_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CGCToGCMsgMasterStartupComplete_GCInfo::CGCToGCMsgMasterStartupComplete_GCInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CGCToGCMsgMasterStartupComplete.GCInfo)
+}
+CGCToGCMsgMasterStartupComplete_GCInfo::CGCToGCMsgMasterStartupComplete_GCInfo(const CGCToGCMsgMasterStartupComplete_GCInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CGCToGCMsgMasterStartupComplete_GCInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_name_){}
+    , decltype(_impl_.dir_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_machine_name()) {
+    _this->_impl_.machine_name_.Set(from._internal_machine_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.dir_index_ = from._impl_.dir_index_;
+  // @@protoc_insertion_point(copy_constructor:CGCToGCMsgMasterStartupComplete.GCInfo)
+}
+
+inline void CGCToGCMsgMasterStartupComplete_GCInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.machine_name_){}
+    , decltype(_impl_.dir_index_){0u}
+  };
+  _impl_.machine_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CGCToGCMsgMasterStartupComplete_GCInfo::~CGCToGCMsgMasterStartupComplete_GCInfo() {
+  // @@protoc_insertion_point(destructor:CGCToGCMsgMasterStartupComplete.GCInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CGCToGCMsgMasterStartupComplete_GCInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.machine_name_.Destroy();
+}
+
+void CGCToGCMsgMasterStartupComplete_GCInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CGCToGCMsgMasterStartupComplete_GCInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:CGCToGCMsgMasterStartupComplete.GCInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.machine_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.dir_index_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CGCToGCMsgMasterStartupComplete_GCInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 dir_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_dir_index(&has_bits);
+          _impl_.dir_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string machine_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_machine_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CGCToGCMsgMasterStartupComplete.GCInfo.machine_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CGCToGCMsgMasterStartupComplete_GCInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CGCToGCMsgMasterStartupComplete.GCInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 dir_index = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_dir_index(), target);
+  }
+
+  // optional string machine_name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_machine_name().data(), static_cast<int>(this->_internal_machine_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CGCToGCMsgMasterStartupComplete.GCInfo.machine_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_machine_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CGCToGCMsgMasterStartupComplete.GCInfo)
+  return target;
+}
+
+size_t CGCToGCMsgMasterStartupComplete_GCInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CGCToGCMsgMasterStartupComplete.GCInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string machine_name = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_machine_name());
+    }
+
+    // optional uint32 dir_index = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dir_index());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CGCToGCMsgMasterStartupComplete_GCInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CGCToGCMsgMasterStartupComplete_GCInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CGCToGCMsgMasterStartupComplete_GCInfo::GetClassData() const { return &_class_data_; }
+
+
+void CGCToGCMsgMasterStartupComplete_GCInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CGCToGCMsgMasterStartupComplete_GCInfo*>(&to_msg);
+  auto& from = static_cast<const CGCToGCMsgMasterStartupComplete_GCInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CGCToGCMsgMasterStartupComplete.GCInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_machine_name(from._internal_machine_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.dir_index_ = from._impl_.dir_index_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CGCToGCMsgMasterStartupComplete_GCInfo::CopyFrom(const CGCToGCMsgMasterStartupComplete_GCInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CGCToGCMsgMasterStartupComplete.GCInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CGCToGCMsgMasterStartupComplete_GCInfo::IsInitialized() const {
+  return true;
+}
+
+void CGCToGCMsgMasterStartupComplete_GCInfo::InternalSwap(CGCToGCMsgMasterStartupComplete_GCInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.machine_name_, lhs_arena,
+      &other->_impl_.machine_name_, rhs_arena
+  );
+  swap(_impl_.dir_index_, other->_impl_.dir_index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CGCToGCMsgMasterStartupComplete_GCInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[16]);
+}
+
+// ===================================================================
+
+class CGCToGCMsgMasterStartupComplete::_Internal {
+ public:
+};
+
+CGCToGCMsgMasterStartupComplete::CGCToGCMsgMasterStartupComplete(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CGCToGCMsgMasterStartupComplete)
+}
+CGCToGCMsgMasterStartupComplete::CGCToGCMsgMasterStartupComplete(const CGCToGCMsgMasterStartupComplete& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CGCToGCMsgMasterStartupComplete* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gc_info_){from._impl_.gc_info_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CGCToGCMsgMasterStartupComplete)
+}
+
+inline void CGCToGCMsgMasterStartupComplete::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gc_info_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CGCToGCMsgMasterStartupComplete::~CGCToGCMsgMasterStartupComplete() {
+  // @@protoc_insertion_point(destructor:CGCToGCMsgMasterStartupComplete)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CGCToGCMsgMasterStartupComplete::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.gc_info_.~RepeatedPtrField();
+}
+
+void CGCToGCMsgMasterStartupComplete::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CGCToGCMsgMasterStartupComplete::Clear() {
+// @@protoc_insertion_point(message_clear_start:CGCToGCMsgMasterStartupComplete)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.gc_info_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CGCToGCMsgMasterStartupComplete::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CGCToGCMsgMasterStartupComplete.GCInfo gc_info = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_gc_info(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CGCToGCMsgMasterStartupComplete::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CGCToGCMsgMasterStartupComplete)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CGCToGCMsgMasterStartupComplete.GCInfo gc_info = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_gc_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_gc_info(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CGCToGCMsgMasterStartupComplete)
+  return target;
+}
+
+size_t CGCToGCMsgMasterStartupComplete::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CGCToGCMsgMasterStartupComplete)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CGCToGCMsgMasterStartupComplete.GCInfo gc_info = 1;
+  total_size += 1UL * this->_internal_gc_info_size();
+  for (const auto& msg : this->_impl_.gc_info_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CGCToGCMsgMasterStartupComplete::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CGCToGCMsgMasterStartupComplete::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CGCToGCMsgMasterStartupComplete::GetClassData() const { return &_class_data_; }
+
+
+void CGCToGCMsgMasterStartupComplete::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CGCToGCMsgMasterStartupComplete*>(&to_msg);
+  auto& from = static_cast<const CGCToGCMsgMasterStartupComplete&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CGCToGCMsgMasterStartupComplete)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.gc_info_.MergeFrom(from._impl_.gc_info_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CGCToGCMsgMasterStartupComplete::CopyFrom(const CGCToGCMsgMasterStartupComplete& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CGCToGCMsgMasterStartupComplete)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CGCToGCMsgMasterStartupComplete::IsInitialized() const {
+  return true;
+}
+
+void CGCToGCMsgMasterStartupComplete::InternalSwap(CGCToGCMsgMasterStartupComplete* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.gc_info_.InternalSwap(&other->_impl_.gc_info_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CGCToGCMsgMasterStartupComplete::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[17]);
+}
+
+// ===================================================================
+
+class CGCToGCMsgRouted::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CGCToGCMsgRouted>()._impl_._has_bits_);
+  static void set_has_msg_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_sender_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_net_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CGCToGCMsgRouted::CGCToGCMsgRouted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CGCToGCMsgRouted)
+}
+CGCToGCMsgRouted::CGCToGCMsgRouted(const CGCToGCMsgRouted& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CGCToGCMsgRouted* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.net_message_){}
+    , decltype(_impl_.sender_id_){}
+    , decltype(_impl_.msg_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.net_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.net_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_net_message()) {
+    _this->_impl_.net_message_.Set(from._internal_net_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sender_id_, &from._impl_.sender_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.msg_type_) -
+    reinterpret_cast<char*>(&_impl_.sender_id_)) + sizeof(_impl_.msg_type_));
+  // @@protoc_insertion_point(copy_constructor:CGCToGCMsgRouted)
+}
+
+inline void CGCToGCMsgRouted::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.net_message_){}
+    , decltype(_impl_.sender_id_){uint64_t{0u}}
+    , decltype(_impl_.msg_type_){0u}
+  };
+  _impl_.net_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.net_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CGCToGCMsgRouted::~CGCToGCMsgRouted() {
+  // @@protoc_insertion_point(destructor:CGCToGCMsgRouted)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CGCToGCMsgRouted::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.net_message_.Destroy();
+}
+
+void CGCToGCMsgRouted::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CGCToGCMsgRouted::Clear() {
+// @@protoc_insertion_point(message_clear_start:CGCToGCMsgRouted)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.net_message_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.sender_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.msg_type_) -
+        reinterpret_cast<char*>(&_impl_.sender_id_)) + sizeof(_impl_.msg_type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CGCToGCMsgRouted::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 msg_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_msg_type(&has_bits);
+          _impl_.msg_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 sender_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_sender_id(&has_bits);
+          _impl_.sender_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes net_message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_net_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CGCToGCMsgRouted::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CGCToGCMsgRouted)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 msg_type = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_msg_type(), target);
+  }
+
+  // optional fixed64 sender_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_sender_id(), target);
+  }
+
+  // optional bytes net_message = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_net_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CGCToGCMsgRouted)
+  return target;
+}
+
+size_t CGCToGCMsgRouted::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CGCToGCMsgRouted)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bytes net_message = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_net_message());
+    }
+
+    // optional fixed64 sender_id = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 msg_type = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_msg_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CGCToGCMsgRouted::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CGCToGCMsgRouted::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CGCToGCMsgRouted::GetClassData() const { return &_class_data_; }
+
+
+void CGCToGCMsgRouted::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CGCToGCMsgRouted*>(&to_msg);
+  auto& from = static_cast<const CGCToGCMsgRouted&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CGCToGCMsgRouted)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_net_message(from._internal_net_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.sender_id_ = from._impl_.sender_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.msg_type_ = from._impl_.msg_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CGCToGCMsgRouted::CopyFrom(const CGCToGCMsgRouted& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CGCToGCMsgRouted)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CGCToGCMsgRouted::IsInitialized() const {
+  return true;
+}
+
+void CGCToGCMsgRouted::InternalSwap(CGCToGCMsgRouted* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.net_message_, lhs_arena,
+      &other->_impl_.net_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CGCToGCMsgRouted, _impl_.msg_type_)
+      + sizeof(CGCToGCMsgRouted::_impl_.msg_type_)
+      - PROTOBUF_FIELD_OFFSET(CGCToGCMsgRouted, _impl_.sender_id_)>(
+          reinterpret_cast<char*>(&_impl_.sender_id_),
+          reinterpret_cast<char*>(&other->_impl_.sender_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CGCToGCMsgRouted::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[18]);
+}
+
+// ===================================================================
+
+class CGCToGCMsgRoutedReply::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CGCToGCMsgRoutedReply>()._impl_._has_bits_);
+  static void set_has_msg_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_net_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CGCToGCMsgRoutedReply::CGCToGCMsgRoutedReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CGCToGCMsgRoutedReply)
+}
+CGCToGCMsgRoutedReply::CGCToGCMsgRoutedReply(const CGCToGCMsgRoutedReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CGCToGCMsgRoutedReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.net_message_){}
+    , decltype(_impl_.msg_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.net_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.net_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_net_message()) {
+    _this->_impl_.net_message_.Set(from._internal_net_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.msg_type_ = from._impl_.msg_type_;
+  // @@protoc_insertion_point(copy_constructor:CGCToGCMsgRoutedReply)
+}
+
+inline void CGCToGCMsgRoutedReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.net_message_){}
+    , decltype(_impl_.msg_type_){0u}
+  };
+  _impl_.net_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.net_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CGCToGCMsgRoutedReply::~CGCToGCMsgRoutedReply() {
+  // @@protoc_insertion_point(destructor:CGCToGCMsgRoutedReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CGCToGCMsgRoutedReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.net_message_.Destroy();
+}
+
+void CGCToGCMsgRoutedReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CGCToGCMsgRoutedReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:CGCToGCMsgRoutedReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.net_message_.ClearNonDefaultToEmpty();
+  }
+  _impl_.msg_type_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CGCToGCMsgRoutedReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 msg_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_msg_type(&has_bits);
+          _impl_.msg_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes net_message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_net_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CGCToGCMsgRoutedReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CGCToGCMsgRoutedReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 msg_type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_msg_type(), target);
+  }
+
+  // optional bytes net_message = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_net_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CGCToGCMsgRoutedReply)
+  return target;
+}
+
+size_t CGCToGCMsgRoutedReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CGCToGCMsgRoutedReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes net_message = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_net_message());
+    }
+
+    // optional uint32 msg_type = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_msg_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CGCToGCMsgRoutedReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CGCToGCMsgRoutedReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CGCToGCMsgRoutedReply::GetClassData() const { return &_class_data_; }
+
+
+void CGCToGCMsgRoutedReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CGCToGCMsgRoutedReply*>(&to_msg);
+  auto& from = static_cast<const CGCToGCMsgRoutedReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CGCToGCMsgRoutedReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_net_message(from._internal_net_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.msg_type_ = from._impl_.msg_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CGCToGCMsgRoutedReply::CopyFrom(const CGCToGCMsgRoutedReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CGCToGCMsgRoutedReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CGCToGCMsgRoutedReply::IsInitialized() const {
+  return true;
+}
+
+void CGCToGCMsgRoutedReply::InternalSwap(CGCToGCMsgRoutedReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.net_message_, lhs_arena,
+      &other->_impl_.net_message_, rhs_arena
+  );
+  swap(_impl_.msg_type_, other->_impl_.msg_type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CGCToGCMsgRoutedReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[19]);
+}
+
+// ===================================================================
+
+class CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgGCUpdateSubGCSessionInfo_CMsgUpdate>()._impl_._has_bits_);
+  static void set_has_steamid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_trusted(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+}
+CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate(const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.steamid_){}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.trusted_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.steamid_, &from._impl_.steamid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.trusted_) -
+    reinterpret_cast<char*>(&_impl_.steamid_)) + sizeof(_impl_.trusted_));
+  // @@protoc_insertion_point(copy_constructor:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+}
+
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.steamid_){uint64_t{0u}}
+    , decltype(_impl_.ip_){0u}
+    , decltype(_impl_.trusted_){false}
+  };
+}
+
+CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::~CMsgGCUpdateSubGCSessionInfo_CMsgUpdate() {
+  // @@protoc_insertion_point(destructor:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.steamid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.trusted_) -
+        reinterpret_cast<char*>(&_impl_.steamid_)) + sizeof(_impl_.trusted_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed64 steamid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_steamid(&has_bits);
+          _impl_.steamid_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 ip = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_ip(&has_bits);
+          _impl_.ip_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool trusted = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_trusted(&has_bits);
+          _impl_.trusted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed64 steamid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_steamid(), target);
+  }
+
+  // optional fixed32 ip = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(2, this->_internal_ip(), target);
+  }
+
+  // optional bool trusted = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_trusted(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+  return target;
+}
+
+size_t CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional fixed64 steamid = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed32 ip = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool trusted = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCUpdateSubGCSessionInfo_CMsgUpdate*>(&to_msg);
+  auto& from = static_cast<const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.steamid_ = from._impl_.steamid_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.ip_ = from._impl_.ip_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.trusted_ = from._impl_.trusted_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::CopyFrom(const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::InternalSwap(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate, _impl_.trusted_)
+      + sizeof(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_impl_.trusted_)
+      - PROTOBUF_FIELD_OFFSET(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate, _impl_.steamid_)>(
+          reinterpret_cast<char*>(&_impl_.steamid_),
+          reinterpret_cast<char*>(&other->_impl_.steamid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[20]);
+}
+
+// ===================================================================
+
+class CMsgGCUpdateSubGCSessionInfo::_Internal {
+ public:
+};
+
+CMsgGCUpdateSubGCSessionInfo::CMsgGCUpdateSubGCSessionInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCUpdateSubGCSessionInfo)
+}
+CMsgGCUpdateSubGCSessionInfo::CMsgGCUpdateSubGCSessionInfo(const CMsgGCUpdateSubGCSessionInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCUpdateSubGCSessionInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.updates_){from._impl_.updates_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CMsgGCUpdateSubGCSessionInfo)
+}
+
+inline void CMsgGCUpdateSubGCSessionInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.updates_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CMsgGCUpdateSubGCSessionInfo::~CMsgGCUpdateSubGCSessionInfo() {
+  // @@protoc_insertion_point(destructor:CMsgGCUpdateSubGCSessionInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCUpdateSubGCSessionInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.updates_.~RepeatedPtrField();
+}
+
+void CMsgGCUpdateSubGCSessionInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCUpdateSubGCSessionInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCUpdateSubGCSessionInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.updates_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCUpdateSubGCSessionInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CMsgGCUpdateSubGCSessionInfo.CMsgUpdate updates = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_updates(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCUpdateSubGCSessionInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCUpdateSubGCSessionInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CMsgGCUpdateSubGCSessionInfo.CMsgUpdate updates = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_updates_size()); i < n; i++) {
+    const auto& repfield = this->_internal_updates(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCUpdateSubGCSessionInfo)
+  return target;
+}
+
+size_t CMsgGCUpdateSubGCSessionInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCUpdateSubGCSessionInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CMsgGCUpdateSubGCSessionInfo.CMsgUpdate updates = 1;
+  total_size += 1UL * this->_internal_updates_size();
+  for (const auto& msg : this->_impl_.updates_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCUpdateSubGCSessionInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCUpdateSubGCSessionInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCUpdateSubGCSessionInfo::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCUpdateSubGCSessionInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCUpdateSubGCSessionInfo*>(&to_msg);
+  auto& from = static_cast<const CMsgGCUpdateSubGCSessionInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCUpdateSubGCSessionInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.updates_.MergeFrom(from._impl_.updates_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCUpdateSubGCSessionInfo::CopyFrom(const CMsgGCUpdateSubGCSessionInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCUpdateSubGCSessionInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCUpdateSubGCSessionInfo::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCUpdateSubGCSessionInfo::InternalSwap(CMsgGCUpdateSubGCSessionInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.updates_.InternalSwap(&other->_impl_.updates_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCUpdateSubGCSessionInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[21]);
+}
+
+// ===================================================================
+
+class CMsgGCRequestSubGCSessionInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgGCRequestSubGCSessionInfo>()._impl_._has_bits_);
+  static void set_has_steamid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CMsgGCRequestSubGCSessionInfo::CMsgGCRequestSubGCSessionInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCRequestSubGCSessionInfo)
+}
+CMsgGCRequestSubGCSessionInfo::CMsgGCRequestSubGCSessionInfo(const CMsgGCRequestSubGCSessionInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCRequestSubGCSessionInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.steamid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.steamid_ = from._impl_.steamid_;
+  // @@protoc_insertion_point(copy_constructor:CMsgGCRequestSubGCSessionInfo)
+}
+
+inline void CMsgGCRequestSubGCSessionInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.steamid_){uint64_t{0u}}
+  };
+}
+
+CMsgGCRequestSubGCSessionInfo::~CMsgGCRequestSubGCSessionInfo() {
+  // @@protoc_insertion_point(destructor:CMsgGCRequestSubGCSessionInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCRequestSubGCSessionInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgGCRequestSubGCSessionInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCRequestSubGCSessionInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCRequestSubGCSessionInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.steamid_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCRequestSubGCSessionInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed64 steamid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_steamid(&has_bits);
+          _impl_.steamid_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCRequestSubGCSessionInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCRequestSubGCSessionInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed64 steamid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_steamid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCRequestSubGCSessionInfo)
+  return target;
+}
+
+size_t CMsgGCRequestSubGCSessionInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCRequestSubGCSessionInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional fixed64 steamid = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCRequestSubGCSessionInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCRequestSubGCSessionInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCRequestSubGCSessionInfo::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCRequestSubGCSessionInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCRequestSubGCSessionInfo*>(&to_msg);
+  auto& from = static_cast<const CMsgGCRequestSubGCSessionInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCRequestSubGCSessionInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_steamid()) {
+    _this->_internal_set_steamid(from._internal_steamid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCRequestSubGCSessionInfo::CopyFrom(const CMsgGCRequestSubGCSessionInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCRequestSubGCSessionInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCRequestSubGCSessionInfo::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCRequestSubGCSessionInfo::InternalSwap(CMsgGCRequestSubGCSessionInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.steamid_, other->_impl_.steamid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCRequestSubGCSessionInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[22]);
+}
+
+// ===================================================================
+
+class CMsgGCRequestSubGCSessionInfoResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgGCRequestSubGCSessionInfoResponse>()._impl_._has_bits_);
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_trusted(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CMsgGCRequestSubGCSessionInfoResponse::CMsgGCRequestSubGCSessionInfoResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCRequestSubGCSessionInfoResponse)
+}
+CMsgGCRequestSubGCSessionInfoResponse::CMsgGCRequestSubGCSessionInfoResponse(const CMsgGCRequestSubGCSessionInfoResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCRequestSubGCSessionInfoResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.trusted_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ip_, &from._impl_.ip_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.trusted_) -
+    reinterpret_cast<char*>(&_impl_.ip_)) + sizeof(_impl_.trusted_));
+  // @@protoc_insertion_point(copy_constructor:CMsgGCRequestSubGCSessionInfoResponse)
+}
+
+inline void CMsgGCRequestSubGCSessionInfoResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){0u}
+    , decltype(_impl_.trusted_){false}
+  };
+}
+
+CMsgGCRequestSubGCSessionInfoResponse::~CMsgGCRequestSubGCSessionInfoResponse() {
+  // @@protoc_insertion_point(destructor:CMsgGCRequestSubGCSessionInfoResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCRequestSubGCSessionInfoResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgGCRequestSubGCSessionInfoResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCRequestSubGCSessionInfoResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCRequestSubGCSessionInfoResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.ip_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.trusted_) -
+        reinterpret_cast<char*>(&_impl_.ip_)) + sizeof(_impl_.trusted_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCRequestSubGCSessionInfoResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed32 ip = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_ip(&has_bits);
+          _impl_.ip_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool trusted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_trusted(&has_bits);
+          _impl_.trusted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCRequestSubGCSessionInfoResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCRequestSubGCSessionInfoResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed32 ip = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_ip(), target);
+  }
+
+  // optional bool trusted = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_trusted(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCRequestSubGCSessionInfoResponse)
+  return target;
+}
+
+size_t CMsgGCRequestSubGCSessionInfoResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCRequestSubGCSessionInfoResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional fixed32 ip = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool trusted = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCRequestSubGCSessionInfoResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCRequestSubGCSessionInfoResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCRequestSubGCSessionInfoResponse::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCRequestSubGCSessionInfoResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCRequestSubGCSessionInfoResponse*>(&to_msg);
+  auto& from = static_cast<const CMsgGCRequestSubGCSessionInfoResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCRequestSubGCSessionInfoResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.ip_ = from._impl_.ip_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.trusted_ = from._impl_.trusted_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCRequestSubGCSessionInfoResponse::CopyFrom(const CMsgGCRequestSubGCSessionInfoResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCRequestSubGCSessionInfoResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCRequestSubGCSessionInfoResponse::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCRequestSubGCSessionInfoResponse::InternalSwap(CMsgGCRequestSubGCSessionInfoResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgGCRequestSubGCSessionInfoResponse, _impl_.trusted_)
+      + sizeof(CMsgGCRequestSubGCSessionInfoResponse::_impl_.trusted_)
+      - PROTOBUF_FIELD_OFFSET(CMsgGCRequestSubGCSessionInfoResponse, _impl_.ip_)>(
+          reinterpret_cast<char*>(&_impl_.ip_),
+          reinterpret_cast<char*>(&other->_impl_.ip_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCRequestSubGCSessionInfoResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[23]);
+}
+
+// ===================================================================
+
+class CMsgSOCacheHaveVersion::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgSOCacheHaveVersion>()._impl_._has_bits_);
+  static const ::CMsgSOIDOwner& soid(const CMsgSOCacheHaveVersion* msg);
+  static void set_has_soid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_service_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_cached_file_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::CMsgSOIDOwner&
+CMsgSOCacheHaveVersion::_Internal::soid(const CMsgSOCacheHaveVersion* msg) {
+  return *msg->_impl_.soid_;
+}
+CMsgSOCacheHaveVersion::CMsgSOCacheHaveVersion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgSOCacheHaveVersion)
+}
+CMsgSOCacheHaveVersion::CMsgSOCacheHaveVersion(const CMsgSOCacheHaveVersion& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgSOCacheHaveVersion* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.soid_){nullptr}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.service_id_){}
+    , decltype(_impl_.cached_file_version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_soid()) {
+    _this->_impl_.soid_ = new ::CMsgSOIDOwner(*from._impl_.soid_);
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cached_file_version_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.cached_file_version_));
+  // @@protoc_insertion_point(copy_constructor:CMsgSOCacheHaveVersion)
+}
+
+inline void CMsgSOCacheHaveVersion::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.soid_){nullptr}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.service_id_){0u}
+    , decltype(_impl_.cached_file_version_){0u}
+  };
+}
+
+CMsgSOCacheHaveVersion::~CMsgSOCacheHaveVersion() {
+  // @@protoc_insertion_point(destructor:CMsgSOCacheHaveVersion)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgSOCacheHaveVersion::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.soid_;
+}
+
+void CMsgSOCacheHaveVersion::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgSOCacheHaveVersion::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgSOCacheHaveVersion)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.soid_ != nullptr);
+    _impl_.soid_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.cached_file_version_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.cached_file_version_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgSOCacheHaveVersion::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .CMsgSOIDOwner soid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_soid(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 service_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_service_id(&has_bits);
+          _impl_.service_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 cached_file_version = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_cached_file_version(&has_bits);
+          _impl_.cached_file_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgSOCacheHaveVersion::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgSOCacheHaveVersion)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .CMsgSOIDOwner soid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::soid(this),
+        _Internal::soid(this).GetCachedSize(), target, stream);
+  }
+
+  // optional fixed64 version = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_version(), target);
+  }
+
+  // optional uint32 service_id = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_service_id(), target);
+  }
+
+  // optional uint32 cached_file_version = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_cached_file_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgSOCacheHaveVersion)
+  return target;
+}
+
+size_t CMsgSOCacheHaveVersion::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgSOCacheHaveVersion)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional .CMsgSOIDOwner soid = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.soid_);
+    }
+
+    // optional fixed64 version = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 service_id = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_service_id());
+    }
+
+    // optional uint32 cached_file_version = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cached_file_version());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgSOCacheHaveVersion::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgSOCacheHaveVersion::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgSOCacheHaveVersion::GetClassData() const { return &_class_data_; }
+
+
+void CMsgSOCacheHaveVersion::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgSOCacheHaveVersion*>(&to_msg);
+  auto& from = static_cast<const CMsgSOCacheHaveVersion&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgSOCacheHaveVersion)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_soid()->::CMsgSOIDOwner::MergeFrom(
+          from._internal_soid());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.service_id_ = from._impl_.service_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.cached_file_version_ = from._impl_.cached_file_version_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgSOCacheHaveVersion::CopyFrom(const CMsgSOCacheHaveVersion& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgSOCacheHaveVersion)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgSOCacheHaveVersion::IsInitialized() const {
+  return true;
+}
+
+void CMsgSOCacheHaveVersion::InternalSwap(CMsgSOCacheHaveVersion* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgSOCacheHaveVersion, _impl_.cached_file_version_)
+      + sizeof(CMsgSOCacheHaveVersion::_impl_.cached_file_version_)
+      - PROTOBUF_FIELD_OFFSET(CMsgSOCacheHaveVersion, _impl_.soid_)>(
+          reinterpret_cast<char*>(&_impl_.soid_),
+          reinterpret_cast<char*>(&other->_impl_.soid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgSOCacheHaveVersion::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[24]);
+}
+
+// ===================================================================
+
+class CMsgClientHello::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgClientHello>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_client_session_need(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_client_launcher(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_secret_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_client_language(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_engine(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+CMsgClientHello::CMsgClientHello(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgClientHello)
+}
+CMsgClientHello::CMsgClientHello(const CMsgClientHello& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgClientHello* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.socache_have_versions_){from._impl_.socache_have_versions_}
+    , decltype(_impl_.secret_key_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.client_session_need_){}
+    , decltype(_impl_.client_launcher_){}
+    , decltype(_impl_.client_language_){}
+    , decltype(_impl_.engine_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.secret_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.secret_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_secret_key()) {
+    _this->_impl_.secret_key_.Set(from._internal_secret_key(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.engine_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.engine_));
+  // @@protoc_insertion_point(copy_constructor:CMsgClientHello)
+}
+
+inline void CMsgClientHello::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.socache_have_versions_){arena}
+    , decltype(_impl_.secret_key_){}
+    , decltype(_impl_.version_){0u}
+    , decltype(_impl_.client_session_need_){0u}
+    , decltype(_impl_.client_launcher_){0}
+    , decltype(_impl_.client_language_){0u}
+    , decltype(_impl_.engine_){0}
+  };
+  _impl_.secret_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.secret_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CMsgClientHello::~CMsgClientHello() {
+  // @@protoc_insertion_point(destructor:CMsgClientHello)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgClientHello::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.socache_have_versions_.~RepeatedPtrField();
+  _impl_.secret_key_.Destroy();
+}
+
+void CMsgClientHello::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgClientHello::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgClientHello)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.socache_have_versions_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.secret_key_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.engine_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.engine_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgClientHello::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CMsgSOCacheHaveVersion socache_have_versions = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_socache_have_versions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 client_session_need = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_client_session_need(&has_bits);
+          _impl_.client_session_need_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .PartnerAccountType client_launcher = 4 [default = PARTNER_NONE];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::PartnerAccountType_IsValid(val))) {
+            _internal_set_client_launcher(static_cast<::PartnerAccountType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string secret_key = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_secret_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CMsgClientHello.secret_key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 client_language = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_client_language(&has_bits);
+          _impl_.client_language_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ESourceEngine engine = 7 [default = k_ESE_Source1];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ESourceEngine_IsValid(val))) {
+            _internal_set_engine(static_cast<::ESourceEngine>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(7, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgClientHello::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgClientHello)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 version = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_version(), target);
+  }
+
+  // repeated .CMsgSOCacheHaveVersion socache_have_versions = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_socache_have_versions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_socache_have_versions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 client_session_need = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_client_session_need(), target);
+  }
+
+  // optional .PartnerAccountType client_launcher = 4 [default = PARTNER_NONE];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_client_launcher(), target);
+  }
+
+  // optional string secret_key = 5;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_secret_key().data(), static_cast<int>(this->_internal_secret_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CMsgClientHello.secret_key");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_secret_key(), target);
+  }
+
+  // optional uint32 client_language = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_client_language(), target);
+  }
+
+  // optional .ESourceEngine engine = 7 [default = k_ESE_Source1];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_engine(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgClientHello)
+  return target;
+}
+
+size_t CMsgClientHello::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgClientHello)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CMsgSOCacheHaveVersion socache_have_versions = 2;
+  total_size += 1UL * this->_internal_socache_have_versions_size();
+  for (const auto& msg : this->_impl_.socache_have_versions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string secret_key = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_secret_key());
+    }
+
+    // optional uint32 version = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_version());
+    }
+
+    // optional uint32 client_session_need = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_session_need());
+    }
+
+    // optional .PartnerAccountType client_launcher = 4 [default = PARTNER_NONE];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_client_launcher());
+    }
+
+    // optional uint32 client_language = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_language());
+    }
+
+    // optional .ESourceEngine engine = 7 [default = k_ESE_Source1];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgClientHello::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgClientHello::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgClientHello::GetClassData() const { return &_class_data_; }
+
+
+void CMsgClientHello::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgClientHello*>(&to_msg);
+  auto& from = static_cast<const CMsgClientHello&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgClientHello)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.socache_have_versions_.MergeFrom(from._impl_.socache_have_versions_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_secret_key(from._internal_secret_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.client_session_need_ = from._impl_.client_session_need_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.client_launcher_ = from._impl_.client_launcher_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.client_language_ = from._impl_.client_language_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.engine_ = from._impl_.engine_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgClientHello::CopyFrom(const CMsgClientHello& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgClientHello)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgClientHello::IsInitialized() const {
+  return true;
+}
+
+void CMsgClientHello::InternalSwap(CMsgClientHello* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.socache_have_versions_.InternalSwap(&other->_impl_.socache_have_versions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.secret_key_, lhs_arena,
+      &other->_impl_.secret_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgClientHello, _impl_.engine_)
+      + sizeof(CMsgClientHello::_impl_.engine_)
+      - PROTOBUF_FIELD_OFFSET(CMsgClientHello, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgClientHello::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[25]);
+}
+
+// ===================================================================
+
+class CMsgClientWelcome_Location::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgClientWelcome_Location>()._impl_._has_bits_);
+  static void set_has_latitude(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_longitude(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_country(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CMsgClientWelcome_Location::CMsgClientWelcome_Location(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgClientWelcome.Location)
+}
+CMsgClientWelcome_Location::CMsgClientWelcome_Location(const CMsgClientWelcome_Location& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgClientWelcome_Location* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.country_){}
+    , decltype(_impl_.latitude_){}
+    , decltype(_impl_.longitude_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.country_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.country_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_country()) {
+    _this->_impl_.country_.Set(from._internal_country(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.latitude_, &from._impl_.latitude_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.longitude_) -
+    reinterpret_cast<char*>(&_impl_.latitude_)) + sizeof(_impl_.longitude_));
+  // @@protoc_insertion_point(copy_constructor:CMsgClientWelcome.Location)
+}
+
+inline void CMsgClientWelcome_Location::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.country_){}
+    , decltype(_impl_.latitude_){0}
+    , decltype(_impl_.longitude_){0}
+  };
+  _impl_.country_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.country_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CMsgClientWelcome_Location::~CMsgClientWelcome_Location() {
+  // @@protoc_insertion_point(destructor:CMsgClientWelcome.Location)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgClientWelcome_Location::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.country_.Destroy();
+}
+
+void CMsgClientWelcome_Location::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgClientWelcome_Location::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgClientWelcome.Location)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.country_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.latitude_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.longitude_) -
+        reinterpret_cast<char*>(&_impl_.latitude_)) + sizeof(_impl_.longitude_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgClientWelcome_Location::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float latitude = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_latitude(&has_bits);
+          _impl_.latitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float longitude = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_longitude(&has_bits);
+          _impl_.longitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string country = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_country();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CMsgClientWelcome.Location.country");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgClientWelcome_Location::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgClientWelcome.Location)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float latitude = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_latitude(), target);
+  }
+
+  // optional float longitude = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_longitude(), target);
+  }
+
+  // optional string country = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_country().data(), static_cast<int>(this->_internal_country().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CMsgClientWelcome.Location.country");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_country(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgClientWelcome.Location)
+  return target;
+}
+
+size_t CMsgClientWelcome_Location::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgClientWelcome.Location)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string country = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_country());
+    }
+
+    // optional float latitude = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float longitude = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgClientWelcome_Location::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgClientWelcome_Location::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgClientWelcome_Location::GetClassData() const { return &_class_data_; }
+
+
+void CMsgClientWelcome_Location::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgClientWelcome_Location*>(&to_msg);
+  auto& from = static_cast<const CMsgClientWelcome_Location&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgClientWelcome.Location)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_country(from._internal_country());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.latitude_ = from._impl_.latitude_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.longitude_ = from._impl_.longitude_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgClientWelcome_Location::CopyFrom(const CMsgClientWelcome_Location& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgClientWelcome.Location)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgClientWelcome_Location::IsInitialized() const {
+  return true;
+}
+
+void CMsgClientWelcome_Location::InternalSwap(CMsgClientWelcome_Location* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.country_, lhs_arena,
+      &other->_impl_.country_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgClientWelcome_Location, _impl_.longitude_)
+      + sizeof(CMsgClientWelcome_Location::_impl_.longitude_)
+      - PROTOBUF_FIELD_OFFSET(CMsgClientWelcome_Location, _impl_.latitude_)>(
+          reinterpret_cast<char*>(&_impl_.latitude_),
+          reinterpret_cast<char*>(&other->_impl_.latitude_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgClientWelcome_Location::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[26]);
+}
+
+// ===================================================================
+
+class CMsgClientWelcome::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgClientWelcome>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_game_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::CMsgClientWelcome_Location& location(const CMsgClientWelcome* msg);
+  static void set_has_location(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_save_game_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::CMsgClientWelcome_Location&
+CMsgClientWelcome::_Internal::location(const CMsgClientWelcome* msg) {
+  return *msg->_impl_.location_;
+}
+CMsgClientWelcome::CMsgClientWelcome(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgClientWelcome)
+}
+CMsgClientWelcome::CMsgClientWelcome(const CMsgClientWelcome& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgClientWelcome* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.outofdate_subscribed_caches_){from._impl_.outofdate_subscribed_caches_}
+    , decltype(_impl_.uptodate_subscribed_caches_){from._impl_.uptodate_subscribed_caches_}
+    , decltype(_impl_.game_data_){}
+    , decltype(_impl_.save_game_key_){}
+    , decltype(_impl_.location_){nullptr}
+    , decltype(_impl_.version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.game_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.game_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_game_data()) {
+    _this->_impl_.game_data_.Set(from._internal_game_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.save_game_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.save_game_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_save_game_key()) {
+    _this->_impl_.save_game_key_.Set(from._internal_save_game_key(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_location()) {
+    _this->_impl_.location_ = new ::CMsgClientWelcome_Location(*from._impl_.location_);
+  }
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:CMsgClientWelcome)
+}
+
+inline void CMsgClientWelcome::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.outofdate_subscribed_caches_){arena}
+    , decltype(_impl_.uptodate_subscribed_caches_){arena}
+    , decltype(_impl_.game_data_){}
+    , decltype(_impl_.save_game_key_){}
+    , decltype(_impl_.location_){nullptr}
+    , decltype(_impl_.version_){0u}
+  };
+  _impl_.game_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.game_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.save_game_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.save_game_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CMsgClientWelcome::~CMsgClientWelcome() {
+  // @@protoc_insertion_point(destructor:CMsgClientWelcome)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgClientWelcome::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.outofdate_subscribed_caches_.~RepeatedPtrField();
+  _impl_.uptodate_subscribed_caches_.~RepeatedPtrField();
+  _impl_.game_data_.Destroy();
+  _impl_.save_game_key_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.location_;
+}
+
+void CMsgClientWelcome::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgClientWelcome::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgClientWelcome)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.outofdate_subscribed_caches_.Clear();
+  _impl_.uptodate_subscribed_caches_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.game_data_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.save_game_key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.location_ != nullptr);
+      _impl_.location_->Clear();
+    }
+  }
+  _impl_.version_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgClientWelcome::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes game_data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_game_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CMsgSOCacheSubscribed outofdate_subscribed_caches = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_outofdate_subscribed_caches(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CMsgSOCacheSubscriptionCheck uptodate_subscribed_caches = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_uptodate_subscribed_caches(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CMsgClientWelcome.Location location = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_location(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes save_game_key = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_save_game_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgClientWelcome::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgClientWelcome)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 version = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_version(), target);
+  }
+
+  // optional bytes game_data = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_game_data(), target);
+  }
+
+  // repeated .CMsgSOCacheSubscribed outofdate_subscribed_caches = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_outofdate_subscribed_caches_size()); i < n; i++) {
+    const auto& repfield = this->_internal_outofdate_subscribed_caches(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .CMsgSOCacheSubscriptionCheck uptodate_subscribed_caches = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_uptodate_subscribed_caches_size()); i < n; i++) {
+    const auto& repfield = this->_internal_uptodate_subscribed_caches(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .CMsgClientWelcome.Location location = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::location(this),
+        _Internal::location(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bytes save_game_key = 6;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_save_game_key(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgClientWelcome)
+  return target;
+}
+
+size_t CMsgClientWelcome::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgClientWelcome)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CMsgSOCacheSubscribed outofdate_subscribed_caches = 3;
+  total_size += 1UL * this->_internal_outofdate_subscribed_caches_size();
+  for (const auto& msg : this->_impl_.outofdate_subscribed_caches_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .CMsgSOCacheSubscriptionCheck uptodate_subscribed_caches = 4;
+  total_size += 1UL * this->_internal_uptodate_subscribed_caches_size();
+  for (const auto& msg : this->_impl_.uptodate_subscribed_caches_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional bytes game_data = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_game_data());
+    }
+
+    // optional bytes save_game_key = 6;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_save_game_key());
+    }
+
+    // optional .CMsgClientWelcome.Location location = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.location_);
+    }
+
+    // optional uint32 version = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_version());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgClientWelcome::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgClientWelcome::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgClientWelcome::GetClassData() const { return &_class_data_; }
+
+
+void CMsgClientWelcome::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgClientWelcome*>(&to_msg);
+  auto& from = static_cast<const CMsgClientWelcome&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgClientWelcome)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.outofdate_subscribed_caches_.MergeFrom(from._impl_.outofdate_subscribed_caches_);
+  _this->_impl_.uptodate_subscribed_caches_.MergeFrom(from._impl_.uptodate_subscribed_caches_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_game_data(from._internal_game_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_save_game_key(from._internal_save_game_key());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_location()->::CMsgClientWelcome_Location::MergeFrom(
+          from._internal_location());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgClientWelcome::CopyFrom(const CMsgClientWelcome& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgClientWelcome)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgClientWelcome::IsInitialized() const {
+  return true;
+}
+
+void CMsgClientWelcome::InternalSwap(CMsgClientWelcome* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.outofdate_subscribed_caches_.InternalSwap(&other->_impl_.outofdate_subscribed_caches_);
+  _impl_.uptodate_subscribed_caches_.InternalSwap(&other->_impl_.uptodate_subscribed_caches_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.game_data_, lhs_arena,
+      &other->_impl_.game_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.save_game_key_, lhs_arena,
+      &other->_impl_.save_game_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgClientWelcome, _impl_.version_)
+      + sizeof(CMsgClientWelcome::_impl_.version_)
+      - PROTOBUF_FIELD_OFFSET(CMsgClientWelcome, _impl_.location_)>(
+          reinterpret_cast<char*>(&_impl_.location_),
+          reinterpret_cast<char*>(&other->_impl_.location_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgClientWelcome::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[27]);
+}
+
+// ===================================================================
+
+class CMsgConnectionStatus::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgConnectionStatus>()._impl_._has_bits_);
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_client_session_need(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_queue_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_queue_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_wait_seconds(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_estimated_wait_seconds_remaining(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+CMsgConnectionStatus::CMsgConnectionStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgConnectionStatus)
+}
+CMsgConnectionStatus::CMsgConnectionStatus(const CMsgConnectionStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgConnectionStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.client_session_need_){}
+    , decltype(_impl_.queue_position_){}
+    , decltype(_impl_.queue_size_){}
+    , decltype(_impl_.wait_seconds_){}
+    , decltype(_impl_.estimated_wait_seconds_remaining_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.estimated_wait_seconds_remaining_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.estimated_wait_seconds_remaining_));
+  // @@protoc_insertion_point(copy_constructor:CMsgConnectionStatus)
+}
+
+inline void CMsgConnectionStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.client_session_need_){0u}
+    , decltype(_impl_.queue_position_){0}
+    , decltype(_impl_.queue_size_){0}
+    , decltype(_impl_.wait_seconds_){0}
+    , decltype(_impl_.estimated_wait_seconds_remaining_){0}
+  };
+}
+
+CMsgConnectionStatus::~CMsgConnectionStatus() {
+  // @@protoc_insertion_point(destructor:CMsgConnectionStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgConnectionStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgConnectionStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgConnectionStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgConnectionStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.status_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.estimated_wait_seconds_remaining_) -
+        reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.estimated_wait_seconds_remaining_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgConnectionStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .GCConnectionStatus status = 1 [default = GCConnectionStatus_HAVE_SESSION];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::GCConnectionStatus_IsValid(val))) {
+            _internal_set_status(static_cast<::GCConnectionStatus>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 client_session_need = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_client_session_need(&has_bits);
+          _impl_.client_session_need_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 queue_position = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_queue_position(&has_bits);
+          _impl_.queue_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 queue_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_queue_size(&has_bits);
+          _impl_.queue_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 wait_seconds = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_wait_seconds(&has_bits);
+          _impl_.wait_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 estimated_wait_seconds_remaining = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_estimated_wait_seconds_remaining(&has_bits);
+          _impl_.estimated_wait_seconds_remaining_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgConnectionStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgConnectionStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .GCConnectionStatus status = 1 [default = GCConnectionStatus_HAVE_SESSION];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional uint32 client_session_need = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_client_session_need(), target);
+  }
+
+  // optional int32 queue_position = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_queue_position(), target);
+  }
+
+  // optional int32 queue_size = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_queue_size(), target);
+  }
+
+  // optional int32 wait_seconds = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_wait_seconds(), target);
+  }
+
+  // optional int32 estimated_wait_seconds_remaining = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_estimated_wait_seconds_remaining(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgConnectionStatus)
+  return target;
+}
+
+size_t CMsgConnectionStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgConnectionStatus)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional .GCConnectionStatus status = 1 [default = GCConnectionStatus_HAVE_SESSION];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+    }
+
+    // optional uint32 client_session_need = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client_session_need());
+    }
+
+    // optional int32 queue_position = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_queue_position());
+    }
+
+    // optional int32 queue_size = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_queue_size());
+    }
+
+    // optional int32 wait_seconds = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_wait_seconds());
+    }
+
+    // optional int32 estimated_wait_seconds_remaining = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_estimated_wait_seconds_remaining());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgConnectionStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgConnectionStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgConnectionStatus::GetClassData() const { return &_class_data_; }
+
+
+void CMsgConnectionStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgConnectionStatus*>(&to_msg);
+  auto& from = static_cast<const CMsgConnectionStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgConnectionStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.client_session_need_ = from._impl_.client_session_need_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.queue_position_ = from._impl_.queue_position_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.queue_size_ = from._impl_.queue_size_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.wait_seconds_ = from._impl_.wait_seconds_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.estimated_wait_seconds_remaining_ = from._impl_.estimated_wait_seconds_remaining_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgConnectionStatus::CopyFrom(const CMsgConnectionStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgConnectionStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgConnectionStatus::IsInitialized() const {
+  return true;
+}
+
+void CMsgConnectionStatus::InternalSwap(CMsgConnectionStatus* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgConnectionStatus, _impl_.estimated_wait_seconds_remaining_)
+      + sizeof(CMsgConnectionStatus::_impl_.estimated_wait_seconds_remaining_)
+      - PROTOBUF_FIELD_OFFSET(CMsgConnectionStatus, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgConnectionStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[28]);
+}
+
+// ===================================================================
+
+class CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions>()._impl_._has_bits_);
+  static void set_has_service_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+}
+CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions(const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.service_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.service_id_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  // @@protoc_insertion_point(copy_constructor:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+}
+
+inline void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.service_id_){0u}
+  };
+}
+
+CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::~CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions() {
+  // @@protoc_insertion_point(destructor:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.version_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.service_id_) -
+        reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.service_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 service_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_service_id(&has_bits);
+          _impl_.service_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 service_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_service_id(), target);
+  }
+
+  // optional uint64 version = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+  return target;
+}
+
+size_t CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint64 version = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+    }
+
+    // optional uint32 service_id = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_service_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions*>(&to_msg);
+  auto& from = static_cast<const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.service_id_ = from._impl_.service_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::CopyFrom(const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::InternalSwap(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions, _impl_.service_id_)
+      + sizeof(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_impl_.service_id_)
+      - PROTOBUF_FIELD_OFFSET(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[29]);
+}
+
+// ===================================================================
+
+class CMsgGCToGCSOCacheSubscribe::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgGCToGCSOCacheSubscribe>()._impl_._has_bits_);
+  static void set_has_subscriber(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_subscribe_to(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sync_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CMsgGCToGCSOCacheSubscribe::CMsgGCToGCSOCacheSubscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCToGCSOCacheSubscribe)
+}
+CMsgGCToGCSOCacheSubscribe::CMsgGCToGCSOCacheSubscribe(const CMsgGCToGCSOCacheSubscribe& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCToGCSOCacheSubscribe* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.have_versions_){from._impl_.have_versions_}
+    , decltype(_impl_.subscriber_){}
+    , decltype(_impl_.subscribe_to_){}
+    , decltype(_impl_.sync_version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.subscriber_, &from._impl_.subscriber_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sync_version_) -
+    reinterpret_cast<char*>(&_impl_.subscriber_)) + sizeof(_impl_.sync_version_));
+  // @@protoc_insertion_point(copy_constructor:CMsgGCToGCSOCacheSubscribe)
+}
+
+inline void CMsgGCToGCSOCacheSubscribe::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.have_versions_){arena}
+    , decltype(_impl_.subscriber_){uint64_t{0u}}
+    , decltype(_impl_.subscribe_to_){uint64_t{0u}}
+    , decltype(_impl_.sync_version_){uint64_t{0u}}
+  };
+}
+
+CMsgGCToGCSOCacheSubscribe::~CMsgGCToGCSOCacheSubscribe() {
+  // @@protoc_insertion_point(destructor:CMsgGCToGCSOCacheSubscribe)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCToGCSOCacheSubscribe::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.have_versions_.~RepeatedPtrField();
+}
+
+void CMsgGCToGCSOCacheSubscribe::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCToGCSOCacheSubscribe::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCToGCSOCacheSubscribe)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.have_versions_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.subscriber_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sync_version_) -
+        reinterpret_cast<char*>(&_impl_.subscriber_)) + sizeof(_impl_.sync_version_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCToGCSOCacheSubscribe::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed64 subscriber = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_subscriber(&has_bits);
+          _impl_.subscriber_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 subscribe_to = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_subscribe_to(&has_bits);
+          _impl_.subscribe_to_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 sync_version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_sync_version(&has_bits);
+          _impl_.sync_version_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions have_versions = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_have_versions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCToGCSOCacheSubscribe::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCToGCSOCacheSubscribe)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed64 subscriber = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_subscriber(), target);
+  }
+
+  // optional fixed64 subscribe_to = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_subscribe_to(), target);
+  }
+
+  // optional fixed64 sync_version = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_sync_version(), target);
+  }
+
+  // repeated .CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions have_versions = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_have_versions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_have_versions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCToGCSOCacheSubscribe)
+  return target;
+}
+
+size_t CMsgGCToGCSOCacheSubscribe::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCToGCSOCacheSubscribe)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions have_versions = 4;
+  total_size += 1UL * this->_internal_have_versions_size();
+  for (const auto& msg : this->_impl_.have_versions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional fixed64 subscriber = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed64 subscribe_to = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed64 sync_version = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCToGCSOCacheSubscribe::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCToGCSOCacheSubscribe::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCToGCSOCacheSubscribe::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCToGCSOCacheSubscribe::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCToGCSOCacheSubscribe*>(&to_msg);
+  auto& from = static_cast<const CMsgGCToGCSOCacheSubscribe&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCToGCSOCacheSubscribe)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.have_versions_.MergeFrom(from._impl_.have_versions_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.subscriber_ = from._impl_.subscriber_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.subscribe_to_ = from._impl_.subscribe_to_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sync_version_ = from._impl_.sync_version_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCToGCSOCacheSubscribe::CopyFrom(const CMsgGCToGCSOCacheSubscribe& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCToGCSOCacheSubscribe)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCToGCSOCacheSubscribe::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCToGCSOCacheSubscribe::InternalSwap(CMsgGCToGCSOCacheSubscribe* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.have_versions_.InternalSwap(&other->_impl_.have_versions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgGCToGCSOCacheSubscribe, _impl_.sync_version_)
+      + sizeof(CMsgGCToGCSOCacheSubscribe::_impl_.sync_version_)
+      - PROTOBUF_FIELD_OFFSET(CMsgGCToGCSOCacheSubscribe, _impl_.subscriber_)>(
+          reinterpret_cast<char*>(&_impl_.subscriber_),
+          reinterpret_cast<char*>(&other->_impl_.subscriber_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCToGCSOCacheSubscribe::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[30]);
+}
+
+// ===================================================================
+
+class CMsgGCToGCSOCacheUnsubscribe::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgGCToGCSOCacheUnsubscribe>()._impl_._has_bits_);
+  static void set_has_subscriber(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_unsubscribe_from(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CMsgGCToGCSOCacheUnsubscribe::CMsgGCToGCSOCacheUnsubscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCToGCSOCacheUnsubscribe)
+}
+CMsgGCToGCSOCacheUnsubscribe::CMsgGCToGCSOCacheUnsubscribe(const CMsgGCToGCSOCacheUnsubscribe& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCToGCSOCacheUnsubscribe* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.subscriber_){}
+    , decltype(_impl_.unsubscribe_from_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.subscriber_, &from._impl_.subscriber_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unsubscribe_from_) -
+    reinterpret_cast<char*>(&_impl_.subscriber_)) + sizeof(_impl_.unsubscribe_from_));
+  // @@protoc_insertion_point(copy_constructor:CMsgGCToGCSOCacheUnsubscribe)
+}
+
+inline void CMsgGCToGCSOCacheUnsubscribe::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.subscriber_){uint64_t{0u}}
+    , decltype(_impl_.unsubscribe_from_){uint64_t{0u}}
+  };
+}
+
+CMsgGCToGCSOCacheUnsubscribe::~CMsgGCToGCSOCacheUnsubscribe() {
+  // @@protoc_insertion_point(destructor:CMsgGCToGCSOCacheUnsubscribe)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCToGCSOCacheUnsubscribe::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgGCToGCSOCacheUnsubscribe::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCToGCSOCacheUnsubscribe::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCToGCSOCacheUnsubscribe)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.subscriber_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.unsubscribe_from_) -
+        reinterpret_cast<char*>(&_impl_.subscriber_)) + sizeof(_impl_.unsubscribe_from_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCToGCSOCacheUnsubscribe::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed64 subscriber = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_subscriber(&has_bits);
+          _impl_.subscriber_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 unsubscribe_from = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_unsubscribe_from(&has_bits);
+          _impl_.unsubscribe_from_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCToGCSOCacheUnsubscribe::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCToGCSOCacheUnsubscribe)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed64 subscriber = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_subscriber(), target);
+  }
+
+  // optional fixed64 unsubscribe_from = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_unsubscribe_from(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCToGCSOCacheUnsubscribe)
+  return target;
+}
+
+size_t CMsgGCToGCSOCacheUnsubscribe::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCToGCSOCacheUnsubscribe)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional fixed64 subscriber = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed64 unsubscribe_from = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCToGCSOCacheUnsubscribe::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCToGCSOCacheUnsubscribe::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCToGCSOCacheUnsubscribe::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCToGCSOCacheUnsubscribe::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCToGCSOCacheUnsubscribe*>(&to_msg);
+  auto& from = static_cast<const CMsgGCToGCSOCacheUnsubscribe&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCToGCSOCacheUnsubscribe)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.subscriber_ = from._impl_.subscriber_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.unsubscribe_from_ = from._impl_.unsubscribe_from_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCToGCSOCacheUnsubscribe::CopyFrom(const CMsgGCToGCSOCacheUnsubscribe& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCToGCSOCacheUnsubscribe)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCToGCSOCacheUnsubscribe::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCToGCSOCacheUnsubscribe::InternalSwap(CMsgGCToGCSOCacheUnsubscribe* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgGCToGCSOCacheUnsubscribe, _impl_.unsubscribe_from_)
+      + sizeof(CMsgGCToGCSOCacheUnsubscribe::_impl_.unsubscribe_from_)
+      - PROTOBUF_FIELD_OFFSET(CMsgGCToGCSOCacheUnsubscribe, _impl_.subscriber_)>(
+          reinterpret_cast<char*>(&_impl_.subscriber_),
+          reinterpret_cast<char*>(&other->_impl_.subscriber_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCToGCSOCacheUnsubscribe::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[31]);
+}
+
+// ===================================================================
+
+class CMsgGCClientPing::_Internal {
+ public:
+};
+
+CMsgGCClientPing::CMsgGCClientPing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:CMsgGCClientPing)
+}
+CMsgGCClientPing::CMsgGCClientPing(const CMsgGCClientPing& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CMsgGCClientPing* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CMsgGCClientPing)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCClientPing::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCClientPing::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCClientPing::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[32]);
+}
+
+// ===================================================================
+
+class CMsgGCToGCLoadSessionSOCache::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgGCToGCLoadSessionSOCache>()._impl_._has_bits_);
+  static void set_has_account_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CMsgGCToGCLoadSessionSOCache::CMsgGCToGCLoadSessionSOCache(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCToGCLoadSessionSOCache)
+}
+CMsgGCToGCLoadSessionSOCache::CMsgGCToGCLoadSessionSOCache(const CMsgGCToGCLoadSessionSOCache& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCToGCLoadSessionSOCache* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.account_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.account_id_ = from._impl_.account_id_;
+  // @@protoc_insertion_point(copy_constructor:CMsgGCToGCLoadSessionSOCache)
+}
+
+inline void CMsgGCToGCLoadSessionSOCache::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.account_id_){0u}
+  };
+}
+
+CMsgGCToGCLoadSessionSOCache::~CMsgGCToGCLoadSessionSOCache() {
+  // @@protoc_insertion_point(destructor:CMsgGCToGCLoadSessionSOCache)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCToGCLoadSessionSOCache::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgGCToGCLoadSessionSOCache::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCToGCLoadSessionSOCache::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCToGCLoadSessionSOCache)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.account_id_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCToGCLoadSessionSOCache::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 account_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_account_id(&has_bits);
+          _impl_.account_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCToGCLoadSessionSOCache::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCToGCLoadSessionSOCache)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 account_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_account_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCToGCLoadSessionSOCache)
+  return target;
+}
+
+size_t CMsgGCToGCLoadSessionSOCache::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCToGCLoadSessionSOCache)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint32 account_id = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_account_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCToGCLoadSessionSOCache::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCToGCLoadSessionSOCache::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCToGCLoadSessionSOCache::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCToGCLoadSessionSOCache::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCToGCLoadSessionSOCache*>(&to_msg);
+  auto& from = static_cast<const CMsgGCToGCLoadSessionSOCache&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCToGCLoadSessionSOCache)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_account_id()) {
+    _this->_internal_set_account_id(from._internal_account_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCToGCLoadSessionSOCache::CopyFrom(const CMsgGCToGCLoadSessionSOCache& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCToGCLoadSessionSOCache)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCToGCLoadSessionSOCache::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCToGCLoadSessionSOCache::InternalSwap(CMsgGCToGCLoadSessionSOCache* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.account_id_, other->_impl_.account_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCToGCLoadSessionSOCache::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[33]);
+}
+
+// ===================================================================
+
+class CMsgGCToGCLoadSessionSOCacheResponse::_Internal {
+ public:
+};
+
+CMsgGCToGCLoadSessionSOCacheResponse::CMsgGCToGCLoadSessionSOCacheResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:CMsgGCToGCLoadSessionSOCacheResponse)
+}
+CMsgGCToGCLoadSessionSOCacheResponse::CMsgGCToGCLoadSessionSOCacheResponse(const CMsgGCToGCLoadSessionSOCacheResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CMsgGCToGCLoadSessionSOCacheResponse* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CMsgGCToGCLoadSessionSOCacheResponse)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCToGCLoadSessionSOCacheResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCToGCLoadSessionSOCacheResponse::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCToGCLoadSessionSOCacheResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[34]);
+}
+
+// ===================================================================
+
+class CMsgGCToGCUpdateSessionStats::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgGCToGCUpdateSessionStats>()._impl_._has_bits_);
+  static void set_has_user_sessions(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_server_sessions(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_in_logon_surge(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CMsgGCToGCUpdateSessionStats::CMsgGCToGCUpdateSessionStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgGCToGCUpdateSessionStats)
+}
+CMsgGCToGCUpdateSessionStats::CMsgGCToGCUpdateSessionStats(const CMsgGCToGCUpdateSessionStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgGCToGCUpdateSessionStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.user_sessions_){}
+    , decltype(_impl_.server_sessions_){}
+    , decltype(_impl_.in_logon_surge_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.user_sessions_, &from._impl_.user_sessions_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.in_logon_surge_) -
+    reinterpret_cast<char*>(&_impl_.user_sessions_)) + sizeof(_impl_.in_logon_surge_));
+  // @@protoc_insertion_point(copy_constructor:CMsgGCToGCUpdateSessionStats)
+}
+
+inline void CMsgGCToGCUpdateSessionStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.user_sessions_){0u}
+    , decltype(_impl_.server_sessions_){0u}
+    , decltype(_impl_.in_logon_surge_){false}
+  };
+}
+
+CMsgGCToGCUpdateSessionStats::~CMsgGCToGCUpdateSessionStats() {
+  // @@protoc_insertion_point(destructor:CMsgGCToGCUpdateSessionStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgGCToGCUpdateSessionStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgGCToGCUpdateSessionStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgGCToGCUpdateSessionStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgGCToGCUpdateSessionStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.user_sessions_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.in_logon_surge_) -
+        reinterpret_cast<char*>(&_impl_.user_sessions_)) + sizeof(_impl_.in_logon_surge_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgGCToGCUpdateSessionStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 user_sessions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_user_sessions(&has_bits);
+          _impl_.user_sessions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 server_sessions = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_server_sessions(&has_bits);
+          _impl_.server_sessions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool in_logon_surge = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_in_logon_surge(&has_bits);
+          _impl_.in_logon_surge_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgGCToGCUpdateSessionStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgGCToGCUpdateSessionStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 user_sessions = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_user_sessions(), target);
+  }
+
+  // optional uint32 server_sessions = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_server_sessions(), target);
+  }
+
+  // optional bool in_logon_surge = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_in_logon_surge(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgGCToGCUpdateSessionStats)
+  return target;
+}
+
+size_t CMsgGCToGCUpdateSessionStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgGCToGCUpdateSessionStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional uint32 user_sessions = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_user_sessions());
+    }
+
+    // optional uint32 server_sessions = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_server_sessions());
+    }
+
+    // optional bool in_logon_surge = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgGCToGCUpdateSessionStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgGCToGCUpdateSessionStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgGCToGCUpdateSessionStats::GetClassData() const { return &_class_data_; }
+
+
+void CMsgGCToGCUpdateSessionStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgGCToGCUpdateSessionStats*>(&to_msg);
+  auto& from = static_cast<const CMsgGCToGCUpdateSessionStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgGCToGCUpdateSessionStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.user_sessions_ = from._impl_.user_sessions_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.server_sessions_ = from._impl_.server_sessions_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.in_logon_surge_ = from._impl_.in_logon_surge_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgGCToGCUpdateSessionStats::CopyFrom(const CMsgGCToGCUpdateSessionStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgGCToGCUpdateSessionStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgGCToGCUpdateSessionStats::IsInitialized() const {
+  return true;
+}
+
+void CMsgGCToGCUpdateSessionStats::InternalSwap(CMsgGCToGCUpdateSessionStats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgGCToGCUpdateSessionStats, _impl_.in_logon_surge_)
+      + sizeof(CMsgGCToGCUpdateSessionStats::_impl_.in_logon_surge_)
+      - PROTOBUF_FIELD_OFFSET(CMsgGCToGCUpdateSessionStats, _impl_.user_sessions_)>(
+          reinterpret_cast<char*>(&_impl_.user_sessions_),
+          reinterpret_cast<char*>(&other->_impl_.user_sessions_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgGCToGCUpdateSessionStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[35]);
+}
+
+// ===================================================================
+
+class CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription>()._impl_._has_bits_);
+  static void set_has_gameitemid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_item_description(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+}
+CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription(const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.item_description_){}
+    , decltype(_impl_.gameitemid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.item_description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.item_description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_item_description()) {
+    _this->_impl_.item_description_.Set(from._internal_item_description(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.gameitemid_ = from._impl_.gameitemid_;
+  // @@protoc_insertion_point(copy_constructor:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+}
+
+inline void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.item_description_){}
+    , decltype(_impl_.gameitemid_){0u}
+  };
+  _impl_.item_description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.item_description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::~CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription() {
+  // @@protoc_insertion_point(destructor:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.item_description_.Destroy();
+}
+
+void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::Clear() {
+// @@protoc_insertion_point(message_clear_start:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.item_description_.ClearNonDefaultToEmpty();
+  }
+  _impl_.gameitemid_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 gameitemid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_gameitemid(&has_bits);
+          _impl_.gameitemid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string item_description = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_item_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription.item_description");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 gameitemid = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_gameitemid(), target);
+  }
+
+  // optional string item_description = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_item_description().data(), static_cast<int>(this->_internal_item_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription.item_description");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_item_description(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+  return target;
+}
+
+size_t CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string item_description = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_item_description());
+    }
+
+    // optional uint32 gameitemid = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_gameitemid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::GetClassData() const { return &_class_data_; }
+
+
+void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription*>(&to_msg);
+  auto& from = static_cast<const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_item_description(from._internal_item_description());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.gameitemid_ = from._impl_.gameitemid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::CopyFrom(const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::IsInitialized() const {
+  return true;
+}
+
+void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::InternalSwap(CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.item_description_, lhs_arena,
+      &other->_impl_.item_description_, rhs_arena
+  );
+  swap(_impl_.gameitemid_, other->_impl_.gameitemid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[36]);
+}
+
+// ===================================================================
+
+class CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock>()._impl_._has_bits_);
+  static void set_has_language(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+}
+CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock(const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.descriptions_){from._impl_.descriptions_}
+    , decltype(_impl_.language_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.language_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.language_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_language()) {
+    _this->_impl_.language_.Set(from._internal_language(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+}
+
+inline void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.descriptions_){arena}
+    , decltype(_impl_.language_){}
+  };
+  _impl_.language_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.language_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::~CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock() {
+  // @@protoc_insertion_point(destructor:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.descriptions_.~RepeatedPtrField();
+  _impl_.language_.Destroy();
+}
+
+void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::Clear() {
+// @@protoc_insertion_point(message_clear_start:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.descriptions_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.language_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string language = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_language();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.language");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription descriptions = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_descriptions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string language = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_language().data(), static_cast<int>(this->_internal_language().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.language");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_language(), target);
+  }
+
+  // repeated .CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription descriptions = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_descriptions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_descriptions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+  return target;
+}
+
+size_t CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription descriptions = 2;
+  total_size += 1UL * this->_internal_descriptions_size();
+  for (const auto& msg : this->_impl_.descriptions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string language = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_language());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::GetClassData() const { return &_class_data_; }
+
+
+void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock*>(&to_msg);
+  auto& from = static_cast<const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.descriptions_.MergeFrom(from._impl_.descriptions_);
+  if (from._internal_has_language()) {
+    _this->_internal_set_language(from._internal_language());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::CopyFrom(const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::IsInitialized() const {
+  return true;
+}
+
+void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::InternalSwap(CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.descriptions_.InternalSwap(&other->_impl_.descriptions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.language_, lhs_arena,
+      &other->_impl_.language_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[37]);
+}
+
+// ===================================================================
+
+class CWorkshop_PopulateItemDescriptions_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CWorkshop_PopulateItemDescriptions_Request>()._impl_._has_bits_);
+  static void set_has_appid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CWorkshop_PopulateItemDescriptions_Request::CWorkshop_PopulateItemDescriptions_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CWorkshop_PopulateItemDescriptions_Request)
+}
+CWorkshop_PopulateItemDescriptions_Request::CWorkshop_PopulateItemDescriptions_Request(const CWorkshop_PopulateItemDescriptions_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CWorkshop_PopulateItemDescriptions_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.languages_){from._impl_.languages_}
+    , decltype(_impl_.appid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.appid_ = from._impl_.appid_;
+  // @@protoc_insertion_point(copy_constructor:CWorkshop_PopulateItemDescriptions_Request)
+}
+
+inline void CWorkshop_PopulateItemDescriptions_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.languages_){arena}
+    , decltype(_impl_.appid_){0u}
+  };
+}
+
+CWorkshop_PopulateItemDescriptions_Request::~CWorkshop_PopulateItemDescriptions_Request() {
+  // @@protoc_insertion_point(destructor:CWorkshop_PopulateItemDescriptions_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CWorkshop_PopulateItemDescriptions_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.languages_.~RepeatedPtrField();
+}
+
+void CWorkshop_PopulateItemDescriptions_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CWorkshop_PopulateItemDescriptions_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:CWorkshop_PopulateItemDescriptions_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.languages_.Clear();
+  _impl_.appid_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CWorkshop_PopulateItemDescriptions_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 appid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_appid(&has_bits);
+          _impl_.appid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock languages = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_languages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CWorkshop_PopulateItemDescriptions_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CWorkshop_PopulateItemDescriptions_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 appid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_appid(), target);
+  }
+
+  // repeated .CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock languages = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_languages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_languages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CWorkshop_PopulateItemDescriptions_Request)
+  return target;
+}
+
+size_t CWorkshop_PopulateItemDescriptions_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CWorkshop_PopulateItemDescriptions_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock languages = 2;
+  total_size += 1UL * this->_internal_languages_size();
+  for (const auto& msg : this->_impl_.languages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional uint32 appid = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_appid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CWorkshop_PopulateItemDescriptions_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CWorkshop_PopulateItemDescriptions_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CWorkshop_PopulateItemDescriptions_Request::GetClassData() const { return &_class_data_; }
+
+
+void CWorkshop_PopulateItemDescriptions_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CWorkshop_PopulateItemDescriptions_Request*>(&to_msg);
+  auto& from = static_cast<const CWorkshop_PopulateItemDescriptions_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CWorkshop_PopulateItemDescriptions_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.languages_.MergeFrom(from._impl_.languages_);
+  if (from._internal_has_appid()) {
+    _this->_internal_set_appid(from._internal_appid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CWorkshop_PopulateItemDescriptions_Request::CopyFrom(const CWorkshop_PopulateItemDescriptions_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CWorkshop_PopulateItemDescriptions_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CWorkshop_PopulateItemDescriptions_Request::IsInitialized() const {
+  return true;
+}
+
+void CWorkshop_PopulateItemDescriptions_Request::InternalSwap(CWorkshop_PopulateItemDescriptions_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.languages_.InternalSwap(&other->_impl_.languages_);
+  swap(_impl_.appid_, other->_impl_.appid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CWorkshop_PopulateItemDescriptions_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[38]);
+}
+
+// ===================================================================
+
+class CWorkshop_GetContributors_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CWorkshop_GetContributors_Request>()._impl_._has_bits_);
+  static void set_has_appid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_gameitemid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CWorkshop_GetContributors_Request::CWorkshop_GetContributors_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CWorkshop_GetContributors_Request)
+}
+CWorkshop_GetContributors_Request::CWorkshop_GetContributors_Request(const CWorkshop_GetContributors_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CWorkshop_GetContributors_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.appid_){}
+    , decltype(_impl_.gameitemid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.appid_, &from._impl_.appid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.gameitemid_) -
+    reinterpret_cast<char*>(&_impl_.appid_)) + sizeof(_impl_.gameitemid_));
+  // @@protoc_insertion_point(copy_constructor:CWorkshop_GetContributors_Request)
+}
+
+inline void CWorkshop_GetContributors_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.appid_){0u}
+    , decltype(_impl_.gameitemid_){0u}
+  };
+}
+
+CWorkshop_GetContributors_Request::~CWorkshop_GetContributors_Request() {
+  // @@protoc_insertion_point(destructor:CWorkshop_GetContributors_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CWorkshop_GetContributors_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CWorkshop_GetContributors_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CWorkshop_GetContributors_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:CWorkshop_GetContributors_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.appid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.gameitemid_) -
+        reinterpret_cast<char*>(&_impl_.appid_)) + sizeof(_impl_.gameitemid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CWorkshop_GetContributors_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 appid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_appid(&has_bits);
+          _impl_.appid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 gameitemid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_gameitemid(&has_bits);
+          _impl_.gameitemid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CWorkshop_GetContributors_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CWorkshop_GetContributors_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 appid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_appid(), target);
+  }
+
+  // optional uint32 gameitemid = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_gameitemid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CWorkshop_GetContributors_Request)
+  return target;
+}
+
+size_t CWorkshop_GetContributors_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CWorkshop_GetContributors_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 appid = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_appid());
+    }
+
+    // optional uint32 gameitemid = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_gameitemid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CWorkshop_GetContributors_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CWorkshop_GetContributors_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CWorkshop_GetContributors_Request::GetClassData() const { return &_class_data_; }
+
+
+void CWorkshop_GetContributors_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CWorkshop_GetContributors_Request*>(&to_msg);
+  auto& from = static_cast<const CWorkshop_GetContributors_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CWorkshop_GetContributors_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.appid_ = from._impl_.appid_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.gameitemid_ = from._impl_.gameitemid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CWorkshop_GetContributors_Request::CopyFrom(const CWorkshop_GetContributors_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CWorkshop_GetContributors_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CWorkshop_GetContributors_Request::IsInitialized() const {
+  return true;
+}
+
+void CWorkshop_GetContributors_Request::InternalSwap(CWorkshop_GetContributors_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CWorkshop_GetContributors_Request, _impl_.gameitemid_)
+      + sizeof(CWorkshop_GetContributors_Request::_impl_.gameitemid_)
+      - PROTOBUF_FIELD_OFFSET(CWorkshop_GetContributors_Request, _impl_.appid_)>(
+          reinterpret_cast<char*>(&_impl_.appid_),
+          reinterpret_cast<char*>(&other->_impl_.appid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CWorkshop_GetContributors_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[39]);
+}
+
+// ===================================================================
+
+class CWorkshop_GetContributors_Response::_Internal {
+ public:
+};
+
+CWorkshop_GetContributors_Response::CWorkshop_GetContributors_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CWorkshop_GetContributors_Response)
+}
+CWorkshop_GetContributors_Response::CWorkshop_GetContributors_Response(const CWorkshop_GetContributors_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CWorkshop_GetContributors_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contributors_){from._impl_.contributors_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CWorkshop_GetContributors_Response)
+}
+
+inline void CWorkshop_GetContributors_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.contributors_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CWorkshop_GetContributors_Response::~CWorkshop_GetContributors_Response() {
+  // @@protoc_insertion_point(destructor:CWorkshop_GetContributors_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CWorkshop_GetContributors_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.contributors_.~RepeatedField();
+}
+
+void CWorkshop_GetContributors_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CWorkshop_GetContributors_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:CWorkshop_GetContributors_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.contributors_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CWorkshop_GetContributors_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated fixed64 contributors = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_contributors(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+            ptr += sizeof(uint64_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<9>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_contributors(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CWorkshop_GetContributors_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CWorkshop_GetContributors_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated fixed64 contributors = 1;
+  for (int i = 0, n = this->_internal_contributors_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_contributors(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CWorkshop_GetContributors_Response)
+  return target;
+}
+
+size_t CWorkshop_GetContributors_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CWorkshop_GetContributors_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed64 contributors = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_contributors_size());
+    size_t data_size = 8UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_contributors_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CWorkshop_GetContributors_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CWorkshop_GetContributors_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CWorkshop_GetContributors_Response::GetClassData() const { return &_class_data_; }
+
+
+void CWorkshop_GetContributors_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CWorkshop_GetContributors_Response*>(&to_msg);
+  auto& from = static_cast<const CWorkshop_GetContributors_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CWorkshop_GetContributors_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.contributors_.MergeFrom(from._impl_.contributors_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CWorkshop_GetContributors_Response::CopyFrom(const CWorkshop_GetContributors_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CWorkshop_GetContributors_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CWorkshop_GetContributors_Response::IsInitialized() const {
+  return true;
+}
+
+void CWorkshop_GetContributors_Response::InternalSwap(CWorkshop_GetContributors_Response* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.contributors_.InternalSwap(&other->_impl_.contributors_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CWorkshop_GetContributors_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[40]);
+}
+
+// ===================================================================
+
+class CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule>()._impl_._has_bits_);
+  static void set_has_workshop_file_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_revenue_percentage(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_rule_description(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+}
+CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule(const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rule_description_){}
+    , decltype(_impl_.workshop_file_id_){}
+    , decltype(_impl_.revenue_percentage_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rule_description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rule_description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_rule_description()) {
+    _this->_impl_.rule_description_.Set(from._internal_rule_description(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.workshop_file_id_, &from._impl_.workshop_file_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.revenue_percentage_) -
+    reinterpret_cast<char*>(&_impl_.workshop_file_id_)) + sizeof(_impl_.revenue_percentage_));
+  // @@protoc_insertion_point(copy_constructor:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+}
+
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rule_description_){}
+    , decltype(_impl_.workshop_file_id_){uint64_t{0u}}
+    , decltype(_impl_.revenue_percentage_){0}
+  };
+  _impl_.rule_description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rule_description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::~CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule() {
+  // @@protoc_insertion_point(destructor:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rule_description_.Destroy();
+}
+
+void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::Clear() {
+// @@protoc_insertion_point(message_clear_start:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.rule_description_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.workshop_file_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.revenue_percentage_) -
+        reinterpret_cast<char*>(&_impl_.workshop_file_id_)) + sizeof(_impl_.revenue_percentage_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 workshop_file_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_workshop_file_id(&has_bits);
+          _impl_.workshop_file_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float revenue_percentage = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_revenue_percentage(&has_bits);
+          _impl_.revenue_percentage_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string rule_description = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_rule_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.rule_description");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 workshop_file_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_workshop_file_id(), target);
+  }
+
+  // optional float revenue_percentage = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_revenue_percentage(), target);
+  }
+
+  // optional string rule_description = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_rule_description().data(), static_cast<int>(this->_internal_rule_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.rule_description");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_rule_description(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+  return target;
+}
+
+size_t CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string rule_description = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_rule_description());
+    }
+
+    // optional uint64 workshop_file_id = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_workshop_file_id());
+    }
+
+    // optional float revenue_percentage = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::GetClassData() const { return &_class_data_; }
+
+
+void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule*>(&to_msg);
+  auto& from = static_cast<const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_rule_description(from._internal_rule_description());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.workshop_file_id_ = from._impl_.workshop_file_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.revenue_percentage_ = from._impl_.revenue_percentage_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::CopyFrom(const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::IsInitialized() const {
+  return true;
+}
+
+void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::InternalSwap(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rule_description_, lhs_arena,
+      &other->_impl_.rule_description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule, _impl_.revenue_percentage_)
+      + sizeof(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_impl_.revenue_percentage_)
+      - PROTOBUF_FIELD_OFFSET(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule, _impl_.workshop_file_id_)>(
+          reinterpret_cast<char*>(&_impl_.workshop_file_id_),
+          reinterpret_cast<char*>(&other->_impl_.workshop_file_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[41]);
+}
+
+// ===================================================================
+
+class CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule>()._impl_._has_bits_);
+  static void set_has_account_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_revenue_percentage(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_rule_description(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+}
+CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule(const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rule_description_){}
+    , decltype(_impl_.account_id_){}
+    , decltype(_impl_.revenue_percentage_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rule_description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rule_description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_rule_description()) {
+    _this->_impl_.rule_description_.Set(from._internal_rule_description(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.account_id_, &from._impl_.account_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.revenue_percentage_) -
+    reinterpret_cast<char*>(&_impl_.account_id_)) + sizeof(_impl_.revenue_percentage_));
+  // @@protoc_insertion_point(copy_constructor:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+}
+
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rule_description_){}
+    , decltype(_impl_.account_id_){0u}
+    , decltype(_impl_.revenue_percentage_){0}
+  };
+  _impl_.rule_description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rule_description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::~CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule() {
+  // @@protoc_insertion_point(destructor:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rule_description_.Destroy();
+}
+
+void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::Clear() {
+// @@protoc_insertion_point(message_clear_start:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.rule_description_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.account_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.revenue_percentage_) -
+        reinterpret_cast<char*>(&_impl_.account_id_)) + sizeof(_impl_.revenue_percentage_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 account_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_account_id(&has_bits);
+          _impl_.account_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float revenue_percentage = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_revenue_percentage(&has_bits);
+          _impl_.revenue_percentage_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string rule_description = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_rule_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.rule_description");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 account_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_account_id(), target);
+  }
+
+  // optional float revenue_percentage = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_revenue_percentage(), target);
+  }
+
+  // optional string rule_description = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_rule_description().data(), static_cast<int>(this->_internal_rule_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.rule_description");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_rule_description(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+  return target;
+}
+
+size_t CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string rule_description = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_rule_description());
+    }
+
+    // optional uint32 account_id = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_account_id());
+    }
+
+    // optional float revenue_percentage = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::GetClassData() const { return &_class_data_; }
+
+
+void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule*>(&to_msg);
+  auto& from = static_cast<const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_rule_description(from._internal_rule_description());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.account_id_ = from._impl_.account_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.revenue_percentage_ = from._impl_.revenue_percentage_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::CopyFrom(const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::IsInitialized() const {
+  return true;
+}
+
+void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::InternalSwap(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rule_description_, lhs_arena,
+      &other->_impl_.rule_description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule, _impl_.revenue_percentage_)
+      + sizeof(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_impl_.revenue_percentage_)
+      - PROTOBUF_FIELD_OFFSET(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule, _impl_.account_id_)>(
+          reinterpret_cast<char*>(&_impl_.account_id_),
+          reinterpret_cast<char*>(&other->_impl_.account_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[42]);
+}
+
+// ===================================================================
+
+class CWorkshop_SetItemPaymentRules_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CWorkshop_SetItemPaymentRules_Request>()._impl_._has_bits_);
+  static void set_has_appid(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_gameitemid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CWorkshop_SetItemPaymentRules_Request::CWorkshop_SetItemPaymentRules_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CWorkshop_SetItemPaymentRules_Request)
+}
+CWorkshop_SetItemPaymentRules_Request::CWorkshop_SetItemPaymentRules_Request(const CWorkshop_SetItemPaymentRules_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CWorkshop_SetItemPaymentRules_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.associated_workshop_files_){from._impl_.associated_workshop_files_}
+    , decltype(_impl_.partner_accounts_){from._impl_.partner_accounts_}
+    , decltype(_impl_.appid_){}
+    , decltype(_impl_.gameitemid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.appid_, &from._impl_.appid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.gameitemid_) -
+    reinterpret_cast<char*>(&_impl_.appid_)) + sizeof(_impl_.gameitemid_));
+  // @@protoc_insertion_point(copy_constructor:CWorkshop_SetItemPaymentRules_Request)
+}
+
+inline void CWorkshop_SetItemPaymentRules_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.associated_workshop_files_){arena}
+    , decltype(_impl_.partner_accounts_){arena}
+    , decltype(_impl_.appid_){0u}
+    , decltype(_impl_.gameitemid_){0u}
+  };
+}
+
+CWorkshop_SetItemPaymentRules_Request::~CWorkshop_SetItemPaymentRules_Request() {
+  // @@protoc_insertion_point(destructor:CWorkshop_SetItemPaymentRules_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CWorkshop_SetItemPaymentRules_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.associated_workshop_files_.~RepeatedPtrField();
+  _impl_.partner_accounts_.~RepeatedPtrField();
+}
+
+void CWorkshop_SetItemPaymentRules_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CWorkshop_SetItemPaymentRules_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:CWorkshop_SetItemPaymentRules_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.associated_workshop_files_.Clear();
+  _impl_.partner_accounts_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.appid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.gameitemid_) -
+        reinterpret_cast<char*>(&_impl_.appid_)) + sizeof(_impl_.gameitemid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CWorkshop_SetItemPaymentRules_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 appid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_appid(&has_bits);
+          _impl_.appid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 gameitemid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_gameitemid(&has_bits);
+          _impl_.gameitemid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule associated_workshop_files = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_associated_workshop_files(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule partner_accounts = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_partner_accounts(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CWorkshop_SetItemPaymentRules_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CWorkshop_SetItemPaymentRules_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 appid = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_appid(), target);
+  }
+
+  // optional uint32 gameitemid = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_gameitemid(), target);
+  }
+
+  // repeated .CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule associated_workshop_files = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_associated_workshop_files_size()); i < n; i++) {
+    const auto& repfield = this->_internal_associated_workshop_files(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule partner_accounts = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_partner_accounts_size()); i < n; i++) {
+    const auto& repfield = this->_internal_partner_accounts(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CWorkshop_SetItemPaymentRules_Request)
+  return target;
+}
+
+size_t CWorkshop_SetItemPaymentRules_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CWorkshop_SetItemPaymentRules_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule associated_workshop_files = 3;
+  total_size += 1UL * this->_internal_associated_workshop_files_size();
+  for (const auto& msg : this->_impl_.associated_workshop_files_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule partner_accounts = 4;
+  total_size += 1UL * this->_internal_partner_accounts_size();
+  for (const auto& msg : this->_impl_.partner_accounts_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 appid = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_appid());
+    }
+
+    // optional uint32 gameitemid = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_gameitemid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CWorkshop_SetItemPaymentRules_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CWorkshop_SetItemPaymentRules_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CWorkshop_SetItemPaymentRules_Request::GetClassData() const { return &_class_data_; }
+
+
+void CWorkshop_SetItemPaymentRules_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CWorkshop_SetItemPaymentRules_Request*>(&to_msg);
+  auto& from = static_cast<const CWorkshop_SetItemPaymentRules_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CWorkshop_SetItemPaymentRules_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.associated_workshop_files_.MergeFrom(from._impl_.associated_workshop_files_);
+  _this->_impl_.partner_accounts_.MergeFrom(from._impl_.partner_accounts_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.appid_ = from._impl_.appid_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.gameitemid_ = from._impl_.gameitemid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CWorkshop_SetItemPaymentRules_Request::CopyFrom(const CWorkshop_SetItemPaymentRules_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CWorkshop_SetItemPaymentRules_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CWorkshop_SetItemPaymentRules_Request::IsInitialized() const {
+  return true;
+}
+
+void CWorkshop_SetItemPaymentRules_Request::InternalSwap(CWorkshop_SetItemPaymentRules_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.associated_workshop_files_.InternalSwap(&other->_impl_.associated_workshop_files_);
+  _impl_.partner_accounts_.InternalSwap(&other->_impl_.partner_accounts_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CWorkshop_SetItemPaymentRules_Request, _impl_.gameitemid_)
+      + sizeof(CWorkshop_SetItemPaymentRules_Request::_impl_.gameitemid_)
+      - PROTOBUF_FIELD_OFFSET(CWorkshop_SetItemPaymentRules_Request, _impl_.appid_)>(
+          reinterpret_cast<char*>(&_impl_.appid_),
+          reinterpret_cast<char*>(&other->_impl_.appid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CWorkshop_SetItemPaymentRules_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[43]);
+}
+
+// ===================================================================
+
+class CWorkshop_SetItemPaymentRules_Response::_Internal {
+ public:
+};
+
+CWorkshop_SetItemPaymentRules_Response::CWorkshop_SetItemPaymentRules_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:CWorkshop_SetItemPaymentRules_Response)
+}
+CWorkshop_SetItemPaymentRules_Response::CWorkshop_SetItemPaymentRules_Response(const CWorkshop_SetItemPaymentRules_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CWorkshop_SetItemPaymentRules_Response* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CWorkshop_SetItemPaymentRules_Response)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CWorkshop_SetItemPaymentRules_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CWorkshop_SetItemPaymentRules_Response::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CWorkshop_SetItemPaymentRules_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[44]);
+}
+
+// ===================================================================
+
+class CBroadcast_PostGameDataFrame_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CBroadcast_PostGameDataFrame_Request>()._impl_._has_bits_);
+  static void set_has_appid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_steamid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_broadcast_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_frame_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CBroadcast_PostGameDataFrame_Request::CBroadcast_PostGameDataFrame_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CBroadcast_PostGameDataFrame_Request)
+}
+CBroadcast_PostGameDataFrame_Request::CBroadcast_PostGameDataFrame_Request(const CBroadcast_PostGameDataFrame_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CBroadcast_PostGameDataFrame_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.frame_data_){}
+    , decltype(_impl_.steamid_){}
+    , decltype(_impl_.broadcast_id_){}
+    , decltype(_impl_.appid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.frame_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frame_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_frame_data()) {
+    _this->_impl_.frame_data_.Set(from._internal_frame_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.steamid_, &from._impl_.steamid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.appid_) -
+    reinterpret_cast<char*>(&_impl_.steamid_)) + sizeof(_impl_.appid_));
+  // @@protoc_insertion_point(copy_constructor:CBroadcast_PostGameDataFrame_Request)
+}
+
+inline void CBroadcast_PostGameDataFrame_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.frame_data_){}
+    , decltype(_impl_.steamid_){uint64_t{0u}}
+    , decltype(_impl_.broadcast_id_){uint64_t{0u}}
+    , decltype(_impl_.appid_){0u}
+  };
+  _impl_.frame_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frame_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CBroadcast_PostGameDataFrame_Request::~CBroadcast_PostGameDataFrame_Request() {
+  // @@protoc_insertion_point(destructor:CBroadcast_PostGameDataFrame_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CBroadcast_PostGameDataFrame_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frame_data_.Destroy();
+}
+
+void CBroadcast_PostGameDataFrame_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CBroadcast_PostGameDataFrame_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:CBroadcast_PostGameDataFrame_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.frame_data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.steamid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.appid_) -
+        reinterpret_cast<char*>(&_impl_.steamid_)) + sizeof(_impl_.appid_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CBroadcast_PostGameDataFrame_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 appid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_appid(&has_bits);
+          _impl_.appid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 steamid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_steamid(&has_bits);
+          _impl_.steamid_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 broadcast_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_broadcast_id(&has_bits);
+          _impl_.broadcast_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes frame_data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_frame_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CBroadcast_PostGameDataFrame_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CBroadcast_PostGameDataFrame_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 appid = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_appid(), target);
+  }
+
+  // optional fixed64 steamid = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_steamid(), target);
+  }
+
+  // optional fixed64 broadcast_id = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_broadcast_id(), target);
+  }
+
+  // optional bytes frame_data = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_frame_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CBroadcast_PostGameDataFrame_Request)
+  return target;
+}
+
+size_t CBroadcast_PostGameDataFrame_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CBroadcast_PostGameDataFrame_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional bytes frame_data = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_frame_data());
+    }
+
+    // optional fixed64 steamid = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed64 broadcast_id = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 appid = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_appid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CBroadcast_PostGameDataFrame_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CBroadcast_PostGameDataFrame_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CBroadcast_PostGameDataFrame_Request::GetClassData() const { return &_class_data_; }
+
+
+void CBroadcast_PostGameDataFrame_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CBroadcast_PostGameDataFrame_Request*>(&to_msg);
+  auto& from = static_cast<const CBroadcast_PostGameDataFrame_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CBroadcast_PostGameDataFrame_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_frame_data(from._internal_frame_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.steamid_ = from._impl_.steamid_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.broadcast_id_ = from._impl_.broadcast_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.appid_ = from._impl_.appid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CBroadcast_PostGameDataFrame_Request::CopyFrom(const CBroadcast_PostGameDataFrame_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CBroadcast_PostGameDataFrame_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CBroadcast_PostGameDataFrame_Request::IsInitialized() const {
+  return true;
+}
+
+void CBroadcast_PostGameDataFrame_Request::InternalSwap(CBroadcast_PostGameDataFrame_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.frame_data_, lhs_arena,
+      &other->_impl_.frame_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CBroadcast_PostGameDataFrame_Request, _impl_.appid_)
+      + sizeof(CBroadcast_PostGameDataFrame_Request::_impl_.appid_)
+      - PROTOBUF_FIELD_OFFSET(CBroadcast_PostGameDataFrame_Request, _impl_.steamid_)>(
+          reinterpret_cast<char*>(&_impl_.steamid_),
+          reinterpret_cast<char*>(&other->_impl_.steamid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CBroadcast_PostGameDataFrame_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gcsdk_5fgcmessages_2eproto_getter, &descriptor_table_gcsdk_5fgcmessages_2eproto_once,
+      file_level_metadata_gcsdk_5fgcmessages_2eproto[45]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::CMsgSHA1Digest*
+Arena::CreateMaybeMessage< ::CMsgSHA1Digest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSHA1Digest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOIDOwner*
+Arena::CreateMaybeMessage< ::CMsgSOIDOwner >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOIDOwner >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOSingleObject*
+Arena::CreateMaybeMessage< ::CMsgSOSingleObject >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOSingleObject >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOMultipleObjects_SingleObject*
+Arena::CreateMaybeMessage< ::CMsgSOMultipleObjects_SingleObject >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOMultipleObjects_SingleObject >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOMultipleObjects*
+Arena::CreateMaybeMessage< ::CMsgSOMultipleObjects >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOMultipleObjects >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOCacheSubscribed_SubscribedType*
+Arena::CreateMaybeMessage< ::CMsgSOCacheSubscribed_SubscribedType >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOCacheSubscribed_SubscribedType >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOCacheSubscribed*
+Arena::CreateMaybeMessage< ::CMsgSOCacheSubscribed >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOCacheSubscribed >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOCacheSubscribedUpToDate*
+Arena::CreateMaybeMessage< ::CMsgSOCacheSubscribedUpToDate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOCacheSubscribedUpToDate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOCacheUnsubscribed*
+Arena::CreateMaybeMessage< ::CMsgSOCacheUnsubscribed >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOCacheUnsubscribed >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOCacheSubscriptionCheck*
+Arena::CreateMaybeMessage< ::CMsgSOCacheSubscriptionCheck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOCacheSubscriptionCheck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOCacheSubscriptionRefresh*
+Arena::CreateMaybeMessage< ::CMsgSOCacheSubscriptionRefresh >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOCacheSubscriptionRefresh >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOCacheVersion*
+Arena::CreateMaybeMessage< ::CMsgSOCacheVersion >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOCacheVersion >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCMultiplexMessage*
+Arena::CreateMaybeMessage< ::CMsgGCMultiplexMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCMultiplexMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CGCToGCMsgMasterAck_Process*
+Arena::CreateMaybeMessage< ::CGCToGCMsgMasterAck_Process >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CGCToGCMsgMasterAck_Process >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CGCToGCMsgMasterAck*
+Arena::CreateMaybeMessage< ::CGCToGCMsgMasterAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CGCToGCMsgMasterAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CGCToGCMsgMasterAck_Response*
+Arena::CreateMaybeMessage< ::CGCToGCMsgMasterAck_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CGCToGCMsgMasterAck_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CGCToGCMsgMasterStartupComplete_GCInfo*
+Arena::CreateMaybeMessage< ::CGCToGCMsgMasterStartupComplete_GCInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CGCToGCMsgMasterStartupComplete_GCInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CGCToGCMsgMasterStartupComplete*
+Arena::CreateMaybeMessage< ::CGCToGCMsgMasterStartupComplete >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CGCToGCMsgMasterStartupComplete >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CGCToGCMsgRouted*
+Arena::CreateMaybeMessage< ::CGCToGCMsgRouted >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CGCToGCMsgRouted >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CGCToGCMsgRoutedReply*
+Arena::CreateMaybeMessage< ::CGCToGCMsgRoutedReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CGCToGCMsgRoutedReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate*
+Arena::CreateMaybeMessage< ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCUpdateSubGCSessionInfo*
+Arena::CreateMaybeMessage< ::CMsgGCUpdateSubGCSessionInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCUpdateSubGCSessionInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCRequestSubGCSessionInfo*
+Arena::CreateMaybeMessage< ::CMsgGCRequestSubGCSessionInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCRequestSubGCSessionInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCRequestSubGCSessionInfoResponse*
+Arena::CreateMaybeMessage< ::CMsgGCRequestSubGCSessionInfoResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCRequestSubGCSessionInfoResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgSOCacheHaveVersion*
+Arena::CreateMaybeMessage< ::CMsgSOCacheHaveVersion >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgSOCacheHaveVersion >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgClientHello*
+Arena::CreateMaybeMessage< ::CMsgClientHello >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgClientHello >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgClientWelcome_Location*
+Arena::CreateMaybeMessage< ::CMsgClientWelcome_Location >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgClientWelcome_Location >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgClientWelcome*
+Arena::CreateMaybeMessage< ::CMsgClientWelcome >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgClientWelcome >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgConnectionStatus*
+Arena::CreateMaybeMessage< ::CMsgConnectionStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgConnectionStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions*
+Arena::CreateMaybeMessage< ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCToGCSOCacheSubscribe*
+Arena::CreateMaybeMessage< ::CMsgGCToGCSOCacheSubscribe >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCToGCSOCacheSubscribe >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCToGCSOCacheUnsubscribe*
+Arena::CreateMaybeMessage< ::CMsgGCToGCSOCacheUnsubscribe >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCToGCSOCacheUnsubscribe >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCClientPing*
+Arena::CreateMaybeMessage< ::CMsgGCClientPing >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCClientPing >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCToGCLoadSessionSOCache*
+Arena::CreateMaybeMessage< ::CMsgGCToGCLoadSessionSOCache >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCToGCLoadSessionSOCache >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCToGCLoadSessionSOCacheResponse*
+Arena::CreateMaybeMessage< ::CMsgGCToGCLoadSessionSOCacheResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCToGCLoadSessionSOCacheResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgGCToGCUpdateSessionStats*
+Arena::CreateMaybeMessage< ::CMsgGCToGCUpdateSessionStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgGCToGCUpdateSessionStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription*
+Arena::CreateMaybeMessage< ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock*
+Arena::CreateMaybeMessage< ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CWorkshop_PopulateItemDescriptions_Request*
+Arena::CreateMaybeMessage< ::CWorkshop_PopulateItemDescriptions_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CWorkshop_PopulateItemDescriptions_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CWorkshop_GetContributors_Request*
+Arena::CreateMaybeMessage< ::CWorkshop_GetContributors_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CWorkshop_GetContributors_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CWorkshop_GetContributors_Response*
+Arena::CreateMaybeMessage< ::CWorkshop_GetContributors_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CWorkshop_GetContributors_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule*
+Arena::CreateMaybeMessage< ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule*
+Arena::CreateMaybeMessage< ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CWorkshop_SetItemPaymentRules_Request*
+Arena::CreateMaybeMessage< ::CWorkshop_SetItemPaymentRules_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CWorkshop_SetItemPaymentRules_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CWorkshop_SetItemPaymentRules_Response*
+Arena::CreateMaybeMessage< ::CWorkshop_SetItemPaymentRules_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CWorkshop_SetItemPaymentRules_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CBroadcast_PostGameDataFrame_Request*
+Arena::CreateMaybeMessage< ::CBroadcast_PostGameDataFrame_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CBroadcast_PostGameDataFrame_Request >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,14480 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: gcsdk_gcmessages.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_gcsdk_5fgcmessages_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_gcsdk_5fgcmessages_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "steammessages.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_gcsdk_5fgcmessages_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_gcsdk_5fgcmessages_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_gcsdk_5fgcmessages_2eproto;
+class CBroadcast_PostGameDataFrame_Request;
+struct CBroadcast_PostGameDataFrame_RequestDefaultTypeInternal;
+extern CBroadcast_PostGameDataFrame_RequestDefaultTypeInternal _CBroadcast_PostGameDataFrame_Request_default_instance_;
+class CGCToGCMsgMasterAck;
+struct CGCToGCMsgMasterAckDefaultTypeInternal;
+extern CGCToGCMsgMasterAckDefaultTypeInternal _CGCToGCMsgMasterAck_default_instance_;
+class CGCToGCMsgMasterAck_Process;
+struct CGCToGCMsgMasterAck_ProcessDefaultTypeInternal;
+extern CGCToGCMsgMasterAck_ProcessDefaultTypeInternal _CGCToGCMsgMasterAck_Process_default_instance_;
+class CGCToGCMsgMasterAck_Response;
+struct CGCToGCMsgMasterAck_ResponseDefaultTypeInternal;
+extern CGCToGCMsgMasterAck_ResponseDefaultTypeInternal _CGCToGCMsgMasterAck_Response_default_instance_;
+class CGCToGCMsgMasterStartupComplete;
+struct CGCToGCMsgMasterStartupCompleteDefaultTypeInternal;
+extern CGCToGCMsgMasterStartupCompleteDefaultTypeInternal _CGCToGCMsgMasterStartupComplete_default_instance_;
+class CGCToGCMsgMasterStartupComplete_GCInfo;
+struct CGCToGCMsgMasterStartupComplete_GCInfoDefaultTypeInternal;
+extern CGCToGCMsgMasterStartupComplete_GCInfoDefaultTypeInternal _CGCToGCMsgMasterStartupComplete_GCInfo_default_instance_;
+class CGCToGCMsgRouted;
+struct CGCToGCMsgRoutedDefaultTypeInternal;
+extern CGCToGCMsgRoutedDefaultTypeInternal _CGCToGCMsgRouted_default_instance_;
+class CGCToGCMsgRoutedReply;
+struct CGCToGCMsgRoutedReplyDefaultTypeInternal;
+extern CGCToGCMsgRoutedReplyDefaultTypeInternal _CGCToGCMsgRoutedReply_default_instance_;
+class CMsgClientHello;
+struct CMsgClientHelloDefaultTypeInternal;
+extern CMsgClientHelloDefaultTypeInternal _CMsgClientHello_default_instance_;
+class CMsgClientWelcome;
+struct CMsgClientWelcomeDefaultTypeInternal;
+extern CMsgClientWelcomeDefaultTypeInternal _CMsgClientWelcome_default_instance_;
+class CMsgClientWelcome_Location;
+struct CMsgClientWelcome_LocationDefaultTypeInternal;
+extern CMsgClientWelcome_LocationDefaultTypeInternal _CMsgClientWelcome_Location_default_instance_;
+class CMsgConnectionStatus;
+struct CMsgConnectionStatusDefaultTypeInternal;
+extern CMsgConnectionStatusDefaultTypeInternal _CMsgConnectionStatus_default_instance_;
+class CMsgGCClientPing;
+struct CMsgGCClientPingDefaultTypeInternal;
+extern CMsgGCClientPingDefaultTypeInternal _CMsgGCClientPing_default_instance_;
+class CMsgGCMultiplexMessage;
+struct CMsgGCMultiplexMessageDefaultTypeInternal;
+extern CMsgGCMultiplexMessageDefaultTypeInternal _CMsgGCMultiplexMessage_default_instance_;
+class CMsgGCRequestSubGCSessionInfo;
+struct CMsgGCRequestSubGCSessionInfoDefaultTypeInternal;
+extern CMsgGCRequestSubGCSessionInfoDefaultTypeInternal _CMsgGCRequestSubGCSessionInfo_default_instance_;
+class CMsgGCRequestSubGCSessionInfoResponse;
+struct CMsgGCRequestSubGCSessionInfoResponseDefaultTypeInternal;
+extern CMsgGCRequestSubGCSessionInfoResponseDefaultTypeInternal _CMsgGCRequestSubGCSessionInfoResponse_default_instance_;
+class CMsgGCToGCLoadSessionSOCache;
+struct CMsgGCToGCLoadSessionSOCacheDefaultTypeInternal;
+extern CMsgGCToGCLoadSessionSOCacheDefaultTypeInternal _CMsgGCToGCLoadSessionSOCache_default_instance_;
+class CMsgGCToGCLoadSessionSOCacheResponse;
+struct CMsgGCToGCLoadSessionSOCacheResponseDefaultTypeInternal;
+extern CMsgGCToGCLoadSessionSOCacheResponseDefaultTypeInternal _CMsgGCToGCLoadSessionSOCacheResponse_default_instance_;
+class CMsgGCToGCSOCacheSubscribe;
+struct CMsgGCToGCSOCacheSubscribeDefaultTypeInternal;
+extern CMsgGCToGCSOCacheSubscribeDefaultTypeInternal _CMsgGCToGCSOCacheSubscribe_default_instance_;
+class CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions;
+struct CMsgGCToGCSOCacheSubscribe_CMsgHaveVersionsDefaultTypeInternal;
+extern CMsgGCToGCSOCacheSubscribe_CMsgHaveVersionsDefaultTypeInternal _CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions_default_instance_;
+class CMsgGCToGCSOCacheUnsubscribe;
+struct CMsgGCToGCSOCacheUnsubscribeDefaultTypeInternal;
+extern CMsgGCToGCSOCacheUnsubscribeDefaultTypeInternal _CMsgGCToGCSOCacheUnsubscribe_default_instance_;
+class CMsgGCToGCUpdateSessionStats;
+struct CMsgGCToGCUpdateSessionStatsDefaultTypeInternal;
+extern CMsgGCToGCUpdateSessionStatsDefaultTypeInternal _CMsgGCToGCUpdateSessionStats_default_instance_;
+class CMsgGCUpdateSubGCSessionInfo;
+struct CMsgGCUpdateSubGCSessionInfoDefaultTypeInternal;
+extern CMsgGCUpdateSubGCSessionInfoDefaultTypeInternal _CMsgGCUpdateSubGCSessionInfo_default_instance_;
+class CMsgGCUpdateSubGCSessionInfo_CMsgUpdate;
+struct CMsgGCUpdateSubGCSessionInfo_CMsgUpdateDefaultTypeInternal;
+extern CMsgGCUpdateSubGCSessionInfo_CMsgUpdateDefaultTypeInternal _CMsgGCUpdateSubGCSessionInfo_CMsgUpdate_default_instance_;
+class CMsgSHA1Digest;
+struct CMsgSHA1DigestDefaultTypeInternal;
+extern CMsgSHA1DigestDefaultTypeInternal _CMsgSHA1Digest_default_instance_;
+class CMsgSOCacheHaveVersion;
+struct CMsgSOCacheHaveVersionDefaultTypeInternal;
+extern CMsgSOCacheHaveVersionDefaultTypeInternal _CMsgSOCacheHaveVersion_default_instance_;
+class CMsgSOCacheSubscribed;
+struct CMsgSOCacheSubscribedDefaultTypeInternal;
+extern CMsgSOCacheSubscribedDefaultTypeInternal _CMsgSOCacheSubscribed_default_instance_;
+class CMsgSOCacheSubscribedUpToDate;
+struct CMsgSOCacheSubscribedUpToDateDefaultTypeInternal;
+extern CMsgSOCacheSubscribedUpToDateDefaultTypeInternal _CMsgSOCacheSubscribedUpToDate_default_instance_;
+class CMsgSOCacheSubscribed_SubscribedType;
+struct CMsgSOCacheSubscribed_SubscribedTypeDefaultTypeInternal;
+extern CMsgSOCacheSubscribed_SubscribedTypeDefaultTypeInternal _CMsgSOCacheSubscribed_SubscribedType_default_instance_;
+class CMsgSOCacheSubscriptionCheck;
+struct CMsgSOCacheSubscriptionCheckDefaultTypeInternal;
+extern CMsgSOCacheSubscriptionCheckDefaultTypeInternal _CMsgSOCacheSubscriptionCheck_default_instance_;
+class CMsgSOCacheSubscriptionRefresh;
+struct CMsgSOCacheSubscriptionRefreshDefaultTypeInternal;
+extern CMsgSOCacheSubscriptionRefreshDefaultTypeInternal _CMsgSOCacheSubscriptionRefresh_default_instance_;
+class CMsgSOCacheUnsubscribed;
+struct CMsgSOCacheUnsubscribedDefaultTypeInternal;
+extern CMsgSOCacheUnsubscribedDefaultTypeInternal _CMsgSOCacheUnsubscribed_default_instance_;
+class CMsgSOCacheVersion;
+struct CMsgSOCacheVersionDefaultTypeInternal;
+extern CMsgSOCacheVersionDefaultTypeInternal _CMsgSOCacheVersion_default_instance_;
+class CMsgSOIDOwner;
+struct CMsgSOIDOwnerDefaultTypeInternal;
+extern CMsgSOIDOwnerDefaultTypeInternal _CMsgSOIDOwner_default_instance_;
+class CMsgSOMultipleObjects;
+struct CMsgSOMultipleObjectsDefaultTypeInternal;
+extern CMsgSOMultipleObjectsDefaultTypeInternal _CMsgSOMultipleObjects_default_instance_;
+class CMsgSOMultipleObjects_SingleObject;
+struct CMsgSOMultipleObjects_SingleObjectDefaultTypeInternal;
+extern CMsgSOMultipleObjects_SingleObjectDefaultTypeInternal _CMsgSOMultipleObjects_SingleObject_default_instance_;
+class CMsgSOSingleObject;
+struct CMsgSOSingleObjectDefaultTypeInternal;
+extern CMsgSOSingleObjectDefaultTypeInternal _CMsgSOSingleObject_default_instance_;
+class CWorkshop_GetContributors_Request;
+struct CWorkshop_GetContributors_RequestDefaultTypeInternal;
+extern CWorkshop_GetContributors_RequestDefaultTypeInternal _CWorkshop_GetContributors_Request_default_instance_;
+class CWorkshop_GetContributors_Response;
+struct CWorkshop_GetContributors_ResponseDefaultTypeInternal;
+extern CWorkshop_GetContributors_ResponseDefaultTypeInternal _CWorkshop_GetContributors_Response_default_instance_;
+class CWorkshop_PopulateItemDescriptions_Request;
+struct CWorkshop_PopulateItemDescriptions_RequestDefaultTypeInternal;
+extern CWorkshop_PopulateItemDescriptions_RequestDefaultTypeInternal _CWorkshop_PopulateItemDescriptions_Request_default_instance_;
+class CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock;
+struct CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlockDefaultTypeInternal;
+extern CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlockDefaultTypeInternal _CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock_default_instance_;
+class CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription;
+struct CWorkshop_PopulateItemDescriptions_Request_SingleItemDescriptionDefaultTypeInternal;
+extern CWorkshop_PopulateItemDescriptions_Request_SingleItemDescriptionDefaultTypeInternal _CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription_default_instance_;
+class CWorkshop_SetItemPaymentRules_Request;
+struct CWorkshop_SetItemPaymentRules_RequestDefaultTypeInternal;
+extern CWorkshop_SetItemPaymentRules_RequestDefaultTypeInternal _CWorkshop_SetItemPaymentRules_Request_default_instance_;
+class CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule;
+struct CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRuleDefaultTypeInternal;
+extern CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRuleDefaultTypeInternal _CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule_default_instance_;
+class CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule;
+struct CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRuleDefaultTypeInternal;
+extern CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRuleDefaultTypeInternal _CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule_default_instance_;
+class CWorkshop_SetItemPaymentRules_Response;
+struct CWorkshop_SetItemPaymentRules_ResponseDefaultTypeInternal;
+extern CWorkshop_SetItemPaymentRules_ResponseDefaultTypeInternal _CWorkshop_SetItemPaymentRules_Response_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::CBroadcast_PostGameDataFrame_Request* Arena::CreateMaybeMessage<::CBroadcast_PostGameDataFrame_Request>(Arena*);
+template<> ::CGCToGCMsgMasterAck* Arena::CreateMaybeMessage<::CGCToGCMsgMasterAck>(Arena*);
+template<> ::CGCToGCMsgMasterAck_Process* Arena::CreateMaybeMessage<::CGCToGCMsgMasterAck_Process>(Arena*);
+template<> ::CGCToGCMsgMasterAck_Response* Arena::CreateMaybeMessage<::CGCToGCMsgMasterAck_Response>(Arena*);
+template<> ::CGCToGCMsgMasterStartupComplete* Arena::CreateMaybeMessage<::CGCToGCMsgMasterStartupComplete>(Arena*);
+template<> ::CGCToGCMsgMasterStartupComplete_GCInfo* Arena::CreateMaybeMessage<::CGCToGCMsgMasterStartupComplete_GCInfo>(Arena*);
+template<> ::CGCToGCMsgRouted* Arena::CreateMaybeMessage<::CGCToGCMsgRouted>(Arena*);
+template<> ::CGCToGCMsgRoutedReply* Arena::CreateMaybeMessage<::CGCToGCMsgRoutedReply>(Arena*);
+template<> ::CMsgClientHello* Arena::CreateMaybeMessage<::CMsgClientHello>(Arena*);
+template<> ::CMsgClientWelcome* Arena::CreateMaybeMessage<::CMsgClientWelcome>(Arena*);
+template<> ::CMsgClientWelcome_Location* Arena::CreateMaybeMessage<::CMsgClientWelcome_Location>(Arena*);
+template<> ::CMsgConnectionStatus* Arena::CreateMaybeMessage<::CMsgConnectionStatus>(Arena*);
+template<> ::CMsgGCClientPing* Arena::CreateMaybeMessage<::CMsgGCClientPing>(Arena*);
+template<> ::CMsgGCMultiplexMessage* Arena::CreateMaybeMessage<::CMsgGCMultiplexMessage>(Arena*);
+template<> ::CMsgGCRequestSubGCSessionInfo* Arena::CreateMaybeMessage<::CMsgGCRequestSubGCSessionInfo>(Arena*);
+template<> ::CMsgGCRequestSubGCSessionInfoResponse* Arena::CreateMaybeMessage<::CMsgGCRequestSubGCSessionInfoResponse>(Arena*);
+template<> ::CMsgGCToGCLoadSessionSOCache* Arena::CreateMaybeMessage<::CMsgGCToGCLoadSessionSOCache>(Arena*);
+template<> ::CMsgGCToGCLoadSessionSOCacheResponse* Arena::CreateMaybeMessage<::CMsgGCToGCLoadSessionSOCacheResponse>(Arena*);
+template<> ::CMsgGCToGCSOCacheSubscribe* Arena::CreateMaybeMessage<::CMsgGCToGCSOCacheSubscribe>(Arena*);
+template<> ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* Arena::CreateMaybeMessage<::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions>(Arena*);
+template<> ::CMsgGCToGCSOCacheUnsubscribe* Arena::CreateMaybeMessage<::CMsgGCToGCSOCacheUnsubscribe>(Arena*);
+template<> ::CMsgGCToGCUpdateSessionStats* Arena::CreateMaybeMessage<::CMsgGCToGCUpdateSessionStats>(Arena*);
+template<> ::CMsgGCUpdateSubGCSessionInfo* Arena::CreateMaybeMessage<::CMsgGCUpdateSubGCSessionInfo>(Arena*);
+template<> ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* Arena::CreateMaybeMessage<::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate>(Arena*);
+template<> ::CMsgSHA1Digest* Arena::CreateMaybeMessage<::CMsgSHA1Digest>(Arena*);
+template<> ::CMsgSOCacheHaveVersion* Arena::CreateMaybeMessage<::CMsgSOCacheHaveVersion>(Arena*);
+template<> ::CMsgSOCacheSubscribed* Arena::CreateMaybeMessage<::CMsgSOCacheSubscribed>(Arena*);
+template<> ::CMsgSOCacheSubscribedUpToDate* Arena::CreateMaybeMessage<::CMsgSOCacheSubscribedUpToDate>(Arena*);
+template<> ::CMsgSOCacheSubscribed_SubscribedType* Arena::CreateMaybeMessage<::CMsgSOCacheSubscribed_SubscribedType>(Arena*);
+template<> ::CMsgSOCacheSubscriptionCheck* Arena::CreateMaybeMessage<::CMsgSOCacheSubscriptionCheck>(Arena*);
+template<> ::CMsgSOCacheSubscriptionRefresh* Arena::CreateMaybeMessage<::CMsgSOCacheSubscriptionRefresh>(Arena*);
+template<> ::CMsgSOCacheUnsubscribed* Arena::CreateMaybeMessage<::CMsgSOCacheUnsubscribed>(Arena*);
+template<> ::CMsgSOCacheVersion* Arena::CreateMaybeMessage<::CMsgSOCacheVersion>(Arena*);
+template<> ::CMsgSOIDOwner* Arena::CreateMaybeMessage<::CMsgSOIDOwner>(Arena*);
+template<> ::CMsgSOMultipleObjects* Arena::CreateMaybeMessage<::CMsgSOMultipleObjects>(Arena*);
+template<> ::CMsgSOMultipleObjects_SingleObject* Arena::CreateMaybeMessage<::CMsgSOMultipleObjects_SingleObject>(Arena*);
+template<> ::CMsgSOSingleObject* Arena::CreateMaybeMessage<::CMsgSOSingleObject>(Arena*);
+template<> ::CWorkshop_GetContributors_Request* Arena::CreateMaybeMessage<::CWorkshop_GetContributors_Request>(Arena*);
+template<> ::CWorkshop_GetContributors_Response* Arena::CreateMaybeMessage<::CWorkshop_GetContributors_Response>(Arena*);
+template<> ::CWorkshop_PopulateItemDescriptions_Request* Arena::CreateMaybeMessage<::CWorkshop_PopulateItemDescriptions_Request>(Arena*);
+template<> ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* Arena::CreateMaybeMessage<::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock>(Arena*);
+template<> ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* Arena::CreateMaybeMessage<::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription>(Arena*);
+template<> ::CWorkshop_SetItemPaymentRules_Request* Arena::CreateMaybeMessage<::CWorkshop_SetItemPaymentRules_Request>(Arena*);
+template<> ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* Arena::CreateMaybeMessage<::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule>(Arena*);
+template<> ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* Arena::CreateMaybeMessage<::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule>(Arena*);
+template<> ::CWorkshop_SetItemPaymentRules_Response* Arena::CreateMaybeMessage<::CWorkshop_SetItemPaymentRules_Response>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+enum ESourceEngine : int {
+  k_ESE_Source1 = 0,
+  k_ESE_Source2 = 1
+};
+bool ESourceEngine_IsValid(int value);
+constexpr ESourceEngine ESourceEngine_MIN = k_ESE_Source1;
+constexpr ESourceEngine ESourceEngine_MAX = k_ESE_Source2;
+constexpr int ESourceEngine_ARRAYSIZE = ESourceEngine_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ESourceEngine_descriptor();
+template<typename T>
+inline const std::string& ESourceEngine_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ESourceEngine>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ESourceEngine_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ESourceEngine_descriptor(), enum_t_value);
+}
+inline bool ESourceEngine_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ESourceEngine* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ESourceEngine>(
+    ESourceEngine_descriptor(), name, value);
+}
+enum PartnerAccountType : int {
+  PARTNER_NONE = 0,
+  PARTNER_PERFECT_WORLD = 1,
+  PARTNER_NEXON = 2,
+  PARTNER_INVALID = 3
+};
+bool PartnerAccountType_IsValid(int value);
+constexpr PartnerAccountType PartnerAccountType_MIN = PARTNER_NONE;
+constexpr PartnerAccountType PartnerAccountType_MAX = PARTNER_INVALID;
+constexpr int PartnerAccountType_ARRAYSIZE = PartnerAccountType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PartnerAccountType_descriptor();
+template<typename T>
+inline const std::string& PartnerAccountType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PartnerAccountType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PartnerAccountType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PartnerAccountType_descriptor(), enum_t_value);
+}
+inline bool PartnerAccountType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PartnerAccountType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PartnerAccountType>(
+    PartnerAccountType_descriptor(), name, value);
+}
+enum GCConnectionStatus : int {
+  GCConnectionStatus_HAVE_SESSION = 0,
+  GCConnectionStatus_GC_GOING_DOWN = 1,
+  GCConnectionStatus_NO_SESSION = 2,
+  GCConnectionStatus_NO_SESSION_IN_LOGON_QUEUE = 3,
+  GCConnectionStatus_NO_STEAM = 4,
+  GCConnectionStatus_SUSPENDED = 5
+};
+bool GCConnectionStatus_IsValid(int value);
+constexpr GCConnectionStatus GCConnectionStatus_MIN = GCConnectionStatus_HAVE_SESSION;
+constexpr GCConnectionStatus GCConnectionStatus_MAX = GCConnectionStatus_SUSPENDED;
+constexpr int GCConnectionStatus_ARRAYSIZE = GCConnectionStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GCConnectionStatus_descriptor();
+template<typename T>
+inline const std::string& GCConnectionStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, GCConnectionStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function GCConnectionStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    GCConnectionStatus_descriptor(), enum_t_value);
+}
+inline bool GCConnectionStatus_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, GCConnectionStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<GCConnectionStatus>(
+    GCConnectionStatus_descriptor(), name, value);
+}
+// ===================================================================
+
+class CMsgSHA1Digest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSHA1Digest) */ {
+ public:
+  inline CMsgSHA1Digest() : CMsgSHA1Digest(nullptr) {}
+  ~CMsgSHA1Digest() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSHA1Digest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSHA1Digest(const CMsgSHA1Digest& from);
+  CMsgSHA1Digest(CMsgSHA1Digest&& from) noexcept
+    : CMsgSHA1Digest() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSHA1Digest& operator=(const CMsgSHA1Digest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSHA1Digest& operator=(CMsgSHA1Digest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSHA1Digest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSHA1Digest* internal_default_instance() {
+    return reinterpret_cast<const CMsgSHA1Digest*>(
+               &_CMsgSHA1Digest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CMsgSHA1Digest& a, CMsgSHA1Digest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSHA1Digest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSHA1Digest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSHA1Digest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSHA1Digest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSHA1Digest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSHA1Digest& from) {
+    CMsgSHA1Digest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSHA1Digest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSHA1Digest";
+  }
+  protected:
+  explicit CMsgSHA1Digest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlock1FieldNumber = 1,
+    kBlock2FieldNumber = 2,
+    kBlock3FieldNumber = 3,
+  };
+  // required fixed64 block1 = 1;
+  bool has_block1() const;
+  private:
+  bool _internal_has_block1() const;
+  public:
+  void clear_block1();
+  uint64_t block1() const;
+  void set_block1(uint64_t value);
+  private:
+  uint64_t _internal_block1() const;
+  void _internal_set_block1(uint64_t value);
+  public:
+
+  // required fixed64 block2 = 2;
+  bool has_block2() const;
+  private:
+  bool _internal_has_block2() const;
+  public:
+  void clear_block2();
+  uint64_t block2() const;
+  void set_block2(uint64_t value);
+  private:
+  uint64_t _internal_block2() const;
+  void _internal_set_block2(uint64_t value);
+  public:
+
+  // required fixed32 block3 = 3;
+  bool has_block3() const;
+  private:
+  bool _internal_has_block3() const;
+  public:
+  void clear_block3();
+  uint32_t block3() const;
+  void set_block3(uint32_t value);
+  private:
+  uint32_t _internal_block3() const;
+  void _internal_set_block3(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSHA1Digest)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t block1_;
+    uint64_t block2_;
+    uint32_t block3_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOIDOwner final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOIDOwner) */ {
+ public:
+  inline CMsgSOIDOwner() : CMsgSOIDOwner(nullptr) {}
+  ~CMsgSOIDOwner() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOIDOwner(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOIDOwner(const CMsgSOIDOwner& from);
+  CMsgSOIDOwner(CMsgSOIDOwner&& from) noexcept
+    : CMsgSOIDOwner() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOIDOwner& operator=(const CMsgSOIDOwner& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOIDOwner& operator=(CMsgSOIDOwner&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOIDOwner& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOIDOwner* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOIDOwner*>(
+               &_CMsgSOIDOwner_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(CMsgSOIDOwner& a, CMsgSOIDOwner& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOIDOwner* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOIDOwner* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOIDOwner* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOIDOwner>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOIDOwner& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOIDOwner& from) {
+    CMsgSOIDOwner::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOIDOwner* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOIDOwner";
+  }
+  protected:
+  explicit CMsgSOIDOwner(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
+  // optional uint64 id = 2;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // optional uint32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  uint32_t type() const;
+  void set_type(uint32_t value);
+  private:
+  uint32_t _internal_type() const;
+  void _internal_set_type(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOIDOwner)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t id_;
+    uint32_t type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOSingleObject final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOSingleObject) */ {
+ public:
+  inline CMsgSOSingleObject() : CMsgSOSingleObject(nullptr) {}
+  ~CMsgSOSingleObject() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOSingleObject(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOSingleObject(const CMsgSOSingleObject& from);
+  CMsgSOSingleObject(CMsgSOSingleObject&& from) noexcept
+    : CMsgSOSingleObject() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOSingleObject& operator=(const CMsgSOSingleObject& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOSingleObject& operator=(CMsgSOSingleObject&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOSingleObject& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOSingleObject* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOSingleObject*>(
+               &_CMsgSOSingleObject_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CMsgSOSingleObject& a, CMsgSOSingleObject& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOSingleObject* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOSingleObject* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOSingleObject* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOSingleObject>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOSingleObject& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOSingleObject& from) {
+    CMsgSOSingleObject::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOSingleObject* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOSingleObject";
+  }
+  protected:
+  explicit CMsgSOSingleObject(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kObjectDataFieldNumber = 3,
+    kOwnerSoidFieldNumber = 5,
+    kVersionFieldNumber = 4,
+    kTypeIdFieldNumber = 2,
+    kServiceIdFieldNumber = 6,
+  };
+  // optional bytes object_data = 3;
+  bool has_object_data() const;
+  private:
+  bool _internal_has_object_data() const;
+  public:
+  void clear_object_data();
+  const std::string& object_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_object_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_object_data();
+  PROTOBUF_NODISCARD std::string* release_object_data();
+  void set_allocated_object_data(std::string* object_data);
+  private:
+  const std::string& _internal_object_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_object_data(const std::string& value);
+  std::string* _internal_mutable_object_data();
+  public:
+
+  // optional .CMsgSOIDOwner owner_soid = 5;
+  bool has_owner_soid() const;
+  private:
+  bool _internal_has_owner_soid() const;
+  public:
+  void clear_owner_soid();
+  const ::CMsgSOIDOwner& owner_soid() const;
+  PROTOBUF_NODISCARD ::CMsgSOIDOwner* release_owner_soid();
+  ::CMsgSOIDOwner* mutable_owner_soid();
+  void set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid);
+  private:
+  const ::CMsgSOIDOwner& _internal_owner_soid() const;
+  ::CMsgSOIDOwner* _internal_mutable_owner_soid();
+  public:
+  void unsafe_arena_set_allocated_owner_soid(
+      ::CMsgSOIDOwner* owner_soid);
+  ::CMsgSOIDOwner* unsafe_arena_release_owner_soid();
+
+  // optional fixed64 version = 4;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // optional int32 type_id = 2;
+  bool has_type_id() const;
+  private:
+  bool _internal_has_type_id() const;
+  public:
+  void clear_type_id();
+  int32_t type_id() const;
+  void set_type_id(int32_t value);
+  private:
+  int32_t _internal_type_id() const;
+  void _internal_set_type_id(int32_t value);
+  public:
+
+  // optional uint32 service_id = 6;
+  bool has_service_id() const;
+  private:
+  bool _internal_has_service_id() const;
+  public:
+  void clear_service_id();
+  uint32_t service_id() const;
+  void set_service_id(uint32_t value);
+  private:
+  uint32_t _internal_service_id() const;
+  void _internal_set_service_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOSingleObject)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr object_data_;
+    ::CMsgSOIDOwner* owner_soid_;
+    uint64_t version_;
+    int32_t type_id_;
+    uint32_t service_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOMultipleObjects_SingleObject final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOMultipleObjects.SingleObject) */ {
+ public:
+  inline CMsgSOMultipleObjects_SingleObject() : CMsgSOMultipleObjects_SingleObject(nullptr) {}
+  ~CMsgSOMultipleObjects_SingleObject() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOMultipleObjects_SingleObject(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOMultipleObjects_SingleObject(const CMsgSOMultipleObjects_SingleObject& from);
+  CMsgSOMultipleObjects_SingleObject(CMsgSOMultipleObjects_SingleObject&& from) noexcept
+    : CMsgSOMultipleObjects_SingleObject() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOMultipleObjects_SingleObject& operator=(const CMsgSOMultipleObjects_SingleObject& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOMultipleObjects_SingleObject& operator=(CMsgSOMultipleObjects_SingleObject&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOMultipleObjects_SingleObject& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOMultipleObjects_SingleObject* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOMultipleObjects_SingleObject*>(
+               &_CMsgSOMultipleObjects_SingleObject_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CMsgSOMultipleObjects_SingleObject& a, CMsgSOMultipleObjects_SingleObject& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOMultipleObjects_SingleObject* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOMultipleObjects_SingleObject* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOMultipleObjects_SingleObject* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOMultipleObjects_SingleObject>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOMultipleObjects_SingleObject& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOMultipleObjects_SingleObject& from) {
+    CMsgSOMultipleObjects_SingleObject::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOMultipleObjects_SingleObject* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOMultipleObjects.SingleObject";
+  }
+  protected:
+  explicit CMsgSOMultipleObjects_SingleObject(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kObjectDataFieldNumber = 2,
+    kTypeIdFieldNumber = 1,
+  };
+  // optional bytes object_data = 2;
+  bool has_object_data() const;
+  private:
+  bool _internal_has_object_data() const;
+  public:
+  void clear_object_data();
+  const std::string& object_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_object_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_object_data();
+  PROTOBUF_NODISCARD std::string* release_object_data();
+  void set_allocated_object_data(std::string* object_data);
+  private:
+  const std::string& _internal_object_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_object_data(const std::string& value);
+  std::string* _internal_mutable_object_data();
+  public:
+
+  // optional int32 type_id = 1;
+  bool has_type_id() const;
+  private:
+  bool _internal_has_type_id() const;
+  public:
+  void clear_type_id();
+  int32_t type_id() const;
+  void set_type_id(int32_t value);
+  private:
+  int32_t _internal_type_id() const;
+  void _internal_set_type_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOMultipleObjects.SingleObject)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr object_data_;
+    int32_t type_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOMultipleObjects final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOMultipleObjects) */ {
+ public:
+  inline CMsgSOMultipleObjects() : CMsgSOMultipleObjects(nullptr) {}
+  ~CMsgSOMultipleObjects() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOMultipleObjects(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOMultipleObjects(const CMsgSOMultipleObjects& from);
+  CMsgSOMultipleObjects(CMsgSOMultipleObjects&& from) noexcept
+    : CMsgSOMultipleObjects() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOMultipleObjects& operator=(const CMsgSOMultipleObjects& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOMultipleObjects& operator=(CMsgSOMultipleObjects&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOMultipleObjects& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOMultipleObjects* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOMultipleObjects*>(
+               &_CMsgSOMultipleObjects_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CMsgSOMultipleObjects& a, CMsgSOMultipleObjects& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOMultipleObjects* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOMultipleObjects* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOMultipleObjects* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOMultipleObjects>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOMultipleObjects& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOMultipleObjects& from) {
+    CMsgSOMultipleObjects::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOMultipleObjects* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOMultipleObjects";
+  }
+  protected:
+  explicit CMsgSOMultipleObjects(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CMsgSOMultipleObjects_SingleObject SingleObject;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kObjectsModifiedFieldNumber = 2,
+    kObjectsAddedFieldNumber = 4,
+    kObjectsRemovedFieldNumber = 5,
+    kOwnerSoidFieldNumber = 6,
+    kVersionFieldNumber = 3,
+    kServiceIdFieldNumber = 7,
+  };
+  // repeated .CMsgSOMultipleObjects.SingleObject objects_modified = 2;
+  int objects_modified_size() const;
+  private:
+  int _internal_objects_modified_size() const;
+  public:
+  void clear_objects_modified();
+  ::CMsgSOMultipleObjects_SingleObject* mutable_objects_modified(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >*
+      mutable_objects_modified();
+  private:
+  const ::CMsgSOMultipleObjects_SingleObject& _internal_objects_modified(int index) const;
+  ::CMsgSOMultipleObjects_SingleObject* _internal_add_objects_modified();
+  public:
+  const ::CMsgSOMultipleObjects_SingleObject& objects_modified(int index) const;
+  ::CMsgSOMultipleObjects_SingleObject* add_objects_modified();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >&
+      objects_modified() const;
+
+  // repeated .CMsgSOMultipleObjects.SingleObject objects_added = 4;
+  int objects_added_size() const;
+  private:
+  int _internal_objects_added_size() const;
+  public:
+  void clear_objects_added();
+  ::CMsgSOMultipleObjects_SingleObject* mutable_objects_added(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >*
+      mutable_objects_added();
+  private:
+  const ::CMsgSOMultipleObjects_SingleObject& _internal_objects_added(int index) const;
+  ::CMsgSOMultipleObjects_SingleObject* _internal_add_objects_added();
+  public:
+  const ::CMsgSOMultipleObjects_SingleObject& objects_added(int index) const;
+  ::CMsgSOMultipleObjects_SingleObject* add_objects_added();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >&
+      objects_added() const;
+
+  // repeated .CMsgSOMultipleObjects.SingleObject objects_removed = 5;
+  int objects_removed_size() const;
+  private:
+  int _internal_objects_removed_size() const;
+  public:
+  void clear_objects_removed();
+  ::CMsgSOMultipleObjects_SingleObject* mutable_objects_removed(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >*
+      mutable_objects_removed();
+  private:
+  const ::CMsgSOMultipleObjects_SingleObject& _internal_objects_removed(int index) const;
+  ::CMsgSOMultipleObjects_SingleObject* _internal_add_objects_removed();
+  public:
+  const ::CMsgSOMultipleObjects_SingleObject& objects_removed(int index) const;
+  ::CMsgSOMultipleObjects_SingleObject* add_objects_removed();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >&
+      objects_removed() const;
+
+  // optional .CMsgSOIDOwner owner_soid = 6;
+  bool has_owner_soid() const;
+  private:
+  bool _internal_has_owner_soid() const;
+  public:
+  void clear_owner_soid();
+  const ::CMsgSOIDOwner& owner_soid() const;
+  PROTOBUF_NODISCARD ::CMsgSOIDOwner* release_owner_soid();
+  ::CMsgSOIDOwner* mutable_owner_soid();
+  void set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid);
+  private:
+  const ::CMsgSOIDOwner& _internal_owner_soid() const;
+  ::CMsgSOIDOwner* _internal_mutable_owner_soid();
+  public:
+  void unsafe_arena_set_allocated_owner_soid(
+      ::CMsgSOIDOwner* owner_soid);
+  ::CMsgSOIDOwner* unsafe_arena_release_owner_soid();
+
+  // optional fixed64 version = 3;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // optional uint32 service_id = 7;
+  bool has_service_id() const;
+  private:
+  bool _internal_has_service_id() const;
+  public:
+  void clear_service_id();
+  uint32_t service_id() const;
+  void set_service_id(uint32_t value);
+  private:
+  uint32_t _internal_service_id() const;
+  void _internal_set_service_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOMultipleObjects)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject > objects_modified_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject > objects_added_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject > objects_removed_;
+    ::CMsgSOIDOwner* owner_soid_;
+    uint64_t version_;
+    uint32_t service_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOCacheSubscribed_SubscribedType final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOCacheSubscribed.SubscribedType) */ {
+ public:
+  inline CMsgSOCacheSubscribed_SubscribedType() : CMsgSOCacheSubscribed_SubscribedType(nullptr) {}
+  ~CMsgSOCacheSubscribed_SubscribedType() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOCacheSubscribed_SubscribedType(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOCacheSubscribed_SubscribedType(const CMsgSOCacheSubscribed_SubscribedType& from);
+  CMsgSOCacheSubscribed_SubscribedType(CMsgSOCacheSubscribed_SubscribedType&& from) noexcept
+    : CMsgSOCacheSubscribed_SubscribedType() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOCacheSubscribed_SubscribedType& operator=(const CMsgSOCacheSubscribed_SubscribedType& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOCacheSubscribed_SubscribedType& operator=(CMsgSOCacheSubscribed_SubscribedType&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOCacheSubscribed_SubscribedType& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOCacheSubscribed_SubscribedType* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOCacheSubscribed_SubscribedType*>(
+               &_CMsgSOCacheSubscribed_SubscribedType_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(CMsgSOCacheSubscribed_SubscribedType& a, CMsgSOCacheSubscribed_SubscribedType& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOCacheSubscribed_SubscribedType* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOCacheSubscribed_SubscribedType* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOCacheSubscribed_SubscribedType* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOCacheSubscribed_SubscribedType>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOCacheSubscribed_SubscribedType& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOCacheSubscribed_SubscribedType& from) {
+    CMsgSOCacheSubscribed_SubscribedType::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOCacheSubscribed_SubscribedType* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOCacheSubscribed.SubscribedType";
+  }
+  protected:
+  explicit CMsgSOCacheSubscribed_SubscribedType(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kObjectDataFieldNumber = 2,
+    kTypeIdFieldNumber = 1,
+  };
+  // repeated bytes object_data = 2;
+  int object_data_size() const;
+  private:
+  int _internal_object_data_size() const;
+  public:
+  void clear_object_data();
+  const std::string& object_data(int index) const;
+  std::string* mutable_object_data(int index);
+  void set_object_data(int index, const std::string& value);
+  void set_object_data(int index, std::string&& value);
+  void set_object_data(int index, const char* value);
+  void set_object_data(int index, const void* value, size_t size);
+  std::string* add_object_data();
+  void add_object_data(const std::string& value);
+  void add_object_data(std::string&& value);
+  void add_object_data(const char* value);
+  void add_object_data(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& object_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_object_data();
+  private:
+  const std::string& _internal_object_data(int index) const;
+  std::string* _internal_add_object_data();
+  public:
+
+  // optional int32 type_id = 1;
+  bool has_type_id() const;
+  private:
+  bool _internal_has_type_id() const;
+  public:
+  void clear_type_id();
+  int32_t type_id() const;
+  void set_type_id(int32_t value);
+  private:
+  int32_t _internal_type_id() const;
+  void _internal_set_type_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOCacheSubscribed.SubscribedType)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> object_data_;
+    int32_t type_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOCacheSubscribed final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOCacheSubscribed) */ {
+ public:
+  inline CMsgSOCacheSubscribed() : CMsgSOCacheSubscribed(nullptr) {}
+  ~CMsgSOCacheSubscribed() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOCacheSubscribed(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOCacheSubscribed(const CMsgSOCacheSubscribed& from);
+  CMsgSOCacheSubscribed(CMsgSOCacheSubscribed&& from) noexcept
+    : CMsgSOCacheSubscribed() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOCacheSubscribed& operator=(const CMsgSOCacheSubscribed& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOCacheSubscribed& operator=(CMsgSOCacheSubscribed&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOCacheSubscribed& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOCacheSubscribed* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOCacheSubscribed*>(
+               &_CMsgSOCacheSubscribed_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(CMsgSOCacheSubscribed& a, CMsgSOCacheSubscribed& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOCacheSubscribed* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOCacheSubscribed* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOCacheSubscribed* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOCacheSubscribed>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOCacheSubscribed& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOCacheSubscribed& from) {
+    CMsgSOCacheSubscribed::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOCacheSubscribed* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOCacheSubscribed";
+  }
+  protected:
+  explicit CMsgSOCacheSubscribed(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CMsgSOCacheSubscribed_SubscribedType SubscribedType;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kObjectsFieldNumber = 2,
+    kServiceListFieldNumber = 6,
+    kOwnerSoidFieldNumber = 4,
+    kVersionFieldNumber = 3,
+    kSyncVersionFieldNumber = 7,
+    kServiceIdFieldNumber = 5,
+  };
+  // repeated .CMsgSOCacheSubscribed.SubscribedType objects = 2;
+  int objects_size() const;
+  private:
+  int _internal_objects_size() const;
+  public:
+  void clear_objects();
+  ::CMsgSOCacheSubscribed_SubscribedType* mutable_objects(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed_SubscribedType >*
+      mutable_objects();
+  private:
+  const ::CMsgSOCacheSubscribed_SubscribedType& _internal_objects(int index) const;
+  ::CMsgSOCacheSubscribed_SubscribedType* _internal_add_objects();
+  public:
+  const ::CMsgSOCacheSubscribed_SubscribedType& objects(int index) const;
+  ::CMsgSOCacheSubscribed_SubscribedType* add_objects();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed_SubscribedType >&
+      objects() const;
+
+  // repeated uint32 service_list = 6;
+  int service_list_size() const;
+  private:
+  int _internal_service_list_size() const;
+  public:
+  void clear_service_list();
+  private:
+  uint32_t _internal_service_list(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_service_list() const;
+  void _internal_add_service_list(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_service_list();
+  public:
+  uint32_t service_list(int index) const;
+  void set_service_list(int index, uint32_t value);
+  void add_service_list(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      service_list() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_service_list();
+
+  // optional .CMsgSOIDOwner owner_soid = 4;
+  bool has_owner_soid() const;
+  private:
+  bool _internal_has_owner_soid() const;
+  public:
+  void clear_owner_soid();
+  const ::CMsgSOIDOwner& owner_soid() const;
+  PROTOBUF_NODISCARD ::CMsgSOIDOwner* release_owner_soid();
+  ::CMsgSOIDOwner* mutable_owner_soid();
+  void set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid);
+  private:
+  const ::CMsgSOIDOwner& _internal_owner_soid() const;
+  ::CMsgSOIDOwner* _internal_mutable_owner_soid();
+  public:
+  void unsafe_arena_set_allocated_owner_soid(
+      ::CMsgSOIDOwner* owner_soid);
+  ::CMsgSOIDOwner* unsafe_arena_release_owner_soid();
+
+  // optional fixed64 version = 3;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // optional fixed64 sync_version = 7;
+  bool has_sync_version() const;
+  private:
+  bool _internal_has_sync_version() const;
+  public:
+  void clear_sync_version();
+  uint64_t sync_version() const;
+  void set_sync_version(uint64_t value);
+  private:
+  uint64_t _internal_sync_version() const;
+  void _internal_set_sync_version(uint64_t value);
+  public:
+
+  // optional uint32 service_id = 5;
+  bool has_service_id() const;
+  private:
+  bool _internal_has_service_id() const;
+  public:
+  void clear_service_id();
+  uint32_t service_id() const;
+  void set_service_id(uint32_t value);
+  private:
+  uint32_t _internal_service_id() const;
+  void _internal_set_service_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOCacheSubscribed)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed_SubscribedType > objects_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > service_list_;
+    ::CMsgSOIDOwner* owner_soid_;
+    uint64_t version_;
+    uint64_t sync_version_;
+    uint32_t service_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOCacheSubscribedUpToDate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOCacheSubscribedUpToDate) */ {
+ public:
+  inline CMsgSOCacheSubscribedUpToDate() : CMsgSOCacheSubscribedUpToDate(nullptr) {}
+  ~CMsgSOCacheSubscribedUpToDate() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOCacheSubscribedUpToDate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOCacheSubscribedUpToDate(const CMsgSOCacheSubscribedUpToDate& from);
+  CMsgSOCacheSubscribedUpToDate(CMsgSOCacheSubscribedUpToDate&& from) noexcept
+    : CMsgSOCacheSubscribedUpToDate() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOCacheSubscribedUpToDate& operator=(const CMsgSOCacheSubscribedUpToDate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOCacheSubscribedUpToDate& operator=(CMsgSOCacheSubscribedUpToDate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOCacheSubscribedUpToDate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOCacheSubscribedUpToDate* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOCacheSubscribedUpToDate*>(
+               &_CMsgSOCacheSubscribedUpToDate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(CMsgSOCacheSubscribedUpToDate& a, CMsgSOCacheSubscribedUpToDate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOCacheSubscribedUpToDate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOCacheSubscribedUpToDate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOCacheSubscribedUpToDate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOCacheSubscribedUpToDate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOCacheSubscribedUpToDate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOCacheSubscribedUpToDate& from) {
+    CMsgSOCacheSubscribedUpToDate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOCacheSubscribedUpToDate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOCacheSubscribedUpToDate";
+  }
+  protected:
+  explicit CMsgSOCacheSubscribedUpToDate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceListFieldNumber = 4,
+    kOwnerSoidFieldNumber = 2,
+    kVersionFieldNumber = 1,
+    kSyncVersionFieldNumber = 5,
+    kServiceIdFieldNumber = 3,
+  };
+  // repeated uint32 service_list = 4;
+  int service_list_size() const;
+  private:
+  int _internal_service_list_size() const;
+  public:
+  void clear_service_list();
+  private:
+  uint32_t _internal_service_list(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_service_list() const;
+  void _internal_add_service_list(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_service_list();
+  public:
+  uint32_t service_list(int index) const;
+  void set_service_list(int index, uint32_t value);
+  void add_service_list(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      service_list() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_service_list();
+
+  // optional .CMsgSOIDOwner owner_soid = 2;
+  bool has_owner_soid() const;
+  private:
+  bool _internal_has_owner_soid() const;
+  public:
+  void clear_owner_soid();
+  const ::CMsgSOIDOwner& owner_soid() const;
+  PROTOBUF_NODISCARD ::CMsgSOIDOwner* release_owner_soid();
+  ::CMsgSOIDOwner* mutable_owner_soid();
+  void set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid);
+  private:
+  const ::CMsgSOIDOwner& _internal_owner_soid() const;
+  ::CMsgSOIDOwner* _internal_mutable_owner_soid();
+  public:
+  void unsafe_arena_set_allocated_owner_soid(
+      ::CMsgSOIDOwner* owner_soid);
+  ::CMsgSOIDOwner* unsafe_arena_release_owner_soid();
+
+  // optional fixed64 version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // optional fixed64 sync_version = 5;
+  bool has_sync_version() const;
+  private:
+  bool _internal_has_sync_version() const;
+  public:
+  void clear_sync_version();
+  uint64_t sync_version() const;
+  void set_sync_version(uint64_t value);
+  private:
+  uint64_t _internal_sync_version() const;
+  void _internal_set_sync_version(uint64_t value);
+  public:
+
+  // optional uint32 service_id = 3;
+  bool has_service_id() const;
+  private:
+  bool _internal_has_service_id() const;
+  public:
+  void clear_service_id();
+  uint32_t service_id() const;
+  void set_service_id(uint32_t value);
+  private:
+  uint32_t _internal_service_id() const;
+  void _internal_set_service_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOCacheSubscribedUpToDate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > service_list_;
+    ::CMsgSOIDOwner* owner_soid_;
+    uint64_t version_;
+    uint64_t sync_version_;
+    uint32_t service_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOCacheUnsubscribed final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOCacheUnsubscribed) */ {
+ public:
+  inline CMsgSOCacheUnsubscribed() : CMsgSOCacheUnsubscribed(nullptr) {}
+  ~CMsgSOCacheUnsubscribed() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOCacheUnsubscribed(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOCacheUnsubscribed(const CMsgSOCacheUnsubscribed& from);
+  CMsgSOCacheUnsubscribed(CMsgSOCacheUnsubscribed&& from) noexcept
+    : CMsgSOCacheUnsubscribed() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOCacheUnsubscribed& operator=(const CMsgSOCacheUnsubscribed& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOCacheUnsubscribed& operator=(CMsgSOCacheUnsubscribed&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOCacheUnsubscribed& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOCacheUnsubscribed* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOCacheUnsubscribed*>(
+               &_CMsgSOCacheUnsubscribed_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(CMsgSOCacheUnsubscribed& a, CMsgSOCacheUnsubscribed& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOCacheUnsubscribed* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOCacheUnsubscribed* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOCacheUnsubscribed* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOCacheUnsubscribed>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOCacheUnsubscribed& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOCacheUnsubscribed& from) {
+    CMsgSOCacheUnsubscribed::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOCacheUnsubscribed* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOCacheUnsubscribed";
+  }
+  protected:
+  explicit CMsgSOCacheUnsubscribed(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOwnerSoidFieldNumber = 2,
+  };
+  // optional .CMsgSOIDOwner owner_soid = 2;
+  bool has_owner_soid() const;
+  private:
+  bool _internal_has_owner_soid() const;
+  public:
+  void clear_owner_soid();
+  const ::CMsgSOIDOwner& owner_soid() const;
+  PROTOBUF_NODISCARD ::CMsgSOIDOwner* release_owner_soid();
+  ::CMsgSOIDOwner* mutable_owner_soid();
+  void set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid);
+  private:
+  const ::CMsgSOIDOwner& _internal_owner_soid() const;
+  ::CMsgSOIDOwner* _internal_mutable_owner_soid();
+  public:
+  void unsafe_arena_set_allocated_owner_soid(
+      ::CMsgSOIDOwner* owner_soid);
+  ::CMsgSOIDOwner* unsafe_arena_release_owner_soid();
+
+  // @@protoc_insertion_point(class_scope:CMsgSOCacheUnsubscribed)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CMsgSOIDOwner* owner_soid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOCacheSubscriptionCheck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOCacheSubscriptionCheck) */ {
+ public:
+  inline CMsgSOCacheSubscriptionCheck() : CMsgSOCacheSubscriptionCheck(nullptr) {}
+  ~CMsgSOCacheSubscriptionCheck() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOCacheSubscriptionCheck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOCacheSubscriptionCheck(const CMsgSOCacheSubscriptionCheck& from);
+  CMsgSOCacheSubscriptionCheck(CMsgSOCacheSubscriptionCheck&& from) noexcept
+    : CMsgSOCacheSubscriptionCheck() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOCacheSubscriptionCheck& operator=(const CMsgSOCacheSubscriptionCheck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOCacheSubscriptionCheck& operator=(CMsgSOCacheSubscriptionCheck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOCacheSubscriptionCheck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOCacheSubscriptionCheck* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOCacheSubscriptionCheck*>(
+               &_CMsgSOCacheSubscriptionCheck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(CMsgSOCacheSubscriptionCheck& a, CMsgSOCacheSubscriptionCheck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOCacheSubscriptionCheck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOCacheSubscriptionCheck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOCacheSubscriptionCheck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOCacheSubscriptionCheck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOCacheSubscriptionCheck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOCacheSubscriptionCheck& from) {
+    CMsgSOCacheSubscriptionCheck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOCacheSubscriptionCheck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOCacheSubscriptionCheck";
+  }
+  protected:
+  explicit CMsgSOCacheSubscriptionCheck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceListFieldNumber = 5,
+    kOwnerSoidFieldNumber = 3,
+    kVersionFieldNumber = 2,
+    kSyncVersionFieldNumber = 6,
+    kServiceIdFieldNumber = 4,
+  };
+  // repeated uint32 service_list = 5;
+  int service_list_size() const;
+  private:
+  int _internal_service_list_size() const;
+  public:
+  void clear_service_list();
+  private:
+  uint32_t _internal_service_list(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_service_list() const;
+  void _internal_add_service_list(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_service_list();
+  public:
+  uint32_t service_list(int index) const;
+  void set_service_list(int index, uint32_t value);
+  void add_service_list(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      service_list() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_service_list();
+
+  // optional .CMsgSOIDOwner owner_soid = 3;
+  bool has_owner_soid() const;
+  private:
+  bool _internal_has_owner_soid() const;
+  public:
+  void clear_owner_soid();
+  const ::CMsgSOIDOwner& owner_soid() const;
+  PROTOBUF_NODISCARD ::CMsgSOIDOwner* release_owner_soid();
+  ::CMsgSOIDOwner* mutable_owner_soid();
+  void set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid);
+  private:
+  const ::CMsgSOIDOwner& _internal_owner_soid() const;
+  ::CMsgSOIDOwner* _internal_mutable_owner_soid();
+  public:
+  void unsafe_arena_set_allocated_owner_soid(
+      ::CMsgSOIDOwner* owner_soid);
+  ::CMsgSOIDOwner* unsafe_arena_release_owner_soid();
+
+  // optional fixed64 version = 2;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // optional fixed64 sync_version = 6;
+  bool has_sync_version() const;
+  private:
+  bool _internal_has_sync_version() const;
+  public:
+  void clear_sync_version();
+  uint64_t sync_version() const;
+  void set_sync_version(uint64_t value);
+  private:
+  uint64_t _internal_sync_version() const;
+  void _internal_set_sync_version(uint64_t value);
+  public:
+
+  // optional uint32 service_id = 4;
+  bool has_service_id() const;
+  private:
+  bool _internal_has_service_id() const;
+  public:
+  void clear_service_id();
+  uint32_t service_id() const;
+  void set_service_id(uint32_t value);
+  private:
+  uint32_t _internal_service_id() const;
+  void _internal_set_service_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOCacheSubscriptionCheck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > service_list_;
+    ::CMsgSOIDOwner* owner_soid_;
+    uint64_t version_;
+    uint64_t sync_version_;
+    uint32_t service_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOCacheSubscriptionRefresh final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOCacheSubscriptionRefresh) */ {
+ public:
+  inline CMsgSOCacheSubscriptionRefresh() : CMsgSOCacheSubscriptionRefresh(nullptr) {}
+  ~CMsgSOCacheSubscriptionRefresh() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOCacheSubscriptionRefresh(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOCacheSubscriptionRefresh(const CMsgSOCacheSubscriptionRefresh& from);
+  CMsgSOCacheSubscriptionRefresh(CMsgSOCacheSubscriptionRefresh&& from) noexcept
+    : CMsgSOCacheSubscriptionRefresh() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOCacheSubscriptionRefresh& operator=(const CMsgSOCacheSubscriptionRefresh& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOCacheSubscriptionRefresh& operator=(CMsgSOCacheSubscriptionRefresh&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOCacheSubscriptionRefresh& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOCacheSubscriptionRefresh* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOCacheSubscriptionRefresh*>(
+               &_CMsgSOCacheSubscriptionRefresh_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(CMsgSOCacheSubscriptionRefresh& a, CMsgSOCacheSubscriptionRefresh& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOCacheSubscriptionRefresh* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOCacheSubscriptionRefresh* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOCacheSubscriptionRefresh* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOCacheSubscriptionRefresh>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOCacheSubscriptionRefresh& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOCacheSubscriptionRefresh& from) {
+    CMsgSOCacheSubscriptionRefresh::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOCacheSubscriptionRefresh* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOCacheSubscriptionRefresh";
+  }
+  protected:
+  explicit CMsgSOCacheSubscriptionRefresh(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOwnerSoidFieldNumber = 2,
+  };
+  // optional .CMsgSOIDOwner owner_soid = 2;
+  bool has_owner_soid() const;
+  private:
+  bool _internal_has_owner_soid() const;
+  public:
+  void clear_owner_soid();
+  const ::CMsgSOIDOwner& owner_soid() const;
+  PROTOBUF_NODISCARD ::CMsgSOIDOwner* release_owner_soid();
+  ::CMsgSOIDOwner* mutable_owner_soid();
+  void set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid);
+  private:
+  const ::CMsgSOIDOwner& _internal_owner_soid() const;
+  ::CMsgSOIDOwner* _internal_mutable_owner_soid();
+  public:
+  void unsafe_arena_set_allocated_owner_soid(
+      ::CMsgSOIDOwner* owner_soid);
+  ::CMsgSOIDOwner* unsafe_arena_release_owner_soid();
+
+  // @@protoc_insertion_point(class_scope:CMsgSOCacheSubscriptionRefresh)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CMsgSOIDOwner* owner_soid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOCacheVersion final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOCacheVersion) */ {
+ public:
+  inline CMsgSOCacheVersion() : CMsgSOCacheVersion(nullptr) {}
+  ~CMsgSOCacheVersion() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOCacheVersion(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOCacheVersion(const CMsgSOCacheVersion& from);
+  CMsgSOCacheVersion(CMsgSOCacheVersion&& from) noexcept
+    : CMsgSOCacheVersion() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOCacheVersion& operator=(const CMsgSOCacheVersion& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOCacheVersion& operator=(CMsgSOCacheVersion&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOCacheVersion& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOCacheVersion* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOCacheVersion*>(
+               &_CMsgSOCacheVersion_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(CMsgSOCacheVersion& a, CMsgSOCacheVersion& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOCacheVersion* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOCacheVersion* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOCacheVersion* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOCacheVersion>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOCacheVersion& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOCacheVersion& from) {
+    CMsgSOCacheVersion::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOCacheVersion* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOCacheVersion";
+  }
+  protected:
+  explicit CMsgSOCacheVersion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+  };
+  // optional fixed64 version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOCacheVersion)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCMultiplexMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCMultiplexMessage) */ {
+ public:
+  inline CMsgGCMultiplexMessage() : CMsgGCMultiplexMessage(nullptr) {}
+  ~CMsgGCMultiplexMessage() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCMultiplexMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCMultiplexMessage(const CMsgGCMultiplexMessage& from);
+  CMsgGCMultiplexMessage(CMsgGCMultiplexMessage&& from) noexcept
+    : CMsgGCMultiplexMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCMultiplexMessage& operator=(const CMsgGCMultiplexMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCMultiplexMessage& operator=(CMsgGCMultiplexMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCMultiplexMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCMultiplexMessage* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCMultiplexMessage*>(
+               &_CMsgGCMultiplexMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(CMsgGCMultiplexMessage& a, CMsgGCMultiplexMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCMultiplexMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCMultiplexMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCMultiplexMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCMultiplexMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCMultiplexMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCMultiplexMessage& from) {
+    CMsgGCMultiplexMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCMultiplexMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCMultiplexMessage";
+  }
+  protected:
+  explicit CMsgGCMultiplexMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSteamidsFieldNumber = 3,
+    kPayloadFieldNumber = 2,
+    kMsgtypeFieldNumber = 1,
+  };
+  // repeated fixed64 steamids = 3;
+  int steamids_size() const;
+  private:
+  int _internal_steamids_size() const;
+  public:
+  void clear_steamids();
+  private:
+  uint64_t _internal_steamids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_steamids() const;
+  void _internal_add_steamids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_steamids();
+  public:
+  uint64_t steamids(int index) const;
+  void set_steamids(int index, uint64_t value);
+  void add_steamids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      steamids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_steamids();
+
+  // optional bytes payload = 2;
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
+
+  // optional uint32 msgtype = 1;
+  bool has_msgtype() const;
+  private:
+  bool _internal_has_msgtype() const;
+  public:
+  void clear_msgtype();
+  uint32_t msgtype() const;
+  void set_msgtype(uint32_t value);
+  private:
+  uint32_t _internal_msgtype() const;
+  void _internal_set_msgtype(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgGCMultiplexMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > steamids_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    uint32_t msgtype_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CGCToGCMsgMasterAck_Process final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CGCToGCMsgMasterAck.Process) */ {
+ public:
+  inline CGCToGCMsgMasterAck_Process() : CGCToGCMsgMasterAck_Process(nullptr) {}
+  ~CGCToGCMsgMasterAck_Process() override;
+  explicit PROTOBUF_CONSTEXPR CGCToGCMsgMasterAck_Process(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CGCToGCMsgMasterAck_Process(const CGCToGCMsgMasterAck_Process& from);
+  CGCToGCMsgMasterAck_Process(CGCToGCMsgMasterAck_Process&& from) noexcept
+    : CGCToGCMsgMasterAck_Process() {
+    *this = ::std::move(from);
+  }
+
+  inline CGCToGCMsgMasterAck_Process& operator=(const CGCToGCMsgMasterAck_Process& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CGCToGCMsgMasterAck_Process& operator=(CGCToGCMsgMasterAck_Process&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CGCToGCMsgMasterAck_Process& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CGCToGCMsgMasterAck_Process* internal_default_instance() {
+    return reinterpret_cast<const CGCToGCMsgMasterAck_Process*>(
+               &_CGCToGCMsgMasterAck_Process_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(CGCToGCMsgMasterAck_Process& a, CGCToGCMsgMasterAck_Process& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CGCToGCMsgMasterAck_Process* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CGCToGCMsgMasterAck_Process* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CGCToGCMsgMasterAck_Process* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CGCToGCMsgMasterAck_Process>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CGCToGCMsgMasterAck_Process& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CGCToGCMsgMasterAck_Process& from) {
+    CGCToGCMsgMasterAck_Process::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CGCToGCMsgMasterAck_Process* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CGCToGCMsgMasterAck.Process";
+  }
+  protected:
+  explicit CGCToGCMsgMasterAck_Process(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTypeInstancesFieldNumber = 2,
+    kDirIndexFieldNumber = 1,
+  };
+  // repeated uint32 type_instances = 2;
+  int type_instances_size() const;
+  private:
+  int _internal_type_instances_size() const;
+  public:
+  void clear_type_instances();
+  private:
+  uint32_t _internal_type_instances(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_type_instances() const;
+  void _internal_add_type_instances(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_type_instances();
+  public:
+  uint32_t type_instances(int index) const;
+  void set_type_instances(int index, uint32_t value);
+  void add_type_instances(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      type_instances() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_type_instances();
+
+  // optional uint32 dir_index = 1;
+  bool has_dir_index() const;
+  private:
+  bool _internal_has_dir_index() const;
+  public:
+  void clear_dir_index();
+  uint32_t dir_index() const;
+  void set_dir_index(uint32_t value);
+  private:
+  uint32_t _internal_dir_index() const;
+  void _internal_set_dir_index(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CGCToGCMsgMasterAck.Process)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > type_instances_;
+    uint32_t dir_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CGCToGCMsgMasterAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CGCToGCMsgMasterAck) */ {
+ public:
+  inline CGCToGCMsgMasterAck() : CGCToGCMsgMasterAck(nullptr) {}
+  ~CGCToGCMsgMasterAck() override;
+  explicit PROTOBUF_CONSTEXPR CGCToGCMsgMasterAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CGCToGCMsgMasterAck(const CGCToGCMsgMasterAck& from);
+  CGCToGCMsgMasterAck(CGCToGCMsgMasterAck&& from) noexcept
+    : CGCToGCMsgMasterAck() {
+    *this = ::std::move(from);
+  }
+
+  inline CGCToGCMsgMasterAck& operator=(const CGCToGCMsgMasterAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CGCToGCMsgMasterAck& operator=(CGCToGCMsgMasterAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CGCToGCMsgMasterAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CGCToGCMsgMasterAck* internal_default_instance() {
+    return reinterpret_cast<const CGCToGCMsgMasterAck*>(
+               &_CGCToGCMsgMasterAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(CGCToGCMsgMasterAck& a, CGCToGCMsgMasterAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CGCToGCMsgMasterAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CGCToGCMsgMasterAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CGCToGCMsgMasterAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CGCToGCMsgMasterAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CGCToGCMsgMasterAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CGCToGCMsgMasterAck& from) {
+    CGCToGCMsgMasterAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CGCToGCMsgMasterAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CGCToGCMsgMasterAck";
+  }
+  protected:
+  explicit CGCToGCMsgMasterAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CGCToGCMsgMasterAck_Process Process;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDirectoryFieldNumber = 6,
+    kMachineNameFieldNumber = 3,
+    kProcessNameFieldNumber = 4,
+    kDirIndexFieldNumber = 1,
+  };
+  // repeated .CGCToGCMsgMasterAck.Process directory = 6;
+  int directory_size() const;
+  private:
+  int _internal_directory_size() const;
+  public:
+  void clear_directory();
+  ::CGCToGCMsgMasterAck_Process* mutable_directory(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterAck_Process >*
+      mutable_directory();
+  private:
+  const ::CGCToGCMsgMasterAck_Process& _internal_directory(int index) const;
+  ::CGCToGCMsgMasterAck_Process* _internal_add_directory();
+  public:
+  const ::CGCToGCMsgMasterAck_Process& directory(int index) const;
+  ::CGCToGCMsgMasterAck_Process* add_directory();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterAck_Process >&
+      directory() const;
+
+  // optional string machine_name = 3;
+  bool has_machine_name() const;
+  private:
+  bool _internal_has_machine_name() const;
+  public:
+  void clear_machine_name();
+  const std::string& machine_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_machine_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_machine_name();
+  PROTOBUF_NODISCARD std::string* release_machine_name();
+  void set_allocated_machine_name(std::string* machine_name);
+  private:
+  const std::string& _internal_machine_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_machine_name(const std::string& value);
+  std::string* _internal_mutable_machine_name();
+  public:
+
+  // optional string process_name = 4;
+  bool has_process_name() const;
+  private:
+  bool _internal_has_process_name() const;
+  public:
+  void clear_process_name();
+  const std::string& process_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_process_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_process_name();
+  PROTOBUF_NODISCARD std::string* release_process_name();
+  void set_allocated_process_name(std::string* process_name);
+  private:
+  const std::string& _internal_process_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_process_name(const std::string& value);
+  std::string* _internal_mutable_process_name();
+  public:
+
+  // optional uint32 dir_index = 1;
+  bool has_dir_index() const;
+  private:
+  bool _internal_has_dir_index() const;
+  public:
+  void clear_dir_index();
+  uint32_t dir_index() const;
+  void set_dir_index(uint32_t value);
+  private:
+  uint32_t _internal_dir_index() const;
+  void _internal_set_dir_index(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CGCToGCMsgMasterAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterAck_Process > directory_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr machine_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr process_name_;
+    uint32_t dir_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CGCToGCMsgMasterAck_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CGCToGCMsgMasterAck_Response) */ {
+ public:
+  inline CGCToGCMsgMasterAck_Response() : CGCToGCMsgMasterAck_Response(nullptr) {}
+  ~CGCToGCMsgMasterAck_Response() override;
+  explicit PROTOBUF_CONSTEXPR CGCToGCMsgMasterAck_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CGCToGCMsgMasterAck_Response(const CGCToGCMsgMasterAck_Response& from);
+  CGCToGCMsgMasterAck_Response(CGCToGCMsgMasterAck_Response&& from) noexcept
+    : CGCToGCMsgMasterAck_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline CGCToGCMsgMasterAck_Response& operator=(const CGCToGCMsgMasterAck_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CGCToGCMsgMasterAck_Response& operator=(CGCToGCMsgMasterAck_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CGCToGCMsgMasterAck_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CGCToGCMsgMasterAck_Response* internal_default_instance() {
+    return reinterpret_cast<const CGCToGCMsgMasterAck_Response*>(
+               &_CGCToGCMsgMasterAck_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(CGCToGCMsgMasterAck_Response& a, CGCToGCMsgMasterAck_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CGCToGCMsgMasterAck_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CGCToGCMsgMasterAck_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CGCToGCMsgMasterAck_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CGCToGCMsgMasterAck_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CGCToGCMsgMasterAck_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CGCToGCMsgMasterAck_Response& from) {
+    CGCToGCMsgMasterAck_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CGCToGCMsgMasterAck_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CGCToGCMsgMasterAck_Response";
+  }
+  protected:
+  explicit CGCToGCMsgMasterAck_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEresultFieldNumber = 1,
+  };
+  // optional int32 eresult = 1 [default = 2];
+  bool has_eresult() const;
+  private:
+  bool _internal_has_eresult() const;
+  public:
+  void clear_eresult();
+  int32_t eresult() const;
+  void set_eresult(int32_t value);
+  private:
+  int32_t _internal_eresult() const;
+  void _internal_set_eresult(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CGCToGCMsgMasterAck_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t eresult_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CGCToGCMsgMasterStartupComplete_GCInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CGCToGCMsgMasterStartupComplete.GCInfo) */ {
+ public:
+  inline CGCToGCMsgMasterStartupComplete_GCInfo() : CGCToGCMsgMasterStartupComplete_GCInfo(nullptr) {}
+  ~CGCToGCMsgMasterStartupComplete_GCInfo() override;
+  explicit PROTOBUF_CONSTEXPR CGCToGCMsgMasterStartupComplete_GCInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CGCToGCMsgMasterStartupComplete_GCInfo(const CGCToGCMsgMasterStartupComplete_GCInfo& from);
+  CGCToGCMsgMasterStartupComplete_GCInfo(CGCToGCMsgMasterStartupComplete_GCInfo&& from) noexcept
+    : CGCToGCMsgMasterStartupComplete_GCInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline CGCToGCMsgMasterStartupComplete_GCInfo& operator=(const CGCToGCMsgMasterStartupComplete_GCInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CGCToGCMsgMasterStartupComplete_GCInfo& operator=(CGCToGCMsgMasterStartupComplete_GCInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CGCToGCMsgMasterStartupComplete_GCInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CGCToGCMsgMasterStartupComplete_GCInfo* internal_default_instance() {
+    return reinterpret_cast<const CGCToGCMsgMasterStartupComplete_GCInfo*>(
+               &_CGCToGCMsgMasterStartupComplete_GCInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(CGCToGCMsgMasterStartupComplete_GCInfo& a, CGCToGCMsgMasterStartupComplete_GCInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CGCToGCMsgMasterStartupComplete_GCInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CGCToGCMsgMasterStartupComplete_GCInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CGCToGCMsgMasterStartupComplete_GCInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CGCToGCMsgMasterStartupComplete_GCInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CGCToGCMsgMasterStartupComplete_GCInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CGCToGCMsgMasterStartupComplete_GCInfo& from) {
+    CGCToGCMsgMasterStartupComplete_GCInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CGCToGCMsgMasterStartupComplete_GCInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CGCToGCMsgMasterStartupComplete.GCInfo";
+  }
+  protected:
+  explicit CGCToGCMsgMasterStartupComplete_GCInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMachineNameFieldNumber = 2,
+    kDirIndexFieldNumber = 1,
+  };
+  // optional string machine_name = 2;
+  bool has_machine_name() const;
+  private:
+  bool _internal_has_machine_name() const;
+  public:
+  void clear_machine_name();
+  const std::string& machine_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_machine_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_machine_name();
+  PROTOBUF_NODISCARD std::string* release_machine_name();
+  void set_allocated_machine_name(std::string* machine_name);
+  private:
+  const std::string& _internal_machine_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_machine_name(const std::string& value);
+  std::string* _internal_mutable_machine_name();
+  public:
+
+  // optional uint32 dir_index = 1;
+  bool has_dir_index() const;
+  private:
+  bool _internal_has_dir_index() const;
+  public:
+  void clear_dir_index();
+  uint32_t dir_index() const;
+  void set_dir_index(uint32_t value);
+  private:
+  uint32_t _internal_dir_index() const;
+  void _internal_set_dir_index(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CGCToGCMsgMasterStartupComplete.GCInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr machine_name_;
+    uint32_t dir_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CGCToGCMsgMasterStartupComplete final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CGCToGCMsgMasterStartupComplete) */ {
+ public:
+  inline CGCToGCMsgMasterStartupComplete() : CGCToGCMsgMasterStartupComplete(nullptr) {}
+  ~CGCToGCMsgMasterStartupComplete() override;
+  explicit PROTOBUF_CONSTEXPR CGCToGCMsgMasterStartupComplete(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CGCToGCMsgMasterStartupComplete(const CGCToGCMsgMasterStartupComplete& from);
+  CGCToGCMsgMasterStartupComplete(CGCToGCMsgMasterStartupComplete&& from) noexcept
+    : CGCToGCMsgMasterStartupComplete() {
+    *this = ::std::move(from);
+  }
+
+  inline CGCToGCMsgMasterStartupComplete& operator=(const CGCToGCMsgMasterStartupComplete& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CGCToGCMsgMasterStartupComplete& operator=(CGCToGCMsgMasterStartupComplete&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CGCToGCMsgMasterStartupComplete& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CGCToGCMsgMasterStartupComplete* internal_default_instance() {
+    return reinterpret_cast<const CGCToGCMsgMasterStartupComplete*>(
+               &_CGCToGCMsgMasterStartupComplete_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(CGCToGCMsgMasterStartupComplete& a, CGCToGCMsgMasterStartupComplete& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CGCToGCMsgMasterStartupComplete* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CGCToGCMsgMasterStartupComplete* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CGCToGCMsgMasterStartupComplete* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CGCToGCMsgMasterStartupComplete>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CGCToGCMsgMasterStartupComplete& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CGCToGCMsgMasterStartupComplete& from) {
+    CGCToGCMsgMasterStartupComplete::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CGCToGCMsgMasterStartupComplete* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CGCToGCMsgMasterStartupComplete";
+  }
+  protected:
+  explicit CGCToGCMsgMasterStartupComplete(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CGCToGCMsgMasterStartupComplete_GCInfo GCInfo;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGcInfoFieldNumber = 1,
+  };
+  // repeated .CGCToGCMsgMasterStartupComplete.GCInfo gc_info = 1;
+  int gc_info_size() const;
+  private:
+  int _internal_gc_info_size() const;
+  public:
+  void clear_gc_info();
+  ::CGCToGCMsgMasterStartupComplete_GCInfo* mutable_gc_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterStartupComplete_GCInfo >*
+      mutable_gc_info();
+  private:
+  const ::CGCToGCMsgMasterStartupComplete_GCInfo& _internal_gc_info(int index) const;
+  ::CGCToGCMsgMasterStartupComplete_GCInfo* _internal_add_gc_info();
+  public:
+  const ::CGCToGCMsgMasterStartupComplete_GCInfo& gc_info(int index) const;
+  ::CGCToGCMsgMasterStartupComplete_GCInfo* add_gc_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterStartupComplete_GCInfo >&
+      gc_info() const;
+
+  // @@protoc_insertion_point(class_scope:CGCToGCMsgMasterStartupComplete)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterStartupComplete_GCInfo > gc_info_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CGCToGCMsgRouted final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CGCToGCMsgRouted) */ {
+ public:
+  inline CGCToGCMsgRouted() : CGCToGCMsgRouted(nullptr) {}
+  ~CGCToGCMsgRouted() override;
+  explicit PROTOBUF_CONSTEXPR CGCToGCMsgRouted(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CGCToGCMsgRouted(const CGCToGCMsgRouted& from);
+  CGCToGCMsgRouted(CGCToGCMsgRouted&& from) noexcept
+    : CGCToGCMsgRouted() {
+    *this = ::std::move(from);
+  }
+
+  inline CGCToGCMsgRouted& operator=(const CGCToGCMsgRouted& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CGCToGCMsgRouted& operator=(CGCToGCMsgRouted&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CGCToGCMsgRouted& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CGCToGCMsgRouted* internal_default_instance() {
+    return reinterpret_cast<const CGCToGCMsgRouted*>(
+               &_CGCToGCMsgRouted_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(CGCToGCMsgRouted& a, CGCToGCMsgRouted& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CGCToGCMsgRouted* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CGCToGCMsgRouted* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CGCToGCMsgRouted* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CGCToGCMsgRouted>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CGCToGCMsgRouted& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CGCToGCMsgRouted& from) {
+    CGCToGCMsgRouted::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CGCToGCMsgRouted* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CGCToGCMsgRouted";
+  }
+  protected:
+  explicit CGCToGCMsgRouted(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNetMessageFieldNumber = 3,
+    kSenderIdFieldNumber = 2,
+    kMsgTypeFieldNumber = 1,
+  };
+  // optional bytes net_message = 3;
+  bool has_net_message() const;
+  private:
+  bool _internal_has_net_message() const;
+  public:
+  void clear_net_message();
+  const std::string& net_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_net_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_net_message();
+  PROTOBUF_NODISCARD std::string* release_net_message();
+  void set_allocated_net_message(std::string* net_message);
+  private:
+  const std::string& _internal_net_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_net_message(const std::string& value);
+  std::string* _internal_mutable_net_message();
+  public:
+
+  // optional fixed64 sender_id = 2;
+  bool has_sender_id() const;
+  private:
+  bool _internal_has_sender_id() const;
+  public:
+  void clear_sender_id();
+  uint64_t sender_id() const;
+  void set_sender_id(uint64_t value);
+  private:
+  uint64_t _internal_sender_id() const;
+  void _internal_set_sender_id(uint64_t value);
+  public:
+
+  // optional uint32 msg_type = 1;
+  bool has_msg_type() const;
+  private:
+  bool _internal_has_msg_type() const;
+  public:
+  void clear_msg_type();
+  uint32_t msg_type() const;
+  void set_msg_type(uint32_t value);
+  private:
+  uint32_t _internal_msg_type() const;
+  void _internal_set_msg_type(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CGCToGCMsgRouted)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr net_message_;
+    uint64_t sender_id_;
+    uint32_t msg_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CGCToGCMsgRoutedReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CGCToGCMsgRoutedReply) */ {
+ public:
+  inline CGCToGCMsgRoutedReply() : CGCToGCMsgRoutedReply(nullptr) {}
+  ~CGCToGCMsgRoutedReply() override;
+  explicit PROTOBUF_CONSTEXPR CGCToGCMsgRoutedReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CGCToGCMsgRoutedReply(const CGCToGCMsgRoutedReply& from);
+  CGCToGCMsgRoutedReply(CGCToGCMsgRoutedReply&& from) noexcept
+    : CGCToGCMsgRoutedReply() {
+    *this = ::std::move(from);
+  }
+
+  inline CGCToGCMsgRoutedReply& operator=(const CGCToGCMsgRoutedReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CGCToGCMsgRoutedReply& operator=(CGCToGCMsgRoutedReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CGCToGCMsgRoutedReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CGCToGCMsgRoutedReply* internal_default_instance() {
+    return reinterpret_cast<const CGCToGCMsgRoutedReply*>(
+               &_CGCToGCMsgRoutedReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(CGCToGCMsgRoutedReply& a, CGCToGCMsgRoutedReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CGCToGCMsgRoutedReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CGCToGCMsgRoutedReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CGCToGCMsgRoutedReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CGCToGCMsgRoutedReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CGCToGCMsgRoutedReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CGCToGCMsgRoutedReply& from) {
+    CGCToGCMsgRoutedReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CGCToGCMsgRoutedReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CGCToGCMsgRoutedReply";
+  }
+  protected:
+  explicit CGCToGCMsgRoutedReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNetMessageFieldNumber = 2,
+    kMsgTypeFieldNumber = 1,
+  };
+  // optional bytes net_message = 2;
+  bool has_net_message() const;
+  private:
+  bool _internal_has_net_message() const;
+  public:
+  void clear_net_message();
+  const std::string& net_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_net_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_net_message();
+  PROTOBUF_NODISCARD std::string* release_net_message();
+  void set_allocated_net_message(std::string* net_message);
+  private:
+  const std::string& _internal_net_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_net_message(const std::string& value);
+  std::string* _internal_mutable_net_message();
+  public:
+
+  // optional uint32 msg_type = 1;
+  bool has_msg_type() const;
+  private:
+  bool _internal_has_msg_type() const;
+  public:
+  void clear_msg_type();
+  uint32_t msg_type() const;
+  void set_msg_type(uint32_t value);
+  private:
+  uint32_t _internal_msg_type() const;
+  void _internal_set_msg_type(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CGCToGCMsgRoutedReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr net_message_;
+    uint32_t msg_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCUpdateSubGCSessionInfo_CMsgUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate) */ {
+ public:
+  inline CMsgGCUpdateSubGCSessionInfo_CMsgUpdate() : CMsgGCUpdateSubGCSessionInfo_CMsgUpdate(nullptr) {}
+  ~CMsgGCUpdateSubGCSessionInfo_CMsgUpdate() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCUpdateSubGCSessionInfo_CMsgUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCUpdateSubGCSessionInfo_CMsgUpdate(const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& from);
+  CMsgGCUpdateSubGCSessionInfo_CMsgUpdate(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate&& from) noexcept
+    : CMsgGCUpdateSubGCSessionInfo_CMsgUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& operator=(const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& operator=(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate*>(
+               &_CMsgGCUpdateSubGCSessionInfo_CMsgUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& a, CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCUpdateSubGCSessionInfo_CMsgUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& from) {
+    CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCUpdateSubGCSessionInfo.CMsgUpdate";
+  }
+  protected:
+  explicit CMsgGCUpdateSubGCSessionInfo_CMsgUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSteamidFieldNumber = 1,
+    kIpFieldNumber = 2,
+    kTrustedFieldNumber = 3,
+  };
+  // optional fixed64 steamid = 1;
+  bool has_steamid() const;
+  private:
+  bool _internal_has_steamid() const;
+  public:
+  void clear_steamid();
+  uint64_t steamid() const;
+  void set_steamid(uint64_t value);
+  private:
+  uint64_t _internal_steamid() const;
+  void _internal_set_steamid(uint64_t value);
+  public:
+
+  // optional fixed32 ip = 2;
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  uint32_t ip() const;
+  void set_ip(uint32_t value);
+  private:
+  uint32_t _internal_ip() const;
+  void _internal_set_ip(uint32_t value);
+  public:
+
+  // optional bool trusted = 3;
+  bool has_trusted() const;
+  private:
+  bool _internal_has_trusted() const;
+  public:
+  void clear_trusted();
+  bool trusted() const;
+  void set_trusted(bool value);
+  private:
+  bool _internal_trusted() const;
+  void _internal_set_trusted(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t steamid_;
+    uint32_t ip_;
+    bool trusted_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCUpdateSubGCSessionInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCUpdateSubGCSessionInfo) */ {
+ public:
+  inline CMsgGCUpdateSubGCSessionInfo() : CMsgGCUpdateSubGCSessionInfo(nullptr) {}
+  ~CMsgGCUpdateSubGCSessionInfo() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCUpdateSubGCSessionInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCUpdateSubGCSessionInfo(const CMsgGCUpdateSubGCSessionInfo& from);
+  CMsgGCUpdateSubGCSessionInfo(CMsgGCUpdateSubGCSessionInfo&& from) noexcept
+    : CMsgGCUpdateSubGCSessionInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCUpdateSubGCSessionInfo& operator=(const CMsgGCUpdateSubGCSessionInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCUpdateSubGCSessionInfo& operator=(CMsgGCUpdateSubGCSessionInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCUpdateSubGCSessionInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCUpdateSubGCSessionInfo* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCUpdateSubGCSessionInfo*>(
+               &_CMsgGCUpdateSubGCSessionInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(CMsgGCUpdateSubGCSessionInfo& a, CMsgGCUpdateSubGCSessionInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCUpdateSubGCSessionInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCUpdateSubGCSessionInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCUpdateSubGCSessionInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCUpdateSubGCSessionInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCUpdateSubGCSessionInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCUpdateSubGCSessionInfo& from) {
+    CMsgGCUpdateSubGCSessionInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCUpdateSubGCSessionInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCUpdateSubGCSessionInfo";
+  }
+  protected:
+  explicit CMsgGCUpdateSubGCSessionInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CMsgGCUpdateSubGCSessionInfo_CMsgUpdate CMsgUpdate;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUpdatesFieldNumber = 1,
+  };
+  // repeated .CMsgGCUpdateSubGCSessionInfo.CMsgUpdate updates = 1;
+  int updates_size() const;
+  private:
+  int _internal_updates_size() const;
+  public:
+  void clear_updates();
+  ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* mutable_updates(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate >*
+      mutable_updates();
+  private:
+  const ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& _internal_updates(int index) const;
+  ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* _internal_add_updates();
+  public:
+  const ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& updates(int index) const;
+  ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* add_updates();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate >&
+      updates() const;
+
+  // @@protoc_insertion_point(class_scope:CMsgGCUpdateSubGCSessionInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate > updates_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCRequestSubGCSessionInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCRequestSubGCSessionInfo) */ {
+ public:
+  inline CMsgGCRequestSubGCSessionInfo() : CMsgGCRequestSubGCSessionInfo(nullptr) {}
+  ~CMsgGCRequestSubGCSessionInfo() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCRequestSubGCSessionInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCRequestSubGCSessionInfo(const CMsgGCRequestSubGCSessionInfo& from);
+  CMsgGCRequestSubGCSessionInfo(CMsgGCRequestSubGCSessionInfo&& from) noexcept
+    : CMsgGCRequestSubGCSessionInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCRequestSubGCSessionInfo& operator=(const CMsgGCRequestSubGCSessionInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCRequestSubGCSessionInfo& operator=(CMsgGCRequestSubGCSessionInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCRequestSubGCSessionInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCRequestSubGCSessionInfo* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCRequestSubGCSessionInfo*>(
+               &_CMsgGCRequestSubGCSessionInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(CMsgGCRequestSubGCSessionInfo& a, CMsgGCRequestSubGCSessionInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCRequestSubGCSessionInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCRequestSubGCSessionInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCRequestSubGCSessionInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCRequestSubGCSessionInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCRequestSubGCSessionInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCRequestSubGCSessionInfo& from) {
+    CMsgGCRequestSubGCSessionInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCRequestSubGCSessionInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCRequestSubGCSessionInfo";
+  }
+  protected:
+  explicit CMsgGCRequestSubGCSessionInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSteamidFieldNumber = 1,
+  };
+  // optional fixed64 steamid = 1;
+  bool has_steamid() const;
+  private:
+  bool _internal_has_steamid() const;
+  public:
+  void clear_steamid();
+  uint64_t steamid() const;
+  void set_steamid(uint64_t value);
+  private:
+  uint64_t _internal_steamid() const;
+  void _internal_set_steamid(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgGCRequestSubGCSessionInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t steamid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCRequestSubGCSessionInfoResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCRequestSubGCSessionInfoResponse) */ {
+ public:
+  inline CMsgGCRequestSubGCSessionInfoResponse() : CMsgGCRequestSubGCSessionInfoResponse(nullptr) {}
+  ~CMsgGCRequestSubGCSessionInfoResponse() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCRequestSubGCSessionInfoResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCRequestSubGCSessionInfoResponse(const CMsgGCRequestSubGCSessionInfoResponse& from);
+  CMsgGCRequestSubGCSessionInfoResponse(CMsgGCRequestSubGCSessionInfoResponse&& from) noexcept
+    : CMsgGCRequestSubGCSessionInfoResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCRequestSubGCSessionInfoResponse& operator=(const CMsgGCRequestSubGCSessionInfoResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCRequestSubGCSessionInfoResponse& operator=(CMsgGCRequestSubGCSessionInfoResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCRequestSubGCSessionInfoResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCRequestSubGCSessionInfoResponse* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCRequestSubGCSessionInfoResponse*>(
+               &_CMsgGCRequestSubGCSessionInfoResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(CMsgGCRequestSubGCSessionInfoResponse& a, CMsgGCRequestSubGCSessionInfoResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCRequestSubGCSessionInfoResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCRequestSubGCSessionInfoResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCRequestSubGCSessionInfoResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCRequestSubGCSessionInfoResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCRequestSubGCSessionInfoResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCRequestSubGCSessionInfoResponse& from) {
+    CMsgGCRequestSubGCSessionInfoResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCRequestSubGCSessionInfoResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCRequestSubGCSessionInfoResponse";
+  }
+  protected:
+  explicit CMsgGCRequestSubGCSessionInfoResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIpFieldNumber = 1,
+    kTrustedFieldNumber = 2,
+  };
+  // optional fixed32 ip = 1;
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  uint32_t ip() const;
+  void set_ip(uint32_t value);
+  private:
+  uint32_t _internal_ip() const;
+  void _internal_set_ip(uint32_t value);
+  public:
+
+  // optional bool trusted = 2;
+  bool has_trusted() const;
+  private:
+  bool _internal_has_trusted() const;
+  public:
+  void clear_trusted();
+  bool trusted() const;
+  void set_trusted(bool value);
+  private:
+  bool _internal_trusted() const;
+  void _internal_set_trusted(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgGCRequestSubGCSessionInfoResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t ip_;
+    bool trusted_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgSOCacheHaveVersion final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgSOCacheHaveVersion) */ {
+ public:
+  inline CMsgSOCacheHaveVersion() : CMsgSOCacheHaveVersion(nullptr) {}
+  ~CMsgSOCacheHaveVersion() override;
+  explicit PROTOBUF_CONSTEXPR CMsgSOCacheHaveVersion(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgSOCacheHaveVersion(const CMsgSOCacheHaveVersion& from);
+  CMsgSOCacheHaveVersion(CMsgSOCacheHaveVersion&& from) noexcept
+    : CMsgSOCacheHaveVersion() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgSOCacheHaveVersion& operator=(const CMsgSOCacheHaveVersion& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgSOCacheHaveVersion& operator=(CMsgSOCacheHaveVersion&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgSOCacheHaveVersion& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgSOCacheHaveVersion* internal_default_instance() {
+    return reinterpret_cast<const CMsgSOCacheHaveVersion*>(
+               &_CMsgSOCacheHaveVersion_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(CMsgSOCacheHaveVersion& a, CMsgSOCacheHaveVersion& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgSOCacheHaveVersion* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgSOCacheHaveVersion* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgSOCacheHaveVersion* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgSOCacheHaveVersion>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgSOCacheHaveVersion& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgSOCacheHaveVersion& from) {
+    CMsgSOCacheHaveVersion::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgSOCacheHaveVersion* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgSOCacheHaveVersion";
+  }
+  protected:
+  explicit CMsgSOCacheHaveVersion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSoidFieldNumber = 1,
+    kVersionFieldNumber = 2,
+    kServiceIdFieldNumber = 3,
+    kCachedFileVersionFieldNumber = 4,
+  };
+  // optional .CMsgSOIDOwner soid = 1;
+  bool has_soid() const;
+  private:
+  bool _internal_has_soid() const;
+  public:
+  void clear_soid();
+  const ::CMsgSOIDOwner& soid() const;
+  PROTOBUF_NODISCARD ::CMsgSOIDOwner* release_soid();
+  ::CMsgSOIDOwner* mutable_soid();
+  void set_allocated_soid(::CMsgSOIDOwner* soid);
+  private:
+  const ::CMsgSOIDOwner& _internal_soid() const;
+  ::CMsgSOIDOwner* _internal_mutable_soid();
+  public:
+  void unsafe_arena_set_allocated_soid(
+      ::CMsgSOIDOwner* soid);
+  ::CMsgSOIDOwner* unsafe_arena_release_soid();
+
+  // optional fixed64 version = 2;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // optional uint32 service_id = 3;
+  bool has_service_id() const;
+  private:
+  bool _internal_has_service_id() const;
+  public:
+  void clear_service_id();
+  uint32_t service_id() const;
+  void set_service_id(uint32_t value);
+  private:
+  uint32_t _internal_service_id() const;
+  void _internal_set_service_id(uint32_t value);
+  public:
+
+  // optional uint32 cached_file_version = 4;
+  bool has_cached_file_version() const;
+  private:
+  bool _internal_has_cached_file_version() const;
+  public:
+  void clear_cached_file_version();
+  uint32_t cached_file_version() const;
+  void set_cached_file_version(uint32_t value);
+  private:
+  uint32_t _internal_cached_file_version() const;
+  void _internal_set_cached_file_version(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgSOCacheHaveVersion)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CMsgSOIDOwner* soid_;
+    uint64_t version_;
+    uint32_t service_id_;
+    uint32_t cached_file_version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgClientHello final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgClientHello) */ {
+ public:
+  inline CMsgClientHello() : CMsgClientHello(nullptr) {}
+  ~CMsgClientHello() override;
+  explicit PROTOBUF_CONSTEXPR CMsgClientHello(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgClientHello(const CMsgClientHello& from);
+  CMsgClientHello(CMsgClientHello&& from) noexcept
+    : CMsgClientHello() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgClientHello& operator=(const CMsgClientHello& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgClientHello& operator=(CMsgClientHello&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgClientHello& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgClientHello* internal_default_instance() {
+    return reinterpret_cast<const CMsgClientHello*>(
+               &_CMsgClientHello_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(CMsgClientHello& a, CMsgClientHello& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgClientHello* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgClientHello* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgClientHello* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgClientHello>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgClientHello& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgClientHello& from) {
+    CMsgClientHello::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgClientHello* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgClientHello";
+  }
+  protected:
+  explicit CMsgClientHello(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSocacheHaveVersionsFieldNumber = 2,
+    kSecretKeyFieldNumber = 5,
+    kVersionFieldNumber = 1,
+    kClientSessionNeedFieldNumber = 3,
+    kClientLauncherFieldNumber = 4,
+    kClientLanguageFieldNumber = 6,
+    kEngineFieldNumber = 7,
+  };
+  // repeated .CMsgSOCacheHaveVersion socache_have_versions = 2;
+  int socache_have_versions_size() const;
+  private:
+  int _internal_socache_have_versions_size() const;
+  public:
+  void clear_socache_have_versions();
+  ::CMsgSOCacheHaveVersion* mutable_socache_have_versions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheHaveVersion >*
+      mutable_socache_have_versions();
+  private:
+  const ::CMsgSOCacheHaveVersion& _internal_socache_have_versions(int index) const;
+  ::CMsgSOCacheHaveVersion* _internal_add_socache_have_versions();
+  public:
+  const ::CMsgSOCacheHaveVersion& socache_have_versions(int index) const;
+  ::CMsgSOCacheHaveVersion* add_socache_have_versions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheHaveVersion >&
+      socache_have_versions() const;
+
+  // optional string secret_key = 5;
+  bool has_secret_key() const;
+  private:
+  bool _internal_has_secret_key() const;
+  public:
+  void clear_secret_key();
+  const std::string& secret_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_secret_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_secret_key();
+  PROTOBUF_NODISCARD std::string* release_secret_key();
+  void set_allocated_secret_key(std::string* secret_key);
+  private:
+  const std::string& _internal_secret_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_secret_key(const std::string& value);
+  std::string* _internal_mutable_secret_key();
+  public:
+
+  // optional uint32 version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint32_t version() const;
+  void set_version(uint32_t value);
+  private:
+  uint32_t _internal_version() const;
+  void _internal_set_version(uint32_t value);
+  public:
+
+  // optional uint32 client_session_need = 3;
+  bool has_client_session_need() const;
+  private:
+  bool _internal_has_client_session_need() const;
+  public:
+  void clear_client_session_need();
+  uint32_t client_session_need() const;
+  void set_client_session_need(uint32_t value);
+  private:
+  uint32_t _internal_client_session_need() const;
+  void _internal_set_client_session_need(uint32_t value);
+  public:
+
+  // optional .PartnerAccountType client_launcher = 4 [default = PARTNER_NONE];
+  bool has_client_launcher() const;
+  private:
+  bool _internal_has_client_launcher() const;
+  public:
+  void clear_client_launcher();
+  ::PartnerAccountType client_launcher() const;
+  void set_client_launcher(::PartnerAccountType value);
+  private:
+  ::PartnerAccountType _internal_client_launcher() const;
+  void _internal_set_client_launcher(::PartnerAccountType value);
+  public:
+
+  // optional uint32 client_language = 6;
+  bool has_client_language() const;
+  private:
+  bool _internal_has_client_language() const;
+  public:
+  void clear_client_language();
+  uint32_t client_language() const;
+  void set_client_language(uint32_t value);
+  private:
+  uint32_t _internal_client_language() const;
+  void _internal_set_client_language(uint32_t value);
+  public:
+
+  // optional .ESourceEngine engine = 7 [default = k_ESE_Source1];
+  bool has_engine() const;
+  private:
+  bool _internal_has_engine() const;
+  public:
+  void clear_engine();
+  ::ESourceEngine engine() const;
+  void set_engine(::ESourceEngine value);
+  private:
+  ::ESourceEngine _internal_engine() const;
+  void _internal_set_engine(::ESourceEngine value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgClientHello)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheHaveVersion > socache_have_versions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr secret_key_;
+    uint32_t version_;
+    uint32_t client_session_need_;
+    int client_launcher_;
+    uint32_t client_language_;
+    int engine_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgClientWelcome_Location final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgClientWelcome.Location) */ {
+ public:
+  inline CMsgClientWelcome_Location() : CMsgClientWelcome_Location(nullptr) {}
+  ~CMsgClientWelcome_Location() override;
+  explicit PROTOBUF_CONSTEXPR CMsgClientWelcome_Location(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgClientWelcome_Location(const CMsgClientWelcome_Location& from);
+  CMsgClientWelcome_Location(CMsgClientWelcome_Location&& from) noexcept
+    : CMsgClientWelcome_Location() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgClientWelcome_Location& operator=(const CMsgClientWelcome_Location& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgClientWelcome_Location& operator=(CMsgClientWelcome_Location&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgClientWelcome_Location& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgClientWelcome_Location* internal_default_instance() {
+    return reinterpret_cast<const CMsgClientWelcome_Location*>(
+               &_CMsgClientWelcome_Location_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(CMsgClientWelcome_Location& a, CMsgClientWelcome_Location& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgClientWelcome_Location* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgClientWelcome_Location* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgClientWelcome_Location* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgClientWelcome_Location>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgClientWelcome_Location& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgClientWelcome_Location& from) {
+    CMsgClientWelcome_Location::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgClientWelcome_Location* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgClientWelcome.Location";
+  }
+  protected:
+  explicit CMsgClientWelcome_Location(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountryFieldNumber = 3,
+    kLatitudeFieldNumber = 1,
+    kLongitudeFieldNumber = 2,
+  };
+  // optional string country = 3;
+  bool has_country() const;
+  private:
+  bool _internal_has_country() const;
+  public:
+  void clear_country();
+  const std::string& country() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_country(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_country();
+  PROTOBUF_NODISCARD std::string* release_country();
+  void set_allocated_country(std::string* country);
+  private:
+  const std::string& _internal_country() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_country(const std::string& value);
+  std::string* _internal_mutable_country();
+  public:
+
+  // optional float latitude = 1;
+  bool has_latitude() const;
+  private:
+  bool _internal_has_latitude() const;
+  public:
+  void clear_latitude();
+  float latitude() const;
+  void set_latitude(float value);
+  private:
+  float _internal_latitude() const;
+  void _internal_set_latitude(float value);
+  public:
+
+  // optional float longitude = 2;
+  bool has_longitude() const;
+  private:
+  bool _internal_has_longitude() const;
+  public:
+  void clear_longitude();
+  float longitude() const;
+  void set_longitude(float value);
+  private:
+  float _internal_longitude() const;
+  void _internal_set_longitude(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgClientWelcome.Location)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr country_;
+    float latitude_;
+    float longitude_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgClientWelcome final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgClientWelcome) */ {
+ public:
+  inline CMsgClientWelcome() : CMsgClientWelcome(nullptr) {}
+  ~CMsgClientWelcome() override;
+  explicit PROTOBUF_CONSTEXPR CMsgClientWelcome(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgClientWelcome(const CMsgClientWelcome& from);
+  CMsgClientWelcome(CMsgClientWelcome&& from) noexcept
+    : CMsgClientWelcome() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgClientWelcome& operator=(const CMsgClientWelcome& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgClientWelcome& operator=(CMsgClientWelcome&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgClientWelcome& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgClientWelcome* internal_default_instance() {
+    return reinterpret_cast<const CMsgClientWelcome*>(
+               &_CMsgClientWelcome_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(CMsgClientWelcome& a, CMsgClientWelcome& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgClientWelcome* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgClientWelcome* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgClientWelcome* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgClientWelcome>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgClientWelcome& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgClientWelcome& from) {
+    CMsgClientWelcome::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgClientWelcome* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgClientWelcome";
+  }
+  protected:
+  explicit CMsgClientWelcome(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CMsgClientWelcome_Location Location;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOutofdateSubscribedCachesFieldNumber = 3,
+    kUptodateSubscribedCachesFieldNumber = 4,
+    kGameDataFieldNumber = 2,
+    kSaveGameKeyFieldNumber = 6,
+    kLocationFieldNumber = 5,
+    kVersionFieldNumber = 1,
+  };
+  // repeated .CMsgSOCacheSubscribed outofdate_subscribed_caches = 3;
+  int outofdate_subscribed_caches_size() const;
+  private:
+  int _internal_outofdate_subscribed_caches_size() const;
+  public:
+  void clear_outofdate_subscribed_caches();
+  ::CMsgSOCacheSubscribed* mutable_outofdate_subscribed_caches(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed >*
+      mutable_outofdate_subscribed_caches();
+  private:
+  const ::CMsgSOCacheSubscribed& _internal_outofdate_subscribed_caches(int index) const;
+  ::CMsgSOCacheSubscribed* _internal_add_outofdate_subscribed_caches();
+  public:
+  const ::CMsgSOCacheSubscribed& outofdate_subscribed_caches(int index) const;
+  ::CMsgSOCacheSubscribed* add_outofdate_subscribed_caches();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed >&
+      outofdate_subscribed_caches() const;
+
+  // repeated .CMsgSOCacheSubscriptionCheck uptodate_subscribed_caches = 4;
+  int uptodate_subscribed_caches_size() const;
+  private:
+  int _internal_uptodate_subscribed_caches_size() const;
+  public:
+  void clear_uptodate_subscribed_caches();
+  ::CMsgSOCacheSubscriptionCheck* mutable_uptodate_subscribed_caches(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscriptionCheck >*
+      mutable_uptodate_subscribed_caches();
+  private:
+  const ::CMsgSOCacheSubscriptionCheck& _internal_uptodate_subscribed_caches(int index) const;
+  ::CMsgSOCacheSubscriptionCheck* _internal_add_uptodate_subscribed_caches();
+  public:
+  const ::CMsgSOCacheSubscriptionCheck& uptodate_subscribed_caches(int index) const;
+  ::CMsgSOCacheSubscriptionCheck* add_uptodate_subscribed_caches();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscriptionCheck >&
+      uptodate_subscribed_caches() const;
+
+  // optional bytes game_data = 2;
+  bool has_game_data() const;
+  private:
+  bool _internal_has_game_data() const;
+  public:
+  void clear_game_data();
+  const std::string& game_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_game_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_game_data();
+  PROTOBUF_NODISCARD std::string* release_game_data();
+  void set_allocated_game_data(std::string* game_data);
+  private:
+  const std::string& _internal_game_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_game_data(const std::string& value);
+  std::string* _internal_mutable_game_data();
+  public:
+
+  // optional bytes save_game_key = 6;
+  bool has_save_game_key() const;
+  private:
+  bool _internal_has_save_game_key() const;
+  public:
+  void clear_save_game_key();
+  const std::string& save_game_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_save_game_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_save_game_key();
+  PROTOBUF_NODISCARD std::string* release_save_game_key();
+  void set_allocated_save_game_key(std::string* save_game_key);
+  private:
+  const std::string& _internal_save_game_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_save_game_key(const std::string& value);
+  std::string* _internal_mutable_save_game_key();
+  public:
+
+  // optional .CMsgClientWelcome.Location location = 5;
+  bool has_location() const;
+  private:
+  bool _internal_has_location() const;
+  public:
+  void clear_location();
+  const ::CMsgClientWelcome_Location& location() const;
+  PROTOBUF_NODISCARD ::CMsgClientWelcome_Location* release_location();
+  ::CMsgClientWelcome_Location* mutable_location();
+  void set_allocated_location(::CMsgClientWelcome_Location* location);
+  private:
+  const ::CMsgClientWelcome_Location& _internal_location() const;
+  ::CMsgClientWelcome_Location* _internal_mutable_location();
+  public:
+  void unsafe_arena_set_allocated_location(
+      ::CMsgClientWelcome_Location* location);
+  ::CMsgClientWelcome_Location* unsafe_arena_release_location();
+
+  // optional uint32 version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint32_t version() const;
+  void set_version(uint32_t value);
+  private:
+  uint32_t _internal_version() const;
+  void _internal_set_version(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgClientWelcome)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed > outofdate_subscribed_caches_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscriptionCheck > uptodate_subscribed_caches_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr game_data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr save_game_key_;
+    ::CMsgClientWelcome_Location* location_;
+    uint32_t version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgConnectionStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgConnectionStatus) */ {
+ public:
+  inline CMsgConnectionStatus() : CMsgConnectionStatus(nullptr) {}
+  ~CMsgConnectionStatus() override;
+  explicit PROTOBUF_CONSTEXPR CMsgConnectionStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgConnectionStatus(const CMsgConnectionStatus& from);
+  CMsgConnectionStatus(CMsgConnectionStatus&& from) noexcept
+    : CMsgConnectionStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgConnectionStatus& operator=(const CMsgConnectionStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgConnectionStatus& operator=(CMsgConnectionStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgConnectionStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgConnectionStatus* internal_default_instance() {
+    return reinterpret_cast<const CMsgConnectionStatus*>(
+               &_CMsgConnectionStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(CMsgConnectionStatus& a, CMsgConnectionStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgConnectionStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgConnectionStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgConnectionStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgConnectionStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgConnectionStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgConnectionStatus& from) {
+    CMsgConnectionStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgConnectionStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgConnectionStatus";
+  }
+  protected:
+  explicit CMsgConnectionStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatusFieldNumber = 1,
+    kClientSessionNeedFieldNumber = 2,
+    kQueuePositionFieldNumber = 3,
+    kQueueSizeFieldNumber = 4,
+    kWaitSecondsFieldNumber = 5,
+    kEstimatedWaitSecondsRemainingFieldNumber = 6,
+  };
+  // optional .GCConnectionStatus status = 1 [default = GCConnectionStatus_HAVE_SESSION];
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  ::GCConnectionStatus status() const;
+  void set_status(::GCConnectionStatus value);
+  private:
+  ::GCConnectionStatus _internal_status() const;
+  void _internal_set_status(::GCConnectionStatus value);
+  public:
+
+  // optional uint32 client_session_need = 2;
+  bool has_client_session_need() const;
+  private:
+  bool _internal_has_client_session_need() const;
+  public:
+  void clear_client_session_need();
+  uint32_t client_session_need() const;
+  void set_client_session_need(uint32_t value);
+  private:
+  uint32_t _internal_client_session_need() const;
+  void _internal_set_client_session_need(uint32_t value);
+  public:
+
+  // optional int32 queue_position = 3;
+  bool has_queue_position() const;
+  private:
+  bool _internal_has_queue_position() const;
+  public:
+  void clear_queue_position();
+  int32_t queue_position() const;
+  void set_queue_position(int32_t value);
+  private:
+  int32_t _internal_queue_position() const;
+  void _internal_set_queue_position(int32_t value);
+  public:
+
+  // optional int32 queue_size = 4;
+  bool has_queue_size() const;
+  private:
+  bool _internal_has_queue_size() const;
+  public:
+  void clear_queue_size();
+  int32_t queue_size() const;
+  void set_queue_size(int32_t value);
+  private:
+  int32_t _internal_queue_size() const;
+  void _internal_set_queue_size(int32_t value);
+  public:
+
+  // optional int32 wait_seconds = 5;
+  bool has_wait_seconds() const;
+  private:
+  bool _internal_has_wait_seconds() const;
+  public:
+  void clear_wait_seconds();
+  int32_t wait_seconds() const;
+  void set_wait_seconds(int32_t value);
+  private:
+  int32_t _internal_wait_seconds() const;
+  void _internal_set_wait_seconds(int32_t value);
+  public:
+
+  // optional int32 estimated_wait_seconds_remaining = 6;
+  bool has_estimated_wait_seconds_remaining() const;
+  private:
+  bool _internal_has_estimated_wait_seconds_remaining() const;
+  public:
+  void clear_estimated_wait_seconds_remaining();
+  int32_t estimated_wait_seconds_remaining() const;
+  void set_estimated_wait_seconds_remaining(int32_t value);
+  private:
+  int32_t _internal_estimated_wait_seconds_remaining() const;
+  void _internal_set_estimated_wait_seconds_remaining(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgConnectionStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int status_;
+    uint32_t client_session_need_;
+    int32_t queue_position_;
+    int32_t queue_size_;
+    int32_t wait_seconds_;
+    int32_t estimated_wait_seconds_remaining_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions) */ {
+ public:
+  inline CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions() : CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions(nullptr) {}
+  ~CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions(const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& from);
+  CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions&& from) noexcept
+    : CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& operator=(const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& operator=(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions*>(
+               &_CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& a, CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& from) {
+    CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions";
+  }
+  protected:
+  explicit CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 2,
+    kServiceIdFieldNumber = 1,
+  };
+  // optional uint64 version = 2;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // optional uint32 service_id = 1;
+  bool has_service_id() const;
+  private:
+  bool _internal_has_service_id() const;
+  public:
+  void clear_service_id();
+  uint32_t service_id() const;
+  void set_service_id(uint32_t value);
+  private:
+  uint32_t _internal_service_id() const;
+  void _internal_set_service_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t version_;
+    uint32_t service_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCToGCSOCacheSubscribe final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCToGCSOCacheSubscribe) */ {
+ public:
+  inline CMsgGCToGCSOCacheSubscribe() : CMsgGCToGCSOCacheSubscribe(nullptr) {}
+  ~CMsgGCToGCSOCacheSubscribe() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCToGCSOCacheSubscribe(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCToGCSOCacheSubscribe(const CMsgGCToGCSOCacheSubscribe& from);
+  CMsgGCToGCSOCacheSubscribe(CMsgGCToGCSOCacheSubscribe&& from) noexcept
+    : CMsgGCToGCSOCacheSubscribe() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCToGCSOCacheSubscribe& operator=(const CMsgGCToGCSOCacheSubscribe& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCToGCSOCacheSubscribe& operator=(CMsgGCToGCSOCacheSubscribe&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCToGCSOCacheSubscribe& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCToGCSOCacheSubscribe* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCToGCSOCacheSubscribe*>(
+               &_CMsgGCToGCSOCacheSubscribe_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(CMsgGCToGCSOCacheSubscribe& a, CMsgGCToGCSOCacheSubscribe& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCToGCSOCacheSubscribe* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCToGCSOCacheSubscribe* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCToGCSOCacheSubscribe* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCToGCSOCacheSubscribe>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCToGCSOCacheSubscribe& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCToGCSOCacheSubscribe& from) {
+    CMsgGCToGCSOCacheSubscribe::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCToGCSOCacheSubscribe* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCToGCSOCacheSubscribe";
+  }
+  protected:
+  explicit CMsgGCToGCSOCacheSubscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions CMsgHaveVersions;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHaveVersionsFieldNumber = 4,
+    kSubscriberFieldNumber = 1,
+    kSubscribeToFieldNumber = 2,
+    kSyncVersionFieldNumber = 3,
+  };
+  // repeated .CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions have_versions = 4;
+  int have_versions_size() const;
+  private:
+  int _internal_have_versions_size() const;
+  public:
+  void clear_have_versions();
+  ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* mutable_have_versions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions >*
+      mutable_have_versions();
+  private:
+  const ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& _internal_have_versions(int index) const;
+  ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* _internal_add_have_versions();
+  public:
+  const ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& have_versions(int index) const;
+  ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* add_have_versions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions >&
+      have_versions() const;
+
+  // optional fixed64 subscriber = 1;
+  bool has_subscriber() const;
+  private:
+  bool _internal_has_subscriber() const;
+  public:
+  void clear_subscriber();
+  uint64_t subscriber() const;
+  void set_subscriber(uint64_t value);
+  private:
+  uint64_t _internal_subscriber() const;
+  void _internal_set_subscriber(uint64_t value);
+  public:
+
+  // optional fixed64 subscribe_to = 2;
+  bool has_subscribe_to() const;
+  private:
+  bool _internal_has_subscribe_to() const;
+  public:
+  void clear_subscribe_to();
+  uint64_t subscribe_to() const;
+  void set_subscribe_to(uint64_t value);
+  private:
+  uint64_t _internal_subscribe_to() const;
+  void _internal_set_subscribe_to(uint64_t value);
+  public:
+
+  // optional fixed64 sync_version = 3;
+  bool has_sync_version() const;
+  private:
+  bool _internal_has_sync_version() const;
+  public:
+  void clear_sync_version();
+  uint64_t sync_version() const;
+  void set_sync_version(uint64_t value);
+  private:
+  uint64_t _internal_sync_version() const;
+  void _internal_set_sync_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgGCToGCSOCacheSubscribe)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions > have_versions_;
+    uint64_t subscriber_;
+    uint64_t subscribe_to_;
+    uint64_t sync_version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCToGCSOCacheUnsubscribe final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCToGCSOCacheUnsubscribe) */ {
+ public:
+  inline CMsgGCToGCSOCacheUnsubscribe() : CMsgGCToGCSOCacheUnsubscribe(nullptr) {}
+  ~CMsgGCToGCSOCacheUnsubscribe() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCToGCSOCacheUnsubscribe(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCToGCSOCacheUnsubscribe(const CMsgGCToGCSOCacheUnsubscribe& from);
+  CMsgGCToGCSOCacheUnsubscribe(CMsgGCToGCSOCacheUnsubscribe&& from) noexcept
+    : CMsgGCToGCSOCacheUnsubscribe() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCToGCSOCacheUnsubscribe& operator=(const CMsgGCToGCSOCacheUnsubscribe& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCToGCSOCacheUnsubscribe& operator=(CMsgGCToGCSOCacheUnsubscribe&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCToGCSOCacheUnsubscribe& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCToGCSOCacheUnsubscribe* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCToGCSOCacheUnsubscribe*>(
+               &_CMsgGCToGCSOCacheUnsubscribe_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(CMsgGCToGCSOCacheUnsubscribe& a, CMsgGCToGCSOCacheUnsubscribe& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCToGCSOCacheUnsubscribe* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCToGCSOCacheUnsubscribe* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCToGCSOCacheUnsubscribe* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCToGCSOCacheUnsubscribe>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCToGCSOCacheUnsubscribe& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCToGCSOCacheUnsubscribe& from) {
+    CMsgGCToGCSOCacheUnsubscribe::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCToGCSOCacheUnsubscribe* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCToGCSOCacheUnsubscribe";
+  }
+  protected:
+  explicit CMsgGCToGCSOCacheUnsubscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubscriberFieldNumber = 1,
+    kUnsubscribeFromFieldNumber = 2,
+  };
+  // optional fixed64 subscriber = 1;
+  bool has_subscriber() const;
+  private:
+  bool _internal_has_subscriber() const;
+  public:
+  void clear_subscriber();
+  uint64_t subscriber() const;
+  void set_subscriber(uint64_t value);
+  private:
+  uint64_t _internal_subscriber() const;
+  void _internal_set_subscriber(uint64_t value);
+  public:
+
+  // optional fixed64 unsubscribe_from = 2;
+  bool has_unsubscribe_from() const;
+  private:
+  bool _internal_has_unsubscribe_from() const;
+  public:
+  void clear_unsubscribe_from();
+  uint64_t unsubscribe_from() const;
+  void set_unsubscribe_from(uint64_t value);
+  private:
+  uint64_t _internal_unsubscribe_from() const;
+  void _internal_set_unsubscribe_from(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgGCToGCSOCacheUnsubscribe)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t subscriber_;
+    uint64_t unsubscribe_from_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCClientPing final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:CMsgGCClientPing) */ {
+ public:
+  inline CMsgGCClientPing() : CMsgGCClientPing(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CMsgGCClientPing(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCClientPing(const CMsgGCClientPing& from);
+  CMsgGCClientPing(CMsgGCClientPing&& from) noexcept
+    : CMsgGCClientPing() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCClientPing& operator=(const CMsgGCClientPing& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCClientPing& operator=(CMsgGCClientPing&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCClientPing& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCClientPing* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCClientPing*>(
+               &_CMsgGCClientPing_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(CMsgGCClientPing& a, CMsgGCClientPing& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCClientPing* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCClientPing* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCClientPing* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCClientPing>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CMsgGCClientPing& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CMsgGCClientPing& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCClientPing";
+  }
+  protected:
+  explicit CMsgGCClientPing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:CMsgGCClientPing)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCToGCLoadSessionSOCache final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCToGCLoadSessionSOCache) */ {
+ public:
+  inline CMsgGCToGCLoadSessionSOCache() : CMsgGCToGCLoadSessionSOCache(nullptr) {}
+  ~CMsgGCToGCLoadSessionSOCache() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCToGCLoadSessionSOCache(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCToGCLoadSessionSOCache(const CMsgGCToGCLoadSessionSOCache& from);
+  CMsgGCToGCLoadSessionSOCache(CMsgGCToGCLoadSessionSOCache&& from) noexcept
+    : CMsgGCToGCLoadSessionSOCache() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCToGCLoadSessionSOCache& operator=(const CMsgGCToGCLoadSessionSOCache& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCToGCLoadSessionSOCache& operator=(CMsgGCToGCLoadSessionSOCache&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCToGCLoadSessionSOCache& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCToGCLoadSessionSOCache* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCToGCLoadSessionSOCache*>(
+               &_CMsgGCToGCLoadSessionSOCache_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(CMsgGCToGCLoadSessionSOCache& a, CMsgGCToGCLoadSessionSOCache& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCToGCLoadSessionSOCache* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCToGCLoadSessionSOCache* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCToGCLoadSessionSOCache* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCToGCLoadSessionSOCache>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCToGCLoadSessionSOCache& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCToGCLoadSessionSOCache& from) {
+    CMsgGCToGCLoadSessionSOCache::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCToGCLoadSessionSOCache* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCToGCLoadSessionSOCache";
+  }
+  protected:
+  explicit CMsgGCToGCLoadSessionSOCache(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAccountIdFieldNumber = 1,
+  };
+  // optional uint32 account_id = 1;
+  bool has_account_id() const;
+  private:
+  bool _internal_has_account_id() const;
+  public:
+  void clear_account_id();
+  uint32_t account_id() const;
+  void set_account_id(uint32_t value);
+  private:
+  uint32_t _internal_account_id() const;
+  void _internal_set_account_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgGCToGCLoadSessionSOCache)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t account_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCToGCLoadSessionSOCacheResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:CMsgGCToGCLoadSessionSOCacheResponse) */ {
+ public:
+  inline CMsgGCToGCLoadSessionSOCacheResponse() : CMsgGCToGCLoadSessionSOCacheResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CMsgGCToGCLoadSessionSOCacheResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCToGCLoadSessionSOCacheResponse(const CMsgGCToGCLoadSessionSOCacheResponse& from);
+  CMsgGCToGCLoadSessionSOCacheResponse(CMsgGCToGCLoadSessionSOCacheResponse&& from) noexcept
+    : CMsgGCToGCLoadSessionSOCacheResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCToGCLoadSessionSOCacheResponse& operator=(const CMsgGCToGCLoadSessionSOCacheResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCToGCLoadSessionSOCacheResponse& operator=(CMsgGCToGCLoadSessionSOCacheResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCToGCLoadSessionSOCacheResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCToGCLoadSessionSOCacheResponse* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCToGCLoadSessionSOCacheResponse*>(
+               &_CMsgGCToGCLoadSessionSOCacheResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(CMsgGCToGCLoadSessionSOCacheResponse& a, CMsgGCToGCLoadSessionSOCacheResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCToGCLoadSessionSOCacheResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCToGCLoadSessionSOCacheResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCToGCLoadSessionSOCacheResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCToGCLoadSessionSOCacheResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CMsgGCToGCLoadSessionSOCacheResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CMsgGCToGCLoadSessionSOCacheResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCToGCLoadSessionSOCacheResponse";
+  }
+  protected:
+  explicit CMsgGCToGCLoadSessionSOCacheResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:CMsgGCToGCLoadSessionSOCacheResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgGCToGCUpdateSessionStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgGCToGCUpdateSessionStats) */ {
+ public:
+  inline CMsgGCToGCUpdateSessionStats() : CMsgGCToGCUpdateSessionStats(nullptr) {}
+  ~CMsgGCToGCUpdateSessionStats() override;
+  explicit PROTOBUF_CONSTEXPR CMsgGCToGCUpdateSessionStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgGCToGCUpdateSessionStats(const CMsgGCToGCUpdateSessionStats& from);
+  CMsgGCToGCUpdateSessionStats(CMsgGCToGCUpdateSessionStats&& from) noexcept
+    : CMsgGCToGCUpdateSessionStats() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgGCToGCUpdateSessionStats& operator=(const CMsgGCToGCUpdateSessionStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgGCToGCUpdateSessionStats& operator=(CMsgGCToGCUpdateSessionStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgGCToGCUpdateSessionStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgGCToGCUpdateSessionStats* internal_default_instance() {
+    return reinterpret_cast<const CMsgGCToGCUpdateSessionStats*>(
+               &_CMsgGCToGCUpdateSessionStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(CMsgGCToGCUpdateSessionStats& a, CMsgGCToGCUpdateSessionStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgGCToGCUpdateSessionStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgGCToGCUpdateSessionStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgGCToGCUpdateSessionStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgGCToGCUpdateSessionStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgGCToGCUpdateSessionStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgGCToGCUpdateSessionStats& from) {
+    CMsgGCToGCUpdateSessionStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgGCToGCUpdateSessionStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgGCToGCUpdateSessionStats";
+  }
+  protected:
+  explicit CMsgGCToGCUpdateSessionStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUserSessionsFieldNumber = 1,
+    kServerSessionsFieldNumber = 2,
+    kInLogonSurgeFieldNumber = 3,
+  };
+  // optional uint32 user_sessions = 1;
+  bool has_user_sessions() const;
+  private:
+  bool _internal_has_user_sessions() const;
+  public:
+  void clear_user_sessions();
+  uint32_t user_sessions() const;
+  void set_user_sessions(uint32_t value);
+  private:
+  uint32_t _internal_user_sessions() const;
+  void _internal_set_user_sessions(uint32_t value);
+  public:
+
+  // optional uint32 server_sessions = 2;
+  bool has_server_sessions() const;
+  private:
+  bool _internal_has_server_sessions() const;
+  public:
+  void clear_server_sessions();
+  uint32_t server_sessions() const;
+  void set_server_sessions(uint32_t value);
+  private:
+  uint32_t _internal_server_sessions() const;
+  void _internal_set_server_sessions(uint32_t value);
+  public:
+
+  // optional bool in_logon_surge = 3;
+  bool has_in_logon_surge() const;
+  private:
+  bool _internal_has_in_logon_surge() const;
+  public:
+  void clear_in_logon_surge();
+  bool in_logon_surge() const;
+  void set_in_logon_surge(bool value);
+  private:
+  bool _internal_in_logon_surge() const;
+  void _internal_set_in_logon_surge(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgGCToGCUpdateSessionStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t user_sessions_;
+    uint32_t server_sessions_;
+    bool in_logon_surge_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription) */ {
+ public:
+  inline CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription() : CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription(nullptr) {}
+  ~CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription() override;
+  explicit PROTOBUF_CONSTEXPR CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription(const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& from);
+  CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription(CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription&& from) noexcept
+    : CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription() {
+    *this = ::std::move(from);
+  }
+
+  inline CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& operator=(const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& operator=(CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* internal_default_instance() {
+    return reinterpret_cast<const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription*>(
+               &_CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& a, CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& from) {
+    CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription";
+  }
+  protected:
+  explicit CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kItemDescriptionFieldNumber = 2,
+    kGameitemidFieldNumber = 1,
+  };
+  // optional string item_description = 2;
+  bool has_item_description() const;
+  private:
+  bool _internal_has_item_description() const;
+  public:
+  void clear_item_description();
+  const std::string& item_description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_item_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_item_description();
+  PROTOBUF_NODISCARD std::string* release_item_description();
+  void set_allocated_item_description(std::string* item_description);
+  private:
+  const std::string& _internal_item_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_item_description(const std::string& value);
+  std::string* _internal_mutable_item_description();
+  public:
+
+  // optional uint32 gameitemid = 1;
+  bool has_gameitemid() const;
+  private:
+  bool _internal_has_gameitemid() const;
+  public:
+  void clear_gameitemid();
+  uint32_t gameitemid() const;
+  void set_gameitemid(uint32_t value);
+  private:
+  uint32_t _internal_gameitemid() const;
+  void _internal_set_gameitemid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr item_description_;
+    uint32_t gameitemid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock) */ {
+ public:
+  inline CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock() : CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock(nullptr) {}
+  ~CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock() override;
+  explicit PROTOBUF_CONSTEXPR CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock(const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& from);
+  CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock(CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock&& from) noexcept
+    : CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock() {
+    *this = ::std::move(from);
+  }
+
+  inline CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& operator=(const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& operator=(CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* internal_default_instance() {
+    return reinterpret_cast<const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock*>(
+               &_CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& a, CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& from) {
+    CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock";
+  }
+  protected:
+  explicit CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDescriptionsFieldNumber = 2,
+    kLanguageFieldNumber = 1,
+  };
+  // repeated .CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription descriptions = 2;
+  int descriptions_size() const;
+  private:
+  int _internal_descriptions_size() const;
+  public:
+  void clear_descriptions();
+  ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* mutable_descriptions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription >*
+      mutable_descriptions();
+  private:
+  const ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& _internal_descriptions(int index) const;
+  ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* _internal_add_descriptions();
+  public:
+  const ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& descriptions(int index) const;
+  ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* add_descriptions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription >&
+      descriptions() const;
+
+  // optional string language = 1;
+  bool has_language() const;
+  private:
+  bool _internal_has_language() const;
+  public:
+  void clear_language();
+  const std::string& language() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_language(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_language();
+  PROTOBUF_NODISCARD std::string* release_language();
+  void set_allocated_language(std::string* language);
+  private:
+  const std::string& _internal_language() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_language(const std::string& value);
+  std::string* _internal_mutable_language();
+  public:
+
+  // @@protoc_insertion_point(class_scope:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription > descriptions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr language_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CWorkshop_PopulateItemDescriptions_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CWorkshop_PopulateItemDescriptions_Request) */ {
+ public:
+  inline CWorkshop_PopulateItemDescriptions_Request() : CWorkshop_PopulateItemDescriptions_Request(nullptr) {}
+  ~CWorkshop_PopulateItemDescriptions_Request() override;
+  explicit PROTOBUF_CONSTEXPR CWorkshop_PopulateItemDescriptions_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CWorkshop_PopulateItemDescriptions_Request(const CWorkshop_PopulateItemDescriptions_Request& from);
+  CWorkshop_PopulateItemDescriptions_Request(CWorkshop_PopulateItemDescriptions_Request&& from) noexcept
+    : CWorkshop_PopulateItemDescriptions_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline CWorkshop_PopulateItemDescriptions_Request& operator=(const CWorkshop_PopulateItemDescriptions_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CWorkshop_PopulateItemDescriptions_Request& operator=(CWorkshop_PopulateItemDescriptions_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CWorkshop_PopulateItemDescriptions_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CWorkshop_PopulateItemDescriptions_Request* internal_default_instance() {
+    return reinterpret_cast<const CWorkshop_PopulateItemDescriptions_Request*>(
+               &_CWorkshop_PopulateItemDescriptions_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(CWorkshop_PopulateItemDescriptions_Request& a, CWorkshop_PopulateItemDescriptions_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CWorkshop_PopulateItemDescriptions_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CWorkshop_PopulateItemDescriptions_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CWorkshop_PopulateItemDescriptions_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CWorkshop_PopulateItemDescriptions_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CWorkshop_PopulateItemDescriptions_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CWorkshop_PopulateItemDescriptions_Request& from) {
+    CWorkshop_PopulateItemDescriptions_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CWorkshop_PopulateItemDescriptions_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CWorkshop_PopulateItemDescriptions_Request";
+  }
+  protected:
+  explicit CWorkshop_PopulateItemDescriptions_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription SingleItemDescription;
+  typedef CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock ItemDescriptionsLanguageBlock;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLanguagesFieldNumber = 2,
+    kAppidFieldNumber = 1,
+  };
+  // repeated .CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock languages = 2;
+  int languages_size() const;
+  private:
+  int _internal_languages_size() const;
+  public:
+  void clear_languages();
+  ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* mutable_languages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock >*
+      mutable_languages();
+  private:
+  const ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& _internal_languages(int index) const;
+  ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* _internal_add_languages();
+  public:
+  const ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& languages(int index) const;
+  ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* add_languages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock >&
+      languages() const;
+
+  // optional uint32 appid = 1;
+  bool has_appid() const;
+  private:
+  bool _internal_has_appid() const;
+  public:
+  void clear_appid();
+  uint32_t appid() const;
+  void set_appid(uint32_t value);
+  private:
+  uint32_t _internal_appid() const;
+  void _internal_set_appid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CWorkshop_PopulateItemDescriptions_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock > languages_;
+    uint32_t appid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CWorkshop_GetContributors_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CWorkshop_GetContributors_Request) */ {
+ public:
+  inline CWorkshop_GetContributors_Request() : CWorkshop_GetContributors_Request(nullptr) {}
+  ~CWorkshop_GetContributors_Request() override;
+  explicit PROTOBUF_CONSTEXPR CWorkshop_GetContributors_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CWorkshop_GetContributors_Request(const CWorkshop_GetContributors_Request& from);
+  CWorkshop_GetContributors_Request(CWorkshop_GetContributors_Request&& from) noexcept
+    : CWorkshop_GetContributors_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline CWorkshop_GetContributors_Request& operator=(const CWorkshop_GetContributors_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CWorkshop_GetContributors_Request& operator=(CWorkshop_GetContributors_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CWorkshop_GetContributors_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CWorkshop_GetContributors_Request* internal_default_instance() {
+    return reinterpret_cast<const CWorkshop_GetContributors_Request*>(
+               &_CWorkshop_GetContributors_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
+
+  friend void swap(CWorkshop_GetContributors_Request& a, CWorkshop_GetContributors_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CWorkshop_GetContributors_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CWorkshop_GetContributors_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CWorkshop_GetContributors_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CWorkshop_GetContributors_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CWorkshop_GetContributors_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CWorkshop_GetContributors_Request& from) {
+    CWorkshop_GetContributors_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CWorkshop_GetContributors_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CWorkshop_GetContributors_Request";
+  }
+  protected:
+  explicit CWorkshop_GetContributors_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAppidFieldNumber = 1,
+    kGameitemidFieldNumber = 2,
+  };
+  // optional uint32 appid = 1;
+  bool has_appid() const;
+  private:
+  bool _internal_has_appid() const;
+  public:
+  void clear_appid();
+  uint32_t appid() const;
+  void set_appid(uint32_t value);
+  private:
+  uint32_t _internal_appid() const;
+  void _internal_set_appid(uint32_t value);
+  public:
+
+  // optional uint32 gameitemid = 2;
+  bool has_gameitemid() const;
+  private:
+  bool _internal_has_gameitemid() const;
+  public:
+  void clear_gameitemid();
+  uint32_t gameitemid() const;
+  void set_gameitemid(uint32_t value);
+  private:
+  uint32_t _internal_gameitemid() const;
+  void _internal_set_gameitemid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CWorkshop_GetContributors_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t appid_;
+    uint32_t gameitemid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CWorkshop_GetContributors_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CWorkshop_GetContributors_Response) */ {
+ public:
+  inline CWorkshop_GetContributors_Response() : CWorkshop_GetContributors_Response(nullptr) {}
+  ~CWorkshop_GetContributors_Response() override;
+  explicit PROTOBUF_CONSTEXPR CWorkshop_GetContributors_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CWorkshop_GetContributors_Response(const CWorkshop_GetContributors_Response& from);
+  CWorkshop_GetContributors_Response(CWorkshop_GetContributors_Response&& from) noexcept
+    : CWorkshop_GetContributors_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline CWorkshop_GetContributors_Response& operator=(const CWorkshop_GetContributors_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CWorkshop_GetContributors_Response& operator=(CWorkshop_GetContributors_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CWorkshop_GetContributors_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CWorkshop_GetContributors_Response* internal_default_instance() {
+    return reinterpret_cast<const CWorkshop_GetContributors_Response*>(
+               &_CWorkshop_GetContributors_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    40;
+
+  friend void swap(CWorkshop_GetContributors_Response& a, CWorkshop_GetContributors_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CWorkshop_GetContributors_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CWorkshop_GetContributors_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CWorkshop_GetContributors_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CWorkshop_GetContributors_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CWorkshop_GetContributors_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CWorkshop_GetContributors_Response& from) {
+    CWorkshop_GetContributors_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CWorkshop_GetContributors_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CWorkshop_GetContributors_Response";
+  }
+  protected:
+  explicit CWorkshop_GetContributors_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContributorsFieldNumber = 1,
+  };
+  // repeated fixed64 contributors = 1;
+  int contributors_size() const;
+  private:
+  int _internal_contributors_size() const;
+  public:
+  void clear_contributors();
+  private:
+  uint64_t _internal_contributors(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_contributors() const;
+  void _internal_add_contributors(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_contributors();
+  public:
+  uint64_t contributors(int index) const;
+  void set_contributors(int index, uint64_t value);
+  void add_contributors(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      contributors() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_contributors();
+
+  // @@protoc_insertion_point(class_scope:CWorkshop_GetContributors_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > contributors_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule) */ {
+ public:
+  inline CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule() : CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule(nullptr) {}
+  ~CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule() override;
+  explicit PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule(const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& from);
+  CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule&& from) noexcept
+    : CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule() {
+    *this = ::std::move(from);
+  }
+
+  inline CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& operator=(const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& operator=(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* internal_default_instance() {
+    return reinterpret_cast<const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule*>(
+               &_CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    41;
+
+  friend void swap(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& a, CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& from) {
+    CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule";
+  }
+  protected:
+  explicit CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRuleDescriptionFieldNumber = 3,
+    kWorkshopFileIdFieldNumber = 1,
+    kRevenuePercentageFieldNumber = 2,
+  };
+  // optional string rule_description = 3;
+  bool has_rule_description() const;
+  private:
+  bool _internal_has_rule_description() const;
+  public:
+  void clear_rule_description();
+  const std::string& rule_description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rule_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rule_description();
+  PROTOBUF_NODISCARD std::string* release_rule_description();
+  void set_allocated_rule_description(std::string* rule_description);
+  private:
+  const std::string& _internal_rule_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rule_description(const std::string& value);
+  std::string* _internal_mutable_rule_description();
+  public:
+
+  // optional uint64 workshop_file_id = 1;
+  bool has_workshop_file_id() const;
+  private:
+  bool _internal_has_workshop_file_id() const;
+  public:
+  void clear_workshop_file_id();
+  uint64_t workshop_file_id() const;
+  void set_workshop_file_id(uint64_t value);
+  private:
+  uint64_t _internal_workshop_file_id() const;
+  void _internal_set_workshop_file_id(uint64_t value);
+  public:
+
+  // optional float revenue_percentage = 2;
+  bool has_revenue_percentage() const;
+  private:
+  bool _internal_has_revenue_percentage() const;
+  public:
+  void clear_revenue_percentage();
+  float revenue_percentage() const;
+  void set_revenue_percentage(float value);
+  private:
+  float _internal_revenue_percentage() const;
+  void _internal_set_revenue_percentage(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rule_description_;
+    uint64_t workshop_file_id_;
+    float revenue_percentage_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule) */ {
+ public:
+  inline CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule() : CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule(nullptr) {}
+  ~CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule() override;
+  explicit PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule(const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& from);
+  CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule&& from) noexcept
+    : CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule() {
+    *this = ::std::move(from);
+  }
+
+  inline CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& operator=(const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& operator=(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* internal_default_instance() {
+    return reinterpret_cast<const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule*>(
+               &_CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    42;
+
+  friend void swap(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& a, CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& from) {
+    CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule";
+  }
+  protected:
+  explicit CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRuleDescriptionFieldNumber = 3,
+    kAccountIdFieldNumber = 1,
+    kRevenuePercentageFieldNumber = 2,
+  };
+  // optional string rule_description = 3;
+  bool has_rule_description() const;
+  private:
+  bool _internal_has_rule_description() const;
+  public:
+  void clear_rule_description();
+  const std::string& rule_description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rule_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rule_description();
+  PROTOBUF_NODISCARD std::string* release_rule_description();
+  void set_allocated_rule_description(std::string* rule_description);
+  private:
+  const std::string& _internal_rule_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rule_description(const std::string& value);
+  std::string* _internal_mutable_rule_description();
+  public:
+
+  // optional uint32 account_id = 1;
+  bool has_account_id() const;
+  private:
+  bool _internal_has_account_id() const;
+  public:
+  void clear_account_id();
+  uint32_t account_id() const;
+  void set_account_id(uint32_t value);
+  private:
+  uint32_t _internal_account_id() const;
+  void _internal_set_account_id(uint32_t value);
+  public:
+
+  // optional float revenue_percentage = 2;
+  bool has_revenue_percentage() const;
+  private:
+  bool _internal_has_revenue_percentage() const;
+  public:
+  void clear_revenue_percentage();
+  float revenue_percentage() const;
+  void set_revenue_percentage(float value);
+  private:
+  float _internal_revenue_percentage() const;
+  void _internal_set_revenue_percentage(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rule_description_;
+    uint32_t account_id_;
+    float revenue_percentage_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CWorkshop_SetItemPaymentRules_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CWorkshop_SetItemPaymentRules_Request) */ {
+ public:
+  inline CWorkshop_SetItemPaymentRules_Request() : CWorkshop_SetItemPaymentRules_Request(nullptr) {}
+  ~CWorkshop_SetItemPaymentRules_Request() override;
+  explicit PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CWorkshop_SetItemPaymentRules_Request(const CWorkshop_SetItemPaymentRules_Request& from);
+  CWorkshop_SetItemPaymentRules_Request(CWorkshop_SetItemPaymentRules_Request&& from) noexcept
+    : CWorkshop_SetItemPaymentRules_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline CWorkshop_SetItemPaymentRules_Request& operator=(const CWorkshop_SetItemPaymentRules_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CWorkshop_SetItemPaymentRules_Request& operator=(CWorkshop_SetItemPaymentRules_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CWorkshop_SetItemPaymentRules_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CWorkshop_SetItemPaymentRules_Request* internal_default_instance() {
+    return reinterpret_cast<const CWorkshop_SetItemPaymentRules_Request*>(
+               &_CWorkshop_SetItemPaymentRules_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    43;
+
+  friend void swap(CWorkshop_SetItemPaymentRules_Request& a, CWorkshop_SetItemPaymentRules_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CWorkshop_SetItemPaymentRules_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CWorkshop_SetItemPaymentRules_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CWorkshop_SetItemPaymentRules_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CWorkshop_SetItemPaymentRules_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CWorkshop_SetItemPaymentRules_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CWorkshop_SetItemPaymentRules_Request& from) {
+    CWorkshop_SetItemPaymentRules_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CWorkshop_SetItemPaymentRules_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CWorkshop_SetItemPaymentRules_Request";
+  }
+  protected:
+  explicit CWorkshop_SetItemPaymentRules_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule WorkshopItemPaymentRule;
+  typedef CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule PartnerItemPaymentRule;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAssociatedWorkshopFilesFieldNumber = 3,
+    kPartnerAccountsFieldNumber = 4,
+    kAppidFieldNumber = 1,
+    kGameitemidFieldNumber = 2,
+  };
+  // repeated .CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule associated_workshop_files = 3;
+  int associated_workshop_files_size() const;
+  private:
+  int _internal_associated_workshop_files_size() const;
+  public:
+  void clear_associated_workshop_files();
+  ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* mutable_associated_workshop_files(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule >*
+      mutable_associated_workshop_files();
+  private:
+  const ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& _internal_associated_workshop_files(int index) const;
+  ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* _internal_add_associated_workshop_files();
+  public:
+  const ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& associated_workshop_files(int index) const;
+  ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* add_associated_workshop_files();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule >&
+      associated_workshop_files() const;
+
+  // repeated .CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule partner_accounts = 4;
+  int partner_accounts_size() const;
+  private:
+  int _internal_partner_accounts_size() const;
+  public:
+  void clear_partner_accounts();
+  ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* mutable_partner_accounts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule >*
+      mutable_partner_accounts();
+  private:
+  const ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& _internal_partner_accounts(int index) const;
+  ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* _internal_add_partner_accounts();
+  public:
+  const ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& partner_accounts(int index) const;
+  ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* add_partner_accounts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule >&
+      partner_accounts() const;
+
+  // optional uint32 appid = 1;
+  bool has_appid() const;
+  private:
+  bool _internal_has_appid() const;
+  public:
+  void clear_appid();
+  uint32_t appid() const;
+  void set_appid(uint32_t value);
+  private:
+  uint32_t _internal_appid() const;
+  void _internal_set_appid(uint32_t value);
+  public:
+
+  // optional uint32 gameitemid = 2;
+  bool has_gameitemid() const;
+  private:
+  bool _internal_has_gameitemid() const;
+  public:
+  void clear_gameitemid();
+  uint32_t gameitemid() const;
+  void set_gameitemid(uint32_t value);
+  private:
+  uint32_t _internal_gameitemid() const;
+  void _internal_set_gameitemid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CWorkshop_SetItemPaymentRules_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule > associated_workshop_files_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule > partner_accounts_;
+    uint32_t appid_;
+    uint32_t gameitemid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CWorkshop_SetItemPaymentRules_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:CWorkshop_SetItemPaymentRules_Response) */ {
+ public:
+  inline CWorkshop_SetItemPaymentRules_Response() : CWorkshop_SetItemPaymentRules_Response(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CWorkshop_SetItemPaymentRules_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CWorkshop_SetItemPaymentRules_Response(const CWorkshop_SetItemPaymentRules_Response& from);
+  CWorkshop_SetItemPaymentRules_Response(CWorkshop_SetItemPaymentRules_Response&& from) noexcept
+    : CWorkshop_SetItemPaymentRules_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline CWorkshop_SetItemPaymentRules_Response& operator=(const CWorkshop_SetItemPaymentRules_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CWorkshop_SetItemPaymentRules_Response& operator=(CWorkshop_SetItemPaymentRules_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CWorkshop_SetItemPaymentRules_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CWorkshop_SetItemPaymentRules_Response* internal_default_instance() {
+    return reinterpret_cast<const CWorkshop_SetItemPaymentRules_Response*>(
+               &_CWorkshop_SetItemPaymentRules_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    44;
+
+  friend void swap(CWorkshop_SetItemPaymentRules_Response& a, CWorkshop_SetItemPaymentRules_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CWorkshop_SetItemPaymentRules_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CWorkshop_SetItemPaymentRules_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CWorkshop_SetItemPaymentRules_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CWorkshop_SetItemPaymentRules_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CWorkshop_SetItemPaymentRules_Response& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CWorkshop_SetItemPaymentRules_Response& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CWorkshop_SetItemPaymentRules_Response";
+  }
+  protected:
+  explicit CWorkshop_SetItemPaymentRules_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:CWorkshop_SetItemPaymentRules_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CBroadcast_PostGameDataFrame_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CBroadcast_PostGameDataFrame_Request) */ {
+ public:
+  inline CBroadcast_PostGameDataFrame_Request() : CBroadcast_PostGameDataFrame_Request(nullptr) {}
+  ~CBroadcast_PostGameDataFrame_Request() override;
+  explicit PROTOBUF_CONSTEXPR CBroadcast_PostGameDataFrame_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CBroadcast_PostGameDataFrame_Request(const CBroadcast_PostGameDataFrame_Request& from);
+  CBroadcast_PostGameDataFrame_Request(CBroadcast_PostGameDataFrame_Request&& from) noexcept
+    : CBroadcast_PostGameDataFrame_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline CBroadcast_PostGameDataFrame_Request& operator=(const CBroadcast_PostGameDataFrame_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CBroadcast_PostGameDataFrame_Request& operator=(CBroadcast_PostGameDataFrame_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CBroadcast_PostGameDataFrame_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CBroadcast_PostGameDataFrame_Request* internal_default_instance() {
+    return reinterpret_cast<const CBroadcast_PostGameDataFrame_Request*>(
+               &_CBroadcast_PostGameDataFrame_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    45;
+
+  friend void swap(CBroadcast_PostGameDataFrame_Request& a, CBroadcast_PostGameDataFrame_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CBroadcast_PostGameDataFrame_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CBroadcast_PostGameDataFrame_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CBroadcast_PostGameDataFrame_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CBroadcast_PostGameDataFrame_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CBroadcast_PostGameDataFrame_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CBroadcast_PostGameDataFrame_Request& from) {
+    CBroadcast_PostGameDataFrame_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CBroadcast_PostGameDataFrame_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CBroadcast_PostGameDataFrame_Request";
+  }
+  protected:
+  explicit CBroadcast_PostGameDataFrame_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFrameDataFieldNumber = 4,
+    kSteamidFieldNumber = 2,
+    kBroadcastIdFieldNumber = 3,
+    kAppidFieldNumber = 1,
+  };
+  // optional bytes frame_data = 4;
+  bool has_frame_data() const;
+  private:
+  bool _internal_has_frame_data() const;
+  public:
+  void clear_frame_data();
+  const std::string& frame_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_frame_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_frame_data();
+  PROTOBUF_NODISCARD std::string* release_frame_data();
+  void set_allocated_frame_data(std::string* frame_data);
+  private:
+  const std::string& _internal_frame_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_frame_data(const std::string& value);
+  std::string* _internal_mutable_frame_data();
+  public:
+
+  // optional fixed64 steamid = 2;
+  bool has_steamid() const;
+  private:
+  bool _internal_has_steamid() const;
+  public:
+  void clear_steamid();
+  uint64_t steamid() const;
+  void set_steamid(uint64_t value);
+  private:
+  uint64_t _internal_steamid() const;
+  void _internal_set_steamid(uint64_t value);
+  public:
+
+  // optional fixed64 broadcast_id = 3;
+  bool has_broadcast_id() const;
+  private:
+  bool _internal_has_broadcast_id() const;
+  public:
+  void clear_broadcast_id();
+  uint64_t broadcast_id() const;
+  void set_broadcast_id(uint64_t value);
+  private:
+  uint64_t _internal_broadcast_id() const;
+  void _internal_set_broadcast_id(uint64_t value);
+  public:
+
+  // optional uint32 appid = 1;
+  bool has_appid() const;
+  private:
+  bool _internal_has_appid() const;
+  public:
+  void clear_appid();
+  uint32_t appid() const;
+  void set_appid(uint32_t value);
+  private:
+  uint32_t _internal_appid() const;
+  void _internal_set_appid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CBroadcast_PostGameDataFrame_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr frame_data_;
+    uint64_t steamid_;
+    uint64_t broadcast_id_;
+    uint32_t appid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gcsdk_5fgcmessages_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CMsgSHA1Digest
+
+// required fixed64 block1 = 1;
+inline bool CMsgSHA1Digest::_internal_has_block1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgSHA1Digest::has_block1() const {
+  return _internal_has_block1();
+}
+inline void CMsgSHA1Digest::clear_block1() {
+  _impl_.block1_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CMsgSHA1Digest::_internal_block1() const {
+  return _impl_.block1_;
+}
+inline uint64_t CMsgSHA1Digest::block1() const {
+  // @@protoc_insertion_point(field_get:CMsgSHA1Digest.block1)
+  return _internal_block1();
+}
+inline void CMsgSHA1Digest::_internal_set_block1(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.block1_ = value;
+}
+inline void CMsgSHA1Digest::set_block1(uint64_t value) {
+  _internal_set_block1(value);
+  // @@protoc_insertion_point(field_set:CMsgSHA1Digest.block1)
+}
+
+// required fixed64 block2 = 2;
+inline bool CMsgSHA1Digest::_internal_has_block2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgSHA1Digest::has_block2() const {
+  return _internal_has_block2();
+}
+inline void CMsgSHA1Digest::clear_block2() {
+  _impl_.block2_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CMsgSHA1Digest::_internal_block2() const {
+  return _impl_.block2_;
+}
+inline uint64_t CMsgSHA1Digest::block2() const {
+  // @@protoc_insertion_point(field_get:CMsgSHA1Digest.block2)
+  return _internal_block2();
+}
+inline void CMsgSHA1Digest::_internal_set_block2(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.block2_ = value;
+}
+inline void CMsgSHA1Digest::set_block2(uint64_t value) {
+  _internal_set_block2(value);
+  // @@protoc_insertion_point(field_set:CMsgSHA1Digest.block2)
+}
+
+// required fixed32 block3 = 3;
+inline bool CMsgSHA1Digest::_internal_has_block3() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgSHA1Digest::has_block3() const {
+  return _internal_has_block3();
+}
+inline void CMsgSHA1Digest::clear_block3() {
+  _impl_.block3_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CMsgSHA1Digest::_internal_block3() const {
+  return _impl_.block3_;
+}
+inline uint32_t CMsgSHA1Digest::block3() const {
+  // @@protoc_insertion_point(field_get:CMsgSHA1Digest.block3)
+  return _internal_block3();
+}
+inline void CMsgSHA1Digest::_internal_set_block3(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.block3_ = value;
+}
+inline void CMsgSHA1Digest::set_block3(uint32_t value) {
+  _internal_set_block3(value);
+  // @@protoc_insertion_point(field_set:CMsgSHA1Digest.block3)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOIDOwner
+
+// optional uint32 type = 1;
+inline bool CMsgSOIDOwner::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgSOIDOwner::has_type() const {
+  return _internal_has_type();
+}
+inline void CMsgSOIDOwner::clear_type() {
+  _impl_.type_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CMsgSOIDOwner::_internal_type() const {
+  return _impl_.type_;
+}
+inline uint32_t CMsgSOIDOwner::type() const {
+  // @@protoc_insertion_point(field_get:CMsgSOIDOwner.type)
+  return _internal_type();
+}
+inline void CMsgSOIDOwner::_internal_set_type(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void CMsgSOIDOwner::set_type(uint32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:CMsgSOIDOwner.type)
+}
+
+// optional uint64 id = 2;
+inline bool CMsgSOIDOwner::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgSOIDOwner::has_id() const {
+  return _internal_has_id();
+}
+inline void CMsgSOIDOwner::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CMsgSOIDOwner::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t CMsgSOIDOwner::id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOIDOwner.id)
+  return _internal_id();
+}
+inline void CMsgSOIDOwner::_internal_set_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void CMsgSOIDOwner::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOIDOwner.id)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOSingleObject
+
+// optional int32 type_id = 2;
+inline bool CMsgSOSingleObject::_internal_has_type_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CMsgSOSingleObject::has_type_id() const {
+  return _internal_has_type_id();
+}
+inline void CMsgSOSingleObject::clear_type_id() {
+  _impl_.type_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CMsgSOSingleObject::_internal_type_id() const {
+  return _impl_.type_id_;
+}
+inline int32_t CMsgSOSingleObject::type_id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOSingleObject.type_id)
+  return _internal_type_id();
+}
+inline void CMsgSOSingleObject::_internal_set_type_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.type_id_ = value;
+}
+inline void CMsgSOSingleObject::set_type_id(int32_t value) {
+  _internal_set_type_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOSingleObject.type_id)
+}
+
+// optional bytes object_data = 3;
+inline bool CMsgSOSingleObject::_internal_has_object_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgSOSingleObject::has_object_data() const {
+  return _internal_has_object_data();
+}
+inline void CMsgSOSingleObject::clear_object_data() {
+  _impl_.object_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CMsgSOSingleObject::object_data() const {
+  // @@protoc_insertion_point(field_get:CMsgSOSingleObject.object_data)
+  return _internal_object_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CMsgSOSingleObject::set_object_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.object_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CMsgSOSingleObject.object_data)
+}
+inline std::string* CMsgSOSingleObject::mutable_object_data() {
+  std::string* _s = _internal_mutable_object_data();
+  // @@protoc_insertion_point(field_mutable:CMsgSOSingleObject.object_data)
+  return _s;
+}
+inline const std::string& CMsgSOSingleObject::_internal_object_data() const {
+  return _impl_.object_data_.Get();
+}
+inline void CMsgSOSingleObject::_internal_set_object_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.object_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CMsgSOSingleObject::_internal_mutable_object_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.object_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CMsgSOSingleObject::release_object_data() {
+  // @@protoc_insertion_point(field_release:CMsgSOSingleObject.object_data)
+  if (!_internal_has_object_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.object_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.object_data_.IsDefault()) {
+    _impl_.object_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CMsgSOSingleObject::set_allocated_object_data(std::string* object_data) {
+  if (object_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.object_data_.SetAllocated(object_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.object_data_.IsDefault()) {
+    _impl_.object_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOSingleObject.object_data)
+}
+
+// optional fixed64 version = 4;
+inline bool CMsgSOSingleObject::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgSOSingleObject::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgSOSingleObject::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t CMsgSOSingleObject::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CMsgSOSingleObject::version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOSingleObject.version)
+  return _internal_version();
+}
+inline void CMsgSOSingleObject::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.version_ = value;
+}
+inline void CMsgSOSingleObject::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOSingleObject.version)
+}
+
+// optional .CMsgSOIDOwner owner_soid = 5;
+inline bool CMsgSOSingleObject::_internal_has_owner_soid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.owner_soid_ != nullptr);
+  return value;
+}
+inline bool CMsgSOSingleObject::has_owner_soid() const {
+  return _internal_has_owner_soid();
+}
+inline void CMsgSOSingleObject::clear_owner_soid() {
+  if (_impl_.owner_soid_ != nullptr) _impl_.owner_soid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::CMsgSOIDOwner& CMsgSOSingleObject::_internal_owner_soid() const {
+  const ::CMsgSOIDOwner* p = _impl_.owner_soid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgSOIDOwner&>(
+      ::_CMsgSOIDOwner_default_instance_);
+}
+inline const ::CMsgSOIDOwner& CMsgSOSingleObject::owner_soid() const {
+  // @@protoc_insertion_point(field_get:CMsgSOSingleObject.owner_soid)
+  return _internal_owner_soid();
+}
+inline void CMsgSOSingleObject::unsafe_arena_set_allocated_owner_soid(
+    ::CMsgSOIDOwner* owner_soid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.owner_soid_);
+  }
+  _impl_.owner_soid_ = owner_soid;
+  if (owner_soid) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMsgSOSingleObject.owner_soid)
+}
+inline ::CMsgSOIDOwner* CMsgSOSingleObject::release_owner_soid() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOSingleObject::unsafe_arena_release_owner_soid() {
+  // @@protoc_insertion_point(field_release:CMsgSOSingleObject.owner_soid)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOSingleObject::_internal_mutable_owner_soid() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.owner_soid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgSOIDOwner>(GetArenaForAllocation());
+    _impl_.owner_soid_ = p;
+  }
+  return _impl_.owner_soid_;
+}
+inline ::CMsgSOIDOwner* CMsgSOSingleObject::mutable_owner_soid() {
+  ::CMsgSOIDOwner* _msg = _internal_mutable_owner_soid();
+  // @@protoc_insertion_point(field_mutable:CMsgSOSingleObject.owner_soid)
+  return _msg;
+}
+inline void CMsgSOSingleObject::set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.owner_soid_;
+  }
+  if (owner_soid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(owner_soid);
+    if (message_arena != submessage_arena) {
+      owner_soid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, owner_soid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.owner_soid_ = owner_soid;
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOSingleObject.owner_soid)
+}
+
+// optional uint32 service_id = 6;
+inline bool CMsgSOSingleObject::_internal_has_service_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CMsgSOSingleObject::has_service_id() const {
+  return _internal_has_service_id();
+}
+inline void CMsgSOSingleObject::clear_service_id() {
+  _impl_.service_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t CMsgSOSingleObject::_internal_service_id() const {
+  return _impl_.service_id_;
+}
+inline uint32_t CMsgSOSingleObject::service_id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOSingleObject.service_id)
+  return _internal_service_id();
+}
+inline void CMsgSOSingleObject::_internal_set_service_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.service_id_ = value;
+}
+inline void CMsgSOSingleObject::set_service_id(uint32_t value) {
+  _internal_set_service_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOSingleObject.service_id)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOMultipleObjects_SingleObject
+
+// optional int32 type_id = 1;
+inline bool CMsgSOMultipleObjects_SingleObject::_internal_has_type_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgSOMultipleObjects_SingleObject::has_type_id() const {
+  return _internal_has_type_id();
+}
+inline void CMsgSOMultipleObjects_SingleObject::clear_type_id() {
+  _impl_.type_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CMsgSOMultipleObjects_SingleObject::_internal_type_id() const {
+  return _impl_.type_id_;
+}
+inline int32_t CMsgSOMultipleObjects_SingleObject::type_id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOMultipleObjects.SingleObject.type_id)
+  return _internal_type_id();
+}
+inline void CMsgSOMultipleObjects_SingleObject::_internal_set_type_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_id_ = value;
+}
+inline void CMsgSOMultipleObjects_SingleObject::set_type_id(int32_t value) {
+  _internal_set_type_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOMultipleObjects.SingleObject.type_id)
+}
+
+// optional bytes object_data = 2;
+inline bool CMsgSOMultipleObjects_SingleObject::_internal_has_object_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgSOMultipleObjects_SingleObject::has_object_data() const {
+  return _internal_has_object_data();
+}
+inline void CMsgSOMultipleObjects_SingleObject::clear_object_data() {
+  _impl_.object_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CMsgSOMultipleObjects_SingleObject::object_data() const {
+  // @@protoc_insertion_point(field_get:CMsgSOMultipleObjects.SingleObject.object_data)
+  return _internal_object_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CMsgSOMultipleObjects_SingleObject::set_object_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.object_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CMsgSOMultipleObjects.SingleObject.object_data)
+}
+inline std::string* CMsgSOMultipleObjects_SingleObject::mutable_object_data() {
+  std::string* _s = _internal_mutable_object_data();
+  // @@protoc_insertion_point(field_mutable:CMsgSOMultipleObjects.SingleObject.object_data)
+  return _s;
+}
+inline const std::string& CMsgSOMultipleObjects_SingleObject::_internal_object_data() const {
+  return _impl_.object_data_.Get();
+}
+inline void CMsgSOMultipleObjects_SingleObject::_internal_set_object_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.object_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CMsgSOMultipleObjects_SingleObject::_internal_mutable_object_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.object_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CMsgSOMultipleObjects_SingleObject::release_object_data() {
+  // @@protoc_insertion_point(field_release:CMsgSOMultipleObjects.SingleObject.object_data)
+  if (!_internal_has_object_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.object_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.object_data_.IsDefault()) {
+    _impl_.object_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CMsgSOMultipleObjects_SingleObject::set_allocated_object_data(std::string* object_data) {
+  if (object_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.object_data_.SetAllocated(object_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.object_data_.IsDefault()) {
+    _impl_.object_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOMultipleObjects.SingleObject.object_data)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOMultipleObjects
+
+// repeated .CMsgSOMultipleObjects.SingleObject objects_modified = 2;
+inline int CMsgSOMultipleObjects::_internal_objects_modified_size() const {
+  return _impl_.objects_modified_.size();
+}
+inline int CMsgSOMultipleObjects::objects_modified_size() const {
+  return _internal_objects_modified_size();
+}
+inline void CMsgSOMultipleObjects::clear_objects_modified() {
+  _impl_.objects_modified_.Clear();
+}
+inline ::CMsgSOMultipleObjects_SingleObject* CMsgSOMultipleObjects::mutable_objects_modified(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgSOMultipleObjects.objects_modified)
+  return _impl_.objects_modified_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >*
+CMsgSOMultipleObjects::mutable_objects_modified() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgSOMultipleObjects.objects_modified)
+  return &_impl_.objects_modified_;
+}
+inline const ::CMsgSOMultipleObjects_SingleObject& CMsgSOMultipleObjects::_internal_objects_modified(int index) const {
+  return _impl_.objects_modified_.Get(index);
+}
+inline const ::CMsgSOMultipleObjects_SingleObject& CMsgSOMultipleObjects::objects_modified(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgSOMultipleObjects.objects_modified)
+  return _internal_objects_modified(index);
+}
+inline ::CMsgSOMultipleObjects_SingleObject* CMsgSOMultipleObjects::_internal_add_objects_modified() {
+  return _impl_.objects_modified_.Add();
+}
+inline ::CMsgSOMultipleObjects_SingleObject* CMsgSOMultipleObjects::add_objects_modified() {
+  ::CMsgSOMultipleObjects_SingleObject* _add = _internal_add_objects_modified();
+  // @@protoc_insertion_point(field_add:CMsgSOMultipleObjects.objects_modified)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >&
+CMsgSOMultipleObjects::objects_modified() const {
+  // @@protoc_insertion_point(field_list:CMsgSOMultipleObjects.objects_modified)
+  return _impl_.objects_modified_;
+}
+
+// optional fixed64 version = 3;
+inline bool CMsgSOMultipleObjects::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgSOMultipleObjects::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgSOMultipleObjects::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CMsgSOMultipleObjects::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CMsgSOMultipleObjects::version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOMultipleObjects.version)
+  return _internal_version();
+}
+inline void CMsgSOMultipleObjects::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
+}
+inline void CMsgSOMultipleObjects::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOMultipleObjects.version)
+}
+
+// repeated .CMsgSOMultipleObjects.SingleObject objects_added = 4;
+inline int CMsgSOMultipleObjects::_internal_objects_added_size() const {
+  return _impl_.objects_added_.size();
+}
+inline int CMsgSOMultipleObjects::objects_added_size() const {
+  return _internal_objects_added_size();
+}
+inline void CMsgSOMultipleObjects::clear_objects_added() {
+  _impl_.objects_added_.Clear();
+}
+inline ::CMsgSOMultipleObjects_SingleObject* CMsgSOMultipleObjects::mutable_objects_added(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgSOMultipleObjects.objects_added)
+  return _impl_.objects_added_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >*
+CMsgSOMultipleObjects::mutable_objects_added() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgSOMultipleObjects.objects_added)
+  return &_impl_.objects_added_;
+}
+inline const ::CMsgSOMultipleObjects_SingleObject& CMsgSOMultipleObjects::_internal_objects_added(int index) const {
+  return _impl_.objects_added_.Get(index);
+}
+inline const ::CMsgSOMultipleObjects_SingleObject& CMsgSOMultipleObjects::objects_added(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgSOMultipleObjects.objects_added)
+  return _internal_objects_added(index);
+}
+inline ::CMsgSOMultipleObjects_SingleObject* CMsgSOMultipleObjects::_internal_add_objects_added() {
+  return _impl_.objects_added_.Add();
+}
+inline ::CMsgSOMultipleObjects_SingleObject* CMsgSOMultipleObjects::add_objects_added() {
+  ::CMsgSOMultipleObjects_SingleObject* _add = _internal_add_objects_added();
+  // @@protoc_insertion_point(field_add:CMsgSOMultipleObjects.objects_added)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >&
+CMsgSOMultipleObjects::objects_added() const {
+  // @@protoc_insertion_point(field_list:CMsgSOMultipleObjects.objects_added)
+  return _impl_.objects_added_;
+}
+
+// repeated .CMsgSOMultipleObjects.SingleObject objects_removed = 5;
+inline int CMsgSOMultipleObjects::_internal_objects_removed_size() const {
+  return _impl_.objects_removed_.size();
+}
+inline int CMsgSOMultipleObjects::objects_removed_size() const {
+  return _internal_objects_removed_size();
+}
+inline void CMsgSOMultipleObjects::clear_objects_removed() {
+  _impl_.objects_removed_.Clear();
+}
+inline ::CMsgSOMultipleObjects_SingleObject* CMsgSOMultipleObjects::mutable_objects_removed(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgSOMultipleObjects.objects_removed)
+  return _impl_.objects_removed_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >*
+CMsgSOMultipleObjects::mutable_objects_removed() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgSOMultipleObjects.objects_removed)
+  return &_impl_.objects_removed_;
+}
+inline const ::CMsgSOMultipleObjects_SingleObject& CMsgSOMultipleObjects::_internal_objects_removed(int index) const {
+  return _impl_.objects_removed_.Get(index);
+}
+inline const ::CMsgSOMultipleObjects_SingleObject& CMsgSOMultipleObjects::objects_removed(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgSOMultipleObjects.objects_removed)
+  return _internal_objects_removed(index);
+}
+inline ::CMsgSOMultipleObjects_SingleObject* CMsgSOMultipleObjects::_internal_add_objects_removed() {
+  return _impl_.objects_removed_.Add();
+}
+inline ::CMsgSOMultipleObjects_SingleObject* CMsgSOMultipleObjects::add_objects_removed() {
+  ::CMsgSOMultipleObjects_SingleObject* _add = _internal_add_objects_removed();
+  // @@protoc_insertion_point(field_add:CMsgSOMultipleObjects.objects_removed)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOMultipleObjects_SingleObject >&
+CMsgSOMultipleObjects::objects_removed() const {
+  // @@protoc_insertion_point(field_list:CMsgSOMultipleObjects.objects_removed)
+  return _impl_.objects_removed_;
+}
+
+// optional .CMsgSOIDOwner owner_soid = 6;
+inline bool CMsgSOMultipleObjects::_internal_has_owner_soid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.owner_soid_ != nullptr);
+  return value;
+}
+inline bool CMsgSOMultipleObjects::has_owner_soid() const {
+  return _internal_has_owner_soid();
+}
+inline void CMsgSOMultipleObjects::clear_owner_soid() {
+  if (_impl_.owner_soid_ != nullptr) _impl_.owner_soid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CMsgSOIDOwner& CMsgSOMultipleObjects::_internal_owner_soid() const {
+  const ::CMsgSOIDOwner* p = _impl_.owner_soid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgSOIDOwner&>(
+      ::_CMsgSOIDOwner_default_instance_);
+}
+inline const ::CMsgSOIDOwner& CMsgSOMultipleObjects::owner_soid() const {
+  // @@protoc_insertion_point(field_get:CMsgSOMultipleObjects.owner_soid)
+  return _internal_owner_soid();
+}
+inline void CMsgSOMultipleObjects::unsafe_arena_set_allocated_owner_soid(
+    ::CMsgSOIDOwner* owner_soid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.owner_soid_);
+  }
+  _impl_.owner_soid_ = owner_soid;
+  if (owner_soid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMsgSOMultipleObjects.owner_soid)
+}
+inline ::CMsgSOIDOwner* CMsgSOMultipleObjects::release_owner_soid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOMultipleObjects::unsafe_arena_release_owner_soid() {
+  // @@protoc_insertion_point(field_release:CMsgSOMultipleObjects.owner_soid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOMultipleObjects::_internal_mutable_owner_soid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.owner_soid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgSOIDOwner>(GetArenaForAllocation());
+    _impl_.owner_soid_ = p;
+  }
+  return _impl_.owner_soid_;
+}
+inline ::CMsgSOIDOwner* CMsgSOMultipleObjects::mutable_owner_soid() {
+  ::CMsgSOIDOwner* _msg = _internal_mutable_owner_soid();
+  // @@protoc_insertion_point(field_mutable:CMsgSOMultipleObjects.owner_soid)
+  return _msg;
+}
+inline void CMsgSOMultipleObjects::set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.owner_soid_;
+  }
+  if (owner_soid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(owner_soid);
+    if (message_arena != submessage_arena) {
+      owner_soid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, owner_soid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.owner_soid_ = owner_soid;
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOMultipleObjects.owner_soid)
+}
+
+// optional uint32 service_id = 7;
+inline bool CMsgSOMultipleObjects::_internal_has_service_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgSOMultipleObjects::has_service_id() const {
+  return _internal_has_service_id();
+}
+inline void CMsgSOMultipleObjects::clear_service_id() {
+  _impl_.service_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CMsgSOMultipleObjects::_internal_service_id() const {
+  return _impl_.service_id_;
+}
+inline uint32_t CMsgSOMultipleObjects::service_id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOMultipleObjects.service_id)
+  return _internal_service_id();
+}
+inline void CMsgSOMultipleObjects::_internal_set_service_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.service_id_ = value;
+}
+inline void CMsgSOMultipleObjects::set_service_id(uint32_t value) {
+  _internal_set_service_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOMultipleObjects.service_id)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOCacheSubscribed_SubscribedType
+
+// optional int32 type_id = 1;
+inline bool CMsgSOCacheSubscribed_SubscribedType::_internal_has_type_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscribed_SubscribedType::has_type_id() const {
+  return _internal_has_type_id();
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::clear_type_id() {
+  _impl_.type_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CMsgSOCacheSubscribed_SubscribedType::_internal_type_id() const {
+  return _impl_.type_id_;
+}
+inline int32_t CMsgSOCacheSubscribed_SubscribedType::type_id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribed.SubscribedType.type_id)
+  return _internal_type_id();
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::_internal_set_type_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_id_ = value;
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::set_type_id(int32_t value) {
+  _internal_set_type_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribed.SubscribedType.type_id)
+}
+
+// repeated bytes object_data = 2;
+inline int CMsgSOCacheSubscribed_SubscribedType::_internal_object_data_size() const {
+  return _impl_.object_data_.size();
+}
+inline int CMsgSOCacheSubscribed_SubscribedType::object_data_size() const {
+  return _internal_object_data_size();
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::clear_object_data() {
+  _impl_.object_data_.Clear();
+}
+inline std::string* CMsgSOCacheSubscribed_SubscribedType::add_object_data() {
+  std::string* _s = _internal_add_object_data();
+  // @@protoc_insertion_point(field_add_mutable:CMsgSOCacheSubscribed.SubscribedType.object_data)
+  return _s;
+}
+inline const std::string& CMsgSOCacheSubscribed_SubscribedType::_internal_object_data(int index) const {
+  return _impl_.object_data_.Get(index);
+}
+inline const std::string& CMsgSOCacheSubscribed_SubscribedType::object_data(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribed.SubscribedType.object_data)
+  return _internal_object_data(index);
+}
+inline std::string* CMsgSOCacheSubscribed_SubscribedType::mutable_object_data(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgSOCacheSubscribed.SubscribedType.object_data)
+  return _impl_.object_data_.Mutable(index);
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::set_object_data(int index, const std::string& value) {
+  _impl_.object_data_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribed.SubscribedType.object_data)
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::set_object_data(int index, std::string&& value) {
+  _impl_.object_data_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribed.SubscribedType.object_data)
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::set_object_data(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.object_data_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:CMsgSOCacheSubscribed.SubscribedType.object_data)
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::set_object_data(int index, const void* value, size_t size) {
+  _impl_.object_data_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:CMsgSOCacheSubscribed.SubscribedType.object_data)
+}
+inline std::string* CMsgSOCacheSubscribed_SubscribedType::_internal_add_object_data() {
+  return _impl_.object_data_.Add();
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::add_object_data(const std::string& value) {
+  _impl_.object_data_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:CMsgSOCacheSubscribed.SubscribedType.object_data)
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::add_object_data(std::string&& value) {
+  _impl_.object_data_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:CMsgSOCacheSubscribed.SubscribedType.object_data)
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::add_object_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.object_data_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:CMsgSOCacheSubscribed.SubscribedType.object_data)
+}
+inline void CMsgSOCacheSubscribed_SubscribedType::add_object_data(const void* value, size_t size) {
+  _impl_.object_data_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:CMsgSOCacheSubscribed.SubscribedType.object_data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CMsgSOCacheSubscribed_SubscribedType::object_data() const {
+  // @@protoc_insertion_point(field_list:CMsgSOCacheSubscribed.SubscribedType.object_data)
+  return _impl_.object_data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CMsgSOCacheSubscribed_SubscribedType::mutable_object_data() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgSOCacheSubscribed.SubscribedType.object_data)
+  return &_impl_.object_data_;
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOCacheSubscribed
+
+// repeated .CMsgSOCacheSubscribed.SubscribedType objects = 2;
+inline int CMsgSOCacheSubscribed::_internal_objects_size() const {
+  return _impl_.objects_.size();
+}
+inline int CMsgSOCacheSubscribed::objects_size() const {
+  return _internal_objects_size();
+}
+inline void CMsgSOCacheSubscribed::clear_objects() {
+  _impl_.objects_.Clear();
+}
+inline ::CMsgSOCacheSubscribed_SubscribedType* CMsgSOCacheSubscribed::mutable_objects(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgSOCacheSubscribed.objects)
+  return _impl_.objects_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed_SubscribedType >*
+CMsgSOCacheSubscribed::mutable_objects() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgSOCacheSubscribed.objects)
+  return &_impl_.objects_;
+}
+inline const ::CMsgSOCacheSubscribed_SubscribedType& CMsgSOCacheSubscribed::_internal_objects(int index) const {
+  return _impl_.objects_.Get(index);
+}
+inline const ::CMsgSOCacheSubscribed_SubscribedType& CMsgSOCacheSubscribed::objects(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribed.objects)
+  return _internal_objects(index);
+}
+inline ::CMsgSOCacheSubscribed_SubscribedType* CMsgSOCacheSubscribed::_internal_add_objects() {
+  return _impl_.objects_.Add();
+}
+inline ::CMsgSOCacheSubscribed_SubscribedType* CMsgSOCacheSubscribed::add_objects() {
+  ::CMsgSOCacheSubscribed_SubscribedType* _add = _internal_add_objects();
+  // @@protoc_insertion_point(field_add:CMsgSOCacheSubscribed.objects)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed_SubscribedType >&
+CMsgSOCacheSubscribed::objects() const {
+  // @@protoc_insertion_point(field_list:CMsgSOCacheSubscribed.objects)
+  return _impl_.objects_;
+}
+
+// optional fixed64 version = 3;
+inline bool CMsgSOCacheSubscribed::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscribed::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgSOCacheSubscribed::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CMsgSOCacheSubscribed::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CMsgSOCacheSubscribed::version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribed.version)
+  return _internal_version();
+}
+inline void CMsgSOCacheSubscribed::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
+}
+inline void CMsgSOCacheSubscribed::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribed.version)
+}
+
+// optional .CMsgSOIDOwner owner_soid = 4;
+inline bool CMsgSOCacheSubscribed::_internal_has_owner_soid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.owner_soid_ != nullptr);
+  return value;
+}
+inline bool CMsgSOCacheSubscribed::has_owner_soid() const {
+  return _internal_has_owner_soid();
+}
+inline void CMsgSOCacheSubscribed::clear_owner_soid() {
+  if (_impl_.owner_soid_ != nullptr) _impl_.owner_soid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheSubscribed::_internal_owner_soid() const {
+  const ::CMsgSOIDOwner* p = _impl_.owner_soid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgSOIDOwner&>(
+      ::_CMsgSOIDOwner_default_instance_);
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheSubscribed::owner_soid() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribed.owner_soid)
+  return _internal_owner_soid();
+}
+inline void CMsgSOCacheSubscribed::unsafe_arena_set_allocated_owner_soid(
+    ::CMsgSOIDOwner* owner_soid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.owner_soid_);
+  }
+  _impl_.owner_soid_ = owner_soid;
+  if (owner_soid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMsgSOCacheSubscribed.owner_soid)
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscribed::release_owner_soid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscribed::unsafe_arena_release_owner_soid() {
+  // @@protoc_insertion_point(field_release:CMsgSOCacheSubscribed.owner_soid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscribed::_internal_mutable_owner_soid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.owner_soid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgSOIDOwner>(GetArenaForAllocation());
+    _impl_.owner_soid_ = p;
+  }
+  return _impl_.owner_soid_;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscribed::mutable_owner_soid() {
+  ::CMsgSOIDOwner* _msg = _internal_mutable_owner_soid();
+  // @@protoc_insertion_point(field_mutable:CMsgSOCacheSubscribed.owner_soid)
+  return _msg;
+}
+inline void CMsgSOCacheSubscribed::set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.owner_soid_;
+  }
+  if (owner_soid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(owner_soid);
+    if (message_arena != submessage_arena) {
+      owner_soid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, owner_soid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.owner_soid_ = owner_soid;
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOCacheSubscribed.owner_soid)
+}
+
+// optional uint32 service_id = 5;
+inline bool CMsgSOCacheSubscribed::_internal_has_service_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscribed::has_service_id() const {
+  return _internal_has_service_id();
+}
+inline void CMsgSOCacheSubscribed::clear_service_id() {
+  _impl_.service_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CMsgSOCacheSubscribed::_internal_service_id() const {
+  return _impl_.service_id_;
+}
+inline uint32_t CMsgSOCacheSubscribed::service_id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribed.service_id)
+  return _internal_service_id();
+}
+inline void CMsgSOCacheSubscribed::_internal_set_service_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.service_id_ = value;
+}
+inline void CMsgSOCacheSubscribed::set_service_id(uint32_t value) {
+  _internal_set_service_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribed.service_id)
+}
+
+// repeated uint32 service_list = 6;
+inline int CMsgSOCacheSubscribed::_internal_service_list_size() const {
+  return _impl_.service_list_.size();
+}
+inline int CMsgSOCacheSubscribed::service_list_size() const {
+  return _internal_service_list_size();
+}
+inline void CMsgSOCacheSubscribed::clear_service_list() {
+  _impl_.service_list_.Clear();
+}
+inline uint32_t CMsgSOCacheSubscribed::_internal_service_list(int index) const {
+  return _impl_.service_list_.Get(index);
+}
+inline uint32_t CMsgSOCacheSubscribed::service_list(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribed.service_list)
+  return _internal_service_list(index);
+}
+inline void CMsgSOCacheSubscribed::set_service_list(int index, uint32_t value) {
+  _impl_.service_list_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribed.service_list)
+}
+inline void CMsgSOCacheSubscribed::_internal_add_service_list(uint32_t value) {
+  _impl_.service_list_.Add(value);
+}
+inline void CMsgSOCacheSubscribed::add_service_list(uint32_t value) {
+  _internal_add_service_list(value);
+  // @@protoc_insertion_point(field_add:CMsgSOCacheSubscribed.service_list)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CMsgSOCacheSubscribed::_internal_service_list() const {
+  return _impl_.service_list_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CMsgSOCacheSubscribed::service_list() const {
+  // @@protoc_insertion_point(field_list:CMsgSOCacheSubscribed.service_list)
+  return _internal_service_list();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CMsgSOCacheSubscribed::_internal_mutable_service_list() {
+  return &_impl_.service_list_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CMsgSOCacheSubscribed::mutable_service_list() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgSOCacheSubscribed.service_list)
+  return _internal_mutable_service_list();
+}
+
+// optional fixed64 sync_version = 7;
+inline bool CMsgSOCacheSubscribed::_internal_has_sync_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscribed::has_sync_version() const {
+  return _internal_has_sync_version();
+}
+inline void CMsgSOCacheSubscribed::clear_sync_version() {
+  _impl_.sync_version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t CMsgSOCacheSubscribed::_internal_sync_version() const {
+  return _impl_.sync_version_;
+}
+inline uint64_t CMsgSOCacheSubscribed::sync_version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribed.sync_version)
+  return _internal_sync_version();
+}
+inline void CMsgSOCacheSubscribed::_internal_set_sync_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sync_version_ = value;
+}
+inline void CMsgSOCacheSubscribed::set_sync_version(uint64_t value) {
+  _internal_set_sync_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribed.sync_version)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOCacheSubscribedUpToDate
+
+// optional fixed64 version = 1;
+inline bool CMsgSOCacheSubscribedUpToDate::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscribedUpToDate::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgSOCacheSubscribedUpToDate::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CMsgSOCacheSubscribedUpToDate::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CMsgSOCacheSubscribedUpToDate::version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribedUpToDate.version)
+  return _internal_version();
+}
+inline void CMsgSOCacheSubscribedUpToDate::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
+}
+inline void CMsgSOCacheSubscribedUpToDate::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribedUpToDate.version)
+}
+
+// optional .CMsgSOIDOwner owner_soid = 2;
+inline bool CMsgSOCacheSubscribedUpToDate::_internal_has_owner_soid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.owner_soid_ != nullptr);
+  return value;
+}
+inline bool CMsgSOCacheSubscribedUpToDate::has_owner_soid() const {
+  return _internal_has_owner_soid();
+}
+inline void CMsgSOCacheSubscribedUpToDate::clear_owner_soid() {
+  if (_impl_.owner_soid_ != nullptr) _impl_.owner_soid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheSubscribedUpToDate::_internal_owner_soid() const {
+  const ::CMsgSOIDOwner* p = _impl_.owner_soid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgSOIDOwner&>(
+      ::_CMsgSOIDOwner_default_instance_);
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheSubscribedUpToDate::owner_soid() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribedUpToDate.owner_soid)
+  return _internal_owner_soid();
+}
+inline void CMsgSOCacheSubscribedUpToDate::unsafe_arena_set_allocated_owner_soid(
+    ::CMsgSOIDOwner* owner_soid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.owner_soid_);
+  }
+  _impl_.owner_soid_ = owner_soid;
+  if (owner_soid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMsgSOCacheSubscribedUpToDate.owner_soid)
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscribedUpToDate::release_owner_soid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscribedUpToDate::unsafe_arena_release_owner_soid() {
+  // @@protoc_insertion_point(field_release:CMsgSOCacheSubscribedUpToDate.owner_soid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscribedUpToDate::_internal_mutable_owner_soid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.owner_soid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgSOIDOwner>(GetArenaForAllocation());
+    _impl_.owner_soid_ = p;
+  }
+  return _impl_.owner_soid_;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscribedUpToDate::mutable_owner_soid() {
+  ::CMsgSOIDOwner* _msg = _internal_mutable_owner_soid();
+  // @@protoc_insertion_point(field_mutable:CMsgSOCacheSubscribedUpToDate.owner_soid)
+  return _msg;
+}
+inline void CMsgSOCacheSubscribedUpToDate::set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.owner_soid_;
+  }
+  if (owner_soid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(owner_soid);
+    if (message_arena != submessage_arena) {
+      owner_soid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, owner_soid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.owner_soid_ = owner_soid;
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOCacheSubscribedUpToDate.owner_soid)
+}
+
+// optional uint32 service_id = 3;
+inline bool CMsgSOCacheSubscribedUpToDate::_internal_has_service_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscribedUpToDate::has_service_id() const {
+  return _internal_has_service_id();
+}
+inline void CMsgSOCacheSubscribedUpToDate::clear_service_id() {
+  _impl_.service_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CMsgSOCacheSubscribedUpToDate::_internal_service_id() const {
+  return _impl_.service_id_;
+}
+inline uint32_t CMsgSOCacheSubscribedUpToDate::service_id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribedUpToDate.service_id)
+  return _internal_service_id();
+}
+inline void CMsgSOCacheSubscribedUpToDate::_internal_set_service_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.service_id_ = value;
+}
+inline void CMsgSOCacheSubscribedUpToDate::set_service_id(uint32_t value) {
+  _internal_set_service_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribedUpToDate.service_id)
+}
+
+// repeated uint32 service_list = 4;
+inline int CMsgSOCacheSubscribedUpToDate::_internal_service_list_size() const {
+  return _impl_.service_list_.size();
+}
+inline int CMsgSOCacheSubscribedUpToDate::service_list_size() const {
+  return _internal_service_list_size();
+}
+inline void CMsgSOCacheSubscribedUpToDate::clear_service_list() {
+  _impl_.service_list_.Clear();
+}
+inline uint32_t CMsgSOCacheSubscribedUpToDate::_internal_service_list(int index) const {
+  return _impl_.service_list_.Get(index);
+}
+inline uint32_t CMsgSOCacheSubscribedUpToDate::service_list(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribedUpToDate.service_list)
+  return _internal_service_list(index);
+}
+inline void CMsgSOCacheSubscribedUpToDate::set_service_list(int index, uint32_t value) {
+  _impl_.service_list_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribedUpToDate.service_list)
+}
+inline void CMsgSOCacheSubscribedUpToDate::_internal_add_service_list(uint32_t value) {
+  _impl_.service_list_.Add(value);
+}
+inline void CMsgSOCacheSubscribedUpToDate::add_service_list(uint32_t value) {
+  _internal_add_service_list(value);
+  // @@protoc_insertion_point(field_add:CMsgSOCacheSubscribedUpToDate.service_list)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CMsgSOCacheSubscribedUpToDate::_internal_service_list() const {
+  return _impl_.service_list_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CMsgSOCacheSubscribedUpToDate::service_list() const {
+  // @@protoc_insertion_point(field_list:CMsgSOCacheSubscribedUpToDate.service_list)
+  return _internal_service_list();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CMsgSOCacheSubscribedUpToDate::_internal_mutable_service_list() {
+  return &_impl_.service_list_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CMsgSOCacheSubscribedUpToDate::mutable_service_list() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgSOCacheSubscribedUpToDate.service_list)
+  return _internal_mutable_service_list();
+}
+
+// optional fixed64 sync_version = 5;
+inline bool CMsgSOCacheSubscribedUpToDate::_internal_has_sync_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscribedUpToDate::has_sync_version() const {
+  return _internal_has_sync_version();
+}
+inline void CMsgSOCacheSubscribedUpToDate::clear_sync_version() {
+  _impl_.sync_version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t CMsgSOCacheSubscribedUpToDate::_internal_sync_version() const {
+  return _impl_.sync_version_;
+}
+inline uint64_t CMsgSOCacheSubscribedUpToDate::sync_version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscribedUpToDate.sync_version)
+  return _internal_sync_version();
+}
+inline void CMsgSOCacheSubscribedUpToDate::_internal_set_sync_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sync_version_ = value;
+}
+inline void CMsgSOCacheSubscribedUpToDate::set_sync_version(uint64_t value) {
+  _internal_set_sync_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscribedUpToDate.sync_version)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOCacheUnsubscribed
+
+// optional .CMsgSOIDOwner owner_soid = 2;
+inline bool CMsgSOCacheUnsubscribed::_internal_has_owner_soid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.owner_soid_ != nullptr);
+  return value;
+}
+inline bool CMsgSOCacheUnsubscribed::has_owner_soid() const {
+  return _internal_has_owner_soid();
+}
+inline void CMsgSOCacheUnsubscribed::clear_owner_soid() {
+  if (_impl_.owner_soid_ != nullptr) _impl_.owner_soid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheUnsubscribed::_internal_owner_soid() const {
+  const ::CMsgSOIDOwner* p = _impl_.owner_soid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgSOIDOwner&>(
+      ::_CMsgSOIDOwner_default_instance_);
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheUnsubscribed::owner_soid() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheUnsubscribed.owner_soid)
+  return _internal_owner_soid();
+}
+inline void CMsgSOCacheUnsubscribed::unsafe_arena_set_allocated_owner_soid(
+    ::CMsgSOIDOwner* owner_soid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.owner_soid_);
+  }
+  _impl_.owner_soid_ = owner_soid;
+  if (owner_soid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMsgSOCacheUnsubscribed.owner_soid)
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheUnsubscribed::release_owner_soid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheUnsubscribed::unsafe_arena_release_owner_soid() {
+  // @@protoc_insertion_point(field_release:CMsgSOCacheUnsubscribed.owner_soid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheUnsubscribed::_internal_mutable_owner_soid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.owner_soid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgSOIDOwner>(GetArenaForAllocation());
+    _impl_.owner_soid_ = p;
+  }
+  return _impl_.owner_soid_;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheUnsubscribed::mutable_owner_soid() {
+  ::CMsgSOIDOwner* _msg = _internal_mutable_owner_soid();
+  // @@protoc_insertion_point(field_mutable:CMsgSOCacheUnsubscribed.owner_soid)
+  return _msg;
+}
+inline void CMsgSOCacheUnsubscribed::set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.owner_soid_;
+  }
+  if (owner_soid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(owner_soid);
+    if (message_arena != submessage_arena) {
+      owner_soid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, owner_soid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.owner_soid_ = owner_soid;
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOCacheUnsubscribed.owner_soid)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOCacheSubscriptionCheck
+
+// optional fixed64 version = 2;
+inline bool CMsgSOCacheSubscriptionCheck::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscriptionCheck::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgSOCacheSubscriptionCheck::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CMsgSOCacheSubscriptionCheck::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CMsgSOCacheSubscriptionCheck::version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscriptionCheck.version)
+  return _internal_version();
+}
+inline void CMsgSOCacheSubscriptionCheck::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
+}
+inline void CMsgSOCacheSubscriptionCheck::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscriptionCheck.version)
+}
+
+// optional .CMsgSOIDOwner owner_soid = 3;
+inline bool CMsgSOCacheSubscriptionCheck::_internal_has_owner_soid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.owner_soid_ != nullptr);
+  return value;
+}
+inline bool CMsgSOCacheSubscriptionCheck::has_owner_soid() const {
+  return _internal_has_owner_soid();
+}
+inline void CMsgSOCacheSubscriptionCheck::clear_owner_soid() {
+  if (_impl_.owner_soid_ != nullptr) _impl_.owner_soid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheSubscriptionCheck::_internal_owner_soid() const {
+  const ::CMsgSOIDOwner* p = _impl_.owner_soid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgSOIDOwner&>(
+      ::_CMsgSOIDOwner_default_instance_);
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheSubscriptionCheck::owner_soid() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscriptionCheck.owner_soid)
+  return _internal_owner_soid();
+}
+inline void CMsgSOCacheSubscriptionCheck::unsafe_arena_set_allocated_owner_soid(
+    ::CMsgSOIDOwner* owner_soid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.owner_soid_);
+  }
+  _impl_.owner_soid_ = owner_soid;
+  if (owner_soid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMsgSOCacheSubscriptionCheck.owner_soid)
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscriptionCheck::release_owner_soid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscriptionCheck::unsafe_arena_release_owner_soid() {
+  // @@protoc_insertion_point(field_release:CMsgSOCacheSubscriptionCheck.owner_soid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscriptionCheck::_internal_mutable_owner_soid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.owner_soid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgSOIDOwner>(GetArenaForAllocation());
+    _impl_.owner_soid_ = p;
+  }
+  return _impl_.owner_soid_;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscriptionCheck::mutable_owner_soid() {
+  ::CMsgSOIDOwner* _msg = _internal_mutable_owner_soid();
+  // @@protoc_insertion_point(field_mutable:CMsgSOCacheSubscriptionCheck.owner_soid)
+  return _msg;
+}
+inline void CMsgSOCacheSubscriptionCheck::set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.owner_soid_;
+  }
+  if (owner_soid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(owner_soid);
+    if (message_arena != submessage_arena) {
+      owner_soid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, owner_soid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.owner_soid_ = owner_soid;
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOCacheSubscriptionCheck.owner_soid)
+}
+
+// optional uint32 service_id = 4;
+inline bool CMsgSOCacheSubscriptionCheck::_internal_has_service_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscriptionCheck::has_service_id() const {
+  return _internal_has_service_id();
+}
+inline void CMsgSOCacheSubscriptionCheck::clear_service_id() {
+  _impl_.service_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CMsgSOCacheSubscriptionCheck::_internal_service_id() const {
+  return _impl_.service_id_;
+}
+inline uint32_t CMsgSOCacheSubscriptionCheck::service_id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscriptionCheck.service_id)
+  return _internal_service_id();
+}
+inline void CMsgSOCacheSubscriptionCheck::_internal_set_service_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.service_id_ = value;
+}
+inline void CMsgSOCacheSubscriptionCheck::set_service_id(uint32_t value) {
+  _internal_set_service_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscriptionCheck.service_id)
+}
+
+// repeated uint32 service_list = 5;
+inline int CMsgSOCacheSubscriptionCheck::_internal_service_list_size() const {
+  return _impl_.service_list_.size();
+}
+inline int CMsgSOCacheSubscriptionCheck::service_list_size() const {
+  return _internal_service_list_size();
+}
+inline void CMsgSOCacheSubscriptionCheck::clear_service_list() {
+  _impl_.service_list_.Clear();
+}
+inline uint32_t CMsgSOCacheSubscriptionCheck::_internal_service_list(int index) const {
+  return _impl_.service_list_.Get(index);
+}
+inline uint32_t CMsgSOCacheSubscriptionCheck::service_list(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscriptionCheck.service_list)
+  return _internal_service_list(index);
+}
+inline void CMsgSOCacheSubscriptionCheck::set_service_list(int index, uint32_t value) {
+  _impl_.service_list_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscriptionCheck.service_list)
+}
+inline void CMsgSOCacheSubscriptionCheck::_internal_add_service_list(uint32_t value) {
+  _impl_.service_list_.Add(value);
+}
+inline void CMsgSOCacheSubscriptionCheck::add_service_list(uint32_t value) {
+  _internal_add_service_list(value);
+  // @@protoc_insertion_point(field_add:CMsgSOCacheSubscriptionCheck.service_list)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CMsgSOCacheSubscriptionCheck::_internal_service_list() const {
+  return _impl_.service_list_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CMsgSOCacheSubscriptionCheck::service_list() const {
+  // @@protoc_insertion_point(field_list:CMsgSOCacheSubscriptionCheck.service_list)
+  return _internal_service_list();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CMsgSOCacheSubscriptionCheck::_internal_mutable_service_list() {
+  return &_impl_.service_list_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CMsgSOCacheSubscriptionCheck::mutable_service_list() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgSOCacheSubscriptionCheck.service_list)
+  return _internal_mutable_service_list();
+}
+
+// optional fixed64 sync_version = 6;
+inline bool CMsgSOCacheSubscriptionCheck::_internal_has_sync_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheSubscriptionCheck::has_sync_version() const {
+  return _internal_has_sync_version();
+}
+inline void CMsgSOCacheSubscriptionCheck::clear_sync_version() {
+  _impl_.sync_version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t CMsgSOCacheSubscriptionCheck::_internal_sync_version() const {
+  return _impl_.sync_version_;
+}
+inline uint64_t CMsgSOCacheSubscriptionCheck::sync_version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscriptionCheck.sync_version)
+  return _internal_sync_version();
+}
+inline void CMsgSOCacheSubscriptionCheck::_internal_set_sync_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sync_version_ = value;
+}
+inline void CMsgSOCacheSubscriptionCheck::set_sync_version(uint64_t value) {
+  _internal_set_sync_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheSubscriptionCheck.sync_version)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOCacheSubscriptionRefresh
+
+// optional .CMsgSOIDOwner owner_soid = 2;
+inline bool CMsgSOCacheSubscriptionRefresh::_internal_has_owner_soid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.owner_soid_ != nullptr);
+  return value;
+}
+inline bool CMsgSOCacheSubscriptionRefresh::has_owner_soid() const {
+  return _internal_has_owner_soid();
+}
+inline void CMsgSOCacheSubscriptionRefresh::clear_owner_soid() {
+  if (_impl_.owner_soid_ != nullptr) _impl_.owner_soid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheSubscriptionRefresh::_internal_owner_soid() const {
+  const ::CMsgSOIDOwner* p = _impl_.owner_soid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgSOIDOwner&>(
+      ::_CMsgSOIDOwner_default_instance_);
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheSubscriptionRefresh::owner_soid() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheSubscriptionRefresh.owner_soid)
+  return _internal_owner_soid();
+}
+inline void CMsgSOCacheSubscriptionRefresh::unsafe_arena_set_allocated_owner_soid(
+    ::CMsgSOIDOwner* owner_soid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.owner_soid_);
+  }
+  _impl_.owner_soid_ = owner_soid;
+  if (owner_soid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMsgSOCacheSubscriptionRefresh.owner_soid)
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscriptionRefresh::release_owner_soid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscriptionRefresh::unsafe_arena_release_owner_soid() {
+  // @@protoc_insertion_point(field_release:CMsgSOCacheSubscriptionRefresh.owner_soid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.owner_soid_;
+  _impl_.owner_soid_ = nullptr;
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscriptionRefresh::_internal_mutable_owner_soid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.owner_soid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgSOIDOwner>(GetArenaForAllocation());
+    _impl_.owner_soid_ = p;
+  }
+  return _impl_.owner_soid_;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheSubscriptionRefresh::mutable_owner_soid() {
+  ::CMsgSOIDOwner* _msg = _internal_mutable_owner_soid();
+  // @@protoc_insertion_point(field_mutable:CMsgSOCacheSubscriptionRefresh.owner_soid)
+  return _msg;
+}
+inline void CMsgSOCacheSubscriptionRefresh::set_allocated_owner_soid(::CMsgSOIDOwner* owner_soid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.owner_soid_;
+  }
+  if (owner_soid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(owner_soid);
+    if (message_arena != submessage_arena) {
+      owner_soid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, owner_soid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.owner_soid_ = owner_soid;
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOCacheSubscriptionRefresh.owner_soid)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOCacheVersion
+
+// optional fixed64 version = 1;
+inline bool CMsgSOCacheVersion::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheVersion::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgSOCacheVersion::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CMsgSOCacheVersion::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CMsgSOCacheVersion::version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheVersion.version)
+  return _internal_version();
+}
+inline void CMsgSOCacheVersion::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_ = value;
+}
+inline void CMsgSOCacheVersion::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheVersion.version)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCMultiplexMessage
+
+// optional uint32 msgtype = 1;
+inline bool CMsgGCMultiplexMessage::_internal_has_msgtype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgGCMultiplexMessage::has_msgtype() const {
+  return _internal_has_msgtype();
+}
+inline void CMsgGCMultiplexMessage::clear_msgtype() {
+  _impl_.msgtype_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CMsgGCMultiplexMessage::_internal_msgtype() const {
+  return _impl_.msgtype_;
+}
+inline uint32_t CMsgGCMultiplexMessage::msgtype() const {
+  // @@protoc_insertion_point(field_get:CMsgGCMultiplexMessage.msgtype)
+  return _internal_msgtype();
+}
+inline void CMsgGCMultiplexMessage::_internal_set_msgtype(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.msgtype_ = value;
+}
+inline void CMsgGCMultiplexMessage::set_msgtype(uint32_t value) {
+  _internal_set_msgtype(value);
+  // @@protoc_insertion_point(field_set:CMsgGCMultiplexMessage.msgtype)
+}
+
+// optional bytes payload = 2;
+inline bool CMsgGCMultiplexMessage::_internal_has_payload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgGCMultiplexMessage::has_payload() const {
+  return _internal_has_payload();
+}
+inline void CMsgGCMultiplexMessage::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CMsgGCMultiplexMessage::payload() const {
+  // @@protoc_insertion_point(field_get:CMsgGCMultiplexMessage.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CMsgGCMultiplexMessage::set_payload(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CMsgGCMultiplexMessage.payload)
+}
+inline std::string* CMsgGCMultiplexMessage::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:CMsgGCMultiplexMessage.payload)
+  return _s;
+}
+inline const std::string& CMsgGCMultiplexMessage::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void CMsgGCMultiplexMessage::_internal_set_payload(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CMsgGCMultiplexMessage::_internal_mutable_payload() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CMsgGCMultiplexMessage::release_payload() {
+  // @@protoc_insertion_point(field_release:CMsgGCMultiplexMessage.payload)
+  if (!_internal_has_payload()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.payload_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CMsgGCMultiplexMessage::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CMsgGCMultiplexMessage.payload)
+}
+
+// repeated fixed64 steamids = 3;
+inline int CMsgGCMultiplexMessage::_internal_steamids_size() const {
+  return _impl_.steamids_.size();
+}
+inline int CMsgGCMultiplexMessage::steamids_size() const {
+  return _internal_steamids_size();
+}
+inline void CMsgGCMultiplexMessage::clear_steamids() {
+  _impl_.steamids_.Clear();
+}
+inline uint64_t CMsgGCMultiplexMessage::_internal_steamids(int index) const {
+  return _impl_.steamids_.Get(index);
+}
+inline uint64_t CMsgGCMultiplexMessage::steamids(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgGCMultiplexMessage.steamids)
+  return _internal_steamids(index);
+}
+inline void CMsgGCMultiplexMessage::set_steamids(int index, uint64_t value) {
+  _impl_.steamids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CMsgGCMultiplexMessage.steamids)
+}
+inline void CMsgGCMultiplexMessage::_internal_add_steamids(uint64_t value) {
+  _impl_.steamids_.Add(value);
+}
+inline void CMsgGCMultiplexMessage::add_steamids(uint64_t value) {
+  _internal_add_steamids(value);
+  // @@protoc_insertion_point(field_add:CMsgGCMultiplexMessage.steamids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CMsgGCMultiplexMessage::_internal_steamids() const {
+  return _impl_.steamids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CMsgGCMultiplexMessage::steamids() const {
+  // @@protoc_insertion_point(field_list:CMsgGCMultiplexMessage.steamids)
+  return _internal_steamids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CMsgGCMultiplexMessage::_internal_mutable_steamids() {
+  return &_impl_.steamids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CMsgGCMultiplexMessage::mutable_steamids() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgGCMultiplexMessage.steamids)
+  return _internal_mutable_steamids();
+}
+
+// -------------------------------------------------------------------
+
+// CGCToGCMsgMasterAck_Process
+
+// optional uint32 dir_index = 1;
+inline bool CGCToGCMsgMasterAck_Process::_internal_has_dir_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgMasterAck_Process::has_dir_index() const {
+  return _internal_has_dir_index();
+}
+inline void CGCToGCMsgMasterAck_Process::clear_dir_index() {
+  _impl_.dir_index_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CGCToGCMsgMasterAck_Process::_internal_dir_index() const {
+  return _impl_.dir_index_;
+}
+inline uint32_t CGCToGCMsgMasterAck_Process::dir_index() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterAck.Process.dir_index)
+  return _internal_dir_index();
+}
+inline void CGCToGCMsgMasterAck_Process::_internal_set_dir_index(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.dir_index_ = value;
+}
+inline void CGCToGCMsgMasterAck_Process::set_dir_index(uint32_t value) {
+  _internal_set_dir_index(value);
+  // @@protoc_insertion_point(field_set:CGCToGCMsgMasterAck.Process.dir_index)
+}
+
+// repeated uint32 type_instances = 2;
+inline int CGCToGCMsgMasterAck_Process::_internal_type_instances_size() const {
+  return _impl_.type_instances_.size();
+}
+inline int CGCToGCMsgMasterAck_Process::type_instances_size() const {
+  return _internal_type_instances_size();
+}
+inline void CGCToGCMsgMasterAck_Process::clear_type_instances() {
+  _impl_.type_instances_.Clear();
+}
+inline uint32_t CGCToGCMsgMasterAck_Process::_internal_type_instances(int index) const {
+  return _impl_.type_instances_.Get(index);
+}
+inline uint32_t CGCToGCMsgMasterAck_Process::type_instances(int index) const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterAck.Process.type_instances)
+  return _internal_type_instances(index);
+}
+inline void CGCToGCMsgMasterAck_Process::set_type_instances(int index, uint32_t value) {
+  _impl_.type_instances_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CGCToGCMsgMasterAck.Process.type_instances)
+}
+inline void CGCToGCMsgMasterAck_Process::_internal_add_type_instances(uint32_t value) {
+  _impl_.type_instances_.Add(value);
+}
+inline void CGCToGCMsgMasterAck_Process::add_type_instances(uint32_t value) {
+  _internal_add_type_instances(value);
+  // @@protoc_insertion_point(field_add:CGCToGCMsgMasterAck.Process.type_instances)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CGCToGCMsgMasterAck_Process::_internal_type_instances() const {
+  return _impl_.type_instances_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CGCToGCMsgMasterAck_Process::type_instances() const {
+  // @@protoc_insertion_point(field_list:CGCToGCMsgMasterAck.Process.type_instances)
+  return _internal_type_instances();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CGCToGCMsgMasterAck_Process::_internal_mutable_type_instances() {
+  return &_impl_.type_instances_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CGCToGCMsgMasterAck_Process::mutable_type_instances() {
+  // @@protoc_insertion_point(field_mutable_list:CGCToGCMsgMasterAck.Process.type_instances)
+  return _internal_mutable_type_instances();
+}
+
+// -------------------------------------------------------------------
+
+// CGCToGCMsgMasterAck
+
+// optional uint32 dir_index = 1;
+inline bool CGCToGCMsgMasterAck::_internal_has_dir_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgMasterAck::has_dir_index() const {
+  return _internal_has_dir_index();
+}
+inline void CGCToGCMsgMasterAck::clear_dir_index() {
+  _impl_.dir_index_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CGCToGCMsgMasterAck::_internal_dir_index() const {
+  return _impl_.dir_index_;
+}
+inline uint32_t CGCToGCMsgMasterAck::dir_index() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterAck.dir_index)
+  return _internal_dir_index();
+}
+inline void CGCToGCMsgMasterAck::_internal_set_dir_index(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.dir_index_ = value;
+}
+inline void CGCToGCMsgMasterAck::set_dir_index(uint32_t value) {
+  _internal_set_dir_index(value);
+  // @@protoc_insertion_point(field_set:CGCToGCMsgMasterAck.dir_index)
+}
+
+// optional string machine_name = 3;
+inline bool CGCToGCMsgMasterAck::_internal_has_machine_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgMasterAck::has_machine_name() const {
+  return _internal_has_machine_name();
+}
+inline void CGCToGCMsgMasterAck::clear_machine_name() {
+  _impl_.machine_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CGCToGCMsgMasterAck::machine_name() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterAck.machine_name)
+  return _internal_machine_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CGCToGCMsgMasterAck::set_machine_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.machine_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CGCToGCMsgMasterAck.machine_name)
+}
+inline std::string* CGCToGCMsgMasterAck::mutable_machine_name() {
+  std::string* _s = _internal_mutable_machine_name();
+  // @@protoc_insertion_point(field_mutable:CGCToGCMsgMasterAck.machine_name)
+  return _s;
+}
+inline const std::string& CGCToGCMsgMasterAck::_internal_machine_name() const {
+  return _impl_.machine_name_.Get();
+}
+inline void CGCToGCMsgMasterAck::_internal_set_machine_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.machine_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgMasterAck::_internal_mutable_machine_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.machine_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgMasterAck::release_machine_name() {
+  // @@protoc_insertion_point(field_release:CGCToGCMsgMasterAck.machine_name)
+  if (!_internal_has_machine_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.machine_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CGCToGCMsgMasterAck::set_allocated_machine_name(std::string* machine_name) {
+  if (machine_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.machine_name_.SetAllocated(machine_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CGCToGCMsgMasterAck.machine_name)
+}
+
+// optional string process_name = 4;
+inline bool CGCToGCMsgMasterAck::_internal_has_process_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgMasterAck::has_process_name() const {
+  return _internal_has_process_name();
+}
+inline void CGCToGCMsgMasterAck::clear_process_name() {
+  _impl_.process_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CGCToGCMsgMasterAck::process_name() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterAck.process_name)
+  return _internal_process_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CGCToGCMsgMasterAck::set_process_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.process_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CGCToGCMsgMasterAck.process_name)
+}
+inline std::string* CGCToGCMsgMasterAck::mutable_process_name() {
+  std::string* _s = _internal_mutable_process_name();
+  // @@protoc_insertion_point(field_mutable:CGCToGCMsgMasterAck.process_name)
+  return _s;
+}
+inline const std::string& CGCToGCMsgMasterAck::_internal_process_name() const {
+  return _impl_.process_name_.Get();
+}
+inline void CGCToGCMsgMasterAck::_internal_set_process_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.process_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgMasterAck::_internal_mutable_process_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.process_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgMasterAck::release_process_name() {
+  // @@protoc_insertion_point(field_release:CGCToGCMsgMasterAck.process_name)
+  if (!_internal_has_process_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.process_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.process_name_.IsDefault()) {
+    _impl_.process_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CGCToGCMsgMasterAck::set_allocated_process_name(std::string* process_name) {
+  if (process_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.process_name_.SetAllocated(process_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.process_name_.IsDefault()) {
+    _impl_.process_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CGCToGCMsgMasterAck.process_name)
+}
+
+// repeated .CGCToGCMsgMasterAck.Process directory = 6;
+inline int CGCToGCMsgMasterAck::_internal_directory_size() const {
+  return _impl_.directory_.size();
+}
+inline int CGCToGCMsgMasterAck::directory_size() const {
+  return _internal_directory_size();
+}
+inline void CGCToGCMsgMasterAck::clear_directory() {
+  _impl_.directory_.Clear();
+}
+inline ::CGCToGCMsgMasterAck_Process* CGCToGCMsgMasterAck::mutable_directory(int index) {
+  // @@protoc_insertion_point(field_mutable:CGCToGCMsgMasterAck.directory)
+  return _impl_.directory_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterAck_Process >*
+CGCToGCMsgMasterAck::mutable_directory() {
+  // @@protoc_insertion_point(field_mutable_list:CGCToGCMsgMasterAck.directory)
+  return &_impl_.directory_;
+}
+inline const ::CGCToGCMsgMasterAck_Process& CGCToGCMsgMasterAck::_internal_directory(int index) const {
+  return _impl_.directory_.Get(index);
+}
+inline const ::CGCToGCMsgMasterAck_Process& CGCToGCMsgMasterAck::directory(int index) const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterAck.directory)
+  return _internal_directory(index);
+}
+inline ::CGCToGCMsgMasterAck_Process* CGCToGCMsgMasterAck::_internal_add_directory() {
+  return _impl_.directory_.Add();
+}
+inline ::CGCToGCMsgMasterAck_Process* CGCToGCMsgMasterAck::add_directory() {
+  ::CGCToGCMsgMasterAck_Process* _add = _internal_add_directory();
+  // @@protoc_insertion_point(field_add:CGCToGCMsgMasterAck.directory)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterAck_Process >&
+CGCToGCMsgMasterAck::directory() const {
+  // @@protoc_insertion_point(field_list:CGCToGCMsgMasterAck.directory)
+  return _impl_.directory_;
+}
+
+// -------------------------------------------------------------------
+
+// CGCToGCMsgMasterAck_Response
+
+// optional int32 eresult = 1 [default = 2];
+inline bool CGCToGCMsgMasterAck_Response::_internal_has_eresult() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgMasterAck_Response::has_eresult() const {
+  return _internal_has_eresult();
+}
+inline void CGCToGCMsgMasterAck_Response::clear_eresult() {
+  _impl_.eresult_ = 2;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CGCToGCMsgMasterAck_Response::_internal_eresult() const {
+  return _impl_.eresult_;
+}
+inline int32_t CGCToGCMsgMasterAck_Response::eresult() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterAck_Response.eresult)
+  return _internal_eresult();
+}
+inline void CGCToGCMsgMasterAck_Response::_internal_set_eresult(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.eresult_ = value;
+}
+inline void CGCToGCMsgMasterAck_Response::set_eresult(int32_t value) {
+  _internal_set_eresult(value);
+  // @@protoc_insertion_point(field_set:CGCToGCMsgMasterAck_Response.eresult)
+}
+
+// -------------------------------------------------------------------
+
+// CGCToGCMsgMasterStartupComplete_GCInfo
+
+// optional uint32 dir_index = 1;
+inline bool CGCToGCMsgMasterStartupComplete_GCInfo::_internal_has_dir_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgMasterStartupComplete_GCInfo::has_dir_index() const {
+  return _internal_has_dir_index();
+}
+inline void CGCToGCMsgMasterStartupComplete_GCInfo::clear_dir_index() {
+  _impl_.dir_index_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CGCToGCMsgMasterStartupComplete_GCInfo::_internal_dir_index() const {
+  return _impl_.dir_index_;
+}
+inline uint32_t CGCToGCMsgMasterStartupComplete_GCInfo::dir_index() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterStartupComplete.GCInfo.dir_index)
+  return _internal_dir_index();
+}
+inline void CGCToGCMsgMasterStartupComplete_GCInfo::_internal_set_dir_index(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.dir_index_ = value;
+}
+inline void CGCToGCMsgMasterStartupComplete_GCInfo::set_dir_index(uint32_t value) {
+  _internal_set_dir_index(value);
+  // @@protoc_insertion_point(field_set:CGCToGCMsgMasterStartupComplete.GCInfo.dir_index)
+}
+
+// optional string machine_name = 2;
+inline bool CGCToGCMsgMasterStartupComplete_GCInfo::_internal_has_machine_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgMasterStartupComplete_GCInfo::has_machine_name() const {
+  return _internal_has_machine_name();
+}
+inline void CGCToGCMsgMasterStartupComplete_GCInfo::clear_machine_name() {
+  _impl_.machine_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CGCToGCMsgMasterStartupComplete_GCInfo::machine_name() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterStartupComplete.GCInfo.machine_name)
+  return _internal_machine_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CGCToGCMsgMasterStartupComplete_GCInfo::set_machine_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.machine_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CGCToGCMsgMasterStartupComplete.GCInfo.machine_name)
+}
+inline std::string* CGCToGCMsgMasterStartupComplete_GCInfo::mutable_machine_name() {
+  std::string* _s = _internal_mutable_machine_name();
+  // @@protoc_insertion_point(field_mutable:CGCToGCMsgMasterStartupComplete.GCInfo.machine_name)
+  return _s;
+}
+inline const std::string& CGCToGCMsgMasterStartupComplete_GCInfo::_internal_machine_name() const {
+  return _impl_.machine_name_.Get();
+}
+inline void CGCToGCMsgMasterStartupComplete_GCInfo::_internal_set_machine_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.machine_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgMasterStartupComplete_GCInfo::_internal_mutable_machine_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.machine_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgMasterStartupComplete_GCInfo::release_machine_name() {
+  // @@protoc_insertion_point(field_release:CGCToGCMsgMasterStartupComplete.GCInfo.machine_name)
+  if (!_internal_has_machine_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.machine_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CGCToGCMsgMasterStartupComplete_GCInfo::set_allocated_machine_name(std::string* machine_name) {
+  if (machine_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.machine_name_.SetAllocated(machine_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.machine_name_.IsDefault()) {
+    _impl_.machine_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CGCToGCMsgMasterStartupComplete.GCInfo.machine_name)
+}
+
+// -------------------------------------------------------------------
+
+// CGCToGCMsgMasterStartupComplete
+
+// repeated .CGCToGCMsgMasterStartupComplete.GCInfo gc_info = 1;
+inline int CGCToGCMsgMasterStartupComplete::_internal_gc_info_size() const {
+  return _impl_.gc_info_.size();
+}
+inline int CGCToGCMsgMasterStartupComplete::gc_info_size() const {
+  return _internal_gc_info_size();
+}
+inline void CGCToGCMsgMasterStartupComplete::clear_gc_info() {
+  _impl_.gc_info_.Clear();
+}
+inline ::CGCToGCMsgMasterStartupComplete_GCInfo* CGCToGCMsgMasterStartupComplete::mutable_gc_info(int index) {
+  // @@protoc_insertion_point(field_mutable:CGCToGCMsgMasterStartupComplete.gc_info)
+  return _impl_.gc_info_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterStartupComplete_GCInfo >*
+CGCToGCMsgMasterStartupComplete::mutable_gc_info() {
+  // @@protoc_insertion_point(field_mutable_list:CGCToGCMsgMasterStartupComplete.gc_info)
+  return &_impl_.gc_info_;
+}
+inline const ::CGCToGCMsgMasterStartupComplete_GCInfo& CGCToGCMsgMasterStartupComplete::_internal_gc_info(int index) const {
+  return _impl_.gc_info_.Get(index);
+}
+inline const ::CGCToGCMsgMasterStartupComplete_GCInfo& CGCToGCMsgMasterStartupComplete::gc_info(int index) const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgMasterStartupComplete.gc_info)
+  return _internal_gc_info(index);
+}
+inline ::CGCToGCMsgMasterStartupComplete_GCInfo* CGCToGCMsgMasterStartupComplete::_internal_add_gc_info() {
+  return _impl_.gc_info_.Add();
+}
+inline ::CGCToGCMsgMasterStartupComplete_GCInfo* CGCToGCMsgMasterStartupComplete::add_gc_info() {
+  ::CGCToGCMsgMasterStartupComplete_GCInfo* _add = _internal_add_gc_info();
+  // @@protoc_insertion_point(field_add:CGCToGCMsgMasterStartupComplete.gc_info)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CGCToGCMsgMasterStartupComplete_GCInfo >&
+CGCToGCMsgMasterStartupComplete::gc_info() const {
+  // @@protoc_insertion_point(field_list:CGCToGCMsgMasterStartupComplete.gc_info)
+  return _impl_.gc_info_;
+}
+
+// -------------------------------------------------------------------
+
+// CGCToGCMsgRouted
+
+// optional uint32 msg_type = 1;
+inline bool CGCToGCMsgRouted::_internal_has_msg_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgRouted::has_msg_type() const {
+  return _internal_has_msg_type();
+}
+inline void CGCToGCMsgRouted::clear_msg_type() {
+  _impl_.msg_type_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CGCToGCMsgRouted::_internal_msg_type() const {
+  return _impl_.msg_type_;
+}
+inline uint32_t CGCToGCMsgRouted::msg_type() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgRouted.msg_type)
+  return _internal_msg_type();
+}
+inline void CGCToGCMsgRouted::_internal_set_msg_type(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.msg_type_ = value;
+}
+inline void CGCToGCMsgRouted::set_msg_type(uint32_t value) {
+  _internal_set_msg_type(value);
+  // @@protoc_insertion_point(field_set:CGCToGCMsgRouted.msg_type)
+}
+
+// optional fixed64 sender_id = 2;
+inline bool CGCToGCMsgRouted::_internal_has_sender_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgRouted::has_sender_id() const {
+  return _internal_has_sender_id();
+}
+inline void CGCToGCMsgRouted::clear_sender_id() {
+  _impl_.sender_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CGCToGCMsgRouted::_internal_sender_id() const {
+  return _impl_.sender_id_;
+}
+inline uint64_t CGCToGCMsgRouted::sender_id() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgRouted.sender_id)
+  return _internal_sender_id();
+}
+inline void CGCToGCMsgRouted::_internal_set_sender_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sender_id_ = value;
+}
+inline void CGCToGCMsgRouted::set_sender_id(uint64_t value) {
+  _internal_set_sender_id(value);
+  // @@protoc_insertion_point(field_set:CGCToGCMsgRouted.sender_id)
+}
+
+// optional bytes net_message = 3;
+inline bool CGCToGCMsgRouted::_internal_has_net_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgRouted::has_net_message() const {
+  return _internal_has_net_message();
+}
+inline void CGCToGCMsgRouted::clear_net_message() {
+  _impl_.net_message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CGCToGCMsgRouted::net_message() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgRouted.net_message)
+  return _internal_net_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CGCToGCMsgRouted::set_net_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.net_message_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CGCToGCMsgRouted.net_message)
+}
+inline std::string* CGCToGCMsgRouted::mutable_net_message() {
+  std::string* _s = _internal_mutable_net_message();
+  // @@protoc_insertion_point(field_mutable:CGCToGCMsgRouted.net_message)
+  return _s;
+}
+inline const std::string& CGCToGCMsgRouted::_internal_net_message() const {
+  return _impl_.net_message_.Get();
+}
+inline void CGCToGCMsgRouted::_internal_set_net_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.net_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgRouted::_internal_mutable_net_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.net_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgRouted::release_net_message() {
+  // @@protoc_insertion_point(field_release:CGCToGCMsgRouted.net_message)
+  if (!_internal_has_net_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.net_message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.net_message_.IsDefault()) {
+    _impl_.net_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CGCToGCMsgRouted::set_allocated_net_message(std::string* net_message) {
+  if (net_message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.net_message_.SetAllocated(net_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.net_message_.IsDefault()) {
+    _impl_.net_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CGCToGCMsgRouted.net_message)
+}
+
+// -------------------------------------------------------------------
+
+// CGCToGCMsgRoutedReply
+
+// optional uint32 msg_type = 1;
+inline bool CGCToGCMsgRoutedReply::_internal_has_msg_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgRoutedReply::has_msg_type() const {
+  return _internal_has_msg_type();
+}
+inline void CGCToGCMsgRoutedReply::clear_msg_type() {
+  _impl_.msg_type_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CGCToGCMsgRoutedReply::_internal_msg_type() const {
+  return _impl_.msg_type_;
+}
+inline uint32_t CGCToGCMsgRoutedReply::msg_type() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgRoutedReply.msg_type)
+  return _internal_msg_type();
+}
+inline void CGCToGCMsgRoutedReply::_internal_set_msg_type(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.msg_type_ = value;
+}
+inline void CGCToGCMsgRoutedReply::set_msg_type(uint32_t value) {
+  _internal_set_msg_type(value);
+  // @@protoc_insertion_point(field_set:CGCToGCMsgRoutedReply.msg_type)
+}
+
+// optional bytes net_message = 2;
+inline bool CGCToGCMsgRoutedReply::_internal_has_net_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CGCToGCMsgRoutedReply::has_net_message() const {
+  return _internal_has_net_message();
+}
+inline void CGCToGCMsgRoutedReply::clear_net_message() {
+  _impl_.net_message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CGCToGCMsgRoutedReply::net_message() const {
+  // @@protoc_insertion_point(field_get:CGCToGCMsgRoutedReply.net_message)
+  return _internal_net_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CGCToGCMsgRoutedReply::set_net_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.net_message_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CGCToGCMsgRoutedReply.net_message)
+}
+inline std::string* CGCToGCMsgRoutedReply::mutable_net_message() {
+  std::string* _s = _internal_mutable_net_message();
+  // @@protoc_insertion_point(field_mutable:CGCToGCMsgRoutedReply.net_message)
+  return _s;
+}
+inline const std::string& CGCToGCMsgRoutedReply::_internal_net_message() const {
+  return _impl_.net_message_.Get();
+}
+inline void CGCToGCMsgRoutedReply::_internal_set_net_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.net_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgRoutedReply::_internal_mutable_net_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.net_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CGCToGCMsgRoutedReply::release_net_message() {
+  // @@protoc_insertion_point(field_release:CGCToGCMsgRoutedReply.net_message)
+  if (!_internal_has_net_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.net_message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.net_message_.IsDefault()) {
+    _impl_.net_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CGCToGCMsgRoutedReply::set_allocated_net_message(std::string* net_message) {
+  if (net_message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.net_message_.SetAllocated(net_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.net_message_.IsDefault()) {
+    _impl_.net_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CGCToGCMsgRoutedReply.net_message)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCUpdateSubGCSessionInfo_CMsgUpdate
+
+// optional fixed64 steamid = 1;
+inline bool CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_internal_has_steamid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::has_steamid() const {
+  return _internal_has_steamid();
+}
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::clear_steamid() {
+  _impl_.steamid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_internal_steamid() const {
+  return _impl_.steamid_;
+}
+inline uint64_t CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::steamid() const {
+  // @@protoc_insertion_point(field_get:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate.steamid)
+  return _internal_steamid();
+}
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_internal_set_steamid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.steamid_ = value;
+}
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::set_steamid(uint64_t value) {
+  _internal_set_steamid(value);
+  // @@protoc_insertion_point(field_set:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate.steamid)
+}
+
+// optional fixed32 ip = 2;
+inline bool CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::has_ip() const {
+  return _internal_has_ip();
+}
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::clear_ip() {
+  _impl_.ip_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_internal_ip() const {
+  return _impl_.ip_;
+}
+inline uint32_t CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::ip() const {
+  // @@protoc_insertion_point(field_get:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate.ip)
+  return _internal_ip();
+}
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_internal_set_ip(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ip_ = value;
+}
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::set_ip(uint32_t value) {
+  _internal_set_ip(value);
+  // @@protoc_insertion_point(field_set:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate.ip)
+}
+
+// optional bool trusted = 3;
+inline bool CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_internal_has_trusted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::has_trusted() const {
+  return _internal_has_trusted();
+}
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::clear_trusted() {
+  _impl_.trusted_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_internal_trusted() const {
+  return _impl_.trusted_;
+}
+inline bool CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::trusted() const {
+  // @@protoc_insertion_point(field_get:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate.trusted)
+  return _internal_trusted();
+}
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::_internal_set_trusted(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.trusted_ = value;
+}
+inline void CMsgGCUpdateSubGCSessionInfo_CMsgUpdate::set_trusted(bool value) {
+  _internal_set_trusted(value);
+  // @@protoc_insertion_point(field_set:CMsgGCUpdateSubGCSessionInfo.CMsgUpdate.trusted)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCUpdateSubGCSessionInfo
+
+// repeated .CMsgGCUpdateSubGCSessionInfo.CMsgUpdate updates = 1;
+inline int CMsgGCUpdateSubGCSessionInfo::_internal_updates_size() const {
+  return _impl_.updates_.size();
+}
+inline int CMsgGCUpdateSubGCSessionInfo::updates_size() const {
+  return _internal_updates_size();
+}
+inline void CMsgGCUpdateSubGCSessionInfo::clear_updates() {
+  _impl_.updates_.Clear();
+}
+inline ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* CMsgGCUpdateSubGCSessionInfo::mutable_updates(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgGCUpdateSubGCSessionInfo.updates)
+  return _impl_.updates_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate >*
+CMsgGCUpdateSubGCSessionInfo::mutable_updates() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgGCUpdateSubGCSessionInfo.updates)
+  return &_impl_.updates_;
+}
+inline const ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& CMsgGCUpdateSubGCSessionInfo::_internal_updates(int index) const {
+  return _impl_.updates_.Get(index);
+}
+inline const ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate& CMsgGCUpdateSubGCSessionInfo::updates(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgGCUpdateSubGCSessionInfo.updates)
+  return _internal_updates(index);
+}
+inline ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* CMsgGCUpdateSubGCSessionInfo::_internal_add_updates() {
+  return _impl_.updates_.Add();
+}
+inline ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* CMsgGCUpdateSubGCSessionInfo::add_updates() {
+  ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate* _add = _internal_add_updates();
+  // @@protoc_insertion_point(field_add:CMsgGCUpdateSubGCSessionInfo.updates)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCUpdateSubGCSessionInfo_CMsgUpdate >&
+CMsgGCUpdateSubGCSessionInfo::updates() const {
+  // @@protoc_insertion_point(field_list:CMsgGCUpdateSubGCSessionInfo.updates)
+  return _impl_.updates_;
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCRequestSubGCSessionInfo
+
+// optional fixed64 steamid = 1;
+inline bool CMsgGCRequestSubGCSessionInfo::_internal_has_steamid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgGCRequestSubGCSessionInfo::has_steamid() const {
+  return _internal_has_steamid();
+}
+inline void CMsgGCRequestSubGCSessionInfo::clear_steamid() {
+  _impl_.steamid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CMsgGCRequestSubGCSessionInfo::_internal_steamid() const {
+  return _impl_.steamid_;
+}
+inline uint64_t CMsgGCRequestSubGCSessionInfo::steamid() const {
+  // @@protoc_insertion_point(field_get:CMsgGCRequestSubGCSessionInfo.steamid)
+  return _internal_steamid();
+}
+inline void CMsgGCRequestSubGCSessionInfo::_internal_set_steamid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.steamid_ = value;
+}
+inline void CMsgGCRequestSubGCSessionInfo::set_steamid(uint64_t value) {
+  _internal_set_steamid(value);
+  // @@protoc_insertion_point(field_set:CMsgGCRequestSubGCSessionInfo.steamid)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCRequestSubGCSessionInfoResponse
+
+// optional fixed32 ip = 1;
+inline bool CMsgGCRequestSubGCSessionInfoResponse::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgGCRequestSubGCSessionInfoResponse::has_ip() const {
+  return _internal_has_ip();
+}
+inline void CMsgGCRequestSubGCSessionInfoResponse::clear_ip() {
+  _impl_.ip_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CMsgGCRequestSubGCSessionInfoResponse::_internal_ip() const {
+  return _impl_.ip_;
+}
+inline uint32_t CMsgGCRequestSubGCSessionInfoResponse::ip() const {
+  // @@protoc_insertion_point(field_get:CMsgGCRequestSubGCSessionInfoResponse.ip)
+  return _internal_ip();
+}
+inline void CMsgGCRequestSubGCSessionInfoResponse::_internal_set_ip(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ip_ = value;
+}
+inline void CMsgGCRequestSubGCSessionInfoResponse::set_ip(uint32_t value) {
+  _internal_set_ip(value);
+  // @@protoc_insertion_point(field_set:CMsgGCRequestSubGCSessionInfoResponse.ip)
+}
+
+// optional bool trusted = 2;
+inline bool CMsgGCRequestSubGCSessionInfoResponse::_internal_has_trusted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgGCRequestSubGCSessionInfoResponse::has_trusted() const {
+  return _internal_has_trusted();
+}
+inline void CMsgGCRequestSubGCSessionInfoResponse::clear_trusted() {
+  _impl_.trusted_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool CMsgGCRequestSubGCSessionInfoResponse::_internal_trusted() const {
+  return _impl_.trusted_;
+}
+inline bool CMsgGCRequestSubGCSessionInfoResponse::trusted() const {
+  // @@protoc_insertion_point(field_get:CMsgGCRequestSubGCSessionInfoResponse.trusted)
+  return _internal_trusted();
+}
+inline void CMsgGCRequestSubGCSessionInfoResponse::_internal_set_trusted(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.trusted_ = value;
+}
+inline void CMsgGCRequestSubGCSessionInfoResponse::set_trusted(bool value) {
+  _internal_set_trusted(value);
+  // @@protoc_insertion_point(field_set:CMsgGCRequestSubGCSessionInfoResponse.trusted)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgSOCacheHaveVersion
+
+// optional .CMsgSOIDOwner soid = 1;
+inline bool CMsgSOCacheHaveVersion::_internal_has_soid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.soid_ != nullptr);
+  return value;
+}
+inline bool CMsgSOCacheHaveVersion::has_soid() const {
+  return _internal_has_soid();
+}
+inline void CMsgSOCacheHaveVersion::clear_soid() {
+  if (_impl_.soid_ != nullptr) _impl_.soid_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheHaveVersion::_internal_soid() const {
+  const ::CMsgSOIDOwner* p = _impl_.soid_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgSOIDOwner&>(
+      ::_CMsgSOIDOwner_default_instance_);
+}
+inline const ::CMsgSOIDOwner& CMsgSOCacheHaveVersion::soid() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheHaveVersion.soid)
+  return _internal_soid();
+}
+inline void CMsgSOCacheHaveVersion::unsafe_arena_set_allocated_soid(
+    ::CMsgSOIDOwner* soid) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.soid_);
+  }
+  _impl_.soid_ = soid;
+  if (soid) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMsgSOCacheHaveVersion.soid)
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheHaveVersion::release_soid() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.soid_;
+  _impl_.soid_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheHaveVersion::unsafe_arena_release_soid() {
+  // @@protoc_insertion_point(field_release:CMsgSOCacheHaveVersion.soid)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgSOIDOwner* temp = _impl_.soid_;
+  _impl_.soid_ = nullptr;
+  return temp;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheHaveVersion::_internal_mutable_soid() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.soid_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgSOIDOwner>(GetArenaForAllocation());
+    _impl_.soid_ = p;
+  }
+  return _impl_.soid_;
+}
+inline ::CMsgSOIDOwner* CMsgSOCacheHaveVersion::mutable_soid() {
+  ::CMsgSOIDOwner* _msg = _internal_mutable_soid();
+  // @@protoc_insertion_point(field_mutable:CMsgSOCacheHaveVersion.soid)
+  return _msg;
+}
+inline void CMsgSOCacheHaveVersion::set_allocated_soid(::CMsgSOIDOwner* soid) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.soid_;
+  }
+  if (soid) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(soid);
+    if (message_arena != submessage_arena) {
+      soid = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, soid, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.soid_ = soid;
+  // @@protoc_insertion_point(field_set_allocated:CMsgSOCacheHaveVersion.soid)
+}
+
+// optional fixed64 version = 2;
+inline bool CMsgSOCacheHaveVersion::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheHaveVersion::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgSOCacheHaveVersion::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CMsgSOCacheHaveVersion::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CMsgSOCacheHaveVersion::version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheHaveVersion.version)
+  return _internal_version();
+}
+inline void CMsgSOCacheHaveVersion::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
+}
+inline void CMsgSOCacheHaveVersion::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheHaveVersion.version)
+}
+
+// optional uint32 service_id = 3;
+inline bool CMsgSOCacheHaveVersion::_internal_has_service_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheHaveVersion::has_service_id() const {
+  return _internal_has_service_id();
+}
+inline void CMsgSOCacheHaveVersion::clear_service_id() {
+  _impl_.service_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CMsgSOCacheHaveVersion::_internal_service_id() const {
+  return _impl_.service_id_;
+}
+inline uint32_t CMsgSOCacheHaveVersion::service_id() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheHaveVersion.service_id)
+  return _internal_service_id();
+}
+inline void CMsgSOCacheHaveVersion::_internal_set_service_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.service_id_ = value;
+}
+inline void CMsgSOCacheHaveVersion::set_service_id(uint32_t value) {
+  _internal_set_service_id(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheHaveVersion.service_id)
+}
+
+// optional uint32 cached_file_version = 4;
+inline bool CMsgSOCacheHaveVersion::_internal_has_cached_file_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CMsgSOCacheHaveVersion::has_cached_file_version() const {
+  return _internal_has_cached_file_version();
+}
+inline void CMsgSOCacheHaveVersion::clear_cached_file_version() {
+  _impl_.cached_file_version_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CMsgSOCacheHaveVersion::_internal_cached_file_version() const {
+  return _impl_.cached_file_version_;
+}
+inline uint32_t CMsgSOCacheHaveVersion::cached_file_version() const {
+  // @@protoc_insertion_point(field_get:CMsgSOCacheHaveVersion.cached_file_version)
+  return _internal_cached_file_version();
+}
+inline void CMsgSOCacheHaveVersion::_internal_set_cached_file_version(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.cached_file_version_ = value;
+}
+inline void CMsgSOCacheHaveVersion::set_cached_file_version(uint32_t value) {
+  _internal_set_cached_file_version(value);
+  // @@protoc_insertion_point(field_set:CMsgSOCacheHaveVersion.cached_file_version)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgClientHello
+
+// optional uint32 version = 1;
+inline bool CMsgClientHello::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgClientHello::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgClientHello::clear_version() {
+  _impl_.version_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CMsgClientHello::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint32_t CMsgClientHello::version() const {
+  // @@protoc_insertion_point(field_get:CMsgClientHello.version)
+  return _internal_version();
+}
+inline void CMsgClientHello::_internal_set_version(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
+}
+inline void CMsgClientHello::set_version(uint32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgClientHello.version)
+}
+
+// repeated .CMsgSOCacheHaveVersion socache_have_versions = 2;
+inline int CMsgClientHello::_internal_socache_have_versions_size() const {
+  return _impl_.socache_have_versions_.size();
+}
+inline int CMsgClientHello::socache_have_versions_size() const {
+  return _internal_socache_have_versions_size();
+}
+inline void CMsgClientHello::clear_socache_have_versions() {
+  _impl_.socache_have_versions_.Clear();
+}
+inline ::CMsgSOCacheHaveVersion* CMsgClientHello::mutable_socache_have_versions(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgClientHello.socache_have_versions)
+  return _impl_.socache_have_versions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheHaveVersion >*
+CMsgClientHello::mutable_socache_have_versions() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgClientHello.socache_have_versions)
+  return &_impl_.socache_have_versions_;
+}
+inline const ::CMsgSOCacheHaveVersion& CMsgClientHello::_internal_socache_have_versions(int index) const {
+  return _impl_.socache_have_versions_.Get(index);
+}
+inline const ::CMsgSOCacheHaveVersion& CMsgClientHello::socache_have_versions(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgClientHello.socache_have_versions)
+  return _internal_socache_have_versions(index);
+}
+inline ::CMsgSOCacheHaveVersion* CMsgClientHello::_internal_add_socache_have_versions() {
+  return _impl_.socache_have_versions_.Add();
+}
+inline ::CMsgSOCacheHaveVersion* CMsgClientHello::add_socache_have_versions() {
+  ::CMsgSOCacheHaveVersion* _add = _internal_add_socache_have_versions();
+  // @@protoc_insertion_point(field_add:CMsgClientHello.socache_have_versions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheHaveVersion >&
+CMsgClientHello::socache_have_versions() const {
+  // @@protoc_insertion_point(field_list:CMsgClientHello.socache_have_versions)
+  return _impl_.socache_have_versions_;
+}
+
+// optional uint32 client_session_need = 3;
+inline bool CMsgClientHello::_internal_has_client_session_need() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgClientHello::has_client_session_need() const {
+  return _internal_has_client_session_need();
+}
+inline void CMsgClientHello::clear_client_session_need() {
+  _impl_.client_session_need_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CMsgClientHello::_internal_client_session_need() const {
+  return _impl_.client_session_need_;
+}
+inline uint32_t CMsgClientHello::client_session_need() const {
+  // @@protoc_insertion_point(field_get:CMsgClientHello.client_session_need)
+  return _internal_client_session_need();
+}
+inline void CMsgClientHello::_internal_set_client_session_need(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.client_session_need_ = value;
+}
+inline void CMsgClientHello::set_client_session_need(uint32_t value) {
+  _internal_set_client_session_need(value);
+  // @@protoc_insertion_point(field_set:CMsgClientHello.client_session_need)
+}
+
+// optional .PartnerAccountType client_launcher = 4 [default = PARTNER_NONE];
+inline bool CMsgClientHello::_internal_has_client_launcher() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CMsgClientHello::has_client_launcher() const {
+  return _internal_has_client_launcher();
+}
+inline void CMsgClientHello::clear_client_launcher() {
+  _impl_.client_launcher_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::PartnerAccountType CMsgClientHello::_internal_client_launcher() const {
+  return static_cast< ::PartnerAccountType >(_impl_.client_launcher_);
+}
+inline ::PartnerAccountType CMsgClientHello::client_launcher() const {
+  // @@protoc_insertion_point(field_get:CMsgClientHello.client_launcher)
+  return _internal_client_launcher();
+}
+inline void CMsgClientHello::_internal_set_client_launcher(::PartnerAccountType value) {
+  assert(::PartnerAccountType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.client_launcher_ = value;
+}
+inline void CMsgClientHello::set_client_launcher(::PartnerAccountType value) {
+  _internal_set_client_launcher(value);
+  // @@protoc_insertion_point(field_set:CMsgClientHello.client_launcher)
+}
+
+// optional string secret_key = 5;
+inline bool CMsgClientHello::_internal_has_secret_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgClientHello::has_secret_key() const {
+  return _internal_has_secret_key();
+}
+inline void CMsgClientHello::clear_secret_key() {
+  _impl_.secret_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CMsgClientHello::secret_key() const {
+  // @@protoc_insertion_point(field_get:CMsgClientHello.secret_key)
+  return _internal_secret_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CMsgClientHello::set_secret_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.secret_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CMsgClientHello.secret_key)
+}
+inline std::string* CMsgClientHello::mutable_secret_key() {
+  std::string* _s = _internal_mutable_secret_key();
+  // @@protoc_insertion_point(field_mutable:CMsgClientHello.secret_key)
+  return _s;
+}
+inline const std::string& CMsgClientHello::_internal_secret_key() const {
+  return _impl_.secret_key_.Get();
+}
+inline void CMsgClientHello::_internal_set_secret_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.secret_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CMsgClientHello::_internal_mutable_secret_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.secret_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CMsgClientHello::release_secret_key() {
+  // @@protoc_insertion_point(field_release:CMsgClientHello.secret_key)
+  if (!_internal_has_secret_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.secret_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.secret_key_.IsDefault()) {
+    _impl_.secret_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CMsgClientHello::set_allocated_secret_key(std::string* secret_key) {
+  if (secret_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.secret_key_.SetAllocated(secret_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.secret_key_.IsDefault()) {
+    _impl_.secret_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CMsgClientHello.secret_key)
+}
+
+// optional uint32 client_language = 6;
+inline bool CMsgClientHello::_internal_has_client_language() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CMsgClientHello::has_client_language() const {
+  return _internal_has_client_language();
+}
+inline void CMsgClientHello::clear_client_language() {
+  _impl_.client_language_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t CMsgClientHello::_internal_client_language() const {
+  return _impl_.client_language_;
+}
+inline uint32_t CMsgClientHello::client_language() const {
+  // @@protoc_insertion_point(field_get:CMsgClientHello.client_language)
+  return _internal_client_language();
+}
+inline void CMsgClientHello::_internal_set_client_language(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.client_language_ = value;
+}
+inline void CMsgClientHello::set_client_language(uint32_t value) {
+  _internal_set_client_language(value);
+  // @@protoc_insertion_point(field_set:CMsgClientHello.client_language)
+}
+
+// optional .ESourceEngine engine = 7 [default = k_ESE_Source1];
+inline bool CMsgClientHello::_internal_has_engine() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CMsgClientHello::has_engine() const {
+  return _internal_has_engine();
+}
+inline void CMsgClientHello::clear_engine() {
+  _impl_.engine_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::ESourceEngine CMsgClientHello::_internal_engine() const {
+  return static_cast< ::ESourceEngine >(_impl_.engine_);
+}
+inline ::ESourceEngine CMsgClientHello::engine() const {
+  // @@protoc_insertion_point(field_get:CMsgClientHello.engine)
+  return _internal_engine();
+}
+inline void CMsgClientHello::_internal_set_engine(::ESourceEngine value) {
+  assert(::ESourceEngine_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.engine_ = value;
+}
+inline void CMsgClientHello::set_engine(::ESourceEngine value) {
+  _internal_set_engine(value);
+  // @@protoc_insertion_point(field_set:CMsgClientHello.engine)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgClientWelcome_Location
+
+// optional float latitude = 1;
+inline bool CMsgClientWelcome_Location::_internal_has_latitude() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgClientWelcome_Location::has_latitude() const {
+  return _internal_has_latitude();
+}
+inline void CMsgClientWelcome_Location::clear_latitude() {
+  _impl_.latitude_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float CMsgClientWelcome_Location::_internal_latitude() const {
+  return _impl_.latitude_;
+}
+inline float CMsgClientWelcome_Location::latitude() const {
+  // @@protoc_insertion_point(field_get:CMsgClientWelcome.Location.latitude)
+  return _internal_latitude();
+}
+inline void CMsgClientWelcome_Location::_internal_set_latitude(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.latitude_ = value;
+}
+inline void CMsgClientWelcome_Location::set_latitude(float value) {
+  _internal_set_latitude(value);
+  // @@protoc_insertion_point(field_set:CMsgClientWelcome.Location.latitude)
+}
+
+// optional float longitude = 2;
+inline bool CMsgClientWelcome_Location::_internal_has_longitude() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgClientWelcome_Location::has_longitude() const {
+  return _internal_has_longitude();
+}
+inline void CMsgClientWelcome_Location::clear_longitude() {
+  _impl_.longitude_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CMsgClientWelcome_Location::_internal_longitude() const {
+  return _impl_.longitude_;
+}
+inline float CMsgClientWelcome_Location::longitude() const {
+  // @@protoc_insertion_point(field_get:CMsgClientWelcome.Location.longitude)
+  return _internal_longitude();
+}
+inline void CMsgClientWelcome_Location::_internal_set_longitude(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.longitude_ = value;
+}
+inline void CMsgClientWelcome_Location::set_longitude(float value) {
+  _internal_set_longitude(value);
+  // @@protoc_insertion_point(field_set:CMsgClientWelcome.Location.longitude)
+}
+
+// optional string country = 3;
+inline bool CMsgClientWelcome_Location::_internal_has_country() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgClientWelcome_Location::has_country() const {
+  return _internal_has_country();
+}
+inline void CMsgClientWelcome_Location::clear_country() {
+  _impl_.country_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CMsgClientWelcome_Location::country() const {
+  // @@protoc_insertion_point(field_get:CMsgClientWelcome.Location.country)
+  return _internal_country();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CMsgClientWelcome_Location::set_country(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.country_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CMsgClientWelcome.Location.country)
+}
+inline std::string* CMsgClientWelcome_Location::mutable_country() {
+  std::string* _s = _internal_mutable_country();
+  // @@protoc_insertion_point(field_mutable:CMsgClientWelcome.Location.country)
+  return _s;
+}
+inline const std::string& CMsgClientWelcome_Location::_internal_country() const {
+  return _impl_.country_.Get();
+}
+inline void CMsgClientWelcome_Location::_internal_set_country(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.country_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CMsgClientWelcome_Location::_internal_mutable_country() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.country_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CMsgClientWelcome_Location::release_country() {
+  // @@protoc_insertion_point(field_release:CMsgClientWelcome.Location.country)
+  if (!_internal_has_country()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.country_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.country_.IsDefault()) {
+    _impl_.country_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CMsgClientWelcome_Location::set_allocated_country(std::string* country) {
+  if (country != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.country_.SetAllocated(country, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.country_.IsDefault()) {
+    _impl_.country_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CMsgClientWelcome.Location.country)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgClientWelcome
+
+// optional uint32 version = 1;
+inline bool CMsgClientWelcome::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CMsgClientWelcome::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgClientWelcome::clear_version() {
+  _impl_.version_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CMsgClientWelcome::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint32_t CMsgClientWelcome::version() const {
+  // @@protoc_insertion_point(field_get:CMsgClientWelcome.version)
+  return _internal_version();
+}
+inline void CMsgClientWelcome::_internal_set_version(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.version_ = value;
+}
+inline void CMsgClientWelcome::set_version(uint32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgClientWelcome.version)
+}
+
+// optional bytes game_data = 2;
+inline bool CMsgClientWelcome::_internal_has_game_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgClientWelcome::has_game_data() const {
+  return _internal_has_game_data();
+}
+inline void CMsgClientWelcome::clear_game_data() {
+  _impl_.game_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CMsgClientWelcome::game_data() const {
+  // @@protoc_insertion_point(field_get:CMsgClientWelcome.game_data)
+  return _internal_game_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CMsgClientWelcome::set_game_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.game_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CMsgClientWelcome.game_data)
+}
+inline std::string* CMsgClientWelcome::mutable_game_data() {
+  std::string* _s = _internal_mutable_game_data();
+  // @@protoc_insertion_point(field_mutable:CMsgClientWelcome.game_data)
+  return _s;
+}
+inline const std::string& CMsgClientWelcome::_internal_game_data() const {
+  return _impl_.game_data_.Get();
+}
+inline void CMsgClientWelcome::_internal_set_game_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.game_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CMsgClientWelcome::_internal_mutable_game_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.game_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CMsgClientWelcome::release_game_data() {
+  // @@protoc_insertion_point(field_release:CMsgClientWelcome.game_data)
+  if (!_internal_has_game_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.game_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.game_data_.IsDefault()) {
+    _impl_.game_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CMsgClientWelcome::set_allocated_game_data(std::string* game_data) {
+  if (game_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.game_data_.SetAllocated(game_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.game_data_.IsDefault()) {
+    _impl_.game_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CMsgClientWelcome.game_data)
+}
+
+// repeated .CMsgSOCacheSubscribed outofdate_subscribed_caches = 3;
+inline int CMsgClientWelcome::_internal_outofdate_subscribed_caches_size() const {
+  return _impl_.outofdate_subscribed_caches_.size();
+}
+inline int CMsgClientWelcome::outofdate_subscribed_caches_size() const {
+  return _internal_outofdate_subscribed_caches_size();
+}
+inline void CMsgClientWelcome::clear_outofdate_subscribed_caches() {
+  _impl_.outofdate_subscribed_caches_.Clear();
+}
+inline ::CMsgSOCacheSubscribed* CMsgClientWelcome::mutable_outofdate_subscribed_caches(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgClientWelcome.outofdate_subscribed_caches)
+  return _impl_.outofdate_subscribed_caches_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed >*
+CMsgClientWelcome::mutable_outofdate_subscribed_caches() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgClientWelcome.outofdate_subscribed_caches)
+  return &_impl_.outofdate_subscribed_caches_;
+}
+inline const ::CMsgSOCacheSubscribed& CMsgClientWelcome::_internal_outofdate_subscribed_caches(int index) const {
+  return _impl_.outofdate_subscribed_caches_.Get(index);
+}
+inline const ::CMsgSOCacheSubscribed& CMsgClientWelcome::outofdate_subscribed_caches(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgClientWelcome.outofdate_subscribed_caches)
+  return _internal_outofdate_subscribed_caches(index);
+}
+inline ::CMsgSOCacheSubscribed* CMsgClientWelcome::_internal_add_outofdate_subscribed_caches() {
+  return _impl_.outofdate_subscribed_caches_.Add();
+}
+inline ::CMsgSOCacheSubscribed* CMsgClientWelcome::add_outofdate_subscribed_caches() {
+  ::CMsgSOCacheSubscribed* _add = _internal_add_outofdate_subscribed_caches();
+  // @@protoc_insertion_point(field_add:CMsgClientWelcome.outofdate_subscribed_caches)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscribed >&
+CMsgClientWelcome::outofdate_subscribed_caches() const {
+  // @@protoc_insertion_point(field_list:CMsgClientWelcome.outofdate_subscribed_caches)
+  return _impl_.outofdate_subscribed_caches_;
+}
+
+// repeated .CMsgSOCacheSubscriptionCheck uptodate_subscribed_caches = 4;
+inline int CMsgClientWelcome::_internal_uptodate_subscribed_caches_size() const {
+  return _impl_.uptodate_subscribed_caches_.size();
+}
+inline int CMsgClientWelcome::uptodate_subscribed_caches_size() const {
+  return _internal_uptodate_subscribed_caches_size();
+}
+inline void CMsgClientWelcome::clear_uptodate_subscribed_caches() {
+  _impl_.uptodate_subscribed_caches_.Clear();
+}
+inline ::CMsgSOCacheSubscriptionCheck* CMsgClientWelcome::mutable_uptodate_subscribed_caches(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgClientWelcome.uptodate_subscribed_caches)
+  return _impl_.uptodate_subscribed_caches_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscriptionCheck >*
+CMsgClientWelcome::mutable_uptodate_subscribed_caches() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgClientWelcome.uptodate_subscribed_caches)
+  return &_impl_.uptodate_subscribed_caches_;
+}
+inline const ::CMsgSOCacheSubscriptionCheck& CMsgClientWelcome::_internal_uptodate_subscribed_caches(int index) const {
+  return _impl_.uptodate_subscribed_caches_.Get(index);
+}
+inline const ::CMsgSOCacheSubscriptionCheck& CMsgClientWelcome::uptodate_subscribed_caches(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgClientWelcome.uptodate_subscribed_caches)
+  return _internal_uptodate_subscribed_caches(index);
+}
+inline ::CMsgSOCacheSubscriptionCheck* CMsgClientWelcome::_internal_add_uptodate_subscribed_caches() {
+  return _impl_.uptodate_subscribed_caches_.Add();
+}
+inline ::CMsgSOCacheSubscriptionCheck* CMsgClientWelcome::add_uptodate_subscribed_caches() {
+  ::CMsgSOCacheSubscriptionCheck* _add = _internal_add_uptodate_subscribed_caches();
+  // @@protoc_insertion_point(field_add:CMsgClientWelcome.uptodate_subscribed_caches)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgSOCacheSubscriptionCheck >&
+CMsgClientWelcome::uptodate_subscribed_caches() const {
+  // @@protoc_insertion_point(field_list:CMsgClientWelcome.uptodate_subscribed_caches)
+  return _impl_.uptodate_subscribed_caches_;
+}
+
+// optional .CMsgClientWelcome.Location location = 5;
+inline bool CMsgClientWelcome::_internal_has_location() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.location_ != nullptr);
+  return value;
+}
+inline bool CMsgClientWelcome::has_location() const {
+  return _internal_has_location();
+}
+inline void CMsgClientWelcome::clear_location() {
+  if (_impl_.location_ != nullptr) _impl_.location_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::CMsgClientWelcome_Location& CMsgClientWelcome::_internal_location() const {
+  const ::CMsgClientWelcome_Location* p = _impl_.location_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgClientWelcome_Location&>(
+      ::_CMsgClientWelcome_Location_default_instance_);
+}
+inline const ::CMsgClientWelcome_Location& CMsgClientWelcome::location() const {
+  // @@protoc_insertion_point(field_get:CMsgClientWelcome.location)
+  return _internal_location();
+}
+inline void CMsgClientWelcome::unsafe_arena_set_allocated_location(
+    ::CMsgClientWelcome_Location* location) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.location_);
+  }
+  _impl_.location_ = location;
+  if (location) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMsgClientWelcome.location)
+}
+inline ::CMsgClientWelcome_Location* CMsgClientWelcome::release_location() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::CMsgClientWelcome_Location* temp = _impl_.location_;
+  _impl_.location_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgClientWelcome_Location* CMsgClientWelcome::unsafe_arena_release_location() {
+  // @@protoc_insertion_point(field_release:CMsgClientWelcome.location)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::CMsgClientWelcome_Location* temp = _impl_.location_;
+  _impl_.location_ = nullptr;
+  return temp;
+}
+inline ::CMsgClientWelcome_Location* CMsgClientWelcome::_internal_mutable_location() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.location_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgClientWelcome_Location>(GetArenaForAllocation());
+    _impl_.location_ = p;
+  }
+  return _impl_.location_;
+}
+inline ::CMsgClientWelcome_Location* CMsgClientWelcome::mutable_location() {
+  ::CMsgClientWelcome_Location* _msg = _internal_mutable_location();
+  // @@protoc_insertion_point(field_mutable:CMsgClientWelcome.location)
+  return _msg;
+}
+inline void CMsgClientWelcome::set_allocated_location(::CMsgClientWelcome_Location* location) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.location_;
+  }
+  if (location) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(location);
+    if (message_arena != submessage_arena) {
+      location = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, location, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.location_ = location;
+  // @@protoc_insertion_point(field_set_allocated:CMsgClientWelcome.location)
+}
+
+// optional bytes save_game_key = 6;
+inline bool CMsgClientWelcome::_internal_has_save_game_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgClientWelcome::has_save_game_key() const {
+  return _internal_has_save_game_key();
+}
+inline void CMsgClientWelcome::clear_save_game_key() {
+  _impl_.save_game_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CMsgClientWelcome::save_game_key() const {
+  // @@protoc_insertion_point(field_get:CMsgClientWelcome.save_game_key)
+  return _internal_save_game_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CMsgClientWelcome::set_save_game_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.save_game_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CMsgClientWelcome.save_game_key)
+}
+inline std::string* CMsgClientWelcome::mutable_save_game_key() {
+  std::string* _s = _internal_mutable_save_game_key();
+  // @@protoc_insertion_point(field_mutable:CMsgClientWelcome.save_game_key)
+  return _s;
+}
+inline const std::string& CMsgClientWelcome::_internal_save_game_key() const {
+  return _impl_.save_game_key_.Get();
+}
+inline void CMsgClientWelcome::_internal_set_save_game_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.save_game_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CMsgClientWelcome::_internal_mutable_save_game_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.save_game_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CMsgClientWelcome::release_save_game_key() {
+  // @@protoc_insertion_point(field_release:CMsgClientWelcome.save_game_key)
+  if (!_internal_has_save_game_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.save_game_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.save_game_key_.IsDefault()) {
+    _impl_.save_game_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CMsgClientWelcome::set_allocated_save_game_key(std::string* save_game_key) {
+  if (save_game_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.save_game_key_.SetAllocated(save_game_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.save_game_key_.IsDefault()) {
+    _impl_.save_game_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CMsgClientWelcome.save_game_key)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgConnectionStatus
+
+// optional .GCConnectionStatus status = 1 [default = GCConnectionStatus_HAVE_SESSION];
+inline bool CMsgConnectionStatus::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgConnectionStatus::has_status() const {
+  return _internal_has_status();
+}
+inline void CMsgConnectionStatus::clear_status() {
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::GCConnectionStatus CMsgConnectionStatus::_internal_status() const {
+  return static_cast< ::GCConnectionStatus >(_impl_.status_);
+}
+inline ::GCConnectionStatus CMsgConnectionStatus::status() const {
+  // @@protoc_insertion_point(field_get:CMsgConnectionStatus.status)
+  return _internal_status();
+}
+inline void CMsgConnectionStatus::_internal_set_status(::GCConnectionStatus value) {
+  assert(::GCConnectionStatus_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.status_ = value;
+}
+inline void CMsgConnectionStatus::set_status(::GCConnectionStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:CMsgConnectionStatus.status)
+}
+
+// optional uint32 client_session_need = 2;
+inline bool CMsgConnectionStatus::_internal_has_client_session_need() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgConnectionStatus::has_client_session_need() const {
+  return _internal_has_client_session_need();
+}
+inline void CMsgConnectionStatus::clear_client_session_need() {
+  _impl_.client_session_need_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CMsgConnectionStatus::_internal_client_session_need() const {
+  return _impl_.client_session_need_;
+}
+inline uint32_t CMsgConnectionStatus::client_session_need() const {
+  // @@protoc_insertion_point(field_get:CMsgConnectionStatus.client_session_need)
+  return _internal_client_session_need();
+}
+inline void CMsgConnectionStatus::_internal_set_client_session_need(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.client_session_need_ = value;
+}
+inline void CMsgConnectionStatus::set_client_session_need(uint32_t value) {
+  _internal_set_client_session_need(value);
+  // @@protoc_insertion_point(field_set:CMsgConnectionStatus.client_session_need)
+}
+
+// optional int32 queue_position = 3;
+inline bool CMsgConnectionStatus::_internal_has_queue_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgConnectionStatus::has_queue_position() const {
+  return _internal_has_queue_position();
+}
+inline void CMsgConnectionStatus::clear_queue_position() {
+  _impl_.queue_position_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CMsgConnectionStatus::_internal_queue_position() const {
+  return _impl_.queue_position_;
+}
+inline int32_t CMsgConnectionStatus::queue_position() const {
+  // @@protoc_insertion_point(field_get:CMsgConnectionStatus.queue_position)
+  return _internal_queue_position();
+}
+inline void CMsgConnectionStatus::_internal_set_queue_position(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.queue_position_ = value;
+}
+inline void CMsgConnectionStatus::set_queue_position(int32_t value) {
+  _internal_set_queue_position(value);
+  // @@protoc_insertion_point(field_set:CMsgConnectionStatus.queue_position)
+}
+
+// optional int32 queue_size = 4;
+inline bool CMsgConnectionStatus::_internal_has_queue_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CMsgConnectionStatus::has_queue_size() const {
+  return _internal_has_queue_size();
+}
+inline void CMsgConnectionStatus::clear_queue_size() {
+  _impl_.queue_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CMsgConnectionStatus::_internal_queue_size() const {
+  return _impl_.queue_size_;
+}
+inline int32_t CMsgConnectionStatus::queue_size() const {
+  // @@protoc_insertion_point(field_get:CMsgConnectionStatus.queue_size)
+  return _internal_queue_size();
+}
+inline void CMsgConnectionStatus::_internal_set_queue_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.queue_size_ = value;
+}
+inline void CMsgConnectionStatus::set_queue_size(int32_t value) {
+  _internal_set_queue_size(value);
+  // @@protoc_insertion_point(field_set:CMsgConnectionStatus.queue_size)
+}
+
+// optional int32 wait_seconds = 5;
+inline bool CMsgConnectionStatus::_internal_has_wait_seconds() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CMsgConnectionStatus::has_wait_seconds() const {
+  return _internal_has_wait_seconds();
+}
+inline void CMsgConnectionStatus::clear_wait_seconds() {
+  _impl_.wait_seconds_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t CMsgConnectionStatus::_internal_wait_seconds() const {
+  return _impl_.wait_seconds_;
+}
+inline int32_t CMsgConnectionStatus::wait_seconds() const {
+  // @@protoc_insertion_point(field_get:CMsgConnectionStatus.wait_seconds)
+  return _internal_wait_seconds();
+}
+inline void CMsgConnectionStatus::_internal_set_wait_seconds(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.wait_seconds_ = value;
+}
+inline void CMsgConnectionStatus::set_wait_seconds(int32_t value) {
+  _internal_set_wait_seconds(value);
+  // @@protoc_insertion_point(field_set:CMsgConnectionStatus.wait_seconds)
+}
+
+// optional int32 estimated_wait_seconds_remaining = 6;
+inline bool CMsgConnectionStatus::_internal_has_estimated_wait_seconds_remaining() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CMsgConnectionStatus::has_estimated_wait_seconds_remaining() const {
+  return _internal_has_estimated_wait_seconds_remaining();
+}
+inline void CMsgConnectionStatus::clear_estimated_wait_seconds_remaining() {
+  _impl_.estimated_wait_seconds_remaining_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t CMsgConnectionStatus::_internal_estimated_wait_seconds_remaining() const {
+  return _impl_.estimated_wait_seconds_remaining_;
+}
+inline int32_t CMsgConnectionStatus::estimated_wait_seconds_remaining() const {
+  // @@protoc_insertion_point(field_get:CMsgConnectionStatus.estimated_wait_seconds_remaining)
+  return _internal_estimated_wait_seconds_remaining();
+}
+inline void CMsgConnectionStatus::_internal_set_estimated_wait_seconds_remaining(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.estimated_wait_seconds_remaining_ = value;
+}
+inline void CMsgConnectionStatus::set_estimated_wait_seconds_remaining(int32_t value) {
+  _internal_set_estimated_wait_seconds_remaining(value);
+  // @@protoc_insertion_point(field_set:CMsgConnectionStatus.estimated_wait_seconds_remaining)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions
+
+// optional uint32 service_id = 1;
+inline bool CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_internal_has_service_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::has_service_id() const {
+  return _internal_has_service_id();
+}
+inline void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::clear_service_id() {
+  _impl_.service_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_internal_service_id() const {
+  return _impl_.service_id_;
+}
+inline uint32_t CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::service_id() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions.service_id)
+  return _internal_service_id();
+}
+inline void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_internal_set_service_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.service_id_ = value;
+}
+inline void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::set_service_id(uint32_t value) {
+  _internal_set_service_id(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions.service_id)
+}
+
+// optional uint64 version = 2;
+inline bool CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::has_version() const {
+  return _internal_has_version();
+}
+inline void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::version() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions.version)
+  return _internal_version();
+}
+inline void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_ = value;
+}
+inline void CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions.version)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCToGCSOCacheSubscribe
+
+// optional fixed64 subscriber = 1;
+inline bool CMsgGCToGCSOCacheSubscribe::_internal_has_subscriber() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCSOCacheSubscribe::has_subscriber() const {
+  return _internal_has_subscriber();
+}
+inline void CMsgGCToGCSOCacheSubscribe::clear_subscriber() {
+  _impl_.subscriber_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CMsgGCToGCSOCacheSubscribe::_internal_subscriber() const {
+  return _impl_.subscriber_;
+}
+inline uint64_t CMsgGCToGCSOCacheSubscribe::subscriber() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCSOCacheSubscribe.subscriber)
+  return _internal_subscriber();
+}
+inline void CMsgGCToGCSOCacheSubscribe::_internal_set_subscriber(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subscriber_ = value;
+}
+inline void CMsgGCToGCSOCacheSubscribe::set_subscriber(uint64_t value) {
+  _internal_set_subscriber(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCSOCacheSubscribe.subscriber)
+}
+
+// optional fixed64 subscribe_to = 2;
+inline bool CMsgGCToGCSOCacheSubscribe::_internal_has_subscribe_to() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCSOCacheSubscribe::has_subscribe_to() const {
+  return _internal_has_subscribe_to();
+}
+inline void CMsgGCToGCSOCacheSubscribe::clear_subscribe_to() {
+  _impl_.subscribe_to_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CMsgGCToGCSOCacheSubscribe::_internal_subscribe_to() const {
+  return _impl_.subscribe_to_;
+}
+inline uint64_t CMsgGCToGCSOCacheSubscribe::subscribe_to() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCSOCacheSubscribe.subscribe_to)
+  return _internal_subscribe_to();
+}
+inline void CMsgGCToGCSOCacheSubscribe::_internal_set_subscribe_to(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.subscribe_to_ = value;
+}
+inline void CMsgGCToGCSOCacheSubscribe::set_subscribe_to(uint64_t value) {
+  _internal_set_subscribe_to(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCSOCacheSubscribe.subscribe_to)
+}
+
+// optional fixed64 sync_version = 3;
+inline bool CMsgGCToGCSOCacheSubscribe::_internal_has_sync_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCSOCacheSubscribe::has_sync_version() const {
+  return _internal_has_sync_version();
+}
+inline void CMsgGCToGCSOCacheSubscribe::clear_sync_version() {
+  _impl_.sync_version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t CMsgGCToGCSOCacheSubscribe::_internal_sync_version() const {
+  return _impl_.sync_version_;
+}
+inline uint64_t CMsgGCToGCSOCacheSubscribe::sync_version() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCSOCacheSubscribe.sync_version)
+  return _internal_sync_version();
+}
+inline void CMsgGCToGCSOCacheSubscribe::_internal_set_sync_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sync_version_ = value;
+}
+inline void CMsgGCToGCSOCacheSubscribe::set_sync_version(uint64_t value) {
+  _internal_set_sync_version(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCSOCacheSubscribe.sync_version)
+}
+
+// repeated .CMsgGCToGCSOCacheSubscribe.CMsgHaveVersions have_versions = 4;
+inline int CMsgGCToGCSOCacheSubscribe::_internal_have_versions_size() const {
+  return _impl_.have_versions_.size();
+}
+inline int CMsgGCToGCSOCacheSubscribe::have_versions_size() const {
+  return _internal_have_versions_size();
+}
+inline void CMsgGCToGCSOCacheSubscribe::clear_have_versions() {
+  _impl_.have_versions_.Clear();
+}
+inline ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* CMsgGCToGCSOCacheSubscribe::mutable_have_versions(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsgGCToGCSOCacheSubscribe.have_versions)
+  return _impl_.have_versions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions >*
+CMsgGCToGCSOCacheSubscribe::mutable_have_versions() {
+  // @@protoc_insertion_point(field_mutable_list:CMsgGCToGCSOCacheSubscribe.have_versions)
+  return &_impl_.have_versions_;
+}
+inline const ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& CMsgGCToGCSOCacheSubscribe::_internal_have_versions(int index) const {
+  return _impl_.have_versions_.Get(index);
+}
+inline const ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions& CMsgGCToGCSOCacheSubscribe::have_versions(int index) const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCSOCacheSubscribe.have_versions)
+  return _internal_have_versions(index);
+}
+inline ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* CMsgGCToGCSOCacheSubscribe::_internal_add_have_versions() {
+  return _impl_.have_versions_.Add();
+}
+inline ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* CMsgGCToGCSOCacheSubscribe::add_have_versions() {
+  ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions* _add = _internal_add_have_versions();
+  // @@protoc_insertion_point(field_add:CMsgGCToGCSOCacheSubscribe.have_versions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsgGCToGCSOCacheSubscribe_CMsgHaveVersions >&
+CMsgGCToGCSOCacheSubscribe::have_versions() const {
+  // @@protoc_insertion_point(field_list:CMsgGCToGCSOCacheSubscribe.have_versions)
+  return _impl_.have_versions_;
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCToGCSOCacheUnsubscribe
+
+// optional fixed64 subscriber = 1;
+inline bool CMsgGCToGCSOCacheUnsubscribe::_internal_has_subscriber() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCSOCacheUnsubscribe::has_subscriber() const {
+  return _internal_has_subscriber();
+}
+inline void CMsgGCToGCSOCacheUnsubscribe::clear_subscriber() {
+  _impl_.subscriber_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CMsgGCToGCSOCacheUnsubscribe::_internal_subscriber() const {
+  return _impl_.subscriber_;
+}
+inline uint64_t CMsgGCToGCSOCacheUnsubscribe::subscriber() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCSOCacheUnsubscribe.subscriber)
+  return _internal_subscriber();
+}
+inline void CMsgGCToGCSOCacheUnsubscribe::_internal_set_subscriber(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subscriber_ = value;
+}
+inline void CMsgGCToGCSOCacheUnsubscribe::set_subscriber(uint64_t value) {
+  _internal_set_subscriber(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCSOCacheUnsubscribe.subscriber)
+}
+
+// optional fixed64 unsubscribe_from = 2;
+inline bool CMsgGCToGCSOCacheUnsubscribe::_internal_has_unsubscribe_from() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCSOCacheUnsubscribe::has_unsubscribe_from() const {
+  return _internal_has_unsubscribe_from();
+}
+inline void CMsgGCToGCSOCacheUnsubscribe::clear_unsubscribe_from() {
+  _impl_.unsubscribe_from_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CMsgGCToGCSOCacheUnsubscribe::_internal_unsubscribe_from() const {
+  return _impl_.unsubscribe_from_;
+}
+inline uint64_t CMsgGCToGCSOCacheUnsubscribe::unsubscribe_from() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCSOCacheUnsubscribe.unsubscribe_from)
+  return _internal_unsubscribe_from();
+}
+inline void CMsgGCToGCSOCacheUnsubscribe::_internal_set_unsubscribe_from(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.unsubscribe_from_ = value;
+}
+inline void CMsgGCToGCSOCacheUnsubscribe::set_unsubscribe_from(uint64_t value) {
+  _internal_set_unsubscribe_from(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCSOCacheUnsubscribe.unsubscribe_from)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCClientPing
+
+// -------------------------------------------------------------------
+
+// CMsgGCToGCLoadSessionSOCache
+
+// optional uint32 account_id = 1;
+inline bool CMsgGCToGCLoadSessionSOCache::_internal_has_account_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCLoadSessionSOCache::has_account_id() const {
+  return _internal_has_account_id();
+}
+inline void CMsgGCToGCLoadSessionSOCache::clear_account_id() {
+  _impl_.account_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CMsgGCToGCLoadSessionSOCache::_internal_account_id() const {
+  return _impl_.account_id_;
+}
+inline uint32_t CMsgGCToGCLoadSessionSOCache::account_id() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCLoadSessionSOCache.account_id)
+  return _internal_account_id();
+}
+inline void CMsgGCToGCLoadSessionSOCache::_internal_set_account_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.account_id_ = value;
+}
+inline void CMsgGCToGCLoadSessionSOCache::set_account_id(uint32_t value) {
+  _internal_set_account_id(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCLoadSessionSOCache.account_id)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgGCToGCLoadSessionSOCacheResponse
+
+// -------------------------------------------------------------------
+
+// CMsgGCToGCUpdateSessionStats
+
+// optional uint32 user_sessions = 1;
+inline bool CMsgGCToGCUpdateSessionStats::_internal_has_user_sessions() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCUpdateSessionStats::has_user_sessions() const {
+  return _internal_has_user_sessions();
+}
+inline void CMsgGCToGCUpdateSessionStats::clear_user_sessions() {
+  _impl_.user_sessions_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CMsgGCToGCUpdateSessionStats::_internal_user_sessions() const {
+  return _impl_.user_sessions_;
+}
+inline uint32_t CMsgGCToGCUpdateSessionStats::user_sessions() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCUpdateSessionStats.user_sessions)
+  return _internal_user_sessions();
+}
+inline void CMsgGCToGCUpdateSessionStats::_internal_set_user_sessions(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.user_sessions_ = value;
+}
+inline void CMsgGCToGCUpdateSessionStats::set_user_sessions(uint32_t value) {
+  _internal_set_user_sessions(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCUpdateSessionStats.user_sessions)
+}
+
+// optional uint32 server_sessions = 2;
+inline bool CMsgGCToGCUpdateSessionStats::_internal_has_server_sessions() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCUpdateSessionStats::has_server_sessions() const {
+  return _internal_has_server_sessions();
+}
+inline void CMsgGCToGCUpdateSessionStats::clear_server_sessions() {
+  _impl_.server_sessions_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CMsgGCToGCUpdateSessionStats::_internal_server_sessions() const {
+  return _impl_.server_sessions_;
+}
+inline uint32_t CMsgGCToGCUpdateSessionStats::server_sessions() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCUpdateSessionStats.server_sessions)
+  return _internal_server_sessions();
+}
+inline void CMsgGCToGCUpdateSessionStats::_internal_set_server_sessions(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.server_sessions_ = value;
+}
+inline void CMsgGCToGCUpdateSessionStats::set_server_sessions(uint32_t value) {
+  _internal_set_server_sessions(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCUpdateSessionStats.server_sessions)
+}
+
+// optional bool in_logon_surge = 3;
+inline bool CMsgGCToGCUpdateSessionStats::_internal_has_in_logon_surge() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgGCToGCUpdateSessionStats::has_in_logon_surge() const {
+  return _internal_has_in_logon_surge();
+}
+inline void CMsgGCToGCUpdateSessionStats::clear_in_logon_surge() {
+  _impl_.in_logon_surge_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CMsgGCToGCUpdateSessionStats::_internal_in_logon_surge() const {
+  return _impl_.in_logon_surge_;
+}
+inline bool CMsgGCToGCUpdateSessionStats::in_logon_surge() const {
+  // @@protoc_insertion_point(field_get:CMsgGCToGCUpdateSessionStats.in_logon_surge)
+  return _internal_in_logon_surge();
+}
+inline void CMsgGCToGCUpdateSessionStats::_internal_set_in_logon_surge(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.in_logon_surge_ = value;
+}
+inline void CMsgGCToGCUpdateSessionStats::set_in_logon_surge(bool value) {
+  _internal_set_in_logon_surge(value);
+  // @@protoc_insertion_point(field_set:CMsgGCToGCUpdateSessionStats.in_logon_surge)
+}
+
+// -------------------------------------------------------------------
+
+// CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription
+
+// optional uint32 gameitemid = 1;
+inline bool CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_internal_has_gameitemid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::has_gameitemid() const {
+  return _internal_has_gameitemid();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::clear_gameitemid() {
+  _impl_.gameitemid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_internal_gameitemid() const {
+  return _impl_.gameitemid_;
+}
+inline uint32_t CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::gameitemid() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription.gameitemid)
+  return _internal_gameitemid();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_internal_set_gameitemid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.gameitemid_ = value;
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::set_gameitemid(uint32_t value) {
+  _internal_set_gameitemid(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription.gameitemid)
+}
+
+// optional string item_description = 2;
+inline bool CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_internal_has_item_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::has_item_description() const {
+  return _internal_has_item_description();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::clear_item_description() {
+  _impl_.item_description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::item_description() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription.item_description)
+  return _internal_item_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::set_item_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.item_description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription.item_description)
+}
+inline std::string* CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::mutable_item_description() {
+  std::string* _s = _internal_mutable_item_description();
+  // @@protoc_insertion_point(field_mutable:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription.item_description)
+  return _s;
+}
+inline const std::string& CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_internal_item_description() const {
+  return _impl_.item_description_.Get();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_internal_set_item_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.item_description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::_internal_mutable_item_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.item_description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::release_item_description() {
+  // @@protoc_insertion_point(field_release:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription.item_description)
+  if (!_internal_has_item_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.item_description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.item_description_.IsDefault()) {
+    _impl_.item_description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription::set_allocated_item_description(std::string* item_description) {
+  if (item_description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.item_description_.SetAllocated(item_description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.item_description_.IsDefault()) {
+    _impl_.item_description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription.item_description)
+}
+
+// -------------------------------------------------------------------
+
+// CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock
+
+// optional string language = 1;
+inline bool CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_internal_has_language() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::has_language() const {
+  return _internal_has_language();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::clear_language() {
+  _impl_.language_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::language() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.language)
+  return _internal_language();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::set_language(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.language_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.language)
+}
+inline std::string* CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::mutable_language() {
+  std::string* _s = _internal_mutable_language();
+  // @@protoc_insertion_point(field_mutable:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.language)
+  return _s;
+}
+inline const std::string& CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_internal_language() const {
+  return _impl_.language_.Get();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_internal_set_language(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.language_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_internal_mutable_language() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.language_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::release_language() {
+  // @@protoc_insertion_point(field_release:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.language)
+  if (!_internal_has_language()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.language_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.language_.IsDefault()) {
+    _impl_.language_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::set_allocated_language(std::string* language) {
+  if (language != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.language_.SetAllocated(language, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.language_.IsDefault()) {
+    _impl_.language_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.language)
+}
+
+// repeated .CWorkshop_PopulateItemDescriptions_Request.SingleItemDescription descriptions = 2;
+inline int CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_internal_descriptions_size() const {
+  return _impl_.descriptions_.size();
+}
+inline int CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::descriptions_size() const {
+  return _internal_descriptions_size();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::clear_descriptions() {
+  _impl_.descriptions_.Clear();
+}
+inline ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::mutable_descriptions(int index) {
+  // @@protoc_insertion_point(field_mutable:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.descriptions)
+  return _impl_.descriptions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription >*
+CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::mutable_descriptions() {
+  // @@protoc_insertion_point(field_mutable_list:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.descriptions)
+  return &_impl_.descriptions_;
+}
+inline const ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_internal_descriptions(int index) const {
+  return _impl_.descriptions_.Get(index);
+}
+inline const ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription& CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::descriptions(int index) const {
+  // @@protoc_insertion_point(field_get:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.descriptions)
+  return _internal_descriptions(index);
+}
+inline ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::_internal_add_descriptions() {
+  return _impl_.descriptions_.Add();
+}
+inline ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::add_descriptions() {
+  ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription* _add = _internal_add_descriptions();
+  // @@protoc_insertion_point(field_add:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.descriptions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_SingleItemDescription >&
+CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock::descriptions() const {
+  // @@protoc_insertion_point(field_list:CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock.descriptions)
+  return _impl_.descriptions_;
+}
+
+// -------------------------------------------------------------------
+
+// CWorkshop_PopulateItemDescriptions_Request
+
+// optional uint32 appid = 1;
+inline bool CWorkshop_PopulateItemDescriptions_Request::_internal_has_appid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CWorkshop_PopulateItemDescriptions_Request::has_appid() const {
+  return _internal_has_appid();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request::clear_appid() {
+  _impl_.appid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CWorkshop_PopulateItemDescriptions_Request::_internal_appid() const {
+  return _impl_.appid_;
+}
+inline uint32_t CWorkshop_PopulateItemDescriptions_Request::appid() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_PopulateItemDescriptions_Request.appid)
+  return _internal_appid();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request::_internal_set_appid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.appid_ = value;
+}
+inline void CWorkshop_PopulateItemDescriptions_Request::set_appid(uint32_t value) {
+  _internal_set_appid(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_PopulateItemDescriptions_Request.appid)
+}
+
+// repeated .CWorkshop_PopulateItemDescriptions_Request.ItemDescriptionsLanguageBlock languages = 2;
+inline int CWorkshop_PopulateItemDescriptions_Request::_internal_languages_size() const {
+  return _impl_.languages_.size();
+}
+inline int CWorkshop_PopulateItemDescriptions_Request::languages_size() const {
+  return _internal_languages_size();
+}
+inline void CWorkshop_PopulateItemDescriptions_Request::clear_languages() {
+  _impl_.languages_.Clear();
+}
+inline ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* CWorkshop_PopulateItemDescriptions_Request::mutable_languages(int index) {
+  // @@protoc_insertion_point(field_mutable:CWorkshop_PopulateItemDescriptions_Request.languages)
+  return _impl_.languages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock >*
+CWorkshop_PopulateItemDescriptions_Request::mutable_languages() {
+  // @@protoc_insertion_point(field_mutable_list:CWorkshop_PopulateItemDescriptions_Request.languages)
+  return &_impl_.languages_;
+}
+inline const ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& CWorkshop_PopulateItemDescriptions_Request::_internal_languages(int index) const {
+  return _impl_.languages_.Get(index);
+}
+inline const ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock& CWorkshop_PopulateItemDescriptions_Request::languages(int index) const {
+  // @@protoc_insertion_point(field_get:CWorkshop_PopulateItemDescriptions_Request.languages)
+  return _internal_languages(index);
+}
+inline ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* CWorkshop_PopulateItemDescriptions_Request::_internal_add_languages() {
+  return _impl_.languages_.Add();
+}
+inline ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* CWorkshop_PopulateItemDescriptions_Request::add_languages() {
+  ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock* _add = _internal_add_languages();
+  // @@protoc_insertion_point(field_add:CWorkshop_PopulateItemDescriptions_Request.languages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_PopulateItemDescriptions_Request_ItemDescriptionsLanguageBlock >&
+CWorkshop_PopulateItemDescriptions_Request::languages() const {
+  // @@protoc_insertion_point(field_list:CWorkshop_PopulateItemDescriptions_Request.languages)
+  return _impl_.languages_;
+}
+
+// -------------------------------------------------------------------
+
+// CWorkshop_GetContributors_Request
+
+// optional uint32 appid = 1;
+inline bool CWorkshop_GetContributors_Request::_internal_has_appid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CWorkshop_GetContributors_Request::has_appid() const {
+  return _internal_has_appid();
+}
+inline void CWorkshop_GetContributors_Request::clear_appid() {
+  _impl_.appid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CWorkshop_GetContributors_Request::_internal_appid() const {
+  return _impl_.appid_;
+}
+inline uint32_t CWorkshop_GetContributors_Request::appid() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_GetContributors_Request.appid)
+  return _internal_appid();
+}
+inline void CWorkshop_GetContributors_Request::_internal_set_appid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.appid_ = value;
+}
+inline void CWorkshop_GetContributors_Request::set_appid(uint32_t value) {
+  _internal_set_appid(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_GetContributors_Request.appid)
+}
+
+// optional uint32 gameitemid = 2;
+inline bool CWorkshop_GetContributors_Request::_internal_has_gameitemid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CWorkshop_GetContributors_Request::has_gameitemid() const {
+  return _internal_has_gameitemid();
+}
+inline void CWorkshop_GetContributors_Request::clear_gameitemid() {
+  _impl_.gameitemid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CWorkshop_GetContributors_Request::_internal_gameitemid() const {
+  return _impl_.gameitemid_;
+}
+inline uint32_t CWorkshop_GetContributors_Request::gameitemid() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_GetContributors_Request.gameitemid)
+  return _internal_gameitemid();
+}
+inline void CWorkshop_GetContributors_Request::_internal_set_gameitemid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.gameitemid_ = value;
+}
+inline void CWorkshop_GetContributors_Request::set_gameitemid(uint32_t value) {
+  _internal_set_gameitemid(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_GetContributors_Request.gameitemid)
+}
+
+// -------------------------------------------------------------------
+
+// CWorkshop_GetContributors_Response
+
+// repeated fixed64 contributors = 1;
+inline int CWorkshop_GetContributors_Response::_internal_contributors_size() const {
+  return _impl_.contributors_.size();
+}
+inline int CWorkshop_GetContributors_Response::contributors_size() const {
+  return _internal_contributors_size();
+}
+inline void CWorkshop_GetContributors_Response::clear_contributors() {
+  _impl_.contributors_.Clear();
+}
+inline uint64_t CWorkshop_GetContributors_Response::_internal_contributors(int index) const {
+  return _impl_.contributors_.Get(index);
+}
+inline uint64_t CWorkshop_GetContributors_Response::contributors(int index) const {
+  // @@protoc_insertion_point(field_get:CWorkshop_GetContributors_Response.contributors)
+  return _internal_contributors(index);
+}
+inline void CWorkshop_GetContributors_Response::set_contributors(int index, uint64_t value) {
+  _impl_.contributors_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CWorkshop_GetContributors_Response.contributors)
+}
+inline void CWorkshop_GetContributors_Response::_internal_add_contributors(uint64_t value) {
+  _impl_.contributors_.Add(value);
+}
+inline void CWorkshop_GetContributors_Response::add_contributors(uint64_t value) {
+  _internal_add_contributors(value);
+  // @@protoc_insertion_point(field_add:CWorkshop_GetContributors_Response.contributors)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CWorkshop_GetContributors_Response::_internal_contributors() const {
+  return _impl_.contributors_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+CWorkshop_GetContributors_Response::contributors() const {
+  // @@protoc_insertion_point(field_list:CWorkshop_GetContributors_Response.contributors)
+  return _internal_contributors();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CWorkshop_GetContributors_Response::_internal_mutable_contributors() {
+  return &_impl_.contributors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+CWorkshop_GetContributors_Response::mutable_contributors() {
+  // @@protoc_insertion_point(field_mutable_list:CWorkshop_GetContributors_Response.contributors)
+  return _internal_mutable_contributors();
+}
+
+// -------------------------------------------------------------------
+
+// CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule
+
+// optional uint64 workshop_file_id = 1;
+inline bool CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_has_workshop_file_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::has_workshop_file_id() const {
+  return _internal_has_workshop_file_id();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::clear_workshop_file_id() {
+  _impl_.workshop_file_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_workshop_file_id() const {
+  return _impl_.workshop_file_id_;
+}
+inline uint64_t CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::workshop_file_id() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.workshop_file_id)
+  return _internal_workshop_file_id();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_set_workshop_file_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.workshop_file_id_ = value;
+}
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::set_workshop_file_id(uint64_t value) {
+  _internal_set_workshop_file_id(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.workshop_file_id)
+}
+
+// optional float revenue_percentage = 2;
+inline bool CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_has_revenue_percentage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::has_revenue_percentage() const {
+  return _internal_has_revenue_percentage();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::clear_revenue_percentage() {
+  _impl_.revenue_percentage_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_revenue_percentage() const {
+  return _impl_.revenue_percentage_;
+}
+inline float CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::revenue_percentage() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.revenue_percentage)
+  return _internal_revenue_percentage();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_set_revenue_percentage(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.revenue_percentage_ = value;
+}
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::set_revenue_percentage(float value) {
+  _internal_set_revenue_percentage(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.revenue_percentage)
+}
+
+// optional string rule_description = 3;
+inline bool CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_has_rule_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::has_rule_description() const {
+  return _internal_has_rule_description();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::clear_rule_description() {
+  _impl_.rule_description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::rule_description() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.rule_description)
+  return _internal_rule_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::set_rule_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.rule_description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.rule_description)
+}
+inline std::string* CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::mutable_rule_description() {
+  std::string* _s = _internal_mutable_rule_description();
+  // @@protoc_insertion_point(field_mutable:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.rule_description)
+  return _s;
+}
+inline const std::string& CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_rule_description() const {
+  return _impl_.rule_description_.Get();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_set_rule_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.rule_description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::_internal_mutable_rule_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.rule_description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::release_rule_description() {
+  // @@protoc_insertion_point(field_release:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.rule_description)
+  if (!_internal_has_rule_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.rule_description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rule_description_.IsDefault()) {
+    _impl_.rule_description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule::set_allocated_rule_description(std::string* rule_description) {
+  if (rule_description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.rule_description_.SetAllocated(rule_description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rule_description_.IsDefault()) {
+    _impl_.rule_description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule.rule_description)
+}
+
+// -------------------------------------------------------------------
+
+// CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule
+
+// optional uint32 account_id = 1;
+inline bool CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_has_account_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::has_account_id() const {
+  return _internal_has_account_id();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::clear_account_id() {
+  _impl_.account_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_account_id() const {
+  return _impl_.account_id_;
+}
+inline uint32_t CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::account_id() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.account_id)
+  return _internal_account_id();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_set_account_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.account_id_ = value;
+}
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::set_account_id(uint32_t value) {
+  _internal_set_account_id(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.account_id)
+}
+
+// optional float revenue_percentage = 2;
+inline bool CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_has_revenue_percentage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::has_revenue_percentage() const {
+  return _internal_has_revenue_percentage();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::clear_revenue_percentage() {
+  _impl_.revenue_percentage_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_revenue_percentage() const {
+  return _impl_.revenue_percentage_;
+}
+inline float CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::revenue_percentage() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.revenue_percentage)
+  return _internal_revenue_percentage();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_set_revenue_percentage(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.revenue_percentage_ = value;
+}
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::set_revenue_percentage(float value) {
+  _internal_set_revenue_percentage(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.revenue_percentage)
+}
+
+// optional string rule_description = 3;
+inline bool CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_has_rule_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::has_rule_description() const {
+  return _internal_has_rule_description();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::clear_rule_description() {
+  _impl_.rule_description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::rule_description() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.rule_description)
+  return _internal_rule_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::set_rule_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.rule_description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.rule_description)
+}
+inline std::string* CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::mutable_rule_description() {
+  std::string* _s = _internal_mutable_rule_description();
+  // @@protoc_insertion_point(field_mutable:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.rule_description)
+  return _s;
+}
+inline const std::string& CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_rule_description() const {
+  return _impl_.rule_description_.Get();
+}
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_set_rule_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.rule_description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::_internal_mutable_rule_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.rule_description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::release_rule_description() {
+  // @@protoc_insertion_point(field_release:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.rule_description)
+  if (!_internal_has_rule_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.rule_description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rule_description_.IsDefault()) {
+    _impl_.rule_description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule::set_allocated_rule_description(std::string* rule_description) {
+  if (rule_description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.rule_description_.SetAllocated(rule_description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rule_description_.IsDefault()) {
+    _impl_.rule_description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule.rule_description)
+}
+
+// -------------------------------------------------------------------
+
+// CWorkshop_SetItemPaymentRules_Request
+
+// optional uint32 appid = 1;
+inline bool CWorkshop_SetItemPaymentRules_Request::_internal_has_appid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CWorkshop_SetItemPaymentRules_Request::has_appid() const {
+  return _internal_has_appid();
+}
+inline void CWorkshop_SetItemPaymentRules_Request::clear_appid() {
+  _impl_.appid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CWorkshop_SetItemPaymentRules_Request::_internal_appid() const {
+  return _impl_.appid_;
+}
+inline uint32_t CWorkshop_SetItemPaymentRules_Request::appid() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.appid)
+  return _internal_appid();
+}
+inline void CWorkshop_SetItemPaymentRules_Request::_internal_set_appid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.appid_ = value;
+}
+inline void CWorkshop_SetItemPaymentRules_Request::set_appid(uint32_t value) {
+  _internal_set_appid(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_SetItemPaymentRules_Request.appid)
+}
+
+// optional uint32 gameitemid = 2;
+inline bool CWorkshop_SetItemPaymentRules_Request::_internal_has_gameitemid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CWorkshop_SetItemPaymentRules_Request::has_gameitemid() const {
+  return _internal_has_gameitemid();
+}
+inline void CWorkshop_SetItemPaymentRules_Request::clear_gameitemid() {
+  _impl_.gameitemid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CWorkshop_SetItemPaymentRules_Request::_internal_gameitemid() const {
+  return _impl_.gameitemid_;
+}
+inline uint32_t CWorkshop_SetItemPaymentRules_Request::gameitemid() const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.gameitemid)
+  return _internal_gameitemid();
+}
+inline void CWorkshop_SetItemPaymentRules_Request::_internal_set_gameitemid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.gameitemid_ = value;
+}
+inline void CWorkshop_SetItemPaymentRules_Request::set_gameitemid(uint32_t value) {
+  _internal_set_gameitemid(value);
+  // @@protoc_insertion_point(field_set:CWorkshop_SetItemPaymentRules_Request.gameitemid)
+}
+
+// repeated .CWorkshop_SetItemPaymentRules_Request.WorkshopItemPaymentRule associated_workshop_files = 3;
+inline int CWorkshop_SetItemPaymentRules_Request::_internal_associated_workshop_files_size() const {
+  return _impl_.associated_workshop_files_.size();
+}
+inline int CWorkshop_SetItemPaymentRules_Request::associated_workshop_files_size() const {
+  return _internal_associated_workshop_files_size();
+}
+inline void CWorkshop_SetItemPaymentRules_Request::clear_associated_workshop_files() {
+  _impl_.associated_workshop_files_.Clear();
+}
+inline ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* CWorkshop_SetItemPaymentRules_Request::mutable_associated_workshop_files(int index) {
+  // @@protoc_insertion_point(field_mutable:CWorkshop_SetItemPaymentRules_Request.associated_workshop_files)
+  return _impl_.associated_workshop_files_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule >*
+CWorkshop_SetItemPaymentRules_Request::mutable_associated_workshop_files() {
+  // @@protoc_insertion_point(field_mutable_list:CWorkshop_SetItemPaymentRules_Request.associated_workshop_files)
+  return &_impl_.associated_workshop_files_;
+}
+inline const ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& CWorkshop_SetItemPaymentRules_Request::_internal_associated_workshop_files(int index) const {
+  return _impl_.associated_workshop_files_.Get(index);
+}
+inline const ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule& CWorkshop_SetItemPaymentRules_Request::associated_workshop_files(int index) const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.associated_workshop_files)
+  return _internal_associated_workshop_files(index);
+}
+inline ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* CWorkshop_SetItemPaymentRules_Request::_internal_add_associated_workshop_files() {
+  return _impl_.associated_workshop_files_.Add();
+}
+inline ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* CWorkshop_SetItemPaymentRules_Request::add_associated_workshop_files() {
+  ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule* _add = _internal_add_associated_workshop_files();
+  // @@protoc_insertion_point(field_add:CWorkshop_SetItemPaymentRules_Request.associated_workshop_files)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_WorkshopItemPaymentRule >&
+CWorkshop_SetItemPaymentRules_Request::associated_workshop_files() const {
+  // @@protoc_insertion_point(field_list:CWorkshop_SetItemPaymentRules_Request.associated_workshop_files)
+  return _impl_.associated_workshop_files_;
+}
+
+// repeated .CWorkshop_SetItemPaymentRules_Request.PartnerItemPaymentRule partner_accounts = 4;
+inline int CWorkshop_SetItemPaymentRules_Request::_internal_partner_accounts_size() const {
+  return _impl_.partner_accounts_.size();
+}
+inline int CWorkshop_SetItemPaymentRules_Request::partner_accounts_size() const {
+  return _internal_partner_accounts_size();
+}
+inline void CWorkshop_SetItemPaymentRules_Request::clear_partner_accounts() {
+  _impl_.partner_accounts_.Clear();
+}
+inline ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* CWorkshop_SetItemPaymentRules_Request::mutable_partner_accounts(int index) {
+  // @@protoc_insertion_point(field_mutable:CWorkshop_SetItemPaymentRules_Request.partner_accounts)
+  return _impl_.partner_accounts_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule >*
+CWorkshop_SetItemPaymentRules_Request::mutable_partner_accounts() {
+  // @@protoc_insertion_point(field_mutable_list:CWorkshop_SetItemPaymentRules_Request.partner_accounts)
+  return &_impl_.partner_accounts_;
+}
+inline const ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& CWorkshop_SetItemPaymentRules_Request::_internal_partner_accounts(int index) const {
+  return _impl_.partner_accounts_.Get(index);
+}
+inline const ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule& CWorkshop_SetItemPaymentRules_Request::partner_accounts(int index) const {
+  // @@protoc_insertion_point(field_get:CWorkshop_SetItemPaymentRules_Request.partner_accounts)
+  return _internal_partner_accounts(index);
+}
+inline ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* CWorkshop_SetItemPaymentRules_Request::_internal_add_partner_accounts() {
+  return _impl_.partner_accounts_.Add();
+}
+inline ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* CWorkshop_SetItemPaymentRules_Request::add_partner_accounts() {
+  ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule* _add = _internal_add_partner_accounts();
+  // @@protoc_insertion_point(field_add:CWorkshop_SetItemPaymentRules_Request.partner_accounts)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CWorkshop_SetItemPaymentRules_Request_PartnerItemPaymentRule >&
+CWorkshop_SetItemPaymentRules_Request::partner_accounts() const {
+  // @@protoc_insertion_point(field_list:CWorkshop_SetItemPaymentRules_Request.partner_accounts)
+  return _impl_.partner_accounts_;
+}
+
+// -------------------------------------------------------------------
+
+// CWorkshop_SetItemPaymentRules_Response
+
+// -------------------------------------------------------------------
+
+// CBroadcast_PostGameDataFrame_Request
+
+// optional uint32 appid = 1;
+inline bool CBroadcast_PostGameDataFrame_Request::_internal_has_appid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CBroadcast_PostGameDataFrame_Request::has_appid() const {
+  return _internal_has_appid();
+}
+inline void CBroadcast_PostGameDataFrame_Request::clear_appid() {
+  _impl_.appid_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CBroadcast_PostGameDataFrame_Request::_internal_appid() const {
+  return _impl_.appid_;
+}
+inline uint32_t CBroadcast_PostGameDataFrame_Request::appid() const {
+  // @@protoc_insertion_point(field_get:CBroadcast_PostGameDataFrame_Request.appid)
+  return _internal_appid();
+}
+inline void CBroadcast_PostGameDataFrame_Request::_internal_set_appid(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.appid_ = value;
+}
+inline void CBroadcast_PostGameDataFrame_Request::set_appid(uint32_t value) {
+  _internal_set_appid(value);
+  // @@protoc_insertion_point(field_set:CBroadcast_PostGameDataFrame_Request.appid)
+}
+
+// optional fixed64 steamid = 2;
+inline bool CBroadcast_PostGameDataFrame_Request::_internal_has_steamid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CBroadcast_PostGameDataFrame_Request::has_steamid() const {
+  return _internal_has_steamid();
+}
+inline void CBroadcast_PostGameDataFrame_Request::clear_steamid() {
+  _impl_.steamid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CBroadcast_PostGameDataFrame_Request::_internal_steamid() const {
+  return _impl_.steamid_;
+}
+inline uint64_t CBroadcast_PostGameDataFrame_Request::steamid() const {
+  // @@protoc_insertion_point(field_get:CBroadcast_PostGameDataFrame_Request.steamid)
+  return _internal_steamid();
+}
+inline void CBroadcast_PostGameDataFrame_Request::_internal_set_steamid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.steamid_ = value;
+}
+inline void CBroadcast_PostGameDataFrame_Request::set_steamid(uint64_t value) {
+  _internal_set_steamid(value);
+  // @@protoc_insertion_point(field_set:CBroadcast_PostGameDataFrame_Request.steamid)
+}
+
+// optional fixed64 broadcast_id = 3;
+inline bool CBroadcast_PostGameDataFrame_Request::_internal_has_broadcast_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CBroadcast_PostGameDataFrame_Request::has_broadcast_id() const {
+  return _internal_has_broadcast_id();
+}
+inline void CBroadcast_PostGameDataFrame_Request::clear_broadcast_id() {
+  _impl_.broadcast_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t CBroadcast_PostGameDataFrame_Request::_internal_broadcast_id() const {
+  return _impl_.broadcast_id_;
+}
+inline uint64_t CBroadcast_PostGameDataFrame_Request::broadcast_id() const {
+  // @@protoc_insertion_point(field_get:CBroadcast_PostGameDataFrame_Request.broadcast_id)
+  return _internal_broadcast_id();
+}
+inline void CBroadcast_PostGameDataFrame_Request::_internal_set_broadcast_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.broadcast_id_ = value;
+}
+inline void CBroadcast_PostGameDataFrame_Request::set_broadcast_id(uint64_t value) {
+  _internal_set_broadcast_id(value);
+  // @@protoc_insertion_point(field_set:CBroadcast_PostGameDataFrame_Request.broadcast_id)
+}
+
+// optional bytes frame_data = 4;
+inline bool CBroadcast_PostGameDataFrame_Request::_internal_has_frame_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CBroadcast_PostGameDataFrame_Request::has_frame_data() const {
+  return _internal_has_frame_data();
+}
+inline void CBroadcast_PostGameDataFrame_Request::clear_frame_data() {
+  _impl_.frame_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CBroadcast_PostGameDataFrame_Request::frame_data() const {
+  // @@protoc_insertion_point(field_get:CBroadcast_PostGameDataFrame_Request.frame_data)
+  return _internal_frame_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CBroadcast_PostGameDataFrame_Request::set_frame_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.frame_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CBroadcast_PostGameDataFrame_Request.frame_data)
+}
+inline std::string* CBroadcast_PostGameDataFrame_Request::mutable_frame_data() {
+  std::string* _s = _internal_mutable_frame_data();
+  // @@protoc_insertion_point(field_mutable:CBroadcast_PostGameDataFrame_Request.frame_data)
+  return _s;
+}
+inline const std::string& CBroadcast_PostGameDataFrame_Request::_internal_frame_data() const {
+  return _impl_.frame_data_.Get();
+}
+inline void CBroadcast_PostGameDataFrame_Request::_internal_set_frame_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.frame_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CBroadcast_PostGameDataFrame_Request::_internal_mutable_frame_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.frame_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CBroadcast_PostGameDataFrame_Request::release_frame_data() {
+  // @@protoc_insertion_point(field_release:CBroadcast_PostGameDataFrame_Request.frame_data)
+  if (!_internal_has_frame_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.frame_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.frame_data_.IsDefault()) {
+    _impl_.frame_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CBroadcast_PostGameDataFrame_Request::set_allocated_frame_data(std::string* frame_data) {
+  if (frame_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.frame_data_.SetAllocated(frame_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.frame_data_.IsDefault()) {
+    _impl_.frame_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CBroadcast_PostGameDataFrame_Request.frame_data)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ESourceEngine> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ESourceEngine>() {
+  return ::ESourceEngine_descriptor();
+}
+template <> struct is_proto_enum< ::PartnerAccountType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::PartnerAccountType>() {
+  return ::PartnerAccountType_descriptor();
+}
+template <> struct is_proto_enum< ::GCConnectionStatus> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::GCConnectionStatus>() {
+  return ::GCConnectionStatus_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_gcsdk_5fgcmessages_2eproto
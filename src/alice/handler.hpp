@@ -27,13 +27,24 @@
 #include <unordered_map>
 #include <vector>
 #include <utility>
+#include <chrono>
 #include <memory>
 #include <type_traits>
 
+#include <google/protobuf/stubs/common.h>
+
 #include <alice/exception.hpp>
 #include <alice/delegate.hpp>
 #include <alice/dem.hpp>
 
+/// Arenas are available starting with protobuf 3.0
+#if GOOGLE_PROTOBUF_VERSION >= 3000000
+#define DOTA_ARENA 1
+#include <google/protobuf/arena.h>
+#else
+#define DOTA_ARENA 0
+#endif // GOOGLE_PROTOBUF_VERSION
+
 /// Registers and object with the handler.
 ///
 /// Invoking it is nessecary when the object should be created by the handler from the data
@@ -74,6 +85,24 @@ handler_->removeCallback<type_>( \
     handler_t::type<type_::id>::delegate_t::fromMemberFunc<object_, &object_::function_>(this) \
 );
 
+/// Subscribes a callback function to a protobuf message type.
+///
+/// Handler type and message id are looked up in the message registry at compile time. The
+/// callback receives the message as its own type, see handlerTypedCbType. Messages with typed
+/// subscriptions are parsed before any callback is invoked.
+///
+/// Example: handlerSubscribe( handler, CSVCMsg_Print, myObject, myFunction )
+///
+#define handlerSubscribe(handler_, message_, object_, function_) \
+handler_->subscribe<message_, object_, &object_::function_>(this);
+
+/// Removes a callback function which has been subscribed with handlerSubscribe.
+///
+/// Example: handlerUnsubscribe( handler, CSVCMsg_Print, myObject, myFunction )
+///
+#define handlerUnsubscribe(handler_, message_, object_, function_) \
+handler_->unsubscribe<message_, object_, &object_::function_>(this);
+
 /// Resolves the return type for a specific message type.
 ///
 /// This macro is best used as the function parameter for callback functions.
@@ -82,6 +111,12 @@ handler_->removeCallback<type_>( \
 ///
 #define handlerCbType(type_) handler_t::type<type_::id>::callbackObj_t
 
+/// Resolves the parameter type for callbacks subscribed with handlerSubscribe.
+///
+/// Example: void myCallbackFunction( handlerTypedCbType(CSVCMsg_Print) callbackObject );
+///
+#define handlerTypedCbType(message_) ::dota::cbObject<message_*, uint32_t>*
+
 // include detail namespace
 #include "handler_detail.hpp"
 
@@ -89,6 +124,7 @@ namespace google {
     namespace protobuf {
         // forward declaration
         class Message;
+        class Arena;
     }
 }
 namespace dota {
@@ -112,45 +148,87 @@ namespace dota {
     // forward declaration
     class entity;
     struct entity_delta;
+    struct tick_batch;
+
+    // forward declaration, specialized in message_registry.hpp
+    template <typename T>
+    struct message_traits;
 
     /// @defgroup CORE Core
     /// @{
 
-    /** Callback object getting supplied to each function invoked by the handler. */
+    /**
+     * Callback object getting supplied to each function invoked by the handler.
+     *
+     * Messages forwarded by the handler are parsed on the first call to get(), callbacks only
+     * looking at the tick or id don't pay for parsing. Until then msg is not set.
+     */
     template <typename Obj, typename Id>
     struct cbObject {
         /** Current tick */
         uint32_t tick;
-        /** The message in question */
+        /** The message in question, use get() for messages that are parsed lazily */
         Obj msg;
         /** Id for the message */
         const Id &id;
         /** Whether to take ownership of the memory */
         bool ownsPointer;
+        /** Pool to return the message to instead of deleting it, may be nullptr */
+        std::vector<Obj>* pool;
+        /** Creates msg on first access, nullptr once msg is set */
+        Obj (*loader)(void*);
+        /** Argument passed to the loader */
+        void* loaderData;
 
         /** Constructor, sets all values */
-        cbObject(Obj msg, uint32_t tick, const Id &id, bool ownsPointer = true)
-            : tick(tick), msg(std::move(msg)), id(id), ownsPointer(ownsPointer) { }
+        cbObject(Obj msg, uint32_t tick, const Id &id, bool ownsPointer = true, std::vector<Obj>* pool = nullptr)
+            : tick(tick), msg(std::move(msg)), id(id), ownsPointer(ownsPointer), pool(pool),
+              loader(nullptr), loaderData(nullptr) { }
 
         /** Destructor, deletes message if it's a pointer */
         ~cbObject() {
-            if (ownsPointer)
-                detail::destroyCallbackObjectHelper<Obj>::destroy(std::move(msg));
+            free();
         }
 
-        /** Casts message into the specified type and returns it. */
+        /** Casts message into the specified type and returns it, parses it if that hasn't happened yet. */
         template <typename T>
         T* get() {
+            if (loader != nullptr) {
+                msg = loader(loaderData);
+                loader = nullptr;
+            }
+
             return reinterpret_cast<T*>(msg);
         }
 
         /** Delete memory held by this object, does never lead to a double free, only works if Obj is a pointer */
         void free() {
+            if (!ownsPointer)
+                return;
+
+            // never parsed, nothing to free
+            if (loader != nullptr) {
+                ownsPointer = false;
+                return;
+            }
+
             ownsPointer = false;
-            detail::destroyCallbackObjectHelper<Obj>::destroy(std::move(msg));
+            if (pool != nullptr) {
+                pool->push_back(std::move(msg));
+            } else {
+                detail::destroyCallbackObjectHelper<Obj>::destroy(std::move(msg));
+            }
         }
     };
 
+    namespace detail {
+        /** Invokes F on self, instantiated for each typed subscription so the call can be inlined */
+        template <typename T, typename C, void (C::*F)(cbObject<T*, uint32_t>*)>
+        void typedCallback(void* self, void* o) {
+            (static_cast<C*>(self)->*F)(static_cast<cbObject<T*, uint32_t>*>(o));
+        }
+    }
+
     /**
      * This is the implementation of each of the handler functions for a specifc set of parameters.
      *
@@ -179,12 +257,38 @@ namespace dota {
             /** Own unique ID in the handler context */
             typedef IdSelf id;
 
+            /** Constructor */
+            handlersub() : revision(0), arena(nullptr), parseTimer(nullptr) {}
+
+            /** Copy constructor, don't allow copying */
+            handlersub(const handlersub&) = delete;
+
+            /** Destructor, frees pooled objects */
+            ~handlersub() {
+                clearPool();
+            }
+
             /** Returns true if the specified type has at least one callback function */
             bool hasCallback(const id_t& i) {
-                if (cb.size() <= i)
-                    return false;
+                return (cb.size() > i && !cb[i].empty()) || (typed.size() > i && !typed[i].empty());
+            }
+
+            /** Returns the number of callback functions for the specified type */
+            std::size_t countCallbacks(const id_t& i) {
+                std::size_t ret = 0;
+
+                if (cb.size() > i)
+                    ret += cb[i].size();
+
+                if (typed.size() > i)
+                    ret += typed[i].size();
+
+                return ret;
+            }
 
-                return !cb[i].empty();
+            /** Returns a counter which changes each time a callback is added or removed */
+            uint32_t getRevision() const {
+                return revision;
             }
 
             /** Registers a new callback handler for the specified ID */
@@ -193,6 +297,7 @@ namespace dota {
                     cb.resize(i+1);
 
                 cb[i].push_back(std::move(d));
+                ++revision;
             }
 
             /**
@@ -206,23 +311,88 @@ namespace dota {
                 for (auto it = cb[i].begin(); it != cb[i].end(); ++it) {
                     if (*it == d) {
                         cb[i].erase(it);
+                        ++revision;
                         break;
                     }
                 }
             }
 
+            /**
+             * Registers a typed callback for the specified ID, T is the type messages are parsed into.
+             *
+             * Replaces the object registered for the ID with T. Messages of the ID are dispatched by a
+             * function generated for T, without looking up the object.
+             */
+            template <typename T>
+            void registerTyped(const id_t& i, void* self, void (*fn)(void*, void*)) {
+                if (typed.size() <= i) {
+                    typed.resize(i+1);
+                    dispatch.resize(i+1, nullptr);
+                    dispatchParsed.resize(i+1, nullptr);
+                }
+
+                // pooled objects have to be of type T
+                if (dispatch[i] != &dispatchTyped<T>) {
+                    registerObject<T>(i);
+                    dispatch[i] = &dispatchTyped<T>;
+                    dispatchParsed[i] = &dispatchParsedTyped<T>;
+                }
+
+                typed[i].push_back(typed_t{self, fn});
+                ++revision;
+            }
+
+            /** Removes a typed callback for the specified ID */
+            void removeTyped(const id_t& i, void* self, void (*fn)(void*, void*)) {
+                if (typed.size() <= i)
+                    return;
+
+                for (auto it = typed[i].begin(); it != typed[i].end(); ++it) {
+                    if (it->self == self && it->fn == fn) {
+                        typed[i].erase(it);
+                        ++revision;
+                        break;
+                    }
+                }
+
+                // back to parsing on demand
+                if (typed[i].empty()) {
+                    dispatch[i] = nullptr;
+                    dispatchParsed[i] = nullptr;
+                }
+            }
+
+            /**
+             * Allocate objects created from now on on the given arena.
+             *
+             * Objects on an arena are not deleted by their callback object, they are released
+             * in bulk when the arena is reset. Passing nullptr allocates them on the heap again.
+             *
+             * Heap objects are not deleted either, they are kept in a pool per type and parsed
+             * into again the next time a message of that type arrives.
+             */
+            void setArena(google::protobuf::Arena* a) {
+                arena = a;
+            }
+
+            /** Adds the nanoseconds spent creating objects to t, nullptr to stop measuring */
+            void setParseTimer(uint64_t* t) {
+                parseTimer = t;
+            }
+
             /** Register a new object type for the specified ID */
             template <typename T>
             void registerObject(const id_t& i) {
-                if (obj.size() <= i)
+                if (obj.size() <= i) {
                     obj.resize(i+1, nullptr);
+                    pool.resize(i+1);
+                }
 
-                obj[i] = [](demMessage_t&& data) {
-                    obj_t msg = new T;
-                    if (!msg->ParseFromArray(data.msg, data.size))
-                            BOOST_THROW_EXCEPTION((handlerParserError()));
+                // pooled objects might be of the previous type
+                clearPool(i);
 
-                    return msg;
+                obj[i] = [](demMessage_t&& data, google::protobuf::Arena* arena, obj_t reuse) -> obj_t {
+                    return parse<T>(std::move(data), arena, static_cast<T*>(reuse));
                 };
             }
 
@@ -236,10 +406,19 @@ namespace dota {
                 return retrieve(i, std::move(data), tick, std::is_same<Obj, Data>{});
             }
 
+            /** Forwards a message parsed by retrieve to all handlers, the caller keeps ownership. */
+            void forwardParsed(const id_t& i, Obj msg, uint32_t tick);
+
             /** Deletes all registered callbacks and objects. */
             void clear() {
+                clearPool();
                 cb.clear();
+                typed.clear();
+                dispatch.clear();
+                dispatchParsed.clear();
                 obj.clear();
+                pool.clear();
+                ++revision;
             }
         private:
             /** Type for a list of registered callbacks */
@@ -248,10 +427,84 @@ namespace dota {
             cblist_t cb;
 
             /** Type for a list of registered objects */
-            typedef std::vector<obj_t (*)(Data&&)> objlist_t;
+            typedef std::vector<obj_t (*)(Data&&, google::protobuf::Arena*, obj_t)> objlist_t;
             /** Object list */
             objlist_t obj;
 
+            /** Parsed objects no longer in use, per type */
+            std::vector<std::vector<obj_t>> pool;
+
+            /** Callback for a typed subscription, the message type is only known to fn */
+            struct typed_t {
+                /** Object the callback is invoked on */
+                void* self;
+                /** Invokes the callback with a typed callback object */
+                void (*fn)(void*, void*);
+            };
+
+            /** Typed callback list */
+            std::vector<std::vector<typed_t>> typed;
+
+            /** Parses and forwards messages of IDs with typed callbacks, nullptr for all other IDs */
+            std::vector<void (*)(handlersub*, const id_t&, Data&&, uint32_t)> dispatch;
+
+            /** Forwards parsed messages of IDs with typed callbacks, nullptr for all other IDs */
+            std::vector<void (*)(handlersub*, const id_t&, Obj, uint32_t)> dispatchParsed;
+
+            /** Incremented each time the callback list changes */
+            uint32_t revision;
+
+            /** Arena objects are created on, nullptr for the heap */
+            google::protobuf::Arena* arena;
+
+            /** Accumulates time spent creating objects if set */
+            uint64_t* parseTimer;
+
+            /** Creates the object for the specified ID, reusing a pooled one if possible */
+            obj_t create(const id_t& i, Data &&data);
+
+            /** Creates an object of type T for the specified ID, reusing a pooled one if possible */
+            template <typename T>
+            T* createTyped(const id_t& i, Data &&data);
+
+            /** Parses data into reuse or a new T */
+            template <typename T>
+            static T* parse(Data &&data, google::protobuf::Arena* arena, T* reuse);
+
+            /** Forwards a message to typed and untyped callbacks, generated for the type of the ID */
+            template <typename T>
+            static void dispatchTyped(handlersub* self, const id_t& i, Data &&data, uint32_t tick);
+
+            /** Forwards a parsed message to typed and untyped callbacks, generated for the type of the ID */
+            template <typename T>
+            static void dispatchParsedTyped(handlersub* self, const id_t& i, Obj msg, uint32_t tick);
+
+            /** Deletes all pooled objects of the specified ID */
+            void clearPool(const id_t& i) {
+                clearPool(i, std::is_same<Obj, Data>());
+            }
+
+            /** Deletes all pooled objects of the specified ID */
+            void clearPool(const id_t& i, std::false_type) {
+                for (auto &o : pool[i]) {
+                    detail::destroyCallbackObjectHelper<Obj>::destroy(std::move(o));
+                }
+
+                pool[i].clear();
+            }
+
+            /** Data that's already in message format is never pooled and isn't ours to delete */
+            void clearPool(const id_t& i, std::true_type) {
+                pool[i].clear();
+            }
+
+            /** Deletes all pooled objects */
+            void clearPool() {
+                for (id_t i = 0; i < pool.size(); ++i) {
+                    clearPool(i);
+                }
+            }
+
             /** Called if the message needs to be parsed from the data */
             void forward(const id_t& i, Data &&data, uint32_t tick, std::false_type);
             /** Called if the data is already in message format */
@@ -282,6 +535,24 @@ namespace dota {
                 return false; // just to fix compiler warnings
             }
 
+            template <typename Type, typename Id>
+            std::size_t countCallbacks(const Id& i) {
+                BOOST_THROW_EXCEPTION( handlerNoConversionAvailable() );
+                return 0; // just to fix compiler warnings
+            }
+
+            uint32_t getRevision() const {
+                return 0;
+            }
+
+            void setArena(google::protobuf::Arena* a) {
+                // end of recursion
+            }
+
+            void setParseTimer(uint64_t* t) {
+                // end of recursion
+            }
+
             template<typename Type, typename Id, typename Delegate>
             void registerCallback(const Id& i, Delegate&& d, bool prefix = false) {
                 BOOST_THROW_EXCEPTION( handlerNoConversionAvailable() );
@@ -297,11 +568,26 @@ namespace dota {
                 BOOST_THROW_EXCEPTION( handlerNoConversionAvailable() );
             }
 
+            template<typename Type, typename T, typename Id>
+            void registerTyped(const Id& i, void* self, void (*fn)(void*, void*)) {
+                BOOST_THROW_EXCEPTION( handlerNoConversionAvailable() );
+            }
+
+            template<typename Type, typename Id>
+            void removeTyped(const Id& i, void* self, void (*fn)(void*, void*)) {
+                BOOST_THROW_EXCEPTION( handlerNoConversionAvailable() );
+            }
+
             template <typename Type, typename Id, typename Data>
             void forward(const Id& i, Data &&data, uint32_t tick) {
                 BOOST_THROW_EXCEPTION( handlerNoConversionAvailable() );
             }
 
+            template <typename Type, typename Id, typename Obj>
+            void forwardParsed(const Id& i, Obj msg, uint32_t tick) {
+                BOOST_THROW_EXCEPTION( handlerNoConversionAvailable() );
+            }
+
             template <typename Type>
             void clear() {
                 BOOST_THROW_EXCEPTION( handlerNoConversionAvailable() );
@@ -321,6 +607,29 @@ namespace dota {
                 return hasCallback<Type, Id>(i, std::is_same<typename T1::id, Type>{});
             }
 
+            /** Returns the number of callback functions for the specified ID. */
+            template <typename Type, typename Id>
+            std::size_t countCallbacks(const Id& i) {
+                return countCallbacks<Type, Id>(i, std::is_same<typename T1::id, Type>{});
+            }
+
+            /** Returns a counter which changes each time a callback of any type is added or removed. */
+            uint32_t getRevision() const {
+                return subhandler.getRevision() + child.getRevision();
+            }
+
+            /** Allocate the objects of all types on the given arena, nullptr to use the heap */
+            void setArena(google::protobuf::Arena* a) {
+                subhandler.setArena(a);
+                child.setArena(a);
+            }
+
+            /** Adds the nanoseconds spent creating objects of any type to t, nullptr to stop measuring */
+            void setParseTimer(uint64_t* t) {
+                subhandler.setParseTimer(t);
+                child.setParseTimer(t);
+            }
+
             /** Register a callback for a specified type */
             template<typename Type, typename Id, typename Delegate>
             void registerCallback(const Id& i, Delegate&& d) {
@@ -339,12 +648,46 @@ namespace dota {
                 registerObject<Type, T, Id>(i, std::is_same<typename T1::id, Type>{});
             }
 
+            /** Subscribe F to messages of type T, handler type and id are taken from the message registry */
+            template <typename T, typename C, void (C::*F)(cbObject<T*, uint32_t>*)>
+            void subscribe(C* self) {
+                registerTyped<typename message_traits<T>::type, T>(
+                    (uint32_t)message_traits<T>::id, self, &detail::typedCallback<T, C, F>
+                );
+            }
+
+            /** Removes a callback subscribed with subscribe */
+            template <typename T, typename C, void (C::*F)(cbObject<T*, uint32_t>*)>
+            void unsubscribe(C* self) {
+                removeTyped<typename message_traits<T>::type>(
+                    (uint32_t)message_traits<T>::id, self, &detail::typedCallback<T, C, F>
+                );
+            }
+
+            /** Register a typed callback for a specific ID of the selected type, use subscribe instead */
+            template<typename Type, typename T, typename Id>
+            void registerTyped(const Id& i, void* self, void (*fn)(void*, void*)) {
+                registerTyped<Type, T, Id>(i, self, fn, std::is_same<typename T1::id, Type>{});
+            }
+
+            /** Removes a typed callback for a specific ID of the selected type, use unsubscribe instead */
+            template<typename Type, typename Id>
+            void removeTyped(const Id& i, void* self, void (*fn)(void*, void*)) {
+                removeTyped<Type, Id>(i, self, fn, std::is_same<typename T1::id, Type>{});
+            }
+
             /** Forwards a message to all registered handlers */
             template <typename Type, typename Id, typename Data>
             void forward(Id i, Data data, uint32_t tick) {
                 forward<Type, Id, Data>(std::move(i), std::move(data), tick, std::is_same<typename T1::id, Type>{});
             }
 
+            /** Forwards a message that has already been parsed, e.g. with retrieve, the caller keeps ownership */
+            template <typename Type, typename Id, typename Obj>
+            void forwardParsed(Id i, Obj msg, uint32_t tick) {
+                forwardParsed<Type, Id, Obj>(std::move(i), msg, tick, std::is_same<typename T1::id, Type>{});
+            }
+
             #ifndef _MSC_VER
             /** Retrieve a parsed callback object without forwarding it. Not available when compiling with visual studio. */
             template <unsigned Type, typename Id, typename Data>
@@ -381,6 +724,13 @@ namespace dota {
             template <typename Type, typename Id>
             bool hasCallback(const Id& i, std::false_type);
 
+            /** Implementation for countCallbacks */
+            template <typename Type, typename Id>
+            std::size_t countCallbacks(const Id& i, std::true_type);
+            /** Implementation for countCallbacks */
+            template <typename Type, typename Id>
+            std::size_t countCallbacks(const Id& i, std::false_type);
+
             /** Implementation for registerCallback */
             template<typename Type, typename Id, typename Delegate>
             void registerCallback(const Id& i, Delegate&& d, std::true_type);
@@ -402,6 +752,20 @@ namespace dota {
             template<typename Type, typename T, typename Id>
             void registerObject(const Id& i, std::false_type);
 
+            /** Implementation for registerTyped */
+            template<typename Type, typename T, typename Id>
+            void registerTyped(const Id& i, void* self, void (*fn)(void*, void*), std::true_type);
+            /** Implementation for registerTyped */
+            template<typename Type, typename T, typename Id>
+            void registerTyped(const Id& i, void* self, void (*fn)(void*, void*), std::false_type);
+
+            /** Implementation for removeTyped */
+            template<typename Type, typename Id>
+            void removeTyped(const Id& i, void* self, void (*fn)(void*, void*), std::true_type);
+            /** Implementation for removeTyped */
+            template<typename Type, typename Id>
+            void removeTyped(const Id& i, void* self, void (*fn)(void*, void*), std::false_type);
+
             /** Implementation for forward */
             template <typename Type, typename Id, typename Data>
             void forward(Id i, Data data, uint32_t tick, std::true_type);
@@ -409,6 +773,13 @@ namespace dota {
             template <typename Type, typename Id, typename Data>
             void forward(Id i, Data data, uint32_t tick, std::false_type);
 
+            /** Implementation for forwardParsed */
+            template <typename Type, typename Id, typename Obj>
+            void forwardParsed(Id i, Obj msg, uint32_t tick, std::true_type);
+            /** Implementation for forwardParsed */
+            template <typename Type, typename Id, typename Obj>
+            void forwardParsed(Id i, Obj msg, uint32_t tick, std::false_type);
+
             #ifndef _MSC_VER
             /** Implementation for retrieve */
             template <unsigned Type, typename Id, typename Data>
@@ -445,6 +816,13 @@ namespace dota {
      */
     struct msgEntityDelta { static const uint32_t id = 5; };
 
+    /**
+     * Struct for all events of a tick, delivered at once.
+     *
+     * Subscribe with an id of 0. Collecting batches only happens while there are subscribers.
+     */
+    struct msgTick { static const uint32_t id = 6; };
+
     /** Type for our default handler */
     typedef handler<
         handlersub< uint32_t, uint32_t, msgStatus >,
@@ -452,7 +830,8 @@ namespace dota {
         handlersub< ::google::protobuf::Message*, demMessage_t, msgUser >,
         handlersub< ::google::protobuf::Message*, demMessage_t, msgNet >,
         handlersub< entity*, entity*, msgEntity >,
-        handlersub< entity_delta*, entity_delta*, msgEntityDelta >
+        handlersub< entity_delta*, entity_delta*, msgEntityDelta >,
+        handlersub< tick_batch*, tick_batch*, msgTick >
     > handler_t;
 
     /// @}
@@ -20,15 +20,146 @@
  *
  */
 
+template <typename Obj, typename Data, typename IdSelf>
+typename handlersub<Obj, Data, IdSelf>::obj_t handlersub<Obj, Data, IdSelf>::
+create(const id_t& i, Data &&data) {
+    obj_t reuse = nullptr;
+    if (arena == nullptr && !pool[i].empty()) {
+        reuse = pool[i].back();
+        pool[i].pop_back();
+    }
+
+    if (parseTimer == nullptr)
+        return obj[i](std::move(data), arena, reuse);
+
+    const auto start = std::chrono::steady_clock::now();
+    obj_t ret = obj[i](std::move(data), arena, reuse);
+    *parseTimer += std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+
+    return ret;
+}
+
+template <typename Obj, typename Data, typename IdSelf>
+template <typename T>
+T* handlersub<Obj, Data, IdSelf>::
+createTyped(const id_t& i, Data &&data) {
+    // pooled objects are of type T as long as the ID has typed callbacks
+    T* reuse = nullptr;
+    if (arena == nullptr && !pool[i].empty()) {
+        reuse = static_cast<T*>(pool[i].back());
+        pool[i].pop_back();
+    }
+
+    if (parseTimer == nullptr)
+        return parse<T>(std::move(data), arena, reuse);
+
+    const auto start = std::chrono::steady_clock::now();
+    T* ret = parse<T>(std::move(data), arena, reuse);
+    *parseTimer += std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+
+    return ret;
+}
+
+template <typename Obj, typename Data, typename IdSelf>
+template <typename T>
+T* handlersub<Obj, Data, IdSelf>::
+parse(Data &&data, google::protobuf::Arena* arena, T* reuse) {
+    data.decompress();
+
+    T* msg = reuse;
+    if (msg == nullptr) {
+        #if DOTA_ARENA
+        msg = arena ? google::protobuf::Arena::CreateMessage<T>(arena) : new T;
+        #else
+        msg = new T;
+        #endif // DOTA_ARENA
+    }
+
+    // clears the previous contents of reused objects
+    if (!msg->ParseFromArray(data.msg, data.size))
+        BOOST_THROW_EXCEPTION((handlerParserError()));
+
+    return msg;
+}
+
+template <typename Obj, typename Data, typename IdSelf>
+template <typename T>
+void handlersub<Obj, Data, IdSelf>::
+dispatchTyped(handlersub* self, const id_t& i, Data &&data, uint32_t tick) {
+    T* msg = self->template createTyped<T>(i, std::move(data));
+
+    // returns the message to the pool unless it lives on the arena
+    cbObject<Obj, uint32_t> o(msg, tick, i, self->arena == nullptr, &self->pool[i]);
+    cbObject<T*, uint32_t> t(msg, tick, i, false);
+
+    for (auto &d : self->typed[i]) {
+        d.fn(d.self, &t);
+    }
+
+    if (self->cb.size() <= i)
+        return;
+
+    for (auto &d : self->cb[i]) {
+        d(&o);
+    }
+}
+
+template <typename Obj, typename Data, typename IdSelf>
+template <typename T>
+void handlersub<Obj, Data, IdSelf>::
+dispatchParsedTyped(handlersub* self, const id_t& i, Obj msg, uint32_t tick) {
+    // owned by the caller
+    cbObject<Obj, uint32_t> o(msg, tick, i, false);
+    cbObject<T*, uint32_t> t(static_cast<T*>(msg), tick, i, false);
+
+    for (auto &d : self->typed[i]) {
+        d.fn(d.self, &t);
+    }
+
+    if (self->cb.size() <= i)
+        return;
+
+    for (auto &d : self->cb[i]) {
+        d(&o);
+    }
+}
+
+template <typename Obj, typename Data, typename IdSelf>
+void handlersub<Obj, Data, IdSelf>::
+forwardParsed(const id_t& i, Obj msg, uint32_t tick) {
+    // check for callback handlers
+    if (!hasCallback(i))
+        return;
+
+    if (dispatchParsed.size() > i && dispatchParsed[i] != nullptr) {
+        dispatchParsed[i](this, i, msg, tick);
+        return;
+    }
+
+    // owned by the caller
+    cbObject<Obj, uint32_t> o(msg, tick, i, false);
+
+    for (auto &d : cb[i]) {
+        d(&o);
+    }
+}
+
 template <typename Obj, typename Data, typename IdSelf>
 void handlersub<Obj, Data, IdSelf>::
 forward(const id_t& i, Data &&data, uint32_t tick, std::false_type) {
     // check for callback handlers
-    if (cb.size() <= i)
+    if (!hasCallback(i))
         return;
 
-    if (cb[i].empty())
+    // the type is known for typed callbacks, no need to look up the object
+    if (dispatch.size() > i && dispatch[i] != nullptr) {
+        dispatch[i](this, i, std::move(data), tick);
         return;
+    }
 
     // get conversion object
     if (obj.size() <= i || obj[i] == nullptr)
@@ -36,8 +167,20 @@ forward(const id_t& i, Data &&data, uint32_t tick, std::false_type) {
             << (typename EArgT<1, id_t>::info(i))
         );
 
-    // create object
-    cbObject<Obj, uint32_t> o(obj[i](std::move(data)), tick, i);
+    // data required to create the object once a callback asks for it
+    struct pending {
+        handlersub* self;
+        const id_t& i;
+        Data data;
+    } p {this, i, std::move(data)};
+
+    // the arena owns the object if there is one, otherwise it goes back into the pool
+    cbObject<Obj, uint32_t> o(Obj(), tick, i, arena == nullptr, &pool[i]);
+    o.loaderData = &p;
+    o.loader = [](void* d) -> Obj {
+        pending* p = static_cast<pending*>(d);
+        return p->self->create(p->i, std::move(p->data));
+    };
 
     // forward to definitive handlers
     for (auto &d : cb[i]) {
@@ -74,7 +217,7 @@ retrieve(const id_t& i, Data &&data, uint32_t tick, std::false_type) {
         );
 
     // return object
-    return cbObject<Obj, uint32_t>(obj[i](std::move(data)), tick, i);
+    return cbObject<Obj, uint32_t>(create(i, std::move(data)), tick, i, arena == nullptr, &pool[i]);
 }
 
 template <typename Obj, typename Data, typename IdSelf>
@@ -95,6 +238,18 @@ bool handler<T1, Rest...>::hasCallback(const Id& i, std::false_type) {
     return child.template hasCallback<Type, Id>(i);
 }
 
+template <typename T1, typename... Rest>
+template <typename Type, typename Id>
+std::size_t handler<T1, Rest...>::countCallbacks(const Id& i, std::true_type) {
+    return subhandler.countCallbacks(i);
+}
+
+template <typename T1, typename... Rest>
+template <typename Type, typename Id>
+std::size_t handler<T1, Rest...>::countCallbacks(const Id& i, std::false_type) {
+    return child.template countCallbacks<Type, Id>(i);
+}
+
 template <typename T1, typename... Rest>
 template<typename Type, typename Id, typename Delegate>
 void handler<T1, Rest...>::registerCallback(const Id& i, Delegate&& d, std::true_type) {
@@ -131,6 +286,30 @@ void handler<T1, Rest...>::registerObject(const Id& i, std::false_type) {
     child.template registerObject<Type, T>(i);
 }
 
+template <typename T1, typename... Rest>
+template<typename Type, typename T, typename Id>
+void handler<T1, Rest...>::registerTyped(const Id& i, void* self, void (*fn)(void*, void*), std::true_type) {
+    subhandler.template registerTyped<T>(i, self, fn);
+}
+
+template <typename T1, typename... Rest>
+template<typename Type, typename T, typename Id>
+void handler<T1, Rest...>::registerTyped(const Id& i, void* self, void (*fn)(void*, void*), std::false_type) {
+    child.template registerTyped<Type, T>(i, self, fn);
+}
+
+template <typename T1, typename... Rest>
+template<typename Type, typename Id>
+void handler<T1, Rest...>::removeTyped(const Id& i, void* self, void (*fn)(void*, void*), std::true_type) {
+    subhandler.removeTyped(i, self, fn);
+}
+
+template <typename T1, typename... Rest>
+template<typename Type, typename Id>
+void handler<T1, Rest...>::removeTyped(const Id& i, void* self, void (*fn)(void*, void*), std::false_type) {
+    child.template removeTyped<Type>(i, self, fn);
+}
+
 template <typename T1, typename... Rest>
 template <typename Type, typename Id, typename Data>
 void handler<T1, Rest...>::forward(Id i, Data data, uint32_t tick, std::true_type) {
@@ -143,6 +322,18 @@ void handler<T1, Rest...>::forward(Id i, Data data, uint32_t tick, std::false_ty
 	child.template forward<Type>(std::move(i), std::move(data), std::move(tick));
 }
 
+template <typename T1, typename... Rest>
+template <typename Type, typename Id, typename Obj>
+void handler<T1, Rest...>::forwardParsed(Id i, Obj msg, uint32_t tick, std::true_type) {
+    subhandler.forwardParsed(std::move(i), msg, tick);
+}
+
+template <typename T1, typename... Rest>
+template <typename Type, typename Id, typename Obj>
+void handler<T1, Rest...>::forwardParsed(Id i, Obj msg, uint32_t tick, std::false_type) {
+    child.template forwardParsed<Type>(std::move(i), msg, tick);
+}
+
 #ifndef _MSC_VER
 template <typename T1, typename... Rest>
 template <unsigned Type, typename Id, typename Data>
@@ -0,0 +1,226 @@
+/**
+ * @file message_registry.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef _DOTA_MESSAGE_REGISTRY_HPP_
+#define _DOTA_MESSAGE_REGISTRY_HPP_
+
+#include <cstdint>
+
+#include <alice/demo.pb.h>
+#include <alice/netmessages.pb.h>
+#include <alice/usermessages.pb.h>
+#include <alice/dota_usermessages.pb.h>
+
+#include <alice/handler.hpp>
+
+/// Invokes X( handler type, message id, protobuf type ) for each message the parser knows about.
+///
+/// DEM_SignonPacket shares CDemoPacket with DEM_Packet and is not part of the list. The user
+/// messages AddUnitToSelection, CombatLogData, CharacterSpeakConcept and TournamentDrop are not
+/// registered.
+///
+#define DOTA_MESSAGES(X) \
+    X( msgDem,  DEM_FileHeader,                   CDemoFileHeader ) \
+    X( msgDem,  DEM_FileInfo,                     CDemoFileInfo ) \
+    X( msgDem,  DEM_SyncTick,                     CDemoSyncTick ) \
+    X( msgDem,  DEM_SendTables,                   CDemoSendTables ) \
+    X( msgDem,  DEM_ClassInfo,                    CDemoClassInfo ) \
+    X( msgDem,  DEM_StringTables,                 CDemoStringTables ) \
+    X( msgDem,  DEM_Packet,                       CDemoPacket ) \
+    X( msgDem,  DEM_ConsoleCmd,                   CDemoConsoleCmd ) \
+    X( msgDem,  DEM_CustomData,                   CDemoCustomData ) \
+    X( msgDem,  DEM_CustomDataCallbacks,          CDemoCustomDataCallbacks ) \
+    X( msgDem,  DEM_UserCmd,                      CDemoUserCmd ) \
+    X( msgDem,  DEM_FullPacket,                   CDemoFullPacket ) \
+    X( msgDem,  DEM_SaveGame,                     CDemoSaveGame ) \
+    \
+    X( msgNet,  net_NOP,                          CNETMsg_NOP ) \
+    X( msgNet,  net_Disconnect,                   CNETMsg_Disconnect ) \
+    X( msgNet,  net_File,                         CNETMsg_File ) \
+    X( msgNet,  net_SplitScreenUser,              CNETMsg_SplitScreenUser ) \
+    X( msgNet,  net_Tick,                         CNETMsg_Tick ) \
+    X( msgNet,  net_StringCmd,                    CNETMsg_StringCmd ) \
+    X( msgNet,  net_SetConVar,                    CNETMsg_SetConVar ) \
+    X( msgNet,  net_SignonState,                  CNETMsg_SignonState ) \
+    \
+    X( msgNet,  svc_ServerInfo,                   CSVCMsg_ServerInfo ) \
+    X( msgNet,  svc_SendTable,                    CSVCMsg_SendTable ) \
+    X( msgNet,  svc_ClassInfo,                    CSVCMsg_ClassInfo ) \
+    X( msgNet,  svc_SetPause,                     CSVCMsg_SetPause ) \
+    X( msgNet,  svc_CreateStringTable,            CSVCMsg_CreateStringTable ) \
+    X( msgNet,  svc_UpdateStringTable,            CSVCMsg_UpdateStringTable ) \
+    X( msgNet,  svc_VoiceInit,                    CSVCMsg_VoiceInit ) \
+    X( msgNet,  svc_VoiceData,                    CSVCMsg_VoiceData ) \
+    X( msgNet,  svc_Print,                        CSVCMsg_Print ) \
+    X( msgNet,  svc_Sounds,                       CSVCMsg_Sounds ) \
+    X( msgNet,  svc_SetView,                      CSVCMsg_SetView ) \
+    X( msgNet,  svc_FixAngle,                     CSVCMsg_FixAngle ) \
+    X( msgNet,  svc_CrosshairAngle,               CSVCMsg_CrosshairAngle ) \
+    X( msgNet,  svc_BSPDecal,                     CSVCMsg_BSPDecal ) \
+    X( msgNet,  svc_SplitScreen,                  CSVCMsg_SplitScreen ) \
+    X( msgNet,  svc_UserMessage,                  CSVCMsg_UserMessage ) \
+    X( msgNet,  svc_GameEvent,                    CSVCMsg_GameEvent ) \
+    X( msgNet,  svc_PacketEntities,               CSVCMsg_PacketEntities ) \
+    X( msgNet,  svc_TempEntities,                 CSVCMsg_TempEntities ) \
+    X( msgNet,  svc_Prefetch,                     CSVCMsg_Prefetch ) \
+    X( msgNet,  svc_Menu,                         CSVCMsg_Menu ) \
+    X( msgNet,  svc_GameEventList,                CSVCMsg_GameEventList ) \
+    X( msgNet,  svc_GetCvarValue,                 CSVCMsg_GetCvarValue ) \
+    X( msgNet,  svc_PacketReliable,               CSVCMsg_PacketReliable ) \
+    X( msgNet,  svc_FullFrameSplit,               CSVCMsg_FullFrameSplit ) \
+    \
+    X( msgUser, UM_AchievementEvent,              CUserMsg_AchievementEvent ) \
+    X( msgUser, UM_CloseCaption,                  CUserMsg_CloseCaption ) \
+    X( msgUser, UM_CurrentTimescale,              CUserMsg_CurrentTimescale ) \
+    X( msgUser, UM_DesiredTimescale,              CUserMsg_DesiredTimescale ) \
+    X( msgUser, UM_Fade,                          CUserMsg_Fade ) \
+    X( msgUser, UM_GameTitle,                     CUserMsg_GameTitle ) \
+    X( msgUser, UM_Geiger,                        CUserMsg_Geiger ) \
+    X( msgUser, UM_HintText,                      CUserMsg_HintText ) \
+    X( msgUser, UM_HudMsg,                        CUserMsg_HudMsg ) \
+    X( msgUser, UM_HudText,                       CUserMsg_HudText ) \
+    X( msgUser, UM_KeyHintText,                   CUserMsg_KeyHintText ) \
+    X( msgUser, UM_MessageText,                   CUserMsg_MessageText ) \
+    X( msgUser, UM_RequestState,                  CUserMsg_RequestState ) \
+    X( msgUser, UM_ResetHUD,                      CUserMsg_ResetHUD ) \
+    X( msgUser, UM_Rumble,                        CUserMsg_Rumble ) \
+    X( msgUser, UM_SayText,                       CUserMsg_SayText ) \
+    X( msgUser, UM_SayText2,                      CUserMsg_SayText2 ) \
+    X( msgUser, UM_SayTextChannel,                CUserMsg_SayTextChannel ) \
+    X( msgUser, UM_Shake,                         CUserMsg_Shake ) \
+    X( msgUser, UM_ShakeDir,                      CUserMsg_ShakeDir ) \
+    X( msgUser, UM_StatsCrawlMsg,                 CUserMsg_StatsCrawlMsg ) \
+    X( msgUser, UM_StatsSkipState,                CUserMsg_StatsSkipState ) \
+    X( msgUser, UM_TextMsg,                       CUserMsg_TextMsg ) \
+    X( msgUser, UM_Tilt,                          CUserMsg_Tilt ) \
+    X( msgUser, UM_Train,                         CUserMsg_Train ) \
+    X( msgUser, UM_VGUIMenu,                      CUserMsg_VGUIMenu ) \
+    X( msgUser, UM_VoiceMask,                     CUserMsg_VoiceMask ) \
+    X( msgUser, UM_VoiceSubtitle,                 CUserMsg_VoiceSubtitle ) \
+    X( msgUser, UM_SendAudio,                     CUserMsg_SendAudio ) \
+    X( msgUser, UM_CameraTransition,              CUserMsg_CameraTransition ) \
+    \
+    X( msgUser, DOTA_UM_AIDebugLine,              CDOTAUserMsg_AIDebugLine ) \
+    X( msgUser, DOTA_UM_ChatEvent,                CDOTAUserMsg_ChatEvent ) \
+    X( msgUser, DOTA_UM_CombatHeroPositions,      CDOTAUserMsg_CombatHeroPositions ) \
+    X( msgUser, DOTA_UM_CombatLogShowDeath,       CDOTAUserMsg_CombatLogShowDeath ) \
+    X( msgUser, DOTA_UM_CreateLinearProjectile,   CDOTAUserMsg_CreateLinearProjectile ) \
+    X( msgUser, DOTA_UM_DestroyLinearProjectile,  CDOTAUserMsg_DestroyLinearProjectile ) \
+    X( msgUser, DOTA_UM_DodgeTrackingProjectiles, CDOTAUserMsg_DodgeTrackingProjectiles ) \
+    X( msgUser, DOTA_UM_GlobalLightColor,         CDOTAUserMsg_GlobalLightColor ) \
+    X( msgUser, DOTA_UM_GlobalLightDirection,     CDOTAUserMsg_GlobalLightDirection ) \
+    X( msgUser, DOTA_UM_InvalidCommand,           CDOTAUserMsg_InvalidCommand ) \
+    X( msgUser, DOTA_UM_LocationPing,             CDOTAUserMsg_LocationPing ) \
+    X( msgUser, DOTA_UM_MapLine,                  CDOTAUserMsg_MapLine ) \
+    X( msgUser, DOTA_UM_MiniKillCamInfo,          CDOTAUserMsg_MiniKillCamInfo ) \
+    X( msgUser, DOTA_UM_MinimapDebugPoint,        CDOTAUserMsg_MinimapDebugPoint ) \
+    X( msgUser, DOTA_UM_MinimapEvent,             CDOTAUserMsg_MinimapEvent ) \
+    X( msgUser, DOTA_UM_NevermoreRequiem,         CDOTAUserMsg_NevermoreRequiem ) \
+    X( msgUser, DOTA_UM_OverheadEvent,            CDOTAUserMsg_OverheadEvent ) \
+    X( msgUser, DOTA_UM_SetNextAutobuyItem,       CDOTAUserMsg_SetNextAutobuyItem ) \
+    X( msgUser, DOTA_UM_SharedCooldown,           CDOTAUserMsg_SharedCooldown ) \
+    X( msgUser, DOTA_UM_SpectatorPlayerClick,     CDOTAUserMsg_SpectatorPlayerClick ) \
+    X( msgUser, DOTA_UM_TutorialTipInfo,          CDOTAUserMsg_TutorialTipInfo ) \
+    X( msgUser, DOTA_UM_UnitEvent,                CDOTAUserMsg_UnitEvent ) \
+    X( msgUser, DOTA_UM_ParticleManager,          CDOTAUserMsg_ParticleManager ) \
+    X( msgUser, DOTA_UM_BotChat,                  CDOTAUserMsg_BotChat ) \
+    X( msgUser, DOTA_UM_HudError,                 CDOTAUserMsg_HudError ) \
+    X( msgUser, DOTA_UM_ItemPurchased,            CDOTAUserMsg_ItemPurchased ) \
+    X( msgUser, DOTA_UM_Ping,                     CDOTAUserMsg_Ping ) \
+    X( msgUser, DOTA_UM_ItemFound,                CDOTAUserMsg_ItemFound ) \
+    X( msgUser, DOTA_UM_SwapVerify,               CDOTAUserMsg_SwapVerify ) \
+    X( msgUser, DOTA_UM_WorldLine,                CDOTAUserMsg_WorldLine ) \
+    X( msgUser, DOTA_UM_ItemAlert,                CDOTAUserMsg_ItemAlert ) \
+    X( msgUser, DOTA_UM_HalloweenDrops,           CDOTAUserMsg_HalloweenDrops ) \
+    X( msgUser, DOTA_UM_ChatWheel,                CDOTAUserMsg_ChatWheel ) \
+    X( msgUser, DOTA_UM_ReceivedXmasGift,         CDOTAUserMsg_ReceivedXmasGift ) \
+    X( msgUser, DOTA_UM_UpdateSharedContent,      CDOTAUserMsg_UpdateSharedContent ) \
+    X( msgUser, DOTA_UM_TutorialRequestExp,       CDOTAUserMsg_TutorialRequestExp ) \
+    X( msgUser, DOTA_UM_TutorialPingMinimap,      CDOTAUserMsg_TutorialPingMinimap ) \
+    X( msgUser, DOTA_UM_GamerulesStateChanged,    CDOTA_UM_GamerulesStateChanged ) \
+    X( msgUser, DOTA_UM_ShowSurvey,               CDOTAUserMsg_ShowSurvey ) \
+    X( msgUser, DOTA_UM_TutorialFade,             CDOTAUserMsg_TutorialFade ) \
+    X( msgUser, DOTA_UM_AddQuestLogEntry,         CDOTAUserMsg_AddQuestLogEntry ) \
+    X( msgUser, DOTA_UM_SendStatPopup,            CDOTAUserMsg_SendStatPopup ) \
+    X( msgUser, DOTA_UM_TutorialFinish,           CDOTAUserMsg_TutorialFinish ) \
+    X( msgUser, DOTA_UM_SendRoshanPopup,          CDOTAUserMsg_SendRoshanPopup ) \
+    X( msgUser, DOTA_UM_SendGenericToolTip,       CDOTAUserMsg_SendGenericToolTip ) \
+    X( msgUser, DOTA_UM_SendFinalGold,            CDOTAUserMsg_SendFinalGold ) \
+    X( msgUser, DOTA_UM_CustomMsg,                CDOTAUserMsg_CustomMsg ) \
+    X( msgUser, DOTA_UM_CoachHUDPing,             CDOTAUserMsg_CoachHUDPing ) \
+    X( msgUser, DOTA_UM_ClientLoadGridNav,        CDOTAUserMsg_ClientLoadGridNav ) \
+    X( msgUser, DOTA_UM_AbilityPing,              CDOTAUserMsg_AbilityPing ) \
+    X( msgUser, DOTA_UM_ShowGenericPopup,         CDOTAUserMsg_ShowGenericPopup ) \
+    X( msgUser, DOTA_UM_VoteStart,                CDOTAUserMsg_VoteStart ) \
+    X( msgUser, DOTA_UM_VoteUpdate,               CDOTAUserMsg_VoteUpdate ) \
+    X( msgUser, DOTA_UM_VoteEnd,                  CDOTAUserMsg_VoteEnd ) \
+    X( msgUser, DOTA_UM_BoosterState,             CDOTAUserMsg_BoosterState ) \
+    X( msgUser, DOTA_UM_WillPurchaseAlert,        CDOTAUserMsg_WillPurchaseAlert ) \
+    X( msgUser, DOTA_UM_TutorialMinimapPosition,  CDOTAUserMsg_TutorialMinimapPosition ) \
+    X( msgUser, DOTA_UM_PlayerMMR,                CDOTAUserMsg_PlayerMMR ) \
+    X( msgUser, DOTA_UM_AbilitySteal,             CDOTAUserMsg_AbilitySteal ) \
+    X( msgUser, DOTA_UM_CourierKilledAlert,       CDOTAUserMsg_CourierKilledAlert ) \
+    X( msgUser, DOTA_UM_EnemyItemAlert,           CDOTAUserMsg_EnemyItemAlert ) \
+    X( msgUser, DOTA_UM_StatsMatchDetails,        CDOTAUserMsg_StatsMatchDetails ) \
+    X( msgUser, DOTA_UM_MiniTaunt,                CDOTAUserMsg_MiniTaunt ) \
+    X( msgUser, DOTA_UM_BuyBackStateAlert,        CDOTAUserMsg_BuyBackStateAlert )
+
+namespace dota {
+    /// @defgroup CORE Core
+    /// @{
+
+    /**
+     * Maps a protobuf type to its handler type and message id.
+     *
+     * Only specialized for registered messages, using any other type fails to compile.
+     */
+    template <typename T>
+    struct message_traits;
+
+    /** Maps a handler type and message id to the protobuf type */
+    template <typename Type, uint32_t Id>
+    struct message_type;
+
+    #define DOTA_MESSAGE_TRAITS( type_, id_, object_ ) \
+    template <> \
+    struct message_traits<object_> { \
+        typedef type_ type; \
+        static const uint32_t id = id_; \
+    }; \
+    template <> \
+    struct message_type<type_, id_> { \
+        typedef object_ type; \
+    };
+
+    DOTA_MESSAGES( DOTA_MESSAGE_TRAITS )
+
+    #undef DOTA_MESSAGE_TRAITS
+
+    template <>
+    struct message_type<msgDem, DEM_SignonPacket> {
+        typedef CDemoPacket type;
+    };
+
+    /// @}
+}
+
+#endif // _DOTA_MESSAGE_REGISTRY_HPP_
@@ -0,0 +1,13650 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: netmessages.proto
+
+#include "netmessages.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR CCLCMsg_ClientInfo::CCLCMsg_ClientInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.custom_files_)*/{}
+  , /*decltype(_impl_.friends_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.send_table_crc_)*/0u
+  , /*decltype(_impl_.server_count_)*/0u
+  , /*decltype(_impl_.is_hltv_)*/false
+  , /*decltype(_impl_.is_replay_)*/false
+  , /*decltype(_impl_.friends_id_)*/0u} {}
+struct CCLCMsg_ClientInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_ClientInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_ClientInfoDefaultTypeInternal() {}
+  union {
+    CCLCMsg_ClientInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_ClientInfoDefaultTypeInternal _CCLCMsg_ClientInfo_default_instance_;
+PROTOBUF_CONSTEXPR CCLCMsg_Move::CCLCMsg_Move(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.num_backup_commands_)*/0u
+  , /*decltype(_impl_.num_new_commands_)*/0u} {}
+struct CCLCMsg_MoveDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_MoveDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_MoveDefaultTypeInternal() {}
+  union {
+    CCLCMsg_Move _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_MoveDefaultTypeInternal _CCLCMsg_Move_default_instance_;
+PROTOBUF_CONSTEXPR CCLCMsg_VoiceData::CCLCMsg_VoiceData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.xuid_)*/uint64_t{0u}
+  , /*decltype(_impl_.format_)*/0
+  , /*decltype(_impl_.sequence_bytes_)*/0
+  , /*decltype(_impl_.section_number_)*/0u
+  , /*decltype(_impl_.uncompressed_sample_offset_)*/0u
+  , /*decltype(_impl_.tick_)*/0u} {}
+struct CCLCMsg_VoiceDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_VoiceDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_VoiceDataDefaultTypeInternal() {}
+  union {
+    CCLCMsg_VoiceData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_VoiceDataDefaultTypeInternal _CCLCMsg_VoiceData_default_instance_;
+PROTOBUF_CONSTEXPR CCLCMsg_BaselineAck::CCLCMsg_BaselineAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.baseline_tick_)*/0
+  , /*decltype(_impl_.baseline_nr_)*/0} {}
+struct CCLCMsg_BaselineAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_BaselineAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_BaselineAckDefaultTypeInternal() {}
+  union {
+    CCLCMsg_BaselineAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_BaselineAckDefaultTypeInternal _CCLCMsg_BaselineAck_default_instance_;
+PROTOBUF_CONSTEXPR CCLCMsg_ListenEvents::CCLCMsg_ListenEvents(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.event_mask_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CCLCMsg_ListenEventsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_ListenEventsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_ListenEventsDefaultTypeInternal() {}
+  union {
+    CCLCMsg_ListenEvents _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_ListenEventsDefaultTypeInternal _CCLCMsg_ListenEvents_default_instance_;
+PROTOBUF_CONSTEXPR CCLCMsg_RespondCvarValue::CCLCMsg_RespondCvarValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cookie_)*/0
+  , /*decltype(_impl_.status_code_)*/0} {}
+struct CCLCMsg_RespondCvarValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_RespondCvarValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_RespondCvarValueDefaultTypeInternal() {}
+  union {
+    CCLCMsg_RespondCvarValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_RespondCvarValueDefaultTypeInternal _CCLCMsg_RespondCvarValue_default_instance_;
+PROTOBUF_CONSTEXPR CCLCMsg_FileCRCCheck::CCLCMsg_FileCRCCheck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.filename_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.code_path_)*/0
+  , /*decltype(_impl_.code_filename_)*/0
+  , /*decltype(_impl_.crc_)*/0u} {}
+struct CCLCMsg_FileCRCCheckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_FileCRCCheckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_FileCRCCheckDefaultTypeInternal() {}
+  union {
+    CCLCMsg_FileCRCCheck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_FileCRCCheckDefaultTypeInternal _CCLCMsg_FileCRCCheck_default_instance_;
+PROTOBUF_CONSTEXPR CCLCMsg_LoadingProgress::CCLCMsg_LoadingProgress(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.progress_)*/0} {}
+struct CCLCMsg_LoadingProgressDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_LoadingProgressDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_LoadingProgressDefaultTypeInternal() {}
+  union {
+    CCLCMsg_LoadingProgress _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_LoadingProgressDefaultTypeInternal _CCLCMsg_LoadingProgress_default_instance_;
+PROTOBUF_CONSTEXPR CCLCMsg_SplitPlayerConnect::CCLCMsg_SplitPlayerConnect(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.convars_)*/nullptr} {}
+struct CCLCMsg_SplitPlayerConnectDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_SplitPlayerConnectDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_SplitPlayerConnectDefaultTypeInternal() {}
+  union {
+    CCLCMsg_SplitPlayerConnect _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_SplitPlayerConnectDefaultTypeInternal _CCLCMsg_SplitPlayerConnect_default_instance_;
+PROTOBUF_CONSTEXPR CCLCMsg_ClientMessage::CCLCMsg_ClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_type_)*/0} {}
+struct CCLCMsg_ClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CCLCMsg_ClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CCLCMsg_ClientMessageDefaultTypeInternal() {}
+  union {
+    CCLCMsg_ClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CCLCMsg_ClientMessageDefaultTypeInternal _CCLCMsg_ClientMessage_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_ServerInfo::CSVCMsg_ServerInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.game_dir_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.map_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sky_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.host_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.addon_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.protocol_)*/0
+  , /*decltype(_impl_.server_count_)*/0
+  , /*decltype(_impl_.is_dedicated_)*/false
+  , /*decltype(_impl_.is_hltv_)*/false
+  , /*decltype(_impl_.is_replay_)*/false
+  , /*decltype(_impl_.c_os_)*/0
+  , /*decltype(_impl_.map_crc_)*/0u
+  , /*decltype(_impl_.client_crc_)*/0u
+  , /*decltype(_impl_.string_table_crc_)*/0u
+  , /*decltype(_impl_.max_clients_)*/0
+  , /*decltype(_impl_.max_classes_)*/0
+  , /*decltype(_impl_.player_slot_)*/0
+  , /*decltype(_impl_.tick_interval_)*/0} {}
+struct CSVCMsg_ServerInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_ServerInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_ServerInfoDefaultTypeInternal() {}
+  union {
+    CSVCMsg_ServerInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_ServerInfoDefaultTypeInternal _CSVCMsg_ServerInfo_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_ClassInfo_class_t::CSVCMsg_ClassInfo_class_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.class_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.class_id_)*/0} {}
+struct CSVCMsg_ClassInfo_class_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_ClassInfo_class_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_ClassInfo_class_tDefaultTypeInternal() {}
+  union {
+    CSVCMsg_ClassInfo_class_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_ClassInfo_class_tDefaultTypeInternal _CSVCMsg_ClassInfo_class_t_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_ClassInfo::CSVCMsg_ClassInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.classes_)*/{}
+  , /*decltype(_impl_.create_on_client_)*/false} {}
+struct CSVCMsg_ClassInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_ClassInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_ClassInfoDefaultTypeInternal() {}
+  union {
+    CSVCMsg_ClassInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_ClassInfoDefaultTypeInternal _CSVCMsg_ClassInfo_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_SetPause::CSVCMsg_SetPause(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.paused_)*/false} {}
+struct CSVCMsg_SetPauseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_SetPauseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_SetPauseDefaultTypeInternal() {}
+  union {
+    CSVCMsg_SetPause _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_SetPauseDefaultTypeInternal _CSVCMsg_SetPause_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_VoiceInit::CSVCMsg_VoiceInit(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.codec_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.quality_)*/0
+  , /*decltype(_impl_.version_)*/0} {}
+struct CSVCMsg_VoiceInitDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_VoiceInitDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_VoiceInitDefaultTypeInternal() {}
+  union {
+    CSVCMsg_VoiceInit _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_VoiceInitDefaultTypeInternal _CSVCMsg_VoiceInit_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_Print::CSVCMsg_Print(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CSVCMsg_PrintDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_PrintDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_PrintDefaultTypeInternal() {}
+  union {
+    CSVCMsg_Print _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_PrintDefaultTypeInternal _CSVCMsg_Print_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_Sounds_sounddata_t::CSVCMsg_Sounds_sounddata_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.origin_x_)*/0
+  , /*decltype(_impl_.origin_y_)*/0
+  , /*decltype(_impl_.origin_z_)*/0
+  , /*decltype(_impl_.volume_)*/0u
+  , /*decltype(_impl_.delay_value_)*/0
+  , /*decltype(_impl_.sequence_number_)*/0
+  , /*decltype(_impl_.entity_index_)*/0
+  , /*decltype(_impl_.channel_)*/0
+  , /*decltype(_impl_.pitch_)*/0
+  , /*decltype(_impl_.flags_)*/0
+  , /*decltype(_impl_.sound_num_)*/0u
+  , /*decltype(_impl_.sound_num_handle_)*/0u
+  , /*decltype(_impl_.speaker_entity_)*/0
+  , /*decltype(_impl_.random_seed_)*/0
+  , /*decltype(_impl_.sound_level_)*/0
+  , /*decltype(_impl_.is_sentence_)*/false
+  , /*decltype(_impl_.is_ambient_)*/false} {}
+struct CSVCMsg_Sounds_sounddata_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_Sounds_sounddata_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_Sounds_sounddata_tDefaultTypeInternal() {}
+  union {
+    CSVCMsg_Sounds_sounddata_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_Sounds_sounddata_tDefaultTypeInternal _CSVCMsg_Sounds_sounddata_t_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_Sounds::CSVCMsg_Sounds(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sounds_)*/{}
+  , /*decltype(_impl_.reliable_sound_)*/false} {}
+struct CSVCMsg_SoundsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_SoundsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_SoundsDefaultTypeInternal() {}
+  union {
+    CSVCMsg_Sounds _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_SoundsDefaultTypeInternal _CSVCMsg_Sounds_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_Prefetch::CSVCMsg_Prefetch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sound_index_)*/0} {}
+struct CSVCMsg_PrefetchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_PrefetchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_PrefetchDefaultTypeInternal() {}
+  union {
+    CSVCMsg_Prefetch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_PrefetchDefaultTypeInternal _CSVCMsg_Prefetch_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_SetView::CSVCMsg_SetView(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entity_index_)*/0} {}
+struct CSVCMsg_SetViewDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_SetViewDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_SetViewDefaultTypeInternal() {}
+  union {
+    CSVCMsg_SetView _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_SetViewDefaultTypeInternal _CSVCMsg_SetView_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_FixAngle::CSVCMsg_FixAngle(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.angle_)*/nullptr
+  , /*decltype(_impl_.relative_)*/false} {}
+struct CSVCMsg_FixAngleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_FixAngleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_FixAngleDefaultTypeInternal() {}
+  union {
+    CSVCMsg_FixAngle _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_FixAngleDefaultTypeInternal _CSVCMsg_FixAngle_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_CrosshairAngle::CSVCMsg_CrosshairAngle(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.angle_)*/nullptr} {}
+struct CSVCMsg_CrosshairAngleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_CrosshairAngleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_CrosshairAngleDefaultTypeInternal() {}
+  union {
+    CSVCMsg_CrosshairAngle _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_CrosshairAngleDefaultTypeInternal _CSVCMsg_CrosshairAngle_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_BSPDecal::CSVCMsg_BSPDecal(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.pos_)*/nullptr
+  , /*decltype(_impl_.decal_texture_index_)*/0
+  , /*decltype(_impl_.entity_index_)*/0
+  , /*decltype(_impl_.model_index_)*/0
+  , /*decltype(_impl_.low_priority_)*/false} {}
+struct CSVCMsg_BSPDecalDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_BSPDecalDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_BSPDecalDefaultTypeInternal() {}
+  union {
+    CSVCMsg_BSPDecal _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_BSPDecalDefaultTypeInternal _CSVCMsg_BSPDecal_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_SplitScreen::CSVCMsg_SplitScreen(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.slot_)*/0
+  , /*decltype(_impl_.player_index_)*/0} {}
+struct CSVCMsg_SplitScreenDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_SplitScreenDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_SplitScreenDefaultTypeInternal() {}
+  union {
+    CSVCMsg_SplitScreen _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_SplitScreenDefaultTypeInternal _CSVCMsg_SplitScreen_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_GetCvarValue::CSVCMsg_GetCvarValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.cvar_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cookie_)*/0} {}
+struct CSVCMsg_GetCvarValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_GetCvarValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_GetCvarValueDefaultTypeInternal() {}
+  union {
+    CSVCMsg_GetCvarValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_GetCvarValueDefaultTypeInternal _CSVCMsg_GetCvarValue_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_Menu::CSVCMsg_Menu(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.menu_key_values_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.dialog_type_)*/0} {}
+struct CSVCMsg_MenuDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_MenuDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_MenuDefaultTypeInternal() {}
+  union {
+    CSVCMsg_Menu _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_MenuDefaultTypeInternal _CSVCMsg_Menu_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_SendTable_sendprop_t::CSVCMsg_SendTable_sendprop_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.var_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.dt_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.flags_)*/0
+  , /*decltype(_impl_.priority_)*/0
+  , /*decltype(_impl_.num_elements_)*/0
+  , /*decltype(_impl_.low_value_)*/0
+  , /*decltype(_impl_.high_value_)*/0
+  , /*decltype(_impl_.num_bits_)*/0} {}
+struct CSVCMsg_SendTable_sendprop_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_SendTable_sendprop_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_SendTable_sendprop_tDefaultTypeInternal() {}
+  union {
+    CSVCMsg_SendTable_sendprop_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_SendTable_sendprop_tDefaultTypeInternal _CSVCMsg_SendTable_sendprop_t_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_SendTable::CSVCMsg_SendTable(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.props_)*/{}
+  , /*decltype(_impl_.net_table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.is_end_)*/false
+  , /*decltype(_impl_.needs_decoder_)*/false} {}
+struct CSVCMsg_SendTableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_SendTableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_SendTableDefaultTypeInternal() {}
+  union {
+    CSVCMsg_SendTable _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_SendTableDefaultTypeInternal _CSVCMsg_SendTable_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_GameEventList_key_t::CSVCMsg_GameEventList_key_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0} {}
+struct CSVCMsg_GameEventList_key_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_GameEventList_key_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_GameEventList_key_tDefaultTypeInternal() {}
+  union {
+    CSVCMsg_GameEventList_key_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_GameEventList_key_tDefaultTypeInternal _CSVCMsg_GameEventList_key_t_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_GameEventList_descriptor_t::CSVCMsg_GameEventList_descriptor_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.eventid_)*/0} {}
+struct CSVCMsg_GameEventList_descriptor_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_GameEventList_descriptor_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_GameEventList_descriptor_tDefaultTypeInternal() {}
+  union {
+    CSVCMsg_GameEventList_descriptor_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_GameEventList_descriptor_tDefaultTypeInternal _CSVCMsg_GameEventList_descriptor_t_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_GameEventList::CSVCMsg_GameEventList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.descriptors_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CSVCMsg_GameEventListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_GameEventListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_GameEventListDefaultTypeInternal() {}
+  union {
+    CSVCMsg_GameEventList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_GameEventListDefaultTypeInternal _CSVCMsg_GameEventList_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_PacketEntities::CSVCMsg_PacketEntities(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entity_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.max_entries_)*/0
+  , /*decltype(_impl_.updated_entries_)*/0
+  , /*decltype(_impl_.baseline_)*/0
+  , /*decltype(_impl_.is_delta_)*/false
+  , /*decltype(_impl_.update_baseline_)*/false
+  , /*decltype(_impl_.pending_full_frame_)*/false
+  , /*decltype(_impl_.delta_from_)*/0} {}
+struct CSVCMsg_PacketEntitiesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_PacketEntitiesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_PacketEntitiesDefaultTypeInternal() {}
+  union {
+    CSVCMsg_PacketEntities _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_PacketEntitiesDefaultTypeInternal _CSVCMsg_PacketEntities_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_TempEntities::CSVCMsg_TempEntities(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entity_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.reliable_)*/false
+  , /*decltype(_impl_.num_entries_)*/0} {}
+struct CSVCMsg_TempEntitiesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_TempEntitiesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_TempEntitiesDefaultTypeInternal() {}
+  union {
+    CSVCMsg_TempEntities _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_TempEntitiesDefaultTypeInternal _CSVCMsg_TempEntities_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_CreateStringTable::CSVCMsg_CreateStringTable(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.string_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.max_entries_)*/0
+  , /*decltype(_impl_.num_entries_)*/0
+  , /*decltype(_impl_.user_data_fixed_size_)*/false
+  , /*decltype(_impl_.user_data_size_)*/0
+  , /*decltype(_impl_.user_data_size_bits_)*/0
+  , /*decltype(_impl_.flags_)*/0} {}
+struct CSVCMsg_CreateStringTableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_CreateStringTableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_CreateStringTableDefaultTypeInternal() {}
+  union {
+    CSVCMsg_CreateStringTable _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_CreateStringTableDefaultTypeInternal _CSVCMsg_CreateStringTable_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_UpdateStringTable::CSVCMsg_UpdateStringTable(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.string_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_id_)*/0
+  , /*decltype(_impl_.num_changed_entries_)*/0} {}
+struct CSVCMsg_UpdateStringTableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_UpdateStringTableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_UpdateStringTableDefaultTypeInternal() {}
+  union {
+    CSVCMsg_UpdateStringTable _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_UpdateStringTableDefaultTypeInternal _CSVCMsg_UpdateStringTable_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_VoiceData::CSVCMsg_VoiceData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.voice_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.client_)*/0
+  , /*decltype(_impl_.proximity_)*/false
+  , /*decltype(_impl_.xuid_)*/uint64_t{0u}
+  , /*decltype(_impl_.audible_mask_)*/0
+  , /*decltype(_impl_.format_)*/0
+  , /*decltype(_impl_.sequence_bytes_)*/0
+  , /*decltype(_impl_.section_number_)*/0u
+  , /*decltype(_impl_.uncompressed_sample_offset_)*/0u
+  , /*decltype(_impl_.tick_)*/0u} {}
+struct CSVCMsg_VoiceDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_VoiceDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_VoiceDataDefaultTypeInternal() {}
+  union {
+    CSVCMsg_VoiceData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_VoiceDataDefaultTypeInternal _CSVCMsg_VoiceData_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_PacketReliable::CSVCMsg_PacketReliable(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tick_)*/0
+  , /*decltype(_impl_.messagessize_)*/0} {}
+struct CSVCMsg_PacketReliableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_PacketReliableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_PacketReliableDefaultTypeInternal() {}
+  union {
+    CSVCMsg_PacketReliable _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_PacketReliableDefaultTypeInternal _CSVCMsg_PacketReliable_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_FullFrameSplit::CSVCMsg_FullFrameSplit(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tick_)*/0
+  , /*decltype(_impl_.section_)*/0
+  , /*decltype(_impl_.total_)*/0} {}
+struct CSVCMsg_FullFrameSplitDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_FullFrameSplitDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_FullFrameSplitDefaultTypeInternal() {}
+  union {
+    CSVCMsg_FullFrameSplit _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_FullFrameSplitDefaultTypeInternal _CSVCMsg_FullFrameSplit_default_instance_;
+static ::_pb::Metadata file_level_metadata_netmessages_2eproto[38];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_netmessages_2eproto[4];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_netmessages_2eproto = nullptr;
+
+const uint32_t TableStruct_netmessages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientInfo, _impl_.send_table_crc_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientInfo, _impl_.server_count_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientInfo, _impl_.is_hltv_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientInfo, _impl_.is_replay_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientInfo, _impl_.friends_id_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientInfo, _impl_.friends_name_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientInfo, _impl_.custom_files_),
+  1,
+  2,
+  3,
+  4,
+  5,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_Move, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_Move, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_Move, _impl_.num_backup_commands_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_Move, _impl_.num_new_commands_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_Move, _impl_.data_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_VoiceData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_VoiceData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_VoiceData, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_VoiceData, _impl_.xuid_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_VoiceData, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_VoiceData, _impl_.sequence_bytes_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_VoiceData, _impl_.section_number_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_VoiceData, _impl_.uncompressed_sample_offset_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_VoiceData, _impl_.tick_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_BaselineAck, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_BaselineAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_BaselineAck, _impl_.baseline_tick_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_BaselineAck, _impl_.baseline_nr_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ListenEvents, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ListenEvents, _impl_.event_mask_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_RespondCvarValue, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_RespondCvarValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_RespondCvarValue, _impl_.cookie_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_RespondCvarValue, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_RespondCvarValue, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_RespondCvarValue, _impl_.value_),
+  2,
+  3,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_FileCRCCheck, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_FileCRCCheck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_FileCRCCheck, _impl_.code_path_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_FileCRCCheck, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_FileCRCCheck, _impl_.code_filename_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_FileCRCCheck, _impl_.filename_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_FileCRCCheck, _impl_.crc_),
+  2,
+  0,
+  3,
+  1,
+  4,
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_LoadingProgress, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_LoadingProgress, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_LoadingProgress, _impl_.progress_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_SplitPlayerConnect, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_SplitPlayerConnect, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_SplitPlayerConnect, _impl_.convars_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientMessage, _impl_.msg_type_),
+  PROTOBUF_FIELD_OFFSET(::CCLCMsg_ClientMessage, _impl_.data_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.protocol_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.server_count_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.is_dedicated_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.is_hltv_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.is_replay_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.c_os_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.map_crc_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.client_crc_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.string_table_crc_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.max_clients_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.max_classes_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.player_slot_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.tick_interval_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.game_dir_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.map_name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.sky_name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.host_name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ServerInfo, _impl_.addon_name_),
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  17,
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ClassInfo_class_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ClassInfo_class_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ClassInfo_class_t, _impl_.class_id_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ClassInfo_class_t, _impl_.data_table_name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ClassInfo_class_t, _impl_.class_name_),
+  2,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ClassInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ClassInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ClassInfo, _impl_.create_on_client_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_ClassInfo, _impl_.classes_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SetPause, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SetPause, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SetPause, _impl_.paused_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceInit, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceInit, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceInit, _impl_.quality_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceInit, _impl_.codec_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceInit, _impl_.version_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Print, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Print, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Print, _impl_.text_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.origin_x_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.origin_y_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.origin_z_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.volume_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.delay_value_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.sequence_number_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.entity_index_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.channel_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.pitch_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.flags_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.sound_num_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.sound_num_handle_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.speaker_entity_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.random_seed_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.sound_level_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.is_sentence_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds_sounddata_t, _impl_.is_ambient_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds, _impl_.reliable_sound_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Sounds, _impl_.sounds_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Prefetch, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Prefetch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Prefetch, _impl_.sound_index_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SetView, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SetView, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SetView, _impl_.entity_index_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FixAngle, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FixAngle, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FixAngle, _impl_.relative_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FixAngle, _impl_.angle_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CrosshairAngle, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CrosshairAngle, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CrosshairAngle, _impl_.angle_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_BSPDecal, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_BSPDecal, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_BSPDecal, _impl_.pos_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_BSPDecal, _impl_.decal_texture_index_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_BSPDecal, _impl_.entity_index_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_BSPDecal, _impl_.model_index_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_BSPDecal, _impl_.low_priority_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SplitScreen, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SplitScreen, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SplitScreen, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SplitScreen, _impl_.slot_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SplitScreen, _impl_.player_index_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GetCvarValue, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GetCvarValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GetCvarValue, _impl_.cookie_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GetCvarValue, _impl_.cvar_name_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Menu, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Menu, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Menu, _impl_.dialog_type_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_Menu, _impl_.menu_key_values_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_.var_name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_.flags_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_.priority_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_.dt_name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_.num_elements_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_.low_value_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_.high_value_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable_sendprop_t, _impl_.num_bits_),
+  2,
+  0,
+  3,
+  4,
+  1,
+  5,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable, _impl_.is_end_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable, _impl_.net_table_name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable, _impl_.needs_decoder_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_SendTable, _impl_.props_),
+  1,
+  0,
+  2,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList_key_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList_key_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList_key_t, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList_key_t, _impl_.name_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList_descriptor_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList_descriptor_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList_descriptor_t, _impl_.eventid_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList_descriptor_t, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList_descriptor_t, _impl_.keys_),
+  1,
+  0,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEventList, _impl_.descriptors_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _impl_.max_entries_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _impl_.updated_entries_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _impl_.is_delta_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _impl_.update_baseline_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _impl_.baseline_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _impl_.delta_from_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _impl_.entity_data_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketEntities, _impl_.pending_full_frame_),
+  1,
+  2,
+  4,
+  5,
+  3,
+  7,
+  0,
+  6,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_TempEntities, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_TempEntities, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_TempEntities, _impl_.reliable_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_TempEntities, _impl_.num_entries_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_TempEntities, _impl_.entity_data_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _impl_.max_entries_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _impl_.num_entries_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _impl_.user_data_fixed_size_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _impl_.user_data_size_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _impl_.user_data_size_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _impl_.flags_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_CreateStringTable, _impl_.string_data_),
+  0,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_UpdateStringTable, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_UpdateStringTable, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_UpdateStringTable, _impl_.table_id_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_UpdateStringTable, _impl_.num_changed_entries_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_UpdateStringTable, _impl_.string_data_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.client_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.proximity_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.xuid_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.audible_mask_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.voice_data_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.sequence_bytes_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.section_number_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.uncompressed_sample_offset_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_VoiceData, _impl_.tick_),
+  1,
+  2,
+  3,
+  4,
+  0,
+  5,
+  6,
+  7,
+  8,
+  9,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketReliable, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketReliable, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketReliable, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_PacketReliable, _impl_.messagessize_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FullFrameSplit, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FullFrameSplit, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FullFrameSplit, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FullFrameSplit, _impl_.section_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FullFrameSplit, _impl_.total_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_FullFrameSplit, _impl_.data_),
+  1,
+  2,
+  3,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::CCLCMsg_ClientInfo)},
+  { 20, 29, -1, sizeof(::CCLCMsg_Move)},
+  { 32, 45, -1, sizeof(::CCLCMsg_VoiceData)},
+  { 52, 60, -1, sizeof(::CCLCMsg_BaselineAck)},
+  { 62, -1, -1, sizeof(::CCLCMsg_ListenEvents)},
+  { 69, 79, -1, sizeof(::CCLCMsg_RespondCvarValue)},
+  { 83, 94, -1, sizeof(::CCLCMsg_FileCRCCheck)},
+  { 99, 106, -1, sizeof(::CCLCMsg_LoadingProgress)},
+  { 107, 114, -1, sizeof(::CCLCMsg_SplitPlayerConnect)},
+  { 115, 123, -1, sizeof(::CCLCMsg_ClientMessage)},
+  { 125, 149, -1, sizeof(::CSVCMsg_ServerInfo)},
+  { 167, 176, -1, sizeof(::CSVCMsg_ClassInfo_class_t)},
+  { 179, 187, -1, sizeof(::CSVCMsg_ClassInfo)},
+  { 189, 196, -1, sizeof(::CSVCMsg_SetPause)},
+  { 197, 206, -1, sizeof(::CSVCMsg_VoiceInit)},
+  { 209, 216, -1, sizeof(::CSVCMsg_Print)},
+  { 217, 240, -1, sizeof(::CSVCMsg_Sounds_sounddata_t)},
+  { 257, 265, -1, sizeof(::CSVCMsg_Sounds)},
+  { 267, 274, -1, sizeof(::CSVCMsg_Prefetch)},
+  { 275, 282, -1, sizeof(::CSVCMsg_SetView)},
+  { 283, 291, -1, sizeof(::CSVCMsg_FixAngle)},
+  { 293, 300, -1, sizeof(::CSVCMsg_CrosshairAngle)},
+  { 301, 312, -1, sizeof(::CSVCMsg_BSPDecal)},
+  { 317, 326, -1, sizeof(::CSVCMsg_SplitScreen)},
+  { 329, 337, -1, sizeof(::CSVCMsg_GetCvarValue)},
+  { 339, 347, -1, sizeof(::CSVCMsg_Menu)},
+  { 349, 364, -1, sizeof(::CSVCMsg_SendTable_sendprop_t)},
+  { 373, 383, -1, sizeof(::CSVCMsg_SendTable)},
+  { 387, 395, -1, sizeof(::CSVCMsg_GameEventList_key_t)},
+  { 397, 406, -1, sizeof(::CSVCMsg_GameEventList_descriptor_t)},
+  { 409, -1, -1, sizeof(::CSVCMsg_GameEventList)},
+  { 416, 430, -1, sizeof(::CSVCMsg_PacketEntities)},
+  { 438, 447, -1, sizeof(::CSVCMsg_TempEntities)},
+  { 450, 464, -1, sizeof(::CSVCMsg_CreateStringTable)},
+  { 472, 481, -1, sizeof(::CSVCMsg_UpdateStringTable)},
+  { 484, 500, -1, sizeof(::CSVCMsg_VoiceData)},
+  { 510, 518, -1, sizeof(::CSVCMsg_PacketReliable)},
+  { 520, 530, -1, sizeof(::CSVCMsg_FullFrameSplit)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_CCLCMsg_ClientInfo_default_instance_._instance,
+  &::_CCLCMsg_Move_default_instance_._instance,
+  &::_CCLCMsg_VoiceData_default_instance_._instance,
+  &::_CCLCMsg_BaselineAck_default_instance_._instance,
+  &::_CCLCMsg_ListenEvents_default_instance_._instance,
+  &::_CCLCMsg_RespondCvarValue_default_instance_._instance,
+  &::_CCLCMsg_FileCRCCheck_default_instance_._instance,
+  &::_CCLCMsg_LoadingProgress_default_instance_._instance,
+  &::_CCLCMsg_SplitPlayerConnect_default_instance_._instance,
+  &::_CCLCMsg_ClientMessage_default_instance_._instance,
+  &::_CSVCMsg_ServerInfo_default_instance_._instance,
+  &::_CSVCMsg_ClassInfo_class_t_default_instance_._instance,
+  &::_CSVCMsg_ClassInfo_default_instance_._instance,
+  &::_CSVCMsg_SetPause_default_instance_._instance,
+  &::_CSVCMsg_VoiceInit_default_instance_._instance,
+  &::_CSVCMsg_Print_default_instance_._instance,
+  &::_CSVCMsg_Sounds_sounddata_t_default_instance_._instance,
+  &::_CSVCMsg_Sounds_default_instance_._instance,
+  &::_CSVCMsg_Prefetch_default_instance_._instance,
+  &::_CSVCMsg_SetView_default_instance_._instance,
+  &::_CSVCMsg_FixAngle_default_instance_._instance,
+  &::_CSVCMsg_CrosshairAngle_default_instance_._instance,
+  &::_CSVCMsg_BSPDecal_default_instance_._instance,
+  &::_CSVCMsg_SplitScreen_default_instance_._instance,
+  &::_CSVCMsg_GetCvarValue_default_instance_._instance,
+  &::_CSVCMsg_Menu_default_instance_._instance,
+  &::_CSVCMsg_SendTable_sendprop_t_default_instance_._instance,
+  &::_CSVCMsg_SendTable_default_instance_._instance,
+  &::_CSVCMsg_GameEventList_key_t_default_instance_._instance,
+  &::_CSVCMsg_GameEventList_descriptor_t_default_instance_._instance,
+  &::_CSVCMsg_GameEventList_default_instance_._instance,
+  &::_CSVCMsg_PacketEntities_default_instance_._instance,
+  &::_CSVCMsg_TempEntities_default_instance_._instance,
+  &::_CSVCMsg_CreateStringTable_default_instance_._instance,
+  &::_CSVCMsg_UpdateStringTable_default_instance_._instance,
+  &::_CSVCMsg_VoiceData_default_instance_._instance,
+  &::_CSVCMsg_PacketReliable_default_instance_._instance,
+  &::_CSVCMsg_FullFrameSplit_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_netmessages_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021netmessages.proto\032\026networkbasetypes.pr"
+  "oto\"\246\001\n\022CCLCMsg_ClientInfo\022\026\n\016send_table"
+  "_crc\030\001 \001(\007\022\024\n\014server_count\030\002 \001(\r\022\017\n\007is_h"
+  "ltv\030\003 \001(\010\022\021\n\tis_replay\030\004 \001(\010\022\022\n\nfriends_"
+  "id\030\005 \001(\r\022\024\n\014friends_name\030\006 \001(\t\022\024\n\014custom"
+  "_files\030\007 \003(\007\"S\n\014CCLCMsg_Move\022\033\n\023num_back"
+  "up_commands\030\001 \001(\r\022\030\n\020num_new_commands\030\002 "
+  "\001(\r\022\014\n\004data\030\003 \001(\014\"\315\001\n\021CCLCMsg_VoiceData\022"
+  "\014\n\004data\030\001 \001(\014\022\014\n\004xuid\030\002 \001(\006\022:\n\006format\030\003 "
+  "\001(\0162\022.VoiceDataFormat_t:\026VOICEDATA_FORMA"
+  "T_STEAM\022\026\n\016sequence_bytes\030\004 \001(\005\022\026\n\016secti"
+  "on_number\030\005 \001(\r\022\"\n\032uncompressed_sample_o"
+  "ffset\030\006 \001(\r\022\014\n\004tick\030\007 \001(\r\"A\n\023CCLCMsg_Bas"
+  "elineAck\022\025\n\rbaseline_tick\030\001 \001(\005\022\023\n\013basel"
+  "ine_nr\030\002 \001(\005\"*\n\024CCLCMsg_ListenEvents\022\022\n\n"
+  "event_mask\030\001 \003(\007\"\\\n\030CCLCMsg_RespondCvarV"
+  "alue\022\016\n\006cookie\030\001 \001(\005\022\023\n\013status_code\030\002 \001("
+  "\005\022\014\n\004name\030\003 \001(\t\022\r\n\005value\030\004 \001(\t\"m\n\024CCLCMs"
+  "g_FileCRCCheck\022\021\n\tcode_path\030\001 \001(\005\022\014\n\004pat"
+  "h\030\002 \001(\t\022\025\n\rcode_filename\030\003 \001(\005\022\020\n\010filena"
+  "me\030\004 \001(\t\022\013\n\003crc\030\005 \001(\007\"+\n\027CCLCMsg_Loading"
+  "Progress\022\020\n\010progress\030\001 \001(\005\":\n\032CCLCMsg_Sp"
+  "litPlayerConnect\022\034\n\007convars\030\001 \001(\0132\013.CMsg"
+  "_CVars\"7\n\025CCLCMsg_ClientMessage\022\020\n\010msg_t"
+  "ype\030\001 \001(\005\022\014\n\004data\030\002 \001(\014\"\366\002\n\022CSVCMsg_Serv"
+  "erInfo\022\020\n\010protocol\030\001 \001(\005\022\024\n\014server_count"
+  "\030\002 \001(\005\022\024\n\014is_dedicated\030\003 \001(\010\022\017\n\007is_hltv\030"
+  "\004 \001(\010\022\021\n\tis_replay\030\005 \001(\010\022\014\n\004c_os\030\006 \001(\005\022\017"
+  "\n\007map_crc\030\007 \001(\007\022\022\n\nclient_crc\030\010 \001(\007\022\030\n\020s"
+  "tring_table_crc\030\t \001(\007\022\023\n\013max_clients\030\n \001"
+  "(\005\022\023\n\013max_classes\030\013 \001(\005\022\023\n\013player_slot\030\014"
+  " \001(\005\022\025\n\rtick_interval\030\r \001(\002\022\020\n\010game_dir\030"
+  "\016 \001(\t\022\020\n\010map_name\030\017 \001(\t\022\020\n\010sky_name\030\020 \001("
+  "\t\022\021\n\thost_name\030\021 \001(\t\022\022\n\naddon_name\030\022 \001(\t"
+  "\"\244\001\n\021CSVCMsg_ClassInfo\022\030\n\020create_on_clie"
+  "nt\030\001 \001(\010\022+\n\007classes\030\002 \003(\0132\032.CSVCMsg_Clas"
+  "sInfo.class_t\032H\n\007class_t\022\020\n\010class_id\030\001 \001"
+  "(\005\022\027\n\017data_table_name\030\002 \001(\t\022\022\n\nclass_nam"
+  "e\030\003 \001(\t\"\"\n\020CSVCMsg_SetPause\022\016\n\006paused\030\001 "
+  "\001(\010\"G\n\021CSVCMsg_VoiceInit\022\017\n\007quality\030\001 \001("
+  "\005\022\r\n\005codec\030\002 \001(\t\022\022\n\007version\030\003 \001(\005:\0010\"\035\n\r"
+  "CSVCMsg_Print\022\014\n\004text\030\001 \001(\t\"\266\003\n\016CSVCMsg_"
+  "Sounds\022\026\n\016reliable_sound\030\001 \001(\010\022+\n\006sounds"
+  "\030\002 \003(\0132\033.CSVCMsg_Sounds.sounddata_t\032\336\002\n\013"
+  "sounddata_t\022\020\n\010origin_x\030\001 \001(\021\022\020\n\010origin_"
+  "y\030\002 \001(\021\022\020\n\010origin_z\030\003 \001(\021\022\016\n\006volume\030\004 \001("
+  "\r\022\023\n\013delay_value\030\005 \001(\002\022\027\n\017sequence_numbe"
+  "r\030\006 \001(\005\022\024\n\014entity_index\030\007 \001(\005\022\017\n\007channel"
+  "\030\010 \001(\005\022\r\n\005pitch\030\t \001(\005\022\r\n\005flags\030\n \001(\005\022\021\n\t"
+  "sound_num\030\013 \001(\r\022\030\n\020sound_num_handle\030\014 \001("
+  "\007\022\026\n\016speaker_entity\030\r \001(\005\022\023\n\013random_seed"
+  "\030\016 \001(\005\022\023\n\013sound_level\030\017 \001(\005\022\023\n\013is_senten"
+  "ce\030\020 \001(\010\022\022\n\nis_ambient\030\021 \001(\010\"\'\n\020CSVCMsg_"
+  "Prefetch\022\023\n\013sound_index\030\001 \001(\005\"\'\n\017CSVCMsg"
+  "_SetView\022\024\n\014entity_index\030\001 \001(\005\"@\n\020CSVCMs"
+  "g_FixAngle\022\020\n\010relative\030\001 \001(\010\022\032\n\005angle\030\002 "
+  "\001(\0132\013.CMsgQAngle\"4\n\026CSVCMsg_CrosshairAng"
+  "le\022\032\n\005angle\030\001 \001(\0132\013.CMsgQAngle\"\212\001\n\020CSVCM"
+  "sg_BSPDecal\022\030\n\003pos\030\001 \001(\0132\013.CMsgVector\022\033\n"
+  "\023decal_texture_index\030\002 \001(\005\022\024\n\014entity_ind"
+  "ex\030\003 \001(\005\022\023\n\013model_index\030\004 \001(\005\022\024\n\014low_pri"
+  "ority\030\005 \001(\010\"z\n\023CSVCMsg_SplitScreen\022\?\n\004ty"
+  "pe\030\001 \001(\0162\030.ESplitScreenMessageType:\027MSG_"
+  "SPLITSCREEN_ADDUSER\022\014\n\004slot\030\002 \001(\005\022\024\n\014pla"
+  "yer_index\030\003 \001(\005\"9\n\024CSVCMsg_GetCvarValue\022"
+  "\016\n\006cookie\030\001 \001(\005\022\021\n\tcvar_name\030\002 \001(\t\"<\n\014CS"
+  "VCMsg_Menu\022\023\n\013dialog_type\030\001 \001(\005\022\027\n\017menu_"
+  "key_values\030\002 \001(\014\"\260\002\n\021CSVCMsg_SendTable\022\016"
+  "\n\006is_end\030\001 \001(\010\022\026\n\016net_table_name\030\002 \001(\t\022\025"
+  "\n\rneeds_decoder\030\003 \001(\010\022,\n\005props\030\004 \003(\0132\035.C"
+  "SVCMsg_SendTable.sendprop_t\032\255\001\n\nsendprop"
+  "_t\022\014\n\004type\030\001 \001(\005\022\020\n\010var_name\030\002 \001(\t\022\r\n\005fl"
+  "ags\030\003 \001(\005\022\020\n\010priority\030\004 \001(\005\022\017\n\007dt_name\030\005"
+  " \001(\t\022\024\n\014num_elements\030\006 \001(\005\022\021\n\tlow_value\030"
+  "\007 \001(\002\022\022\n\nhigh_value\030\010 \001(\002\022\020\n\010num_bits\030\t "
+  "\001(\005\"\321\001\n\025CSVCMsg_GameEventList\0228\n\013descrip"
+  "tors\030\001 \003(\0132#.CSVCMsg_GameEventList.descr"
+  "iptor_t\032#\n\005key_t\022\014\n\004type\030\001 \001(\005\022\014\n\004name\030\002"
+  " \001(\t\032Y\n\014descriptor_t\022\017\n\007eventid\030\001 \001(\005\022\014\n"
+  "\004name\030\002 \001(\t\022*\n\004keys\030\003 \003(\0132\034.CSVCMsg_Game"
+  "EventList.key_t\"\310\001\n\026CSVCMsg_PacketEntiti"
+  "es\022\023\n\013max_entries\030\001 \001(\005\022\027\n\017updated_entri"
+  "es\030\002 \001(\005\022\020\n\010is_delta\030\003 \001(\010\022\027\n\017update_bas"
+  "eline\030\004 \001(\010\022\020\n\010baseline\030\005 \001(\005\022\022\n\ndelta_f"
+  "rom\030\006 \001(\005\022\023\n\013entity_data\030\007 \001(\014\022\032\n\022pendin"
+  "g_full_frame\030\010 \001(\010\"R\n\024CSVCMsg_TempEntiti"
+  "es\022\020\n\010reliable\030\001 \001(\010\022\023\n\013num_entries\030\002 \001("
+  "\005\022\023\n\013entity_data\030\003 \001(\014\"\312\001\n\031CSVCMsg_Creat"
+  "eStringTable\022\014\n\004name\030\001 \001(\t\022\023\n\013max_entrie"
+  "s\030\002 \001(\005\022\023\n\013num_entries\030\003 \001(\005\022\034\n\024user_dat"
+  "a_fixed_size\030\004 \001(\010\022\026\n\016user_data_size\030\005 \001"
+  "(\005\022\033\n\023user_data_size_bits\030\006 \001(\005\022\r\n\005flags"
+  "\030\007 \001(\005\022\023\n\013string_data\030\010 \001(\014\"_\n\031CSVCMsg_U"
+  "pdateStringTable\022\020\n\010table_id\030\001 \001(\005\022\033\n\023nu"
+  "m_changed_entries\030\002 \001(\005\022\023\n\013string_data\030\003"
+  " \001(\014\"\214\002\n\021CSVCMsg_VoiceData\022\016\n\006client\030\001 \001"
+  "(\005\022\021\n\tproximity\030\002 \001(\010\022\014\n\004xuid\030\003 \001(\006\022\024\n\014a"
+  "udible_mask\030\004 \001(\005\022\022\n\nvoice_data\030\005 \001(\014\022:\n"
+  "\006format\030\006 \001(\0162\022.VoiceDataFormat_t:\026VOICE"
+  "DATA_FORMAT_STEAM\022\026\n\016sequence_bytes\030\007 \001("
+  "\005\022\026\n\016section_number\030\010 \001(\r\022\"\n\032uncompresse"
+  "d_sample_offset\030\t \001(\r\022\014\n\004tick\030\n \001(\r\"<\n\026C"
+  "SVCMsg_PacketReliable\022\014\n\004tick\030\001 \001(\005\022\024\n\014m"
+  "essagessize\030\002 \001(\005\"T\n\026CSVCMsg_FullFrameSp"
+  "lit\022\014\n\004tick\030\001 \001(\005\022\017\n\007section\030\002 \001(\005\022\r\n\005to"
+  "tal\030\003 \001(\005\022\014\n\004data\030\004 \001(\014*\352\001\n\014CLC_Messages"
+  "\022\022\n\016clc_ClientInfo\020\010\022\014\n\010clc_Move\020\t\022\021\n\rcl"
+  "c_VoiceData\020\n\022\023\n\017clc_BaselineAck\020\013\022\024\n\020cl"
+  "c_ListenEvents\020\014\022\030\n\024clc_RespondCvarValue"
+  "\020\r\022\024\n\020clc_FileCRCCheck\020\016\022\027\n\023clc_LoadingP"
+  "rogress\020\017\022\032\n\026clc_SplitPlayerConnect\020\020\022\025\n"
+  "\021clc_ClientMessage\020\021*\241\004\n\014SVC_Messages\022\022\n"
+  "\016svc_ServerInfo\020\010\022\021\n\rsvc_SendTable\020\t\022\021\n\r"
+  "svc_ClassInfo\020\n\022\020\n\014svc_SetPause\020\013\022\031\n\025svc"
+  "_CreateStringTable\020\014\022\031\n\025svc_UpdateString"
+  "Table\020\r\022\021\n\rsvc_VoiceInit\020\016\022\021\n\rsvc_VoiceD"
+  "ata\020\017\022\r\n\tsvc_Print\020\020\022\016\n\nsvc_Sounds\020\021\022\017\n\013"
+  "svc_SetView\020\022\022\020\n\014svc_FixAngle\020\023\022\026\n\022svc_C"
+  "rosshairAngle\020\024\022\020\n\014svc_BSPDecal\020\025\022\023\n\017svc"
+  "_SplitScreen\020\026\022\023\n\017svc_UserMessage\020\027\022\025\n\021s"
+  "vc_EntityMessage\020\030\022\021\n\rsvc_GameEvent\020\031\022\026\n"
+  "\022svc_PacketEntities\020\032\022\024\n\020svc_TempEntitie"
+  "s\020\033\022\020\n\014svc_Prefetch\020\034\022\014\n\010svc_Menu\020\035\022\025\n\021s"
+  "vc_GameEventList\020\036\022\024\n\020svc_GetCvarValue\020\037"
+  "\022\026\n\022svc_PacketReliable\020 \022\026\n\022svc_FullFram"
+  "eSplit\020!*L\n\021VoiceDataFormat_t\022\032\n\026VOICEDA"
+  "TA_FORMAT_STEAM\020\000\022\033\n\027VOICEDATA_FORMAT_EN"
+  "GINE\020\001*V\n\027ESplitScreenMessageType\022\033\n\027MSG"
+  "_SPLITSCREEN_ADDUSER\020\000\022\036\n\032MSG_SPLITSCREE"
+  "N_REMOVEUSER\020\001B\003\200\001\000"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_netmessages_2eproto_deps[1] = {
+  &::descriptor_table_networkbasetypes_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_netmessages_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_netmessages_2eproto = {
+    false, false, 5179, descriptor_table_protodef_netmessages_2eproto,
+    "netmessages.proto",
+    &descriptor_table_netmessages_2eproto_once, descriptor_table_netmessages_2eproto_deps, 1, 38,
+    schemas, file_default_instances, TableStruct_netmessages_2eproto::offsets,
+    file_level_metadata_netmessages_2eproto, file_level_enum_descriptors_netmessages_2eproto,
+    file_level_service_descriptors_netmessages_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_netmessages_2eproto_getter() {
+  return &descriptor_table_netmessages_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_netmessages_2eproto(&descriptor_table_netmessages_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CLC_Messages_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_netmessages_2eproto);
+  return file_level_enum_descriptors_netmessages_2eproto[0];
+}
+bool CLC_Messages_IsValid(int value) {
+  switch (value) {
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SVC_Messages_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_netmessages_2eproto);
+  return file_level_enum_descriptors_netmessages_2eproto[1];
+}
+bool SVC_Messages_IsValid(int value) {
+  switch (value) {
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+    case 30:
+    case 31:
+    case 32:
+    case 33:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VoiceDataFormat_t_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_netmessages_2eproto);
+  return file_level_enum_descriptors_netmessages_2eproto[2];
+}
+bool VoiceDataFormat_t_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ESplitScreenMessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_netmessages_2eproto);
+  return file_level_enum_descriptors_netmessages_2eproto[3];
+}
+bool ESplitScreenMessageType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class CCLCMsg_ClientInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CCLCMsg_ClientInfo>()._impl_._has_bits_);
+  static void set_has_send_table_crc(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_server_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_is_hltv(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_is_replay(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_friends_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_friends_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CCLCMsg_ClientInfo::CCLCMsg_ClientInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_ClientInfo)
+}
+CCLCMsg_ClientInfo::CCLCMsg_ClientInfo(const CCLCMsg_ClientInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_ClientInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.custom_files_){from._impl_.custom_files_}
+    , decltype(_impl_.friends_name_){}
+    , decltype(_impl_.send_table_crc_){}
+    , decltype(_impl_.server_count_){}
+    , decltype(_impl_.is_hltv_){}
+    , decltype(_impl_.is_replay_){}
+    , decltype(_impl_.friends_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.friends_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.friends_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_friends_name()) {
+    _this->_impl_.friends_name_.Set(from._internal_friends_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.send_table_crc_, &from._impl_.send_table_crc_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.friends_id_) -
+    reinterpret_cast<char*>(&_impl_.send_table_crc_)) + sizeof(_impl_.friends_id_));
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_ClientInfo)
+}
+
+inline void CCLCMsg_ClientInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.custom_files_){arena}
+    , decltype(_impl_.friends_name_){}
+    , decltype(_impl_.send_table_crc_){0u}
+    , decltype(_impl_.server_count_){0u}
+    , decltype(_impl_.is_hltv_){false}
+    , decltype(_impl_.is_replay_){false}
+    , decltype(_impl_.friends_id_){0u}
+  };
+  _impl_.friends_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.friends_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CCLCMsg_ClientInfo::~CCLCMsg_ClientInfo() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_ClientInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_ClientInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.custom_files_.~RepeatedField();
+  _impl_.friends_name_.Destroy();
+}
+
+void CCLCMsg_ClientInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_ClientInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_ClientInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.custom_files_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.friends_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.send_table_crc_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.friends_id_) -
+        reinterpret_cast<char*>(&_impl_.send_table_crc_)) + sizeof(_impl_.friends_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_ClientInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed32 send_table_crc = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_send_table_crc(&has_bits);
+          _impl_.send_table_crc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 server_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_server_count(&has_bits);
+          _impl_.server_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_hltv = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_is_hltv(&has_bits);
+          _impl_.is_hltv_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_replay = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_is_replay(&has_bits);
+          _impl_.is_replay_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 friends_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_friends_id(&has_bits);
+          _impl_.friends_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string friends_name = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_friends_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CCLCMsg_ClientInfo.friends_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed32 custom_files = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_custom_files(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr));
+            ptr += sizeof(uint32_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<61>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 58) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_custom_files(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_ClientInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_ClientInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed32 send_table_crc = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_send_table_crc(), target);
+  }
+
+  // optional uint32 server_count = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_server_count(), target);
+  }
+
+  // optional bool is_hltv = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_hltv(), target);
+  }
+
+  // optional bool is_replay = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_is_replay(), target);
+  }
+
+  // optional uint32 friends_id = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_friends_id(), target);
+  }
+
+  // optional string friends_name = 6;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_friends_name().data(), static_cast<int>(this->_internal_friends_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CCLCMsg_ClientInfo.friends_name");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_friends_name(), target);
+  }
+
+  // repeated fixed32 custom_files = 7;
+  for (int i = 0, n = this->_internal_custom_files_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(7, this->_internal_custom_files(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_ClientInfo)
+  return target;
+}
+
+size_t CCLCMsg_ClientInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_ClientInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed32 custom_files = 7;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_custom_files_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_custom_files_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string friends_name = 6;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_friends_name());
+    }
+
+    // optional fixed32 send_table_crc = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 server_count = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_server_count());
+    }
+
+    // optional bool is_hltv = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool is_replay = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 friends_id = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_friends_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_ClientInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_ClientInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_ClientInfo::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_ClientInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_ClientInfo*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_ClientInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_ClientInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.custom_files_.MergeFrom(from._impl_.custom_files_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_friends_name(from._internal_friends_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.send_table_crc_ = from._impl_.send_table_crc_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.server_count_ = from._impl_.server_count_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.is_hltv_ = from._impl_.is_hltv_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.is_replay_ = from._impl_.is_replay_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.friends_id_ = from._impl_.friends_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_ClientInfo::CopyFrom(const CCLCMsg_ClientInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_ClientInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_ClientInfo::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_ClientInfo::InternalSwap(CCLCMsg_ClientInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.custom_files_.InternalSwap(&other->_impl_.custom_files_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.friends_name_, lhs_arena,
+      &other->_impl_.friends_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CCLCMsg_ClientInfo, _impl_.friends_id_)
+      + sizeof(CCLCMsg_ClientInfo::_impl_.friends_id_)
+      - PROTOBUF_FIELD_OFFSET(CCLCMsg_ClientInfo, _impl_.send_table_crc_)>(
+          reinterpret_cast<char*>(&_impl_.send_table_crc_),
+          reinterpret_cast<char*>(&other->_impl_.send_table_crc_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_ClientInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[0]);
+}
+
+// ===================================================================
+
+class CCLCMsg_Move::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CCLCMsg_Move>()._impl_._has_bits_);
+  static void set_has_num_backup_commands(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_new_commands(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CCLCMsg_Move::CCLCMsg_Move(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_Move)
+}
+CCLCMsg_Move::CCLCMsg_Move(const CCLCMsg_Move& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_Move* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.num_backup_commands_){}
+    , decltype(_impl_.num_new_commands_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.num_backup_commands_, &from._impl_.num_backup_commands_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_new_commands_) -
+    reinterpret_cast<char*>(&_impl_.num_backup_commands_)) + sizeof(_impl_.num_new_commands_));
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_Move)
+}
+
+inline void CCLCMsg_Move::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.num_backup_commands_){0u}
+    , decltype(_impl_.num_new_commands_){0u}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CCLCMsg_Move::~CCLCMsg_Move() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_Move)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_Move::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void CCLCMsg_Move::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_Move::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_Move)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.num_backup_commands_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_new_commands_) -
+        reinterpret_cast<char*>(&_impl_.num_backup_commands_)) + sizeof(_impl_.num_new_commands_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_Move::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 num_backup_commands = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_backup_commands(&has_bits);
+          _impl_.num_backup_commands_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 num_new_commands = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_new_commands(&has_bits);
+          _impl_.num_new_commands_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_Move::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_Move)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 num_backup_commands = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_num_backup_commands(), target);
+  }
+
+  // optional uint32 num_new_commands = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_num_new_commands(), target);
+  }
+
+  // optional bytes data = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_Move)
+  return target;
+}
+
+size_t CCLCMsg_Move::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_Move)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bytes data = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_data());
+    }
+
+    // optional uint32 num_backup_commands = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_backup_commands());
+    }
+
+    // optional uint32 num_new_commands = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_new_commands());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_Move::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_Move::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_Move::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_Move::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_Move*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_Move&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_Move)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_data(from._internal_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.num_backup_commands_ = from._impl_.num_backup_commands_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_new_commands_ = from._impl_.num_new_commands_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_Move::CopyFrom(const CCLCMsg_Move& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_Move)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_Move::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_Move::InternalSwap(CCLCMsg_Move* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CCLCMsg_Move, _impl_.num_new_commands_)
+      + sizeof(CCLCMsg_Move::_impl_.num_new_commands_)
+      - PROTOBUF_FIELD_OFFSET(CCLCMsg_Move, _impl_.num_backup_commands_)>(
+          reinterpret_cast<char*>(&_impl_.num_backup_commands_),
+          reinterpret_cast<char*>(&other->_impl_.num_backup_commands_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_Move::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[1]);
+}
+
+// ===================================================================
+
+class CCLCMsg_VoiceData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CCLCMsg_VoiceData>()._impl_._has_bits_);
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_xuid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_format(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_sequence_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_section_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_uncompressed_sample_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+CCLCMsg_VoiceData::CCLCMsg_VoiceData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_VoiceData)
+}
+CCLCMsg_VoiceData::CCLCMsg_VoiceData(const CCLCMsg_VoiceData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_VoiceData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.xuid_){}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.sequence_bytes_){}
+    , decltype(_impl_.section_number_){}
+    , decltype(_impl_.uncompressed_sample_offset_){}
+    , decltype(_impl_.tick_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.xuid_, &from._impl_.xuid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tick_) -
+    reinterpret_cast<char*>(&_impl_.xuid_)) + sizeof(_impl_.tick_));
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_VoiceData)
+}
+
+inline void CCLCMsg_VoiceData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.xuid_){uint64_t{0u}}
+    , decltype(_impl_.format_){0}
+    , decltype(_impl_.sequence_bytes_){0}
+    , decltype(_impl_.section_number_){0u}
+    , decltype(_impl_.uncompressed_sample_offset_){0u}
+    , decltype(_impl_.tick_){0u}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CCLCMsg_VoiceData::~CCLCMsg_VoiceData() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_VoiceData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_VoiceData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void CCLCMsg_VoiceData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_VoiceData::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_VoiceData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000007eu) {
+    ::memset(&_impl_.xuid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.tick_) -
+        reinterpret_cast<char*>(&_impl_.xuid_)) + sizeof(_impl_.tick_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_VoiceData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bytes data = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 xuid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_xuid(&has_bits);
+          _impl_.xuid_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .VoiceDataFormat_t format = 3 [default = VOICEDATA_FORMAT_STEAM];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::VoiceDataFormat_t_IsValid(val))) {
+            _internal_set_format(static_cast<::VoiceDataFormat_t>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 sequence_bytes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_sequence_bytes(&has_bits);
+          _impl_.sequence_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 section_number = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_section_number(&has_bits);
+          _impl_.section_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 uncompressed_sample_offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_uncompressed_sample_offset(&has_bits);
+          _impl_.uncompressed_sample_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 tick = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_VoiceData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_VoiceData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bytes data = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_data(), target);
+  }
+
+  // optional fixed64 xuid = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_xuid(), target);
+  }
+
+  // optional .VoiceDataFormat_t format = 3 [default = VOICEDATA_FORMAT_STEAM];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_format(), target);
+  }
+
+  // optional int32 sequence_bytes = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_sequence_bytes(), target);
+  }
+
+  // optional uint32 section_number = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_section_number(), target);
+  }
+
+  // optional uint32 uncompressed_sample_offset = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_uncompressed_sample_offset(), target);
+  }
+
+  // optional uint32 tick = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_tick(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_VoiceData)
+  return target;
+}
+
+size_t CCLCMsg_VoiceData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_VoiceData)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional bytes data = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_data());
+    }
+
+    // optional fixed64 xuid = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional .VoiceDataFormat_t format = 3 [default = VOICEDATA_FORMAT_STEAM];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_format());
+    }
+
+    // optional int32 sequence_bytes = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sequence_bytes());
+    }
+
+    // optional uint32 section_number = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_section_number());
+    }
+
+    // optional uint32 uncompressed_sample_offset = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_uncompressed_sample_offset());
+    }
+
+    // optional uint32 tick = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tick());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_VoiceData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_VoiceData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_VoiceData::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_VoiceData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_VoiceData*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_VoiceData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_VoiceData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_data(from._internal_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.xuid_ = from._impl_.xuid_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.format_ = from._impl_.format_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.sequence_bytes_ = from._impl_.sequence_bytes_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.section_number_ = from._impl_.section_number_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.uncompressed_sample_offset_ = from._impl_.uncompressed_sample_offset_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_VoiceData::CopyFrom(const CCLCMsg_VoiceData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_VoiceData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_VoiceData::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_VoiceData::InternalSwap(CCLCMsg_VoiceData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CCLCMsg_VoiceData, _impl_.tick_)
+      + sizeof(CCLCMsg_VoiceData::_impl_.tick_)
+      - PROTOBUF_FIELD_OFFSET(CCLCMsg_VoiceData, _impl_.xuid_)>(
+          reinterpret_cast<char*>(&_impl_.xuid_),
+          reinterpret_cast<char*>(&other->_impl_.xuid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_VoiceData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[2]);
+}
+
+// ===================================================================
+
+class CCLCMsg_BaselineAck::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CCLCMsg_BaselineAck>()._impl_._has_bits_);
+  static void set_has_baseline_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_baseline_nr(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CCLCMsg_BaselineAck::CCLCMsg_BaselineAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_BaselineAck)
+}
+CCLCMsg_BaselineAck::CCLCMsg_BaselineAck(const CCLCMsg_BaselineAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_BaselineAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.baseline_tick_){}
+    , decltype(_impl_.baseline_nr_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.baseline_tick_, &from._impl_.baseline_tick_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.baseline_nr_) -
+    reinterpret_cast<char*>(&_impl_.baseline_tick_)) + sizeof(_impl_.baseline_nr_));
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_BaselineAck)
+}
+
+inline void CCLCMsg_BaselineAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.baseline_tick_){0}
+    , decltype(_impl_.baseline_nr_){0}
+  };
+}
+
+CCLCMsg_BaselineAck::~CCLCMsg_BaselineAck() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_BaselineAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_BaselineAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CCLCMsg_BaselineAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_BaselineAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_BaselineAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.baseline_tick_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.baseline_nr_) -
+        reinterpret_cast<char*>(&_impl_.baseline_tick_)) + sizeof(_impl_.baseline_nr_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_BaselineAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 baseline_tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_baseline_tick(&has_bits);
+          _impl_.baseline_tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 baseline_nr = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_baseline_nr(&has_bits);
+          _impl_.baseline_nr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_BaselineAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_BaselineAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 baseline_tick = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_baseline_tick(), target);
+  }
+
+  // optional int32 baseline_nr = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_baseline_nr(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_BaselineAck)
+  return target;
+}
+
+size_t CCLCMsg_BaselineAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_BaselineAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 baseline_tick = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_baseline_tick());
+    }
+
+    // optional int32 baseline_nr = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_baseline_nr());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_BaselineAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_BaselineAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_BaselineAck::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_BaselineAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_BaselineAck*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_BaselineAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_BaselineAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.baseline_tick_ = from._impl_.baseline_tick_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.baseline_nr_ = from._impl_.baseline_nr_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_BaselineAck::CopyFrom(const CCLCMsg_BaselineAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_BaselineAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_BaselineAck::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_BaselineAck::InternalSwap(CCLCMsg_BaselineAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CCLCMsg_BaselineAck, _impl_.baseline_nr_)
+      + sizeof(CCLCMsg_BaselineAck::_impl_.baseline_nr_)
+      - PROTOBUF_FIELD_OFFSET(CCLCMsg_BaselineAck, _impl_.baseline_tick_)>(
+          reinterpret_cast<char*>(&_impl_.baseline_tick_),
+          reinterpret_cast<char*>(&other->_impl_.baseline_tick_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_BaselineAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[3]);
+}
+
+// ===================================================================
+
+class CCLCMsg_ListenEvents::_Internal {
+ public:
+};
+
+CCLCMsg_ListenEvents::CCLCMsg_ListenEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_ListenEvents)
+}
+CCLCMsg_ListenEvents::CCLCMsg_ListenEvents(const CCLCMsg_ListenEvents& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_ListenEvents* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.event_mask_){from._impl_.event_mask_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_ListenEvents)
+}
+
+inline void CCLCMsg_ListenEvents::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.event_mask_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CCLCMsg_ListenEvents::~CCLCMsg_ListenEvents() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_ListenEvents)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_ListenEvents::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.event_mask_.~RepeatedField();
+}
+
+void CCLCMsg_ListenEvents::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_ListenEvents::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_ListenEvents)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.event_mask_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_ListenEvents::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated fixed32 event_mask = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_event_mask(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr));
+            ptr += sizeof(uint32_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<13>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_event_mask(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_ListenEvents::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_ListenEvents)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated fixed32 event_mask = 1;
+  for (int i = 0, n = this->_internal_event_mask_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_event_mask(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_ListenEvents)
+  return target;
+}
+
+size_t CCLCMsg_ListenEvents::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_ListenEvents)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed32 event_mask = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_event_mask_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_event_mask_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_ListenEvents::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_ListenEvents::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_ListenEvents::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_ListenEvents::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_ListenEvents*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_ListenEvents&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_ListenEvents)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.event_mask_.MergeFrom(from._impl_.event_mask_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_ListenEvents::CopyFrom(const CCLCMsg_ListenEvents& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_ListenEvents)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_ListenEvents::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_ListenEvents::InternalSwap(CCLCMsg_ListenEvents* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.event_mask_.InternalSwap(&other->_impl_.event_mask_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_ListenEvents::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[4]);
+}
+
+// ===================================================================
+
+class CCLCMsg_RespondCvarValue::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CCLCMsg_RespondCvarValue>()._impl_._has_bits_);
+  static void set_has_cookie(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_status_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CCLCMsg_RespondCvarValue::CCLCMsg_RespondCvarValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_RespondCvarValue)
+}
+CCLCMsg_RespondCvarValue::CCLCMsg_RespondCvarValue(const CCLCMsg_RespondCvarValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_RespondCvarValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.cookie_){}
+    , decltype(_impl_.status_code_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.cookie_, &from._impl_.cookie_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_code_) -
+    reinterpret_cast<char*>(&_impl_.cookie_)) + sizeof(_impl_.status_code_));
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_RespondCvarValue)
+}
+
+inline void CCLCMsg_RespondCvarValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.cookie_){0}
+    , decltype(_impl_.status_code_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CCLCMsg_RespondCvarValue::~CCLCMsg_RespondCvarValue() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_RespondCvarValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_RespondCvarValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void CCLCMsg_RespondCvarValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_RespondCvarValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_RespondCvarValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.cookie_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.status_code_) -
+        reinterpret_cast<char*>(&_impl_.cookie_)) + sizeof(_impl_.status_code_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_RespondCvarValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 cookie = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_cookie(&has_bits);
+          _impl_.cookie_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 status_code = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_status_code(&has_bits);
+          _impl_.status_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CCLCMsg_RespondCvarValue.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CCLCMsg_RespondCvarValue.value");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_RespondCvarValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_RespondCvarValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 cookie = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_cookie(), target);
+  }
+
+  // optional int32 status_code = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_status_code(), target);
+  }
+
+  // optional string name = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CCLCMsg_RespondCvarValue.name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_name(), target);
+  }
+
+  // optional string value = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CCLCMsg_RespondCvarValue.value");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_RespondCvarValue)
+  return target;
+}
+
+size_t CCLCMsg_RespondCvarValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_RespondCvarValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string name = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string value = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_value());
+    }
+
+    // optional int32 cookie = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_cookie());
+    }
+
+    // optional int32 status_code = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_status_code());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_RespondCvarValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_RespondCvarValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_RespondCvarValue::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_RespondCvarValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_RespondCvarValue*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_RespondCvarValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_RespondCvarValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.cookie_ = from._impl_.cookie_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.status_code_ = from._impl_.status_code_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_RespondCvarValue::CopyFrom(const CCLCMsg_RespondCvarValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_RespondCvarValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_RespondCvarValue::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_RespondCvarValue::InternalSwap(CCLCMsg_RespondCvarValue* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CCLCMsg_RespondCvarValue, _impl_.status_code_)
+      + sizeof(CCLCMsg_RespondCvarValue::_impl_.status_code_)
+      - PROTOBUF_FIELD_OFFSET(CCLCMsg_RespondCvarValue, _impl_.cookie_)>(
+          reinterpret_cast<char*>(&_impl_.cookie_),
+          reinterpret_cast<char*>(&other->_impl_.cookie_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_RespondCvarValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[5]);
+}
+
+// ===================================================================
+
+class CCLCMsg_FileCRCCheck::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CCLCMsg_FileCRCCheck>()._impl_._has_bits_);
+  static void set_has_code_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_code_filename(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_filename(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_crc(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+CCLCMsg_FileCRCCheck::CCLCMsg_FileCRCCheck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_FileCRCCheck)
+}
+CCLCMsg_FileCRCCheck::CCLCMsg_FileCRCCheck(const CCLCMsg_FileCRCCheck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_FileCRCCheck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.filename_){}
+    , decltype(_impl_.code_path_){}
+    , decltype(_impl_.code_filename_){}
+    , decltype(_impl_.crc_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_path()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.filename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_filename()) {
+    _this->_impl_.filename_.Set(from._internal_filename(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.code_path_, &from._impl_.code_path_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.crc_) -
+    reinterpret_cast<char*>(&_impl_.code_path_)) + sizeof(_impl_.crc_));
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_FileCRCCheck)
+}
+
+inline void CCLCMsg_FileCRCCheck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.filename_){}
+    , decltype(_impl_.code_path_){0}
+    , decltype(_impl_.code_filename_){0}
+    , decltype(_impl_.crc_){0u}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.filename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CCLCMsg_FileCRCCheck::~CCLCMsg_FileCRCCheck() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_FileCRCCheck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_FileCRCCheck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.path_.Destroy();
+  _impl_.filename_.Destroy();
+}
+
+void CCLCMsg_FileCRCCheck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_FileCRCCheck::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_FileCRCCheck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.path_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.filename_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000001cu) {
+    ::memset(&_impl_.code_path_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.crc_) -
+        reinterpret_cast<char*>(&_impl_.code_path_)) + sizeof(_impl_.crc_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_FileCRCCheck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 code_path = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_code_path(&has_bits);
+          _impl_.code_path_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CCLCMsg_FileCRCCheck.path");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 code_filename = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_code_filename(&has_bits);
+          _impl_.code_filename_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string filename = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_filename();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CCLCMsg_FileCRCCheck.filename");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 crc = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_crc(&has_bits);
+          _impl_.crc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_FileCRCCheck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_FileCRCCheck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 code_path = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_code_path(), target);
+  }
+
+  // optional string path = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CCLCMsg_FileCRCCheck.path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_path(), target);
+  }
+
+  // optional int32 code_filename = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_code_filename(), target);
+  }
+
+  // optional string filename = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_filename().data(), static_cast<int>(this->_internal_filename().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CCLCMsg_FileCRCCheck.filename");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_filename(), target);
+  }
+
+  // optional fixed32 crc = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(5, this->_internal_crc(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_FileCRCCheck)
+  return target;
+}
+
+size_t CCLCMsg_FileCRCCheck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_FileCRCCheck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string path = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_path());
+    }
+
+    // optional string filename = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_filename());
+    }
+
+    // optional int32 code_path = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_code_path());
+    }
+
+    // optional int32 code_filename = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_code_filename());
+    }
+
+    // optional fixed32 crc = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_FileCRCCheck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_FileCRCCheck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_FileCRCCheck::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_FileCRCCheck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_FileCRCCheck*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_FileCRCCheck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_FileCRCCheck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_path(from._internal_path());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_filename(from._internal_filename());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.code_path_ = from._impl_.code_path_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.code_filename_ = from._impl_.code_filename_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.crc_ = from._impl_.crc_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_FileCRCCheck::CopyFrom(const CCLCMsg_FileCRCCheck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_FileCRCCheck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_FileCRCCheck::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_FileCRCCheck::InternalSwap(CCLCMsg_FileCRCCheck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.filename_, lhs_arena,
+      &other->_impl_.filename_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CCLCMsg_FileCRCCheck, _impl_.crc_)
+      + sizeof(CCLCMsg_FileCRCCheck::_impl_.crc_)
+      - PROTOBUF_FIELD_OFFSET(CCLCMsg_FileCRCCheck, _impl_.code_path_)>(
+          reinterpret_cast<char*>(&_impl_.code_path_),
+          reinterpret_cast<char*>(&other->_impl_.code_path_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_FileCRCCheck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[6]);
+}
+
+// ===================================================================
+
+class CCLCMsg_LoadingProgress::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CCLCMsg_LoadingProgress>()._impl_._has_bits_);
+  static void set_has_progress(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CCLCMsg_LoadingProgress::CCLCMsg_LoadingProgress(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_LoadingProgress)
+}
+CCLCMsg_LoadingProgress::CCLCMsg_LoadingProgress(const CCLCMsg_LoadingProgress& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_LoadingProgress* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.progress_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.progress_ = from._impl_.progress_;
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_LoadingProgress)
+}
+
+inline void CCLCMsg_LoadingProgress::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.progress_){0}
+  };
+}
+
+CCLCMsg_LoadingProgress::~CCLCMsg_LoadingProgress() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_LoadingProgress)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_LoadingProgress::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CCLCMsg_LoadingProgress::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_LoadingProgress::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_LoadingProgress)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.progress_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_LoadingProgress::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 progress = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_progress(&has_bits);
+          _impl_.progress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_LoadingProgress::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_LoadingProgress)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 progress = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_progress(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_LoadingProgress)
+  return target;
+}
+
+size_t CCLCMsg_LoadingProgress::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_LoadingProgress)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 progress = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_progress());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_LoadingProgress::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_LoadingProgress::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_LoadingProgress::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_LoadingProgress::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_LoadingProgress*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_LoadingProgress&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_LoadingProgress)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_progress()) {
+    _this->_internal_set_progress(from._internal_progress());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_LoadingProgress::CopyFrom(const CCLCMsg_LoadingProgress& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_LoadingProgress)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_LoadingProgress::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_LoadingProgress::InternalSwap(CCLCMsg_LoadingProgress* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.progress_, other->_impl_.progress_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_LoadingProgress::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[7]);
+}
+
+// ===================================================================
+
+class CCLCMsg_SplitPlayerConnect::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CCLCMsg_SplitPlayerConnect>()._impl_._has_bits_);
+  static const ::CMsg_CVars& convars(const CCLCMsg_SplitPlayerConnect* msg);
+  static void set_has_convars(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::CMsg_CVars&
+CCLCMsg_SplitPlayerConnect::_Internal::convars(const CCLCMsg_SplitPlayerConnect* msg) {
+  return *msg->_impl_.convars_;
+}
+void CCLCMsg_SplitPlayerConnect::clear_convars() {
+  if (_impl_.convars_ != nullptr) _impl_.convars_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+CCLCMsg_SplitPlayerConnect::CCLCMsg_SplitPlayerConnect(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_SplitPlayerConnect)
+}
+CCLCMsg_SplitPlayerConnect::CCLCMsg_SplitPlayerConnect(const CCLCMsg_SplitPlayerConnect& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_SplitPlayerConnect* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.convars_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_convars()) {
+    _this->_impl_.convars_ = new ::CMsg_CVars(*from._impl_.convars_);
+  }
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_SplitPlayerConnect)
+}
+
+inline void CCLCMsg_SplitPlayerConnect::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.convars_){nullptr}
+  };
+}
+
+CCLCMsg_SplitPlayerConnect::~CCLCMsg_SplitPlayerConnect() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_SplitPlayerConnect)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_SplitPlayerConnect::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.convars_;
+}
+
+void CCLCMsg_SplitPlayerConnect::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_SplitPlayerConnect::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_SplitPlayerConnect)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.convars_ != nullptr);
+    _impl_.convars_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_SplitPlayerConnect::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .CMsg_CVars convars = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_convars(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_SplitPlayerConnect::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_SplitPlayerConnect)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .CMsg_CVars convars = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::convars(this),
+        _Internal::convars(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_SplitPlayerConnect)
+  return target;
+}
+
+size_t CCLCMsg_SplitPlayerConnect::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_SplitPlayerConnect)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .CMsg_CVars convars = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.convars_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_SplitPlayerConnect::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_SplitPlayerConnect::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_SplitPlayerConnect::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_SplitPlayerConnect::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_SplitPlayerConnect*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_SplitPlayerConnect&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_SplitPlayerConnect)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_convars()) {
+    _this->_internal_mutable_convars()->::CMsg_CVars::MergeFrom(
+        from._internal_convars());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_SplitPlayerConnect::CopyFrom(const CCLCMsg_SplitPlayerConnect& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_SplitPlayerConnect)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_SplitPlayerConnect::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_SplitPlayerConnect::InternalSwap(CCLCMsg_SplitPlayerConnect* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.convars_, other->_impl_.convars_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_SplitPlayerConnect::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[8]);
+}
+
+// ===================================================================
+
+class CCLCMsg_ClientMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CCLCMsg_ClientMessage>()._impl_._has_bits_);
+  static void set_has_msg_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CCLCMsg_ClientMessage::CCLCMsg_ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CCLCMsg_ClientMessage)
+}
+CCLCMsg_ClientMessage::CCLCMsg_ClientMessage(const CCLCMsg_ClientMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CCLCMsg_ClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.msg_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.msg_type_ = from._impl_.msg_type_;
+  // @@protoc_insertion_point(copy_constructor:CCLCMsg_ClientMessage)
+}
+
+inline void CCLCMsg_ClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.msg_type_){0}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CCLCMsg_ClientMessage::~CCLCMsg_ClientMessage() {
+  // @@protoc_insertion_point(destructor:CCLCMsg_ClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CCLCMsg_ClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void CCLCMsg_ClientMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CCLCMsg_ClientMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:CCLCMsg_ClientMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.data_.ClearNonDefaultToEmpty();
+  }
+  _impl_.msg_type_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CCLCMsg_ClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 msg_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_msg_type(&has_bits);
+          _impl_.msg_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CCLCMsg_ClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CCLCMsg_ClientMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 msg_type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_msg_type(), target);
+  }
+
+  // optional bytes data = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CCLCMsg_ClientMessage)
+  return target;
+}
+
+size_t CCLCMsg_ClientMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CCLCMsg_ClientMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes data = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_data());
+    }
+
+    // optional int32 msg_type = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_msg_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CCLCMsg_ClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CCLCMsg_ClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CCLCMsg_ClientMessage::GetClassData() const { return &_class_data_; }
+
+
+void CCLCMsg_ClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CCLCMsg_ClientMessage*>(&to_msg);
+  auto& from = static_cast<const CCLCMsg_ClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CCLCMsg_ClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_data(from._internal_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.msg_type_ = from._impl_.msg_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CCLCMsg_ClientMessage::CopyFrom(const CCLCMsg_ClientMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CCLCMsg_ClientMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CCLCMsg_ClientMessage::IsInitialized() const {
+  return true;
+}
+
+void CCLCMsg_ClientMessage::InternalSwap(CCLCMsg_ClientMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  swap(_impl_.msg_type_, other->_impl_.msg_type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CCLCMsg_ClientMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[9]);
+}
+
+// ===================================================================
+
+class CSVCMsg_ServerInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_ServerInfo>()._impl_._has_bits_);
+  static void set_has_protocol(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_server_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_is_dedicated(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_is_hltv(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_is_replay(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_c_os(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_map_crc(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_client_crc(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_string_table_crc(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_max_clients(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_max_classes(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_player_slot(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_tick_interval(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_game_dir(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_map_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sky_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_host_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_addon_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+CSVCMsg_ServerInfo::CSVCMsg_ServerInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_ServerInfo)
+}
+CSVCMsg_ServerInfo::CSVCMsg_ServerInfo(const CSVCMsg_ServerInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_ServerInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.game_dir_){}
+    , decltype(_impl_.map_name_){}
+    , decltype(_impl_.sky_name_){}
+    , decltype(_impl_.host_name_){}
+    , decltype(_impl_.addon_name_){}
+    , decltype(_impl_.protocol_){}
+    , decltype(_impl_.server_count_){}
+    , decltype(_impl_.is_dedicated_){}
+    , decltype(_impl_.is_hltv_){}
+    , decltype(_impl_.is_replay_){}
+    , decltype(_impl_.c_os_){}
+    , decltype(_impl_.map_crc_){}
+    , decltype(_impl_.client_crc_){}
+    , decltype(_impl_.string_table_crc_){}
+    , decltype(_impl_.max_clients_){}
+    , decltype(_impl_.max_classes_){}
+    , decltype(_impl_.player_slot_){}
+    , decltype(_impl_.tick_interval_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.game_dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.game_dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_game_dir()) {
+    _this->_impl_.game_dir_.Set(from._internal_game_dir(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.map_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_map_name()) {
+    _this->_impl_.map_name_.Set(from._internal_map_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.sky_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sky_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_sky_name()) {
+    _this->_impl_.sky_name_.Set(from._internal_sky_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.host_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.host_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_host_name()) {
+    _this->_impl_.host_name_.Set(from._internal_host_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.addon_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.addon_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_addon_name()) {
+    _this->_impl_.addon_name_.Set(from._internal_addon_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.protocol_, &from._impl_.protocol_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tick_interval_) -
+    reinterpret_cast<char*>(&_impl_.protocol_)) + sizeof(_impl_.tick_interval_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_ServerInfo)
+}
+
+inline void CSVCMsg_ServerInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.game_dir_){}
+    , decltype(_impl_.map_name_){}
+    , decltype(_impl_.sky_name_){}
+    , decltype(_impl_.host_name_){}
+    , decltype(_impl_.addon_name_){}
+    , decltype(_impl_.protocol_){0}
+    , decltype(_impl_.server_count_){0}
+    , decltype(_impl_.is_dedicated_){false}
+    , decltype(_impl_.is_hltv_){false}
+    , decltype(_impl_.is_replay_){false}
+    , decltype(_impl_.c_os_){0}
+    , decltype(_impl_.map_crc_){0u}
+    , decltype(_impl_.client_crc_){0u}
+    , decltype(_impl_.string_table_crc_){0u}
+    , decltype(_impl_.max_clients_){0}
+    , decltype(_impl_.max_classes_){0}
+    , decltype(_impl_.player_slot_){0}
+    , decltype(_impl_.tick_interval_){0}
+  };
+  _impl_.game_dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.game_dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.map_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sky_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sky_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.host_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.host_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.addon_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.addon_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_ServerInfo::~CSVCMsg_ServerInfo() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_ServerInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_ServerInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.game_dir_.Destroy();
+  _impl_.map_name_.Destroy();
+  _impl_.sky_name_.Destroy();
+  _impl_.host_name_.Destroy();
+  _impl_.addon_name_.Destroy();
+}
+
+void CSVCMsg_ServerInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_ServerInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_ServerInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.game_dir_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.map_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.sky_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.host_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.addon_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000e0u) {
+    ::memset(&_impl_.protocol_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.is_dedicated_) -
+        reinterpret_cast<char*>(&_impl_.protocol_)) + sizeof(_impl_.is_dedicated_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.is_hltv_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_classes_) -
+        reinterpret_cast<char*>(&_impl_.is_hltv_)) + sizeof(_impl_.max_classes_));
+  }
+  if (cached_has_bits & 0x00030000u) {
+    ::memset(&_impl_.player_slot_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.tick_interval_) -
+        reinterpret_cast<char*>(&_impl_.player_slot_)) + sizeof(_impl_.tick_interval_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_ServerInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 protocol = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_protocol(&has_bits);
+          _impl_.protocol_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 server_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_server_count(&has_bits);
+          _impl_.server_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_dedicated = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_is_dedicated(&has_bits);
+          _impl_.is_dedicated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_hltv = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_is_hltv(&has_bits);
+          _impl_.is_hltv_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_replay = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_is_replay(&has_bits);
+          _impl_.is_replay_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 c_os = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_c_os(&has_bits);
+          _impl_.c_os_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 map_crc = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_map_crc(&has_bits);
+          _impl_.map_crc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 client_crc = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_client_crc(&has_bits);
+          _impl_.client_crc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 string_table_crc = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_string_table_crc(&has_bits);
+          _impl_.string_table_crc_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 max_clients = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_max_clients(&has_bits);
+          _impl_.max_clients_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 max_classes = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_max_classes(&has_bits);
+          _impl_.max_classes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 player_slot = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_player_slot(&has_bits);
+          _impl_.player_slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float tick_interval = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 109)) {
+          _Internal::set_has_tick_interval(&has_bits);
+          _impl_.tick_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string game_dir = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_game_dir();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_ServerInfo.game_dir");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string map_name = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          auto str = _internal_mutable_map_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_ServerInfo.map_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string sky_name = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          auto str = _internal_mutable_sky_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_ServerInfo.sky_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string host_name = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          auto str = _internal_mutable_host_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_ServerInfo.host_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string addon_name = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          auto str = _internal_mutable_addon_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_ServerInfo.addon_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_ServerInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_ServerInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 protocol = 1;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_protocol(), target);
+  }
+
+  // optional int32 server_count = 2;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_server_count(), target);
+  }
+
+  // optional bool is_dedicated = 3;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_dedicated(), target);
+  }
+
+  // optional bool is_hltv = 4;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_is_hltv(), target);
+  }
+
+  // optional bool is_replay = 5;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_is_replay(), target);
+  }
+
+  // optional int32 c_os = 6;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_c_os(), target);
+  }
+
+  // optional fixed32 map_crc = 7;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(7, this->_internal_map_crc(), target);
+  }
+
+  // optional fixed32 client_crc = 8;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(8, this->_internal_client_crc(), target);
+  }
+
+  // optional fixed32 string_table_crc = 9;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(9, this->_internal_string_table_crc(), target);
+  }
+
+  // optional int32 max_clients = 10;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_max_clients(), target);
+  }
+
+  // optional int32 max_classes = 11;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_max_classes(), target);
+  }
+
+  // optional int32 player_slot = 12;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_player_slot(), target);
+  }
+
+  // optional float tick_interval = 13;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(13, this->_internal_tick_interval(), target);
+  }
+
+  // optional string game_dir = 14;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_game_dir().data(), static_cast<int>(this->_internal_game_dir().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_ServerInfo.game_dir");
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_game_dir(), target);
+  }
+
+  // optional string map_name = 15;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_map_name().data(), static_cast<int>(this->_internal_map_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_ServerInfo.map_name");
+    target = stream->WriteStringMaybeAliased(
+        15, this->_internal_map_name(), target);
+  }
+
+  // optional string sky_name = 16;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_sky_name().data(), static_cast<int>(this->_internal_sky_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_ServerInfo.sky_name");
+    target = stream->WriteStringMaybeAliased(
+        16, this->_internal_sky_name(), target);
+  }
+
+  // optional string host_name = 17;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_host_name().data(), static_cast<int>(this->_internal_host_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_ServerInfo.host_name");
+    target = stream->WriteStringMaybeAliased(
+        17, this->_internal_host_name(), target);
+  }
+
+  // optional string addon_name = 18;
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_addon_name().data(), static_cast<int>(this->_internal_addon_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_ServerInfo.addon_name");
+    target = stream->WriteStringMaybeAliased(
+        18, this->_internal_addon_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_ServerInfo)
+  return target;
+}
+
+size_t CSVCMsg_ServerInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_ServerInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string game_dir = 14;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_game_dir());
+    }
+
+    // optional string map_name = 15;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_map_name());
+    }
+
+    // optional string sky_name = 16;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_sky_name());
+    }
+
+    // optional string host_name = 17;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_host_name());
+    }
+
+    // optional string addon_name = 18;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_addon_name());
+    }
+
+    // optional int32 protocol = 1;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_protocol());
+    }
+
+    // optional int32 server_count = 2;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_server_count());
+    }
+
+    // optional bool is_dedicated = 3;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional bool is_hltv = 4;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool is_replay = 5;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 c_os = 6;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_c_os());
+    }
+
+    // optional fixed32 map_crc = 7;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 4;
+    }
+
+    // optional fixed32 client_crc = 8;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional fixed32 string_table_crc = 9;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 max_clients = 10;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_clients());
+    }
+
+    // optional int32 max_classes = 11;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_classes());
+    }
+
+  }
+  if (cached_has_bits & 0x00030000u) {
+    // optional int32 player_slot = 12;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_player_slot());
+    }
+
+    // optional float tick_interval = 13;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_ServerInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_ServerInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_ServerInfo::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_ServerInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_ServerInfo*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_ServerInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_ServerInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_game_dir(from._internal_game_dir());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_map_name(from._internal_map_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_sky_name(from._internal_sky_name());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_host_name(from._internal_host_name());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_addon_name(from._internal_addon_name());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.protocol_ = from._impl_.protocol_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.server_count_ = from._impl_.server_count_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.is_dedicated_ = from._impl_.is_dedicated_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.is_hltv_ = from._impl_.is_hltv_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.is_replay_ = from._impl_.is_replay_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.c_os_ = from._impl_.c_os_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.map_crc_ = from._impl_.map_crc_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.client_crc_ = from._impl_.client_crc_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.string_table_crc_ = from._impl_.string_table_crc_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.max_clients_ = from._impl_.max_clients_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.max_classes_ = from._impl_.max_classes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00030000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.player_slot_ = from._impl_.player_slot_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.tick_interval_ = from._impl_.tick_interval_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_ServerInfo::CopyFrom(const CSVCMsg_ServerInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_ServerInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_ServerInfo::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_ServerInfo::InternalSwap(CSVCMsg_ServerInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.game_dir_, lhs_arena,
+      &other->_impl_.game_dir_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.map_name_, lhs_arena,
+      &other->_impl_.map_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sky_name_, lhs_arena,
+      &other->_impl_.sky_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.host_name_, lhs_arena,
+      &other->_impl_.host_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.addon_name_, lhs_arena,
+      &other->_impl_.addon_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_ServerInfo, _impl_.tick_interval_)
+      + sizeof(CSVCMsg_ServerInfo::_impl_.tick_interval_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_ServerInfo, _impl_.protocol_)>(
+          reinterpret_cast<char*>(&_impl_.protocol_),
+          reinterpret_cast<char*>(&other->_impl_.protocol_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_ServerInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[10]);
+}
+
+// ===================================================================
+
+class CSVCMsg_ClassInfo_class_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_ClassInfo_class_t>()._impl_._has_bits_);
+  static void set_has_class_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_data_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_class_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CSVCMsg_ClassInfo_class_t::CSVCMsg_ClassInfo_class_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_ClassInfo.class_t)
+}
+CSVCMsg_ClassInfo_class_t::CSVCMsg_ClassInfo_class_t(const CSVCMsg_ClassInfo_class_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_ClassInfo_class_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_table_name_){}
+    , decltype(_impl_.class_name_){}
+    , decltype(_impl_.class_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data_table_name()) {
+    _this->_impl_.data_table_name_.Set(from._internal_data_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.class_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.class_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_class_name()) {
+    _this->_impl_.class_name_.Set(from._internal_class_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.class_id_ = from._impl_.class_id_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_ClassInfo.class_t)
+}
+
+inline void CSVCMsg_ClassInfo_class_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_table_name_){}
+    , decltype(_impl_.class_name_){}
+    , decltype(_impl_.class_id_){0}
+  };
+  _impl_.data_table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.class_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.class_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_ClassInfo_class_t::~CSVCMsg_ClassInfo_class_t() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_ClassInfo.class_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_ClassInfo_class_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_table_name_.Destroy();
+  _impl_.class_name_.Destroy();
+}
+
+void CSVCMsg_ClassInfo_class_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_ClassInfo_class_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_ClassInfo.class_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.data_table_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.class_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.class_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_ClassInfo_class_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 class_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_class_id(&has_bits);
+          _impl_.class_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string data_table_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_data_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_ClassInfo.class_t.data_table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string class_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_class_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_ClassInfo.class_t.class_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_ClassInfo_class_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_ClassInfo.class_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 class_id = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_class_id(), target);
+  }
+
+  // optional string data_table_name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_data_table_name().data(), static_cast<int>(this->_internal_data_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_ClassInfo.class_t.data_table_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_data_table_name(), target);
+  }
+
+  // optional string class_name = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_class_name().data(), static_cast<int>(this->_internal_class_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_ClassInfo.class_t.class_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_class_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_ClassInfo.class_t)
+  return target;
+}
+
+size_t CSVCMsg_ClassInfo_class_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_ClassInfo.class_t)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string data_table_name = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_data_table_name());
+    }
+
+    // optional string class_name = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_class_name());
+    }
+
+    // optional int32 class_id = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_class_id());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_ClassInfo_class_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_ClassInfo_class_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_ClassInfo_class_t::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_ClassInfo_class_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_ClassInfo_class_t*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_ClassInfo_class_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_ClassInfo.class_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_data_table_name(from._internal_data_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_class_name(from._internal_class_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.class_id_ = from._impl_.class_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_ClassInfo_class_t::CopyFrom(const CSVCMsg_ClassInfo_class_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_ClassInfo.class_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_ClassInfo_class_t::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_ClassInfo_class_t::InternalSwap(CSVCMsg_ClassInfo_class_t* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_table_name_, lhs_arena,
+      &other->_impl_.data_table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.class_name_, lhs_arena,
+      &other->_impl_.class_name_, rhs_arena
+  );
+  swap(_impl_.class_id_, other->_impl_.class_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_ClassInfo_class_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[11]);
+}
+
+// ===================================================================
+
+class CSVCMsg_ClassInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_ClassInfo>()._impl_._has_bits_);
+  static void set_has_create_on_client(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_ClassInfo::CSVCMsg_ClassInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_ClassInfo)
+}
+CSVCMsg_ClassInfo::CSVCMsg_ClassInfo(const CSVCMsg_ClassInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_ClassInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.classes_){from._impl_.classes_}
+    , decltype(_impl_.create_on_client_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.create_on_client_ = from._impl_.create_on_client_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_ClassInfo)
+}
+
+inline void CSVCMsg_ClassInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.classes_){arena}
+    , decltype(_impl_.create_on_client_){false}
+  };
+}
+
+CSVCMsg_ClassInfo::~CSVCMsg_ClassInfo() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_ClassInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_ClassInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.classes_.~RepeatedPtrField();
+}
+
+void CSVCMsg_ClassInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_ClassInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_ClassInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.classes_.Clear();
+  _impl_.create_on_client_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_ClassInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool create_on_client = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_create_on_client(&has_bits);
+          _impl_.create_on_client_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CSVCMsg_ClassInfo.class_t classes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_classes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_ClassInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_ClassInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool create_on_client = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_create_on_client(), target);
+  }
+
+  // repeated .CSVCMsg_ClassInfo.class_t classes = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_classes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_classes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_ClassInfo)
+  return target;
+}
+
+size_t CSVCMsg_ClassInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_ClassInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsg_ClassInfo.class_t classes = 2;
+  total_size += 1UL * this->_internal_classes_size();
+  for (const auto& msg : this->_impl_.classes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional bool create_on_client = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_ClassInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_ClassInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_ClassInfo::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_ClassInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_ClassInfo*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_ClassInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_ClassInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.classes_.MergeFrom(from._impl_.classes_);
+  if (from._internal_has_create_on_client()) {
+    _this->_internal_set_create_on_client(from._internal_create_on_client());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_ClassInfo::CopyFrom(const CSVCMsg_ClassInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_ClassInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_ClassInfo::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_ClassInfo::InternalSwap(CSVCMsg_ClassInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.classes_.InternalSwap(&other->_impl_.classes_);
+  swap(_impl_.create_on_client_, other->_impl_.create_on_client_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_ClassInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[12]);
+}
+
+// ===================================================================
+
+class CSVCMsg_SetPause::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_SetPause>()._impl_._has_bits_);
+  static void set_has_paused(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_SetPause::CSVCMsg_SetPause(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_SetPause)
+}
+CSVCMsg_SetPause::CSVCMsg_SetPause(const CSVCMsg_SetPause& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_SetPause* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.paused_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.paused_ = from._impl_.paused_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_SetPause)
+}
+
+inline void CSVCMsg_SetPause::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.paused_){false}
+  };
+}
+
+CSVCMsg_SetPause::~CSVCMsg_SetPause() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_SetPause)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_SetPause::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CSVCMsg_SetPause::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_SetPause::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_SetPause)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.paused_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_SetPause::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool paused = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_paused(&has_bits);
+          _impl_.paused_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_SetPause::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_SetPause)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool paused = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_paused(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_SetPause)
+  return target;
+}
+
+size_t CSVCMsg_SetPause::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_SetPause)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bool paused = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_SetPause::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_SetPause::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_SetPause::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_SetPause::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_SetPause*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_SetPause&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_SetPause)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_paused()) {
+    _this->_internal_set_paused(from._internal_paused());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_SetPause::CopyFrom(const CSVCMsg_SetPause& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_SetPause)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_SetPause::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_SetPause::InternalSwap(CSVCMsg_SetPause* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.paused_, other->_impl_.paused_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_SetPause::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[13]);
+}
+
+// ===================================================================
+
+class CSVCMsg_VoiceInit::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_VoiceInit>()._impl_._has_bits_);
+  static void set_has_quality(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_codec(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CSVCMsg_VoiceInit::CSVCMsg_VoiceInit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_VoiceInit)
+}
+CSVCMsg_VoiceInit::CSVCMsg_VoiceInit(const CSVCMsg_VoiceInit& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_VoiceInit* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.codec_){}
+    , decltype(_impl_.quality_){}
+    , decltype(_impl_.version_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.codec_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.codec_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_codec()) {
+    _this->_impl_.codec_.Set(from._internal_codec(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.quality_, &from._impl_.quality_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.version_) -
+    reinterpret_cast<char*>(&_impl_.quality_)) + sizeof(_impl_.version_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_VoiceInit)
+}
+
+inline void CSVCMsg_VoiceInit::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.codec_){}
+    , decltype(_impl_.quality_){0}
+    , decltype(_impl_.version_){0}
+  };
+  _impl_.codec_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.codec_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_VoiceInit::~CSVCMsg_VoiceInit() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_VoiceInit)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_VoiceInit::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.codec_.Destroy();
+}
+
+void CSVCMsg_VoiceInit::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_VoiceInit::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_VoiceInit)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.codec_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.quality_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.version_) -
+        reinterpret_cast<char*>(&_impl_.quality_)) + sizeof(_impl_.version_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_VoiceInit::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 quality = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_quality(&has_bits);
+          _impl_.quality_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string codec = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_codec();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_VoiceInit.codec");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 version = 3 [default = 0];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_VoiceInit::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_VoiceInit)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 quality = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_quality(), target);
+  }
+
+  // optional string codec = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_codec().data(), static_cast<int>(this->_internal_codec().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_VoiceInit.codec");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_codec(), target);
+  }
+
+  // optional int32 version = 3 [default = 0];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_VoiceInit)
+  return target;
+}
+
+size_t CSVCMsg_VoiceInit::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_VoiceInit)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string codec = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_codec());
+    }
+
+    // optional int32 quality = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_quality());
+    }
+
+    // optional int32 version = 3 [default = 0];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_VoiceInit::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_VoiceInit::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_VoiceInit::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_VoiceInit::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_VoiceInit*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_VoiceInit&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_VoiceInit)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_codec(from._internal_codec());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.quality_ = from._impl_.quality_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_VoiceInit::CopyFrom(const CSVCMsg_VoiceInit& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_VoiceInit)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_VoiceInit::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_VoiceInit::InternalSwap(CSVCMsg_VoiceInit* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.codec_, lhs_arena,
+      &other->_impl_.codec_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_VoiceInit, _impl_.version_)
+      + sizeof(CSVCMsg_VoiceInit::_impl_.version_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_VoiceInit, _impl_.quality_)>(
+          reinterpret_cast<char*>(&_impl_.quality_),
+          reinterpret_cast<char*>(&other->_impl_.quality_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_VoiceInit::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[14]);
+}
+
+// ===================================================================
+
+class CSVCMsg_Print::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_Print>()._impl_._has_bits_);
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_Print::CSVCMsg_Print(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_Print)
+}
+CSVCMsg_Print::CSVCMsg_Print(const CSVCMsg_Print& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_Print* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_Print)
+}
+
+inline void CSVCMsg_Print::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_Print::~CSVCMsg_Print() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_Print)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_Print::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
+}
+
+void CSVCMsg_Print::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_Print::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_Print)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.text_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_Print::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string text = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_Print.text");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_Print::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_Print)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string text = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_Print.text");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_Print)
+  return target;
+}
+
+size_t CSVCMsg_Print::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_Print)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string text = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_Print::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_Print::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_Print::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_Print::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_Print*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_Print&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_Print)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_text()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_Print::CopyFrom(const CSVCMsg_Print& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_Print)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_Print::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_Print::InternalSwap(CSVCMsg_Print* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_Print::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[15]);
+}
+
+// ===================================================================
+
+class CSVCMsg_Sounds_sounddata_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_Sounds_sounddata_t>()._impl_._has_bits_);
+  static void set_has_origin_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_origin_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_origin_z(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_volume(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_delay_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_sequence_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_entity_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_pitch(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_flags(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_sound_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_sound_num_handle(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_speaker_entity(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_random_seed(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_sound_level(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_is_sentence(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_is_ambient(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+};
+
+CSVCMsg_Sounds_sounddata_t::CSVCMsg_Sounds_sounddata_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_Sounds.sounddata_t)
+}
+CSVCMsg_Sounds_sounddata_t::CSVCMsg_Sounds_sounddata_t(const CSVCMsg_Sounds_sounddata_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_Sounds_sounddata_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.origin_x_){}
+    , decltype(_impl_.origin_y_){}
+    , decltype(_impl_.origin_z_){}
+    , decltype(_impl_.volume_){}
+    , decltype(_impl_.delay_value_){}
+    , decltype(_impl_.sequence_number_){}
+    , decltype(_impl_.entity_index_){}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.pitch_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.sound_num_){}
+    , decltype(_impl_.sound_num_handle_){}
+    , decltype(_impl_.speaker_entity_){}
+    , decltype(_impl_.random_seed_){}
+    , decltype(_impl_.sound_level_){}
+    , decltype(_impl_.is_sentence_){}
+    , decltype(_impl_.is_ambient_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.origin_x_, &from._impl_.origin_x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_ambient_) -
+    reinterpret_cast<char*>(&_impl_.origin_x_)) + sizeof(_impl_.is_ambient_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_Sounds.sounddata_t)
+}
+
+inline void CSVCMsg_Sounds_sounddata_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.origin_x_){0}
+    , decltype(_impl_.origin_y_){0}
+    , decltype(_impl_.origin_z_){0}
+    , decltype(_impl_.volume_){0u}
+    , decltype(_impl_.delay_value_){0}
+    , decltype(_impl_.sequence_number_){0}
+    , decltype(_impl_.entity_index_){0}
+    , decltype(_impl_.channel_){0}
+    , decltype(_impl_.pitch_){0}
+    , decltype(_impl_.flags_){0}
+    , decltype(_impl_.sound_num_){0u}
+    , decltype(_impl_.sound_num_handle_){0u}
+    , decltype(_impl_.speaker_entity_){0}
+    , decltype(_impl_.random_seed_){0}
+    , decltype(_impl_.sound_level_){0}
+    , decltype(_impl_.is_sentence_){false}
+    , decltype(_impl_.is_ambient_){false}
+  };
+}
+
+CSVCMsg_Sounds_sounddata_t::~CSVCMsg_Sounds_sounddata_t() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_Sounds.sounddata_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_Sounds_sounddata_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CSVCMsg_Sounds_sounddata_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_Sounds_sounddata_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_Sounds.sounddata_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.origin_x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.channel_) -
+        reinterpret_cast<char*>(&_impl_.origin_x_)) + sizeof(_impl_.channel_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.pitch_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.is_sentence_) -
+        reinterpret_cast<char*>(&_impl_.pitch_)) + sizeof(_impl_.is_sentence_));
+  }
+  _impl_.is_ambient_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_Sounds_sounddata_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional sint32 origin_x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_origin_x(&has_bits);
+          _impl_.origin_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional sint32 origin_y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_origin_y(&has_bits);
+          _impl_.origin_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional sint32 origin_z = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_origin_z(&has_bits);
+          _impl_.origin_z_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 volume = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_volume(&has_bits);
+          _impl_.volume_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float delay_value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_delay_value(&has_bits);
+          _impl_.delay_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 sequence_number = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_sequence_number(&has_bits);
+          _impl_.sequence_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 entity_index = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_entity_index(&has_bits);
+          _impl_.entity_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 channel = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_channel(&has_bits);
+          _impl_.channel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 pitch = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_pitch(&has_bits);
+          _impl_.pitch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 flags = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_flags(&has_bits);
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sound_num = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_sound_num(&has_bits);
+          _impl_.sound_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 sound_num_handle = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 101)) {
+          _Internal::set_has_sound_num_handle(&has_bits);
+          _impl_.sound_num_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 speaker_entity = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_speaker_entity(&has_bits);
+          _impl_.speaker_entity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 random_seed = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_random_seed(&has_bits);
+          _impl_.random_seed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 sound_level = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_sound_level(&has_bits);
+          _impl_.sound_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_sentence = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_is_sentence(&has_bits);
+          _impl_.is_sentence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_ambient = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_is_ambient(&has_bits);
+          _impl_.is_ambient_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_Sounds_sounddata_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_Sounds.sounddata_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional sint32 origin_x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(1, this->_internal_origin_x(), target);
+  }
+
+  // optional sint32 origin_y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(2, this->_internal_origin_y(), target);
+  }
+
+  // optional sint32 origin_z = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(3, this->_internal_origin_z(), target);
+  }
+
+  // optional uint32 volume = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_volume(), target);
+  }
+
+  // optional float delay_value = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_delay_value(), target);
+  }
+
+  // optional int32 sequence_number = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_sequence_number(), target);
+  }
+
+  // optional int32 entity_index = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_entity_index(), target);
+  }
+
+  // optional int32 channel = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_channel(), target);
+  }
+
+  // optional int32 pitch = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_pitch(), target);
+  }
+
+  // optional int32 flags = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_flags(), target);
+  }
+
+  // optional uint32 sound_num = 11;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_sound_num(), target);
+  }
+
+  // optional fixed32 sound_num_handle = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(12, this->_internal_sound_num_handle(), target);
+  }
+
+  // optional int32 speaker_entity = 13;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(13, this->_internal_speaker_entity(), target);
+  }
+
+  // optional int32 random_seed = 14;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(14, this->_internal_random_seed(), target);
+  }
+
+  // optional int32 sound_level = 15;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_sound_level(), target);
+  }
+
+  // optional bool is_sentence = 16;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(16, this->_internal_is_sentence(), target);
+  }
+
+  // optional bool is_ambient = 17;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(17, this->_internal_is_ambient(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_Sounds.sounddata_t)
+  return target;
+}
+
+size_t CSVCMsg_Sounds_sounddata_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_Sounds.sounddata_t)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional sint32 origin_x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_origin_x());
+    }
+
+    // optional sint32 origin_y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_origin_y());
+    }
+
+    // optional sint32 origin_z = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_origin_z());
+    }
+
+    // optional uint32 volume = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_volume());
+    }
+
+    // optional float delay_value = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 sequence_number = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sequence_number());
+    }
+
+    // optional int32 entity_index = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entity_index());
+    }
+
+    // optional int32 channel = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_channel());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional int32 pitch = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_pitch());
+    }
+
+    // optional int32 flags = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_flags());
+    }
+
+    // optional uint32 sound_num = 11;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sound_num());
+    }
+
+    // optional fixed32 sound_num_handle = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 speaker_entity = 13;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_speaker_entity());
+    }
+
+    // optional int32 random_seed = 14;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_random_seed());
+    }
+
+    // optional int32 sound_level = 15;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sound_level());
+    }
+
+    // optional bool is_sentence = 16;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 2 + 1;
+    }
+
+  }
+  // optional bool is_ambient = 17;
+  if (cached_has_bits & 0x00010000u) {
+    total_size += 2 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_Sounds_sounddata_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_Sounds_sounddata_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_Sounds_sounddata_t::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_Sounds_sounddata_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_Sounds_sounddata_t*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_Sounds_sounddata_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_Sounds.sounddata_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.origin_x_ = from._impl_.origin_x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.origin_y_ = from._impl_.origin_y_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.origin_z_ = from._impl_.origin_z_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.volume_ = from._impl_.volume_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.delay_value_ = from._impl_.delay_value_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.sequence_number_ = from._impl_.sequence_number_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.entity_index_ = from._impl_.entity_index_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.channel_ = from._impl_.channel_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.pitch_ = from._impl_.pitch_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.flags_ = from._impl_.flags_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.sound_num_ = from._impl_.sound_num_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.sound_num_handle_ = from._impl_.sound_num_handle_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.speaker_entity_ = from._impl_.speaker_entity_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.random_seed_ = from._impl_.random_seed_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.sound_level_ = from._impl_.sound_level_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.is_sentence_ = from._impl_.is_sentence_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00010000u) {
+    _this->_internal_set_is_ambient(from._internal_is_ambient());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_Sounds_sounddata_t::CopyFrom(const CSVCMsg_Sounds_sounddata_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_Sounds.sounddata_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_Sounds_sounddata_t::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_Sounds_sounddata_t::InternalSwap(CSVCMsg_Sounds_sounddata_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_Sounds_sounddata_t, _impl_.is_ambient_)
+      + sizeof(CSVCMsg_Sounds_sounddata_t::_impl_.is_ambient_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_Sounds_sounddata_t, _impl_.origin_x_)>(
+          reinterpret_cast<char*>(&_impl_.origin_x_),
+          reinterpret_cast<char*>(&other->_impl_.origin_x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_Sounds_sounddata_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[16]);
+}
+
+// ===================================================================
+
+class CSVCMsg_Sounds::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_Sounds>()._impl_._has_bits_);
+  static void set_has_reliable_sound(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_Sounds::CSVCMsg_Sounds(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_Sounds)
+}
+CSVCMsg_Sounds::CSVCMsg_Sounds(const CSVCMsg_Sounds& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_Sounds* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sounds_){from._impl_.sounds_}
+    , decltype(_impl_.reliable_sound_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.reliable_sound_ = from._impl_.reliable_sound_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_Sounds)
+}
+
+inline void CSVCMsg_Sounds::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sounds_){arena}
+    , decltype(_impl_.reliable_sound_){false}
+  };
+}
+
+CSVCMsg_Sounds::~CSVCMsg_Sounds() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_Sounds)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_Sounds::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sounds_.~RepeatedPtrField();
+}
+
+void CSVCMsg_Sounds::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_Sounds::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_Sounds)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sounds_.Clear();
+  _impl_.reliable_sound_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_Sounds::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool reliable_sound = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_reliable_sound(&has_bits);
+          _impl_.reliable_sound_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CSVCMsg_Sounds.sounddata_t sounds = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_sounds(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_Sounds::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_Sounds)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool reliable_sound = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_reliable_sound(), target);
+  }
+
+  // repeated .CSVCMsg_Sounds.sounddata_t sounds = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sounds_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sounds(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_Sounds)
+  return target;
+}
+
+size_t CSVCMsg_Sounds::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_Sounds)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsg_Sounds.sounddata_t sounds = 2;
+  total_size += 1UL * this->_internal_sounds_size();
+  for (const auto& msg : this->_impl_.sounds_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional bool reliable_sound = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_Sounds::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_Sounds::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_Sounds::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_Sounds::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_Sounds*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_Sounds&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_Sounds)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.sounds_.MergeFrom(from._impl_.sounds_);
+  if (from._internal_has_reliable_sound()) {
+    _this->_internal_set_reliable_sound(from._internal_reliable_sound());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_Sounds::CopyFrom(const CSVCMsg_Sounds& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_Sounds)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_Sounds::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_Sounds::InternalSwap(CSVCMsg_Sounds* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.sounds_.InternalSwap(&other->_impl_.sounds_);
+  swap(_impl_.reliable_sound_, other->_impl_.reliable_sound_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_Sounds::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[17]);
+}
+
+// ===================================================================
+
+class CSVCMsg_Prefetch::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_Prefetch>()._impl_._has_bits_);
+  static void set_has_sound_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_Prefetch::CSVCMsg_Prefetch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_Prefetch)
+}
+CSVCMsg_Prefetch::CSVCMsg_Prefetch(const CSVCMsg_Prefetch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_Prefetch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sound_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.sound_index_ = from._impl_.sound_index_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_Prefetch)
+}
+
+inline void CSVCMsg_Prefetch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sound_index_){0}
+  };
+}
+
+CSVCMsg_Prefetch::~CSVCMsg_Prefetch() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_Prefetch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_Prefetch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CSVCMsg_Prefetch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_Prefetch::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_Prefetch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sound_index_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_Prefetch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 sound_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_sound_index(&has_bits);
+          _impl_.sound_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_Prefetch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_Prefetch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 sound_index = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_sound_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_Prefetch)
+  return target;
+}
+
+size_t CSVCMsg_Prefetch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_Prefetch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 sound_index = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sound_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_Prefetch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_Prefetch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_Prefetch::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_Prefetch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_Prefetch*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_Prefetch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_Prefetch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_sound_index()) {
+    _this->_internal_set_sound_index(from._internal_sound_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_Prefetch::CopyFrom(const CSVCMsg_Prefetch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_Prefetch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_Prefetch::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_Prefetch::InternalSwap(CSVCMsg_Prefetch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.sound_index_, other->_impl_.sound_index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_Prefetch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[18]);
+}
+
+// ===================================================================
+
+class CSVCMsg_SetView::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_SetView>()._impl_._has_bits_);
+  static void set_has_entity_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_SetView::CSVCMsg_SetView(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_SetView)
+}
+CSVCMsg_SetView::CSVCMsg_SetView(const CSVCMsg_SetView& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_SetView* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entity_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.entity_index_ = from._impl_.entity_index_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_SetView)
+}
+
+inline void CSVCMsg_SetView::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entity_index_){0}
+  };
+}
+
+CSVCMsg_SetView::~CSVCMsg_SetView() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_SetView)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_SetView::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CSVCMsg_SetView::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_SetView::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_SetView)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entity_index_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_SetView::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 entity_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_entity_index(&has_bits);
+          _impl_.entity_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_SetView::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_SetView)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 entity_index = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_entity_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_SetView)
+  return target;
+}
+
+size_t CSVCMsg_SetView::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_SetView)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 entity_index = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entity_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_SetView::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_SetView::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_SetView::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_SetView::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_SetView*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_SetView&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_SetView)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_entity_index()) {
+    _this->_internal_set_entity_index(from._internal_entity_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_SetView::CopyFrom(const CSVCMsg_SetView& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_SetView)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_SetView::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_SetView::InternalSwap(CSVCMsg_SetView* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.entity_index_, other->_impl_.entity_index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_SetView::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[19]);
+}
+
+// ===================================================================
+
+class CSVCMsg_FixAngle::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_FixAngle>()._impl_._has_bits_);
+  static void set_has_relative(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::CMsgQAngle& angle(const CSVCMsg_FixAngle* msg);
+  static void set_has_angle(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::CMsgQAngle&
+CSVCMsg_FixAngle::_Internal::angle(const CSVCMsg_FixAngle* msg) {
+  return *msg->_impl_.angle_;
+}
+void CSVCMsg_FixAngle::clear_angle() {
+  if (_impl_.angle_ != nullptr) _impl_.angle_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+CSVCMsg_FixAngle::CSVCMsg_FixAngle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_FixAngle)
+}
+CSVCMsg_FixAngle::CSVCMsg_FixAngle(const CSVCMsg_FixAngle& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_FixAngle* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.angle_){nullptr}
+    , decltype(_impl_.relative_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_angle()) {
+    _this->_impl_.angle_ = new ::CMsgQAngle(*from._impl_.angle_);
+  }
+  _this->_impl_.relative_ = from._impl_.relative_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_FixAngle)
+}
+
+inline void CSVCMsg_FixAngle::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.angle_){nullptr}
+    , decltype(_impl_.relative_){false}
+  };
+}
+
+CSVCMsg_FixAngle::~CSVCMsg_FixAngle() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_FixAngle)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_FixAngle::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.angle_;
+}
+
+void CSVCMsg_FixAngle::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_FixAngle::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_FixAngle)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.angle_ != nullptr);
+    _impl_.angle_->Clear();
+  }
+  _impl_.relative_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_FixAngle::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool relative = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_relative(&has_bits);
+          _impl_.relative_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CMsgQAngle angle = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_angle(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_FixAngle::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_FixAngle)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool relative = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_relative(), target);
+  }
+
+  // optional .CMsgQAngle angle = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::angle(this),
+        _Internal::angle(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_FixAngle)
+  return target;
+}
+
+size_t CSVCMsg_FixAngle::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_FixAngle)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .CMsgQAngle angle = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.angle_);
+    }
+
+    // optional bool relative = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_FixAngle::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_FixAngle::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_FixAngle::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_FixAngle::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_FixAngle*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_FixAngle&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_FixAngle)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_angle()->::CMsgQAngle::MergeFrom(
+          from._internal_angle());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.relative_ = from._impl_.relative_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_FixAngle::CopyFrom(const CSVCMsg_FixAngle& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_FixAngle)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_FixAngle::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_FixAngle::InternalSwap(CSVCMsg_FixAngle* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_FixAngle, _impl_.relative_)
+      + sizeof(CSVCMsg_FixAngle::_impl_.relative_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_FixAngle, _impl_.angle_)>(
+          reinterpret_cast<char*>(&_impl_.angle_),
+          reinterpret_cast<char*>(&other->_impl_.angle_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_FixAngle::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[20]);
+}
+
+// ===================================================================
+
+class CSVCMsg_CrosshairAngle::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_CrosshairAngle>()._impl_._has_bits_);
+  static const ::CMsgQAngle& angle(const CSVCMsg_CrosshairAngle* msg);
+  static void set_has_angle(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::CMsgQAngle&
+CSVCMsg_CrosshairAngle::_Internal::angle(const CSVCMsg_CrosshairAngle* msg) {
+  return *msg->_impl_.angle_;
+}
+void CSVCMsg_CrosshairAngle::clear_angle() {
+  if (_impl_.angle_ != nullptr) _impl_.angle_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+CSVCMsg_CrosshairAngle::CSVCMsg_CrosshairAngle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_CrosshairAngle)
+}
+CSVCMsg_CrosshairAngle::CSVCMsg_CrosshairAngle(const CSVCMsg_CrosshairAngle& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_CrosshairAngle* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.angle_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_angle()) {
+    _this->_impl_.angle_ = new ::CMsgQAngle(*from._impl_.angle_);
+  }
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_CrosshairAngle)
+}
+
+inline void CSVCMsg_CrosshairAngle::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.angle_){nullptr}
+  };
+}
+
+CSVCMsg_CrosshairAngle::~CSVCMsg_CrosshairAngle() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_CrosshairAngle)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_CrosshairAngle::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.angle_;
+}
+
+void CSVCMsg_CrosshairAngle::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_CrosshairAngle::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_CrosshairAngle)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.angle_ != nullptr);
+    _impl_.angle_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_CrosshairAngle::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .CMsgQAngle angle = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_angle(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_CrosshairAngle::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_CrosshairAngle)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .CMsgQAngle angle = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::angle(this),
+        _Internal::angle(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_CrosshairAngle)
+  return target;
+}
+
+size_t CSVCMsg_CrosshairAngle::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_CrosshairAngle)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .CMsgQAngle angle = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.angle_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_CrosshairAngle::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_CrosshairAngle::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_CrosshairAngle::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_CrosshairAngle::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_CrosshairAngle*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_CrosshairAngle&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_CrosshairAngle)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_angle()) {
+    _this->_internal_mutable_angle()->::CMsgQAngle::MergeFrom(
+        from._internal_angle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_CrosshairAngle::CopyFrom(const CSVCMsg_CrosshairAngle& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_CrosshairAngle)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_CrosshairAngle::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_CrosshairAngle::InternalSwap(CSVCMsg_CrosshairAngle* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.angle_, other->_impl_.angle_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_CrosshairAngle::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[21]);
+}
+
+// ===================================================================
+
+class CSVCMsg_BSPDecal::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_BSPDecal>()._impl_._has_bits_);
+  static const ::CMsgVector& pos(const CSVCMsg_BSPDecal* msg);
+  static void set_has_pos(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_decal_texture_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_entity_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_model_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_low_priority(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::CMsgVector&
+CSVCMsg_BSPDecal::_Internal::pos(const CSVCMsg_BSPDecal* msg) {
+  return *msg->_impl_.pos_;
+}
+void CSVCMsg_BSPDecal::clear_pos() {
+  if (_impl_.pos_ != nullptr) _impl_.pos_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+CSVCMsg_BSPDecal::CSVCMsg_BSPDecal(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_BSPDecal)
+}
+CSVCMsg_BSPDecal::CSVCMsg_BSPDecal(const CSVCMsg_BSPDecal& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_BSPDecal* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pos_){nullptr}
+    , decltype(_impl_.decal_texture_index_){}
+    , decltype(_impl_.entity_index_){}
+    , decltype(_impl_.model_index_){}
+    , decltype(_impl_.low_priority_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_pos()) {
+    _this->_impl_.pos_ = new ::CMsgVector(*from._impl_.pos_);
+  }
+  ::memcpy(&_impl_.decal_texture_index_, &from._impl_.decal_texture_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.low_priority_) -
+    reinterpret_cast<char*>(&_impl_.decal_texture_index_)) + sizeof(_impl_.low_priority_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_BSPDecal)
+}
+
+inline void CSVCMsg_BSPDecal::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.pos_){nullptr}
+    , decltype(_impl_.decal_texture_index_){0}
+    , decltype(_impl_.entity_index_){0}
+    , decltype(_impl_.model_index_){0}
+    , decltype(_impl_.low_priority_){false}
+  };
+}
+
+CSVCMsg_BSPDecal::~CSVCMsg_BSPDecal() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_BSPDecal)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_BSPDecal::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.pos_;
+}
+
+void CSVCMsg_BSPDecal::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_BSPDecal::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_BSPDecal)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.pos_ != nullptr);
+    _impl_.pos_->Clear();
+  }
+  if (cached_has_bits & 0x0000001eu) {
+    ::memset(&_impl_.decal_texture_index_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.low_priority_) -
+        reinterpret_cast<char*>(&_impl_.decal_texture_index_)) + sizeof(_impl_.low_priority_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_BSPDecal::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .CMsgVector pos = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pos(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 decal_texture_index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_decal_texture_index(&has_bits);
+          _impl_.decal_texture_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 entity_index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_entity_index(&has_bits);
+          _impl_.entity_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 model_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_model_index(&has_bits);
+          _impl_.model_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool low_priority = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_low_priority(&has_bits);
+          _impl_.low_priority_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_BSPDecal::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_BSPDecal)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .CMsgVector pos = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::pos(this),
+        _Internal::pos(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int32 decal_texture_index = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_decal_texture_index(), target);
+  }
+
+  // optional int32 entity_index = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_entity_index(), target);
+  }
+
+  // optional int32 model_index = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_model_index(), target);
+  }
+
+  // optional bool low_priority = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_low_priority(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_BSPDecal)
+  return target;
+}
+
+size_t CSVCMsg_BSPDecal::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_BSPDecal)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .CMsgVector pos = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pos_);
+    }
+
+    // optional int32 decal_texture_index = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_decal_texture_index());
+    }
+
+    // optional int32 entity_index = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entity_index());
+    }
+
+    // optional int32 model_index = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_model_index());
+    }
+
+    // optional bool low_priority = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_BSPDecal::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_BSPDecal::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_BSPDecal::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_BSPDecal::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_BSPDecal*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_BSPDecal&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_BSPDecal)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_pos()->::CMsgVector::MergeFrom(
+          from._internal_pos());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.decal_texture_index_ = from._impl_.decal_texture_index_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.entity_index_ = from._impl_.entity_index_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.model_index_ = from._impl_.model_index_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.low_priority_ = from._impl_.low_priority_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_BSPDecal::CopyFrom(const CSVCMsg_BSPDecal& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_BSPDecal)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_BSPDecal::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_BSPDecal::InternalSwap(CSVCMsg_BSPDecal* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_BSPDecal, _impl_.low_priority_)
+      + sizeof(CSVCMsg_BSPDecal::_impl_.low_priority_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_BSPDecal, _impl_.pos_)>(
+          reinterpret_cast<char*>(&_impl_.pos_),
+          reinterpret_cast<char*>(&other->_impl_.pos_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_BSPDecal::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[22]);
+}
+
+// ===================================================================
+
+class CSVCMsg_SplitScreen::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_SplitScreen>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_slot(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_player_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CSVCMsg_SplitScreen::CSVCMsg_SplitScreen(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_SplitScreen)
+}
+CSVCMsg_SplitScreen::CSVCMsg_SplitScreen(const CSVCMsg_SplitScreen& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_SplitScreen* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.slot_){}
+    , decltype(_impl_.player_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.player_index_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.player_index_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_SplitScreen)
+}
+
+inline void CSVCMsg_SplitScreen::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.slot_){0}
+    , decltype(_impl_.player_index_){0}
+  };
+}
+
+CSVCMsg_SplitScreen::~CSVCMsg_SplitScreen() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_SplitScreen)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_SplitScreen::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CSVCMsg_SplitScreen::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_SplitScreen::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_SplitScreen)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.player_index_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.player_index_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_SplitScreen::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .ESplitScreenMessageType type = 1 [default = MSG_SPLITSCREEN_ADDUSER];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ESplitScreenMessageType_IsValid(val))) {
+            _internal_set_type(static_cast<::ESplitScreenMessageType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 slot = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_slot(&has_bits);
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 player_index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_player_index(&has_bits);
+          _impl_.player_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_SplitScreen::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_SplitScreen)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .ESplitScreenMessageType type = 1 [default = MSG_SPLITSCREEN_ADDUSER];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional int32 slot = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_slot(), target);
+  }
+
+  // optional int32 player_index = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_player_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_SplitScreen)
+  return target;
+}
+
+size_t CSVCMsg_SplitScreen::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_SplitScreen)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .ESplitScreenMessageType type = 1 [default = MSG_SPLITSCREEN_ADDUSER];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+    }
+
+    // optional int32 slot = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_slot());
+    }
+
+    // optional int32 player_index = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_player_index());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_SplitScreen::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_SplitScreen::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_SplitScreen::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_SplitScreen::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_SplitScreen*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_SplitScreen&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_SplitScreen)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.slot_ = from._impl_.slot_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.player_index_ = from._impl_.player_index_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_SplitScreen::CopyFrom(const CSVCMsg_SplitScreen& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_SplitScreen)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_SplitScreen::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_SplitScreen::InternalSwap(CSVCMsg_SplitScreen* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_SplitScreen, _impl_.player_index_)
+      + sizeof(CSVCMsg_SplitScreen::_impl_.player_index_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_SplitScreen, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_SplitScreen::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[23]);
+}
+
+// ===================================================================
+
+class CSVCMsg_GetCvarValue::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_GetCvarValue>()._impl_._has_bits_);
+  static void set_has_cookie(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_cvar_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_GetCvarValue::CSVCMsg_GetCvarValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_GetCvarValue)
+}
+CSVCMsg_GetCvarValue::CSVCMsg_GetCvarValue(const CSVCMsg_GetCvarValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_GetCvarValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cvar_name_){}
+    , decltype(_impl_.cookie_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.cvar_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cvar_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cvar_name()) {
+    _this->_impl_.cvar_name_.Set(from._internal_cvar_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.cookie_ = from._impl_.cookie_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_GetCvarValue)
+}
+
+inline void CSVCMsg_GetCvarValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cvar_name_){}
+    , decltype(_impl_.cookie_){0}
+  };
+  _impl_.cvar_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cvar_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_GetCvarValue::~CSVCMsg_GetCvarValue() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_GetCvarValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_GetCvarValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cvar_name_.Destroy();
+}
+
+void CSVCMsg_GetCvarValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_GetCvarValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_GetCvarValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.cvar_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.cookie_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_GetCvarValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 cookie = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_cookie(&has_bits);
+          _impl_.cookie_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string cvar_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cvar_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_GetCvarValue.cvar_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_GetCvarValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_GetCvarValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 cookie = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_cookie(), target);
+  }
+
+  // optional string cvar_name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_cvar_name().data(), static_cast<int>(this->_internal_cvar_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_GetCvarValue.cvar_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cvar_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_GetCvarValue)
+  return target;
+}
+
+size_t CSVCMsg_GetCvarValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_GetCvarValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string cvar_name = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_cvar_name());
+    }
+
+    // optional int32 cookie = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_cookie());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_GetCvarValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_GetCvarValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_GetCvarValue::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_GetCvarValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_GetCvarValue*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_GetCvarValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_GetCvarValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_cvar_name(from._internal_cvar_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.cookie_ = from._impl_.cookie_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_GetCvarValue::CopyFrom(const CSVCMsg_GetCvarValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_GetCvarValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_GetCvarValue::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_GetCvarValue::InternalSwap(CSVCMsg_GetCvarValue* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cvar_name_, lhs_arena,
+      &other->_impl_.cvar_name_, rhs_arena
+  );
+  swap(_impl_.cookie_, other->_impl_.cookie_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_GetCvarValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[24]);
+}
+
+// ===================================================================
+
+class CSVCMsg_Menu::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_Menu>()._impl_._has_bits_);
+  static void set_has_dialog_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_menu_key_values(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_Menu::CSVCMsg_Menu(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_Menu)
+}
+CSVCMsg_Menu::CSVCMsg_Menu(const CSVCMsg_Menu& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_Menu* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.menu_key_values_){}
+    , decltype(_impl_.dialog_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.menu_key_values_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.menu_key_values_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_menu_key_values()) {
+    _this->_impl_.menu_key_values_.Set(from._internal_menu_key_values(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.dialog_type_ = from._impl_.dialog_type_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_Menu)
+}
+
+inline void CSVCMsg_Menu::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.menu_key_values_){}
+    , decltype(_impl_.dialog_type_){0}
+  };
+  _impl_.menu_key_values_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.menu_key_values_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_Menu::~CSVCMsg_Menu() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_Menu)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_Menu::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.menu_key_values_.Destroy();
+}
+
+void CSVCMsg_Menu::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_Menu::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_Menu)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.menu_key_values_.ClearNonDefaultToEmpty();
+  }
+  _impl_.dialog_type_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_Menu::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 dialog_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_dialog_type(&has_bits);
+          _impl_.dialog_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes menu_key_values = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_menu_key_values();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_Menu::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_Menu)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 dialog_type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_dialog_type(), target);
+  }
+
+  // optional bytes menu_key_values = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_menu_key_values(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_Menu)
+  return target;
+}
+
+size_t CSVCMsg_Menu::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_Menu)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes menu_key_values = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_menu_key_values());
+    }
+
+    // optional int32 dialog_type = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_dialog_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_Menu::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_Menu::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_Menu::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_Menu::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_Menu*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_Menu&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_Menu)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_menu_key_values(from._internal_menu_key_values());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.dialog_type_ = from._impl_.dialog_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_Menu::CopyFrom(const CSVCMsg_Menu& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_Menu)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_Menu::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_Menu::InternalSwap(CSVCMsg_Menu* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.menu_key_values_, lhs_arena,
+      &other->_impl_.menu_key_values_, rhs_arena
+  );
+  swap(_impl_.dialog_type_, other->_impl_.dialog_type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_Menu::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[25]);
+}
+
+// ===================================================================
+
+class CSVCMsg_SendTable_sendprop_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_SendTable_sendprop_t>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_var_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_flags(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_priority(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_dt_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_elements(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_low_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_high_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_num_bits(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+};
+
+CSVCMsg_SendTable_sendprop_t::CSVCMsg_SendTable_sendprop_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_SendTable.sendprop_t)
+}
+CSVCMsg_SendTable_sendprop_t::CSVCMsg_SendTable_sendprop_t(const CSVCMsg_SendTable_sendprop_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_SendTable_sendprop_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.var_name_){}
+    , decltype(_impl_.dt_name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.num_elements_){}
+    , decltype(_impl_.low_value_){}
+    , decltype(_impl_.high_value_){}
+    , decltype(_impl_.num_bits_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.var_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_var_name()) {
+    _this->_impl_.var_name_.Set(from._internal_var_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.dt_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dt_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_dt_name()) {
+    _this->_impl_.dt_name_.Set(from._internal_dt_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_bits_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.num_bits_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_SendTable.sendprop_t)
+}
+
+inline void CSVCMsg_SendTable_sendprop_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.var_name_){}
+    , decltype(_impl_.dt_name_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.flags_){0}
+    , decltype(_impl_.priority_){0}
+    , decltype(_impl_.num_elements_){0}
+    , decltype(_impl_.low_value_){0}
+    , decltype(_impl_.high_value_){0}
+    , decltype(_impl_.num_bits_){0}
+  };
+  _impl_.var_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.dt_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dt_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_SendTable_sendprop_t::~CSVCMsg_SendTable_sendprop_t() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_SendTable.sendprop_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_SendTable_sendprop_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.var_name_.Destroy();
+  _impl_.dt_name_.Destroy();
+}
+
+void CSVCMsg_SendTable_sendprop_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_SendTable_sendprop_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_SendTable.sendprop_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.var_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.dt_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.high_value_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.high_value_));
+  }
+  _impl_.num_bits_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_SendTable_sendprop_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string var_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_var_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_SendTable.sendprop_t.var_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 flags = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_flags(&has_bits);
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 priority = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_priority(&has_bits);
+          _impl_.priority_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string dt_name = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_dt_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_SendTable.sendprop_t.dt_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_elements = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_num_elements(&has_bits);
+          _impl_.num_elements_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float low_value = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_low_value(&has_bits);
+          _impl_.low_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float high_value = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_high_value(&has_bits);
+          _impl_.high_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_bits = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_num_bits(&has_bits);
+          _impl_.num_bits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_SendTable_sendprop_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_SendTable.sendprop_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 type = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_type(), target);
+  }
+
+  // optional string var_name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_var_name().data(), static_cast<int>(this->_internal_var_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_SendTable.sendprop_t.var_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_var_name(), target);
+  }
+
+  // optional int32 flags = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_flags(), target);
+  }
+
+  // optional int32 priority = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_priority(), target);
+  }
+
+  // optional string dt_name = 5;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_dt_name().data(), static_cast<int>(this->_internal_dt_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_SendTable.sendprop_t.dt_name");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_dt_name(), target);
+  }
+
+  // optional int32 num_elements = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_num_elements(), target);
+  }
+
+  // optional float low_value = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_low_value(), target);
+  }
+
+  // optional float high_value = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_high_value(), target);
+  }
+
+  // optional int32 num_bits = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_num_bits(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_SendTable.sendprop_t)
+  return target;
+}
+
+size_t CSVCMsg_SendTable_sendprop_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_SendTable.sendprop_t)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string var_name = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_var_name());
+    }
+
+    // optional string dt_name = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_dt_name());
+    }
+
+    // optional int32 type = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+    }
+
+    // optional int32 flags = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_flags());
+    }
+
+    // optional int32 priority = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_priority());
+    }
+
+    // optional int32 num_elements = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_elements());
+    }
+
+    // optional float low_value = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float high_value = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  // optional int32 num_bits = 9;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_bits());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_SendTable_sendprop_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_SendTable_sendprop_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_SendTable_sendprop_t::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_SendTable_sendprop_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_SendTable_sendprop_t*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_SendTable_sendprop_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_SendTable.sendprop_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_var_name(from._internal_var_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_dt_name(from._internal_dt_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.flags_ = from._impl_.flags_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.priority_ = from._impl_.priority_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.num_elements_ = from._impl_.num_elements_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.low_value_ = from._impl_.low_value_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.high_value_ = from._impl_.high_value_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_num_bits(from._internal_num_bits());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_SendTable_sendprop_t::CopyFrom(const CSVCMsg_SendTable_sendprop_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_SendTable.sendprop_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_SendTable_sendprop_t::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_SendTable_sendprop_t::InternalSwap(CSVCMsg_SendTable_sendprop_t* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.var_name_, lhs_arena,
+      &other->_impl_.var_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.dt_name_, lhs_arena,
+      &other->_impl_.dt_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_SendTable_sendprop_t, _impl_.num_bits_)
+      + sizeof(CSVCMsg_SendTable_sendprop_t::_impl_.num_bits_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_SendTable_sendprop_t, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_SendTable_sendprop_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[26]);
+}
+
+// ===================================================================
+
+class CSVCMsg_SendTable::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_SendTable>()._impl_._has_bits_);
+  static void set_has_is_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_net_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_needs_decoder(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CSVCMsg_SendTable::CSVCMsg_SendTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_SendTable)
+}
+CSVCMsg_SendTable::CSVCMsg_SendTable(const CSVCMsg_SendTable& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_SendTable* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.props_){from._impl_.props_}
+    , decltype(_impl_.net_table_name_){}
+    , decltype(_impl_.is_end_){}
+    , decltype(_impl_.needs_decoder_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.net_table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.net_table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_net_table_name()) {
+    _this->_impl_.net_table_name_.Set(from._internal_net_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.is_end_, &from._impl_.is_end_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.needs_decoder_) -
+    reinterpret_cast<char*>(&_impl_.is_end_)) + sizeof(_impl_.needs_decoder_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_SendTable)
+}
+
+inline void CSVCMsg_SendTable::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.props_){arena}
+    , decltype(_impl_.net_table_name_){}
+    , decltype(_impl_.is_end_){false}
+    , decltype(_impl_.needs_decoder_){false}
+  };
+  _impl_.net_table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.net_table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_SendTable::~CSVCMsg_SendTable() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_SendTable)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_SendTable::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.props_.~RepeatedPtrField();
+  _impl_.net_table_name_.Destroy();
+}
+
+void CSVCMsg_SendTable::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_SendTable::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_SendTable)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.props_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.net_table_name_.ClearNonDefaultToEmpty();
+  }
+  ::memset(&_impl_.is_end_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.needs_decoder_) -
+      reinterpret_cast<char*>(&_impl_.is_end_)) + sizeof(_impl_.needs_decoder_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_SendTable::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool is_end = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_is_end(&has_bits);
+          _impl_.is_end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string net_table_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_net_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_SendTable.net_table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool needs_decoder = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_needs_decoder(&has_bits);
+          _impl_.needs_decoder_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CSVCMsg_SendTable.sendprop_t props = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_props(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_SendTable::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_SendTable)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool is_end = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_is_end(), target);
+  }
+
+  // optional string net_table_name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_net_table_name().data(), static_cast<int>(this->_internal_net_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_SendTable.net_table_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_net_table_name(), target);
+  }
+
+  // optional bool needs_decoder = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_needs_decoder(), target);
+  }
+
+  // repeated .CSVCMsg_SendTable.sendprop_t props = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_props_size()); i < n; i++) {
+    const auto& repfield = this->_internal_props(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_SendTable)
+  return target;
+}
+
+size_t CSVCMsg_SendTable::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_SendTable)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsg_SendTable.sendprop_t props = 4;
+  total_size += 1UL * this->_internal_props_size();
+  for (const auto& msg : this->_impl_.props_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string net_table_name = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_net_table_name());
+    }
+
+    // optional bool is_end = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool needs_decoder = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_SendTable::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_SendTable::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_SendTable::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_SendTable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_SendTable*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_SendTable&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_SendTable)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.props_.MergeFrom(from._impl_.props_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_net_table_name(from._internal_net_table_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.is_end_ = from._impl_.is_end_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.needs_decoder_ = from._impl_.needs_decoder_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_SendTable::CopyFrom(const CSVCMsg_SendTable& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_SendTable)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_SendTable::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_SendTable::InternalSwap(CSVCMsg_SendTable* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.props_.InternalSwap(&other->_impl_.props_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.net_table_name_, lhs_arena,
+      &other->_impl_.net_table_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_SendTable, _impl_.needs_decoder_)
+      + sizeof(CSVCMsg_SendTable::_impl_.needs_decoder_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_SendTable, _impl_.is_end_)>(
+          reinterpret_cast<char*>(&_impl_.is_end_),
+          reinterpret_cast<char*>(&other->_impl_.is_end_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_SendTable::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[27]);
+}
+
+// ===================================================================
+
+class CSVCMsg_GameEventList_key_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_GameEventList_key_t>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_GameEventList_key_t::CSVCMsg_GameEventList_key_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_GameEventList.key_t)
+}
+CSVCMsg_GameEventList_key_t::CSVCMsg_GameEventList_key_t(const CSVCMsg_GameEventList_key_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_GameEventList_key_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_GameEventList.key_t)
+}
+
+inline void CSVCMsg_GameEventList_key_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_GameEventList_key_t::~CSVCMsg_GameEventList_key_t() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_GameEventList.key_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_GameEventList_key_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void CSVCMsg_GameEventList_key_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_GameEventList_key_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_GameEventList.key_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.type_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_GameEventList_key_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_GameEventList.key_t.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_GameEventList_key_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_GameEventList.key_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_type(), target);
+  }
+
+  // optional string name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_GameEventList.key_t.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_GameEventList.key_t)
+  return target;
+}
+
+size_t CSVCMsg_GameEventList_key_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_GameEventList.key_t)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional int32 type = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_GameEventList_key_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_GameEventList_key_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_GameEventList_key_t::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_GameEventList_key_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_GameEventList_key_t*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_GameEventList_key_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_GameEventList.key_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_GameEventList_key_t::CopyFrom(const CSVCMsg_GameEventList_key_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_GameEventList.key_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_GameEventList_key_t::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_GameEventList_key_t::InternalSwap(CSVCMsg_GameEventList_key_t* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_GameEventList_key_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[28]);
+}
+
+// ===================================================================
+
+class CSVCMsg_GameEventList_descriptor_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_GameEventList_descriptor_t>()._impl_._has_bits_);
+  static void set_has_eventid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_GameEventList_descriptor_t::CSVCMsg_GameEventList_descriptor_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_GameEventList.descriptor_t)
+}
+CSVCMsg_GameEventList_descriptor_t::CSVCMsg_GameEventList_descriptor_t(const CSVCMsg_GameEventList_descriptor_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_GameEventList_descriptor_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.eventid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.eventid_ = from._impl_.eventid_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_GameEventList.descriptor_t)
+}
+
+inline void CSVCMsg_GameEventList_descriptor_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.eventid_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_GameEventList_descriptor_t::~CSVCMsg_GameEventList_descriptor_t() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_GameEventList.descriptor_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_GameEventList_descriptor_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void CSVCMsg_GameEventList_descriptor_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_GameEventList_descriptor_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_GameEventList.descriptor_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.eventid_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_GameEventList_descriptor_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 eventid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_eventid(&has_bits);
+          _impl_.eventid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_GameEventList.descriptor_t.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CSVCMsg_GameEventList.key_t keys = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_keys(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_GameEventList_descriptor_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_GameEventList.descriptor_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 eventid = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_eventid(), target);
+  }
+
+  // optional string name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_GameEventList.descriptor_t.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  // repeated .CSVCMsg_GameEventList.key_t keys = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_keys_size()); i < n; i++) {
+    const auto& repfield = this->_internal_keys(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_GameEventList.descriptor_t)
+  return target;
+}
+
+size_t CSVCMsg_GameEventList_descriptor_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_GameEventList.descriptor_t)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsg_GameEventList.key_t keys = 3;
+  total_size += 1UL * this->_internal_keys_size();
+  for (const auto& msg : this->_impl_.keys_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional int32 eventid = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_eventid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_GameEventList_descriptor_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_GameEventList_descriptor_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_GameEventList_descriptor_t::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_GameEventList_descriptor_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_GameEventList_descriptor_t*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_GameEventList_descriptor_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_GameEventList.descriptor_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.eventid_ = from._impl_.eventid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_GameEventList_descriptor_t::CopyFrom(const CSVCMsg_GameEventList_descriptor_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_GameEventList.descriptor_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_GameEventList_descriptor_t::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_GameEventList_descriptor_t::InternalSwap(CSVCMsg_GameEventList_descriptor_t* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.eventid_, other->_impl_.eventid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_GameEventList_descriptor_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[29]);
+}
+
+// ===================================================================
+
+class CSVCMsg_GameEventList::_Internal {
+ public:
+};
+
+CSVCMsg_GameEventList::CSVCMsg_GameEventList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_GameEventList)
+}
+CSVCMsg_GameEventList::CSVCMsg_GameEventList(const CSVCMsg_GameEventList& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_GameEventList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.descriptors_){from._impl_.descriptors_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_GameEventList)
+}
+
+inline void CSVCMsg_GameEventList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.descriptors_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CSVCMsg_GameEventList::~CSVCMsg_GameEventList() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_GameEventList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_GameEventList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.descriptors_.~RepeatedPtrField();
+}
+
+void CSVCMsg_GameEventList::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_GameEventList::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_GameEventList)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.descriptors_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_GameEventList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CSVCMsg_GameEventList.descriptor_t descriptors = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_descriptors(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_GameEventList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_GameEventList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsg_GameEventList.descriptor_t descriptors = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_descriptors_size()); i < n; i++) {
+    const auto& repfield = this->_internal_descriptors(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_GameEventList)
+  return target;
+}
+
+size_t CSVCMsg_GameEventList::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_GameEventList)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsg_GameEventList.descriptor_t descriptors = 1;
+  total_size += 1UL * this->_internal_descriptors_size();
+  for (const auto& msg : this->_impl_.descriptors_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_GameEventList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_GameEventList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_GameEventList::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_GameEventList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_GameEventList*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_GameEventList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_GameEventList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.descriptors_.MergeFrom(from._impl_.descriptors_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_GameEventList::CopyFrom(const CSVCMsg_GameEventList& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_GameEventList)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_GameEventList::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_GameEventList::InternalSwap(CSVCMsg_GameEventList* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.descriptors_.InternalSwap(&other->_impl_.descriptors_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_GameEventList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[30]);
+}
+
+// ===================================================================
+
+class CSVCMsg_PacketEntities::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_PacketEntities>()._impl_._has_bits_);
+  static void set_has_max_entries(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_updated_entries(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_is_delta(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_update_baseline(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_baseline(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_delta_from(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_entity_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_pending_full_frame(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+CSVCMsg_PacketEntities::CSVCMsg_PacketEntities(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_PacketEntities)
+}
+CSVCMsg_PacketEntities::CSVCMsg_PacketEntities(const CSVCMsg_PacketEntities& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_PacketEntities* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entity_data_){}
+    , decltype(_impl_.max_entries_){}
+    , decltype(_impl_.updated_entries_){}
+    , decltype(_impl_.baseline_){}
+    , decltype(_impl_.is_delta_){}
+    , decltype(_impl_.update_baseline_){}
+    , decltype(_impl_.pending_full_frame_){}
+    , decltype(_impl_.delta_from_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.entity_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entity_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_entity_data()) {
+    _this->_impl_.entity_data_.Set(from._internal_entity_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.max_entries_, &from._impl_.max_entries_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.delta_from_) -
+    reinterpret_cast<char*>(&_impl_.max_entries_)) + sizeof(_impl_.delta_from_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_PacketEntities)
+}
+
+inline void CSVCMsg_PacketEntities::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entity_data_){}
+    , decltype(_impl_.max_entries_){0}
+    , decltype(_impl_.updated_entries_){0}
+    , decltype(_impl_.baseline_){0}
+    , decltype(_impl_.is_delta_){false}
+    , decltype(_impl_.update_baseline_){false}
+    , decltype(_impl_.pending_full_frame_){false}
+    , decltype(_impl_.delta_from_){0}
+  };
+  _impl_.entity_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entity_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_PacketEntities::~CSVCMsg_PacketEntities() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_PacketEntities)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_PacketEntities::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entity_data_.Destroy();
+}
+
+void CSVCMsg_PacketEntities::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_PacketEntities::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_PacketEntities)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.entity_data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.max_entries_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.delta_from_) -
+        reinterpret_cast<char*>(&_impl_.max_entries_)) + sizeof(_impl_.delta_from_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_PacketEntities::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 max_entries = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_max_entries(&has_bits);
+          _impl_.max_entries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 updated_entries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_updated_entries(&has_bits);
+          _impl_.updated_entries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_delta = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_is_delta(&has_bits);
+          _impl_.is_delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool update_baseline = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_update_baseline(&has_bits);
+          _impl_.update_baseline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 baseline = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_baseline(&has_bits);
+          _impl_.baseline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 delta_from = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_delta_from(&has_bits);
+          _impl_.delta_from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes entity_data = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_entity_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool pending_full_frame = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_pending_full_frame(&has_bits);
+          _impl_.pending_full_frame_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_PacketEntities::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_PacketEntities)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 max_entries = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_max_entries(), target);
+  }
+
+  // optional int32 updated_entries = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_updated_entries(), target);
+  }
+
+  // optional bool is_delta = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_delta(), target);
+  }
+
+  // optional bool update_baseline = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_update_baseline(), target);
+  }
+
+  // optional int32 baseline = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_baseline(), target);
+  }
+
+  // optional int32 delta_from = 6;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_delta_from(), target);
+  }
+
+  // optional bytes entity_data = 7;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_entity_data(), target);
+  }
+
+  // optional bool pending_full_frame = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_pending_full_frame(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_PacketEntities)
+  return target;
+}
+
+size_t CSVCMsg_PacketEntities::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_PacketEntities)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional bytes entity_data = 7;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_entity_data());
+    }
+
+    // optional int32 max_entries = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_entries());
+    }
+
+    // optional int32 updated_entries = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_updated_entries());
+    }
+
+    // optional int32 baseline = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_baseline());
+    }
+
+    // optional bool is_delta = 3;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool update_baseline = 4;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool pending_full_frame = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 delta_from = 6;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_delta_from());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_PacketEntities::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_PacketEntities::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_PacketEntities::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_PacketEntities::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_PacketEntities*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_PacketEntities&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_PacketEntities)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_entity_data(from._internal_entity_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.max_entries_ = from._impl_.max_entries_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.updated_entries_ = from._impl_.updated_entries_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.baseline_ = from._impl_.baseline_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.is_delta_ = from._impl_.is_delta_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.update_baseline_ = from._impl_.update_baseline_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.pending_full_frame_ = from._impl_.pending_full_frame_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.delta_from_ = from._impl_.delta_from_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_PacketEntities::CopyFrom(const CSVCMsg_PacketEntities& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_PacketEntities)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_PacketEntities::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_PacketEntities::InternalSwap(CSVCMsg_PacketEntities* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.entity_data_, lhs_arena,
+      &other->_impl_.entity_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_PacketEntities, _impl_.delta_from_)
+      + sizeof(CSVCMsg_PacketEntities::_impl_.delta_from_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_PacketEntities, _impl_.max_entries_)>(
+          reinterpret_cast<char*>(&_impl_.max_entries_),
+          reinterpret_cast<char*>(&other->_impl_.max_entries_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_PacketEntities::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[31]);
+}
+
+// ===================================================================
+
+class CSVCMsg_TempEntities::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_TempEntities>()._impl_._has_bits_);
+  static void set_has_reliable(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_entries(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_entity_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_TempEntities::CSVCMsg_TempEntities(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_TempEntities)
+}
+CSVCMsg_TempEntities::CSVCMsg_TempEntities(const CSVCMsg_TempEntities& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_TempEntities* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entity_data_){}
+    , decltype(_impl_.reliable_){}
+    , decltype(_impl_.num_entries_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.entity_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entity_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_entity_data()) {
+    _this->_impl_.entity_data_.Set(from._internal_entity_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.reliable_, &from._impl_.reliable_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_entries_) -
+    reinterpret_cast<char*>(&_impl_.reliable_)) + sizeof(_impl_.num_entries_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_TempEntities)
+}
+
+inline void CSVCMsg_TempEntities::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entity_data_){}
+    , decltype(_impl_.reliable_){false}
+    , decltype(_impl_.num_entries_){0}
+  };
+  _impl_.entity_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entity_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_TempEntities::~CSVCMsg_TempEntities() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_TempEntities)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_TempEntities::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entity_data_.Destroy();
+}
+
+void CSVCMsg_TempEntities::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_TempEntities::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_TempEntities)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.entity_data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.reliable_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_entries_) -
+        reinterpret_cast<char*>(&_impl_.reliable_)) + sizeof(_impl_.num_entries_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_TempEntities::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool reliable = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_reliable(&has_bits);
+          _impl_.reliable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_entries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_entries(&has_bits);
+          _impl_.num_entries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes entity_data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_entity_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_TempEntities::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_TempEntities)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool reliable = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_reliable(), target);
+  }
+
+  // optional int32 num_entries = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_num_entries(), target);
+  }
+
+  // optional bytes entity_data = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_entity_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_TempEntities)
+  return target;
+}
+
+size_t CSVCMsg_TempEntities::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_TempEntities)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bytes entity_data = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_entity_data());
+    }
+
+    // optional bool reliable = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 num_entries = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_entries());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_TempEntities::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_TempEntities::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_TempEntities::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_TempEntities::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_TempEntities*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_TempEntities&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_TempEntities)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_entity_data(from._internal_entity_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.reliable_ = from._impl_.reliable_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_entries_ = from._impl_.num_entries_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_TempEntities::CopyFrom(const CSVCMsg_TempEntities& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_TempEntities)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_TempEntities::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_TempEntities::InternalSwap(CSVCMsg_TempEntities* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.entity_data_, lhs_arena,
+      &other->_impl_.entity_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_TempEntities, _impl_.num_entries_)
+      + sizeof(CSVCMsg_TempEntities::_impl_.num_entries_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_TempEntities, _impl_.reliable_)>(
+          reinterpret_cast<char*>(&_impl_.reliable_),
+          reinterpret_cast<char*>(&other->_impl_.reliable_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_TempEntities::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[32]);
+}
+
+// ===================================================================
+
+class CSVCMsg_CreateStringTable::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_CreateStringTable>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max_entries(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_num_entries(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_user_data_fixed_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_user_data_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_user_data_size_bits(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_flags(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_string_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CSVCMsg_CreateStringTable::CSVCMsg_CreateStringTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_CreateStringTable)
+}
+CSVCMsg_CreateStringTable::CSVCMsg_CreateStringTable(const CSVCMsg_CreateStringTable& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_CreateStringTable* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.string_data_){}
+    , decltype(_impl_.max_entries_){}
+    , decltype(_impl_.num_entries_){}
+    , decltype(_impl_.user_data_fixed_size_){}
+    , decltype(_impl_.user_data_size_){}
+    , decltype(_impl_.user_data_size_bits_){}
+    , decltype(_impl_.flags_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.string_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.string_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_string_data()) {
+    _this->_impl_.string_data_.Set(from._internal_string_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.max_entries_, &from._impl_.max_entries_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.flags_) -
+    reinterpret_cast<char*>(&_impl_.max_entries_)) + sizeof(_impl_.flags_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_CreateStringTable)
+}
+
+inline void CSVCMsg_CreateStringTable::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.string_data_){}
+    , decltype(_impl_.max_entries_){0}
+    , decltype(_impl_.num_entries_){0}
+    , decltype(_impl_.user_data_fixed_size_){false}
+    , decltype(_impl_.user_data_size_){0}
+    , decltype(_impl_.user_data_size_bits_){0}
+    , decltype(_impl_.flags_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.string_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.string_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_CreateStringTable::~CSVCMsg_CreateStringTable() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_CreateStringTable)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_CreateStringTable::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.string_data_.Destroy();
+}
+
+void CSVCMsg_CreateStringTable::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_CreateStringTable::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_CreateStringTable)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.string_data_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.max_entries_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.flags_) -
+        reinterpret_cast<char*>(&_impl_.max_entries_)) + sizeof(_impl_.flags_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_CreateStringTable::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_CreateStringTable.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 max_entries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_max_entries(&has_bits);
+          _impl_.max_entries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_entries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_num_entries(&has_bits);
+          _impl_.num_entries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool user_data_fixed_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_user_data_fixed_size(&has_bits);
+          _impl_.user_data_fixed_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 user_data_size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_user_data_size(&has_bits);
+          _impl_.user_data_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 user_data_size_bits = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_user_data_size_bits(&has_bits);
+          _impl_.user_data_size_bits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 flags = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_flags(&has_bits);
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes string_data = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_string_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_CreateStringTable::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_CreateStringTable)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_CreateStringTable.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional int32 max_entries = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_entries(), target);
+  }
+
+  // optional int32 num_entries = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_num_entries(), target);
+  }
+
+  // optional bool user_data_fixed_size = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_user_data_fixed_size(), target);
+  }
+
+  // optional int32 user_data_size = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_user_data_size(), target);
+  }
+
+  // optional int32 user_data_size_bits = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_user_data_size_bits(), target);
+  }
+
+  // optional int32 flags = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_flags(), target);
+  }
+
+  // optional bytes string_data = 8;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_string_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_CreateStringTable)
+  return target;
+}
+
+size_t CSVCMsg_CreateStringTable::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_CreateStringTable)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional bytes string_data = 8;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_string_data());
+    }
+
+    // optional int32 max_entries = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_entries());
+    }
+
+    // optional int32 num_entries = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_entries());
+    }
+
+    // optional bool user_data_fixed_size = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 user_data_size = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_user_data_size());
+    }
+
+    // optional int32 user_data_size_bits = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_user_data_size_bits());
+    }
+
+    // optional int32 flags = 7;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_flags());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_CreateStringTable::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_CreateStringTable::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_CreateStringTable::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_CreateStringTable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_CreateStringTable*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_CreateStringTable&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_CreateStringTable)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_string_data(from._internal_string_data());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.max_entries_ = from._impl_.max_entries_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.num_entries_ = from._impl_.num_entries_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.user_data_fixed_size_ = from._impl_.user_data_fixed_size_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.user_data_size_ = from._impl_.user_data_size_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.user_data_size_bits_ = from._impl_.user_data_size_bits_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.flags_ = from._impl_.flags_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_CreateStringTable::CopyFrom(const CSVCMsg_CreateStringTable& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_CreateStringTable)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_CreateStringTable::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_CreateStringTable::InternalSwap(CSVCMsg_CreateStringTable* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.string_data_, lhs_arena,
+      &other->_impl_.string_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_CreateStringTable, _impl_.flags_)
+      + sizeof(CSVCMsg_CreateStringTable::_impl_.flags_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_CreateStringTable, _impl_.max_entries_)>(
+          reinterpret_cast<char*>(&_impl_.max_entries_),
+          reinterpret_cast<char*>(&other->_impl_.max_entries_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_CreateStringTable::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[33]);
+}
+
+// ===================================================================
+
+class CSVCMsg_UpdateStringTable::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_UpdateStringTable>()._impl_._has_bits_);
+  static void set_has_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_changed_entries(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_string_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_UpdateStringTable::CSVCMsg_UpdateStringTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_UpdateStringTable)
+}
+CSVCMsg_UpdateStringTable::CSVCMsg_UpdateStringTable(const CSVCMsg_UpdateStringTable& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_UpdateStringTable* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.string_data_){}
+    , decltype(_impl_.table_id_){}
+    , decltype(_impl_.num_changed_entries_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.string_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.string_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_string_data()) {
+    _this->_impl_.string_data_.Set(from._internal_string_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.table_id_, &from._impl_.table_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_changed_entries_) -
+    reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.num_changed_entries_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_UpdateStringTable)
+}
+
+inline void CSVCMsg_UpdateStringTable::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.string_data_){}
+    , decltype(_impl_.table_id_){0}
+    , decltype(_impl_.num_changed_entries_){0}
+  };
+  _impl_.string_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.string_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_UpdateStringTable::~CSVCMsg_UpdateStringTable() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_UpdateStringTable)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_UpdateStringTable::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.string_data_.Destroy();
+}
+
+void CSVCMsg_UpdateStringTable::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_UpdateStringTable::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_UpdateStringTable)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.string_data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.table_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_changed_entries_) -
+        reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.num_changed_entries_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_UpdateStringTable::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 table_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_table_id(&has_bits);
+          _impl_.table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_changed_entries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_changed_entries(&has_bits);
+          _impl_.num_changed_entries_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes string_data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_string_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_UpdateStringTable::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_UpdateStringTable)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 table_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_table_id(), target);
+  }
+
+  // optional int32 num_changed_entries = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_num_changed_entries(), target);
+  }
+
+  // optional bytes string_data = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_string_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_UpdateStringTable)
+  return target;
+}
+
+size_t CSVCMsg_UpdateStringTable::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_UpdateStringTable)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bytes string_data = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_string_data());
+    }
+
+    // optional int32 table_id = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_table_id());
+    }
+
+    // optional int32 num_changed_entries = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_changed_entries());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_UpdateStringTable::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_UpdateStringTable::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_UpdateStringTable::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_UpdateStringTable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_UpdateStringTable*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_UpdateStringTable&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_UpdateStringTable)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_string_data(from._internal_string_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.table_id_ = from._impl_.table_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_changed_entries_ = from._impl_.num_changed_entries_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_UpdateStringTable::CopyFrom(const CSVCMsg_UpdateStringTable& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_UpdateStringTable)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_UpdateStringTable::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_UpdateStringTable::InternalSwap(CSVCMsg_UpdateStringTable* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.string_data_, lhs_arena,
+      &other->_impl_.string_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_UpdateStringTable, _impl_.num_changed_entries_)
+      + sizeof(CSVCMsg_UpdateStringTable::_impl_.num_changed_entries_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_UpdateStringTable, _impl_.table_id_)>(
+          reinterpret_cast<char*>(&_impl_.table_id_),
+          reinterpret_cast<char*>(&other->_impl_.table_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_UpdateStringTable::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[34]);
+}
+
+// ===================================================================
+
+class CSVCMsg_VoiceData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_VoiceData>()._impl_._has_bits_);
+  static void set_has_client(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_proximity(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_xuid(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_audible_mask(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_voice_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_format(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_sequence_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_section_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_uncompressed_sample_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+};
+
+CSVCMsg_VoiceData::CSVCMsg_VoiceData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_VoiceData)
+}
+CSVCMsg_VoiceData::CSVCMsg_VoiceData(const CSVCMsg_VoiceData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_VoiceData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.voice_data_){}
+    , decltype(_impl_.client_){}
+    , decltype(_impl_.proximity_){}
+    , decltype(_impl_.xuid_){}
+    , decltype(_impl_.audible_mask_){}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.sequence_bytes_){}
+    , decltype(_impl_.section_number_){}
+    , decltype(_impl_.uncompressed_sample_offset_){}
+    , decltype(_impl_.tick_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.voice_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.voice_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_voice_data()) {
+    _this->_impl_.voice_data_.Set(from._internal_voice_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.client_, &from._impl_.client_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tick_) -
+    reinterpret_cast<char*>(&_impl_.client_)) + sizeof(_impl_.tick_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_VoiceData)
+}
+
+inline void CSVCMsg_VoiceData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.voice_data_){}
+    , decltype(_impl_.client_){0}
+    , decltype(_impl_.proximity_){false}
+    , decltype(_impl_.xuid_){uint64_t{0u}}
+    , decltype(_impl_.audible_mask_){0}
+    , decltype(_impl_.format_){0}
+    , decltype(_impl_.sequence_bytes_){0}
+    , decltype(_impl_.section_number_){0u}
+    , decltype(_impl_.uncompressed_sample_offset_){0u}
+    , decltype(_impl_.tick_){0u}
+  };
+  _impl_.voice_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.voice_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_VoiceData::~CSVCMsg_VoiceData() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_VoiceData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_VoiceData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.voice_data_.Destroy();
+}
+
+void CSVCMsg_VoiceData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_VoiceData::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_VoiceData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.voice_data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.client_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.section_number_) -
+        reinterpret_cast<char*>(&_impl_.client_)) + sizeof(_impl_.section_number_));
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.uncompressed_sample_offset_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.tick_) -
+        reinterpret_cast<char*>(&_impl_.uncompressed_sample_offset_)) + sizeof(_impl_.tick_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_VoiceData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 client = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_client(&has_bits);
+          _impl_.client_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool proximity = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_proximity(&has_bits);
+          _impl_.proximity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 xuid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_xuid(&has_bits);
+          _impl_.xuid_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 audible_mask = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_audible_mask(&has_bits);
+          _impl_.audible_mask_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes voice_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_voice_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .VoiceDataFormat_t format = 6 [default = VOICEDATA_FORMAT_STEAM];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::VoiceDataFormat_t_IsValid(val))) {
+            _internal_set_format(static_cast<::VoiceDataFormat_t>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 sequence_bytes = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_sequence_bytes(&has_bits);
+          _impl_.sequence_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 section_number = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_section_number(&has_bits);
+          _impl_.section_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 uncompressed_sample_offset = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_uncompressed_sample_offset(&has_bits);
+          _impl_.uncompressed_sample_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 tick = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_VoiceData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_VoiceData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 client = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_client(), target);
+  }
+
+  // optional bool proximity = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_proximity(), target);
+  }
+
+  // optional fixed64 xuid = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_xuid(), target);
+  }
+
+  // optional int32 audible_mask = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_audible_mask(), target);
+  }
+
+  // optional bytes voice_data = 5;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_voice_data(), target);
+  }
+
+  // optional .VoiceDataFormat_t format = 6 [default = VOICEDATA_FORMAT_STEAM];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_format(), target);
+  }
+
+  // optional int32 sequence_bytes = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_sequence_bytes(), target);
+  }
+
+  // optional uint32 section_number = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_section_number(), target);
+  }
+
+  // optional uint32 uncompressed_sample_offset = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_uncompressed_sample_offset(), target);
+  }
+
+  // optional uint32 tick = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_tick(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_VoiceData)
+  return target;
+}
+
+size_t CSVCMsg_VoiceData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_VoiceData)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional bytes voice_data = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_voice_data());
+    }
+
+    // optional int32 client = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_client());
+    }
+
+    // optional bool proximity = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional fixed64 xuid = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 audible_mask = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_audible_mask());
+    }
+
+    // optional .VoiceDataFormat_t format = 6 [default = VOICEDATA_FORMAT_STEAM];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_format());
+    }
+
+    // optional int32 sequence_bytes = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sequence_bytes());
+    }
+
+    // optional uint32 section_number = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_section_number());
+    }
+
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional uint32 uncompressed_sample_offset = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_uncompressed_sample_offset());
+    }
+
+    // optional uint32 tick = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tick());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_VoiceData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_VoiceData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_VoiceData::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_VoiceData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_VoiceData*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_VoiceData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_VoiceData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_voice_data(from._internal_voice_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.client_ = from._impl_.client_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.proximity_ = from._impl_.proximity_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.xuid_ = from._impl_.xuid_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.audible_mask_ = from._impl_.audible_mask_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.format_ = from._impl_.format_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.sequence_bytes_ = from._impl_.sequence_bytes_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.section_number_ = from._impl_.section_number_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.uncompressed_sample_offset_ = from._impl_.uncompressed_sample_offset_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_VoiceData::CopyFrom(const CSVCMsg_VoiceData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_VoiceData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_VoiceData::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_VoiceData::InternalSwap(CSVCMsg_VoiceData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.voice_data_, lhs_arena,
+      &other->_impl_.voice_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_VoiceData, _impl_.tick_)
+      + sizeof(CSVCMsg_VoiceData::_impl_.tick_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_VoiceData, _impl_.client_)>(
+          reinterpret_cast<char*>(&_impl_.client_),
+          reinterpret_cast<char*>(&other->_impl_.client_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_VoiceData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[35]);
+}
+
+// ===================================================================
+
+class CSVCMsg_PacketReliable::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_PacketReliable>()._impl_._has_bits_);
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_messagessize(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CSVCMsg_PacketReliable::CSVCMsg_PacketReliable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_PacketReliable)
+}
+CSVCMsg_PacketReliable::CSVCMsg_PacketReliable(const CSVCMsg_PacketReliable& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_PacketReliable* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tick_){}
+    , decltype(_impl_.messagessize_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.tick_, &from._impl_.tick_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.messagessize_) -
+    reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.messagessize_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_PacketReliable)
+}
+
+inline void CSVCMsg_PacketReliable::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tick_){0}
+    , decltype(_impl_.messagessize_){0}
+  };
+}
+
+CSVCMsg_PacketReliable::~CSVCMsg_PacketReliable() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_PacketReliable)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_PacketReliable::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CSVCMsg_PacketReliable::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_PacketReliable::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_PacketReliable)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.tick_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.messagessize_) -
+        reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.messagessize_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_PacketReliable::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 messagessize = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_messagessize(&has_bits);
+          _impl_.messagessize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_PacketReliable::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_PacketReliable)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 tick = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_tick(), target);
+  }
+
+  // optional int32 messagessize = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_messagessize(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_PacketReliable)
+  return target;
+}
+
+size_t CSVCMsg_PacketReliable::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_PacketReliable)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 tick = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tick());
+    }
+
+    // optional int32 messagessize = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_messagessize());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_PacketReliable::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_PacketReliable::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_PacketReliable::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_PacketReliable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_PacketReliable*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_PacketReliable&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_PacketReliable)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.messagessize_ = from._impl_.messagessize_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_PacketReliable::CopyFrom(const CSVCMsg_PacketReliable& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_PacketReliable)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_PacketReliable::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_PacketReliable::InternalSwap(CSVCMsg_PacketReliable* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_PacketReliable, _impl_.messagessize_)
+      + sizeof(CSVCMsg_PacketReliable::_impl_.messagessize_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_PacketReliable, _impl_.tick_)>(
+          reinterpret_cast<char*>(&_impl_.tick_),
+          reinterpret_cast<char*>(&other->_impl_.tick_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_PacketReliable::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[36]);
+}
+
+// ===================================================================
+
+class CSVCMsg_FullFrameSplit::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_FullFrameSplit>()._impl_._has_bits_);
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_section(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_total(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_FullFrameSplit::CSVCMsg_FullFrameSplit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_FullFrameSplit)
+}
+CSVCMsg_FullFrameSplit::CSVCMsg_FullFrameSplit(const CSVCMsg_FullFrameSplit& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_FullFrameSplit* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.tick_){}
+    , decltype(_impl_.section_){}
+    , decltype(_impl_.total_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.tick_, &from._impl_.tick_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_) -
+    reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.total_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_FullFrameSplit)
+}
+
+inline void CSVCMsg_FullFrameSplit::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.tick_){0}
+    , decltype(_impl_.section_){0}
+    , decltype(_impl_.total_){0}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_FullFrameSplit::~CSVCMsg_FullFrameSplit() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_FullFrameSplit)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_FullFrameSplit::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void CSVCMsg_FullFrameSplit::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_FullFrameSplit::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_FullFrameSplit)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.tick_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.total_) -
+        reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.total_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_FullFrameSplit::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 section = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_section(&has_bits);
+          _impl_.section_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 total = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_total(&has_bits);
+          _impl_.total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_FullFrameSplit::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_FullFrameSplit)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 tick = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_tick(), target);
+  }
+
+  // optional int32 section = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_section(), target);
+  }
+
+  // optional int32 total = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_total(), target);
+  }
+
+  // optional bytes data = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_FullFrameSplit)
+  return target;
+}
+
+size_t CSVCMsg_FullFrameSplit::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_FullFrameSplit)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional bytes data = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_data());
+    }
+
+    // optional int32 tick = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tick());
+    }
+
+    // optional int32 section = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_section());
+    }
+
+    // optional int32 total = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_FullFrameSplit::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_FullFrameSplit::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_FullFrameSplit::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_FullFrameSplit::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_FullFrameSplit*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_FullFrameSplit&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_FullFrameSplit)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_data(from._internal_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.section_ = from._impl_.section_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.total_ = from._impl_.total_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_FullFrameSplit::CopyFrom(const CSVCMsg_FullFrameSplit& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_FullFrameSplit)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_FullFrameSplit::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_FullFrameSplit::InternalSwap(CSVCMsg_FullFrameSplit* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_FullFrameSplit, _impl_.total_)
+      + sizeof(CSVCMsg_FullFrameSplit::_impl_.total_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_FullFrameSplit, _impl_.tick_)>(
+          reinterpret_cast<char*>(&_impl_.tick_),
+          reinterpret_cast<char*>(&other->_impl_.tick_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_FullFrameSplit::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_netmessages_2eproto_getter, &descriptor_table_netmessages_2eproto_once,
+      file_level_metadata_netmessages_2eproto[37]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::CCLCMsg_ClientInfo*
+Arena::CreateMaybeMessage< ::CCLCMsg_ClientInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_ClientInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CCLCMsg_Move*
+Arena::CreateMaybeMessage< ::CCLCMsg_Move >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_Move >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CCLCMsg_VoiceData*
+Arena::CreateMaybeMessage< ::CCLCMsg_VoiceData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_VoiceData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CCLCMsg_BaselineAck*
+Arena::CreateMaybeMessage< ::CCLCMsg_BaselineAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_BaselineAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CCLCMsg_ListenEvents*
+Arena::CreateMaybeMessage< ::CCLCMsg_ListenEvents >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_ListenEvents >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CCLCMsg_RespondCvarValue*
+Arena::CreateMaybeMessage< ::CCLCMsg_RespondCvarValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_RespondCvarValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CCLCMsg_FileCRCCheck*
+Arena::CreateMaybeMessage< ::CCLCMsg_FileCRCCheck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_FileCRCCheck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CCLCMsg_LoadingProgress*
+Arena::CreateMaybeMessage< ::CCLCMsg_LoadingProgress >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_LoadingProgress >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CCLCMsg_SplitPlayerConnect*
+Arena::CreateMaybeMessage< ::CCLCMsg_SplitPlayerConnect >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_SplitPlayerConnect >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CCLCMsg_ClientMessage*
+Arena::CreateMaybeMessage< ::CCLCMsg_ClientMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CCLCMsg_ClientMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_ServerInfo*
+Arena::CreateMaybeMessage< ::CSVCMsg_ServerInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_ServerInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_ClassInfo_class_t*
+Arena::CreateMaybeMessage< ::CSVCMsg_ClassInfo_class_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_ClassInfo_class_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_ClassInfo*
+Arena::CreateMaybeMessage< ::CSVCMsg_ClassInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_ClassInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_SetPause*
+Arena::CreateMaybeMessage< ::CSVCMsg_SetPause >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_SetPause >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_VoiceInit*
+Arena::CreateMaybeMessage< ::CSVCMsg_VoiceInit >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_VoiceInit >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_Print*
+Arena::CreateMaybeMessage< ::CSVCMsg_Print >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_Print >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_Sounds_sounddata_t*
+Arena::CreateMaybeMessage< ::CSVCMsg_Sounds_sounddata_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_Sounds_sounddata_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_Sounds*
+Arena::CreateMaybeMessage< ::CSVCMsg_Sounds >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_Sounds >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_Prefetch*
+Arena::CreateMaybeMessage< ::CSVCMsg_Prefetch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_Prefetch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_SetView*
+Arena::CreateMaybeMessage< ::CSVCMsg_SetView >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_SetView >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_FixAngle*
+Arena::CreateMaybeMessage< ::CSVCMsg_FixAngle >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_FixAngle >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_CrosshairAngle*
+Arena::CreateMaybeMessage< ::CSVCMsg_CrosshairAngle >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_CrosshairAngle >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_BSPDecal*
+Arena::CreateMaybeMessage< ::CSVCMsg_BSPDecal >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_BSPDecal >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_SplitScreen*
+Arena::CreateMaybeMessage< ::CSVCMsg_SplitScreen >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_SplitScreen >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_GetCvarValue*
+Arena::CreateMaybeMessage< ::CSVCMsg_GetCvarValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_GetCvarValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_Menu*
+Arena::CreateMaybeMessage< ::CSVCMsg_Menu >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_Menu >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_SendTable_sendprop_t*
+Arena::CreateMaybeMessage< ::CSVCMsg_SendTable_sendprop_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_SendTable_sendprop_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_SendTable*
+Arena::CreateMaybeMessage< ::CSVCMsg_SendTable >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_SendTable >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_GameEventList_key_t*
+Arena::CreateMaybeMessage< ::CSVCMsg_GameEventList_key_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_GameEventList_key_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_GameEventList_descriptor_t*
+Arena::CreateMaybeMessage< ::CSVCMsg_GameEventList_descriptor_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_GameEventList_descriptor_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_GameEventList*
+Arena::CreateMaybeMessage< ::CSVCMsg_GameEventList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_GameEventList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_PacketEntities*
+Arena::CreateMaybeMessage< ::CSVCMsg_PacketEntities >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_PacketEntities >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_TempEntities*
+Arena::CreateMaybeMessage< ::CSVCMsg_TempEntities >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_TempEntities >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_CreateStringTable*
+Arena::CreateMaybeMessage< ::CSVCMsg_CreateStringTable >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_CreateStringTable >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_UpdateStringTable*
+Arena::CreateMaybeMessage< ::CSVCMsg_UpdateStringTable >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_UpdateStringTable >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_VoiceData*
+Arena::CreateMaybeMessage< ::CSVCMsg_VoiceData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_VoiceData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_PacketReliable*
+Arena::CreateMaybeMessage< ::CSVCMsg_PacketReliable >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_PacketReliable >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_FullFrameSplit*
+Arena::CreateMaybeMessage< ::CSVCMsg_FullFrameSplit >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_FullFrameSplit >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,14530 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: netmessages.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_netmessages_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_netmessages_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "networkbasetypes.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_netmessages_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_netmessages_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_netmessages_2eproto;
+class CCLCMsg_BaselineAck;
+struct CCLCMsg_BaselineAckDefaultTypeInternal;
+extern CCLCMsg_BaselineAckDefaultTypeInternal _CCLCMsg_BaselineAck_default_instance_;
+class CCLCMsg_ClientInfo;
+struct CCLCMsg_ClientInfoDefaultTypeInternal;
+extern CCLCMsg_ClientInfoDefaultTypeInternal _CCLCMsg_ClientInfo_default_instance_;
+class CCLCMsg_ClientMessage;
+struct CCLCMsg_ClientMessageDefaultTypeInternal;
+extern CCLCMsg_ClientMessageDefaultTypeInternal _CCLCMsg_ClientMessage_default_instance_;
+class CCLCMsg_FileCRCCheck;
+struct CCLCMsg_FileCRCCheckDefaultTypeInternal;
+extern CCLCMsg_FileCRCCheckDefaultTypeInternal _CCLCMsg_FileCRCCheck_default_instance_;
+class CCLCMsg_ListenEvents;
+struct CCLCMsg_ListenEventsDefaultTypeInternal;
+extern CCLCMsg_ListenEventsDefaultTypeInternal _CCLCMsg_ListenEvents_default_instance_;
+class CCLCMsg_LoadingProgress;
+struct CCLCMsg_LoadingProgressDefaultTypeInternal;
+extern CCLCMsg_LoadingProgressDefaultTypeInternal _CCLCMsg_LoadingProgress_default_instance_;
+class CCLCMsg_Move;
+struct CCLCMsg_MoveDefaultTypeInternal;
+extern CCLCMsg_MoveDefaultTypeInternal _CCLCMsg_Move_default_instance_;
+class CCLCMsg_RespondCvarValue;
+struct CCLCMsg_RespondCvarValueDefaultTypeInternal;
+extern CCLCMsg_RespondCvarValueDefaultTypeInternal _CCLCMsg_RespondCvarValue_default_instance_;
+class CCLCMsg_SplitPlayerConnect;
+struct CCLCMsg_SplitPlayerConnectDefaultTypeInternal;
+extern CCLCMsg_SplitPlayerConnectDefaultTypeInternal _CCLCMsg_SplitPlayerConnect_default_instance_;
+class CCLCMsg_VoiceData;
+struct CCLCMsg_VoiceDataDefaultTypeInternal;
+extern CCLCMsg_VoiceDataDefaultTypeInternal _CCLCMsg_VoiceData_default_instance_;
+class CSVCMsg_BSPDecal;
+struct CSVCMsg_BSPDecalDefaultTypeInternal;
+extern CSVCMsg_BSPDecalDefaultTypeInternal _CSVCMsg_BSPDecal_default_instance_;
+class CSVCMsg_ClassInfo;
+struct CSVCMsg_ClassInfoDefaultTypeInternal;
+extern CSVCMsg_ClassInfoDefaultTypeInternal _CSVCMsg_ClassInfo_default_instance_;
+class CSVCMsg_ClassInfo_class_t;
+struct CSVCMsg_ClassInfo_class_tDefaultTypeInternal;
+extern CSVCMsg_ClassInfo_class_tDefaultTypeInternal _CSVCMsg_ClassInfo_class_t_default_instance_;
+class CSVCMsg_CreateStringTable;
+struct CSVCMsg_CreateStringTableDefaultTypeInternal;
+extern CSVCMsg_CreateStringTableDefaultTypeInternal _CSVCMsg_CreateStringTable_default_instance_;
+class CSVCMsg_CrosshairAngle;
+struct CSVCMsg_CrosshairAngleDefaultTypeInternal;
+extern CSVCMsg_CrosshairAngleDefaultTypeInternal _CSVCMsg_CrosshairAngle_default_instance_;
+class CSVCMsg_FixAngle;
+struct CSVCMsg_FixAngleDefaultTypeInternal;
+extern CSVCMsg_FixAngleDefaultTypeInternal _CSVCMsg_FixAngle_default_instance_;
+class CSVCMsg_FullFrameSplit;
+struct CSVCMsg_FullFrameSplitDefaultTypeInternal;
+extern CSVCMsg_FullFrameSplitDefaultTypeInternal _CSVCMsg_FullFrameSplit_default_instance_;
+class CSVCMsg_GameEventList;
+struct CSVCMsg_GameEventListDefaultTypeInternal;
+extern CSVCMsg_GameEventListDefaultTypeInternal _CSVCMsg_GameEventList_default_instance_;
+class CSVCMsg_GameEventList_descriptor_t;
+struct CSVCMsg_GameEventList_descriptor_tDefaultTypeInternal;
+extern CSVCMsg_GameEventList_descriptor_tDefaultTypeInternal _CSVCMsg_GameEventList_descriptor_t_default_instance_;
+class CSVCMsg_GameEventList_key_t;
+struct CSVCMsg_GameEventList_key_tDefaultTypeInternal;
+extern CSVCMsg_GameEventList_key_tDefaultTypeInternal _CSVCMsg_GameEventList_key_t_default_instance_;
+class CSVCMsg_GetCvarValue;
+struct CSVCMsg_GetCvarValueDefaultTypeInternal;
+extern CSVCMsg_GetCvarValueDefaultTypeInternal _CSVCMsg_GetCvarValue_default_instance_;
+class CSVCMsg_Menu;
+struct CSVCMsg_MenuDefaultTypeInternal;
+extern CSVCMsg_MenuDefaultTypeInternal _CSVCMsg_Menu_default_instance_;
+class CSVCMsg_PacketEntities;
+struct CSVCMsg_PacketEntitiesDefaultTypeInternal;
+extern CSVCMsg_PacketEntitiesDefaultTypeInternal _CSVCMsg_PacketEntities_default_instance_;
+class CSVCMsg_PacketReliable;
+struct CSVCMsg_PacketReliableDefaultTypeInternal;
+extern CSVCMsg_PacketReliableDefaultTypeInternal _CSVCMsg_PacketReliable_default_instance_;
+class CSVCMsg_Prefetch;
+struct CSVCMsg_PrefetchDefaultTypeInternal;
+extern CSVCMsg_PrefetchDefaultTypeInternal _CSVCMsg_Prefetch_default_instance_;
+class CSVCMsg_Print;
+struct CSVCMsg_PrintDefaultTypeInternal;
+extern CSVCMsg_PrintDefaultTypeInternal _CSVCMsg_Print_default_instance_;
+class CSVCMsg_SendTable;
+struct CSVCMsg_SendTableDefaultTypeInternal;
+extern CSVCMsg_SendTableDefaultTypeInternal _CSVCMsg_SendTable_default_instance_;
+class CSVCMsg_SendTable_sendprop_t;
+struct CSVCMsg_SendTable_sendprop_tDefaultTypeInternal;
+extern CSVCMsg_SendTable_sendprop_tDefaultTypeInternal _CSVCMsg_SendTable_sendprop_t_default_instance_;
+class CSVCMsg_ServerInfo;
+struct CSVCMsg_ServerInfoDefaultTypeInternal;
+extern CSVCMsg_ServerInfoDefaultTypeInternal _CSVCMsg_ServerInfo_default_instance_;
+class CSVCMsg_SetPause;
+struct CSVCMsg_SetPauseDefaultTypeInternal;
+extern CSVCMsg_SetPauseDefaultTypeInternal _CSVCMsg_SetPause_default_instance_;
+class CSVCMsg_SetView;
+struct CSVCMsg_SetViewDefaultTypeInternal;
+extern CSVCMsg_SetViewDefaultTypeInternal _CSVCMsg_SetView_default_instance_;
+class CSVCMsg_Sounds;
+struct CSVCMsg_SoundsDefaultTypeInternal;
+extern CSVCMsg_SoundsDefaultTypeInternal _CSVCMsg_Sounds_default_instance_;
+class CSVCMsg_Sounds_sounddata_t;
+struct CSVCMsg_Sounds_sounddata_tDefaultTypeInternal;
+extern CSVCMsg_Sounds_sounddata_tDefaultTypeInternal _CSVCMsg_Sounds_sounddata_t_default_instance_;
+class CSVCMsg_SplitScreen;
+struct CSVCMsg_SplitScreenDefaultTypeInternal;
+extern CSVCMsg_SplitScreenDefaultTypeInternal _CSVCMsg_SplitScreen_default_instance_;
+class CSVCMsg_TempEntities;
+struct CSVCMsg_TempEntitiesDefaultTypeInternal;
+extern CSVCMsg_TempEntitiesDefaultTypeInternal _CSVCMsg_TempEntities_default_instance_;
+class CSVCMsg_UpdateStringTable;
+struct CSVCMsg_UpdateStringTableDefaultTypeInternal;
+extern CSVCMsg_UpdateStringTableDefaultTypeInternal _CSVCMsg_UpdateStringTable_default_instance_;
+class CSVCMsg_VoiceData;
+struct CSVCMsg_VoiceDataDefaultTypeInternal;
+extern CSVCMsg_VoiceDataDefaultTypeInternal _CSVCMsg_VoiceData_default_instance_;
+class CSVCMsg_VoiceInit;
+struct CSVCMsg_VoiceInitDefaultTypeInternal;
+extern CSVCMsg_VoiceInitDefaultTypeInternal _CSVCMsg_VoiceInit_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::CCLCMsg_BaselineAck* Arena::CreateMaybeMessage<::CCLCMsg_BaselineAck>(Arena*);
+template<> ::CCLCMsg_ClientInfo* Arena::CreateMaybeMessage<::CCLCMsg_ClientInfo>(Arena*);
+template<> ::CCLCMsg_ClientMessage* Arena::CreateMaybeMessage<::CCLCMsg_ClientMessage>(Arena*);
+template<> ::CCLCMsg_FileCRCCheck* Arena::CreateMaybeMessage<::CCLCMsg_FileCRCCheck>(Arena*);
+template<> ::CCLCMsg_ListenEvents* Arena::CreateMaybeMessage<::CCLCMsg_ListenEvents>(Arena*);
+template<> ::CCLCMsg_LoadingProgress* Arena::CreateMaybeMessage<::CCLCMsg_LoadingProgress>(Arena*);
+template<> ::CCLCMsg_Move* Arena::CreateMaybeMessage<::CCLCMsg_Move>(Arena*);
+template<> ::CCLCMsg_RespondCvarValue* Arena::CreateMaybeMessage<::CCLCMsg_RespondCvarValue>(Arena*);
+template<> ::CCLCMsg_SplitPlayerConnect* Arena::CreateMaybeMessage<::CCLCMsg_SplitPlayerConnect>(Arena*);
+template<> ::CCLCMsg_VoiceData* Arena::CreateMaybeMessage<::CCLCMsg_VoiceData>(Arena*);
+template<> ::CSVCMsg_BSPDecal* Arena::CreateMaybeMessage<::CSVCMsg_BSPDecal>(Arena*);
+template<> ::CSVCMsg_ClassInfo* Arena::CreateMaybeMessage<::CSVCMsg_ClassInfo>(Arena*);
+template<> ::CSVCMsg_ClassInfo_class_t* Arena::CreateMaybeMessage<::CSVCMsg_ClassInfo_class_t>(Arena*);
+template<> ::CSVCMsg_CreateStringTable* Arena::CreateMaybeMessage<::CSVCMsg_CreateStringTable>(Arena*);
+template<> ::CSVCMsg_CrosshairAngle* Arena::CreateMaybeMessage<::CSVCMsg_CrosshairAngle>(Arena*);
+template<> ::CSVCMsg_FixAngle* Arena::CreateMaybeMessage<::CSVCMsg_FixAngle>(Arena*);
+template<> ::CSVCMsg_FullFrameSplit* Arena::CreateMaybeMessage<::CSVCMsg_FullFrameSplit>(Arena*);
+template<> ::CSVCMsg_GameEventList* Arena::CreateMaybeMessage<::CSVCMsg_GameEventList>(Arena*);
+template<> ::CSVCMsg_GameEventList_descriptor_t* Arena::CreateMaybeMessage<::CSVCMsg_GameEventList_descriptor_t>(Arena*);
+template<> ::CSVCMsg_GameEventList_key_t* Arena::CreateMaybeMessage<::CSVCMsg_GameEventList_key_t>(Arena*);
+template<> ::CSVCMsg_GetCvarValue* Arena::CreateMaybeMessage<::CSVCMsg_GetCvarValue>(Arena*);
+template<> ::CSVCMsg_Menu* Arena::CreateMaybeMessage<::CSVCMsg_Menu>(Arena*);
+template<> ::CSVCMsg_PacketEntities* Arena::CreateMaybeMessage<::CSVCMsg_PacketEntities>(Arena*);
+template<> ::CSVCMsg_PacketReliable* Arena::CreateMaybeMessage<::CSVCMsg_PacketReliable>(Arena*);
+template<> ::CSVCMsg_Prefetch* Arena::CreateMaybeMessage<::CSVCMsg_Prefetch>(Arena*);
+template<> ::CSVCMsg_Print* Arena::CreateMaybeMessage<::CSVCMsg_Print>(Arena*);
+template<> ::CSVCMsg_SendTable* Arena::CreateMaybeMessage<::CSVCMsg_SendTable>(Arena*);
+template<> ::CSVCMsg_SendTable_sendprop_t* Arena::CreateMaybeMessage<::CSVCMsg_SendTable_sendprop_t>(Arena*);
+template<> ::CSVCMsg_ServerInfo* Arena::CreateMaybeMessage<::CSVCMsg_ServerInfo>(Arena*);
+template<> ::CSVCMsg_SetPause* Arena::CreateMaybeMessage<::CSVCMsg_SetPause>(Arena*);
+template<> ::CSVCMsg_SetView* Arena::CreateMaybeMessage<::CSVCMsg_SetView>(Arena*);
+template<> ::CSVCMsg_Sounds* Arena::CreateMaybeMessage<::CSVCMsg_Sounds>(Arena*);
+template<> ::CSVCMsg_Sounds_sounddata_t* Arena::CreateMaybeMessage<::CSVCMsg_Sounds_sounddata_t>(Arena*);
+template<> ::CSVCMsg_SplitScreen* Arena::CreateMaybeMessage<::CSVCMsg_SplitScreen>(Arena*);
+template<> ::CSVCMsg_TempEntities* Arena::CreateMaybeMessage<::CSVCMsg_TempEntities>(Arena*);
+template<> ::CSVCMsg_UpdateStringTable* Arena::CreateMaybeMessage<::CSVCMsg_UpdateStringTable>(Arena*);
+template<> ::CSVCMsg_VoiceData* Arena::CreateMaybeMessage<::CSVCMsg_VoiceData>(Arena*);
+template<> ::CSVCMsg_VoiceInit* Arena::CreateMaybeMessage<::CSVCMsg_VoiceInit>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+enum CLC_Messages : int {
+  clc_ClientInfo = 8,
+  clc_Move = 9,
+  clc_VoiceData = 10,
+  clc_BaselineAck = 11,
+  clc_ListenEvents = 12,
+  clc_RespondCvarValue = 13,
+  clc_FileCRCCheck = 14,
+  clc_LoadingProgress = 15,
+  clc_SplitPlayerConnect = 16,
+  clc_ClientMessage = 17
+};
+bool CLC_Messages_IsValid(int value);
+constexpr CLC_Messages CLC_Messages_MIN = clc_ClientInfo;
+constexpr CLC_Messages CLC_Messages_MAX = clc_ClientMessage;
+constexpr int CLC_Messages_ARRAYSIZE = CLC_Messages_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CLC_Messages_descriptor();
+template<typename T>
+inline const std::string& CLC_Messages_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CLC_Messages>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CLC_Messages_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CLC_Messages_descriptor(), enum_t_value);
+}
+inline bool CLC_Messages_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CLC_Messages* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CLC_Messages>(
+    CLC_Messages_descriptor(), name, value);
+}
+enum SVC_Messages : int {
+  svc_ServerInfo = 8,
+  svc_SendTable = 9,
+  svc_ClassInfo = 10,
+  svc_SetPause = 11,
+  svc_CreateStringTable = 12,
+  svc_UpdateStringTable = 13,
+  svc_VoiceInit = 14,
+  svc_VoiceData = 15,
+  svc_Print = 16,
+  svc_Sounds = 17,
+  svc_SetView = 18,
+  svc_FixAngle = 19,
+  svc_CrosshairAngle = 20,
+  svc_BSPDecal = 21,
+  svc_SplitScreen = 22,
+  svc_UserMessage = 23,
+  svc_EntityMessage = 24,
+  svc_GameEvent = 25,
+  svc_PacketEntities = 26,
+  svc_TempEntities = 27,
+  svc_Prefetch = 28,
+  svc_Menu = 29,
+  svc_GameEventList = 30,
+  svc_GetCvarValue = 31,
+  svc_PacketReliable = 32,
+  svc_FullFrameSplit = 33
+};
+bool SVC_Messages_IsValid(int value);
+constexpr SVC_Messages SVC_Messages_MIN = svc_ServerInfo;
+constexpr SVC_Messages SVC_Messages_MAX = svc_FullFrameSplit;
+constexpr int SVC_Messages_ARRAYSIZE = SVC_Messages_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SVC_Messages_descriptor();
+template<typename T>
+inline const std::string& SVC_Messages_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SVC_Messages>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SVC_Messages_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SVC_Messages_descriptor(), enum_t_value);
+}
+inline bool SVC_Messages_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SVC_Messages* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SVC_Messages>(
+    SVC_Messages_descriptor(), name, value);
+}
+enum VoiceDataFormat_t : int {
+  VOICEDATA_FORMAT_STEAM = 0,
+  VOICEDATA_FORMAT_ENGINE = 1
+};
+bool VoiceDataFormat_t_IsValid(int value);
+constexpr VoiceDataFormat_t VoiceDataFormat_t_MIN = VOICEDATA_FORMAT_STEAM;
+constexpr VoiceDataFormat_t VoiceDataFormat_t_MAX = VOICEDATA_FORMAT_ENGINE;
+constexpr int VoiceDataFormat_t_ARRAYSIZE = VoiceDataFormat_t_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VoiceDataFormat_t_descriptor();
+template<typename T>
+inline const std::string& VoiceDataFormat_t_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, VoiceDataFormat_t>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function VoiceDataFormat_t_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    VoiceDataFormat_t_descriptor(), enum_t_value);
+}
+inline bool VoiceDataFormat_t_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, VoiceDataFormat_t* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<VoiceDataFormat_t>(
+    VoiceDataFormat_t_descriptor(), name, value);
+}
+enum ESplitScreenMessageType : int {
+  MSG_SPLITSCREEN_ADDUSER = 0,
+  MSG_SPLITSCREEN_REMOVEUSER = 1
+};
+bool ESplitScreenMessageType_IsValid(int value);
+constexpr ESplitScreenMessageType ESplitScreenMessageType_MIN = MSG_SPLITSCREEN_ADDUSER;
+constexpr ESplitScreenMessageType ESplitScreenMessageType_MAX = MSG_SPLITSCREEN_REMOVEUSER;
+constexpr int ESplitScreenMessageType_ARRAYSIZE = ESplitScreenMessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ESplitScreenMessageType_descriptor();
+template<typename T>
+inline const std::string& ESplitScreenMessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ESplitScreenMessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ESplitScreenMessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ESplitScreenMessageType_descriptor(), enum_t_value);
+}
+inline bool ESplitScreenMessageType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ESplitScreenMessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ESplitScreenMessageType>(
+    ESplitScreenMessageType_descriptor(), name, value);
+}
+// ===================================================================
+
+class CCLCMsg_ClientInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_ClientInfo) */ {
+ public:
+  inline CCLCMsg_ClientInfo() : CCLCMsg_ClientInfo(nullptr) {}
+  ~CCLCMsg_ClientInfo() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_ClientInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_ClientInfo(const CCLCMsg_ClientInfo& from);
+  CCLCMsg_ClientInfo(CCLCMsg_ClientInfo&& from) noexcept
+    : CCLCMsg_ClientInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_ClientInfo& operator=(const CCLCMsg_ClientInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_ClientInfo& operator=(CCLCMsg_ClientInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_ClientInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_ClientInfo* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_ClientInfo*>(
+               &_CCLCMsg_ClientInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CCLCMsg_ClientInfo& a, CCLCMsg_ClientInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_ClientInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_ClientInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_ClientInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_ClientInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_ClientInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_ClientInfo& from) {
+    CCLCMsg_ClientInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_ClientInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_ClientInfo";
+  }
+  protected:
+  explicit CCLCMsg_ClientInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCustomFilesFieldNumber = 7,
+    kFriendsNameFieldNumber = 6,
+    kSendTableCrcFieldNumber = 1,
+    kServerCountFieldNumber = 2,
+    kIsHltvFieldNumber = 3,
+    kIsReplayFieldNumber = 4,
+    kFriendsIdFieldNumber = 5,
+  };
+  // repeated fixed32 custom_files = 7;
+  int custom_files_size() const;
+  private:
+  int _internal_custom_files_size() const;
+  public:
+  void clear_custom_files();
+  private:
+  uint32_t _internal_custom_files(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_custom_files() const;
+  void _internal_add_custom_files(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_custom_files();
+  public:
+  uint32_t custom_files(int index) const;
+  void set_custom_files(int index, uint32_t value);
+  void add_custom_files(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      custom_files() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_custom_files();
+
+  // optional string friends_name = 6;
+  bool has_friends_name() const;
+  private:
+  bool _internal_has_friends_name() const;
+  public:
+  void clear_friends_name();
+  const std::string& friends_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_friends_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_friends_name();
+  PROTOBUF_NODISCARD std::string* release_friends_name();
+  void set_allocated_friends_name(std::string* friends_name);
+  private:
+  const std::string& _internal_friends_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_friends_name(const std::string& value);
+  std::string* _internal_mutable_friends_name();
+  public:
+
+  // optional fixed32 send_table_crc = 1;
+  bool has_send_table_crc() const;
+  private:
+  bool _internal_has_send_table_crc() const;
+  public:
+  void clear_send_table_crc();
+  uint32_t send_table_crc() const;
+  void set_send_table_crc(uint32_t value);
+  private:
+  uint32_t _internal_send_table_crc() const;
+  void _internal_set_send_table_crc(uint32_t value);
+  public:
+
+  // optional uint32 server_count = 2;
+  bool has_server_count() const;
+  private:
+  bool _internal_has_server_count() const;
+  public:
+  void clear_server_count();
+  uint32_t server_count() const;
+  void set_server_count(uint32_t value);
+  private:
+  uint32_t _internal_server_count() const;
+  void _internal_set_server_count(uint32_t value);
+  public:
+
+  // optional bool is_hltv = 3;
+  bool has_is_hltv() const;
+  private:
+  bool _internal_has_is_hltv() const;
+  public:
+  void clear_is_hltv();
+  bool is_hltv() const;
+  void set_is_hltv(bool value);
+  private:
+  bool _internal_is_hltv() const;
+  void _internal_set_is_hltv(bool value);
+  public:
+
+  // optional bool is_replay = 4;
+  bool has_is_replay() const;
+  private:
+  bool _internal_has_is_replay() const;
+  public:
+  void clear_is_replay();
+  bool is_replay() const;
+  void set_is_replay(bool value);
+  private:
+  bool _internal_is_replay() const;
+  void _internal_set_is_replay(bool value);
+  public:
+
+  // optional uint32 friends_id = 5;
+  bool has_friends_id() const;
+  private:
+  bool _internal_has_friends_id() const;
+  public:
+  void clear_friends_id();
+  uint32_t friends_id() const;
+  void set_friends_id(uint32_t value);
+  private:
+  uint32_t _internal_friends_id() const;
+  void _internal_set_friends_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_ClientInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > custom_files_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr friends_name_;
+    uint32_t send_table_crc_;
+    uint32_t server_count_;
+    bool is_hltv_;
+    bool is_replay_;
+    uint32_t friends_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CCLCMsg_Move final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_Move) */ {
+ public:
+  inline CCLCMsg_Move() : CCLCMsg_Move(nullptr) {}
+  ~CCLCMsg_Move() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_Move(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_Move(const CCLCMsg_Move& from);
+  CCLCMsg_Move(CCLCMsg_Move&& from) noexcept
+    : CCLCMsg_Move() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_Move& operator=(const CCLCMsg_Move& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_Move& operator=(CCLCMsg_Move&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_Move& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_Move* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_Move*>(
+               &_CCLCMsg_Move_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(CCLCMsg_Move& a, CCLCMsg_Move& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_Move* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_Move* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_Move* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_Move>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_Move& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_Move& from) {
+    CCLCMsg_Move::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_Move* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_Move";
+  }
+  protected:
+  explicit CCLCMsg_Move(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 3,
+    kNumBackupCommandsFieldNumber = 1,
+    kNumNewCommandsFieldNumber = 2,
+  };
+  // optional bytes data = 3;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // optional uint32 num_backup_commands = 1;
+  bool has_num_backup_commands() const;
+  private:
+  bool _internal_has_num_backup_commands() const;
+  public:
+  void clear_num_backup_commands();
+  uint32_t num_backup_commands() const;
+  void set_num_backup_commands(uint32_t value);
+  private:
+  uint32_t _internal_num_backup_commands() const;
+  void _internal_set_num_backup_commands(uint32_t value);
+  public:
+
+  // optional uint32 num_new_commands = 2;
+  bool has_num_new_commands() const;
+  private:
+  bool _internal_has_num_new_commands() const;
+  public:
+  void clear_num_new_commands();
+  uint32_t num_new_commands() const;
+  void set_num_new_commands(uint32_t value);
+  private:
+  uint32_t _internal_num_new_commands() const;
+  void _internal_set_num_new_commands(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_Move)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint32_t num_backup_commands_;
+    uint32_t num_new_commands_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CCLCMsg_VoiceData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_VoiceData) */ {
+ public:
+  inline CCLCMsg_VoiceData() : CCLCMsg_VoiceData(nullptr) {}
+  ~CCLCMsg_VoiceData() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_VoiceData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_VoiceData(const CCLCMsg_VoiceData& from);
+  CCLCMsg_VoiceData(CCLCMsg_VoiceData&& from) noexcept
+    : CCLCMsg_VoiceData() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_VoiceData& operator=(const CCLCMsg_VoiceData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_VoiceData& operator=(CCLCMsg_VoiceData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_VoiceData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_VoiceData* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_VoiceData*>(
+               &_CCLCMsg_VoiceData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CCLCMsg_VoiceData& a, CCLCMsg_VoiceData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_VoiceData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_VoiceData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_VoiceData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_VoiceData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_VoiceData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_VoiceData& from) {
+    CCLCMsg_VoiceData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_VoiceData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_VoiceData";
+  }
+  protected:
+  explicit CCLCMsg_VoiceData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+    kXuidFieldNumber = 2,
+    kFormatFieldNumber = 3,
+    kSequenceBytesFieldNumber = 4,
+    kSectionNumberFieldNumber = 5,
+    kUncompressedSampleOffsetFieldNumber = 6,
+    kTickFieldNumber = 7,
+  };
+  // optional bytes data = 1;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // optional fixed64 xuid = 2;
+  bool has_xuid() const;
+  private:
+  bool _internal_has_xuid() const;
+  public:
+  void clear_xuid();
+  uint64_t xuid() const;
+  void set_xuid(uint64_t value);
+  private:
+  uint64_t _internal_xuid() const;
+  void _internal_set_xuid(uint64_t value);
+  public:
+
+  // optional .VoiceDataFormat_t format = 3 [default = VOICEDATA_FORMAT_STEAM];
+  bool has_format() const;
+  private:
+  bool _internal_has_format() const;
+  public:
+  void clear_format();
+  ::VoiceDataFormat_t format() const;
+  void set_format(::VoiceDataFormat_t value);
+  private:
+  ::VoiceDataFormat_t _internal_format() const;
+  void _internal_set_format(::VoiceDataFormat_t value);
+  public:
+
+  // optional int32 sequence_bytes = 4;
+  bool has_sequence_bytes() const;
+  private:
+  bool _internal_has_sequence_bytes() const;
+  public:
+  void clear_sequence_bytes();
+  int32_t sequence_bytes() const;
+  void set_sequence_bytes(int32_t value);
+  private:
+  int32_t _internal_sequence_bytes() const;
+  void _internal_set_sequence_bytes(int32_t value);
+  public:
+
+  // optional uint32 section_number = 5;
+  bool has_section_number() const;
+  private:
+  bool _internal_has_section_number() const;
+  public:
+  void clear_section_number();
+  uint32_t section_number() const;
+  void set_section_number(uint32_t value);
+  private:
+  uint32_t _internal_section_number() const;
+  void _internal_set_section_number(uint32_t value);
+  public:
+
+  // optional uint32 uncompressed_sample_offset = 6;
+  bool has_uncompressed_sample_offset() const;
+  private:
+  bool _internal_has_uncompressed_sample_offset() const;
+  public:
+  void clear_uncompressed_sample_offset();
+  uint32_t uncompressed_sample_offset() const;
+  void set_uncompressed_sample_offset(uint32_t value);
+  private:
+  uint32_t _internal_uncompressed_sample_offset() const;
+  void _internal_set_uncompressed_sample_offset(uint32_t value);
+  public:
+
+  // optional uint32 tick = 7;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  uint32_t tick() const;
+  void set_tick(uint32_t value);
+  private:
+  uint32_t _internal_tick() const;
+  void _internal_set_tick(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_VoiceData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t xuid_;
+    int format_;
+    int32_t sequence_bytes_;
+    uint32_t section_number_;
+    uint32_t uncompressed_sample_offset_;
+    uint32_t tick_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CCLCMsg_BaselineAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_BaselineAck) */ {
+ public:
+  inline CCLCMsg_BaselineAck() : CCLCMsg_BaselineAck(nullptr) {}
+  ~CCLCMsg_BaselineAck() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_BaselineAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_BaselineAck(const CCLCMsg_BaselineAck& from);
+  CCLCMsg_BaselineAck(CCLCMsg_BaselineAck&& from) noexcept
+    : CCLCMsg_BaselineAck() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_BaselineAck& operator=(const CCLCMsg_BaselineAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_BaselineAck& operator=(CCLCMsg_BaselineAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_BaselineAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_BaselineAck* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_BaselineAck*>(
+               &_CCLCMsg_BaselineAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CCLCMsg_BaselineAck& a, CCLCMsg_BaselineAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_BaselineAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_BaselineAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_BaselineAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_BaselineAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_BaselineAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_BaselineAck& from) {
+    CCLCMsg_BaselineAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_BaselineAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_BaselineAck";
+  }
+  protected:
+  explicit CCLCMsg_BaselineAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBaselineTickFieldNumber = 1,
+    kBaselineNrFieldNumber = 2,
+  };
+  // optional int32 baseline_tick = 1;
+  bool has_baseline_tick() const;
+  private:
+  bool _internal_has_baseline_tick() const;
+  public:
+  void clear_baseline_tick();
+  int32_t baseline_tick() const;
+  void set_baseline_tick(int32_t value);
+  private:
+  int32_t _internal_baseline_tick() const;
+  void _internal_set_baseline_tick(int32_t value);
+  public:
+
+  // optional int32 baseline_nr = 2;
+  bool has_baseline_nr() const;
+  private:
+  bool _internal_has_baseline_nr() const;
+  public:
+  void clear_baseline_nr();
+  int32_t baseline_nr() const;
+  void set_baseline_nr(int32_t value);
+  private:
+  int32_t _internal_baseline_nr() const;
+  void _internal_set_baseline_nr(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_BaselineAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t baseline_tick_;
+    int32_t baseline_nr_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CCLCMsg_ListenEvents final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_ListenEvents) */ {
+ public:
+  inline CCLCMsg_ListenEvents() : CCLCMsg_ListenEvents(nullptr) {}
+  ~CCLCMsg_ListenEvents() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_ListenEvents(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_ListenEvents(const CCLCMsg_ListenEvents& from);
+  CCLCMsg_ListenEvents(CCLCMsg_ListenEvents&& from) noexcept
+    : CCLCMsg_ListenEvents() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_ListenEvents& operator=(const CCLCMsg_ListenEvents& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_ListenEvents& operator=(CCLCMsg_ListenEvents&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_ListenEvents& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_ListenEvents* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_ListenEvents*>(
+               &_CCLCMsg_ListenEvents_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CCLCMsg_ListenEvents& a, CCLCMsg_ListenEvents& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_ListenEvents* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_ListenEvents* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_ListenEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_ListenEvents>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_ListenEvents& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_ListenEvents& from) {
+    CCLCMsg_ListenEvents::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_ListenEvents* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_ListenEvents";
+  }
+  protected:
+  explicit CCLCMsg_ListenEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventMaskFieldNumber = 1,
+  };
+  // repeated fixed32 event_mask = 1;
+  int event_mask_size() const;
+  private:
+  int _internal_event_mask_size() const;
+  public:
+  void clear_event_mask();
+  private:
+  uint32_t _internal_event_mask(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_event_mask() const;
+  void _internal_add_event_mask(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_event_mask();
+  public:
+  uint32_t event_mask(int index) const;
+  void set_event_mask(int index, uint32_t value);
+  void add_event_mask(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      event_mask() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_event_mask();
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_ListenEvents)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > event_mask_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CCLCMsg_RespondCvarValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_RespondCvarValue) */ {
+ public:
+  inline CCLCMsg_RespondCvarValue() : CCLCMsg_RespondCvarValue(nullptr) {}
+  ~CCLCMsg_RespondCvarValue() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_RespondCvarValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_RespondCvarValue(const CCLCMsg_RespondCvarValue& from);
+  CCLCMsg_RespondCvarValue(CCLCMsg_RespondCvarValue&& from) noexcept
+    : CCLCMsg_RespondCvarValue() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_RespondCvarValue& operator=(const CCLCMsg_RespondCvarValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_RespondCvarValue& operator=(CCLCMsg_RespondCvarValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_RespondCvarValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_RespondCvarValue* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_RespondCvarValue*>(
+               &_CCLCMsg_RespondCvarValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(CCLCMsg_RespondCvarValue& a, CCLCMsg_RespondCvarValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_RespondCvarValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_RespondCvarValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_RespondCvarValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_RespondCvarValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_RespondCvarValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_RespondCvarValue& from) {
+    CCLCMsg_RespondCvarValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_RespondCvarValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_RespondCvarValue";
+  }
+  protected:
+  explicit CCLCMsg_RespondCvarValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 3,
+    kValueFieldNumber = 4,
+    kCookieFieldNumber = 1,
+    kStatusCodeFieldNumber = 2,
+  };
+  // optional string name = 3;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string value = 4;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // optional int32 cookie = 1;
+  bool has_cookie() const;
+  private:
+  bool _internal_has_cookie() const;
+  public:
+  void clear_cookie();
+  int32_t cookie() const;
+  void set_cookie(int32_t value);
+  private:
+  int32_t _internal_cookie() const;
+  void _internal_set_cookie(int32_t value);
+  public:
+
+  // optional int32 status_code = 2;
+  bool has_status_code() const;
+  private:
+  bool _internal_has_status_code() const;
+  public:
+  void clear_status_code();
+  int32_t status_code() const;
+  void set_status_code(int32_t value);
+  private:
+  int32_t _internal_status_code() const;
+  void _internal_set_status_code(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_RespondCvarValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t cookie_;
+    int32_t status_code_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CCLCMsg_FileCRCCheck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_FileCRCCheck) */ {
+ public:
+  inline CCLCMsg_FileCRCCheck() : CCLCMsg_FileCRCCheck(nullptr) {}
+  ~CCLCMsg_FileCRCCheck() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_FileCRCCheck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_FileCRCCheck(const CCLCMsg_FileCRCCheck& from);
+  CCLCMsg_FileCRCCheck(CCLCMsg_FileCRCCheck&& from) noexcept
+    : CCLCMsg_FileCRCCheck() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_FileCRCCheck& operator=(const CCLCMsg_FileCRCCheck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_FileCRCCheck& operator=(CCLCMsg_FileCRCCheck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_FileCRCCheck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_FileCRCCheck* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_FileCRCCheck*>(
+               &_CCLCMsg_FileCRCCheck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(CCLCMsg_FileCRCCheck& a, CCLCMsg_FileCRCCheck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_FileCRCCheck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_FileCRCCheck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_FileCRCCheck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_FileCRCCheck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_FileCRCCheck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_FileCRCCheck& from) {
+    CCLCMsg_FileCRCCheck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_FileCRCCheck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_FileCRCCheck";
+  }
+  protected:
+  explicit CCLCMsg_FileCRCCheck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathFieldNumber = 2,
+    kFilenameFieldNumber = 4,
+    kCodePathFieldNumber = 1,
+    kCodeFilenameFieldNumber = 3,
+    kCrcFieldNumber = 5,
+  };
+  // optional string path = 2;
+  bool has_path() const;
+  private:
+  bool _internal_has_path() const;
+  public:
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // optional string filename = 4;
+  bool has_filename() const;
+  private:
+  bool _internal_has_filename() const;
+  public:
+  void clear_filename();
+  const std::string& filename() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_filename(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_filename();
+  PROTOBUF_NODISCARD std::string* release_filename();
+  void set_allocated_filename(std::string* filename);
+  private:
+  const std::string& _internal_filename() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_filename(const std::string& value);
+  std::string* _internal_mutable_filename();
+  public:
+
+  // optional int32 code_path = 1;
+  bool has_code_path() const;
+  private:
+  bool _internal_has_code_path() const;
+  public:
+  void clear_code_path();
+  int32_t code_path() const;
+  void set_code_path(int32_t value);
+  private:
+  int32_t _internal_code_path() const;
+  void _internal_set_code_path(int32_t value);
+  public:
+
+  // optional int32 code_filename = 3;
+  bool has_code_filename() const;
+  private:
+  bool _internal_has_code_filename() const;
+  public:
+  void clear_code_filename();
+  int32_t code_filename() const;
+  void set_code_filename(int32_t value);
+  private:
+  int32_t _internal_code_filename() const;
+  void _internal_set_code_filename(int32_t value);
+  public:
+
+  // optional fixed32 crc = 5;
+  bool has_crc() const;
+  private:
+  bool _internal_has_crc() const;
+  public:
+  void clear_crc();
+  uint32_t crc() const;
+  void set_crc(uint32_t value);
+  private:
+  uint32_t _internal_crc() const;
+  void _internal_set_crc(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_FileCRCCheck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filename_;
+    int32_t code_path_;
+    int32_t code_filename_;
+    uint32_t crc_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CCLCMsg_LoadingProgress final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_LoadingProgress) */ {
+ public:
+  inline CCLCMsg_LoadingProgress() : CCLCMsg_LoadingProgress(nullptr) {}
+  ~CCLCMsg_LoadingProgress() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_LoadingProgress(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_LoadingProgress(const CCLCMsg_LoadingProgress& from);
+  CCLCMsg_LoadingProgress(CCLCMsg_LoadingProgress&& from) noexcept
+    : CCLCMsg_LoadingProgress() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_LoadingProgress& operator=(const CCLCMsg_LoadingProgress& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_LoadingProgress& operator=(CCLCMsg_LoadingProgress&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_LoadingProgress& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_LoadingProgress* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_LoadingProgress*>(
+               &_CCLCMsg_LoadingProgress_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(CCLCMsg_LoadingProgress& a, CCLCMsg_LoadingProgress& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_LoadingProgress* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_LoadingProgress* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_LoadingProgress* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_LoadingProgress>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_LoadingProgress& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_LoadingProgress& from) {
+    CCLCMsg_LoadingProgress::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_LoadingProgress* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_LoadingProgress";
+  }
+  protected:
+  explicit CCLCMsg_LoadingProgress(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProgressFieldNumber = 1,
+  };
+  // optional int32 progress = 1;
+  bool has_progress() const;
+  private:
+  bool _internal_has_progress() const;
+  public:
+  void clear_progress();
+  int32_t progress() const;
+  void set_progress(int32_t value);
+  private:
+  int32_t _internal_progress() const;
+  void _internal_set_progress(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_LoadingProgress)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t progress_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CCLCMsg_SplitPlayerConnect final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_SplitPlayerConnect) */ {
+ public:
+  inline CCLCMsg_SplitPlayerConnect() : CCLCMsg_SplitPlayerConnect(nullptr) {}
+  ~CCLCMsg_SplitPlayerConnect() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_SplitPlayerConnect(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_SplitPlayerConnect(const CCLCMsg_SplitPlayerConnect& from);
+  CCLCMsg_SplitPlayerConnect(CCLCMsg_SplitPlayerConnect&& from) noexcept
+    : CCLCMsg_SplitPlayerConnect() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_SplitPlayerConnect& operator=(const CCLCMsg_SplitPlayerConnect& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_SplitPlayerConnect& operator=(CCLCMsg_SplitPlayerConnect&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_SplitPlayerConnect& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_SplitPlayerConnect* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_SplitPlayerConnect*>(
+               &_CCLCMsg_SplitPlayerConnect_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(CCLCMsg_SplitPlayerConnect& a, CCLCMsg_SplitPlayerConnect& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_SplitPlayerConnect* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_SplitPlayerConnect* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_SplitPlayerConnect* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_SplitPlayerConnect>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_SplitPlayerConnect& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_SplitPlayerConnect& from) {
+    CCLCMsg_SplitPlayerConnect::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_SplitPlayerConnect* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_SplitPlayerConnect";
+  }
+  protected:
+  explicit CCLCMsg_SplitPlayerConnect(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConvarsFieldNumber = 1,
+  };
+  // optional .CMsg_CVars convars = 1;
+  bool has_convars() const;
+  private:
+  bool _internal_has_convars() const;
+  public:
+  void clear_convars();
+  const ::CMsg_CVars& convars() const;
+  PROTOBUF_NODISCARD ::CMsg_CVars* release_convars();
+  ::CMsg_CVars* mutable_convars();
+  void set_allocated_convars(::CMsg_CVars* convars);
+  private:
+  const ::CMsg_CVars& _internal_convars() const;
+  ::CMsg_CVars* _internal_mutable_convars();
+  public:
+  void unsafe_arena_set_allocated_convars(
+      ::CMsg_CVars* convars);
+  ::CMsg_CVars* unsafe_arena_release_convars();
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_SplitPlayerConnect)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CMsg_CVars* convars_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CCLCMsg_ClientMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CCLCMsg_ClientMessage) */ {
+ public:
+  inline CCLCMsg_ClientMessage() : CCLCMsg_ClientMessage(nullptr) {}
+  ~CCLCMsg_ClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR CCLCMsg_ClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CCLCMsg_ClientMessage(const CCLCMsg_ClientMessage& from);
+  CCLCMsg_ClientMessage(CCLCMsg_ClientMessage&& from) noexcept
+    : CCLCMsg_ClientMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CCLCMsg_ClientMessage& operator=(const CCLCMsg_ClientMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CCLCMsg_ClientMessage& operator=(CCLCMsg_ClientMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CCLCMsg_ClientMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CCLCMsg_ClientMessage* internal_default_instance() {
+    return reinterpret_cast<const CCLCMsg_ClientMessage*>(
+               &_CCLCMsg_ClientMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(CCLCMsg_ClientMessage& a, CCLCMsg_ClientMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CCLCMsg_ClientMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CCLCMsg_ClientMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CCLCMsg_ClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CCLCMsg_ClientMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CCLCMsg_ClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CCLCMsg_ClientMessage& from) {
+    CCLCMsg_ClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CCLCMsg_ClientMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CCLCMsg_ClientMessage";
+  }
+  protected:
+  explicit CCLCMsg_ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 2,
+    kMsgTypeFieldNumber = 1,
+  };
+  // optional bytes data = 2;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // optional int32 msg_type = 1;
+  bool has_msg_type() const;
+  private:
+  bool _internal_has_msg_type() const;
+  public:
+  void clear_msg_type();
+  int32_t msg_type() const;
+  void set_msg_type(int32_t value);
+  private:
+  int32_t _internal_msg_type() const;
+  void _internal_set_msg_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CCLCMsg_ClientMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int32_t msg_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_ServerInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_ServerInfo) */ {
+ public:
+  inline CSVCMsg_ServerInfo() : CSVCMsg_ServerInfo(nullptr) {}
+  ~CSVCMsg_ServerInfo() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_ServerInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_ServerInfo(const CSVCMsg_ServerInfo& from);
+  CSVCMsg_ServerInfo(CSVCMsg_ServerInfo&& from) noexcept
+    : CSVCMsg_ServerInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_ServerInfo& operator=(const CSVCMsg_ServerInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_ServerInfo& operator=(CSVCMsg_ServerInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_ServerInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_ServerInfo* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_ServerInfo*>(
+               &_CSVCMsg_ServerInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(CSVCMsg_ServerInfo& a, CSVCMsg_ServerInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_ServerInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_ServerInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_ServerInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_ServerInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_ServerInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_ServerInfo& from) {
+    CSVCMsg_ServerInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_ServerInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_ServerInfo";
+  }
+  protected:
+  explicit CSVCMsg_ServerInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGameDirFieldNumber = 14,
+    kMapNameFieldNumber = 15,
+    kSkyNameFieldNumber = 16,
+    kHostNameFieldNumber = 17,
+    kAddonNameFieldNumber = 18,
+    kProtocolFieldNumber = 1,
+    kServerCountFieldNumber = 2,
+    kIsDedicatedFieldNumber = 3,
+    kIsHltvFieldNumber = 4,
+    kIsReplayFieldNumber = 5,
+    kCOsFieldNumber = 6,
+    kMapCrcFieldNumber = 7,
+    kClientCrcFieldNumber = 8,
+    kStringTableCrcFieldNumber = 9,
+    kMaxClientsFieldNumber = 10,
+    kMaxClassesFieldNumber = 11,
+    kPlayerSlotFieldNumber = 12,
+    kTickIntervalFieldNumber = 13,
+  };
+  // optional string game_dir = 14;
+  bool has_game_dir() const;
+  private:
+  bool _internal_has_game_dir() const;
+  public:
+  void clear_game_dir();
+  const std::string& game_dir() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_game_dir(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_game_dir();
+  PROTOBUF_NODISCARD std::string* release_game_dir();
+  void set_allocated_game_dir(std::string* game_dir);
+  private:
+  const std::string& _internal_game_dir() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_game_dir(const std::string& value);
+  std::string* _internal_mutable_game_dir();
+  public:
+
+  // optional string map_name = 15;
+  bool has_map_name() const;
+  private:
+  bool _internal_has_map_name() const;
+  public:
+  void clear_map_name();
+  const std::string& map_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_map_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_map_name();
+  PROTOBUF_NODISCARD std::string* release_map_name();
+  void set_allocated_map_name(std::string* map_name);
+  private:
+  const std::string& _internal_map_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_map_name(const std::string& value);
+  std::string* _internal_mutable_map_name();
+  public:
+
+  // optional string sky_name = 16;
+  bool has_sky_name() const;
+  private:
+  bool _internal_has_sky_name() const;
+  public:
+  void clear_sky_name();
+  const std::string& sky_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sky_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sky_name();
+  PROTOBUF_NODISCARD std::string* release_sky_name();
+  void set_allocated_sky_name(std::string* sky_name);
+  private:
+  const std::string& _internal_sky_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sky_name(const std::string& value);
+  std::string* _internal_mutable_sky_name();
+  public:
+
+  // optional string host_name = 17;
+  bool has_host_name() const;
+  private:
+  bool _internal_has_host_name() const;
+  public:
+  void clear_host_name();
+  const std::string& host_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_host_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_host_name();
+  PROTOBUF_NODISCARD std::string* release_host_name();
+  void set_allocated_host_name(std::string* host_name);
+  private:
+  const std::string& _internal_host_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host_name(const std::string& value);
+  std::string* _internal_mutable_host_name();
+  public:
+
+  // optional string addon_name = 18;
+  bool has_addon_name() const;
+  private:
+  bool _internal_has_addon_name() const;
+  public:
+  void clear_addon_name();
+  const std::string& addon_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_addon_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_addon_name();
+  PROTOBUF_NODISCARD std::string* release_addon_name();
+  void set_allocated_addon_name(std::string* addon_name);
+  private:
+  const std::string& _internal_addon_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_addon_name(const std::string& value);
+  std::string* _internal_mutable_addon_name();
+  public:
+
+  // optional int32 protocol = 1;
+  bool has_protocol() const;
+  private:
+  bool _internal_has_protocol() const;
+  public:
+  void clear_protocol();
+  int32_t protocol() const;
+  void set_protocol(int32_t value);
+  private:
+  int32_t _internal_protocol() const;
+  void _internal_set_protocol(int32_t value);
+  public:
+
+  // optional int32 server_count = 2;
+  bool has_server_count() const;
+  private:
+  bool _internal_has_server_count() const;
+  public:
+  void clear_server_count();
+  int32_t server_count() const;
+  void set_server_count(int32_t value);
+  private:
+  int32_t _internal_server_count() const;
+  void _internal_set_server_count(int32_t value);
+  public:
+
+  // optional bool is_dedicated = 3;
+  bool has_is_dedicated() const;
+  private:
+  bool _internal_has_is_dedicated() const;
+  public:
+  void clear_is_dedicated();
+  bool is_dedicated() const;
+  void set_is_dedicated(bool value);
+  private:
+  bool _internal_is_dedicated() const;
+  void _internal_set_is_dedicated(bool value);
+  public:
+
+  // optional bool is_hltv = 4;
+  bool has_is_hltv() const;
+  private:
+  bool _internal_has_is_hltv() const;
+  public:
+  void clear_is_hltv();
+  bool is_hltv() const;
+  void set_is_hltv(bool value);
+  private:
+  bool _internal_is_hltv() const;
+  void _internal_set_is_hltv(bool value);
+  public:
+
+  // optional bool is_replay = 5;
+  bool has_is_replay() const;
+  private:
+  bool _internal_has_is_replay() const;
+  public:
+  void clear_is_replay();
+  bool is_replay() const;
+  void set_is_replay(bool value);
+  private:
+  bool _internal_is_replay() const;
+  void _internal_set_is_replay(bool value);
+  public:
+
+  // optional int32 c_os = 6;
+  bool has_c_os() const;
+  private:
+  bool _internal_has_c_os() const;
+  public:
+  void clear_c_os();
+  int32_t c_os() const;
+  void set_c_os(int32_t value);
+  private:
+  int32_t _internal_c_os() const;
+  void _internal_set_c_os(int32_t value);
+  public:
+
+  // optional fixed32 map_crc = 7;
+  bool has_map_crc() const;
+  private:
+  bool _internal_has_map_crc() const;
+  public:
+  void clear_map_crc();
+  uint32_t map_crc() const;
+  void set_map_crc(uint32_t value);
+  private:
+  uint32_t _internal_map_crc() const;
+  void _internal_set_map_crc(uint32_t value);
+  public:
+
+  // optional fixed32 client_crc = 8;
+  bool has_client_crc() const;
+  private:
+  bool _internal_has_client_crc() const;
+  public:
+  void clear_client_crc();
+  uint32_t client_crc() const;
+  void set_client_crc(uint32_t value);
+  private:
+  uint32_t _internal_client_crc() const;
+  void _internal_set_client_crc(uint32_t value);
+  public:
+
+  // optional fixed32 string_table_crc = 9;
+  bool has_string_table_crc() const;
+  private:
+  bool _internal_has_string_table_crc() const;
+  public:
+  void clear_string_table_crc();
+  uint32_t string_table_crc() const;
+  void set_string_table_crc(uint32_t value);
+  private:
+  uint32_t _internal_string_table_crc() const;
+  void _internal_set_string_table_crc(uint32_t value);
+  public:
+
+  // optional int32 max_clients = 10;
+  bool has_max_clients() const;
+  private:
+  bool _internal_has_max_clients() const;
+  public:
+  void clear_max_clients();
+  int32_t max_clients() const;
+  void set_max_clients(int32_t value);
+  private:
+  int32_t _internal_max_clients() const;
+  void _internal_set_max_clients(int32_t value);
+  public:
+
+  // optional int32 max_classes = 11;
+  bool has_max_classes() const;
+  private:
+  bool _internal_has_max_classes() const;
+  public:
+  void clear_max_classes();
+  int32_t max_classes() const;
+  void set_max_classes(int32_t value);
+  private:
+  int32_t _internal_max_classes() const;
+  void _internal_set_max_classes(int32_t value);
+  public:
+
+  // optional int32 player_slot = 12;
+  bool has_player_slot() const;
+  private:
+  bool _internal_has_player_slot() const;
+  public:
+  void clear_player_slot();
+  int32_t player_slot() const;
+  void set_player_slot(int32_t value);
+  private:
+  int32_t _internal_player_slot() const;
+  void _internal_set_player_slot(int32_t value);
+  public:
+
+  // optional float tick_interval = 13;
+  bool has_tick_interval() const;
+  private:
+  bool _internal_has_tick_interval() const;
+  public:
+  void clear_tick_interval();
+  float tick_interval() const;
+  void set_tick_interval(float value);
+  private:
+  float _internal_tick_interval() const;
+  void _internal_set_tick_interval(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_ServerInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr game_dir_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr map_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sky_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr host_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr addon_name_;
+    int32_t protocol_;
+    int32_t server_count_;
+    bool is_dedicated_;
+    bool is_hltv_;
+    bool is_replay_;
+    int32_t c_os_;
+    uint32_t map_crc_;
+    uint32_t client_crc_;
+    uint32_t string_table_crc_;
+    int32_t max_clients_;
+    int32_t max_classes_;
+    int32_t player_slot_;
+    float tick_interval_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_ClassInfo_class_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_ClassInfo.class_t) */ {
+ public:
+  inline CSVCMsg_ClassInfo_class_t() : CSVCMsg_ClassInfo_class_t(nullptr) {}
+  ~CSVCMsg_ClassInfo_class_t() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_ClassInfo_class_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_ClassInfo_class_t(const CSVCMsg_ClassInfo_class_t& from);
+  CSVCMsg_ClassInfo_class_t(CSVCMsg_ClassInfo_class_t&& from) noexcept
+    : CSVCMsg_ClassInfo_class_t() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_ClassInfo_class_t& operator=(const CSVCMsg_ClassInfo_class_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_ClassInfo_class_t& operator=(CSVCMsg_ClassInfo_class_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_ClassInfo_class_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_ClassInfo_class_t* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_ClassInfo_class_t*>(
+               &_CSVCMsg_ClassInfo_class_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(CSVCMsg_ClassInfo_class_t& a, CSVCMsg_ClassInfo_class_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_ClassInfo_class_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_ClassInfo_class_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_ClassInfo_class_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_ClassInfo_class_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_ClassInfo_class_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_ClassInfo_class_t& from) {
+    CSVCMsg_ClassInfo_class_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_ClassInfo_class_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_ClassInfo.class_t";
+  }
+  protected:
+  explicit CSVCMsg_ClassInfo_class_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataTableNameFieldNumber = 2,
+    kClassNameFieldNumber = 3,
+    kClassIdFieldNumber = 1,
+  };
+  // optional string data_table_name = 2;
+  bool has_data_table_name() const;
+  private:
+  bool _internal_has_data_table_name() const;
+  public:
+  void clear_data_table_name();
+  const std::string& data_table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data_table_name();
+  PROTOBUF_NODISCARD std::string* release_data_table_name();
+  void set_allocated_data_table_name(std::string* data_table_name);
+  private:
+  const std::string& _internal_data_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data_table_name(const std::string& value);
+  std::string* _internal_mutable_data_table_name();
+  public:
+
+  // optional string class_name = 3;
+  bool has_class_name() const;
+  private:
+  bool _internal_has_class_name() const;
+  public:
+  void clear_class_name();
+  const std::string& class_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_class_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_class_name();
+  PROTOBUF_NODISCARD std::string* release_class_name();
+  void set_allocated_class_name(std::string* class_name);
+  private:
+  const std::string& _internal_class_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_class_name(const std::string& value);
+  std::string* _internal_mutable_class_name();
+  public:
+
+  // optional int32 class_id = 1;
+  bool has_class_id() const;
+  private:
+  bool _internal_has_class_id() const;
+  public:
+  void clear_class_id();
+  int32_t class_id() const;
+  void set_class_id(int32_t value);
+  private:
+  int32_t _internal_class_id() const;
+  void _internal_set_class_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_ClassInfo.class_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_table_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr class_name_;
+    int32_t class_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_ClassInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_ClassInfo) */ {
+ public:
+  inline CSVCMsg_ClassInfo() : CSVCMsg_ClassInfo(nullptr) {}
+  ~CSVCMsg_ClassInfo() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_ClassInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_ClassInfo(const CSVCMsg_ClassInfo& from);
+  CSVCMsg_ClassInfo(CSVCMsg_ClassInfo&& from) noexcept
+    : CSVCMsg_ClassInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_ClassInfo& operator=(const CSVCMsg_ClassInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_ClassInfo& operator=(CSVCMsg_ClassInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_ClassInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_ClassInfo* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_ClassInfo*>(
+               &_CSVCMsg_ClassInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(CSVCMsg_ClassInfo& a, CSVCMsg_ClassInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_ClassInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_ClassInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_ClassInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_ClassInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_ClassInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_ClassInfo& from) {
+    CSVCMsg_ClassInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_ClassInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_ClassInfo";
+  }
+  protected:
+  explicit CSVCMsg_ClassInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CSVCMsg_ClassInfo_class_t class_t;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClassesFieldNumber = 2,
+    kCreateOnClientFieldNumber = 1,
+  };
+  // repeated .CSVCMsg_ClassInfo.class_t classes = 2;
+  int classes_size() const;
+  private:
+  int _internal_classes_size() const;
+  public:
+  void clear_classes();
+  ::CSVCMsg_ClassInfo_class_t* mutable_classes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_ClassInfo_class_t >*
+      mutable_classes();
+  private:
+  const ::CSVCMsg_ClassInfo_class_t& _internal_classes(int index) const;
+  ::CSVCMsg_ClassInfo_class_t* _internal_add_classes();
+  public:
+  const ::CSVCMsg_ClassInfo_class_t& classes(int index) const;
+  ::CSVCMsg_ClassInfo_class_t* add_classes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_ClassInfo_class_t >&
+      classes() const;
+
+  // optional bool create_on_client = 1;
+  bool has_create_on_client() const;
+  private:
+  bool _internal_has_create_on_client() const;
+  public:
+  void clear_create_on_client();
+  bool create_on_client() const;
+  void set_create_on_client(bool value);
+  private:
+  bool _internal_create_on_client() const;
+  void _internal_set_create_on_client(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_ClassInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_ClassInfo_class_t > classes_;
+    bool create_on_client_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_SetPause final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_SetPause) */ {
+ public:
+  inline CSVCMsg_SetPause() : CSVCMsg_SetPause(nullptr) {}
+  ~CSVCMsg_SetPause() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_SetPause(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_SetPause(const CSVCMsg_SetPause& from);
+  CSVCMsg_SetPause(CSVCMsg_SetPause&& from) noexcept
+    : CSVCMsg_SetPause() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_SetPause& operator=(const CSVCMsg_SetPause& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_SetPause& operator=(CSVCMsg_SetPause&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_SetPause& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_SetPause* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_SetPause*>(
+               &_CSVCMsg_SetPause_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(CSVCMsg_SetPause& a, CSVCMsg_SetPause& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_SetPause* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_SetPause* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_SetPause* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_SetPause>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_SetPause& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_SetPause& from) {
+    CSVCMsg_SetPause::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_SetPause* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_SetPause";
+  }
+  protected:
+  explicit CSVCMsg_SetPause(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPausedFieldNumber = 1,
+  };
+  // optional bool paused = 1;
+  bool has_paused() const;
+  private:
+  bool _internal_has_paused() const;
+  public:
+  void clear_paused();
+  bool paused() const;
+  void set_paused(bool value);
+  private:
+  bool _internal_paused() const;
+  void _internal_set_paused(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_SetPause)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool paused_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_VoiceInit final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_VoiceInit) */ {
+ public:
+  inline CSVCMsg_VoiceInit() : CSVCMsg_VoiceInit(nullptr) {}
+  ~CSVCMsg_VoiceInit() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_VoiceInit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_VoiceInit(const CSVCMsg_VoiceInit& from);
+  CSVCMsg_VoiceInit(CSVCMsg_VoiceInit&& from) noexcept
+    : CSVCMsg_VoiceInit() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_VoiceInit& operator=(const CSVCMsg_VoiceInit& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_VoiceInit& operator=(CSVCMsg_VoiceInit&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_VoiceInit& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_VoiceInit* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_VoiceInit*>(
+               &_CSVCMsg_VoiceInit_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(CSVCMsg_VoiceInit& a, CSVCMsg_VoiceInit& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_VoiceInit* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_VoiceInit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_VoiceInit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_VoiceInit>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_VoiceInit& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_VoiceInit& from) {
+    CSVCMsg_VoiceInit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_VoiceInit* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_VoiceInit";
+  }
+  protected:
+  explicit CSVCMsg_VoiceInit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCodecFieldNumber = 2,
+    kQualityFieldNumber = 1,
+    kVersionFieldNumber = 3,
+  };
+  // optional string codec = 2;
+  bool has_codec() const;
+  private:
+  bool _internal_has_codec() const;
+  public:
+  void clear_codec();
+  const std::string& codec() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_codec(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_codec();
+  PROTOBUF_NODISCARD std::string* release_codec();
+  void set_allocated_codec(std::string* codec);
+  private:
+  const std::string& _internal_codec() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_codec(const std::string& value);
+  std::string* _internal_mutable_codec();
+  public:
+
+  // optional int32 quality = 1;
+  bool has_quality() const;
+  private:
+  bool _internal_has_quality() const;
+  public:
+  void clear_quality();
+  int32_t quality() const;
+  void set_quality(int32_t value);
+  private:
+  int32_t _internal_quality() const;
+  void _internal_set_quality(int32_t value);
+  public:
+
+  // optional int32 version = 3 [default = 0];
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  int32_t version() const;
+  void set_version(int32_t value);
+  private:
+  int32_t _internal_version() const;
+  void _internal_set_version(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_VoiceInit)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr codec_;
+    int32_t quality_;
+    int32_t version_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_Print final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_Print) */ {
+ public:
+  inline CSVCMsg_Print() : CSVCMsg_Print(nullptr) {}
+  ~CSVCMsg_Print() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_Print(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_Print(const CSVCMsg_Print& from);
+  CSVCMsg_Print(CSVCMsg_Print&& from) noexcept
+    : CSVCMsg_Print() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_Print& operator=(const CSVCMsg_Print& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_Print& operator=(CSVCMsg_Print&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_Print& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_Print* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_Print*>(
+               &_CSVCMsg_Print_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(CSVCMsg_Print& a, CSVCMsg_Print& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_Print* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_Print* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_Print* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_Print>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_Print& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_Print& from) {
+    CSVCMsg_Print::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_Print* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_Print";
+  }
+  protected:
+  explicit CSVCMsg_Print(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTextFieldNumber = 1,
+  };
+  // optional string text = 1;
+  bool has_text() const;
+  private:
+  bool _internal_has_text() const;
+  public:
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_Print)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_Sounds_sounddata_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_Sounds.sounddata_t) */ {
+ public:
+  inline CSVCMsg_Sounds_sounddata_t() : CSVCMsg_Sounds_sounddata_t(nullptr) {}
+  ~CSVCMsg_Sounds_sounddata_t() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_Sounds_sounddata_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_Sounds_sounddata_t(const CSVCMsg_Sounds_sounddata_t& from);
+  CSVCMsg_Sounds_sounddata_t(CSVCMsg_Sounds_sounddata_t&& from) noexcept
+    : CSVCMsg_Sounds_sounddata_t() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_Sounds_sounddata_t& operator=(const CSVCMsg_Sounds_sounddata_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_Sounds_sounddata_t& operator=(CSVCMsg_Sounds_sounddata_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_Sounds_sounddata_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_Sounds_sounddata_t* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_Sounds_sounddata_t*>(
+               &_CSVCMsg_Sounds_sounddata_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(CSVCMsg_Sounds_sounddata_t& a, CSVCMsg_Sounds_sounddata_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_Sounds_sounddata_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_Sounds_sounddata_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_Sounds_sounddata_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_Sounds_sounddata_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_Sounds_sounddata_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_Sounds_sounddata_t& from) {
+    CSVCMsg_Sounds_sounddata_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_Sounds_sounddata_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_Sounds.sounddata_t";
+  }
+  protected:
+  explicit CSVCMsg_Sounds_sounddata_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOriginXFieldNumber = 1,
+    kOriginYFieldNumber = 2,
+    kOriginZFieldNumber = 3,
+    kVolumeFieldNumber = 4,
+    kDelayValueFieldNumber = 5,
+    kSequenceNumberFieldNumber = 6,
+    kEntityIndexFieldNumber = 7,
+    kChannelFieldNumber = 8,
+    kPitchFieldNumber = 9,
+    kFlagsFieldNumber = 10,
+    kSoundNumFieldNumber = 11,
+    kSoundNumHandleFieldNumber = 12,
+    kSpeakerEntityFieldNumber = 13,
+    kRandomSeedFieldNumber = 14,
+    kSoundLevelFieldNumber = 15,
+    kIsSentenceFieldNumber = 16,
+    kIsAmbientFieldNumber = 17,
+  };
+  // optional sint32 origin_x = 1;
+  bool has_origin_x() const;
+  private:
+  bool _internal_has_origin_x() const;
+  public:
+  void clear_origin_x();
+  int32_t origin_x() const;
+  void set_origin_x(int32_t value);
+  private:
+  int32_t _internal_origin_x() const;
+  void _internal_set_origin_x(int32_t value);
+  public:
+
+  // optional sint32 origin_y = 2;
+  bool has_origin_y() const;
+  private:
+  bool _internal_has_origin_y() const;
+  public:
+  void clear_origin_y();
+  int32_t origin_y() const;
+  void set_origin_y(int32_t value);
+  private:
+  int32_t _internal_origin_y() const;
+  void _internal_set_origin_y(int32_t value);
+  public:
+
+  // optional sint32 origin_z = 3;
+  bool has_origin_z() const;
+  private:
+  bool _internal_has_origin_z() const;
+  public:
+  void clear_origin_z();
+  int32_t origin_z() const;
+  void set_origin_z(int32_t value);
+  private:
+  int32_t _internal_origin_z() const;
+  void _internal_set_origin_z(int32_t value);
+  public:
+
+  // optional uint32 volume = 4;
+  bool has_volume() const;
+  private:
+  bool _internal_has_volume() const;
+  public:
+  void clear_volume();
+  uint32_t volume() const;
+  void set_volume(uint32_t value);
+  private:
+  uint32_t _internal_volume() const;
+  void _internal_set_volume(uint32_t value);
+  public:
+
+  // optional float delay_value = 5;
+  bool has_delay_value() const;
+  private:
+  bool _internal_has_delay_value() const;
+  public:
+  void clear_delay_value();
+  float delay_value() const;
+  void set_delay_value(float value);
+  private:
+  float _internal_delay_value() const;
+  void _internal_set_delay_value(float value);
+  public:
+
+  // optional int32 sequence_number = 6;
+  bool has_sequence_number() const;
+  private:
+  bool _internal_has_sequence_number() const;
+  public:
+  void clear_sequence_number();
+  int32_t sequence_number() const;
+  void set_sequence_number(int32_t value);
+  private:
+  int32_t _internal_sequence_number() const;
+  void _internal_set_sequence_number(int32_t value);
+  public:
+
+  // optional int32 entity_index = 7;
+  bool has_entity_index() const;
+  private:
+  bool _internal_has_entity_index() const;
+  public:
+  void clear_entity_index();
+  int32_t entity_index() const;
+  void set_entity_index(int32_t value);
+  private:
+  int32_t _internal_entity_index() const;
+  void _internal_set_entity_index(int32_t value);
+  public:
+
+  // optional int32 channel = 8;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  int32_t channel() const;
+  void set_channel(int32_t value);
+  private:
+  int32_t _internal_channel() const;
+  void _internal_set_channel(int32_t value);
+  public:
+
+  // optional int32 pitch = 9;
+  bool has_pitch() const;
+  private:
+  bool _internal_has_pitch() const;
+  public:
+  void clear_pitch();
+  int32_t pitch() const;
+  void set_pitch(int32_t value);
+  private:
+  int32_t _internal_pitch() const;
+  void _internal_set_pitch(int32_t value);
+  public:
+
+  // optional int32 flags = 10;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  int32_t flags() const;
+  void set_flags(int32_t value);
+  private:
+  int32_t _internal_flags() const;
+  void _internal_set_flags(int32_t value);
+  public:
+
+  // optional uint32 sound_num = 11;
+  bool has_sound_num() const;
+  private:
+  bool _internal_has_sound_num() const;
+  public:
+  void clear_sound_num();
+  uint32_t sound_num() const;
+  void set_sound_num(uint32_t value);
+  private:
+  uint32_t _internal_sound_num() const;
+  void _internal_set_sound_num(uint32_t value);
+  public:
+
+  // optional fixed32 sound_num_handle = 12;
+  bool has_sound_num_handle() const;
+  private:
+  bool _internal_has_sound_num_handle() const;
+  public:
+  void clear_sound_num_handle();
+  uint32_t sound_num_handle() const;
+  void set_sound_num_handle(uint32_t value);
+  private:
+  uint32_t _internal_sound_num_handle() const;
+  void _internal_set_sound_num_handle(uint32_t value);
+  public:
+
+  // optional int32 speaker_entity = 13;
+  bool has_speaker_entity() const;
+  private:
+  bool _internal_has_speaker_entity() const;
+  public:
+  void clear_speaker_entity();
+  int32_t speaker_entity() const;
+  void set_speaker_entity(int32_t value);
+  private:
+  int32_t _internal_speaker_entity() const;
+  void _internal_set_speaker_entity(int32_t value);
+  public:
+
+  // optional int32 random_seed = 14;
+  bool has_random_seed() const;
+  private:
+  bool _internal_has_random_seed() const;
+  public:
+  void clear_random_seed();
+  int32_t random_seed() const;
+  void set_random_seed(int32_t value);
+  private:
+  int32_t _internal_random_seed() const;
+  void _internal_set_random_seed(int32_t value);
+  public:
+
+  // optional int32 sound_level = 15;
+  bool has_sound_level() const;
+  private:
+  bool _internal_has_sound_level() const;
+  public:
+  void clear_sound_level();
+  int32_t sound_level() const;
+  void set_sound_level(int32_t value);
+  private:
+  int32_t _internal_sound_level() const;
+  void _internal_set_sound_level(int32_t value);
+  public:
+
+  // optional bool is_sentence = 16;
+  bool has_is_sentence() const;
+  private:
+  bool _internal_has_is_sentence() const;
+  public:
+  void clear_is_sentence();
+  bool is_sentence() const;
+  void set_is_sentence(bool value);
+  private:
+  bool _internal_is_sentence() const;
+  void _internal_set_is_sentence(bool value);
+  public:
+
+  // optional bool is_ambient = 17;
+  bool has_is_ambient() const;
+  private:
+  bool _internal_has_is_ambient() const;
+  public:
+  void clear_is_ambient();
+  bool is_ambient() const;
+  void set_is_ambient(bool value);
+  private:
+  bool _internal_is_ambient() const;
+  void _internal_set_is_ambient(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_Sounds.sounddata_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t origin_x_;
+    int32_t origin_y_;
+    int32_t origin_z_;
+    uint32_t volume_;
+    float delay_value_;
+    int32_t sequence_number_;
+    int32_t entity_index_;
+    int32_t channel_;
+    int32_t pitch_;
+    int32_t flags_;
+    uint32_t sound_num_;
+    uint32_t sound_num_handle_;
+    int32_t speaker_entity_;
+    int32_t random_seed_;
+    int32_t sound_level_;
+    bool is_sentence_;
+    bool is_ambient_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_Sounds final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_Sounds) */ {
+ public:
+  inline CSVCMsg_Sounds() : CSVCMsg_Sounds(nullptr) {}
+  ~CSVCMsg_Sounds() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_Sounds(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_Sounds(const CSVCMsg_Sounds& from);
+  CSVCMsg_Sounds(CSVCMsg_Sounds&& from) noexcept
+    : CSVCMsg_Sounds() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_Sounds& operator=(const CSVCMsg_Sounds& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_Sounds& operator=(CSVCMsg_Sounds&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_Sounds& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_Sounds* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_Sounds*>(
+               &_CSVCMsg_Sounds_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(CSVCMsg_Sounds& a, CSVCMsg_Sounds& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_Sounds* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_Sounds* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_Sounds* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_Sounds>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_Sounds& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_Sounds& from) {
+    CSVCMsg_Sounds::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_Sounds* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_Sounds";
+  }
+  protected:
+  explicit CSVCMsg_Sounds(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CSVCMsg_Sounds_sounddata_t sounddata_t;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSoundsFieldNumber = 2,
+    kReliableSoundFieldNumber = 1,
+  };
+  // repeated .CSVCMsg_Sounds.sounddata_t sounds = 2;
+  int sounds_size() const;
+  private:
+  int _internal_sounds_size() const;
+  public:
+  void clear_sounds();
+  ::CSVCMsg_Sounds_sounddata_t* mutable_sounds(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_Sounds_sounddata_t >*
+      mutable_sounds();
+  private:
+  const ::CSVCMsg_Sounds_sounddata_t& _internal_sounds(int index) const;
+  ::CSVCMsg_Sounds_sounddata_t* _internal_add_sounds();
+  public:
+  const ::CSVCMsg_Sounds_sounddata_t& sounds(int index) const;
+  ::CSVCMsg_Sounds_sounddata_t* add_sounds();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_Sounds_sounddata_t >&
+      sounds() const;
+
+  // optional bool reliable_sound = 1;
+  bool has_reliable_sound() const;
+  private:
+  bool _internal_has_reliable_sound() const;
+  public:
+  void clear_reliable_sound();
+  bool reliable_sound() const;
+  void set_reliable_sound(bool value);
+  private:
+  bool _internal_reliable_sound() const;
+  void _internal_set_reliable_sound(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_Sounds)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_Sounds_sounddata_t > sounds_;
+    bool reliable_sound_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_Prefetch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_Prefetch) */ {
+ public:
+  inline CSVCMsg_Prefetch() : CSVCMsg_Prefetch(nullptr) {}
+  ~CSVCMsg_Prefetch() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_Prefetch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_Prefetch(const CSVCMsg_Prefetch& from);
+  CSVCMsg_Prefetch(CSVCMsg_Prefetch&& from) noexcept
+    : CSVCMsg_Prefetch() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_Prefetch& operator=(const CSVCMsg_Prefetch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_Prefetch& operator=(CSVCMsg_Prefetch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_Prefetch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_Prefetch* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_Prefetch*>(
+               &_CSVCMsg_Prefetch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(CSVCMsg_Prefetch& a, CSVCMsg_Prefetch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_Prefetch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_Prefetch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_Prefetch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_Prefetch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_Prefetch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_Prefetch& from) {
+    CSVCMsg_Prefetch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_Prefetch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_Prefetch";
+  }
+  protected:
+  explicit CSVCMsg_Prefetch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSoundIndexFieldNumber = 1,
+  };
+  // optional int32 sound_index = 1;
+  bool has_sound_index() const;
+  private:
+  bool _internal_has_sound_index() const;
+  public:
+  void clear_sound_index();
+  int32_t sound_index() const;
+  void set_sound_index(int32_t value);
+  private:
+  int32_t _internal_sound_index() const;
+  void _internal_set_sound_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_Prefetch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t sound_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_SetView final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_SetView) */ {
+ public:
+  inline CSVCMsg_SetView() : CSVCMsg_SetView(nullptr) {}
+  ~CSVCMsg_SetView() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_SetView(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_SetView(const CSVCMsg_SetView& from);
+  CSVCMsg_SetView(CSVCMsg_SetView&& from) noexcept
+    : CSVCMsg_SetView() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_SetView& operator=(const CSVCMsg_SetView& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_SetView& operator=(CSVCMsg_SetView&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_SetView& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_SetView* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_SetView*>(
+               &_CSVCMsg_SetView_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(CSVCMsg_SetView& a, CSVCMsg_SetView& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_SetView* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_SetView* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_SetView* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_SetView>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_SetView& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_SetView& from) {
+    CSVCMsg_SetView::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_SetView* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_SetView";
+  }
+  protected:
+  explicit CSVCMsg_SetView(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntityIndexFieldNumber = 1,
+  };
+  // optional int32 entity_index = 1;
+  bool has_entity_index() const;
+  private:
+  bool _internal_has_entity_index() const;
+  public:
+  void clear_entity_index();
+  int32_t entity_index() const;
+  void set_entity_index(int32_t value);
+  private:
+  int32_t _internal_entity_index() const;
+  void _internal_set_entity_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_SetView)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t entity_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_FixAngle final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_FixAngle) */ {
+ public:
+  inline CSVCMsg_FixAngle() : CSVCMsg_FixAngle(nullptr) {}
+  ~CSVCMsg_FixAngle() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_FixAngle(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_FixAngle(const CSVCMsg_FixAngle& from);
+  CSVCMsg_FixAngle(CSVCMsg_FixAngle&& from) noexcept
+    : CSVCMsg_FixAngle() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_FixAngle& operator=(const CSVCMsg_FixAngle& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_FixAngle& operator=(CSVCMsg_FixAngle&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_FixAngle& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_FixAngle* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_FixAngle*>(
+               &_CSVCMsg_FixAngle_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(CSVCMsg_FixAngle& a, CSVCMsg_FixAngle& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_FixAngle* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_FixAngle* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_FixAngle* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_FixAngle>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_FixAngle& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_FixAngle& from) {
+    CSVCMsg_FixAngle::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_FixAngle* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_FixAngle";
+  }
+  protected:
+  explicit CSVCMsg_FixAngle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAngleFieldNumber = 2,
+    kRelativeFieldNumber = 1,
+  };
+  // optional .CMsgQAngle angle = 2;
+  bool has_angle() const;
+  private:
+  bool _internal_has_angle() const;
+  public:
+  void clear_angle();
+  const ::CMsgQAngle& angle() const;
+  PROTOBUF_NODISCARD ::CMsgQAngle* release_angle();
+  ::CMsgQAngle* mutable_angle();
+  void set_allocated_angle(::CMsgQAngle* angle);
+  private:
+  const ::CMsgQAngle& _internal_angle() const;
+  ::CMsgQAngle* _internal_mutable_angle();
+  public:
+  void unsafe_arena_set_allocated_angle(
+      ::CMsgQAngle* angle);
+  ::CMsgQAngle* unsafe_arena_release_angle();
+
+  // optional bool relative = 1;
+  bool has_relative() const;
+  private:
+  bool _internal_has_relative() const;
+  public:
+  void clear_relative();
+  bool relative() const;
+  void set_relative(bool value);
+  private:
+  bool _internal_relative() const;
+  void _internal_set_relative(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_FixAngle)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CMsgQAngle* angle_;
+    bool relative_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_CrosshairAngle final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_CrosshairAngle) */ {
+ public:
+  inline CSVCMsg_CrosshairAngle() : CSVCMsg_CrosshairAngle(nullptr) {}
+  ~CSVCMsg_CrosshairAngle() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_CrosshairAngle(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_CrosshairAngle(const CSVCMsg_CrosshairAngle& from);
+  CSVCMsg_CrosshairAngle(CSVCMsg_CrosshairAngle&& from) noexcept
+    : CSVCMsg_CrosshairAngle() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_CrosshairAngle& operator=(const CSVCMsg_CrosshairAngle& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_CrosshairAngle& operator=(CSVCMsg_CrosshairAngle&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_CrosshairAngle& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_CrosshairAngle* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_CrosshairAngle*>(
+               &_CSVCMsg_CrosshairAngle_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(CSVCMsg_CrosshairAngle& a, CSVCMsg_CrosshairAngle& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_CrosshairAngle* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_CrosshairAngle* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_CrosshairAngle* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_CrosshairAngle>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_CrosshairAngle& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_CrosshairAngle& from) {
+    CSVCMsg_CrosshairAngle::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_CrosshairAngle* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_CrosshairAngle";
+  }
+  protected:
+  explicit CSVCMsg_CrosshairAngle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAngleFieldNumber = 1,
+  };
+  // optional .CMsgQAngle angle = 1;
+  bool has_angle() const;
+  private:
+  bool _internal_has_angle() const;
+  public:
+  void clear_angle();
+  const ::CMsgQAngle& angle() const;
+  PROTOBUF_NODISCARD ::CMsgQAngle* release_angle();
+  ::CMsgQAngle* mutable_angle();
+  void set_allocated_angle(::CMsgQAngle* angle);
+  private:
+  const ::CMsgQAngle& _internal_angle() const;
+  ::CMsgQAngle* _internal_mutable_angle();
+  public:
+  void unsafe_arena_set_allocated_angle(
+      ::CMsgQAngle* angle);
+  ::CMsgQAngle* unsafe_arena_release_angle();
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_CrosshairAngle)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CMsgQAngle* angle_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_BSPDecal final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_BSPDecal) */ {
+ public:
+  inline CSVCMsg_BSPDecal() : CSVCMsg_BSPDecal(nullptr) {}
+  ~CSVCMsg_BSPDecal() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_BSPDecal(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_BSPDecal(const CSVCMsg_BSPDecal& from);
+  CSVCMsg_BSPDecal(CSVCMsg_BSPDecal&& from) noexcept
+    : CSVCMsg_BSPDecal() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_BSPDecal& operator=(const CSVCMsg_BSPDecal& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_BSPDecal& operator=(CSVCMsg_BSPDecal&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_BSPDecal& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_BSPDecal* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_BSPDecal*>(
+               &_CSVCMsg_BSPDecal_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(CSVCMsg_BSPDecal& a, CSVCMsg_BSPDecal& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_BSPDecal* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_BSPDecal* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_BSPDecal* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_BSPDecal>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_BSPDecal& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_BSPDecal& from) {
+    CSVCMsg_BSPDecal::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_BSPDecal* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_BSPDecal";
+  }
+  protected:
+  explicit CSVCMsg_BSPDecal(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPosFieldNumber = 1,
+    kDecalTextureIndexFieldNumber = 2,
+    kEntityIndexFieldNumber = 3,
+    kModelIndexFieldNumber = 4,
+    kLowPriorityFieldNumber = 5,
+  };
+  // optional .CMsgVector pos = 1;
+  bool has_pos() const;
+  private:
+  bool _internal_has_pos() const;
+  public:
+  void clear_pos();
+  const ::CMsgVector& pos() const;
+  PROTOBUF_NODISCARD ::CMsgVector* release_pos();
+  ::CMsgVector* mutable_pos();
+  void set_allocated_pos(::CMsgVector* pos);
+  private:
+  const ::CMsgVector& _internal_pos() const;
+  ::CMsgVector* _internal_mutable_pos();
+  public:
+  void unsafe_arena_set_allocated_pos(
+      ::CMsgVector* pos);
+  ::CMsgVector* unsafe_arena_release_pos();
+
+  // optional int32 decal_texture_index = 2;
+  bool has_decal_texture_index() const;
+  private:
+  bool _internal_has_decal_texture_index() const;
+  public:
+  void clear_decal_texture_index();
+  int32_t decal_texture_index() const;
+  void set_decal_texture_index(int32_t value);
+  private:
+  int32_t _internal_decal_texture_index() const;
+  void _internal_set_decal_texture_index(int32_t value);
+  public:
+
+  // optional int32 entity_index = 3;
+  bool has_entity_index() const;
+  private:
+  bool _internal_has_entity_index() const;
+  public:
+  void clear_entity_index();
+  int32_t entity_index() const;
+  void set_entity_index(int32_t value);
+  private:
+  int32_t _internal_entity_index() const;
+  void _internal_set_entity_index(int32_t value);
+  public:
+
+  // optional int32 model_index = 4;
+  bool has_model_index() const;
+  private:
+  bool _internal_has_model_index() const;
+  public:
+  void clear_model_index();
+  int32_t model_index() const;
+  void set_model_index(int32_t value);
+  private:
+  int32_t _internal_model_index() const;
+  void _internal_set_model_index(int32_t value);
+  public:
+
+  // optional bool low_priority = 5;
+  bool has_low_priority() const;
+  private:
+  bool _internal_has_low_priority() const;
+  public:
+  void clear_low_priority();
+  bool low_priority() const;
+  void set_low_priority(bool value);
+  private:
+  bool _internal_low_priority() const;
+  void _internal_set_low_priority(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_BSPDecal)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CMsgVector* pos_;
+    int32_t decal_texture_index_;
+    int32_t entity_index_;
+    int32_t model_index_;
+    bool low_priority_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_SplitScreen final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_SplitScreen) */ {
+ public:
+  inline CSVCMsg_SplitScreen() : CSVCMsg_SplitScreen(nullptr) {}
+  ~CSVCMsg_SplitScreen() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_SplitScreen(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_SplitScreen(const CSVCMsg_SplitScreen& from);
+  CSVCMsg_SplitScreen(CSVCMsg_SplitScreen&& from) noexcept
+    : CSVCMsg_SplitScreen() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_SplitScreen& operator=(const CSVCMsg_SplitScreen& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_SplitScreen& operator=(CSVCMsg_SplitScreen&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_SplitScreen& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_SplitScreen* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_SplitScreen*>(
+               &_CSVCMsg_SplitScreen_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(CSVCMsg_SplitScreen& a, CSVCMsg_SplitScreen& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_SplitScreen* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_SplitScreen* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_SplitScreen* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_SplitScreen>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_SplitScreen& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_SplitScreen& from) {
+    CSVCMsg_SplitScreen::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_SplitScreen* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_SplitScreen";
+  }
+  protected:
+  explicit CSVCMsg_SplitScreen(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTypeFieldNumber = 1,
+    kSlotFieldNumber = 2,
+    kPlayerIndexFieldNumber = 3,
+  };
+  // optional .ESplitScreenMessageType type = 1 [default = MSG_SPLITSCREEN_ADDUSER];
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::ESplitScreenMessageType type() const;
+  void set_type(::ESplitScreenMessageType value);
+  private:
+  ::ESplitScreenMessageType _internal_type() const;
+  void _internal_set_type(::ESplitScreenMessageType value);
+  public:
+
+  // optional int32 slot = 2;
+  bool has_slot() const;
+  private:
+  bool _internal_has_slot() const;
+  public:
+  void clear_slot();
+  int32_t slot() const;
+  void set_slot(int32_t value);
+  private:
+  int32_t _internal_slot() const;
+  void _internal_set_slot(int32_t value);
+  public:
+
+  // optional int32 player_index = 3;
+  bool has_player_index() const;
+  private:
+  bool _internal_has_player_index() const;
+  public:
+  void clear_player_index();
+  int32_t player_index() const;
+  void set_player_index(int32_t value);
+  private:
+  int32_t _internal_player_index() const;
+  void _internal_set_player_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_SplitScreen)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int type_;
+    int32_t slot_;
+    int32_t player_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_GetCvarValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_GetCvarValue) */ {
+ public:
+  inline CSVCMsg_GetCvarValue() : CSVCMsg_GetCvarValue(nullptr) {}
+  ~CSVCMsg_GetCvarValue() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_GetCvarValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_GetCvarValue(const CSVCMsg_GetCvarValue& from);
+  CSVCMsg_GetCvarValue(CSVCMsg_GetCvarValue&& from) noexcept
+    : CSVCMsg_GetCvarValue() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_GetCvarValue& operator=(const CSVCMsg_GetCvarValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_GetCvarValue& operator=(CSVCMsg_GetCvarValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_GetCvarValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_GetCvarValue* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_GetCvarValue*>(
+               &_CSVCMsg_GetCvarValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(CSVCMsg_GetCvarValue& a, CSVCMsg_GetCvarValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_GetCvarValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_GetCvarValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_GetCvarValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_GetCvarValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_GetCvarValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_GetCvarValue& from) {
+    CSVCMsg_GetCvarValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_GetCvarValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_GetCvarValue";
+  }
+  protected:
+  explicit CSVCMsg_GetCvarValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCvarNameFieldNumber = 2,
+    kCookieFieldNumber = 1,
+  };
+  // optional string cvar_name = 2;
+  bool has_cvar_name() const;
+  private:
+  bool _internal_has_cvar_name() const;
+  public:
+  void clear_cvar_name();
+  const std::string& cvar_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cvar_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cvar_name();
+  PROTOBUF_NODISCARD std::string* release_cvar_name();
+  void set_allocated_cvar_name(std::string* cvar_name);
+  private:
+  const std::string& _internal_cvar_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cvar_name(const std::string& value);
+  std::string* _internal_mutable_cvar_name();
+  public:
+
+  // optional int32 cookie = 1;
+  bool has_cookie() const;
+  private:
+  bool _internal_has_cookie() const;
+  public:
+  void clear_cookie();
+  int32_t cookie() const;
+  void set_cookie(int32_t value);
+  private:
+  int32_t _internal_cookie() const;
+  void _internal_set_cookie(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_GetCvarValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cvar_name_;
+    int32_t cookie_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_Menu final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_Menu) */ {
+ public:
+  inline CSVCMsg_Menu() : CSVCMsg_Menu(nullptr) {}
+  ~CSVCMsg_Menu() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_Menu(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_Menu(const CSVCMsg_Menu& from);
+  CSVCMsg_Menu(CSVCMsg_Menu&& from) noexcept
+    : CSVCMsg_Menu() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_Menu& operator=(const CSVCMsg_Menu& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_Menu& operator=(CSVCMsg_Menu&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_Menu& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_Menu* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_Menu*>(
+               &_CSVCMsg_Menu_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(CSVCMsg_Menu& a, CSVCMsg_Menu& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_Menu* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_Menu* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_Menu* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_Menu>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_Menu& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_Menu& from) {
+    CSVCMsg_Menu::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_Menu* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_Menu";
+  }
+  protected:
+  explicit CSVCMsg_Menu(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMenuKeyValuesFieldNumber = 2,
+    kDialogTypeFieldNumber = 1,
+  };
+  // optional bytes menu_key_values = 2;
+  bool has_menu_key_values() const;
+  private:
+  bool _internal_has_menu_key_values() const;
+  public:
+  void clear_menu_key_values();
+  const std::string& menu_key_values() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_menu_key_values(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_menu_key_values();
+  PROTOBUF_NODISCARD std::string* release_menu_key_values();
+  void set_allocated_menu_key_values(std::string* menu_key_values);
+  private:
+  const std::string& _internal_menu_key_values() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_menu_key_values(const std::string& value);
+  std::string* _internal_mutable_menu_key_values();
+  public:
+
+  // optional int32 dialog_type = 1;
+  bool has_dialog_type() const;
+  private:
+  bool _internal_has_dialog_type() const;
+  public:
+  void clear_dialog_type();
+  int32_t dialog_type() const;
+  void set_dialog_type(int32_t value);
+  private:
+  int32_t _internal_dialog_type() const;
+  void _internal_set_dialog_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_Menu)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr menu_key_values_;
+    int32_t dialog_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_SendTable_sendprop_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_SendTable.sendprop_t) */ {
+ public:
+  inline CSVCMsg_SendTable_sendprop_t() : CSVCMsg_SendTable_sendprop_t(nullptr) {}
+  ~CSVCMsg_SendTable_sendprop_t() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_SendTable_sendprop_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_SendTable_sendprop_t(const CSVCMsg_SendTable_sendprop_t& from);
+  CSVCMsg_SendTable_sendprop_t(CSVCMsg_SendTable_sendprop_t&& from) noexcept
+    : CSVCMsg_SendTable_sendprop_t() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_SendTable_sendprop_t& operator=(const CSVCMsg_SendTable_sendprop_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_SendTable_sendprop_t& operator=(CSVCMsg_SendTable_sendprop_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_SendTable_sendprop_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_SendTable_sendprop_t* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_SendTable_sendprop_t*>(
+               &_CSVCMsg_SendTable_sendprop_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(CSVCMsg_SendTable_sendprop_t& a, CSVCMsg_SendTable_sendprop_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_SendTable_sendprop_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_SendTable_sendprop_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_SendTable_sendprop_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_SendTable_sendprop_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_SendTable_sendprop_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_SendTable_sendprop_t& from) {
+    CSVCMsg_SendTable_sendprop_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_SendTable_sendprop_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_SendTable.sendprop_t";
+  }
+  protected:
+  explicit CSVCMsg_SendTable_sendprop_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVarNameFieldNumber = 2,
+    kDtNameFieldNumber = 5,
+    kTypeFieldNumber = 1,
+    kFlagsFieldNumber = 3,
+    kPriorityFieldNumber = 4,
+    kNumElementsFieldNumber = 6,
+    kLowValueFieldNumber = 7,
+    kHighValueFieldNumber = 8,
+    kNumBitsFieldNumber = 9,
+  };
+  // optional string var_name = 2;
+  bool has_var_name() const;
+  private:
+  bool _internal_has_var_name() const;
+  public:
+  void clear_var_name();
+  const std::string& var_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_var_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_var_name();
+  PROTOBUF_NODISCARD std::string* release_var_name();
+  void set_allocated_var_name(std::string* var_name);
+  private:
+  const std::string& _internal_var_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_var_name(const std::string& value);
+  std::string* _internal_mutable_var_name();
+  public:
+
+  // optional string dt_name = 5;
+  bool has_dt_name() const;
+  private:
+  bool _internal_has_dt_name() const;
+  public:
+  void clear_dt_name();
+  const std::string& dt_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dt_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_dt_name();
+  PROTOBUF_NODISCARD std::string* release_dt_name();
+  void set_allocated_dt_name(std::string* dt_name);
+  private:
+  const std::string& _internal_dt_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dt_name(const std::string& value);
+  std::string* _internal_mutable_dt_name();
+  public:
+
+  // optional int32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // optional int32 flags = 3;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  int32_t flags() const;
+  void set_flags(int32_t value);
+  private:
+  int32_t _internal_flags() const;
+  void _internal_set_flags(int32_t value);
+  public:
+
+  // optional int32 priority = 4;
+  bool has_priority() const;
+  private:
+  bool _internal_has_priority() const;
+  public:
+  void clear_priority();
+  int32_t priority() const;
+  void set_priority(int32_t value);
+  private:
+  int32_t _internal_priority() const;
+  void _internal_set_priority(int32_t value);
+  public:
+
+  // optional int32 num_elements = 6;
+  bool has_num_elements() const;
+  private:
+  bool _internal_has_num_elements() const;
+  public:
+  void clear_num_elements();
+  int32_t num_elements() const;
+  void set_num_elements(int32_t value);
+  private:
+  int32_t _internal_num_elements() const;
+  void _internal_set_num_elements(int32_t value);
+  public:
+
+  // optional float low_value = 7;
+  bool has_low_value() const;
+  private:
+  bool _internal_has_low_value() const;
+  public:
+  void clear_low_value();
+  float low_value() const;
+  void set_low_value(float value);
+  private:
+  float _internal_low_value() const;
+  void _internal_set_low_value(float value);
+  public:
+
+  // optional float high_value = 8;
+  bool has_high_value() const;
+  private:
+  bool _internal_has_high_value() const;
+  public:
+  void clear_high_value();
+  float high_value() const;
+  void set_high_value(float value);
+  private:
+  float _internal_high_value() const;
+  void _internal_set_high_value(float value);
+  public:
+
+  // optional int32 num_bits = 9;
+  bool has_num_bits() const;
+  private:
+  bool _internal_has_num_bits() const;
+  public:
+  void clear_num_bits();
+  int32_t num_bits() const;
+  void set_num_bits(int32_t value);
+  private:
+  int32_t _internal_num_bits() const;
+  void _internal_set_num_bits(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_SendTable.sendprop_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr var_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dt_name_;
+    int32_t type_;
+    int32_t flags_;
+    int32_t priority_;
+    int32_t num_elements_;
+    float low_value_;
+    float high_value_;
+    int32_t num_bits_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_SendTable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_SendTable) */ {
+ public:
+  inline CSVCMsg_SendTable() : CSVCMsg_SendTable(nullptr) {}
+  ~CSVCMsg_SendTable() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_SendTable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_SendTable(const CSVCMsg_SendTable& from);
+  CSVCMsg_SendTable(CSVCMsg_SendTable&& from) noexcept
+    : CSVCMsg_SendTable() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_SendTable& operator=(const CSVCMsg_SendTable& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_SendTable& operator=(CSVCMsg_SendTable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_SendTable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_SendTable* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_SendTable*>(
+               &_CSVCMsg_SendTable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(CSVCMsg_SendTable& a, CSVCMsg_SendTable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_SendTable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_SendTable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_SendTable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_SendTable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_SendTable& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_SendTable& from) {
+    CSVCMsg_SendTable::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_SendTable* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_SendTable";
+  }
+  protected:
+  explicit CSVCMsg_SendTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CSVCMsg_SendTable_sendprop_t sendprop_t;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPropsFieldNumber = 4,
+    kNetTableNameFieldNumber = 2,
+    kIsEndFieldNumber = 1,
+    kNeedsDecoderFieldNumber = 3,
+  };
+  // repeated .CSVCMsg_SendTable.sendprop_t props = 4;
+  int props_size() const;
+  private:
+  int _internal_props_size() const;
+  public:
+  void clear_props();
+  ::CSVCMsg_SendTable_sendprop_t* mutable_props(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_SendTable_sendprop_t >*
+      mutable_props();
+  private:
+  const ::CSVCMsg_SendTable_sendprop_t& _internal_props(int index) const;
+  ::CSVCMsg_SendTable_sendprop_t* _internal_add_props();
+  public:
+  const ::CSVCMsg_SendTable_sendprop_t& props(int index) const;
+  ::CSVCMsg_SendTable_sendprop_t* add_props();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_SendTable_sendprop_t >&
+      props() const;
+
+  // optional string net_table_name = 2;
+  bool has_net_table_name() const;
+  private:
+  bool _internal_has_net_table_name() const;
+  public:
+  void clear_net_table_name();
+  const std::string& net_table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_net_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_net_table_name();
+  PROTOBUF_NODISCARD std::string* release_net_table_name();
+  void set_allocated_net_table_name(std::string* net_table_name);
+  private:
+  const std::string& _internal_net_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_net_table_name(const std::string& value);
+  std::string* _internal_mutable_net_table_name();
+  public:
+
+  // optional bool is_end = 1;
+  bool has_is_end() const;
+  private:
+  bool _internal_has_is_end() const;
+  public:
+  void clear_is_end();
+  bool is_end() const;
+  void set_is_end(bool value);
+  private:
+  bool _internal_is_end() const;
+  void _internal_set_is_end(bool value);
+  public:
+
+  // optional bool needs_decoder = 3;
+  bool has_needs_decoder() const;
+  private:
+  bool _internal_has_needs_decoder() const;
+  public:
+  void clear_needs_decoder();
+  bool needs_decoder() const;
+  void set_needs_decoder(bool value);
+  private:
+  bool _internal_needs_decoder() const;
+  void _internal_set_needs_decoder(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_SendTable)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_SendTable_sendprop_t > props_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr net_table_name_;
+    bool is_end_;
+    bool needs_decoder_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_GameEventList_key_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_GameEventList.key_t) */ {
+ public:
+  inline CSVCMsg_GameEventList_key_t() : CSVCMsg_GameEventList_key_t(nullptr) {}
+  ~CSVCMsg_GameEventList_key_t() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_GameEventList_key_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_GameEventList_key_t(const CSVCMsg_GameEventList_key_t& from);
+  CSVCMsg_GameEventList_key_t(CSVCMsg_GameEventList_key_t&& from) noexcept
+    : CSVCMsg_GameEventList_key_t() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_GameEventList_key_t& operator=(const CSVCMsg_GameEventList_key_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_GameEventList_key_t& operator=(CSVCMsg_GameEventList_key_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_GameEventList_key_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_GameEventList_key_t* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_GameEventList_key_t*>(
+               &_CSVCMsg_GameEventList_key_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(CSVCMsg_GameEventList_key_t& a, CSVCMsg_GameEventList_key_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_GameEventList_key_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_GameEventList_key_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_GameEventList_key_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_GameEventList_key_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_GameEventList_key_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_GameEventList_key_t& from) {
+    CSVCMsg_GameEventList_key_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_GameEventList_key_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_GameEventList.key_t";
+  }
+  protected:
+  explicit CSVCMsg_GameEventList_key_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
+  // optional string name = 2;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional int32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_GameEventList.key_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_GameEventList_descriptor_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_GameEventList.descriptor_t) */ {
+ public:
+  inline CSVCMsg_GameEventList_descriptor_t() : CSVCMsg_GameEventList_descriptor_t(nullptr) {}
+  ~CSVCMsg_GameEventList_descriptor_t() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_GameEventList_descriptor_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_GameEventList_descriptor_t(const CSVCMsg_GameEventList_descriptor_t& from);
+  CSVCMsg_GameEventList_descriptor_t(CSVCMsg_GameEventList_descriptor_t&& from) noexcept
+    : CSVCMsg_GameEventList_descriptor_t() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_GameEventList_descriptor_t& operator=(const CSVCMsg_GameEventList_descriptor_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_GameEventList_descriptor_t& operator=(CSVCMsg_GameEventList_descriptor_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_GameEventList_descriptor_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_GameEventList_descriptor_t* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_GameEventList_descriptor_t*>(
+               &_CSVCMsg_GameEventList_descriptor_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(CSVCMsg_GameEventList_descriptor_t& a, CSVCMsg_GameEventList_descriptor_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_GameEventList_descriptor_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_GameEventList_descriptor_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_GameEventList_descriptor_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_GameEventList_descriptor_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_GameEventList_descriptor_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_GameEventList_descriptor_t& from) {
+    CSVCMsg_GameEventList_descriptor_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_GameEventList_descriptor_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_GameEventList.descriptor_t";
+  }
+  protected:
+  explicit CSVCMsg_GameEventList_descriptor_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 3,
+    kNameFieldNumber = 2,
+    kEventidFieldNumber = 1,
+  };
+  // repeated .CSVCMsg_GameEventList.key_t keys = 3;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  ::CSVCMsg_GameEventList_key_t* mutable_keys(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_key_t >*
+      mutable_keys();
+  private:
+  const ::CSVCMsg_GameEventList_key_t& _internal_keys(int index) const;
+  ::CSVCMsg_GameEventList_key_t* _internal_add_keys();
+  public:
+  const ::CSVCMsg_GameEventList_key_t& keys(int index) const;
+  ::CSVCMsg_GameEventList_key_t* add_keys();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_key_t >&
+      keys() const;
+
+  // optional string name = 2;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional int32 eventid = 1;
+  bool has_eventid() const;
+  private:
+  bool _internal_has_eventid() const;
+  public:
+  void clear_eventid();
+  int32_t eventid() const;
+  void set_eventid(int32_t value);
+  private:
+  int32_t _internal_eventid() const;
+  void _internal_set_eventid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_GameEventList.descriptor_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_key_t > keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t eventid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_GameEventList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_GameEventList) */ {
+ public:
+  inline CSVCMsg_GameEventList() : CSVCMsg_GameEventList(nullptr) {}
+  ~CSVCMsg_GameEventList() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_GameEventList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_GameEventList(const CSVCMsg_GameEventList& from);
+  CSVCMsg_GameEventList(CSVCMsg_GameEventList&& from) noexcept
+    : CSVCMsg_GameEventList() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_GameEventList& operator=(const CSVCMsg_GameEventList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_GameEventList& operator=(CSVCMsg_GameEventList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_GameEventList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_GameEventList* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_GameEventList*>(
+               &_CSVCMsg_GameEventList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(CSVCMsg_GameEventList& a, CSVCMsg_GameEventList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_GameEventList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_GameEventList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_GameEventList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_GameEventList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_GameEventList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_GameEventList& from) {
+    CSVCMsg_GameEventList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_GameEventList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_GameEventList";
+  }
+  protected:
+  explicit CSVCMsg_GameEventList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CSVCMsg_GameEventList_key_t key_t;
+  typedef CSVCMsg_GameEventList_descriptor_t descriptor_t;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDescriptorsFieldNumber = 1,
+  };
+  // repeated .CSVCMsg_GameEventList.descriptor_t descriptors = 1;
+  int descriptors_size() const;
+  private:
+  int _internal_descriptors_size() const;
+  public:
+  void clear_descriptors();
+  ::CSVCMsg_GameEventList_descriptor_t* mutable_descriptors(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_descriptor_t >*
+      mutable_descriptors();
+  private:
+  const ::CSVCMsg_GameEventList_descriptor_t& _internal_descriptors(int index) const;
+  ::CSVCMsg_GameEventList_descriptor_t* _internal_add_descriptors();
+  public:
+  const ::CSVCMsg_GameEventList_descriptor_t& descriptors(int index) const;
+  ::CSVCMsg_GameEventList_descriptor_t* add_descriptors();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_descriptor_t >&
+      descriptors() const;
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_GameEventList)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_descriptor_t > descriptors_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_PacketEntities final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_PacketEntities) */ {
+ public:
+  inline CSVCMsg_PacketEntities() : CSVCMsg_PacketEntities(nullptr) {}
+  ~CSVCMsg_PacketEntities() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_PacketEntities(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_PacketEntities(const CSVCMsg_PacketEntities& from);
+  CSVCMsg_PacketEntities(CSVCMsg_PacketEntities&& from) noexcept
+    : CSVCMsg_PacketEntities() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_PacketEntities& operator=(const CSVCMsg_PacketEntities& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_PacketEntities& operator=(CSVCMsg_PacketEntities&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_PacketEntities& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_PacketEntities* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_PacketEntities*>(
+               &_CSVCMsg_PacketEntities_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(CSVCMsg_PacketEntities& a, CSVCMsg_PacketEntities& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_PacketEntities* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_PacketEntities* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_PacketEntities* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_PacketEntities>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_PacketEntities& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_PacketEntities& from) {
+    CSVCMsg_PacketEntities::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_PacketEntities* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_PacketEntities";
+  }
+  protected:
+  explicit CSVCMsg_PacketEntities(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntityDataFieldNumber = 7,
+    kMaxEntriesFieldNumber = 1,
+    kUpdatedEntriesFieldNumber = 2,
+    kBaselineFieldNumber = 5,
+    kIsDeltaFieldNumber = 3,
+    kUpdateBaselineFieldNumber = 4,
+    kPendingFullFrameFieldNumber = 8,
+    kDeltaFromFieldNumber = 6,
+  };
+  // optional bytes entity_data = 7;
+  bool has_entity_data() const;
+  private:
+  bool _internal_has_entity_data() const;
+  public:
+  void clear_entity_data();
+  const std::string& entity_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entity_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_entity_data();
+  PROTOBUF_NODISCARD std::string* release_entity_data();
+  void set_allocated_entity_data(std::string* entity_data);
+  private:
+  const std::string& _internal_entity_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entity_data(const std::string& value);
+  std::string* _internal_mutable_entity_data();
+  public:
+
+  // optional int32 max_entries = 1;
+  bool has_max_entries() const;
+  private:
+  bool _internal_has_max_entries() const;
+  public:
+  void clear_max_entries();
+  int32_t max_entries() const;
+  void set_max_entries(int32_t value);
+  private:
+  int32_t _internal_max_entries() const;
+  void _internal_set_max_entries(int32_t value);
+  public:
+
+  // optional int32 updated_entries = 2;
+  bool has_updated_entries() const;
+  private:
+  bool _internal_has_updated_entries() const;
+  public:
+  void clear_updated_entries();
+  int32_t updated_entries() const;
+  void set_updated_entries(int32_t value);
+  private:
+  int32_t _internal_updated_entries() const;
+  void _internal_set_updated_entries(int32_t value);
+  public:
+
+  // optional int32 baseline = 5;
+  bool has_baseline() const;
+  private:
+  bool _internal_has_baseline() const;
+  public:
+  void clear_baseline();
+  int32_t baseline() const;
+  void set_baseline(int32_t value);
+  private:
+  int32_t _internal_baseline() const;
+  void _internal_set_baseline(int32_t value);
+  public:
+
+  // optional bool is_delta = 3;
+  bool has_is_delta() const;
+  private:
+  bool _internal_has_is_delta() const;
+  public:
+  void clear_is_delta();
+  bool is_delta() const;
+  void set_is_delta(bool value);
+  private:
+  bool _internal_is_delta() const;
+  void _internal_set_is_delta(bool value);
+  public:
+
+  // optional bool update_baseline = 4;
+  bool has_update_baseline() const;
+  private:
+  bool _internal_has_update_baseline() const;
+  public:
+  void clear_update_baseline();
+  bool update_baseline() const;
+  void set_update_baseline(bool value);
+  private:
+  bool _internal_update_baseline() const;
+  void _internal_set_update_baseline(bool value);
+  public:
+
+  // optional bool pending_full_frame = 8;
+  bool has_pending_full_frame() const;
+  private:
+  bool _internal_has_pending_full_frame() const;
+  public:
+  void clear_pending_full_frame();
+  bool pending_full_frame() const;
+  void set_pending_full_frame(bool value);
+  private:
+  bool _internal_pending_full_frame() const;
+  void _internal_set_pending_full_frame(bool value);
+  public:
+
+  // optional int32 delta_from = 6;
+  bool has_delta_from() const;
+  private:
+  bool _internal_has_delta_from() const;
+  public:
+  void clear_delta_from();
+  int32_t delta_from() const;
+  void set_delta_from(int32_t value);
+  private:
+  int32_t _internal_delta_from() const;
+  void _internal_set_delta_from(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_PacketEntities)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entity_data_;
+    int32_t max_entries_;
+    int32_t updated_entries_;
+    int32_t baseline_;
+    bool is_delta_;
+    bool update_baseline_;
+    bool pending_full_frame_;
+    int32_t delta_from_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_TempEntities final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_TempEntities) */ {
+ public:
+  inline CSVCMsg_TempEntities() : CSVCMsg_TempEntities(nullptr) {}
+  ~CSVCMsg_TempEntities() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_TempEntities(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_TempEntities(const CSVCMsg_TempEntities& from);
+  CSVCMsg_TempEntities(CSVCMsg_TempEntities&& from) noexcept
+    : CSVCMsg_TempEntities() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_TempEntities& operator=(const CSVCMsg_TempEntities& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_TempEntities& operator=(CSVCMsg_TempEntities&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_TempEntities& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_TempEntities* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_TempEntities*>(
+               &_CSVCMsg_TempEntities_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(CSVCMsg_TempEntities& a, CSVCMsg_TempEntities& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_TempEntities* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_TempEntities* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_TempEntities* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_TempEntities>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_TempEntities& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_TempEntities& from) {
+    CSVCMsg_TempEntities::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_TempEntities* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_TempEntities";
+  }
+  protected:
+  explicit CSVCMsg_TempEntities(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntityDataFieldNumber = 3,
+    kReliableFieldNumber = 1,
+    kNumEntriesFieldNumber = 2,
+  };
+  // optional bytes entity_data = 3;
+  bool has_entity_data() const;
+  private:
+  bool _internal_has_entity_data() const;
+  public:
+  void clear_entity_data();
+  const std::string& entity_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entity_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_entity_data();
+  PROTOBUF_NODISCARD std::string* release_entity_data();
+  void set_allocated_entity_data(std::string* entity_data);
+  private:
+  const std::string& _internal_entity_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entity_data(const std::string& value);
+  std::string* _internal_mutable_entity_data();
+  public:
+
+  // optional bool reliable = 1;
+  bool has_reliable() const;
+  private:
+  bool _internal_has_reliable() const;
+  public:
+  void clear_reliable();
+  bool reliable() const;
+  void set_reliable(bool value);
+  private:
+  bool _internal_reliable() const;
+  void _internal_set_reliable(bool value);
+  public:
+
+  // optional int32 num_entries = 2;
+  bool has_num_entries() const;
+  private:
+  bool _internal_has_num_entries() const;
+  public:
+  void clear_num_entries();
+  int32_t num_entries() const;
+  void set_num_entries(int32_t value);
+  private:
+  int32_t _internal_num_entries() const;
+  void _internal_set_num_entries(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_TempEntities)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entity_data_;
+    bool reliable_;
+    int32_t num_entries_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_CreateStringTable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_CreateStringTable) */ {
+ public:
+  inline CSVCMsg_CreateStringTable() : CSVCMsg_CreateStringTable(nullptr) {}
+  ~CSVCMsg_CreateStringTable() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_CreateStringTable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_CreateStringTable(const CSVCMsg_CreateStringTable& from);
+  CSVCMsg_CreateStringTable(CSVCMsg_CreateStringTable&& from) noexcept
+    : CSVCMsg_CreateStringTable() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_CreateStringTable& operator=(const CSVCMsg_CreateStringTable& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_CreateStringTable& operator=(CSVCMsg_CreateStringTable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_CreateStringTable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_CreateStringTable* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_CreateStringTable*>(
+               &_CSVCMsg_CreateStringTable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(CSVCMsg_CreateStringTable& a, CSVCMsg_CreateStringTable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_CreateStringTable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_CreateStringTable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_CreateStringTable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_CreateStringTable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_CreateStringTable& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_CreateStringTable& from) {
+    CSVCMsg_CreateStringTable::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_CreateStringTable* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_CreateStringTable";
+  }
+  protected:
+  explicit CSVCMsg_CreateStringTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kStringDataFieldNumber = 8,
+    kMaxEntriesFieldNumber = 2,
+    kNumEntriesFieldNumber = 3,
+    kUserDataFixedSizeFieldNumber = 4,
+    kUserDataSizeFieldNumber = 5,
+    kUserDataSizeBitsFieldNumber = 6,
+    kFlagsFieldNumber = 7,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional bytes string_data = 8;
+  bool has_string_data() const;
+  private:
+  bool _internal_has_string_data() const;
+  public:
+  void clear_string_data();
+  const std::string& string_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_string_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_string_data();
+  PROTOBUF_NODISCARD std::string* release_string_data();
+  void set_allocated_string_data(std::string* string_data);
+  private:
+  const std::string& _internal_string_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string_data(const std::string& value);
+  std::string* _internal_mutable_string_data();
+  public:
+
+  // optional int32 max_entries = 2;
+  bool has_max_entries() const;
+  private:
+  bool _internal_has_max_entries() const;
+  public:
+  void clear_max_entries();
+  int32_t max_entries() const;
+  void set_max_entries(int32_t value);
+  private:
+  int32_t _internal_max_entries() const;
+  void _internal_set_max_entries(int32_t value);
+  public:
+
+  // optional int32 num_entries = 3;
+  bool has_num_entries() const;
+  private:
+  bool _internal_has_num_entries() const;
+  public:
+  void clear_num_entries();
+  int32_t num_entries() const;
+  void set_num_entries(int32_t value);
+  private:
+  int32_t _internal_num_entries() const;
+  void _internal_set_num_entries(int32_t value);
+  public:
+
+  // optional bool user_data_fixed_size = 4;
+  bool has_user_data_fixed_size() const;
+  private:
+  bool _internal_has_user_data_fixed_size() const;
+  public:
+  void clear_user_data_fixed_size();
+  bool user_data_fixed_size() const;
+  void set_user_data_fixed_size(bool value);
+  private:
+  bool _internal_user_data_fixed_size() const;
+  void _internal_set_user_data_fixed_size(bool value);
+  public:
+
+  // optional int32 user_data_size = 5;
+  bool has_user_data_size() const;
+  private:
+  bool _internal_has_user_data_size() const;
+  public:
+  void clear_user_data_size();
+  int32_t user_data_size() const;
+  void set_user_data_size(int32_t value);
+  private:
+  int32_t _internal_user_data_size() const;
+  void _internal_set_user_data_size(int32_t value);
+  public:
+
+  // optional int32 user_data_size_bits = 6;
+  bool has_user_data_size_bits() const;
+  private:
+  bool _internal_has_user_data_size_bits() const;
+  public:
+  void clear_user_data_size_bits();
+  int32_t user_data_size_bits() const;
+  void set_user_data_size_bits(int32_t value);
+  private:
+  int32_t _internal_user_data_size_bits() const;
+  void _internal_set_user_data_size_bits(int32_t value);
+  public:
+
+  // optional int32 flags = 7;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  int32_t flags() const;
+  void set_flags(int32_t value);
+  private:
+  int32_t _internal_flags() const;
+  void _internal_set_flags(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_CreateStringTable)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_data_;
+    int32_t max_entries_;
+    int32_t num_entries_;
+    bool user_data_fixed_size_;
+    int32_t user_data_size_;
+    int32_t user_data_size_bits_;
+    int32_t flags_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_UpdateStringTable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_UpdateStringTable) */ {
+ public:
+  inline CSVCMsg_UpdateStringTable() : CSVCMsg_UpdateStringTable(nullptr) {}
+  ~CSVCMsg_UpdateStringTable() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_UpdateStringTable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_UpdateStringTable(const CSVCMsg_UpdateStringTable& from);
+  CSVCMsg_UpdateStringTable(CSVCMsg_UpdateStringTable&& from) noexcept
+    : CSVCMsg_UpdateStringTable() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_UpdateStringTable& operator=(const CSVCMsg_UpdateStringTable& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_UpdateStringTable& operator=(CSVCMsg_UpdateStringTable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_UpdateStringTable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_UpdateStringTable* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_UpdateStringTable*>(
+               &_CSVCMsg_UpdateStringTable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(CSVCMsg_UpdateStringTable& a, CSVCMsg_UpdateStringTable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_UpdateStringTable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_UpdateStringTable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_UpdateStringTable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_UpdateStringTable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_UpdateStringTable& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_UpdateStringTable& from) {
+    CSVCMsg_UpdateStringTable::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_UpdateStringTable* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_UpdateStringTable";
+  }
+  protected:
+  explicit CSVCMsg_UpdateStringTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStringDataFieldNumber = 3,
+    kTableIdFieldNumber = 1,
+    kNumChangedEntriesFieldNumber = 2,
+  };
+  // optional bytes string_data = 3;
+  bool has_string_data() const;
+  private:
+  bool _internal_has_string_data() const;
+  public:
+  void clear_string_data();
+  const std::string& string_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_string_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_string_data();
+  PROTOBUF_NODISCARD std::string* release_string_data();
+  void set_allocated_string_data(std::string* string_data);
+  private:
+  const std::string& _internal_string_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string_data(const std::string& value);
+  std::string* _internal_mutable_string_data();
+  public:
+
+  // optional int32 table_id = 1;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  int32_t table_id() const;
+  void set_table_id(int32_t value);
+  private:
+  int32_t _internal_table_id() const;
+  void _internal_set_table_id(int32_t value);
+  public:
+
+  // optional int32 num_changed_entries = 2;
+  bool has_num_changed_entries() const;
+  private:
+  bool _internal_has_num_changed_entries() const;
+  public:
+  void clear_num_changed_entries();
+  int32_t num_changed_entries() const;
+  void set_num_changed_entries(int32_t value);
+  private:
+  int32_t _internal_num_changed_entries() const;
+  void _internal_set_num_changed_entries(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_UpdateStringTable)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_data_;
+    int32_t table_id_;
+    int32_t num_changed_entries_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_VoiceData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_VoiceData) */ {
+ public:
+  inline CSVCMsg_VoiceData() : CSVCMsg_VoiceData(nullptr) {}
+  ~CSVCMsg_VoiceData() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_VoiceData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_VoiceData(const CSVCMsg_VoiceData& from);
+  CSVCMsg_VoiceData(CSVCMsg_VoiceData&& from) noexcept
+    : CSVCMsg_VoiceData() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_VoiceData& operator=(const CSVCMsg_VoiceData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_VoiceData& operator=(CSVCMsg_VoiceData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_VoiceData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_VoiceData* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_VoiceData*>(
+               &_CSVCMsg_VoiceData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(CSVCMsg_VoiceData& a, CSVCMsg_VoiceData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_VoiceData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_VoiceData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_VoiceData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_VoiceData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_VoiceData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_VoiceData& from) {
+    CSVCMsg_VoiceData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_VoiceData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_VoiceData";
+  }
+  protected:
+  explicit CSVCMsg_VoiceData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVoiceDataFieldNumber = 5,
+    kClientFieldNumber = 1,
+    kProximityFieldNumber = 2,
+    kXuidFieldNumber = 3,
+    kAudibleMaskFieldNumber = 4,
+    kFormatFieldNumber = 6,
+    kSequenceBytesFieldNumber = 7,
+    kSectionNumberFieldNumber = 8,
+    kUncompressedSampleOffsetFieldNumber = 9,
+    kTickFieldNumber = 10,
+  };
+  // optional bytes voice_data = 5;
+  bool has_voice_data() const;
+  private:
+  bool _internal_has_voice_data() const;
+  public:
+  void clear_voice_data();
+  const std::string& voice_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_voice_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_voice_data();
+  PROTOBUF_NODISCARD std::string* release_voice_data();
+  void set_allocated_voice_data(std::string* voice_data);
+  private:
+  const std::string& _internal_voice_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_voice_data(const std::string& value);
+  std::string* _internal_mutable_voice_data();
+  public:
+
+  // optional int32 client = 1;
+  bool has_client() const;
+  private:
+  bool _internal_has_client() const;
+  public:
+  void clear_client();
+  int32_t client() const;
+  void set_client(int32_t value);
+  private:
+  int32_t _internal_client() const;
+  void _internal_set_client(int32_t value);
+  public:
+
+  // optional bool proximity = 2;
+  bool has_proximity() const;
+  private:
+  bool _internal_has_proximity() const;
+  public:
+  void clear_proximity();
+  bool proximity() const;
+  void set_proximity(bool value);
+  private:
+  bool _internal_proximity() const;
+  void _internal_set_proximity(bool value);
+  public:
+
+  // optional fixed64 xuid = 3;
+  bool has_xuid() const;
+  private:
+  bool _internal_has_xuid() const;
+  public:
+  void clear_xuid();
+  uint64_t xuid() const;
+  void set_xuid(uint64_t value);
+  private:
+  uint64_t _internal_xuid() const;
+  void _internal_set_xuid(uint64_t value);
+  public:
+
+  // optional int32 audible_mask = 4;
+  bool has_audible_mask() const;
+  private:
+  bool _internal_has_audible_mask() const;
+  public:
+  void clear_audible_mask();
+  int32_t audible_mask() const;
+  void set_audible_mask(int32_t value);
+  private:
+  int32_t _internal_audible_mask() const;
+  void _internal_set_audible_mask(int32_t value);
+  public:
+
+  // optional .VoiceDataFormat_t format = 6 [default = VOICEDATA_FORMAT_STEAM];
+  bool has_format() const;
+  private:
+  bool _internal_has_format() const;
+  public:
+  void clear_format();
+  ::VoiceDataFormat_t format() const;
+  void set_format(::VoiceDataFormat_t value);
+  private:
+  ::VoiceDataFormat_t _internal_format() const;
+  void _internal_set_format(::VoiceDataFormat_t value);
+  public:
+
+  // optional int32 sequence_bytes = 7;
+  bool has_sequence_bytes() const;
+  private:
+  bool _internal_has_sequence_bytes() const;
+  public:
+  void clear_sequence_bytes();
+  int32_t sequence_bytes() const;
+  void set_sequence_bytes(int32_t value);
+  private:
+  int32_t _internal_sequence_bytes() const;
+  void _internal_set_sequence_bytes(int32_t value);
+  public:
+
+  // optional uint32 section_number = 8;
+  bool has_section_number() const;
+  private:
+  bool _internal_has_section_number() const;
+  public:
+  void clear_section_number();
+  uint32_t section_number() const;
+  void set_section_number(uint32_t value);
+  private:
+  uint32_t _internal_section_number() const;
+  void _internal_set_section_number(uint32_t value);
+  public:
+
+  // optional uint32 uncompressed_sample_offset = 9;
+  bool has_uncompressed_sample_offset() const;
+  private:
+  bool _internal_has_uncompressed_sample_offset() const;
+  public:
+  void clear_uncompressed_sample_offset();
+  uint32_t uncompressed_sample_offset() const;
+  void set_uncompressed_sample_offset(uint32_t value);
+  private:
+  uint32_t _internal_uncompressed_sample_offset() const;
+  void _internal_set_uncompressed_sample_offset(uint32_t value);
+  public:
+
+  // optional uint32 tick = 10;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  uint32_t tick() const;
+  void set_tick(uint32_t value);
+  private:
+  uint32_t _internal_tick() const;
+  void _internal_set_tick(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_VoiceData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr voice_data_;
+    int32_t client_;
+    bool proximity_;
+    uint64_t xuid_;
+    int32_t audible_mask_;
+    int format_;
+    int32_t sequence_bytes_;
+    uint32_t section_number_;
+    uint32_t uncompressed_sample_offset_;
+    uint32_t tick_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_PacketReliable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_PacketReliable) */ {
+ public:
+  inline CSVCMsg_PacketReliable() : CSVCMsg_PacketReliable(nullptr) {}
+  ~CSVCMsg_PacketReliable() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_PacketReliable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_PacketReliable(const CSVCMsg_PacketReliable& from);
+  CSVCMsg_PacketReliable(CSVCMsg_PacketReliable&& from) noexcept
+    : CSVCMsg_PacketReliable() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_PacketReliable& operator=(const CSVCMsg_PacketReliable& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_PacketReliable& operator=(CSVCMsg_PacketReliable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_PacketReliable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_PacketReliable* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_PacketReliable*>(
+               &_CSVCMsg_PacketReliable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(CSVCMsg_PacketReliable& a, CSVCMsg_PacketReliable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_PacketReliable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_PacketReliable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_PacketReliable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_PacketReliable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_PacketReliable& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_PacketReliable& from) {
+    CSVCMsg_PacketReliable::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_PacketReliable* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_PacketReliable";
+  }
+  protected:
+  explicit CSVCMsg_PacketReliable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTickFieldNumber = 1,
+    kMessagessizeFieldNumber = 2,
+  };
+  // optional int32 tick = 1;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  int32_t tick() const;
+  void set_tick(int32_t value);
+  private:
+  int32_t _internal_tick() const;
+  void _internal_set_tick(int32_t value);
+  public:
+
+  // optional int32 messagessize = 2;
+  bool has_messagessize() const;
+  private:
+  bool _internal_has_messagessize() const;
+  public:
+  void clear_messagessize();
+  int32_t messagessize() const;
+  void set_messagessize(int32_t value);
+  private:
+  int32_t _internal_messagessize() const;
+  void _internal_set_messagessize(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_PacketReliable)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t tick_;
+    int32_t messagessize_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_FullFrameSplit final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_FullFrameSplit) */ {
+ public:
+  inline CSVCMsg_FullFrameSplit() : CSVCMsg_FullFrameSplit(nullptr) {}
+  ~CSVCMsg_FullFrameSplit() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_FullFrameSplit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_FullFrameSplit(const CSVCMsg_FullFrameSplit& from);
+  CSVCMsg_FullFrameSplit(CSVCMsg_FullFrameSplit&& from) noexcept
+    : CSVCMsg_FullFrameSplit() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_FullFrameSplit& operator=(const CSVCMsg_FullFrameSplit& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_FullFrameSplit& operator=(CSVCMsg_FullFrameSplit&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_FullFrameSplit& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_FullFrameSplit* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_FullFrameSplit*>(
+               &_CSVCMsg_FullFrameSplit_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(CSVCMsg_FullFrameSplit& a, CSVCMsg_FullFrameSplit& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_FullFrameSplit* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_FullFrameSplit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_FullFrameSplit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_FullFrameSplit>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_FullFrameSplit& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_FullFrameSplit& from) {
+    CSVCMsg_FullFrameSplit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_FullFrameSplit* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_FullFrameSplit";
+  }
+  protected:
+  explicit CSVCMsg_FullFrameSplit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 4,
+    kTickFieldNumber = 1,
+    kSectionFieldNumber = 2,
+    kTotalFieldNumber = 3,
+  };
+  // optional bytes data = 4;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // optional int32 tick = 1;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  int32_t tick() const;
+  void set_tick(int32_t value);
+  private:
+  int32_t _internal_tick() const;
+  void _internal_set_tick(int32_t value);
+  public:
+
+  // optional int32 section = 2;
+  bool has_section() const;
+  private:
+  bool _internal_has_section() const;
+  public:
+  void clear_section();
+  int32_t section() const;
+  void set_section(int32_t value);
+  private:
+  int32_t _internal_section() const;
+  void _internal_set_section(int32_t value);
+  public:
+
+  // optional int32 total = 3;
+  bool has_total() const;
+  private:
+  bool _internal_has_total() const;
+  public:
+  void clear_total();
+  int32_t total() const;
+  void set_total(int32_t value);
+  private:
+  int32_t _internal_total() const;
+  void _internal_set_total(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_FullFrameSplit)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int32_t tick_;
+    int32_t section_;
+    int32_t total_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_netmessages_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CCLCMsg_ClientInfo
+
+// optional fixed32 send_table_crc = 1;
+inline bool CCLCMsg_ClientInfo::_internal_has_send_table_crc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CCLCMsg_ClientInfo::has_send_table_crc() const {
+  return _internal_has_send_table_crc();
+}
+inline void CCLCMsg_ClientInfo::clear_send_table_crc() {
+  _impl_.send_table_crc_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CCLCMsg_ClientInfo::_internal_send_table_crc() const {
+  return _impl_.send_table_crc_;
+}
+inline uint32_t CCLCMsg_ClientInfo::send_table_crc() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ClientInfo.send_table_crc)
+  return _internal_send_table_crc();
+}
+inline void CCLCMsg_ClientInfo::_internal_set_send_table_crc(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.send_table_crc_ = value;
+}
+inline void CCLCMsg_ClientInfo::set_send_table_crc(uint32_t value) {
+  _internal_set_send_table_crc(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_ClientInfo.send_table_crc)
+}
+
+// optional uint32 server_count = 2;
+inline bool CCLCMsg_ClientInfo::_internal_has_server_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CCLCMsg_ClientInfo::has_server_count() const {
+  return _internal_has_server_count();
+}
+inline void CCLCMsg_ClientInfo::clear_server_count() {
+  _impl_.server_count_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CCLCMsg_ClientInfo::_internal_server_count() const {
+  return _impl_.server_count_;
+}
+inline uint32_t CCLCMsg_ClientInfo::server_count() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ClientInfo.server_count)
+  return _internal_server_count();
+}
+inline void CCLCMsg_ClientInfo::_internal_set_server_count(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.server_count_ = value;
+}
+inline void CCLCMsg_ClientInfo::set_server_count(uint32_t value) {
+  _internal_set_server_count(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_ClientInfo.server_count)
+}
+
+// optional bool is_hltv = 3;
+inline bool CCLCMsg_ClientInfo::_internal_has_is_hltv() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CCLCMsg_ClientInfo::has_is_hltv() const {
+  return _internal_has_is_hltv();
+}
+inline void CCLCMsg_ClientInfo::clear_is_hltv() {
+  _impl_.is_hltv_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool CCLCMsg_ClientInfo::_internal_is_hltv() const {
+  return _impl_.is_hltv_;
+}
+inline bool CCLCMsg_ClientInfo::is_hltv() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ClientInfo.is_hltv)
+  return _internal_is_hltv();
+}
+inline void CCLCMsg_ClientInfo::_internal_set_is_hltv(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.is_hltv_ = value;
+}
+inline void CCLCMsg_ClientInfo::set_is_hltv(bool value) {
+  _internal_set_is_hltv(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_ClientInfo.is_hltv)
+}
+
+// optional bool is_replay = 4;
+inline bool CCLCMsg_ClientInfo::_internal_has_is_replay() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CCLCMsg_ClientInfo::has_is_replay() const {
+  return _internal_has_is_replay();
+}
+inline void CCLCMsg_ClientInfo::clear_is_replay() {
+  _impl_.is_replay_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool CCLCMsg_ClientInfo::_internal_is_replay() const {
+  return _impl_.is_replay_;
+}
+inline bool CCLCMsg_ClientInfo::is_replay() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ClientInfo.is_replay)
+  return _internal_is_replay();
+}
+inline void CCLCMsg_ClientInfo::_internal_set_is_replay(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.is_replay_ = value;
+}
+inline void CCLCMsg_ClientInfo::set_is_replay(bool value) {
+  _internal_set_is_replay(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_ClientInfo.is_replay)
+}
+
+// optional uint32 friends_id = 5;
+inline bool CCLCMsg_ClientInfo::_internal_has_friends_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CCLCMsg_ClientInfo::has_friends_id() const {
+  return _internal_has_friends_id();
+}
+inline void CCLCMsg_ClientInfo::clear_friends_id() {
+  _impl_.friends_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t CCLCMsg_ClientInfo::_internal_friends_id() const {
+  return _impl_.friends_id_;
+}
+inline uint32_t CCLCMsg_ClientInfo::friends_id() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ClientInfo.friends_id)
+  return _internal_friends_id();
+}
+inline void CCLCMsg_ClientInfo::_internal_set_friends_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.friends_id_ = value;
+}
+inline void CCLCMsg_ClientInfo::set_friends_id(uint32_t value) {
+  _internal_set_friends_id(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_ClientInfo.friends_id)
+}
+
+// optional string friends_name = 6;
+inline bool CCLCMsg_ClientInfo::_internal_has_friends_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CCLCMsg_ClientInfo::has_friends_name() const {
+  return _internal_has_friends_name();
+}
+inline void CCLCMsg_ClientInfo::clear_friends_name() {
+  _impl_.friends_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CCLCMsg_ClientInfo::friends_name() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ClientInfo.friends_name)
+  return _internal_friends_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CCLCMsg_ClientInfo::set_friends_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.friends_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CCLCMsg_ClientInfo.friends_name)
+}
+inline std::string* CCLCMsg_ClientInfo::mutable_friends_name() {
+  std::string* _s = _internal_mutable_friends_name();
+  // @@protoc_insertion_point(field_mutable:CCLCMsg_ClientInfo.friends_name)
+  return _s;
+}
+inline const std::string& CCLCMsg_ClientInfo::_internal_friends_name() const {
+  return _impl_.friends_name_.Get();
+}
+inline void CCLCMsg_ClientInfo::_internal_set_friends_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.friends_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_ClientInfo::_internal_mutable_friends_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.friends_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_ClientInfo::release_friends_name() {
+  // @@protoc_insertion_point(field_release:CCLCMsg_ClientInfo.friends_name)
+  if (!_internal_has_friends_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.friends_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.friends_name_.IsDefault()) {
+    _impl_.friends_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CCLCMsg_ClientInfo::set_allocated_friends_name(std::string* friends_name) {
+  if (friends_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.friends_name_.SetAllocated(friends_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.friends_name_.IsDefault()) {
+    _impl_.friends_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CCLCMsg_ClientInfo.friends_name)
+}
+
+// repeated fixed32 custom_files = 7;
+inline int CCLCMsg_ClientInfo::_internal_custom_files_size() const {
+  return _impl_.custom_files_.size();
+}
+inline int CCLCMsg_ClientInfo::custom_files_size() const {
+  return _internal_custom_files_size();
+}
+inline void CCLCMsg_ClientInfo::clear_custom_files() {
+  _impl_.custom_files_.Clear();
+}
+inline uint32_t CCLCMsg_ClientInfo::_internal_custom_files(int index) const {
+  return _impl_.custom_files_.Get(index);
+}
+inline uint32_t CCLCMsg_ClientInfo::custom_files(int index) const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ClientInfo.custom_files)
+  return _internal_custom_files(index);
+}
+inline void CCLCMsg_ClientInfo::set_custom_files(int index, uint32_t value) {
+  _impl_.custom_files_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_ClientInfo.custom_files)
+}
+inline void CCLCMsg_ClientInfo::_internal_add_custom_files(uint32_t value) {
+  _impl_.custom_files_.Add(value);
+}
+inline void CCLCMsg_ClientInfo::add_custom_files(uint32_t value) {
+  _internal_add_custom_files(value);
+  // @@protoc_insertion_point(field_add:CCLCMsg_ClientInfo.custom_files)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CCLCMsg_ClientInfo::_internal_custom_files() const {
+  return _impl_.custom_files_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CCLCMsg_ClientInfo::custom_files() const {
+  // @@protoc_insertion_point(field_list:CCLCMsg_ClientInfo.custom_files)
+  return _internal_custom_files();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CCLCMsg_ClientInfo::_internal_mutable_custom_files() {
+  return &_impl_.custom_files_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CCLCMsg_ClientInfo::mutable_custom_files() {
+  // @@protoc_insertion_point(field_mutable_list:CCLCMsg_ClientInfo.custom_files)
+  return _internal_mutable_custom_files();
+}
+
+// -------------------------------------------------------------------
+
+// CCLCMsg_Move
+
+// optional uint32 num_backup_commands = 1;
+inline bool CCLCMsg_Move::_internal_has_num_backup_commands() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CCLCMsg_Move::has_num_backup_commands() const {
+  return _internal_has_num_backup_commands();
+}
+inline void CCLCMsg_Move::clear_num_backup_commands() {
+  _impl_.num_backup_commands_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CCLCMsg_Move::_internal_num_backup_commands() const {
+  return _impl_.num_backup_commands_;
+}
+inline uint32_t CCLCMsg_Move::num_backup_commands() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_Move.num_backup_commands)
+  return _internal_num_backup_commands();
+}
+inline void CCLCMsg_Move::_internal_set_num_backup_commands(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_backup_commands_ = value;
+}
+inline void CCLCMsg_Move::set_num_backup_commands(uint32_t value) {
+  _internal_set_num_backup_commands(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_Move.num_backup_commands)
+}
+
+// optional uint32 num_new_commands = 2;
+inline bool CCLCMsg_Move::_internal_has_num_new_commands() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CCLCMsg_Move::has_num_new_commands() const {
+  return _internal_has_num_new_commands();
+}
+inline void CCLCMsg_Move::clear_num_new_commands() {
+  _impl_.num_new_commands_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CCLCMsg_Move::_internal_num_new_commands() const {
+  return _impl_.num_new_commands_;
+}
+inline uint32_t CCLCMsg_Move::num_new_commands() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_Move.num_new_commands)
+  return _internal_num_new_commands();
+}
+inline void CCLCMsg_Move::_internal_set_num_new_commands(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.num_new_commands_ = value;
+}
+inline void CCLCMsg_Move::set_num_new_commands(uint32_t value) {
+  _internal_set_num_new_commands(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_Move.num_new_commands)
+}
+
+// optional bytes data = 3;
+inline bool CCLCMsg_Move::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CCLCMsg_Move::has_data() const {
+  return _internal_has_data();
+}
+inline void CCLCMsg_Move::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CCLCMsg_Move::data() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_Move.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CCLCMsg_Move::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CCLCMsg_Move.data)
+}
+inline std::string* CCLCMsg_Move::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:CCLCMsg_Move.data)
+  return _s;
+}
+inline const std::string& CCLCMsg_Move::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void CCLCMsg_Move::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_Move::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_Move::release_data() {
+  // @@protoc_insertion_point(field_release:CCLCMsg_Move.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CCLCMsg_Move::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CCLCMsg_Move.data)
+}
+
+// -------------------------------------------------------------------
+
+// CCLCMsg_VoiceData
+
+// optional bytes data = 1;
+inline bool CCLCMsg_VoiceData::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CCLCMsg_VoiceData::has_data() const {
+  return _internal_has_data();
+}
+inline void CCLCMsg_VoiceData::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CCLCMsg_VoiceData::data() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_VoiceData.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CCLCMsg_VoiceData::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CCLCMsg_VoiceData.data)
+}
+inline std::string* CCLCMsg_VoiceData::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:CCLCMsg_VoiceData.data)
+  return _s;
+}
+inline const std::string& CCLCMsg_VoiceData::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void CCLCMsg_VoiceData::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_VoiceData::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_VoiceData::release_data() {
+  // @@protoc_insertion_point(field_release:CCLCMsg_VoiceData.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CCLCMsg_VoiceData::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CCLCMsg_VoiceData.data)
+}
+
+// optional fixed64 xuid = 2;
+inline bool CCLCMsg_VoiceData::_internal_has_xuid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CCLCMsg_VoiceData::has_xuid() const {
+  return _internal_has_xuid();
+}
+inline void CCLCMsg_VoiceData::clear_xuid() {
+  _impl_.xuid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CCLCMsg_VoiceData::_internal_xuid() const {
+  return _impl_.xuid_;
+}
+inline uint64_t CCLCMsg_VoiceData::xuid() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_VoiceData.xuid)
+  return _internal_xuid();
+}
+inline void CCLCMsg_VoiceData::_internal_set_xuid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.xuid_ = value;
+}
+inline void CCLCMsg_VoiceData::set_xuid(uint64_t value) {
+  _internal_set_xuid(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_VoiceData.xuid)
+}
+
+// optional .VoiceDataFormat_t format = 3 [default = VOICEDATA_FORMAT_STEAM];
+inline bool CCLCMsg_VoiceData::_internal_has_format() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CCLCMsg_VoiceData::has_format() const {
+  return _internal_has_format();
+}
+inline void CCLCMsg_VoiceData::clear_format() {
+  _impl_.format_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::VoiceDataFormat_t CCLCMsg_VoiceData::_internal_format() const {
+  return static_cast< ::VoiceDataFormat_t >(_impl_.format_);
+}
+inline ::VoiceDataFormat_t CCLCMsg_VoiceData::format() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_VoiceData.format)
+  return _internal_format();
+}
+inline void CCLCMsg_VoiceData::_internal_set_format(::VoiceDataFormat_t value) {
+  assert(::VoiceDataFormat_t_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.format_ = value;
+}
+inline void CCLCMsg_VoiceData::set_format(::VoiceDataFormat_t value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_VoiceData.format)
+}
+
+// optional int32 sequence_bytes = 4;
+inline bool CCLCMsg_VoiceData::_internal_has_sequence_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CCLCMsg_VoiceData::has_sequence_bytes() const {
+  return _internal_has_sequence_bytes();
+}
+inline void CCLCMsg_VoiceData::clear_sequence_bytes() {
+  _impl_.sequence_bytes_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CCLCMsg_VoiceData::_internal_sequence_bytes() const {
+  return _impl_.sequence_bytes_;
+}
+inline int32_t CCLCMsg_VoiceData::sequence_bytes() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_VoiceData.sequence_bytes)
+  return _internal_sequence_bytes();
+}
+inline void CCLCMsg_VoiceData::_internal_set_sequence_bytes(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.sequence_bytes_ = value;
+}
+inline void CCLCMsg_VoiceData::set_sequence_bytes(int32_t value) {
+  _internal_set_sequence_bytes(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_VoiceData.sequence_bytes)
+}
+
+// optional uint32 section_number = 5;
+inline bool CCLCMsg_VoiceData::_internal_has_section_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CCLCMsg_VoiceData::has_section_number() const {
+  return _internal_has_section_number();
+}
+inline void CCLCMsg_VoiceData::clear_section_number() {
+  _impl_.section_number_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t CCLCMsg_VoiceData::_internal_section_number() const {
+  return _impl_.section_number_;
+}
+inline uint32_t CCLCMsg_VoiceData::section_number() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_VoiceData.section_number)
+  return _internal_section_number();
+}
+inline void CCLCMsg_VoiceData::_internal_set_section_number(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.section_number_ = value;
+}
+inline void CCLCMsg_VoiceData::set_section_number(uint32_t value) {
+  _internal_set_section_number(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_VoiceData.section_number)
+}
+
+// optional uint32 uncompressed_sample_offset = 6;
+inline bool CCLCMsg_VoiceData::_internal_has_uncompressed_sample_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CCLCMsg_VoiceData::has_uncompressed_sample_offset() const {
+  return _internal_has_uncompressed_sample_offset();
+}
+inline void CCLCMsg_VoiceData::clear_uncompressed_sample_offset() {
+  _impl_.uncompressed_sample_offset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t CCLCMsg_VoiceData::_internal_uncompressed_sample_offset() const {
+  return _impl_.uncompressed_sample_offset_;
+}
+inline uint32_t CCLCMsg_VoiceData::uncompressed_sample_offset() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_VoiceData.uncompressed_sample_offset)
+  return _internal_uncompressed_sample_offset();
+}
+inline void CCLCMsg_VoiceData::_internal_set_uncompressed_sample_offset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.uncompressed_sample_offset_ = value;
+}
+inline void CCLCMsg_VoiceData::set_uncompressed_sample_offset(uint32_t value) {
+  _internal_set_uncompressed_sample_offset(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_VoiceData.uncompressed_sample_offset)
+}
+
+// optional uint32 tick = 7;
+inline bool CCLCMsg_VoiceData::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CCLCMsg_VoiceData::has_tick() const {
+  return _internal_has_tick();
+}
+inline void CCLCMsg_VoiceData::clear_tick() {
+  _impl_.tick_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t CCLCMsg_VoiceData::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline uint32_t CCLCMsg_VoiceData::tick() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_VoiceData.tick)
+  return _internal_tick();
+}
+inline void CCLCMsg_VoiceData::_internal_set_tick(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.tick_ = value;
+}
+inline void CCLCMsg_VoiceData::set_tick(uint32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_VoiceData.tick)
+}
+
+// -------------------------------------------------------------------
+
+// CCLCMsg_BaselineAck
+
+// optional int32 baseline_tick = 1;
+inline bool CCLCMsg_BaselineAck::_internal_has_baseline_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CCLCMsg_BaselineAck::has_baseline_tick() const {
+  return _internal_has_baseline_tick();
+}
+inline void CCLCMsg_BaselineAck::clear_baseline_tick() {
+  _impl_.baseline_tick_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CCLCMsg_BaselineAck::_internal_baseline_tick() const {
+  return _impl_.baseline_tick_;
+}
+inline int32_t CCLCMsg_BaselineAck::baseline_tick() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_BaselineAck.baseline_tick)
+  return _internal_baseline_tick();
+}
+inline void CCLCMsg_BaselineAck::_internal_set_baseline_tick(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.baseline_tick_ = value;
+}
+inline void CCLCMsg_BaselineAck::set_baseline_tick(int32_t value) {
+  _internal_set_baseline_tick(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_BaselineAck.baseline_tick)
+}
+
+// optional int32 baseline_nr = 2;
+inline bool CCLCMsg_BaselineAck::_internal_has_baseline_nr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CCLCMsg_BaselineAck::has_baseline_nr() const {
+  return _internal_has_baseline_nr();
+}
+inline void CCLCMsg_BaselineAck::clear_baseline_nr() {
+  _impl_.baseline_nr_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CCLCMsg_BaselineAck::_internal_baseline_nr() const {
+  return _impl_.baseline_nr_;
+}
+inline int32_t CCLCMsg_BaselineAck::baseline_nr() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_BaselineAck.baseline_nr)
+  return _internal_baseline_nr();
+}
+inline void CCLCMsg_BaselineAck::_internal_set_baseline_nr(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.baseline_nr_ = value;
+}
+inline void CCLCMsg_BaselineAck::set_baseline_nr(int32_t value) {
+  _internal_set_baseline_nr(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_BaselineAck.baseline_nr)
+}
+
+// -------------------------------------------------------------------
+
+// CCLCMsg_ListenEvents
+
+// repeated fixed32 event_mask = 1;
+inline int CCLCMsg_ListenEvents::_internal_event_mask_size() const {
+  return _impl_.event_mask_.size();
+}
+inline int CCLCMsg_ListenEvents::event_mask_size() const {
+  return _internal_event_mask_size();
+}
+inline void CCLCMsg_ListenEvents::clear_event_mask() {
+  _impl_.event_mask_.Clear();
+}
+inline uint32_t CCLCMsg_ListenEvents::_internal_event_mask(int index) const {
+  return _impl_.event_mask_.Get(index);
+}
+inline uint32_t CCLCMsg_ListenEvents::event_mask(int index) const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ListenEvents.event_mask)
+  return _internal_event_mask(index);
+}
+inline void CCLCMsg_ListenEvents::set_event_mask(int index, uint32_t value) {
+  _impl_.event_mask_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_ListenEvents.event_mask)
+}
+inline void CCLCMsg_ListenEvents::_internal_add_event_mask(uint32_t value) {
+  _impl_.event_mask_.Add(value);
+}
+inline void CCLCMsg_ListenEvents::add_event_mask(uint32_t value) {
+  _internal_add_event_mask(value);
+  // @@protoc_insertion_point(field_add:CCLCMsg_ListenEvents.event_mask)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CCLCMsg_ListenEvents::_internal_event_mask() const {
+  return _impl_.event_mask_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CCLCMsg_ListenEvents::event_mask() const {
+  // @@protoc_insertion_point(field_list:CCLCMsg_ListenEvents.event_mask)
+  return _internal_event_mask();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CCLCMsg_ListenEvents::_internal_mutable_event_mask() {
+  return &_impl_.event_mask_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CCLCMsg_ListenEvents::mutable_event_mask() {
+  // @@protoc_insertion_point(field_mutable_list:CCLCMsg_ListenEvents.event_mask)
+  return _internal_mutable_event_mask();
+}
+
+// -------------------------------------------------------------------
+
+// CCLCMsg_RespondCvarValue
+
+// optional int32 cookie = 1;
+inline bool CCLCMsg_RespondCvarValue::_internal_has_cookie() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CCLCMsg_RespondCvarValue::has_cookie() const {
+  return _internal_has_cookie();
+}
+inline void CCLCMsg_RespondCvarValue::clear_cookie() {
+  _impl_.cookie_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CCLCMsg_RespondCvarValue::_internal_cookie() const {
+  return _impl_.cookie_;
+}
+inline int32_t CCLCMsg_RespondCvarValue::cookie() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_RespondCvarValue.cookie)
+  return _internal_cookie();
+}
+inline void CCLCMsg_RespondCvarValue::_internal_set_cookie(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.cookie_ = value;
+}
+inline void CCLCMsg_RespondCvarValue::set_cookie(int32_t value) {
+  _internal_set_cookie(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_RespondCvarValue.cookie)
+}
+
+// optional int32 status_code = 2;
+inline bool CCLCMsg_RespondCvarValue::_internal_has_status_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CCLCMsg_RespondCvarValue::has_status_code() const {
+  return _internal_has_status_code();
+}
+inline void CCLCMsg_RespondCvarValue::clear_status_code() {
+  _impl_.status_code_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CCLCMsg_RespondCvarValue::_internal_status_code() const {
+  return _impl_.status_code_;
+}
+inline int32_t CCLCMsg_RespondCvarValue::status_code() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_RespondCvarValue.status_code)
+  return _internal_status_code();
+}
+inline void CCLCMsg_RespondCvarValue::_internal_set_status_code(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.status_code_ = value;
+}
+inline void CCLCMsg_RespondCvarValue::set_status_code(int32_t value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_RespondCvarValue.status_code)
+}
+
+// optional string name = 3;
+inline bool CCLCMsg_RespondCvarValue::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CCLCMsg_RespondCvarValue::has_name() const {
+  return _internal_has_name();
+}
+inline void CCLCMsg_RespondCvarValue::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CCLCMsg_RespondCvarValue::name() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_RespondCvarValue.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CCLCMsg_RespondCvarValue::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CCLCMsg_RespondCvarValue.name)
+}
+inline std::string* CCLCMsg_RespondCvarValue::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:CCLCMsg_RespondCvarValue.name)
+  return _s;
+}
+inline const std::string& CCLCMsg_RespondCvarValue::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CCLCMsg_RespondCvarValue::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_RespondCvarValue::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_RespondCvarValue::release_name() {
+  // @@protoc_insertion_point(field_release:CCLCMsg_RespondCvarValue.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CCLCMsg_RespondCvarValue::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CCLCMsg_RespondCvarValue.name)
+}
+
+// optional string value = 4;
+inline bool CCLCMsg_RespondCvarValue::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CCLCMsg_RespondCvarValue::has_value() const {
+  return _internal_has_value();
+}
+inline void CCLCMsg_RespondCvarValue::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CCLCMsg_RespondCvarValue::value() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_RespondCvarValue.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CCLCMsg_RespondCvarValue::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CCLCMsg_RespondCvarValue.value)
+}
+inline std::string* CCLCMsg_RespondCvarValue::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:CCLCMsg_RespondCvarValue.value)
+  return _s;
+}
+inline const std::string& CCLCMsg_RespondCvarValue::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CCLCMsg_RespondCvarValue::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_RespondCvarValue::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_RespondCvarValue::release_value() {
+  // @@protoc_insertion_point(field_release:CCLCMsg_RespondCvarValue.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CCLCMsg_RespondCvarValue::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CCLCMsg_RespondCvarValue.value)
+}
+
+// -------------------------------------------------------------------
+
+// CCLCMsg_FileCRCCheck
+
+// optional int32 code_path = 1;
+inline bool CCLCMsg_FileCRCCheck::_internal_has_code_path() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CCLCMsg_FileCRCCheck::has_code_path() const {
+  return _internal_has_code_path();
+}
+inline void CCLCMsg_FileCRCCheck::clear_code_path() {
+  _impl_.code_path_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CCLCMsg_FileCRCCheck::_internal_code_path() const {
+  return _impl_.code_path_;
+}
+inline int32_t CCLCMsg_FileCRCCheck::code_path() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_FileCRCCheck.code_path)
+  return _internal_code_path();
+}
+inline void CCLCMsg_FileCRCCheck::_internal_set_code_path(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.code_path_ = value;
+}
+inline void CCLCMsg_FileCRCCheck::set_code_path(int32_t value) {
+  _internal_set_code_path(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_FileCRCCheck.code_path)
+}
+
+// optional string path = 2;
+inline bool CCLCMsg_FileCRCCheck::_internal_has_path() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CCLCMsg_FileCRCCheck::has_path() const {
+  return _internal_has_path();
+}
+inline void CCLCMsg_FileCRCCheck::clear_path() {
+  _impl_.path_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CCLCMsg_FileCRCCheck::path() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_FileCRCCheck.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CCLCMsg_FileCRCCheck::set_path(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CCLCMsg_FileCRCCheck.path)
+}
+inline std::string* CCLCMsg_FileCRCCheck::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:CCLCMsg_FileCRCCheck.path)
+  return _s;
+}
+inline const std::string& CCLCMsg_FileCRCCheck::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void CCLCMsg_FileCRCCheck::_internal_set_path(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_FileCRCCheck::_internal_mutable_path() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_FileCRCCheck::release_path() {
+  // @@protoc_insertion_point(field_release:CCLCMsg_FileCRCCheck.path)
+  if (!_internal_has_path()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.path_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CCLCMsg_FileCRCCheck::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CCLCMsg_FileCRCCheck.path)
+}
+
+// optional int32 code_filename = 3;
+inline bool CCLCMsg_FileCRCCheck::_internal_has_code_filename() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CCLCMsg_FileCRCCheck::has_code_filename() const {
+  return _internal_has_code_filename();
+}
+inline void CCLCMsg_FileCRCCheck::clear_code_filename() {
+  _impl_.code_filename_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CCLCMsg_FileCRCCheck::_internal_code_filename() const {
+  return _impl_.code_filename_;
+}
+inline int32_t CCLCMsg_FileCRCCheck::code_filename() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_FileCRCCheck.code_filename)
+  return _internal_code_filename();
+}
+inline void CCLCMsg_FileCRCCheck::_internal_set_code_filename(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.code_filename_ = value;
+}
+inline void CCLCMsg_FileCRCCheck::set_code_filename(int32_t value) {
+  _internal_set_code_filename(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_FileCRCCheck.code_filename)
+}
+
+// optional string filename = 4;
+inline bool CCLCMsg_FileCRCCheck::_internal_has_filename() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CCLCMsg_FileCRCCheck::has_filename() const {
+  return _internal_has_filename();
+}
+inline void CCLCMsg_FileCRCCheck::clear_filename() {
+  _impl_.filename_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CCLCMsg_FileCRCCheck::filename() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_FileCRCCheck.filename)
+  return _internal_filename();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CCLCMsg_FileCRCCheck::set_filename(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.filename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CCLCMsg_FileCRCCheck.filename)
+}
+inline std::string* CCLCMsg_FileCRCCheck::mutable_filename() {
+  std::string* _s = _internal_mutable_filename();
+  // @@protoc_insertion_point(field_mutable:CCLCMsg_FileCRCCheck.filename)
+  return _s;
+}
+inline const std::string& CCLCMsg_FileCRCCheck::_internal_filename() const {
+  return _impl_.filename_.Get();
+}
+inline void CCLCMsg_FileCRCCheck::_internal_set_filename(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.filename_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_FileCRCCheck::_internal_mutable_filename() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.filename_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_FileCRCCheck::release_filename() {
+  // @@protoc_insertion_point(field_release:CCLCMsg_FileCRCCheck.filename)
+  if (!_internal_has_filename()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.filename_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filename_.IsDefault()) {
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CCLCMsg_FileCRCCheck::set_allocated_filename(std::string* filename) {
+  if (filename != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.filename_.SetAllocated(filename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filename_.IsDefault()) {
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CCLCMsg_FileCRCCheck.filename)
+}
+
+// optional fixed32 crc = 5;
+inline bool CCLCMsg_FileCRCCheck::_internal_has_crc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CCLCMsg_FileCRCCheck::has_crc() const {
+  return _internal_has_crc();
+}
+inline void CCLCMsg_FileCRCCheck::clear_crc() {
+  _impl_.crc_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t CCLCMsg_FileCRCCheck::_internal_crc() const {
+  return _impl_.crc_;
+}
+inline uint32_t CCLCMsg_FileCRCCheck::crc() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_FileCRCCheck.crc)
+  return _internal_crc();
+}
+inline void CCLCMsg_FileCRCCheck::_internal_set_crc(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.crc_ = value;
+}
+inline void CCLCMsg_FileCRCCheck::set_crc(uint32_t value) {
+  _internal_set_crc(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_FileCRCCheck.crc)
+}
+
+// -------------------------------------------------------------------
+
+// CCLCMsg_LoadingProgress
+
+// optional int32 progress = 1;
+inline bool CCLCMsg_LoadingProgress::_internal_has_progress() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CCLCMsg_LoadingProgress::has_progress() const {
+  return _internal_has_progress();
+}
+inline void CCLCMsg_LoadingProgress::clear_progress() {
+  _impl_.progress_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CCLCMsg_LoadingProgress::_internal_progress() const {
+  return _impl_.progress_;
+}
+inline int32_t CCLCMsg_LoadingProgress::progress() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_LoadingProgress.progress)
+  return _internal_progress();
+}
+inline void CCLCMsg_LoadingProgress::_internal_set_progress(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.progress_ = value;
+}
+inline void CCLCMsg_LoadingProgress::set_progress(int32_t value) {
+  _internal_set_progress(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_LoadingProgress.progress)
+}
+
+// -------------------------------------------------------------------
+
+// CCLCMsg_SplitPlayerConnect
+
+// optional .CMsg_CVars convars = 1;
+inline bool CCLCMsg_SplitPlayerConnect::_internal_has_convars() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.convars_ != nullptr);
+  return value;
+}
+inline bool CCLCMsg_SplitPlayerConnect::has_convars() const {
+  return _internal_has_convars();
+}
+inline const ::CMsg_CVars& CCLCMsg_SplitPlayerConnect::_internal_convars() const {
+  const ::CMsg_CVars* p = _impl_.convars_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsg_CVars&>(
+      ::_CMsg_CVars_default_instance_);
+}
+inline const ::CMsg_CVars& CCLCMsg_SplitPlayerConnect::convars() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_SplitPlayerConnect.convars)
+  return _internal_convars();
+}
+inline void CCLCMsg_SplitPlayerConnect::unsafe_arena_set_allocated_convars(
+    ::CMsg_CVars* convars) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.convars_);
+  }
+  _impl_.convars_ = convars;
+  if (convars) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CCLCMsg_SplitPlayerConnect.convars)
+}
+inline ::CMsg_CVars* CCLCMsg_SplitPlayerConnect::release_convars() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsg_CVars* temp = _impl_.convars_;
+  _impl_.convars_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsg_CVars* CCLCMsg_SplitPlayerConnect::unsafe_arena_release_convars() {
+  // @@protoc_insertion_point(field_release:CCLCMsg_SplitPlayerConnect.convars)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsg_CVars* temp = _impl_.convars_;
+  _impl_.convars_ = nullptr;
+  return temp;
+}
+inline ::CMsg_CVars* CCLCMsg_SplitPlayerConnect::_internal_mutable_convars() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.convars_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsg_CVars>(GetArenaForAllocation());
+    _impl_.convars_ = p;
+  }
+  return _impl_.convars_;
+}
+inline ::CMsg_CVars* CCLCMsg_SplitPlayerConnect::mutable_convars() {
+  ::CMsg_CVars* _msg = _internal_mutable_convars();
+  // @@protoc_insertion_point(field_mutable:CCLCMsg_SplitPlayerConnect.convars)
+  return _msg;
+}
+inline void CCLCMsg_SplitPlayerConnect::set_allocated_convars(::CMsg_CVars* convars) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.convars_);
+  }
+  if (convars) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(convars));
+    if (message_arena != submessage_arena) {
+      convars = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, convars, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.convars_ = convars;
+  // @@protoc_insertion_point(field_set_allocated:CCLCMsg_SplitPlayerConnect.convars)
+}
+
+// -------------------------------------------------------------------
+
+// CCLCMsg_ClientMessage
+
+// optional int32 msg_type = 1;
+inline bool CCLCMsg_ClientMessage::_internal_has_msg_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CCLCMsg_ClientMessage::has_msg_type() const {
+  return _internal_has_msg_type();
+}
+inline void CCLCMsg_ClientMessage::clear_msg_type() {
+  _impl_.msg_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CCLCMsg_ClientMessage::_internal_msg_type() const {
+  return _impl_.msg_type_;
+}
+inline int32_t CCLCMsg_ClientMessage::msg_type() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ClientMessage.msg_type)
+  return _internal_msg_type();
+}
+inline void CCLCMsg_ClientMessage::_internal_set_msg_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.msg_type_ = value;
+}
+inline void CCLCMsg_ClientMessage::set_msg_type(int32_t value) {
+  _internal_set_msg_type(value);
+  // @@protoc_insertion_point(field_set:CCLCMsg_ClientMessage.msg_type)
+}
+
+// optional bytes data = 2;
+inline bool CCLCMsg_ClientMessage::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CCLCMsg_ClientMessage::has_data() const {
+  return _internal_has_data();
+}
+inline void CCLCMsg_ClientMessage::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CCLCMsg_ClientMessage::data() const {
+  // @@protoc_insertion_point(field_get:CCLCMsg_ClientMessage.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CCLCMsg_ClientMessage::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CCLCMsg_ClientMessage.data)
+}
+inline std::string* CCLCMsg_ClientMessage::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:CCLCMsg_ClientMessage.data)
+  return _s;
+}
+inline const std::string& CCLCMsg_ClientMessage::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void CCLCMsg_ClientMessage::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_ClientMessage::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CCLCMsg_ClientMessage::release_data() {
+  // @@protoc_insertion_point(field_release:CCLCMsg_ClientMessage.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CCLCMsg_ClientMessage::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CCLCMsg_ClientMessage.data)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_ServerInfo
+
+// optional int32 protocol = 1;
+inline bool CSVCMsg_ServerInfo::_internal_has_protocol() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_protocol() const {
+  return _internal_has_protocol();
+}
+inline void CSVCMsg_ServerInfo::clear_protocol() {
+  _impl_.protocol_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t CSVCMsg_ServerInfo::_internal_protocol() const {
+  return _impl_.protocol_;
+}
+inline int32_t CSVCMsg_ServerInfo::protocol() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.protocol)
+  return _internal_protocol();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_protocol(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.protocol_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_protocol(int32_t value) {
+  _internal_set_protocol(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.protocol)
+}
+
+// optional int32 server_count = 2;
+inline bool CSVCMsg_ServerInfo::_internal_has_server_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_server_count() const {
+  return _internal_has_server_count();
+}
+inline void CSVCMsg_ServerInfo::clear_server_count() {
+  _impl_.server_count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t CSVCMsg_ServerInfo::_internal_server_count() const {
+  return _impl_.server_count_;
+}
+inline int32_t CSVCMsg_ServerInfo::server_count() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.server_count)
+  return _internal_server_count();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_server_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.server_count_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_server_count(int32_t value) {
+  _internal_set_server_count(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.server_count)
+}
+
+// optional bool is_dedicated = 3;
+inline bool CSVCMsg_ServerInfo::_internal_has_is_dedicated() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_is_dedicated() const {
+  return _internal_has_is_dedicated();
+}
+inline void CSVCMsg_ServerInfo::clear_is_dedicated() {
+  _impl_.is_dedicated_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool CSVCMsg_ServerInfo::_internal_is_dedicated() const {
+  return _impl_.is_dedicated_;
+}
+inline bool CSVCMsg_ServerInfo::is_dedicated() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.is_dedicated)
+  return _internal_is_dedicated();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_is_dedicated(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.is_dedicated_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_is_dedicated(bool value) {
+  _internal_set_is_dedicated(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.is_dedicated)
+}
+
+// optional bool is_hltv = 4;
+inline bool CSVCMsg_ServerInfo::_internal_has_is_hltv() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_is_hltv() const {
+  return _internal_has_is_hltv();
+}
+inline void CSVCMsg_ServerInfo::clear_is_hltv() {
+  _impl_.is_hltv_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool CSVCMsg_ServerInfo::_internal_is_hltv() const {
+  return _impl_.is_hltv_;
+}
+inline bool CSVCMsg_ServerInfo::is_hltv() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.is_hltv)
+  return _internal_is_hltv();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_is_hltv(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.is_hltv_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_is_hltv(bool value) {
+  _internal_set_is_hltv(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.is_hltv)
+}
+
+// optional bool is_replay = 5;
+inline bool CSVCMsg_ServerInfo::_internal_has_is_replay() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_is_replay() const {
+  return _internal_has_is_replay();
+}
+inline void CSVCMsg_ServerInfo::clear_is_replay() {
+  _impl_.is_replay_ = false;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline bool CSVCMsg_ServerInfo::_internal_is_replay() const {
+  return _impl_.is_replay_;
+}
+inline bool CSVCMsg_ServerInfo::is_replay() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.is_replay)
+  return _internal_is_replay();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_is_replay(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.is_replay_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_is_replay(bool value) {
+  _internal_set_is_replay(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.is_replay)
+}
+
+// optional int32 c_os = 6;
+inline bool CSVCMsg_ServerInfo::_internal_has_c_os() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_c_os() const {
+  return _internal_has_c_os();
+}
+inline void CSVCMsg_ServerInfo::clear_c_os() {
+  _impl_.c_os_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t CSVCMsg_ServerInfo::_internal_c_os() const {
+  return _impl_.c_os_;
+}
+inline int32_t CSVCMsg_ServerInfo::c_os() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.c_os)
+  return _internal_c_os();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_c_os(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.c_os_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_c_os(int32_t value) {
+  _internal_set_c_os(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.c_os)
+}
+
+// optional fixed32 map_crc = 7;
+inline bool CSVCMsg_ServerInfo::_internal_has_map_crc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_map_crc() const {
+  return _internal_has_map_crc();
+}
+inline void CSVCMsg_ServerInfo::clear_map_crc() {
+  _impl_.map_crc_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint32_t CSVCMsg_ServerInfo::_internal_map_crc() const {
+  return _impl_.map_crc_;
+}
+inline uint32_t CSVCMsg_ServerInfo::map_crc() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.map_crc)
+  return _internal_map_crc();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_map_crc(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.map_crc_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_map_crc(uint32_t value) {
+  _internal_set_map_crc(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.map_crc)
+}
+
+// optional fixed32 client_crc = 8;
+inline bool CSVCMsg_ServerInfo::_internal_has_client_crc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_client_crc() const {
+  return _internal_has_client_crc();
+}
+inline void CSVCMsg_ServerInfo::clear_client_crc() {
+  _impl_.client_crc_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint32_t CSVCMsg_ServerInfo::_internal_client_crc() const {
+  return _impl_.client_crc_;
+}
+inline uint32_t CSVCMsg_ServerInfo::client_crc() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.client_crc)
+  return _internal_client_crc();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_client_crc(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.client_crc_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_client_crc(uint32_t value) {
+  _internal_set_client_crc(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.client_crc)
+}
+
+// optional fixed32 string_table_crc = 9;
+inline bool CSVCMsg_ServerInfo::_internal_has_string_table_crc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_string_table_crc() const {
+  return _internal_has_string_table_crc();
+}
+inline void CSVCMsg_ServerInfo::clear_string_table_crc() {
+  _impl_.string_table_crc_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline uint32_t CSVCMsg_ServerInfo::_internal_string_table_crc() const {
+  return _impl_.string_table_crc_;
+}
+inline uint32_t CSVCMsg_ServerInfo::string_table_crc() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.string_table_crc)
+  return _internal_string_table_crc();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_string_table_crc(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.string_table_crc_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_string_table_crc(uint32_t value) {
+  _internal_set_string_table_crc(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.string_table_crc)
+}
+
+// optional int32 max_clients = 10;
+inline bool CSVCMsg_ServerInfo::_internal_has_max_clients() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_max_clients() const {
+  return _internal_has_max_clients();
+}
+inline void CSVCMsg_ServerInfo::clear_max_clients() {
+  _impl_.max_clients_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline int32_t CSVCMsg_ServerInfo::_internal_max_clients() const {
+  return _impl_.max_clients_;
+}
+inline int32_t CSVCMsg_ServerInfo::max_clients() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.max_clients)
+  return _internal_max_clients();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_max_clients(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.max_clients_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_max_clients(int32_t value) {
+  _internal_set_max_clients(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.max_clients)
+}
+
+// optional int32 max_classes = 11;
+inline bool CSVCMsg_ServerInfo::_internal_has_max_classes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_max_classes() const {
+  return _internal_has_max_classes();
+}
+inline void CSVCMsg_ServerInfo::clear_max_classes() {
+  _impl_.max_classes_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline int32_t CSVCMsg_ServerInfo::_internal_max_classes() const {
+  return _impl_.max_classes_;
+}
+inline int32_t CSVCMsg_ServerInfo::max_classes() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.max_classes)
+  return _internal_max_classes();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_max_classes(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.max_classes_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_max_classes(int32_t value) {
+  _internal_set_max_classes(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.max_classes)
+}
+
+// optional int32 player_slot = 12;
+inline bool CSVCMsg_ServerInfo::_internal_has_player_slot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_player_slot() const {
+  return _internal_has_player_slot();
+}
+inline void CSVCMsg_ServerInfo::clear_player_slot() {
+  _impl_.player_slot_ = 0;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline int32_t CSVCMsg_ServerInfo::_internal_player_slot() const {
+  return _impl_.player_slot_;
+}
+inline int32_t CSVCMsg_ServerInfo::player_slot() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.player_slot)
+  return _internal_player_slot();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_player_slot(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.player_slot_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_player_slot(int32_t value) {
+  _internal_set_player_slot(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.player_slot)
+}
+
+// optional float tick_interval = 13;
+inline bool CSVCMsg_ServerInfo::_internal_has_tick_interval() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_tick_interval() const {
+  return _internal_has_tick_interval();
+}
+inline void CSVCMsg_ServerInfo::clear_tick_interval() {
+  _impl_.tick_interval_ = 0;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline float CSVCMsg_ServerInfo::_internal_tick_interval() const {
+  return _impl_.tick_interval_;
+}
+inline float CSVCMsg_ServerInfo::tick_interval() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.tick_interval)
+  return _internal_tick_interval();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_tick_interval(float value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.tick_interval_ = value;
+}
+inline void CSVCMsg_ServerInfo::set_tick_interval(float value) {
+  _internal_set_tick_interval(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.tick_interval)
+}
+
+// optional string game_dir = 14;
+inline bool CSVCMsg_ServerInfo::_internal_has_game_dir() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_game_dir() const {
+  return _internal_has_game_dir();
+}
+inline void CSVCMsg_ServerInfo::clear_game_dir() {
+  _impl_.game_dir_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_ServerInfo::game_dir() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.game_dir)
+  return _internal_game_dir();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_ServerInfo::set_game_dir(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.game_dir_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.game_dir)
+}
+inline std::string* CSVCMsg_ServerInfo::mutable_game_dir() {
+  std::string* _s = _internal_mutable_game_dir();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_ServerInfo.game_dir)
+  return _s;
+}
+inline const std::string& CSVCMsg_ServerInfo::_internal_game_dir() const {
+  return _impl_.game_dir_.Get();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_game_dir(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.game_dir_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::_internal_mutable_game_dir() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.game_dir_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::release_game_dir() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_ServerInfo.game_dir)
+  if (!_internal_has_game_dir()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.game_dir_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.game_dir_.IsDefault()) {
+    _impl_.game_dir_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_ServerInfo::set_allocated_game_dir(std::string* game_dir) {
+  if (game_dir != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.game_dir_.SetAllocated(game_dir, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.game_dir_.IsDefault()) {
+    _impl_.game_dir_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_ServerInfo.game_dir)
+}
+
+// optional string map_name = 15;
+inline bool CSVCMsg_ServerInfo::_internal_has_map_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_map_name() const {
+  return _internal_has_map_name();
+}
+inline void CSVCMsg_ServerInfo::clear_map_name() {
+  _impl_.map_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CSVCMsg_ServerInfo::map_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.map_name)
+  return _internal_map_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_ServerInfo::set_map_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.map_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.map_name)
+}
+inline std::string* CSVCMsg_ServerInfo::mutable_map_name() {
+  std::string* _s = _internal_mutable_map_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_ServerInfo.map_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_ServerInfo::_internal_map_name() const {
+  return _impl_.map_name_.Get();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_map_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.map_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::_internal_mutable_map_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.map_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::release_map_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_ServerInfo.map_name)
+  if (!_internal_has_map_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.map_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.map_name_.IsDefault()) {
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_ServerInfo::set_allocated_map_name(std::string* map_name) {
+  if (map_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.map_name_.SetAllocated(map_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.map_name_.IsDefault()) {
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_ServerInfo.map_name)
+}
+
+// optional string sky_name = 16;
+inline bool CSVCMsg_ServerInfo::_internal_has_sky_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_sky_name() const {
+  return _internal_has_sky_name();
+}
+inline void CSVCMsg_ServerInfo::clear_sky_name() {
+  _impl_.sky_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CSVCMsg_ServerInfo::sky_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.sky_name)
+  return _internal_sky_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_ServerInfo::set_sky_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.sky_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.sky_name)
+}
+inline std::string* CSVCMsg_ServerInfo::mutable_sky_name() {
+  std::string* _s = _internal_mutable_sky_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_ServerInfo.sky_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_ServerInfo::_internal_sky_name() const {
+  return _impl_.sky_name_.Get();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_sky_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sky_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::_internal_mutable_sky_name() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.sky_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::release_sky_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_ServerInfo.sky_name)
+  if (!_internal_has_sky_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.sky_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sky_name_.IsDefault()) {
+    _impl_.sky_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_ServerInfo::set_allocated_sky_name(std::string* sky_name) {
+  if (sky_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.sky_name_.SetAllocated(sky_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sky_name_.IsDefault()) {
+    _impl_.sky_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_ServerInfo.sky_name)
+}
+
+// optional string host_name = 17;
+inline bool CSVCMsg_ServerInfo::_internal_has_host_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_host_name() const {
+  return _internal_has_host_name();
+}
+inline void CSVCMsg_ServerInfo::clear_host_name() {
+  _impl_.host_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& CSVCMsg_ServerInfo::host_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.host_name)
+  return _internal_host_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_ServerInfo::set_host_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.host_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.host_name)
+}
+inline std::string* CSVCMsg_ServerInfo::mutable_host_name() {
+  std::string* _s = _internal_mutable_host_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_ServerInfo.host_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_ServerInfo::_internal_host_name() const {
+  return _impl_.host_name_.Get();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_host_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.host_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::_internal_mutable_host_name() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.host_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::release_host_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_ServerInfo.host_name)
+  if (!_internal_has_host_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.host_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.host_name_.IsDefault()) {
+    _impl_.host_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_ServerInfo::set_allocated_host_name(std::string* host_name) {
+  if (host_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.host_name_.SetAllocated(host_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.host_name_.IsDefault()) {
+    _impl_.host_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_ServerInfo.host_name)
+}
+
+// optional string addon_name = 18;
+inline bool CSVCMsg_ServerInfo::_internal_has_addon_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ServerInfo::has_addon_name() const {
+  return _internal_has_addon_name();
+}
+inline void CSVCMsg_ServerInfo::clear_addon_name() {
+  _impl_.addon_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& CSVCMsg_ServerInfo::addon_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ServerInfo.addon_name)
+  return _internal_addon_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_ServerInfo::set_addon_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.addon_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_ServerInfo.addon_name)
+}
+inline std::string* CSVCMsg_ServerInfo::mutable_addon_name() {
+  std::string* _s = _internal_mutable_addon_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_ServerInfo.addon_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_ServerInfo::_internal_addon_name() const {
+  return _impl_.addon_name_.Get();
+}
+inline void CSVCMsg_ServerInfo::_internal_set_addon_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.addon_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::_internal_mutable_addon_name() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.addon_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ServerInfo::release_addon_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_ServerInfo.addon_name)
+  if (!_internal_has_addon_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.addon_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.addon_name_.IsDefault()) {
+    _impl_.addon_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_ServerInfo::set_allocated_addon_name(std::string* addon_name) {
+  if (addon_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.addon_name_.SetAllocated(addon_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.addon_name_.IsDefault()) {
+    _impl_.addon_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_ServerInfo.addon_name)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_ClassInfo_class_t
+
+// optional int32 class_id = 1;
+inline bool CSVCMsg_ClassInfo_class_t::_internal_has_class_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ClassInfo_class_t::has_class_id() const {
+  return _internal_has_class_id();
+}
+inline void CSVCMsg_ClassInfo_class_t::clear_class_id() {
+  _impl_.class_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_ClassInfo_class_t::_internal_class_id() const {
+  return _impl_.class_id_;
+}
+inline int32_t CSVCMsg_ClassInfo_class_t::class_id() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ClassInfo.class_t.class_id)
+  return _internal_class_id();
+}
+inline void CSVCMsg_ClassInfo_class_t::_internal_set_class_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.class_id_ = value;
+}
+inline void CSVCMsg_ClassInfo_class_t::set_class_id(int32_t value) {
+  _internal_set_class_id(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ClassInfo.class_t.class_id)
+}
+
+// optional string data_table_name = 2;
+inline bool CSVCMsg_ClassInfo_class_t::_internal_has_data_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ClassInfo_class_t::has_data_table_name() const {
+  return _internal_has_data_table_name();
+}
+inline void CSVCMsg_ClassInfo_class_t::clear_data_table_name() {
+  _impl_.data_table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_ClassInfo_class_t::data_table_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ClassInfo.class_t.data_table_name)
+  return _internal_data_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_ClassInfo_class_t::set_data_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.data_table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_ClassInfo.class_t.data_table_name)
+}
+inline std::string* CSVCMsg_ClassInfo_class_t::mutable_data_table_name() {
+  std::string* _s = _internal_mutable_data_table_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_ClassInfo.class_t.data_table_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_ClassInfo_class_t::_internal_data_table_name() const {
+  return _impl_.data_table_name_.Get();
+}
+inline void CSVCMsg_ClassInfo_class_t::_internal_set_data_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.data_table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ClassInfo_class_t::_internal_mutable_data_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.data_table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ClassInfo_class_t::release_data_table_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_ClassInfo.class_t.data_table_name)
+  if (!_internal_has_data_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.data_table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_table_name_.IsDefault()) {
+    _impl_.data_table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_ClassInfo_class_t::set_allocated_data_table_name(std::string* data_table_name) {
+  if (data_table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.data_table_name_.SetAllocated(data_table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_table_name_.IsDefault()) {
+    _impl_.data_table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_ClassInfo.class_t.data_table_name)
+}
+
+// optional string class_name = 3;
+inline bool CSVCMsg_ClassInfo_class_t::_internal_has_class_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ClassInfo_class_t::has_class_name() const {
+  return _internal_has_class_name();
+}
+inline void CSVCMsg_ClassInfo_class_t::clear_class_name() {
+  _impl_.class_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CSVCMsg_ClassInfo_class_t::class_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ClassInfo.class_t.class_name)
+  return _internal_class_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_ClassInfo_class_t::set_class_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.class_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_ClassInfo.class_t.class_name)
+}
+inline std::string* CSVCMsg_ClassInfo_class_t::mutable_class_name() {
+  std::string* _s = _internal_mutable_class_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_ClassInfo.class_t.class_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_ClassInfo_class_t::_internal_class_name() const {
+  return _impl_.class_name_.Get();
+}
+inline void CSVCMsg_ClassInfo_class_t::_internal_set_class_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.class_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ClassInfo_class_t::_internal_mutable_class_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.class_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_ClassInfo_class_t::release_class_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_ClassInfo.class_t.class_name)
+  if (!_internal_has_class_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.class_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.class_name_.IsDefault()) {
+    _impl_.class_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_ClassInfo_class_t::set_allocated_class_name(std::string* class_name) {
+  if (class_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.class_name_.SetAllocated(class_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.class_name_.IsDefault()) {
+    _impl_.class_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_ClassInfo.class_t.class_name)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_ClassInfo
+
+// optional bool create_on_client = 1;
+inline bool CSVCMsg_ClassInfo::_internal_has_create_on_client() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_ClassInfo::has_create_on_client() const {
+  return _internal_has_create_on_client();
+}
+inline void CSVCMsg_ClassInfo::clear_create_on_client() {
+  _impl_.create_on_client_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool CSVCMsg_ClassInfo::_internal_create_on_client() const {
+  return _impl_.create_on_client_;
+}
+inline bool CSVCMsg_ClassInfo::create_on_client() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ClassInfo.create_on_client)
+  return _internal_create_on_client();
+}
+inline void CSVCMsg_ClassInfo::_internal_set_create_on_client(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.create_on_client_ = value;
+}
+inline void CSVCMsg_ClassInfo::set_create_on_client(bool value) {
+  _internal_set_create_on_client(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_ClassInfo.create_on_client)
+}
+
+// repeated .CSVCMsg_ClassInfo.class_t classes = 2;
+inline int CSVCMsg_ClassInfo::_internal_classes_size() const {
+  return _impl_.classes_.size();
+}
+inline int CSVCMsg_ClassInfo::classes_size() const {
+  return _internal_classes_size();
+}
+inline void CSVCMsg_ClassInfo::clear_classes() {
+  _impl_.classes_.Clear();
+}
+inline ::CSVCMsg_ClassInfo_class_t* CSVCMsg_ClassInfo::mutable_classes(int index) {
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_ClassInfo.classes)
+  return _impl_.classes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_ClassInfo_class_t >*
+CSVCMsg_ClassInfo::mutable_classes() {
+  // @@protoc_insertion_point(field_mutable_list:CSVCMsg_ClassInfo.classes)
+  return &_impl_.classes_;
+}
+inline const ::CSVCMsg_ClassInfo_class_t& CSVCMsg_ClassInfo::_internal_classes(int index) const {
+  return _impl_.classes_.Get(index);
+}
+inline const ::CSVCMsg_ClassInfo_class_t& CSVCMsg_ClassInfo::classes(int index) const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_ClassInfo.classes)
+  return _internal_classes(index);
+}
+inline ::CSVCMsg_ClassInfo_class_t* CSVCMsg_ClassInfo::_internal_add_classes() {
+  return _impl_.classes_.Add();
+}
+inline ::CSVCMsg_ClassInfo_class_t* CSVCMsg_ClassInfo::add_classes() {
+  ::CSVCMsg_ClassInfo_class_t* _add = _internal_add_classes();
+  // @@protoc_insertion_point(field_add:CSVCMsg_ClassInfo.classes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_ClassInfo_class_t >&
+CSVCMsg_ClassInfo::classes() const {
+  // @@protoc_insertion_point(field_list:CSVCMsg_ClassInfo.classes)
+  return _impl_.classes_;
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_SetPause
+
+// optional bool paused = 1;
+inline bool CSVCMsg_SetPause::_internal_has_paused() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SetPause::has_paused() const {
+  return _internal_has_paused();
+}
+inline void CSVCMsg_SetPause::clear_paused() {
+  _impl_.paused_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool CSVCMsg_SetPause::_internal_paused() const {
+  return _impl_.paused_;
+}
+inline bool CSVCMsg_SetPause::paused() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SetPause.paused)
+  return _internal_paused();
+}
+inline void CSVCMsg_SetPause::_internal_set_paused(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.paused_ = value;
+}
+inline void CSVCMsg_SetPause::set_paused(bool value) {
+  _internal_set_paused(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SetPause.paused)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_VoiceInit
+
+// optional int32 quality = 1;
+inline bool CSVCMsg_VoiceInit::_internal_has_quality() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceInit::has_quality() const {
+  return _internal_has_quality();
+}
+inline void CSVCMsg_VoiceInit::clear_quality() {
+  _impl_.quality_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_VoiceInit::_internal_quality() const {
+  return _impl_.quality_;
+}
+inline int32_t CSVCMsg_VoiceInit::quality() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceInit.quality)
+  return _internal_quality();
+}
+inline void CSVCMsg_VoiceInit::_internal_set_quality(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.quality_ = value;
+}
+inline void CSVCMsg_VoiceInit::set_quality(int32_t value) {
+  _internal_set_quality(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceInit.quality)
+}
+
+// optional string codec = 2;
+inline bool CSVCMsg_VoiceInit::_internal_has_codec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceInit::has_codec() const {
+  return _internal_has_codec();
+}
+inline void CSVCMsg_VoiceInit::clear_codec() {
+  _impl_.codec_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_VoiceInit::codec() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceInit.codec)
+  return _internal_codec();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_VoiceInit::set_codec(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.codec_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceInit.codec)
+}
+inline std::string* CSVCMsg_VoiceInit::mutable_codec() {
+  std::string* _s = _internal_mutable_codec();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_VoiceInit.codec)
+  return _s;
+}
+inline const std::string& CSVCMsg_VoiceInit::_internal_codec() const {
+  return _impl_.codec_.Get();
+}
+inline void CSVCMsg_VoiceInit::_internal_set_codec(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.codec_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_VoiceInit::_internal_mutable_codec() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.codec_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_VoiceInit::release_codec() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_VoiceInit.codec)
+  if (!_internal_has_codec()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.codec_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.codec_.IsDefault()) {
+    _impl_.codec_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_VoiceInit::set_allocated_codec(std::string* codec) {
+  if (codec != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.codec_.SetAllocated(codec, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.codec_.IsDefault()) {
+    _impl_.codec_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_VoiceInit.codec)
+}
+
+// optional int32 version = 3 [default = 0];
+inline bool CSVCMsg_VoiceInit::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceInit::has_version() const {
+  return _internal_has_version();
+}
+inline void CSVCMsg_VoiceInit::clear_version() {
+  _impl_.version_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_VoiceInit::_internal_version() const {
+  return _impl_.version_;
+}
+inline int32_t CSVCMsg_VoiceInit::version() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceInit.version)
+  return _internal_version();
+}
+inline void CSVCMsg_VoiceInit::_internal_set_version(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.version_ = value;
+}
+inline void CSVCMsg_VoiceInit::set_version(int32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceInit.version)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_Print
+
+// optional string text = 1;
+inline bool CSVCMsg_Print::_internal_has_text() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Print::has_text() const {
+  return _internal_has_text();
+}
+inline void CSVCMsg_Print::clear_text() {
+  _impl_.text_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_Print::text() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Print.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_Print::set_text(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_Print.text)
+}
+inline std::string* CSVCMsg_Print::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_Print.text)
+  return _s;
+}
+inline const std::string& CSVCMsg_Print::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void CSVCMsg_Print::_internal_set_text(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_Print::_internal_mutable_text() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_Print::release_text() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_Print.text)
+  if (!_internal_has_text()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.text_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_Print::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_Print.text)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_Sounds_sounddata_t
+
+// optional sint32 origin_x = 1;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_origin_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_origin_x() const {
+  return _internal_has_origin_x();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_origin_x() {
+  _impl_.origin_x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_origin_x() const {
+  return _impl_.origin_x_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::origin_x() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.origin_x)
+  return _internal_origin_x();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_origin_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.origin_x_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_origin_x(int32_t value) {
+  _internal_set_origin_x(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.origin_x)
+}
+
+// optional sint32 origin_y = 2;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_origin_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_origin_y() const {
+  return _internal_has_origin_y();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_origin_y() {
+  _impl_.origin_y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_origin_y() const {
+  return _impl_.origin_y_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::origin_y() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.origin_y)
+  return _internal_origin_y();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_origin_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.origin_y_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_origin_y(int32_t value) {
+  _internal_set_origin_y(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.origin_y)
+}
+
+// optional sint32 origin_z = 3;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_origin_z() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_origin_z() const {
+  return _internal_has_origin_z();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_origin_z() {
+  _impl_.origin_z_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_origin_z() const {
+  return _impl_.origin_z_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::origin_z() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.origin_z)
+  return _internal_origin_z();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_origin_z(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.origin_z_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_origin_z(int32_t value) {
+  _internal_set_origin_z(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.origin_z)
+}
+
+// optional uint32 volume = 4;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_volume() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_volume() const {
+  return _internal_has_volume();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_volume() {
+  _impl_.volume_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CSVCMsg_Sounds_sounddata_t::_internal_volume() const {
+  return _impl_.volume_;
+}
+inline uint32_t CSVCMsg_Sounds_sounddata_t::volume() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.volume)
+  return _internal_volume();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_volume(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.volume_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_volume(uint32_t value) {
+  _internal_set_volume(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.volume)
+}
+
+// optional float delay_value = 5;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_delay_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_delay_value() const {
+  return _internal_has_delay_value();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_delay_value() {
+  _impl_.delay_value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline float CSVCMsg_Sounds_sounddata_t::_internal_delay_value() const {
+  return _impl_.delay_value_;
+}
+inline float CSVCMsg_Sounds_sounddata_t::delay_value() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.delay_value)
+  return _internal_delay_value();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_delay_value(float value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.delay_value_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_delay_value(float value) {
+  _internal_set_delay_value(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.delay_value)
+}
+
+// optional int32 sequence_number = 6;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_sequence_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_sequence_number() const {
+  return _internal_has_sequence_number();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_sequence_number() {
+  _impl_.sequence_number_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_sequence_number() const {
+  return _impl_.sequence_number_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::sequence_number() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.sequence_number)
+  return _internal_sequence_number();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_sequence_number(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.sequence_number_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_sequence_number(int32_t value) {
+  _internal_set_sequence_number(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.sequence_number)
+}
+
+// optional int32 entity_index = 7;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_entity_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_entity_index() const {
+  return _internal_has_entity_index();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_entity_index() {
+  _impl_.entity_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_entity_index() const {
+  return _impl_.entity_index_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::entity_index() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.entity_index)
+  return _internal_entity_index();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_entity_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.entity_index_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_entity_index(int32_t value) {
+  _internal_set_entity_index(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.entity_index)
+}
+
+// optional int32 channel = 8;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_channel() const {
+  return _internal_has_channel();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_channel() {
+  _impl_.channel_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_channel() const {
+  return _impl_.channel_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::channel() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.channel)
+  return _internal_channel();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_channel(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.channel_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_channel(int32_t value) {
+  _internal_set_channel(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.channel)
+}
+
+// optional int32 pitch = 9;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_pitch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_pitch() const {
+  return _internal_has_pitch();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_pitch() {
+  _impl_.pitch_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_pitch() const {
+  return _impl_.pitch_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::pitch() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.pitch)
+  return _internal_pitch();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_pitch(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.pitch_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_pitch(int32_t value) {
+  _internal_set_pitch(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.pitch)
+}
+
+// optional int32 flags = 10;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_flags() const {
+  return _internal_has_flags();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_flags() {
+  _impl_.flags_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::flags() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.flags)
+  return _internal_flags();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_flags(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.flags_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_flags(int32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.flags)
+}
+
+// optional uint32 sound_num = 11;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_sound_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_sound_num() const {
+  return _internal_has_sound_num();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_sound_num() {
+  _impl_.sound_num_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t CSVCMsg_Sounds_sounddata_t::_internal_sound_num() const {
+  return _impl_.sound_num_;
+}
+inline uint32_t CSVCMsg_Sounds_sounddata_t::sound_num() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.sound_num)
+  return _internal_sound_num();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_sound_num(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.sound_num_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_sound_num(uint32_t value) {
+  _internal_set_sound_num(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.sound_num)
+}
+
+// optional fixed32 sound_num_handle = 12;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_sound_num_handle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_sound_num_handle() const {
+  return _internal_has_sound_num_handle();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_sound_num_handle() {
+  _impl_.sound_num_handle_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint32_t CSVCMsg_Sounds_sounddata_t::_internal_sound_num_handle() const {
+  return _impl_.sound_num_handle_;
+}
+inline uint32_t CSVCMsg_Sounds_sounddata_t::sound_num_handle() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.sound_num_handle)
+  return _internal_sound_num_handle();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_sound_num_handle(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.sound_num_handle_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_sound_num_handle(uint32_t value) {
+  _internal_set_sound_num_handle(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.sound_num_handle)
+}
+
+// optional int32 speaker_entity = 13;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_speaker_entity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_speaker_entity() const {
+  return _internal_has_speaker_entity();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_speaker_entity() {
+  _impl_.speaker_entity_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_speaker_entity() const {
+  return _impl_.speaker_entity_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::speaker_entity() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.speaker_entity)
+  return _internal_speaker_entity();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_speaker_entity(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.speaker_entity_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_speaker_entity(int32_t value) {
+  _internal_set_speaker_entity(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.speaker_entity)
+}
+
+// optional int32 random_seed = 14;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_random_seed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_random_seed() const {
+  return _internal_has_random_seed();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_random_seed() {
+  _impl_.random_seed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_random_seed() const {
+  return _impl_.random_seed_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::random_seed() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.random_seed)
+  return _internal_random_seed();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_random_seed(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.random_seed_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_random_seed(int32_t value) {
+  _internal_set_random_seed(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.random_seed)
+}
+
+// optional int32 sound_level = 15;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_sound_level() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_sound_level() const {
+  return _internal_has_sound_level();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_sound_level() {
+  _impl_.sound_level_ = 0;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::_internal_sound_level() const {
+  return _impl_.sound_level_;
+}
+inline int32_t CSVCMsg_Sounds_sounddata_t::sound_level() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.sound_level)
+  return _internal_sound_level();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_sound_level(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.sound_level_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_sound_level(int32_t value) {
+  _internal_set_sound_level(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.sound_level)
+}
+
+// optional bool is_sentence = 16;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_is_sentence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_is_sentence() const {
+  return _internal_has_is_sentence();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_is_sentence() {
+  _impl_.is_sentence_ = false;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_is_sentence() const {
+  return _impl_.is_sentence_;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::is_sentence() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.is_sentence)
+  return _internal_is_sentence();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_is_sentence(bool value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.is_sentence_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_is_sentence(bool value) {
+  _internal_set_is_sentence(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.is_sentence)
+}
+
+// optional bool is_ambient = 17;
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_has_is_ambient() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::has_is_ambient() const {
+  return _internal_has_is_ambient();
+}
+inline void CSVCMsg_Sounds_sounddata_t::clear_is_ambient() {
+  _impl_.is_ambient_ = false;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::_internal_is_ambient() const {
+  return _impl_.is_ambient_;
+}
+inline bool CSVCMsg_Sounds_sounddata_t::is_ambient() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounddata_t.is_ambient)
+  return _internal_is_ambient();
+}
+inline void CSVCMsg_Sounds_sounddata_t::_internal_set_is_ambient(bool value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.is_ambient_ = value;
+}
+inline void CSVCMsg_Sounds_sounddata_t::set_is_ambient(bool value) {
+  _internal_set_is_ambient(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.sounddata_t.is_ambient)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_Sounds
+
+// optional bool reliable_sound = 1;
+inline bool CSVCMsg_Sounds::_internal_has_reliable_sound() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Sounds::has_reliable_sound() const {
+  return _internal_has_reliable_sound();
+}
+inline void CSVCMsg_Sounds::clear_reliable_sound() {
+  _impl_.reliable_sound_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool CSVCMsg_Sounds::_internal_reliable_sound() const {
+  return _impl_.reliable_sound_;
+}
+inline bool CSVCMsg_Sounds::reliable_sound() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.reliable_sound)
+  return _internal_reliable_sound();
+}
+inline void CSVCMsg_Sounds::_internal_set_reliable_sound(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reliable_sound_ = value;
+}
+inline void CSVCMsg_Sounds::set_reliable_sound(bool value) {
+  _internal_set_reliable_sound(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Sounds.reliable_sound)
+}
+
+// repeated .CSVCMsg_Sounds.sounddata_t sounds = 2;
+inline int CSVCMsg_Sounds::_internal_sounds_size() const {
+  return _impl_.sounds_.size();
+}
+inline int CSVCMsg_Sounds::sounds_size() const {
+  return _internal_sounds_size();
+}
+inline void CSVCMsg_Sounds::clear_sounds() {
+  _impl_.sounds_.Clear();
+}
+inline ::CSVCMsg_Sounds_sounddata_t* CSVCMsg_Sounds::mutable_sounds(int index) {
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_Sounds.sounds)
+  return _impl_.sounds_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_Sounds_sounddata_t >*
+CSVCMsg_Sounds::mutable_sounds() {
+  // @@protoc_insertion_point(field_mutable_list:CSVCMsg_Sounds.sounds)
+  return &_impl_.sounds_;
+}
+inline const ::CSVCMsg_Sounds_sounddata_t& CSVCMsg_Sounds::_internal_sounds(int index) const {
+  return _impl_.sounds_.Get(index);
+}
+inline const ::CSVCMsg_Sounds_sounddata_t& CSVCMsg_Sounds::sounds(int index) const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Sounds.sounds)
+  return _internal_sounds(index);
+}
+inline ::CSVCMsg_Sounds_sounddata_t* CSVCMsg_Sounds::_internal_add_sounds() {
+  return _impl_.sounds_.Add();
+}
+inline ::CSVCMsg_Sounds_sounddata_t* CSVCMsg_Sounds::add_sounds() {
+  ::CSVCMsg_Sounds_sounddata_t* _add = _internal_add_sounds();
+  // @@protoc_insertion_point(field_add:CSVCMsg_Sounds.sounds)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_Sounds_sounddata_t >&
+CSVCMsg_Sounds::sounds() const {
+  // @@protoc_insertion_point(field_list:CSVCMsg_Sounds.sounds)
+  return _impl_.sounds_;
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_Prefetch
+
+// optional int32 sound_index = 1;
+inline bool CSVCMsg_Prefetch::_internal_has_sound_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Prefetch::has_sound_index() const {
+  return _internal_has_sound_index();
+}
+inline void CSVCMsg_Prefetch::clear_sound_index() {
+  _impl_.sound_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CSVCMsg_Prefetch::_internal_sound_index() const {
+  return _impl_.sound_index_;
+}
+inline int32_t CSVCMsg_Prefetch::sound_index() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Prefetch.sound_index)
+  return _internal_sound_index();
+}
+inline void CSVCMsg_Prefetch::_internal_set_sound_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.sound_index_ = value;
+}
+inline void CSVCMsg_Prefetch::set_sound_index(int32_t value) {
+  _internal_set_sound_index(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Prefetch.sound_index)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_SetView
+
+// optional int32 entity_index = 1;
+inline bool CSVCMsg_SetView::_internal_has_entity_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SetView::has_entity_index() const {
+  return _internal_has_entity_index();
+}
+inline void CSVCMsg_SetView::clear_entity_index() {
+  _impl_.entity_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CSVCMsg_SetView::_internal_entity_index() const {
+  return _impl_.entity_index_;
+}
+inline int32_t CSVCMsg_SetView::entity_index() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SetView.entity_index)
+  return _internal_entity_index();
+}
+inline void CSVCMsg_SetView::_internal_set_entity_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.entity_index_ = value;
+}
+inline void CSVCMsg_SetView::set_entity_index(int32_t value) {
+  _internal_set_entity_index(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SetView.entity_index)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_FixAngle
+
+// optional bool relative = 1;
+inline bool CSVCMsg_FixAngle::_internal_has_relative() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_FixAngle::has_relative() const {
+  return _internal_has_relative();
+}
+inline void CSVCMsg_FixAngle::clear_relative() {
+  _impl_.relative_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool CSVCMsg_FixAngle::_internal_relative() const {
+  return _impl_.relative_;
+}
+inline bool CSVCMsg_FixAngle::relative() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_FixAngle.relative)
+  return _internal_relative();
+}
+inline void CSVCMsg_FixAngle::_internal_set_relative(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.relative_ = value;
+}
+inline void CSVCMsg_FixAngle::set_relative(bool value) {
+  _internal_set_relative(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_FixAngle.relative)
+}
+
+// optional .CMsgQAngle angle = 2;
+inline bool CSVCMsg_FixAngle::_internal_has_angle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.angle_ != nullptr);
+  return value;
+}
+inline bool CSVCMsg_FixAngle::has_angle() const {
+  return _internal_has_angle();
+}
+inline const ::CMsgQAngle& CSVCMsg_FixAngle::_internal_angle() const {
+  const ::CMsgQAngle* p = _impl_.angle_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgQAngle&>(
+      ::_CMsgQAngle_default_instance_);
+}
+inline const ::CMsgQAngle& CSVCMsg_FixAngle::angle() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_FixAngle.angle)
+  return _internal_angle();
+}
+inline void CSVCMsg_FixAngle::unsafe_arena_set_allocated_angle(
+    ::CMsgQAngle* angle) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.angle_);
+  }
+  _impl_.angle_ = angle;
+  if (angle) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CSVCMsg_FixAngle.angle)
+}
+inline ::CMsgQAngle* CSVCMsg_FixAngle::release_angle() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgQAngle* temp = _impl_.angle_;
+  _impl_.angle_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgQAngle* CSVCMsg_FixAngle::unsafe_arena_release_angle() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_FixAngle.angle)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgQAngle* temp = _impl_.angle_;
+  _impl_.angle_ = nullptr;
+  return temp;
+}
+inline ::CMsgQAngle* CSVCMsg_FixAngle::_internal_mutable_angle() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.angle_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgQAngle>(GetArenaForAllocation());
+    _impl_.angle_ = p;
+  }
+  return _impl_.angle_;
+}
+inline ::CMsgQAngle* CSVCMsg_FixAngle::mutable_angle() {
+  ::CMsgQAngle* _msg = _internal_mutable_angle();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_FixAngle.angle)
+  return _msg;
+}
+inline void CSVCMsg_FixAngle::set_allocated_angle(::CMsgQAngle* angle) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.angle_);
+  }
+  if (angle) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(angle));
+    if (message_arena != submessage_arena) {
+      angle = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, angle, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.angle_ = angle;
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_FixAngle.angle)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_CrosshairAngle
+
+// optional .CMsgQAngle angle = 1;
+inline bool CSVCMsg_CrosshairAngle::_internal_has_angle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.angle_ != nullptr);
+  return value;
+}
+inline bool CSVCMsg_CrosshairAngle::has_angle() const {
+  return _internal_has_angle();
+}
+inline const ::CMsgQAngle& CSVCMsg_CrosshairAngle::_internal_angle() const {
+  const ::CMsgQAngle* p = _impl_.angle_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgQAngle&>(
+      ::_CMsgQAngle_default_instance_);
+}
+inline const ::CMsgQAngle& CSVCMsg_CrosshairAngle::angle() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_CrosshairAngle.angle)
+  return _internal_angle();
+}
+inline void CSVCMsg_CrosshairAngle::unsafe_arena_set_allocated_angle(
+    ::CMsgQAngle* angle) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.angle_);
+  }
+  _impl_.angle_ = angle;
+  if (angle) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CSVCMsg_CrosshairAngle.angle)
+}
+inline ::CMsgQAngle* CSVCMsg_CrosshairAngle::release_angle() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgQAngle* temp = _impl_.angle_;
+  _impl_.angle_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgQAngle* CSVCMsg_CrosshairAngle::unsafe_arena_release_angle() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_CrosshairAngle.angle)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgQAngle* temp = _impl_.angle_;
+  _impl_.angle_ = nullptr;
+  return temp;
+}
+inline ::CMsgQAngle* CSVCMsg_CrosshairAngle::_internal_mutable_angle() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.angle_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgQAngle>(GetArenaForAllocation());
+    _impl_.angle_ = p;
+  }
+  return _impl_.angle_;
+}
+inline ::CMsgQAngle* CSVCMsg_CrosshairAngle::mutable_angle() {
+  ::CMsgQAngle* _msg = _internal_mutable_angle();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_CrosshairAngle.angle)
+  return _msg;
+}
+inline void CSVCMsg_CrosshairAngle::set_allocated_angle(::CMsgQAngle* angle) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.angle_);
+  }
+  if (angle) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(angle));
+    if (message_arena != submessage_arena) {
+      angle = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, angle, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.angle_ = angle;
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_CrosshairAngle.angle)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_BSPDecal
+
+// optional .CMsgVector pos = 1;
+inline bool CSVCMsg_BSPDecal::_internal_has_pos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pos_ != nullptr);
+  return value;
+}
+inline bool CSVCMsg_BSPDecal::has_pos() const {
+  return _internal_has_pos();
+}
+inline const ::CMsgVector& CSVCMsg_BSPDecal::_internal_pos() const {
+  const ::CMsgVector* p = _impl_.pos_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgVector&>(
+      ::_CMsgVector_default_instance_);
+}
+inline const ::CMsgVector& CSVCMsg_BSPDecal::pos() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_BSPDecal.pos)
+  return _internal_pos();
+}
+inline void CSVCMsg_BSPDecal::unsafe_arena_set_allocated_pos(
+    ::CMsgVector* pos) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pos_);
+  }
+  _impl_.pos_ = pos;
+  if (pos) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CSVCMsg_BSPDecal.pos)
+}
+inline ::CMsgVector* CSVCMsg_BSPDecal::release_pos() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgVector* temp = _impl_.pos_;
+  _impl_.pos_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgVector* CSVCMsg_BSPDecal::unsafe_arena_release_pos() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_BSPDecal.pos)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgVector* temp = _impl_.pos_;
+  _impl_.pos_ = nullptr;
+  return temp;
+}
+inline ::CMsgVector* CSVCMsg_BSPDecal::_internal_mutable_pos() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.pos_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgVector>(GetArenaForAllocation());
+    _impl_.pos_ = p;
+  }
+  return _impl_.pos_;
+}
+inline ::CMsgVector* CSVCMsg_BSPDecal::mutable_pos() {
+  ::CMsgVector* _msg = _internal_mutable_pos();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_BSPDecal.pos)
+  return _msg;
+}
+inline void CSVCMsg_BSPDecal::set_allocated_pos(::CMsgVector* pos) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pos_);
+  }
+  if (pos) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pos));
+    if (message_arena != submessage_arena) {
+      pos = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pos, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.pos_ = pos;
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_BSPDecal.pos)
+}
+
+// optional int32 decal_texture_index = 2;
+inline bool CSVCMsg_BSPDecal::_internal_has_decal_texture_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_BSPDecal::has_decal_texture_index() const {
+  return _internal_has_decal_texture_index();
+}
+inline void CSVCMsg_BSPDecal::clear_decal_texture_index() {
+  _impl_.decal_texture_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_BSPDecal::_internal_decal_texture_index() const {
+  return _impl_.decal_texture_index_;
+}
+inline int32_t CSVCMsg_BSPDecal::decal_texture_index() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_BSPDecal.decal_texture_index)
+  return _internal_decal_texture_index();
+}
+inline void CSVCMsg_BSPDecal::_internal_set_decal_texture_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.decal_texture_index_ = value;
+}
+inline void CSVCMsg_BSPDecal::set_decal_texture_index(int32_t value) {
+  _internal_set_decal_texture_index(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_BSPDecal.decal_texture_index)
+}
+
+// optional int32 entity_index = 3;
+inline bool CSVCMsg_BSPDecal::_internal_has_entity_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_BSPDecal::has_entity_index() const {
+  return _internal_has_entity_index();
+}
+inline void CSVCMsg_BSPDecal::clear_entity_index() {
+  _impl_.entity_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_BSPDecal::_internal_entity_index() const {
+  return _impl_.entity_index_;
+}
+inline int32_t CSVCMsg_BSPDecal::entity_index() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_BSPDecal.entity_index)
+  return _internal_entity_index();
+}
+inline void CSVCMsg_BSPDecal::_internal_set_entity_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.entity_index_ = value;
+}
+inline void CSVCMsg_BSPDecal::set_entity_index(int32_t value) {
+  _internal_set_entity_index(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_BSPDecal.entity_index)
+}
+
+// optional int32 model_index = 4;
+inline bool CSVCMsg_BSPDecal::_internal_has_model_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSVCMsg_BSPDecal::has_model_index() const {
+  return _internal_has_model_index();
+}
+inline void CSVCMsg_BSPDecal::clear_model_index() {
+  _impl_.model_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CSVCMsg_BSPDecal::_internal_model_index() const {
+  return _impl_.model_index_;
+}
+inline int32_t CSVCMsg_BSPDecal::model_index() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_BSPDecal.model_index)
+  return _internal_model_index();
+}
+inline void CSVCMsg_BSPDecal::_internal_set_model_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.model_index_ = value;
+}
+inline void CSVCMsg_BSPDecal::set_model_index(int32_t value) {
+  _internal_set_model_index(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_BSPDecal.model_index)
+}
+
+// optional bool low_priority = 5;
+inline bool CSVCMsg_BSPDecal::_internal_has_low_priority() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CSVCMsg_BSPDecal::has_low_priority() const {
+  return _internal_has_low_priority();
+}
+inline void CSVCMsg_BSPDecal::clear_low_priority() {
+  _impl_.low_priority_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool CSVCMsg_BSPDecal::_internal_low_priority() const {
+  return _impl_.low_priority_;
+}
+inline bool CSVCMsg_BSPDecal::low_priority() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_BSPDecal.low_priority)
+  return _internal_low_priority();
+}
+inline void CSVCMsg_BSPDecal::_internal_set_low_priority(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.low_priority_ = value;
+}
+inline void CSVCMsg_BSPDecal::set_low_priority(bool value) {
+  _internal_set_low_priority(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_BSPDecal.low_priority)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_SplitScreen
+
+// optional .ESplitScreenMessageType type = 1 [default = MSG_SPLITSCREEN_ADDUSER];
+inline bool CSVCMsg_SplitScreen::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SplitScreen::has_type() const {
+  return _internal_has_type();
+}
+inline void CSVCMsg_SplitScreen::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::ESplitScreenMessageType CSVCMsg_SplitScreen::_internal_type() const {
+  return static_cast< ::ESplitScreenMessageType >(_impl_.type_);
+}
+inline ::ESplitScreenMessageType CSVCMsg_SplitScreen::type() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SplitScreen.type)
+  return _internal_type();
+}
+inline void CSVCMsg_SplitScreen::_internal_set_type(::ESplitScreenMessageType value) {
+  assert(::ESplitScreenMessageType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_ = value;
+}
+inline void CSVCMsg_SplitScreen::set_type(::ESplitScreenMessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SplitScreen.type)
+}
+
+// optional int32 slot = 2;
+inline bool CSVCMsg_SplitScreen::_internal_has_slot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SplitScreen::has_slot() const {
+  return _internal_has_slot();
+}
+inline void CSVCMsg_SplitScreen::clear_slot() {
+  _impl_.slot_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_SplitScreen::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline int32_t CSVCMsg_SplitScreen::slot() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SplitScreen.slot)
+  return _internal_slot();
+}
+inline void CSVCMsg_SplitScreen::_internal_set_slot(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.slot_ = value;
+}
+inline void CSVCMsg_SplitScreen::set_slot(int32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SplitScreen.slot)
+}
+
+// optional int32 player_index = 3;
+inline bool CSVCMsg_SplitScreen::_internal_has_player_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SplitScreen::has_player_index() const {
+  return _internal_has_player_index();
+}
+inline void CSVCMsg_SplitScreen::clear_player_index() {
+  _impl_.player_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_SplitScreen::_internal_player_index() const {
+  return _impl_.player_index_;
+}
+inline int32_t CSVCMsg_SplitScreen::player_index() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SplitScreen.player_index)
+  return _internal_player_index();
+}
+inline void CSVCMsg_SplitScreen::_internal_set_player_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.player_index_ = value;
+}
+inline void CSVCMsg_SplitScreen::set_player_index(int32_t value) {
+  _internal_set_player_index(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SplitScreen.player_index)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_GetCvarValue
+
+// optional int32 cookie = 1;
+inline bool CSVCMsg_GetCvarValue::_internal_has_cookie() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GetCvarValue::has_cookie() const {
+  return _internal_has_cookie();
+}
+inline void CSVCMsg_GetCvarValue::clear_cookie() {
+  _impl_.cookie_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_GetCvarValue::_internal_cookie() const {
+  return _impl_.cookie_;
+}
+inline int32_t CSVCMsg_GetCvarValue::cookie() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GetCvarValue.cookie)
+  return _internal_cookie();
+}
+inline void CSVCMsg_GetCvarValue::_internal_set_cookie(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.cookie_ = value;
+}
+inline void CSVCMsg_GetCvarValue::set_cookie(int32_t value) {
+  _internal_set_cookie(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GetCvarValue.cookie)
+}
+
+// optional string cvar_name = 2;
+inline bool CSVCMsg_GetCvarValue::_internal_has_cvar_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GetCvarValue::has_cvar_name() const {
+  return _internal_has_cvar_name();
+}
+inline void CSVCMsg_GetCvarValue::clear_cvar_name() {
+  _impl_.cvar_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_GetCvarValue::cvar_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GetCvarValue.cvar_name)
+  return _internal_cvar_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_GetCvarValue::set_cvar_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.cvar_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_GetCvarValue.cvar_name)
+}
+inline std::string* CSVCMsg_GetCvarValue::mutable_cvar_name() {
+  std::string* _s = _internal_mutable_cvar_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_GetCvarValue.cvar_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_GetCvarValue::_internal_cvar_name() const {
+  return _impl_.cvar_name_.Get();
+}
+inline void CSVCMsg_GetCvarValue::_internal_set_cvar_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cvar_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GetCvarValue::_internal_mutable_cvar_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.cvar_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GetCvarValue::release_cvar_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_GetCvarValue.cvar_name)
+  if (!_internal_has_cvar_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.cvar_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cvar_name_.IsDefault()) {
+    _impl_.cvar_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_GetCvarValue::set_allocated_cvar_name(std::string* cvar_name) {
+  if (cvar_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.cvar_name_.SetAllocated(cvar_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cvar_name_.IsDefault()) {
+    _impl_.cvar_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_GetCvarValue.cvar_name)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_Menu
+
+// optional int32 dialog_type = 1;
+inline bool CSVCMsg_Menu::_internal_has_dialog_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Menu::has_dialog_type() const {
+  return _internal_has_dialog_type();
+}
+inline void CSVCMsg_Menu::clear_dialog_type() {
+  _impl_.dialog_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_Menu::_internal_dialog_type() const {
+  return _impl_.dialog_type_;
+}
+inline int32_t CSVCMsg_Menu::dialog_type() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Menu.dialog_type)
+  return _internal_dialog_type();
+}
+inline void CSVCMsg_Menu::_internal_set_dialog_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.dialog_type_ = value;
+}
+inline void CSVCMsg_Menu::set_dialog_type(int32_t value) {
+  _internal_set_dialog_type(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_Menu.dialog_type)
+}
+
+// optional bytes menu_key_values = 2;
+inline bool CSVCMsg_Menu::_internal_has_menu_key_values() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_Menu::has_menu_key_values() const {
+  return _internal_has_menu_key_values();
+}
+inline void CSVCMsg_Menu::clear_menu_key_values() {
+  _impl_.menu_key_values_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_Menu::menu_key_values() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_Menu.menu_key_values)
+  return _internal_menu_key_values();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_Menu::set_menu_key_values(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.menu_key_values_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_Menu.menu_key_values)
+}
+inline std::string* CSVCMsg_Menu::mutable_menu_key_values() {
+  std::string* _s = _internal_mutable_menu_key_values();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_Menu.menu_key_values)
+  return _s;
+}
+inline const std::string& CSVCMsg_Menu::_internal_menu_key_values() const {
+  return _impl_.menu_key_values_.Get();
+}
+inline void CSVCMsg_Menu::_internal_set_menu_key_values(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.menu_key_values_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_Menu::_internal_mutable_menu_key_values() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.menu_key_values_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_Menu::release_menu_key_values() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_Menu.menu_key_values)
+  if (!_internal_has_menu_key_values()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.menu_key_values_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.menu_key_values_.IsDefault()) {
+    _impl_.menu_key_values_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_Menu::set_allocated_menu_key_values(std::string* menu_key_values) {
+  if (menu_key_values != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.menu_key_values_.SetAllocated(menu_key_values, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.menu_key_values_.IsDefault()) {
+    _impl_.menu_key_values_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_Menu.menu_key_values)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_SendTable_sendprop_t
+
+// optional int32 type = 1;
+inline bool CSVCMsg_SendTable_sendprop_t::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable_sendprop_t::has_type() const {
+  return _internal_has_type();
+}
+inline void CSVCMsg_SendTable_sendprop_t::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::type() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.sendprop_t.type)
+  return _internal_type();
+}
+inline void CSVCMsg_SendTable_sendprop_t::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.type_ = value;
+}
+inline void CSVCMsg_SendTable_sendprop_t::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.sendprop_t.type)
+}
+
+// optional string var_name = 2;
+inline bool CSVCMsg_SendTable_sendprop_t::_internal_has_var_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable_sendprop_t::has_var_name() const {
+  return _internal_has_var_name();
+}
+inline void CSVCMsg_SendTable_sendprop_t::clear_var_name() {
+  _impl_.var_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_SendTable_sendprop_t::var_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.sendprop_t.var_name)
+  return _internal_var_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_SendTable_sendprop_t::set_var_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.var_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.sendprop_t.var_name)
+}
+inline std::string* CSVCMsg_SendTable_sendprop_t::mutable_var_name() {
+  std::string* _s = _internal_mutable_var_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_SendTable.sendprop_t.var_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_SendTable_sendprop_t::_internal_var_name() const {
+  return _impl_.var_name_.Get();
+}
+inline void CSVCMsg_SendTable_sendprop_t::_internal_set_var_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.var_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_SendTable_sendprop_t::_internal_mutable_var_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.var_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_SendTable_sendprop_t::release_var_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_SendTable.sendprop_t.var_name)
+  if (!_internal_has_var_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.var_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var_name_.IsDefault()) {
+    _impl_.var_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_SendTable_sendprop_t::set_allocated_var_name(std::string* var_name) {
+  if (var_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.var_name_.SetAllocated(var_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var_name_.IsDefault()) {
+    _impl_.var_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_SendTable.sendprop_t.var_name)
+}
+
+// optional int32 flags = 3;
+inline bool CSVCMsg_SendTable_sendprop_t::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable_sendprop_t::has_flags() const {
+  return _internal_has_flags();
+}
+inline void CSVCMsg_SendTable_sendprop_t::clear_flags() {
+  _impl_.flags_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::flags() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.sendprop_t.flags)
+  return _internal_flags();
+}
+inline void CSVCMsg_SendTable_sendprop_t::_internal_set_flags(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.flags_ = value;
+}
+inline void CSVCMsg_SendTable_sendprop_t::set_flags(int32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.sendprop_t.flags)
+}
+
+// optional int32 priority = 4;
+inline bool CSVCMsg_SendTable_sendprop_t::_internal_has_priority() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable_sendprop_t::has_priority() const {
+  return _internal_has_priority();
+}
+inline void CSVCMsg_SendTable_sendprop_t::clear_priority() {
+  _impl_.priority_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::priority() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.sendprop_t.priority)
+  return _internal_priority();
+}
+inline void CSVCMsg_SendTable_sendprop_t::_internal_set_priority(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.priority_ = value;
+}
+inline void CSVCMsg_SendTable_sendprop_t::set_priority(int32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.sendprop_t.priority)
+}
+
+// optional string dt_name = 5;
+inline bool CSVCMsg_SendTable_sendprop_t::_internal_has_dt_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable_sendprop_t::has_dt_name() const {
+  return _internal_has_dt_name();
+}
+inline void CSVCMsg_SendTable_sendprop_t::clear_dt_name() {
+  _impl_.dt_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CSVCMsg_SendTable_sendprop_t::dt_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.sendprop_t.dt_name)
+  return _internal_dt_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_SendTable_sendprop_t::set_dt_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.dt_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.sendprop_t.dt_name)
+}
+inline std::string* CSVCMsg_SendTable_sendprop_t::mutable_dt_name() {
+  std::string* _s = _internal_mutable_dt_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_SendTable.sendprop_t.dt_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_SendTable_sendprop_t::_internal_dt_name() const {
+  return _impl_.dt_name_.Get();
+}
+inline void CSVCMsg_SendTable_sendprop_t::_internal_set_dt_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.dt_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_SendTable_sendprop_t::_internal_mutable_dt_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.dt_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_SendTable_sendprop_t::release_dt_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_SendTable.sendprop_t.dt_name)
+  if (!_internal_has_dt_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.dt_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.dt_name_.IsDefault()) {
+    _impl_.dt_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_SendTable_sendprop_t::set_allocated_dt_name(std::string* dt_name) {
+  if (dt_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.dt_name_.SetAllocated(dt_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.dt_name_.IsDefault()) {
+    _impl_.dt_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_SendTable.sendprop_t.dt_name)
+}
+
+// optional int32 num_elements = 6;
+inline bool CSVCMsg_SendTable_sendprop_t::_internal_has_num_elements() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable_sendprop_t::has_num_elements() const {
+  return _internal_has_num_elements();
+}
+inline void CSVCMsg_SendTable_sendprop_t::clear_num_elements() {
+  _impl_.num_elements_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::_internal_num_elements() const {
+  return _impl_.num_elements_;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::num_elements() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.sendprop_t.num_elements)
+  return _internal_num_elements();
+}
+inline void CSVCMsg_SendTable_sendprop_t::_internal_set_num_elements(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.num_elements_ = value;
+}
+inline void CSVCMsg_SendTable_sendprop_t::set_num_elements(int32_t value) {
+  _internal_set_num_elements(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.sendprop_t.num_elements)
+}
+
+// optional float low_value = 7;
+inline bool CSVCMsg_SendTable_sendprop_t::_internal_has_low_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable_sendprop_t::has_low_value() const {
+  return _internal_has_low_value();
+}
+inline void CSVCMsg_SendTable_sendprop_t::clear_low_value() {
+  _impl_.low_value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline float CSVCMsg_SendTable_sendprop_t::_internal_low_value() const {
+  return _impl_.low_value_;
+}
+inline float CSVCMsg_SendTable_sendprop_t::low_value() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.sendprop_t.low_value)
+  return _internal_low_value();
+}
+inline void CSVCMsg_SendTable_sendprop_t::_internal_set_low_value(float value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.low_value_ = value;
+}
+inline void CSVCMsg_SendTable_sendprop_t::set_low_value(float value) {
+  _internal_set_low_value(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.sendprop_t.low_value)
+}
+
+// optional float high_value = 8;
+inline bool CSVCMsg_SendTable_sendprop_t::_internal_has_high_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable_sendprop_t::has_high_value() const {
+  return _internal_has_high_value();
+}
+inline void CSVCMsg_SendTable_sendprop_t::clear_high_value() {
+  _impl_.high_value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline float CSVCMsg_SendTable_sendprop_t::_internal_high_value() const {
+  return _impl_.high_value_;
+}
+inline float CSVCMsg_SendTable_sendprop_t::high_value() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.sendprop_t.high_value)
+  return _internal_high_value();
+}
+inline void CSVCMsg_SendTable_sendprop_t::_internal_set_high_value(float value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.high_value_ = value;
+}
+inline void CSVCMsg_SendTable_sendprop_t::set_high_value(float value) {
+  _internal_set_high_value(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.sendprop_t.high_value)
+}
+
+// optional int32 num_bits = 9;
+inline bool CSVCMsg_SendTable_sendprop_t::_internal_has_num_bits() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable_sendprop_t::has_num_bits() const {
+  return _internal_has_num_bits();
+}
+inline void CSVCMsg_SendTable_sendprop_t::clear_num_bits() {
+  _impl_.num_bits_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::_internal_num_bits() const {
+  return _impl_.num_bits_;
+}
+inline int32_t CSVCMsg_SendTable_sendprop_t::num_bits() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.sendprop_t.num_bits)
+  return _internal_num_bits();
+}
+inline void CSVCMsg_SendTable_sendprop_t::_internal_set_num_bits(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.num_bits_ = value;
+}
+inline void CSVCMsg_SendTable_sendprop_t::set_num_bits(int32_t value) {
+  _internal_set_num_bits(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.sendprop_t.num_bits)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_SendTable
+
+// optional bool is_end = 1;
+inline bool CSVCMsg_SendTable::_internal_has_is_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable::has_is_end() const {
+  return _internal_has_is_end();
+}
+inline void CSVCMsg_SendTable::clear_is_end() {
+  _impl_.is_end_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool CSVCMsg_SendTable::_internal_is_end() const {
+  return _impl_.is_end_;
+}
+inline bool CSVCMsg_SendTable::is_end() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.is_end)
+  return _internal_is_end();
+}
+inline void CSVCMsg_SendTable::_internal_set_is_end(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.is_end_ = value;
+}
+inline void CSVCMsg_SendTable::set_is_end(bool value) {
+  _internal_set_is_end(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.is_end)
+}
+
+// optional string net_table_name = 2;
+inline bool CSVCMsg_SendTable::_internal_has_net_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable::has_net_table_name() const {
+  return _internal_has_net_table_name();
+}
+inline void CSVCMsg_SendTable::clear_net_table_name() {
+  _impl_.net_table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_SendTable::net_table_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.net_table_name)
+  return _internal_net_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_SendTable::set_net_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.net_table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.net_table_name)
+}
+inline std::string* CSVCMsg_SendTable::mutable_net_table_name() {
+  std::string* _s = _internal_mutable_net_table_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_SendTable.net_table_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_SendTable::_internal_net_table_name() const {
+  return _impl_.net_table_name_.Get();
+}
+inline void CSVCMsg_SendTable::_internal_set_net_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.net_table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_SendTable::_internal_mutable_net_table_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.net_table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_SendTable::release_net_table_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_SendTable.net_table_name)
+  if (!_internal_has_net_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.net_table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.net_table_name_.IsDefault()) {
+    _impl_.net_table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_SendTable::set_allocated_net_table_name(std::string* net_table_name) {
+  if (net_table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.net_table_name_.SetAllocated(net_table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.net_table_name_.IsDefault()) {
+    _impl_.net_table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_SendTable.net_table_name)
+}
+
+// optional bool needs_decoder = 3;
+inline bool CSVCMsg_SendTable::_internal_has_needs_decoder() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_SendTable::has_needs_decoder() const {
+  return _internal_has_needs_decoder();
+}
+inline void CSVCMsg_SendTable::clear_needs_decoder() {
+  _impl_.needs_decoder_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CSVCMsg_SendTable::_internal_needs_decoder() const {
+  return _impl_.needs_decoder_;
+}
+inline bool CSVCMsg_SendTable::needs_decoder() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.needs_decoder)
+  return _internal_needs_decoder();
+}
+inline void CSVCMsg_SendTable::_internal_set_needs_decoder(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.needs_decoder_ = value;
+}
+inline void CSVCMsg_SendTable::set_needs_decoder(bool value) {
+  _internal_set_needs_decoder(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_SendTable.needs_decoder)
+}
+
+// repeated .CSVCMsg_SendTable.sendprop_t props = 4;
+inline int CSVCMsg_SendTable::_internal_props_size() const {
+  return _impl_.props_.size();
+}
+inline int CSVCMsg_SendTable::props_size() const {
+  return _internal_props_size();
+}
+inline void CSVCMsg_SendTable::clear_props() {
+  _impl_.props_.Clear();
+}
+inline ::CSVCMsg_SendTable_sendprop_t* CSVCMsg_SendTable::mutable_props(int index) {
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_SendTable.props)
+  return _impl_.props_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_SendTable_sendprop_t >*
+CSVCMsg_SendTable::mutable_props() {
+  // @@protoc_insertion_point(field_mutable_list:CSVCMsg_SendTable.props)
+  return &_impl_.props_;
+}
+inline const ::CSVCMsg_SendTable_sendprop_t& CSVCMsg_SendTable::_internal_props(int index) const {
+  return _impl_.props_.Get(index);
+}
+inline const ::CSVCMsg_SendTable_sendprop_t& CSVCMsg_SendTable::props(int index) const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_SendTable.props)
+  return _internal_props(index);
+}
+inline ::CSVCMsg_SendTable_sendprop_t* CSVCMsg_SendTable::_internal_add_props() {
+  return _impl_.props_.Add();
+}
+inline ::CSVCMsg_SendTable_sendprop_t* CSVCMsg_SendTable::add_props() {
+  ::CSVCMsg_SendTable_sendprop_t* _add = _internal_add_props();
+  // @@protoc_insertion_point(field_add:CSVCMsg_SendTable.props)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_SendTable_sendprop_t >&
+CSVCMsg_SendTable::props() const {
+  // @@protoc_insertion_point(field_list:CSVCMsg_SendTable.props)
+  return _impl_.props_;
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_GameEventList_key_t
+
+// optional int32 type = 1;
+inline bool CSVCMsg_GameEventList_key_t::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEventList_key_t::has_type() const {
+  return _internal_has_type();
+}
+inline void CSVCMsg_GameEventList_key_t::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_GameEventList_key_t::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t CSVCMsg_GameEventList_key_t::type() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEventList.key_t.type)
+  return _internal_type();
+}
+inline void CSVCMsg_GameEventList_key_t::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void CSVCMsg_GameEventList_key_t::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEventList.key_t.type)
+}
+
+// optional string name = 2;
+inline bool CSVCMsg_GameEventList_key_t::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEventList_key_t::has_name() const {
+  return _internal_has_name();
+}
+inline void CSVCMsg_GameEventList_key_t::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_GameEventList_key_t::name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEventList.key_t.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_GameEventList_key_t::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEventList.key_t.name)
+}
+inline std::string* CSVCMsg_GameEventList_key_t::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_GameEventList.key_t.name)
+  return _s;
+}
+inline const std::string& CSVCMsg_GameEventList_key_t::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CSVCMsg_GameEventList_key_t::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GameEventList_key_t::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GameEventList_key_t::release_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_GameEventList.key_t.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_GameEventList_key_t::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_GameEventList.key_t.name)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_GameEventList_descriptor_t
+
+// optional int32 eventid = 1;
+inline bool CSVCMsg_GameEventList_descriptor_t::_internal_has_eventid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEventList_descriptor_t::has_eventid() const {
+  return _internal_has_eventid();
+}
+inline void CSVCMsg_GameEventList_descriptor_t::clear_eventid() {
+  _impl_.eventid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_GameEventList_descriptor_t::_internal_eventid() const {
+  return _impl_.eventid_;
+}
+inline int32_t CSVCMsg_GameEventList_descriptor_t::eventid() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEventList.descriptor_t.eventid)
+  return _internal_eventid();
+}
+inline void CSVCMsg_GameEventList_descriptor_t::_internal_set_eventid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.eventid_ = value;
+}
+inline void CSVCMsg_GameEventList_descriptor_t::set_eventid(int32_t value) {
+  _internal_set_eventid(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEventList.descriptor_t.eventid)
+}
+
+// optional string name = 2;
+inline bool CSVCMsg_GameEventList_descriptor_t::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEventList_descriptor_t::has_name() const {
+  return _internal_has_name();
+}
+inline void CSVCMsg_GameEventList_descriptor_t::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_GameEventList_descriptor_t::name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEventList.descriptor_t.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_GameEventList_descriptor_t::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEventList.descriptor_t.name)
+}
+inline std::string* CSVCMsg_GameEventList_descriptor_t::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_GameEventList.descriptor_t.name)
+  return _s;
+}
+inline const std::string& CSVCMsg_GameEventList_descriptor_t::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CSVCMsg_GameEventList_descriptor_t::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GameEventList_descriptor_t::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GameEventList_descriptor_t::release_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_GameEventList.descriptor_t.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_GameEventList_descriptor_t::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_GameEventList.descriptor_t.name)
+}
+
+// repeated .CSVCMsg_GameEventList.key_t keys = 3;
+inline int CSVCMsg_GameEventList_descriptor_t::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int CSVCMsg_GameEventList_descriptor_t::keys_size() const {
+  return _internal_keys_size();
+}
+inline void CSVCMsg_GameEventList_descriptor_t::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline ::CSVCMsg_GameEventList_key_t* CSVCMsg_GameEventList_descriptor_t::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_GameEventList.descriptor_t.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_key_t >*
+CSVCMsg_GameEventList_descriptor_t::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:CSVCMsg_GameEventList.descriptor_t.keys)
+  return &_impl_.keys_;
+}
+inline const ::CSVCMsg_GameEventList_key_t& CSVCMsg_GameEventList_descriptor_t::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const ::CSVCMsg_GameEventList_key_t& CSVCMsg_GameEventList_descriptor_t::keys(int index) const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEventList.descriptor_t.keys)
+  return _internal_keys(index);
+}
+inline ::CSVCMsg_GameEventList_key_t* CSVCMsg_GameEventList_descriptor_t::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline ::CSVCMsg_GameEventList_key_t* CSVCMsg_GameEventList_descriptor_t::add_keys() {
+  ::CSVCMsg_GameEventList_key_t* _add = _internal_add_keys();
+  // @@protoc_insertion_point(field_add:CSVCMsg_GameEventList.descriptor_t.keys)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_key_t >&
+CSVCMsg_GameEventList_descriptor_t::keys() const {
+  // @@protoc_insertion_point(field_list:CSVCMsg_GameEventList.descriptor_t.keys)
+  return _impl_.keys_;
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_GameEventList
+
+// repeated .CSVCMsg_GameEventList.descriptor_t descriptors = 1;
+inline int CSVCMsg_GameEventList::_internal_descriptors_size() const {
+  return _impl_.descriptors_.size();
+}
+inline int CSVCMsg_GameEventList::descriptors_size() const {
+  return _internal_descriptors_size();
+}
+inline void CSVCMsg_GameEventList::clear_descriptors() {
+  _impl_.descriptors_.Clear();
+}
+inline ::CSVCMsg_GameEventList_descriptor_t* CSVCMsg_GameEventList::mutable_descriptors(int index) {
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_GameEventList.descriptors)
+  return _impl_.descriptors_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_descriptor_t >*
+CSVCMsg_GameEventList::mutable_descriptors() {
+  // @@protoc_insertion_point(field_mutable_list:CSVCMsg_GameEventList.descriptors)
+  return &_impl_.descriptors_;
+}
+inline const ::CSVCMsg_GameEventList_descriptor_t& CSVCMsg_GameEventList::_internal_descriptors(int index) const {
+  return _impl_.descriptors_.Get(index);
+}
+inline const ::CSVCMsg_GameEventList_descriptor_t& CSVCMsg_GameEventList::descriptors(int index) const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEventList.descriptors)
+  return _internal_descriptors(index);
+}
+inline ::CSVCMsg_GameEventList_descriptor_t* CSVCMsg_GameEventList::_internal_add_descriptors() {
+  return _impl_.descriptors_.Add();
+}
+inline ::CSVCMsg_GameEventList_descriptor_t* CSVCMsg_GameEventList::add_descriptors() {
+  ::CSVCMsg_GameEventList_descriptor_t* _add = _internal_add_descriptors();
+  // @@protoc_insertion_point(field_add:CSVCMsg_GameEventList.descriptors)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEventList_descriptor_t >&
+CSVCMsg_GameEventList::descriptors() const {
+  // @@protoc_insertion_point(field_list:CSVCMsg_GameEventList.descriptors)
+  return _impl_.descriptors_;
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_PacketEntities
+
+// optional int32 max_entries = 1;
+inline bool CSVCMsg_PacketEntities::_internal_has_max_entries() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketEntities::has_max_entries() const {
+  return _internal_has_max_entries();
+}
+inline void CSVCMsg_PacketEntities::clear_max_entries() {
+  _impl_.max_entries_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_PacketEntities::_internal_max_entries() const {
+  return _impl_.max_entries_;
+}
+inline int32_t CSVCMsg_PacketEntities::max_entries() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketEntities.max_entries)
+  return _internal_max_entries();
+}
+inline void CSVCMsg_PacketEntities::_internal_set_max_entries(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_entries_ = value;
+}
+inline void CSVCMsg_PacketEntities::set_max_entries(int32_t value) {
+  _internal_set_max_entries(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketEntities.max_entries)
+}
+
+// optional int32 updated_entries = 2;
+inline bool CSVCMsg_PacketEntities::_internal_has_updated_entries() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketEntities::has_updated_entries() const {
+  return _internal_has_updated_entries();
+}
+inline void CSVCMsg_PacketEntities::clear_updated_entries() {
+  _impl_.updated_entries_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_PacketEntities::_internal_updated_entries() const {
+  return _impl_.updated_entries_;
+}
+inline int32_t CSVCMsg_PacketEntities::updated_entries() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketEntities.updated_entries)
+  return _internal_updated_entries();
+}
+inline void CSVCMsg_PacketEntities::_internal_set_updated_entries(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.updated_entries_ = value;
+}
+inline void CSVCMsg_PacketEntities::set_updated_entries(int32_t value) {
+  _internal_set_updated_entries(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketEntities.updated_entries)
+}
+
+// optional bool is_delta = 3;
+inline bool CSVCMsg_PacketEntities::_internal_has_is_delta() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketEntities::has_is_delta() const {
+  return _internal_has_is_delta();
+}
+inline void CSVCMsg_PacketEntities::clear_is_delta() {
+  _impl_.is_delta_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool CSVCMsg_PacketEntities::_internal_is_delta() const {
+  return _impl_.is_delta_;
+}
+inline bool CSVCMsg_PacketEntities::is_delta() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketEntities.is_delta)
+  return _internal_is_delta();
+}
+inline void CSVCMsg_PacketEntities::_internal_set_is_delta(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.is_delta_ = value;
+}
+inline void CSVCMsg_PacketEntities::set_is_delta(bool value) {
+  _internal_set_is_delta(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketEntities.is_delta)
+}
+
+// optional bool update_baseline = 4;
+inline bool CSVCMsg_PacketEntities::_internal_has_update_baseline() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketEntities::has_update_baseline() const {
+  return _internal_has_update_baseline();
+}
+inline void CSVCMsg_PacketEntities::clear_update_baseline() {
+  _impl_.update_baseline_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool CSVCMsg_PacketEntities::_internal_update_baseline() const {
+  return _impl_.update_baseline_;
+}
+inline bool CSVCMsg_PacketEntities::update_baseline() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketEntities.update_baseline)
+  return _internal_update_baseline();
+}
+inline void CSVCMsg_PacketEntities::_internal_set_update_baseline(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.update_baseline_ = value;
+}
+inline void CSVCMsg_PacketEntities::set_update_baseline(bool value) {
+  _internal_set_update_baseline(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketEntities.update_baseline)
+}
+
+// optional int32 baseline = 5;
+inline bool CSVCMsg_PacketEntities::_internal_has_baseline() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketEntities::has_baseline() const {
+  return _internal_has_baseline();
+}
+inline void CSVCMsg_PacketEntities::clear_baseline() {
+  _impl_.baseline_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CSVCMsg_PacketEntities::_internal_baseline() const {
+  return _impl_.baseline_;
+}
+inline int32_t CSVCMsg_PacketEntities::baseline() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketEntities.baseline)
+  return _internal_baseline();
+}
+inline void CSVCMsg_PacketEntities::_internal_set_baseline(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.baseline_ = value;
+}
+inline void CSVCMsg_PacketEntities::set_baseline(int32_t value) {
+  _internal_set_baseline(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketEntities.baseline)
+}
+
+// optional int32 delta_from = 6;
+inline bool CSVCMsg_PacketEntities::_internal_has_delta_from() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketEntities::has_delta_from() const {
+  return _internal_has_delta_from();
+}
+inline void CSVCMsg_PacketEntities::clear_delta_from() {
+  _impl_.delta_from_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t CSVCMsg_PacketEntities::_internal_delta_from() const {
+  return _impl_.delta_from_;
+}
+inline int32_t CSVCMsg_PacketEntities::delta_from() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketEntities.delta_from)
+  return _internal_delta_from();
+}
+inline void CSVCMsg_PacketEntities::_internal_set_delta_from(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.delta_from_ = value;
+}
+inline void CSVCMsg_PacketEntities::set_delta_from(int32_t value) {
+  _internal_set_delta_from(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketEntities.delta_from)
+}
+
+// optional bytes entity_data = 7;
+inline bool CSVCMsg_PacketEntities::_internal_has_entity_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketEntities::has_entity_data() const {
+  return _internal_has_entity_data();
+}
+inline void CSVCMsg_PacketEntities::clear_entity_data() {
+  _impl_.entity_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_PacketEntities::entity_data() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketEntities.entity_data)
+  return _internal_entity_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_PacketEntities::set_entity_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.entity_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketEntities.entity_data)
+}
+inline std::string* CSVCMsg_PacketEntities::mutable_entity_data() {
+  std::string* _s = _internal_mutable_entity_data();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_PacketEntities.entity_data)
+  return _s;
+}
+inline const std::string& CSVCMsg_PacketEntities::_internal_entity_data() const {
+  return _impl_.entity_data_.Get();
+}
+inline void CSVCMsg_PacketEntities::_internal_set_entity_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.entity_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_PacketEntities::_internal_mutable_entity_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.entity_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_PacketEntities::release_entity_data() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_PacketEntities.entity_data)
+  if (!_internal_has_entity_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.entity_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entity_data_.IsDefault()) {
+    _impl_.entity_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_PacketEntities::set_allocated_entity_data(std::string* entity_data) {
+  if (entity_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.entity_data_.SetAllocated(entity_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entity_data_.IsDefault()) {
+    _impl_.entity_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_PacketEntities.entity_data)
+}
+
+// optional bool pending_full_frame = 8;
+inline bool CSVCMsg_PacketEntities::_internal_has_pending_full_frame() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketEntities::has_pending_full_frame() const {
+  return _internal_has_pending_full_frame();
+}
+inline void CSVCMsg_PacketEntities::clear_pending_full_frame() {
+  _impl_.pending_full_frame_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool CSVCMsg_PacketEntities::_internal_pending_full_frame() const {
+  return _impl_.pending_full_frame_;
+}
+inline bool CSVCMsg_PacketEntities::pending_full_frame() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketEntities.pending_full_frame)
+  return _internal_pending_full_frame();
+}
+inline void CSVCMsg_PacketEntities::_internal_set_pending_full_frame(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.pending_full_frame_ = value;
+}
+inline void CSVCMsg_PacketEntities::set_pending_full_frame(bool value) {
+  _internal_set_pending_full_frame(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketEntities.pending_full_frame)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_TempEntities
+
+// optional bool reliable = 1;
+inline bool CSVCMsg_TempEntities::_internal_has_reliable() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_TempEntities::has_reliable() const {
+  return _internal_has_reliable();
+}
+inline void CSVCMsg_TempEntities::clear_reliable() {
+  _impl_.reliable_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool CSVCMsg_TempEntities::_internal_reliable() const {
+  return _impl_.reliable_;
+}
+inline bool CSVCMsg_TempEntities::reliable() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_TempEntities.reliable)
+  return _internal_reliable();
+}
+inline void CSVCMsg_TempEntities::_internal_set_reliable(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.reliable_ = value;
+}
+inline void CSVCMsg_TempEntities::set_reliable(bool value) {
+  _internal_set_reliable(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_TempEntities.reliable)
+}
+
+// optional int32 num_entries = 2;
+inline bool CSVCMsg_TempEntities::_internal_has_num_entries() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_TempEntities::has_num_entries() const {
+  return _internal_has_num_entries();
+}
+inline void CSVCMsg_TempEntities::clear_num_entries() {
+  _impl_.num_entries_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_TempEntities::_internal_num_entries() const {
+  return _impl_.num_entries_;
+}
+inline int32_t CSVCMsg_TempEntities::num_entries() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_TempEntities.num_entries)
+  return _internal_num_entries();
+}
+inline void CSVCMsg_TempEntities::_internal_set_num_entries(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.num_entries_ = value;
+}
+inline void CSVCMsg_TempEntities::set_num_entries(int32_t value) {
+  _internal_set_num_entries(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_TempEntities.num_entries)
+}
+
+// optional bytes entity_data = 3;
+inline bool CSVCMsg_TempEntities::_internal_has_entity_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_TempEntities::has_entity_data() const {
+  return _internal_has_entity_data();
+}
+inline void CSVCMsg_TempEntities::clear_entity_data() {
+  _impl_.entity_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_TempEntities::entity_data() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_TempEntities.entity_data)
+  return _internal_entity_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_TempEntities::set_entity_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.entity_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_TempEntities.entity_data)
+}
+inline std::string* CSVCMsg_TempEntities::mutable_entity_data() {
+  std::string* _s = _internal_mutable_entity_data();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_TempEntities.entity_data)
+  return _s;
+}
+inline const std::string& CSVCMsg_TempEntities::_internal_entity_data() const {
+  return _impl_.entity_data_.Get();
+}
+inline void CSVCMsg_TempEntities::_internal_set_entity_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.entity_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_TempEntities::_internal_mutable_entity_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.entity_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_TempEntities::release_entity_data() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_TempEntities.entity_data)
+  if (!_internal_has_entity_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.entity_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entity_data_.IsDefault()) {
+    _impl_.entity_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_TempEntities::set_allocated_entity_data(std::string* entity_data) {
+  if (entity_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.entity_data_.SetAllocated(entity_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entity_data_.IsDefault()) {
+    _impl_.entity_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_TempEntities.entity_data)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_CreateStringTable
+
+// optional string name = 1;
+inline bool CSVCMsg_CreateStringTable::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_CreateStringTable::has_name() const {
+  return _internal_has_name();
+}
+inline void CSVCMsg_CreateStringTable::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_CreateStringTable::name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_CreateStringTable.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_CreateStringTable::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_CreateStringTable.name)
+}
+inline std::string* CSVCMsg_CreateStringTable::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_CreateStringTable.name)
+  return _s;
+}
+inline const std::string& CSVCMsg_CreateStringTable::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CSVCMsg_CreateStringTable::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_CreateStringTable::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_CreateStringTable::release_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_CreateStringTable.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_CreateStringTable::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_CreateStringTable.name)
+}
+
+// optional int32 max_entries = 2;
+inline bool CSVCMsg_CreateStringTable::_internal_has_max_entries() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_CreateStringTable::has_max_entries() const {
+  return _internal_has_max_entries();
+}
+inline void CSVCMsg_CreateStringTable::clear_max_entries() {
+  _impl_.max_entries_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_CreateStringTable::_internal_max_entries() const {
+  return _impl_.max_entries_;
+}
+inline int32_t CSVCMsg_CreateStringTable::max_entries() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_CreateStringTable.max_entries)
+  return _internal_max_entries();
+}
+inline void CSVCMsg_CreateStringTable::_internal_set_max_entries(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.max_entries_ = value;
+}
+inline void CSVCMsg_CreateStringTable::set_max_entries(int32_t value) {
+  _internal_set_max_entries(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_CreateStringTable.max_entries)
+}
+
+// optional int32 num_entries = 3;
+inline bool CSVCMsg_CreateStringTable::_internal_has_num_entries() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSVCMsg_CreateStringTable::has_num_entries() const {
+  return _internal_has_num_entries();
+}
+inline void CSVCMsg_CreateStringTable::clear_num_entries() {
+  _impl_.num_entries_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CSVCMsg_CreateStringTable::_internal_num_entries() const {
+  return _impl_.num_entries_;
+}
+inline int32_t CSVCMsg_CreateStringTable::num_entries() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_CreateStringTable.num_entries)
+  return _internal_num_entries();
+}
+inline void CSVCMsg_CreateStringTable::_internal_set_num_entries(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.num_entries_ = value;
+}
+inline void CSVCMsg_CreateStringTable::set_num_entries(int32_t value) {
+  _internal_set_num_entries(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_CreateStringTable.num_entries)
+}
+
+// optional bool user_data_fixed_size = 4;
+inline bool CSVCMsg_CreateStringTable::_internal_has_user_data_fixed_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CSVCMsg_CreateStringTable::has_user_data_fixed_size() const {
+  return _internal_has_user_data_fixed_size();
+}
+inline void CSVCMsg_CreateStringTable::clear_user_data_fixed_size() {
+  _impl_.user_data_fixed_size_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool CSVCMsg_CreateStringTable::_internal_user_data_fixed_size() const {
+  return _impl_.user_data_fixed_size_;
+}
+inline bool CSVCMsg_CreateStringTable::user_data_fixed_size() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_CreateStringTable.user_data_fixed_size)
+  return _internal_user_data_fixed_size();
+}
+inline void CSVCMsg_CreateStringTable::_internal_set_user_data_fixed_size(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.user_data_fixed_size_ = value;
+}
+inline void CSVCMsg_CreateStringTable::set_user_data_fixed_size(bool value) {
+  _internal_set_user_data_fixed_size(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_CreateStringTable.user_data_fixed_size)
+}
+
+// optional int32 user_data_size = 5;
+inline bool CSVCMsg_CreateStringTable::_internal_has_user_data_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CSVCMsg_CreateStringTable::has_user_data_size() const {
+  return _internal_has_user_data_size();
+}
+inline void CSVCMsg_CreateStringTable::clear_user_data_size() {
+  _impl_.user_data_size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t CSVCMsg_CreateStringTable::_internal_user_data_size() const {
+  return _impl_.user_data_size_;
+}
+inline int32_t CSVCMsg_CreateStringTable::user_data_size() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_CreateStringTable.user_data_size)
+  return _internal_user_data_size();
+}
+inline void CSVCMsg_CreateStringTable::_internal_set_user_data_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.user_data_size_ = value;
+}
+inline void CSVCMsg_CreateStringTable::set_user_data_size(int32_t value) {
+  _internal_set_user_data_size(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_CreateStringTable.user_data_size)
+}
+
+// optional int32 user_data_size_bits = 6;
+inline bool CSVCMsg_CreateStringTable::_internal_has_user_data_size_bits() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CSVCMsg_CreateStringTable::has_user_data_size_bits() const {
+  return _internal_has_user_data_size_bits();
+}
+inline void CSVCMsg_CreateStringTable::clear_user_data_size_bits() {
+  _impl_.user_data_size_bits_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t CSVCMsg_CreateStringTable::_internal_user_data_size_bits() const {
+  return _impl_.user_data_size_bits_;
+}
+inline int32_t CSVCMsg_CreateStringTable::user_data_size_bits() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_CreateStringTable.user_data_size_bits)
+  return _internal_user_data_size_bits();
+}
+inline void CSVCMsg_CreateStringTable::_internal_set_user_data_size_bits(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.user_data_size_bits_ = value;
+}
+inline void CSVCMsg_CreateStringTable::set_user_data_size_bits(int32_t value) {
+  _internal_set_user_data_size_bits(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_CreateStringTable.user_data_size_bits)
+}
+
+// optional int32 flags = 7;
+inline bool CSVCMsg_CreateStringTable::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool CSVCMsg_CreateStringTable::has_flags() const {
+  return _internal_has_flags();
+}
+inline void CSVCMsg_CreateStringTable::clear_flags() {
+  _impl_.flags_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t CSVCMsg_CreateStringTable::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline int32_t CSVCMsg_CreateStringTable::flags() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_CreateStringTable.flags)
+  return _internal_flags();
+}
+inline void CSVCMsg_CreateStringTable::_internal_set_flags(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.flags_ = value;
+}
+inline void CSVCMsg_CreateStringTable::set_flags(int32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_CreateStringTable.flags)
+}
+
+// optional bytes string_data = 8;
+inline bool CSVCMsg_CreateStringTable::_internal_has_string_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_CreateStringTable::has_string_data() const {
+  return _internal_has_string_data();
+}
+inline void CSVCMsg_CreateStringTable::clear_string_data() {
+  _impl_.string_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CSVCMsg_CreateStringTable::string_data() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_CreateStringTable.string_data)
+  return _internal_string_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_CreateStringTable::set_string_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.string_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_CreateStringTable.string_data)
+}
+inline std::string* CSVCMsg_CreateStringTable::mutable_string_data() {
+  std::string* _s = _internal_mutable_string_data();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_CreateStringTable.string_data)
+  return _s;
+}
+inline const std::string& CSVCMsg_CreateStringTable::_internal_string_data() const {
+  return _impl_.string_data_.Get();
+}
+inline void CSVCMsg_CreateStringTable::_internal_set_string_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.string_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_CreateStringTable::_internal_mutable_string_data() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.string_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_CreateStringTable::release_string_data() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_CreateStringTable.string_data)
+  if (!_internal_has_string_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.string_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.string_data_.IsDefault()) {
+    _impl_.string_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_CreateStringTable::set_allocated_string_data(std::string* string_data) {
+  if (string_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.string_data_.SetAllocated(string_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.string_data_.IsDefault()) {
+    _impl_.string_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_CreateStringTable.string_data)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_UpdateStringTable
+
+// optional int32 table_id = 1;
+inline bool CSVCMsg_UpdateStringTable::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_UpdateStringTable::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void CSVCMsg_UpdateStringTable::clear_table_id() {
+  _impl_.table_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_UpdateStringTable::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline int32_t CSVCMsg_UpdateStringTable::table_id() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_UpdateStringTable.table_id)
+  return _internal_table_id();
+}
+inline void CSVCMsg_UpdateStringTable::_internal_set_table_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.table_id_ = value;
+}
+inline void CSVCMsg_UpdateStringTable::set_table_id(int32_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_UpdateStringTable.table_id)
+}
+
+// optional int32 num_changed_entries = 2;
+inline bool CSVCMsg_UpdateStringTable::_internal_has_num_changed_entries() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_UpdateStringTable::has_num_changed_entries() const {
+  return _internal_has_num_changed_entries();
+}
+inline void CSVCMsg_UpdateStringTable::clear_num_changed_entries() {
+  _impl_.num_changed_entries_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_UpdateStringTable::_internal_num_changed_entries() const {
+  return _impl_.num_changed_entries_;
+}
+inline int32_t CSVCMsg_UpdateStringTable::num_changed_entries() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_UpdateStringTable.num_changed_entries)
+  return _internal_num_changed_entries();
+}
+inline void CSVCMsg_UpdateStringTable::_internal_set_num_changed_entries(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.num_changed_entries_ = value;
+}
+inline void CSVCMsg_UpdateStringTable::set_num_changed_entries(int32_t value) {
+  _internal_set_num_changed_entries(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_UpdateStringTable.num_changed_entries)
+}
+
+// optional bytes string_data = 3;
+inline bool CSVCMsg_UpdateStringTable::_internal_has_string_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_UpdateStringTable::has_string_data() const {
+  return _internal_has_string_data();
+}
+inline void CSVCMsg_UpdateStringTable::clear_string_data() {
+  _impl_.string_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_UpdateStringTable::string_data() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_UpdateStringTable.string_data)
+  return _internal_string_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_UpdateStringTable::set_string_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.string_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_UpdateStringTable.string_data)
+}
+inline std::string* CSVCMsg_UpdateStringTable::mutable_string_data() {
+  std::string* _s = _internal_mutable_string_data();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_UpdateStringTable.string_data)
+  return _s;
+}
+inline const std::string& CSVCMsg_UpdateStringTable::_internal_string_data() const {
+  return _impl_.string_data_.Get();
+}
+inline void CSVCMsg_UpdateStringTable::_internal_set_string_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.string_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_UpdateStringTable::_internal_mutable_string_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.string_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_UpdateStringTable::release_string_data() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_UpdateStringTable.string_data)
+  if (!_internal_has_string_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.string_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.string_data_.IsDefault()) {
+    _impl_.string_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_UpdateStringTable::set_allocated_string_data(std::string* string_data) {
+  if (string_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.string_data_.SetAllocated(string_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.string_data_.IsDefault()) {
+    _impl_.string_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_UpdateStringTable.string_data)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_VoiceData
+
+// optional int32 client = 1;
+inline bool CSVCMsg_VoiceData::_internal_has_client() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_client() const {
+  return _internal_has_client();
+}
+inline void CSVCMsg_VoiceData::clear_client() {
+  _impl_.client_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_VoiceData::_internal_client() const {
+  return _impl_.client_;
+}
+inline int32_t CSVCMsg_VoiceData::client() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.client)
+  return _internal_client();
+}
+inline void CSVCMsg_VoiceData::_internal_set_client(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.client_ = value;
+}
+inline void CSVCMsg_VoiceData::set_client(int32_t value) {
+  _internal_set_client(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.client)
+}
+
+// optional bool proximity = 2;
+inline bool CSVCMsg_VoiceData::_internal_has_proximity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_proximity() const {
+  return _internal_has_proximity();
+}
+inline void CSVCMsg_VoiceData::clear_proximity() {
+  _impl_.proximity_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CSVCMsg_VoiceData::_internal_proximity() const {
+  return _impl_.proximity_;
+}
+inline bool CSVCMsg_VoiceData::proximity() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.proximity)
+  return _internal_proximity();
+}
+inline void CSVCMsg_VoiceData::_internal_set_proximity(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.proximity_ = value;
+}
+inline void CSVCMsg_VoiceData::set_proximity(bool value) {
+  _internal_set_proximity(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.proximity)
+}
+
+// optional fixed64 xuid = 3;
+inline bool CSVCMsg_VoiceData::_internal_has_xuid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_xuid() const {
+  return _internal_has_xuid();
+}
+inline void CSVCMsg_VoiceData::clear_xuid() {
+  _impl_.xuid_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t CSVCMsg_VoiceData::_internal_xuid() const {
+  return _impl_.xuid_;
+}
+inline uint64_t CSVCMsg_VoiceData::xuid() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.xuid)
+  return _internal_xuid();
+}
+inline void CSVCMsg_VoiceData::_internal_set_xuid(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.xuid_ = value;
+}
+inline void CSVCMsg_VoiceData::set_xuid(uint64_t value) {
+  _internal_set_xuid(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.xuid)
+}
+
+// optional int32 audible_mask = 4;
+inline bool CSVCMsg_VoiceData::_internal_has_audible_mask() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_audible_mask() const {
+  return _internal_has_audible_mask();
+}
+inline void CSVCMsg_VoiceData::clear_audible_mask() {
+  _impl_.audible_mask_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t CSVCMsg_VoiceData::_internal_audible_mask() const {
+  return _impl_.audible_mask_;
+}
+inline int32_t CSVCMsg_VoiceData::audible_mask() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.audible_mask)
+  return _internal_audible_mask();
+}
+inline void CSVCMsg_VoiceData::_internal_set_audible_mask(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.audible_mask_ = value;
+}
+inline void CSVCMsg_VoiceData::set_audible_mask(int32_t value) {
+  _internal_set_audible_mask(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.audible_mask)
+}
+
+// optional bytes voice_data = 5;
+inline bool CSVCMsg_VoiceData::_internal_has_voice_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_voice_data() const {
+  return _internal_has_voice_data();
+}
+inline void CSVCMsg_VoiceData::clear_voice_data() {
+  _impl_.voice_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_VoiceData::voice_data() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.voice_data)
+  return _internal_voice_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_VoiceData::set_voice_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.voice_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.voice_data)
+}
+inline std::string* CSVCMsg_VoiceData::mutable_voice_data() {
+  std::string* _s = _internal_mutable_voice_data();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_VoiceData.voice_data)
+  return _s;
+}
+inline const std::string& CSVCMsg_VoiceData::_internal_voice_data() const {
+  return _impl_.voice_data_.Get();
+}
+inline void CSVCMsg_VoiceData::_internal_set_voice_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.voice_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_VoiceData::_internal_mutable_voice_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.voice_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_VoiceData::release_voice_data() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_VoiceData.voice_data)
+  if (!_internal_has_voice_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.voice_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.voice_data_.IsDefault()) {
+    _impl_.voice_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_VoiceData::set_allocated_voice_data(std::string* voice_data) {
+  if (voice_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.voice_data_.SetAllocated(voice_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.voice_data_.IsDefault()) {
+    _impl_.voice_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_VoiceData.voice_data)
+}
+
+// optional .VoiceDataFormat_t format = 6 [default = VOICEDATA_FORMAT_STEAM];
+inline bool CSVCMsg_VoiceData::_internal_has_format() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_format() const {
+  return _internal_has_format();
+}
+inline void CSVCMsg_VoiceData::clear_format() {
+  _impl_.format_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::VoiceDataFormat_t CSVCMsg_VoiceData::_internal_format() const {
+  return static_cast< ::VoiceDataFormat_t >(_impl_.format_);
+}
+inline ::VoiceDataFormat_t CSVCMsg_VoiceData::format() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.format)
+  return _internal_format();
+}
+inline void CSVCMsg_VoiceData::_internal_set_format(::VoiceDataFormat_t value) {
+  assert(::VoiceDataFormat_t_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.format_ = value;
+}
+inline void CSVCMsg_VoiceData::set_format(::VoiceDataFormat_t value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.format)
+}
+
+// optional int32 sequence_bytes = 7;
+inline bool CSVCMsg_VoiceData::_internal_has_sequence_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_sequence_bytes() const {
+  return _internal_has_sequence_bytes();
+}
+inline void CSVCMsg_VoiceData::clear_sequence_bytes() {
+  _impl_.sequence_bytes_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t CSVCMsg_VoiceData::_internal_sequence_bytes() const {
+  return _impl_.sequence_bytes_;
+}
+inline int32_t CSVCMsg_VoiceData::sequence_bytes() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.sequence_bytes)
+  return _internal_sequence_bytes();
+}
+inline void CSVCMsg_VoiceData::_internal_set_sequence_bytes(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.sequence_bytes_ = value;
+}
+inline void CSVCMsg_VoiceData::set_sequence_bytes(int32_t value) {
+  _internal_set_sequence_bytes(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.sequence_bytes)
+}
+
+// optional uint32 section_number = 8;
+inline bool CSVCMsg_VoiceData::_internal_has_section_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_section_number() const {
+  return _internal_has_section_number();
+}
+inline void CSVCMsg_VoiceData::clear_section_number() {
+  _impl_.section_number_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t CSVCMsg_VoiceData::_internal_section_number() const {
+  return _impl_.section_number_;
+}
+inline uint32_t CSVCMsg_VoiceData::section_number() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.section_number)
+  return _internal_section_number();
+}
+inline void CSVCMsg_VoiceData::_internal_set_section_number(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.section_number_ = value;
+}
+inline void CSVCMsg_VoiceData::set_section_number(uint32_t value) {
+  _internal_set_section_number(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.section_number)
+}
+
+// optional uint32 uncompressed_sample_offset = 9;
+inline bool CSVCMsg_VoiceData::_internal_has_uncompressed_sample_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_uncompressed_sample_offset() const {
+  return _internal_has_uncompressed_sample_offset();
+}
+inline void CSVCMsg_VoiceData::clear_uncompressed_sample_offset() {
+  _impl_.uncompressed_sample_offset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t CSVCMsg_VoiceData::_internal_uncompressed_sample_offset() const {
+  return _impl_.uncompressed_sample_offset_;
+}
+inline uint32_t CSVCMsg_VoiceData::uncompressed_sample_offset() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.uncompressed_sample_offset)
+  return _internal_uncompressed_sample_offset();
+}
+inline void CSVCMsg_VoiceData::_internal_set_uncompressed_sample_offset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.uncompressed_sample_offset_ = value;
+}
+inline void CSVCMsg_VoiceData::set_uncompressed_sample_offset(uint32_t value) {
+  _internal_set_uncompressed_sample_offset(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.uncompressed_sample_offset)
+}
+
+// optional uint32 tick = 10;
+inline bool CSVCMsg_VoiceData::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool CSVCMsg_VoiceData::has_tick() const {
+  return _internal_has_tick();
+}
+inline void CSVCMsg_VoiceData::clear_tick() {
+  _impl_.tick_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t CSVCMsg_VoiceData::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline uint32_t CSVCMsg_VoiceData::tick() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_VoiceData.tick)
+  return _internal_tick();
+}
+inline void CSVCMsg_VoiceData::_internal_set_tick(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.tick_ = value;
+}
+inline void CSVCMsg_VoiceData::set_tick(uint32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_VoiceData.tick)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_PacketReliable
+
+// optional int32 tick = 1;
+inline bool CSVCMsg_PacketReliable::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketReliable::has_tick() const {
+  return _internal_has_tick();
+}
+inline void CSVCMsg_PacketReliable::clear_tick() {
+  _impl_.tick_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CSVCMsg_PacketReliable::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline int32_t CSVCMsg_PacketReliable::tick() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketReliable.tick)
+  return _internal_tick();
+}
+inline void CSVCMsg_PacketReliable::_internal_set_tick(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.tick_ = value;
+}
+inline void CSVCMsg_PacketReliable::set_tick(int32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketReliable.tick)
+}
+
+// optional int32 messagessize = 2;
+inline bool CSVCMsg_PacketReliable::_internal_has_messagessize() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_PacketReliable::has_messagessize() const {
+  return _internal_has_messagessize();
+}
+inline void CSVCMsg_PacketReliable::clear_messagessize() {
+  _impl_.messagessize_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_PacketReliable::_internal_messagessize() const {
+  return _impl_.messagessize_;
+}
+inline int32_t CSVCMsg_PacketReliable::messagessize() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_PacketReliable.messagessize)
+  return _internal_messagessize();
+}
+inline void CSVCMsg_PacketReliable::_internal_set_messagessize(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.messagessize_ = value;
+}
+inline void CSVCMsg_PacketReliable::set_messagessize(int32_t value) {
+  _internal_set_messagessize(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_PacketReliable.messagessize)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_FullFrameSplit
+
+// optional int32 tick = 1;
+inline bool CSVCMsg_FullFrameSplit::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_FullFrameSplit::has_tick() const {
+  return _internal_has_tick();
+}
+inline void CSVCMsg_FullFrameSplit::clear_tick() {
+  _impl_.tick_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_FullFrameSplit::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline int32_t CSVCMsg_FullFrameSplit::tick() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_FullFrameSplit.tick)
+  return _internal_tick();
+}
+inline void CSVCMsg_FullFrameSplit::_internal_set_tick(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tick_ = value;
+}
+inline void CSVCMsg_FullFrameSplit::set_tick(int32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_FullFrameSplit.tick)
+}
+
+// optional int32 section = 2;
+inline bool CSVCMsg_FullFrameSplit::_internal_has_section() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_FullFrameSplit::has_section() const {
+  return _internal_has_section();
+}
+inline void CSVCMsg_FullFrameSplit::clear_section() {
+  _impl_.section_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSVCMsg_FullFrameSplit::_internal_section() const {
+  return _impl_.section_;
+}
+inline int32_t CSVCMsg_FullFrameSplit::section() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_FullFrameSplit.section)
+  return _internal_section();
+}
+inline void CSVCMsg_FullFrameSplit::_internal_set_section(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.section_ = value;
+}
+inline void CSVCMsg_FullFrameSplit::set_section(int32_t value) {
+  _internal_set_section(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_FullFrameSplit.section)
+}
+
+// optional int32 total = 3;
+inline bool CSVCMsg_FullFrameSplit::_internal_has_total() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSVCMsg_FullFrameSplit::has_total() const {
+  return _internal_has_total();
+}
+inline void CSVCMsg_FullFrameSplit::clear_total() {
+  _impl_.total_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CSVCMsg_FullFrameSplit::_internal_total() const {
+  return _impl_.total_;
+}
+inline int32_t CSVCMsg_FullFrameSplit::total() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_FullFrameSplit.total)
+  return _internal_total();
+}
+inline void CSVCMsg_FullFrameSplit::_internal_set_total(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.total_ = value;
+}
+inline void CSVCMsg_FullFrameSplit::set_total(int32_t value) {
+  _internal_set_total(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_FullFrameSplit.total)
+}
+
+// optional bytes data = 4;
+inline bool CSVCMsg_FullFrameSplit::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_FullFrameSplit::has_data() const {
+  return _internal_has_data();
+}
+inline void CSVCMsg_FullFrameSplit::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_FullFrameSplit::data() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_FullFrameSplit.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_FullFrameSplit::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_FullFrameSplit.data)
+}
+inline std::string* CSVCMsg_FullFrameSplit::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_FullFrameSplit.data)
+  return _s;
+}
+inline const std::string& CSVCMsg_FullFrameSplit::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void CSVCMsg_FullFrameSplit::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_FullFrameSplit::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_FullFrameSplit::release_data() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_FullFrameSplit.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_FullFrameSplit::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_FullFrameSplit.data)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::CLC_Messages> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::CLC_Messages>() {
+  return ::CLC_Messages_descriptor();
+}
+template <> struct is_proto_enum< ::SVC_Messages> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::SVC_Messages>() {
+  return ::SVC_Messages_descriptor();
+}
+template <> struct is_proto_enum< ::VoiceDataFormat_t> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::VoiceDataFormat_t>() {
+  return ::VoiceDataFormat_t_descriptor();
+}
+template <> struct is_proto_enum< ::ESplitScreenMessageType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ESplitScreenMessageType>() {
+  return ::ESplitScreenMessageType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_netmessages_2eproto
@@ -0,0 +1,5726 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: networkbasetypes.proto
+
+#include "networkbasetypes.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR CMsgVector::CMsgVector(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.z_)*/0} {}
+struct CMsgVectorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgVectorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgVectorDefaultTypeInternal() {}
+  union {
+    CMsgVector _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgVectorDefaultTypeInternal _CMsgVector_default_instance_;
+PROTOBUF_CONSTEXPR CMsgVector2D::CMsgVector2D(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0} {}
+struct CMsgVector2DDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgVector2DDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgVector2DDefaultTypeInternal() {}
+  union {
+    CMsgVector2D _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgVector2DDefaultTypeInternal _CMsgVector2D_default_instance_;
+PROTOBUF_CONSTEXPR CMsgQAngle::CMsgQAngle(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.z_)*/0} {}
+struct CMsgQAngleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsgQAngleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsgQAngleDefaultTypeInternal() {}
+  union {
+    CMsgQAngle _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsgQAngleDefaultTypeInternal _CMsgQAngle_default_instance_;
+PROTOBUF_CONSTEXPR CMsg_CVars_CVar::CMsg_CVars_CVar(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CMsg_CVars_CVarDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsg_CVars_CVarDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsg_CVars_CVarDefaultTypeInternal() {}
+  union {
+    CMsg_CVars_CVar _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsg_CVars_CVarDefaultTypeInternal _CMsg_CVars_CVar_default_instance_;
+PROTOBUF_CONSTEXPR CMsg_CVars::CMsg_CVars(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cvars_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CMsg_CVarsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CMsg_CVarsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CMsg_CVarsDefaultTypeInternal() {}
+  union {
+    CMsg_CVars _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CMsg_CVarsDefaultTypeInternal _CMsg_CVars_default_instance_;
+PROTOBUF_CONSTEXPR CNETMsg_NOP::CNETMsg_NOP(
+    ::_pbi::ConstantInitialized) {}
+struct CNETMsg_NOPDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CNETMsg_NOPDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CNETMsg_NOPDefaultTypeInternal() {}
+  union {
+    CNETMsg_NOP _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CNETMsg_NOPDefaultTypeInternal _CNETMsg_NOP_default_instance_;
+PROTOBUF_CONSTEXPR CNETMsg_SplitScreenUser::CNETMsg_SplitScreenUser(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.slot_)*/0} {}
+struct CNETMsg_SplitScreenUserDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CNETMsg_SplitScreenUserDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CNETMsg_SplitScreenUserDefaultTypeInternal() {}
+  union {
+    CNETMsg_SplitScreenUser _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CNETMsg_SplitScreenUserDefaultTypeInternal _CNETMsg_SplitScreenUser_default_instance_;
+PROTOBUF_CONSTEXPR CNETMsg_Disconnect::CNETMsg_Disconnect(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reason_)*/0} {}
+struct CNETMsg_DisconnectDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CNETMsg_DisconnectDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CNETMsg_DisconnectDefaultTypeInternal() {}
+  union {
+    CNETMsg_Disconnect _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CNETMsg_DisconnectDefaultTypeInternal _CNETMsg_Disconnect_default_instance_;
+PROTOBUF_CONSTEXPR CNETMsg_File::CNETMsg_File(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transfer_id_)*/0
+  , /*decltype(_impl_.is_replay_demo_file_)*/false
+  , /*decltype(_impl_.deny_)*/false
+  , /*decltype(_impl_.is_file_requested_)*/false} {}
+struct CNETMsg_FileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CNETMsg_FileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CNETMsg_FileDefaultTypeInternal() {}
+  union {
+    CNETMsg_File _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CNETMsg_FileDefaultTypeInternal _CNETMsg_File_default_instance_;
+PROTOBUF_CONSTEXPR CNETMsg_Tick::CNETMsg_Tick(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tick_)*/0u
+  , /*decltype(_impl_.host_computationtime_)*/0u
+  , /*decltype(_impl_.host_computationtime_std_deviation_)*/0u
+  , /*decltype(_impl_.host_framestarttime_std_deviation_)*/0u} {}
+struct CNETMsg_TickDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CNETMsg_TickDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CNETMsg_TickDefaultTypeInternal() {}
+  union {
+    CNETMsg_Tick _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CNETMsg_TickDefaultTypeInternal _CNETMsg_Tick_default_instance_;
+PROTOBUF_CONSTEXPR CNETMsg_StringCmd::CNETMsg_StringCmd(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.command_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CNETMsg_StringCmdDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CNETMsg_StringCmdDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CNETMsg_StringCmdDefaultTypeInternal() {}
+  union {
+    CNETMsg_StringCmd _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CNETMsg_StringCmdDefaultTypeInternal _CNETMsg_StringCmd_default_instance_;
+PROTOBUF_CONSTEXPR CNETMsg_SetConVar::CNETMsg_SetConVar(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.convars_)*/nullptr} {}
+struct CNETMsg_SetConVarDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CNETMsg_SetConVarDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CNETMsg_SetConVarDefaultTypeInternal() {}
+  union {
+    CNETMsg_SetConVar _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CNETMsg_SetConVarDefaultTypeInternal _CNETMsg_SetConVar_default_instance_;
+PROTOBUF_CONSTEXPR CNETMsg_SignonState::CNETMsg_SignonState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.players_networkids_)*/{}
+  , /*decltype(_impl_.map_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.signon_state_)*/0u
+  , /*decltype(_impl_.spawn_count_)*/0u
+  , /*decltype(_impl_.num_server_players_)*/0u} {}
+struct CNETMsg_SignonStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CNETMsg_SignonStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CNETMsg_SignonStateDefaultTypeInternal() {}
+  union {
+    CNETMsg_SignonState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CNETMsg_SignonStateDefaultTypeInternal _CNETMsg_SignonState_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_GameEvent_key_t::CSVCMsg_GameEvent_key_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.val_string_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.val_float_)*/0
+  , /*decltype(_impl_.val_long_)*/0
+  , /*decltype(_impl_.val_short_)*/0
+  , /*decltype(_impl_.val_byte_)*/0
+  , /*decltype(_impl_.val_bool_)*/false
+  , /*decltype(_impl_.val_uint64_)*/uint64_t{0u}} {}
+struct CSVCMsg_GameEvent_key_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_GameEvent_key_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_GameEvent_key_tDefaultTypeInternal() {}
+  union {
+    CSVCMsg_GameEvent_key_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_GameEvent_key_tDefaultTypeInternal _CSVCMsg_GameEvent_key_t_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_GameEvent::CSVCMsg_GameEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.event_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.eventid_)*/0} {}
+struct CSVCMsg_GameEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_GameEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_GameEventDefaultTypeInternal() {}
+  union {
+    CSVCMsg_GameEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_GameEventDefaultTypeInternal _CSVCMsg_GameEvent_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsgList_GameEvents_event_t::CSVCMsgList_GameEvents_event_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.event_)*/nullptr
+  , /*decltype(_impl_.tick_)*/0} {}
+struct CSVCMsgList_GameEvents_event_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsgList_GameEvents_event_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsgList_GameEvents_event_tDefaultTypeInternal() {}
+  union {
+    CSVCMsgList_GameEvents_event_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsgList_GameEvents_event_tDefaultTypeInternal _CSVCMsgList_GameEvents_event_t_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsgList_GameEvents::CSVCMsgList_GameEvents(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CSVCMsgList_GameEventsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsgList_GameEventsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsgList_GameEventsDefaultTypeInternal() {}
+  union {
+    CSVCMsgList_GameEvents _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsgList_GameEventsDefaultTypeInternal _CSVCMsgList_GameEvents_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsg_UserMessage::CSVCMsg_UserMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.msg_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msg_type_)*/0} {}
+struct CSVCMsg_UserMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsg_UserMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsg_UserMessageDefaultTypeInternal() {}
+  union {
+    CSVCMsg_UserMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsg_UserMessageDefaultTypeInternal _CSVCMsg_UserMessage_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsgList_UserMessages_usermsg_t::CSVCMsgList_UserMessages_usermsg_t(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.msg_)*/nullptr
+  , /*decltype(_impl_.tick_)*/0} {}
+struct CSVCMsgList_UserMessages_usermsg_tDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsgList_UserMessages_usermsg_tDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsgList_UserMessages_usermsg_tDefaultTypeInternal() {}
+  union {
+    CSVCMsgList_UserMessages_usermsg_t _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsgList_UserMessages_usermsg_tDefaultTypeInternal _CSVCMsgList_UserMessages_usermsg_t_default_instance_;
+PROTOBUF_CONSTEXPR CSVCMsgList_UserMessages::CSVCMsgList_UserMessages(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.usermsgs_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CSVCMsgList_UserMessagesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSVCMsgList_UserMessagesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSVCMsgList_UserMessagesDefaultTypeInternal() {}
+  union {
+    CSVCMsgList_UserMessages _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSVCMsgList_UserMessagesDefaultTypeInternal _CSVCMsgList_UserMessages_default_instance_;
+static ::_pb::Metadata file_level_metadata_networkbasetypes_2eproto[20];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_networkbasetypes_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_networkbasetypes_2eproto = nullptr;
+
+const uint32_t TableStruct_networkbasetypes_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::CMsgVector, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgVector, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgVector, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::CMsgVector, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::CMsgVector, _impl_.z_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CMsgVector2D, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgVector2D, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgVector2D, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::CMsgVector2D, _impl_.y_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CMsgQAngle, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsgQAngle, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsgQAngle, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::CMsgQAngle, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::CMsgQAngle, _impl_.z_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CMsg_CVars_CVar, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CMsg_CVars_CVar, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsg_CVars_CVar, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::CMsg_CVars_CVar, _impl_.value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CMsg_CVars, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CMsg_CVars, _impl_.cvars_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_NOP, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SplitScreenUser, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SplitScreenUser, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SplitScreenUser, _impl_.slot_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_Disconnect, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_Disconnect, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_Disconnect, _impl_.reason_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_File, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_File, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_File, _impl_.transfer_id_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_File, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_File, _impl_.is_replay_demo_file_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_File, _impl_.deny_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_File, _impl_.is_file_requested_),
+  1,
+  0,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_Tick, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_Tick, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_Tick, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_Tick, _impl_.host_computationtime_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_Tick, _impl_.host_computationtime_std_deviation_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_Tick, _impl_.host_framestarttime_std_deviation_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_StringCmd, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_StringCmd, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_StringCmd, _impl_.command_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SetConVar, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SetConVar, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SetConVar, _impl_.convars_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SignonState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SignonState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SignonState, _impl_.signon_state_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SignonState, _impl_.spawn_count_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SignonState, _impl_.num_server_players_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SignonState, _impl_.players_networkids_),
+  PROTOBUF_FIELD_OFFSET(::CNETMsg_SignonState, _impl_.map_name_),
+  1,
+  2,
+  3,
+  ~0u,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _impl_.val_string_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _impl_.val_float_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _impl_.val_long_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _impl_.val_short_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _impl_.val_byte_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _impl_.val_bool_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent_key_t, _impl_.val_uint64_),
+  1,
+  0,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent, _impl_.event_name_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent, _impl_.eventid_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_GameEvent, _impl_.keys_),
+  0,
+  1,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_GameEvents_event_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_GameEvents_event_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_GameEvents_event_t, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_GameEvents_event_t, _impl_.event_),
+  1,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_GameEvents, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_GameEvents, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_UserMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_UserMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_UserMessage, _impl_.msg_type_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsg_UserMessage, _impl_.msg_data_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_UserMessages_usermsg_t, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_UserMessages_usermsg_t, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_UserMessages_usermsg_t, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_UserMessages_usermsg_t, _impl_.msg_),
+  1,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_UserMessages, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CSVCMsgList_UserMessages, _impl_.usermsgs_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::CMsgVector)},
+  { 12, 20, -1, sizeof(::CMsgVector2D)},
+  { 22, 31, -1, sizeof(::CMsgQAngle)},
+  { 34, 42, -1, sizeof(::CMsg_CVars_CVar)},
+  { 44, -1, -1, sizeof(::CMsg_CVars)},
+  { 51, -1, -1, sizeof(::CNETMsg_NOP)},
+  { 57, 64, -1, sizeof(::CNETMsg_SplitScreenUser)},
+  { 65, 72, -1, sizeof(::CNETMsg_Disconnect)},
+  { 73, 84, -1, sizeof(::CNETMsg_File)},
+  { 89, 99, -1, sizeof(::CNETMsg_Tick)},
+  { 103, 110, -1, sizeof(::CNETMsg_StringCmd)},
+  { 111, 118, -1, sizeof(::CNETMsg_SetConVar)},
+  { 119, 130, -1, sizeof(::CNETMsg_SignonState)},
+  { 135, 149, -1, sizeof(::CSVCMsg_GameEvent_key_t)},
+  { 157, 166, -1, sizeof(::CSVCMsg_GameEvent)},
+  { 169, 177, -1, sizeof(::CSVCMsgList_GameEvents_event_t)},
+  { 179, -1, -1, sizeof(::CSVCMsgList_GameEvents)},
+  { 186, 194, -1, sizeof(::CSVCMsg_UserMessage)},
+  { 196, 204, -1, sizeof(::CSVCMsgList_UserMessages_usermsg_t)},
+  { 206, -1, -1, sizeof(::CSVCMsgList_UserMessages)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_CMsgVector_default_instance_._instance,
+  &::_CMsgVector2D_default_instance_._instance,
+  &::_CMsgQAngle_default_instance_._instance,
+  &::_CMsg_CVars_CVar_default_instance_._instance,
+  &::_CMsg_CVars_default_instance_._instance,
+  &::_CNETMsg_NOP_default_instance_._instance,
+  &::_CNETMsg_SplitScreenUser_default_instance_._instance,
+  &::_CNETMsg_Disconnect_default_instance_._instance,
+  &::_CNETMsg_File_default_instance_._instance,
+  &::_CNETMsg_Tick_default_instance_._instance,
+  &::_CNETMsg_StringCmd_default_instance_._instance,
+  &::_CNETMsg_SetConVar_default_instance_._instance,
+  &::_CNETMsg_SignonState_default_instance_._instance,
+  &::_CSVCMsg_GameEvent_key_t_default_instance_._instance,
+  &::_CSVCMsg_GameEvent_default_instance_._instance,
+  &::_CSVCMsgList_GameEvents_event_t_default_instance_._instance,
+  &::_CSVCMsgList_GameEvents_default_instance_._instance,
+  &::_CSVCMsg_UserMessage_default_instance_._instance,
+  &::_CSVCMsgList_UserMessages_usermsg_t_default_instance_._instance,
+  &::_CSVCMsgList_UserMessages_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_networkbasetypes_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026networkbasetypes.proto\032\030network_connec"
+  "tion.proto\"-\n\nCMsgVector\022\t\n\001x\030\001 \001(\002\022\t\n\001y"
+  "\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\"$\n\014CMsgVector2D\022\t\n\001x\030\001"
+  " \001(\002\022\t\n\001y\030\002 \001(\002\"-\n\nCMsgQAngle\022\t\n\001x\030\001 \001(\002"
+  "\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\"R\n\nCMsg_CVars\022\037\n\005"
+  "cvars\030\001 \003(\0132\020.CMsg_CVars.CVar\032#\n\004CVar\022\014\n"
+  "\004name\030\001 \001(\t\022\r\n\005value\030\002 \001(\t\"\r\n\013CNETMsg_NO"
+  "P\"\'\n\027CNETMsg_SplitScreenUser\022\014\n\004slot\030\001 \001"
+  "(\005\"^\n\022CNETMsg_Disconnect\022H\n\006reason\030\002 \001(\016"
+  "2\034.ENetworkDisconnectionReason:\032NETWORK_"
+  "DISCONNECT_INVALID\"|\n\014CNETMsg_File\022\023\n\013tr"
+  "ansfer_id\030\001 \001(\005\022\021\n\tfile_name\030\002 \001(\t\022\033\n\023is"
+  "_replay_demo_file\030\003 \001(\010\022\014\n\004deny\030\004 \001(\010\022\031\n"
+  "\021is_file_requested\030\005 \001(\010\"\221\001\n\014CNETMsg_Tic"
+  "k\022\014\n\004tick\030\001 \001(\r\022\034\n\024host_computationtime\030"
+  "\004 \001(\r\022*\n\"host_computationtime_std_deviat"
+  "ion\030\005 \001(\r\022)\n!host_framestarttime_std_dev"
+  "iation\030\006 \001(\r\"$\n\021CNETMsg_StringCmd\022\017\n\007com"
+  "mand\030\001 \001(\t\"1\n\021CNETMsg_SetConVar\022\034\n\007conva"
+  "rs\030\001 \001(\0132\013.CMsg_CVars\"\212\001\n\023CNETMsg_Signon"
+  "State\022\024\n\014signon_state\030\001 \001(\r\022\023\n\013spawn_cou"
+  "nt\030\002 \001(\r\022\032\n\022num_server_players\030\003 \001(\r\022\032\n\022"
+  "players_networkids\030\004 \003(\t\022\020\n\010map_name\030\005 \001"
+  "(\t\"\374\001\n\021CSVCMsg_GameEvent\022\022\n\nevent_name\030\001"
+  " \001(\t\022\017\n\007eventid\030\002 \001(\005\022&\n\004keys\030\003 \003(\0132\030.CS"
+  "VCMsg_GameEvent.key_t\032\231\001\n\005key_t\022\014\n\004type\030"
+  "\001 \001(\005\022\022\n\nval_string\030\002 \001(\t\022\021\n\tval_float\030\003"
+  " \001(\002\022\020\n\010val_long\030\004 \001(\005\022\021\n\tval_short\030\005 \001("
+  "\005\022\020\n\010val_byte\030\006 \001(\005\022\020\n\010val_bool\030\007 \001(\010\022\022\n"
+  "\nval_uint64\030\010 \001(\004\"\205\001\n\026CSVCMsgList_GameEv"
+  "ents\022/\n\006events\030\001 \003(\0132\037.CSVCMsgList_GameE"
+  "vents.event_t\032:\n\007event_t\022\014\n\004tick\030\001 \001(\005\022!"
+  "\n\005event\030\002 \001(\0132\022.CSVCMsg_GameEvent\"9\n\023CSV"
+  "CMsg_UserMessage\022\020\n\010msg_type\030\001 \001(\005\022\020\n\010ms"
+  "g_data\030\002 \001(\014\"\217\001\n\030CSVCMsgList_UserMessage"
+  "s\0225\n\010usermsgs\030\001 \003(\0132#.CSVCMsgList_UserMe"
+  "ssages.usermsg_t\032<\n\tusermsg_t\022\014\n\004tick\030\001 "
+  "\001(\005\022!\n\003msg\030\002 \001(\0132\024.CSVCMsg_UserMessage*\322"
+  "\001\n\013SIGNONSTATE\022\024\n\020SIGNONSTATE_NONE\020\000\022\031\n\025"
+  "SIGNONSTATE_CHALLENGE\020\001\022\031\n\025SIGNONSTATE_C"
+  "ONNECTED\020\002\022\023\n\017SIGNONSTATE_NEW\020\003\022\030\n\024SIGNO"
+  "NSTATE_PRESPAWN\020\004\022\025\n\021SIGNONSTATE_SPAWN\020\005"
+  "\022\024\n\020SIGNONSTATE_FULL\020\006\022\033\n\027SIGNONSTATE_CH"
+  "ANGELEVEL\020\007*\237\001\n\014NET_Messages\022\013\n\007net_NOP\020"
+  "\000\022\022\n\016net_Disconnect\020\001\022\014\n\010net_File\020\002\022\027\n\023n"
+  "et_SplitScreenUser\020\003\022\014\n\010net_Tick\020\004\022\021\n\rne"
+  "t_StringCmd\020\005\022\021\n\rnet_SetConVar\020\006\022\023\n\017net_"
+  "SignonState\020\007B\003\200\001\000"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_networkbasetypes_2eproto_deps[1] = {
+  &::descriptor_table_network_5fconnection_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_networkbasetypes_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_networkbasetypes_2eproto = {
+    false, false, 1898, descriptor_table_protodef_networkbasetypes_2eproto,
+    "networkbasetypes.proto",
+    &descriptor_table_networkbasetypes_2eproto_once, descriptor_table_networkbasetypes_2eproto_deps, 1, 20,
+    schemas, file_default_instances, TableStruct_networkbasetypes_2eproto::offsets,
+    file_level_metadata_networkbasetypes_2eproto, file_level_enum_descriptors_networkbasetypes_2eproto,
+    file_level_service_descriptors_networkbasetypes_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_networkbasetypes_2eproto_getter() {
+  return &descriptor_table_networkbasetypes_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_networkbasetypes_2eproto(&descriptor_table_networkbasetypes_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SIGNONSTATE_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_networkbasetypes_2eproto);
+  return file_level_enum_descriptors_networkbasetypes_2eproto[0];
+}
+bool SIGNONSTATE_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NET_Messages_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_networkbasetypes_2eproto);
+  return file_level_enum_descriptors_networkbasetypes_2eproto[1];
+}
+bool NET_Messages_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class CMsgVector::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgVector>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_z(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CMsgVector::CMsgVector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgVector)
+}
+CMsgVector::CMsgVector(const CMsgVector& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgVector* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.z_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.z_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  // @@protoc_insertion_point(copy_constructor:CMsgVector)
+}
+
+inline void CMsgVector::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.z_){0}
+  };
+}
+
+CMsgVector::~CMsgVector() {
+  // @@protoc_insertion_point(destructor:CMsgVector)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgVector::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgVector::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgVector::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgVector)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.z_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgVector::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float z = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_z(&has_bits);
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgVector::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgVector)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
+  }
+
+  // optional float y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
+  }
+
+  // optional float z = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgVector)
+  return target;
+}
+
+size_t CMsgVector::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgVector)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional float x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float z = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgVector::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgVector::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgVector::GetClassData() const { return &_class_data_; }
+
+
+void CMsgVector::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgVector*>(&to_msg);
+  auto& from = static_cast<const CMsgVector&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgVector)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.z_ = from._impl_.z_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgVector::CopyFrom(const CMsgVector& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgVector)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgVector::IsInitialized() const {
+  return true;
+}
+
+void CMsgVector::InternalSwap(CMsgVector* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgVector, _impl_.z_)
+      + sizeof(CMsgVector::_impl_.z_)
+      - PROTOBUF_FIELD_OFFSET(CMsgVector, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgVector::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[0]);
+}
+
+// ===================================================================
+
+class CMsgVector2D::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgVector2D>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CMsgVector2D::CMsgVector2D(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgVector2D)
+}
+CMsgVector2D::CMsgVector2D(const CMsgVector2D& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgVector2D* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  // @@protoc_insertion_point(copy_constructor:CMsgVector2D)
+}
+
+inline void CMsgVector2D::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+  };
+}
+
+CMsgVector2D::~CMsgVector2D() {
+  // @@protoc_insertion_point(destructor:CMsgVector2D)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgVector2D::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgVector2D::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgVector2D::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgVector2D)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.y_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgVector2D::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgVector2D::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgVector2D)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
+  }
+
+  // optional float y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgVector2D)
+  return target;
+}
+
+size_t CMsgVector2D::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgVector2D)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional float x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgVector2D::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgVector2D::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgVector2D::GetClassData() const { return &_class_data_; }
+
+
+void CMsgVector2D::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgVector2D*>(&to_msg);
+  auto& from = static_cast<const CMsgVector2D&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgVector2D)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgVector2D::CopyFrom(const CMsgVector2D& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgVector2D)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgVector2D::IsInitialized() const {
+  return true;
+}
+
+void CMsgVector2D::InternalSwap(CMsgVector2D* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgVector2D, _impl_.y_)
+      + sizeof(CMsgVector2D::_impl_.y_)
+      - PROTOBUF_FIELD_OFFSET(CMsgVector2D, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgVector2D::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[1]);
+}
+
+// ===================================================================
+
+class CMsgQAngle::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsgQAngle>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_z(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CMsgQAngle::CMsgQAngle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsgQAngle)
+}
+CMsgQAngle::CMsgQAngle(const CMsgQAngle& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsgQAngle* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.z_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.z_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  // @@protoc_insertion_point(copy_constructor:CMsgQAngle)
+}
+
+inline void CMsgQAngle::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.z_){0}
+  };
+}
+
+CMsgQAngle::~CMsgQAngle() {
+  // @@protoc_insertion_point(destructor:CMsgQAngle)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsgQAngle::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CMsgQAngle::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsgQAngle::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsgQAngle)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.z_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsgQAngle::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float z = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_z(&has_bits);
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsgQAngle::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsgQAngle)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float x = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
+  }
+
+  // optional float y = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
+  }
+
+  // optional float z = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsgQAngle)
+  return target;
+}
+
+size_t CMsgQAngle::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsgQAngle)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional float x = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float y = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float z = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsgQAngle::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsgQAngle::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsgQAngle::GetClassData() const { return &_class_data_; }
+
+
+void CMsgQAngle::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsgQAngle*>(&to_msg);
+  auto& from = static_cast<const CMsgQAngle&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsgQAngle)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.z_ = from._impl_.z_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsgQAngle::CopyFrom(const CMsgQAngle& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsgQAngle)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsgQAngle::IsInitialized() const {
+  return true;
+}
+
+void CMsgQAngle::InternalSwap(CMsgQAngle* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CMsgQAngle, _impl_.z_)
+      + sizeof(CMsgQAngle::_impl_.z_)
+      - PROTOBUF_FIELD_OFFSET(CMsgQAngle, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsgQAngle::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[2]);
+}
+
+// ===================================================================
+
+class CMsg_CVars_CVar::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CMsg_CVars_CVar>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CMsg_CVars_CVar::CMsg_CVars_CVar(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsg_CVars.CVar)
+}
+CMsg_CVars_CVar::CMsg_CVars_CVar(const CMsg_CVars_CVar& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsg_CVars_CVar* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:CMsg_CVars.CVar)
+}
+
+inline void CMsg_CVars_CVar::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CMsg_CVars_CVar::~CMsg_CVars_CVar() {
+  // @@protoc_insertion_point(destructor:CMsg_CVars.CVar)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsg_CVars_CVar::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void CMsg_CVars_CVar::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsg_CVars_CVar::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsg_CVars.CVar)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsg_CVars_CVar::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CMsg_CVars.CVar.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CMsg_CVars.CVar.value");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsg_CVars_CVar::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsg_CVars.CVar)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CMsg_CVars.CVar.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string value = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CMsg_CVars.CVar.value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsg_CVars.CVar)
+  return target;
+}
+
+size_t CMsg_CVars_CVar::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsg_CVars.CVar)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string value = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_value());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsg_CVars_CVar::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsg_CVars_CVar::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsg_CVars_CVar::GetClassData() const { return &_class_data_; }
+
+
+void CMsg_CVars_CVar::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsg_CVars_CVar*>(&to_msg);
+  auto& from = static_cast<const CMsg_CVars_CVar&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsg_CVars.CVar)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsg_CVars_CVar::CopyFrom(const CMsg_CVars_CVar& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsg_CVars.CVar)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsg_CVars_CVar::IsInitialized() const {
+  return true;
+}
+
+void CMsg_CVars_CVar::InternalSwap(CMsg_CVars_CVar* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsg_CVars_CVar::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[3]);
+}
+
+// ===================================================================
+
+class CMsg_CVars::_Internal {
+ public:
+};
+
+CMsg_CVars::CMsg_CVars(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CMsg_CVars)
+}
+CMsg_CVars::CMsg_CVars(const CMsg_CVars& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CMsg_CVars* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cvars_){from._impl_.cvars_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CMsg_CVars)
+}
+
+inline void CMsg_CVars::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cvars_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CMsg_CVars::~CMsg_CVars() {
+  // @@protoc_insertion_point(destructor:CMsg_CVars)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CMsg_CVars::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cvars_.~RepeatedPtrField();
+}
+
+void CMsg_CVars::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CMsg_CVars::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMsg_CVars)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cvars_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CMsg_CVars::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CMsg_CVars.CVar cvars = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_cvars(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CMsg_CVars::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CMsg_CVars)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CMsg_CVars.CVar cvars = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_cvars_size()); i < n; i++) {
+    const auto& repfield = this->_internal_cvars(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CMsg_CVars)
+  return target;
+}
+
+size_t CMsg_CVars::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMsg_CVars)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CMsg_CVars.CVar cvars = 1;
+  total_size += 1UL * this->_internal_cvars_size();
+  for (const auto& msg : this->_impl_.cvars_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CMsg_CVars::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CMsg_CVars::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CMsg_CVars::GetClassData() const { return &_class_data_; }
+
+
+void CMsg_CVars::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CMsg_CVars*>(&to_msg);
+  auto& from = static_cast<const CMsg_CVars&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CMsg_CVars)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.cvars_.MergeFrom(from._impl_.cvars_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CMsg_CVars::CopyFrom(const CMsg_CVars& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMsg_CVars)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMsg_CVars::IsInitialized() const {
+  return true;
+}
+
+void CMsg_CVars::InternalSwap(CMsg_CVars* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.cvars_.InternalSwap(&other->_impl_.cvars_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CMsg_CVars::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[4]);
+}
+
+// ===================================================================
+
+class CNETMsg_NOP::_Internal {
+ public:
+};
+
+CNETMsg_NOP::CNETMsg_NOP(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:CNETMsg_NOP)
+}
+CNETMsg_NOP::CNETMsg_NOP(const CNETMsg_NOP& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CNETMsg_NOP* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CNETMsg_NOP)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CNETMsg_NOP::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CNETMsg_NOP::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CNETMsg_NOP::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[5]);
+}
+
+// ===================================================================
+
+class CNETMsg_SplitScreenUser::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CNETMsg_SplitScreenUser>()._impl_._has_bits_);
+  static void set_has_slot(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CNETMsg_SplitScreenUser::CNETMsg_SplitScreenUser(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNETMsg_SplitScreenUser)
+}
+CNETMsg_SplitScreenUser::CNETMsg_SplitScreenUser(const CNETMsg_SplitScreenUser& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CNETMsg_SplitScreenUser* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slot_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.slot_ = from._impl_.slot_;
+  // @@protoc_insertion_point(copy_constructor:CNETMsg_SplitScreenUser)
+}
+
+inline void CNETMsg_SplitScreenUser::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.slot_){0}
+  };
+}
+
+CNETMsg_SplitScreenUser::~CNETMsg_SplitScreenUser() {
+  // @@protoc_insertion_point(destructor:CNETMsg_SplitScreenUser)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CNETMsg_SplitScreenUser::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CNETMsg_SplitScreenUser::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CNETMsg_SplitScreenUser::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNETMsg_SplitScreenUser)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slot_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CNETMsg_SplitScreenUser::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 slot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_slot(&has_bits);
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CNETMsg_SplitScreenUser::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNETMsg_SplitScreenUser)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 slot = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_slot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNETMsg_SplitScreenUser)
+  return target;
+}
+
+size_t CNETMsg_SplitScreenUser::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNETMsg_SplitScreenUser)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 slot = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_slot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CNETMsg_SplitScreenUser::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CNETMsg_SplitScreenUser::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CNETMsg_SplitScreenUser::GetClassData() const { return &_class_data_; }
+
+
+void CNETMsg_SplitScreenUser::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CNETMsg_SplitScreenUser*>(&to_msg);
+  auto& from = static_cast<const CNETMsg_SplitScreenUser&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNETMsg_SplitScreenUser)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_slot()) {
+    _this->_internal_set_slot(from._internal_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CNETMsg_SplitScreenUser::CopyFrom(const CNETMsg_SplitScreenUser& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNETMsg_SplitScreenUser)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CNETMsg_SplitScreenUser::IsInitialized() const {
+  return true;
+}
+
+void CNETMsg_SplitScreenUser::InternalSwap(CNETMsg_SplitScreenUser* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.slot_, other->_impl_.slot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CNETMsg_SplitScreenUser::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[6]);
+}
+
+// ===================================================================
+
+class CNETMsg_Disconnect::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CNETMsg_Disconnect>()._impl_._has_bits_);
+  static void set_has_reason(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CNETMsg_Disconnect::CNETMsg_Disconnect(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNETMsg_Disconnect)
+}
+CNETMsg_Disconnect::CNETMsg_Disconnect(const CNETMsg_Disconnect& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CNETMsg_Disconnect* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reason_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.reason_ = from._impl_.reason_;
+  // @@protoc_insertion_point(copy_constructor:CNETMsg_Disconnect)
+}
+
+inline void CNETMsg_Disconnect::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reason_){0}
+  };
+}
+
+CNETMsg_Disconnect::~CNETMsg_Disconnect() {
+  // @@protoc_insertion_point(destructor:CNETMsg_Disconnect)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CNETMsg_Disconnect::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CNETMsg_Disconnect::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CNETMsg_Disconnect::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNETMsg_Disconnect)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.reason_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CNETMsg_Disconnect::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .ENetworkDisconnectionReason reason = 2 [default = NETWORK_DISCONNECT_INVALID];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::ENetworkDisconnectionReason_IsValid(val))) {
+            _internal_set_reason(static_cast<::ENetworkDisconnectionReason>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CNETMsg_Disconnect::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNETMsg_Disconnect)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .ENetworkDisconnectionReason reason = 2 [default = NETWORK_DISCONNECT_INVALID];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_reason(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNETMsg_Disconnect)
+  return target;
+}
+
+size_t CNETMsg_Disconnect::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNETMsg_Disconnect)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .ENetworkDisconnectionReason reason = 2 [default = NETWORK_DISCONNECT_INVALID];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_reason());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CNETMsg_Disconnect::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CNETMsg_Disconnect::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CNETMsg_Disconnect::GetClassData() const { return &_class_data_; }
+
+
+void CNETMsg_Disconnect::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CNETMsg_Disconnect*>(&to_msg);
+  auto& from = static_cast<const CNETMsg_Disconnect&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNETMsg_Disconnect)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_reason()) {
+    _this->_internal_set_reason(from._internal_reason());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CNETMsg_Disconnect::CopyFrom(const CNETMsg_Disconnect& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNETMsg_Disconnect)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CNETMsg_Disconnect::IsInitialized() const {
+  return true;
+}
+
+void CNETMsg_Disconnect::InternalSwap(CNETMsg_Disconnect* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.reason_, other->_impl_.reason_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CNETMsg_Disconnect::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[7]);
+}
+
+// ===================================================================
+
+class CNETMsg_File::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CNETMsg_File>()._impl_._has_bits_);
+  static void set_has_transfer_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_file_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_is_replay_demo_file(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_deny(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_is_file_requested(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+CNETMsg_File::CNETMsg_File(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNETMsg_File)
+}
+CNETMsg_File::CNETMsg_File(const CNETMsg_File& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CNETMsg_File* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.transfer_id_){}
+    , decltype(_impl_.is_replay_demo_file_){}
+    , decltype(_impl_.deny_){}
+    , decltype(_impl_.is_file_requested_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_file_name()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.transfer_id_, &from._impl_.transfer_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_file_requested_) -
+    reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.is_file_requested_));
+  // @@protoc_insertion_point(copy_constructor:CNETMsg_File)
+}
+
+inline void CNETMsg_File::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.transfer_id_){0}
+    , decltype(_impl_.is_replay_demo_file_){false}
+    , decltype(_impl_.deny_){false}
+    , decltype(_impl_.is_file_requested_){false}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CNETMsg_File::~CNETMsg_File() {
+  // @@protoc_insertion_point(destructor:CNETMsg_File)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CNETMsg_File::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+}
+
+void CNETMsg_File::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CNETMsg_File::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNETMsg_File)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.file_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000001eu) {
+    ::memset(&_impl_.transfer_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.is_file_requested_) -
+        reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.is_file_requested_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CNETMsg_File::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 transfer_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_transfer_id(&has_bits);
+          _impl_.transfer_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string file_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CNETMsg_File.file_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_replay_demo_file = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_is_replay_demo_file(&has_bits);
+          _impl_.is_replay_demo_file_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool deny = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_deny(&has_bits);
+          _impl_.deny_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_file_requested = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_is_file_requested(&has_bits);
+          _impl_.is_file_requested_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CNETMsg_File::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNETMsg_File)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 transfer_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_transfer_id(), target);
+  }
+
+  // optional string file_name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CNETMsg_File.file_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_file_name(), target);
+  }
+
+  // optional bool is_replay_demo_file = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_replay_demo_file(), target);
+  }
+
+  // optional bool deny = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_deny(), target);
+  }
+
+  // optional bool is_file_requested = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_is_file_requested(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNETMsg_File)
+  return target;
+}
+
+size_t CNETMsg_File::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNETMsg_File)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string file_name = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_file_name());
+    }
+
+    // optional int32 transfer_id = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_transfer_id());
+    }
+
+    // optional bool is_replay_demo_file = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool deny = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool is_file_requested = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CNETMsg_File::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CNETMsg_File::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CNETMsg_File::GetClassData() const { return &_class_data_; }
+
+
+void CNETMsg_File::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CNETMsg_File*>(&to_msg);
+  auto& from = static_cast<const CNETMsg_File&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNETMsg_File)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_file_name(from._internal_file_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.transfer_id_ = from._impl_.transfer_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.is_replay_demo_file_ = from._impl_.is_replay_demo_file_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.deny_ = from._impl_.deny_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.is_file_requested_ = from._impl_.is_file_requested_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CNETMsg_File::CopyFrom(const CNETMsg_File& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNETMsg_File)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CNETMsg_File::IsInitialized() const {
+  return true;
+}
+
+void CNETMsg_File::InternalSwap(CNETMsg_File* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CNETMsg_File, _impl_.is_file_requested_)
+      + sizeof(CNETMsg_File::_impl_.is_file_requested_)
+      - PROTOBUF_FIELD_OFFSET(CNETMsg_File, _impl_.transfer_id_)>(
+          reinterpret_cast<char*>(&_impl_.transfer_id_),
+          reinterpret_cast<char*>(&other->_impl_.transfer_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CNETMsg_File::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[8]);
+}
+
+// ===================================================================
+
+class CNETMsg_Tick::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CNETMsg_Tick>()._impl_._has_bits_);
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_host_computationtime(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_host_computationtime_std_deviation(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_host_framestarttime_std_deviation(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+CNETMsg_Tick::CNETMsg_Tick(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNETMsg_Tick)
+}
+CNETMsg_Tick::CNETMsg_Tick(const CNETMsg_Tick& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CNETMsg_Tick* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tick_){}
+    , decltype(_impl_.host_computationtime_){}
+    , decltype(_impl_.host_computationtime_std_deviation_){}
+    , decltype(_impl_.host_framestarttime_std_deviation_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.tick_, &from._impl_.tick_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.host_framestarttime_std_deviation_) -
+    reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.host_framestarttime_std_deviation_));
+  // @@protoc_insertion_point(copy_constructor:CNETMsg_Tick)
+}
+
+inline void CNETMsg_Tick::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tick_){0u}
+    , decltype(_impl_.host_computationtime_){0u}
+    , decltype(_impl_.host_computationtime_std_deviation_){0u}
+    , decltype(_impl_.host_framestarttime_std_deviation_){0u}
+  };
+}
+
+CNETMsg_Tick::~CNETMsg_Tick() {
+  // @@protoc_insertion_point(destructor:CNETMsg_Tick)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CNETMsg_Tick::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CNETMsg_Tick::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CNETMsg_Tick::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNETMsg_Tick)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.tick_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.host_framestarttime_std_deviation_) -
+        reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.host_framestarttime_std_deviation_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CNETMsg_Tick::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 host_computationtime = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_host_computationtime(&has_bits);
+          _impl_.host_computationtime_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 host_computationtime_std_deviation = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_host_computationtime_std_deviation(&has_bits);
+          _impl_.host_computationtime_std_deviation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 host_framestarttime_std_deviation = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_host_framestarttime_std_deviation(&has_bits);
+          _impl_.host_framestarttime_std_deviation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CNETMsg_Tick::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNETMsg_Tick)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 tick = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_tick(), target);
+  }
+
+  // optional uint32 host_computationtime = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_host_computationtime(), target);
+  }
+
+  // optional uint32 host_computationtime_std_deviation = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_host_computationtime_std_deviation(), target);
+  }
+
+  // optional uint32 host_framestarttime_std_deviation = 6;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_host_framestarttime_std_deviation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNETMsg_Tick)
+  return target;
+}
+
+size_t CNETMsg_Tick::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNETMsg_Tick)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional uint32 tick = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tick());
+    }
+
+    // optional uint32 host_computationtime = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_host_computationtime());
+    }
+
+    // optional uint32 host_computationtime_std_deviation = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_host_computationtime_std_deviation());
+    }
+
+    // optional uint32 host_framestarttime_std_deviation = 6;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_host_framestarttime_std_deviation());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CNETMsg_Tick::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CNETMsg_Tick::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CNETMsg_Tick::GetClassData() const { return &_class_data_; }
+
+
+void CNETMsg_Tick::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CNETMsg_Tick*>(&to_msg);
+  auto& from = static_cast<const CNETMsg_Tick&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNETMsg_Tick)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.host_computationtime_ = from._impl_.host_computationtime_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.host_computationtime_std_deviation_ = from._impl_.host_computationtime_std_deviation_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.host_framestarttime_std_deviation_ = from._impl_.host_framestarttime_std_deviation_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CNETMsg_Tick::CopyFrom(const CNETMsg_Tick& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNETMsg_Tick)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CNETMsg_Tick::IsInitialized() const {
+  return true;
+}
+
+void CNETMsg_Tick::InternalSwap(CNETMsg_Tick* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CNETMsg_Tick, _impl_.host_framestarttime_std_deviation_)
+      + sizeof(CNETMsg_Tick::_impl_.host_framestarttime_std_deviation_)
+      - PROTOBUF_FIELD_OFFSET(CNETMsg_Tick, _impl_.tick_)>(
+          reinterpret_cast<char*>(&_impl_.tick_),
+          reinterpret_cast<char*>(&other->_impl_.tick_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CNETMsg_Tick::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[9]);
+}
+
+// ===================================================================
+
+class CNETMsg_StringCmd::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CNETMsg_StringCmd>()._impl_._has_bits_);
+  static void set_has_command(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CNETMsg_StringCmd::CNETMsg_StringCmd(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNETMsg_StringCmd)
+}
+CNETMsg_StringCmd::CNETMsg_StringCmd(const CNETMsg_StringCmd& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CNETMsg_StringCmd* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.command_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_command()) {
+    _this->_impl_.command_.Set(from._internal_command(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:CNETMsg_StringCmd)
+}
+
+inline void CNETMsg_StringCmd::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.command_){}
+  };
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CNETMsg_StringCmd::~CNETMsg_StringCmd() {
+  // @@protoc_insertion_point(destructor:CNETMsg_StringCmd)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CNETMsg_StringCmd::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.command_.Destroy();
+}
+
+void CNETMsg_StringCmd::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CNETMsg_StringCmd::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNETMsg_StringCmd)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.command_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CNETMsg_StringCmd::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string command = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_command();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CNETMsg_StringCmd.command");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CNETMsg_StringCmd::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNETMsg_StringCmd)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string command = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_command().data(), static_cast<int>(this->_internal_command().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CNETMsg_StringCmd.command");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_command(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNETMsg_StringCmd)
+  return target;
+}
+
+size_t CNETMsg_StringCmd::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNETMsg_StringCmd)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string command = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_command());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CNETMsg_StringCmd::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CNETMsg_StringCmd::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CNETMsg_StringCmd::GetClassData() const { return &_class_data_; }
+
+
+void CNETMsg_StringCmd::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CNETMsg_StringCmd*>(&to_msg);
+  auto& from = static_cast<const CNETMsg_StringCmd&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNETMsg_StringCmd)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_command()) {
+    _this->_internal_set_command(from._internal_command());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CNETMsg_StringCmd::CopyFrom(const CNETMsg_StringCmd& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNETMsg_StringCmd)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CNETMsg_StringCmd::IsInitialized() const {
+  return true;
+}
+
+void CNETMsg_StringCmd::InternalSwap(CNETMsg_StringCmd* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.command_, lhs_arena,
+      &other->_impl_.command_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CNETMsg_StringCmd::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[10]);
+}
+
+// ===================================================================
+
+class CNETMsg_SetConVar::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CNETMsg_SetConVar>()._impl_._has_bits_);
+  static const ::CMsg_CVars& convars(const CNETMsg_SetConVar* msg);
+  static void set_has_convars(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::CMsg_CVars&
+CNETMsg_SetConVar::_Internal::convars(const CNETMsg_SetConVar* msg) {
+  return *msg->_impl_.convars_;
+}
+CNETMsg_SetConVar::CNETMsg_SetConVar(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNETMsg_SetConVar)
+}
+CNETMsg_SetConVar::CNETMsg_SetConVar(const CNETMsg_SetConVar& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CNETMsg_SetConVar* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.convars_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_convars()) {
+    _this->_impl_.convars_ = new ::CMsg_CVars(*from._impl_.convars_);
+  }
+  // @@protoc_insertion_point(copy_constructor:CNETMsg_SetConVar)
+}
+
+inline void CNETMsg_SetConVar::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.convars_){nullptr}
+  };
+}
+
+CNETMsg_SetConVar::~CNETMsg_SetConVar() {
+  // @@protoc_insertion_point(destructor:CNETMsg_SetConVar)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CNETMsg_SetConVar::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.convars_;
+}
+
+void CNETMsg_SetConVar::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CNETMsg_SetConVar::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNETMsg_SetConVar)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.convars_ != nullptr);
+    _impl_.convars_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CNETMsg_SetConVar::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .CMsg_CVars convars = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_convars(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CNETMsg_SetConVar::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNETMsg_SetConVar)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .CMsg_CVars convars = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::convars(this),
+        _Internal::convars(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNETMsg_SetConVar)
+  return target;
+}
+
+size_t CNETMsg_SetConVar::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNETMsg_SetConVar)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .CMsg_CVars convars = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.convars_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CNETMsg_SetConVar::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CNETMsg_SetConVar::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CNETMsg_SetConVar::GetClassData() const { return &_class_data_; }
+
+
+void CNETMsg_SetConVar::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CNETMsg_SetConVar*>(&to_msg);
+  auto& from = static_cast<const CNETMsg_SetConVar&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNETMsg_SetConVar)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_convars()) {
+    _this->_internal_mutable_convars()->::CMsg_CVars::MergeFrom(
+        from._internal_convars());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CNETMsg_SetConVar::CopyFrom(const CNETMsg_SetConVar& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNETMsg_SetConVar)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CNETMsg_SetConVar::IsInitialized() const {
+  return true;
+}
+
+void CNETMsg_SetConVar::InternalSwap(CNETMsg_SetConVar* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.convars_, other->_impl_.convars_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CNETMsg_SetConVar::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[11]);
+}
+
+// ===================================================================
+
+class CNETMsg_SignonState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CNETMsg_SignonState>()._impl_._has_bits_);
+  static void set_has_signon_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_spawn_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_num_server_players(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_map_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CNETMsg_SignonState::CNETMsg_SignonState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CNETMsg_SignonState)
+}
+CNETMsg_SignonState::CNETMsg_SignonState(const CNETMsg_SignonState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CNETMsg_SignonState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.players_networkids_){from._impl_.players_networkids_}
+    , decltype(_impl_.map_name_){}
+    , decltype(_impl_.signon_state_){}
+    , decltype(_impl_.spawn_count_){}
+    , decltype(_impl_.num_server_players_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.map_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_map_name()) {
+    _this->_impl_.map_name_.Set(from._internal_map_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.signon_state_, &from._impl_.signon_state_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_server_players_) -
+    reinterpret_cast<char*>(&_impl_.signon_state_)) + sizeof(_impl_.num_server_players_));
+  // @@protoc_insertion_point(copy_constructor:CNETMsg_SignonState)
+}
+
+inline void CNETMsg_SignonState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.players_networkids_){arena}
+    , decltype(_impl_.map_name_){}
+    , decltype(_impl_.signon_state_){0u}
+    , decltype(_impl_.spawn_count_){0u}
+    , decltype(_impl_.num_server_players_){0u}
+  };
+  _impl_.map_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CNETMsg_SignonState::~CNETMsg_SignonState() {
+  // @@protoc_insertion_point(destructor:CNETMsg_SignonState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CNETMsg_SignonState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.players_networkids_.~RepeatedPtrField();
+  _impl_.map_name_.Destroy();
+}
+
+void CNETMsg_SignonState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CNETMsg_SignonState::Clear() {
+// @@protoc_insertion_point(message_clear_start:CNETMsg_SignonState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.players_networkids_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.map_name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.signon_state_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_server_players_) -
+        reinterpret_cast<char*>(&_impl_.signon_state_)) + sizeof(_impl_.num_server_players_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CNETMsg_SignonState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 signon_state = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_signon_state(&has_bits);
+          _impl_.signon_state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 spawn_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_spawn_count(&has_bits);
+          _impl_.spawn_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 num_server_players = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_num_server_players(&has_bits);
+          _impl_.num_server_players_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string players_networkids = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_players_networkids();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "CNETMsg_SignonState.players_networkids");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string map_name = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_map_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CNETMsg_SignonState.map_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CNETMsg_SignonState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CNETMsg_SignonState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 signon_state = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_signon_state(), target);
+  }
+
+  // optional uint32 spawn_count = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_spawn_count(), target);
+  }
+
+  // optional uint32 num_server_players = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_num_server_players(), target);
+  }
+
+  // repeated string players_networkids = 4;
+  for (int i = 0, n = this->_internal_players_networkids_size(); i < n; i++) {
+    const auto& s = this->_internal_players_networkids(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CNETMsg_SignonState.players_networkids");
+    target = stream->WriteString(4, s, target);
+  }
+
+  // optional string map_name = 5;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_map_name().data(), static_cast<int>(this->_internal_map_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CNETMsg_SignonState.map_name");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_map_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CNETMsg_SignonState)
+  return target;
+}
+
+size_t CNETMsg_SignonState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CNETMsg_SignonState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string players_networkids = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.players_networkids_.size());
+  for (int i = 0, n = _impl_.players_networkids_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.players_networkids_.Get(i));
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string map_name = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_map_name());
+    }
+
+    // optional uint32 signon_state = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_signon_state());
+    }
+
+    // optional uint32 spawn_count = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_spawn_count());
+    }
+
+    // optional uint32 num_server_players = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_server_players());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CNETMsg_SignonState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CNETMsg_SignonState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CNETMsg_SignonState::GetClassData() const { return &_class_data_; }
+
+
+void CNETMsg_SignonState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CNETMsg_SignonState*>(&to_msg);
+  auto& from = static_cast<const CNETMsg_SignonState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CNETMsg_SignonState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.players_networkids_.MergeFrom(from._impl_.players_networkids_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_map_name(from._internal_map_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.signon_state_ = from._impl_.signon_state_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.spawn_count_ = from._impl_.spawn_count_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.num_server_players_ = from._impl_.num_server_players_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CNETMsg_SignonState::CopyFrom(const CNETMsg_SignonState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CNETMsg_SignonState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CNETMsg_SignonState::IsInitialized() const {
+  return true;
+}
+
+void CNETMsg_SignonState::InternalSwap(CNETMsg_SignonState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.players_networkids_.InternalSwap(&other->_impl_.players_networkids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.map_name_, lhs_arena,
+      &other->_impl_.map_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CNETMsg_SignonState, _impl_.num_server_players_)
+      + sizeof(CNETMsg_SignonState::_impl_.num_server_players_)
+      - PROTOBUF_FIELD_OFFSET(CNETMsg_SignonState, _impl_.signon_state_)>(
+          reinterpret_cast<char*>(&_impl_.signon_state_),
+          reinterpret_cast<char*>(&other->_impl_.signon_state_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CNETMsg_SignonState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[12]);
+}
+
+// ===================================================================
+
+class CSVCMsg_GameEvent_key_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_GameEvent_key_t>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_val_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_val_float(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_val_long(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_val_short(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_val_byte(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_val_bool(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_val_uint64(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+};
+
+CSVCMsg_GameEvent_key_t::CSVCMsg_GameEvent_key_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_GameEvent.key_t)
+}
+CSVCMsg_GameEvent_key_t::CSVCMsg_GameEvent_key_t(const CSVCMsg_GameEvent_key_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_GameEvent_key_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.val_string_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.val_float_){}
+    , decltype(_impl_.val_long_){}
+    , decltype(_impl_.val_short_){}
+    , decltype(_impl_.val_byte_){}
+    , decltype(_impl_.val_bool_){}
+    , decltype(_impl_.val_uint64_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.val_string_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.val_string_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_val_string()) {
+    _this->_impl_.val_string_.Set(from._internal_val_string(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.val_uint64_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.val_uint64_));
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_GameEvent.key_t)
+}
+
+inline void CSVCMsg_GameEvent_key_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.val_string_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.val_float_){0}
+    , decltype(_impl_.val_long_){0}
+    , decltype(_impl_.val_short_){0}
+    , decltype(_impl_.val_byte_){0}
+    , decltype(_impl_.val_bool_){false}
+    , decltype(_impl_.val_uint64_){uint64_t{0u}}
+  };
+  _impl_.val_string_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.val_string_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_GameEvent_key_t::~CSVCMsg_GameEvent_key_t() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_GameEvent.key_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_GameEvent_key_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.val_string_.Destroy();
+}
+
+void CSVCMsg_GameEvent_key_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_GameEvent_key_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_GameEvent.key_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.val_string_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.val_uint64_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.val_uint64_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_GameEvent_key_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string val_string = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_val_string();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_GameEvent.key_t.val_string");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float val_float = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_val_float(&has_bits);
+          _impl_.val_float_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 val_long = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_val_long(&has_bits);
+          _impl_.val_long_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 val_short = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_val_short(&has_bits);
+          _impl_.val_short_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 val_byte = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_val_byte(&has_bits);
+          _impl_.val_byte_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool val_bool = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_val_bool(&has_bits);
+          _impl_.val_bool_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 val_uint64 = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_val_uint64(&has_bits);
+          _impl_.val_uint64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_GameEvent_key_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_GameEvent.key_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_type(), target);
+  }
+
+  // optional string val_string = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_val_string().data(), static_cast<int>(this->_internal_val_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_GameEvent.key_t.val_string");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_val_string(), target);
+  }
+
+  // optional float val_float = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_val_float(), target);
+  }
+
+  // optional int32 val_long = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_val_long(), target);
+  }
+
+  // optional int32 val_short = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_val_short(), target);
+  }
+
+  // optional int32 val_byte = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_val_byte(), target);
+  }
+
+  // optional bool val_bool = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_val_bool(), target);
+  }
+
+  // optional uint64 val_uint64 = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_val_uint64(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_GameEvent.key_t)
+  return target;
+}
+
+size_t CSVCMsg_GameEvent_key_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_GameEvent.key_t)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string val_string = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_val_string());
+    }
+
+    // optional int32 type = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+    }
+
+    // optional float val_float = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 val_long = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_val_long());
+    }
+
+    // optional int32 val_short = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_val_short());
+    }
+
+    // optional int32 val_byte = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_val_byte());
+    }
+
+    // optional bool val_bool = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint64 val_uint64 = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_val_uint64());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_GameEvent_key_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_GameEvent_key_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_GameEvent_key_t::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_GameEvent_key_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_GameEvent_key_t*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_GameEvent_key_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_GameEvent.key_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_val_string(from._internal_val_string());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.val_float_ = from._impl_.val_float_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.val_long_ = from._impl_.val_long_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.val_short_ = from._impl_.val_short_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.val_byte_ = from._impl_.val_byte_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.val_bool_ = from._impl_.val_bool_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.val_uint64_ = from._impl_.val_uint64_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_GameEvent_key_t::CopyFrom(const CSVCMsg_GameEvent_key_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_GameEvent.key_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_GameEvent_key_t::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_GameEvent_key_t::InternalSwap(CSVCMsg_GameEvent_key_t* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.val_string_, lhs_arena,
+      &other->_impl_.val_string_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsg_GameEvent_key_t, _impl_.val_uint64_)
+      + sizeof(CSVCMsg_GameEvent_key_t::_impl_.val_uint64_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsg_GameEvent_key_t, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_GameEvent_key_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[13]);
+}
+
+// ===================================================================
+
+class CSVCMsg_GameEvent::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_GameEvent>()._impl_._has_bits_);
+  static void set_has_event_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_eventid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CSVCMsg_GameEvent::CSVCMsg_GameEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_GameEvent)
+}
+CSVCMsg_GameEvent::CSVCMsg_GameEvent(const CSVCMsg_GameEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_GameEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.event_name_){}
+    , decltype(_impl_.eventid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.event_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_event_name()) {
+    _this->_impl_.event_name_.Set(from._internal_event_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.eventid_ = from._impl_.eventid_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_GameEvent)
+}
+
+inline void CSVCMsg_GameEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){arena}
+    , decltype(_impl_.event_name_){}
+    , decltype(_impl_.eventid_){0}
+  };
+  _impl_.event_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_GameEvent::~CSVCMsg_GameEvent() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_GameEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_GameEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.event_name_.Destroy();
+}
+
+void CSVCMsg_GameEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_GameEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_GameEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.event_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.eventid_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_GameEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string event_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_event_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CSVCMsg_GameEvent.event_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 eventid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_eventid(&has_bits);
+          _impl_.eventid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CSVCMsg_GameEvent.key_t keys = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_keys(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_GameEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_GameEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string event_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_event_name().data(), static_cast<int>(this->_internal_event_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CSVCMsg_GameEvent.event_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_event_name(), target);
+  }
+
+  // optional int32 eventid = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_eventid(), target);
+  }
+
+  // repeated .CSVCMsg_GameEvent.key_t keys = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_keys_size()); i < n; i++) {
+    const auto& repfield = this->_internal_keys(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_GameEvent)
+  return target;
+}
+
+size_t CSVCMsg_GameEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_GameEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsg_GameEvent.key_t keys = 3;
+  total_size += 1UL * this->_internal_keys_size();
+  for (const auto& msg : this->_impl_.keys_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string event_name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_event_name());
+    }
+
+    // optional int32 eventid = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_eventid());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_GameEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_GameEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_GameEvent::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_GameEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_GameEvent*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_GameEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_GameEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_event_name(from._internal_event_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.eventid_ = from._impl_.eventid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_GameEvent::CopyFrom(const CSVCMsg_GameEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_GameEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_GameEvent::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_GameEvent::InternalSwap(CSVCMsg_GameEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.event_name_, lhs_arena,
+      &other->_impl_.event_name_, rhs_arena
+  );
+  swap(_impl_.eventid_, other->_impl_.eventid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_GameEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[14]);
+}
+
+// ===================================================================
+
+class CSVCMsgList_GameEvents_event_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsgList_GameEvents_event_t>()._impl_._has_bits_);
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::CSVCMsg_GameEvent& event(const CSVCMsgList_GameEvents_event_t* msg);
+  static void set_has_event(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::CSVCMsg_GameEvent&
+CSVCMsgList_GameEvents_event_t::_Internal::event(const CSVCMsgList_GameEvents_event_t* msg) {
+  return *msg->_impl_.event_;
+}
+CSVCMsgList_GameEvents_event_t::CSVCMsgList_GameEvents_event_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsgList_GameEvents.event_t)
+}
+CSVCMsgList_GameEvents_event_t::CSVCMsgList_GameEvents_event_t(const CSVCMsgList_GameEvents_event_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsgList_GameEvents_event_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.event_){nullptr}
+    , decltype(_impl_.tick_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_event()) {
+    _this->_impl_.event_ = new ::CSVCMsg_GameEvent(*from._impl_.event_);
+  }
+  _this->_impl_.tick_ = from._impl_.tick_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsgList_GameEvents.event_t)
+}
+
+inline void CSVCMsgList_GameEvents_event_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.event_){nullptr}
+    , decltype(_impl_.tick_){0}
+  };
+}
+
+CSVCMsgList_GameEvents_event_t::~CSVCMsgList_GameEvents_event_t() {
+  // @@protoc_insertion_point(destructor:CSVCMsgList_GameEvents.event_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsgList_GameEvents_event_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.event_;
+}
+
+void CSVCMsgList_GameEvents_event_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsgList_GameEvents_event_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsgList_GameEvents.event_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.event_ != nullptr);
+    _impl_.event_->Clear();
+  }
+  _impl_.tick_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsgList_GameEvents_event_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CSVCMsg_GameEvent event = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_event(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsgList_GameEvents_event_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsgList_GameEvents.event_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 tick = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_tick(), target);
+  }
+
+  // optional .CSVCMsg_GameEvent event = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::event(this),
+        _Internal::event(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsgList_GameEvents.event_t)
+  return target;
+}
+
+size_t CSVCMsgList_GameEvents_event_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsgList_GameEvents.event_t)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .CSVCMsg_GameEvent event = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.event_);
+    }
+
+    // optional int32 tick = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tick());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsgList_GameEvents_event_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsgList_GameEvents_event_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsgList_GameEvents_event_t::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsgList_GameEvents_event_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsgList_GameEvents_event_t*>(&to_msg);
+  auto& from = static_cast<const CSVCMsgList_GameEvents_event_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsgList_GameEvents.event_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_event()->::CSVCMsg_GameEvent::MergeFrom(
+          from._internal_event());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsgList_GameEvents_event_t::CopyFrom(const CSVCMsgList_GameEvents_event_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsgList_GameEvents.event_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsgList_GameEvents_event_t::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsgList_GameEvents_event_t::InternalSwap(CSVCMsgList_GameEvents_event_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsgList_GameEvents_event_t, _impl_.tick_)
+      + sizeof(CSVCMsgList_GameEvents_event_t::_impl_.tick_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsgList_GameEvents_event_t, _impl_.event_)>(
+          reinterpret_cast<char*>(&_impl_.event_),
+          reinterpret_cast<char*>(&other->_impl_.event_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsgList_GameEvents_event_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[15]);
+}
+
+// ===================================================================
+
+class CSVCMsgList_GameEvents::_Internal {
+ public:
+};
+
+CSVCMsgList_GameEvents::CSVCMsgList_GameEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsgList_GameEvents)
+}
+CSVCMsgList_GameEvents::CSVCMsgList_GameEvents(const CSVCMsgList_GameEvents& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsgList_GameEvents* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){from._impl_.events_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CSVCMsgList_GameEvents)
+}
+
+inline void CSVCMsgList_GameEvents::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CSVCMsgList_GameEvents::~CSVCMsgList_GameEvents() {
+  // @@protoc_insertion_point(destructor:CSVCMsgList_GameEvents)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsgList_GameEvents::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+}
+
+void CSVCMsgList_GameEvents::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsgList_GameEvents::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsgList_GameEvents)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsgList_GameEvents::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CSVCMsgList_GameEvents.event_t events = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsgList_GameEvents::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsgList_GameEvents)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsgList_GameEvents.event_t events = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsgList_GameEvents)
+  return target;
+}
+
+size_t CSVCMsgList_GameEvents::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsgList_GameEvents)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsgList_GameEvents.event_t events = 1;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsgList_GameEvents::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsgList_GameEvents::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsgList_GameEvents::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsgList_GameEvents::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsgList_GameEvents*>(&to_msg);
+  auto& from = static_cast<const CSVCMsgList_GameEvents&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsgList_GameEvents)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsgList_GameEvents::CopyFrom(const CSVCMsgList_GameEvents& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsgList_GameEvents)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsgList_GameEvents::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsgList_GameEvents::InternalSwap(CSVCMsgList_GameEvents* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsgList_GameEvents::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[16]);
+}
+
+// ===================================================================
+
+class CSVCMsg_UserMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsg_UserMessage>()._impl_._has_bits_);
+  static void set_has_msg_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_msg_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CSVCMsg_UserMessage::CSVCMsg_UserMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsg_UserMessage)
+}
+CSVCMsg_UserMessage::CSVCMsg_UserMessage(const CSVCMsg_UserMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsg_UserMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.msg_data_){}
+    , decltype(_impl_.msg_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_msg_data()) {
+    _this->_impl_.msg_data_.Set(from._internal_msg_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.msg_type_ = from._impl_.msg_type_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsg_UserMessage)
+}
+
+inline void CSVCMsg_UserMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.msg_data_){}
+    , decltype(_impl_.msg_type_){0}
+  };
+  _impl_.msg_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CSVCMsg_UserMessage::~CSVCMsg_UserMessage() {
+  // @@protoc_insertion_point(destructor:CSVCMsg_UserMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsg_UserMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.msg_data_.Destroy();
+}
+
+void CSVCMsg_UserMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsg_UserMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsg_UserMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.msg_data_.ClearNonDefaultToEmpty();
+  }
+  _impl_.msg_type_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsg_UserMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 msg_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_msg_type(&has_bits);
+          _impl_.msg_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes msg_data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_msg_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsg_UserMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsg_UserMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 msg_type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_msg_type(), target);
+  }
+
+  // optional bytes msg_data = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_msg_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsg_UserMessage)
+  return target;
+}
+
+size_t CSVCMsg_UserMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsg_UserMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes msg_data = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_msg_data());
+    }
+
+    // optional int32 msg_type = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_msg_type());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsg_UserMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsg_UserMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsg_UserMessage::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsg_UserMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsg_UserMessage*>(&to_msg);
+  auto& from = static_cast<const CSVCMsg_UserMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsg_UserMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_msg_data(from._internal_msg_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.msg_type_ = from._impl_.msg_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsg_UserMessage::CopyFrom(const CSVCMsg_UserMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsg_UserMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsg_UserMessage::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsg_UserMessage::InternalSwap(CSVCMsg_UserMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_data_, lhs_arena,
+      &other->_impl_.msg_data_, rhs_arena
+  );
+  swap(_impl_.msg_type_, other->_impl_.msg_type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsg_UserMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[17]);
+}
+
+// ===================================================================
+
+class CSVCMsgList_UserMessages_usermsg_t::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CSVCMsgList_UserMessages_usermsg_t>()._impl_._has_bits_);
+  static void set_has_tick(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::CSVCMsg_UserMessage& msg(const CSVCMsgList_UserMessages_usermsg_t* msg);
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::CSVCMsg_UserMessage&
+CSVCMsgList_UserMessages_usermsg_t::_Internal::msg(const CSVCMsgList_UserMessages_usermsg_t* msg) {
+  return *msg->_impl_.msg_;
+}
+CSVCMsgList_UserMessages_usermsg_t::CSVCMsgList_UserMessages_usermsg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsgList_UserMessages.usermsg_t)
+}
+CSVCMsgList_UserMessages_usermsg_t::CSVCMsgList_UserMessages_usermsg_t(const CSVCMsgList_UserMessages_usermsg_t& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsgList_UserMessages_usermsg_t* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.msg_){nullptr}
+    , decltype(_impl_.tick_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_msg()) {
+    _this->_impl_.msg_ = new ::CSVCMsg_UserMessage(*from._impl_.msg_);
+  }
+  _this->_impl_.tick_ = from._impl_.tick_;
+  // @@protoc_insertion_point(copy_constructor:CSVCMsgList_UserMessages.usermsg_t)
+}
+
+inline void CSVCMsgList_UserMessages_usermsg_t::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.msg_){nullptr}
+    , decltype(_impl_.tick_){0}
+  };
+}
+
+CSVCMsgList_UserMessages_usermsg_t::~CSVCMsgList_UserMessages_usermsg_t() {
+  // @@protoc_insertion_point(destructor:CSVCMsgList_UserMessages.usermsg_t)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsgList_UserMessages_usermsg_t::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.msg_;
+}
+
+void CSVCMsgList_UserMessages_usermsg_t::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsgList_UserMessages_usermsg_t::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsgList_UserMessages.usermsg_t)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.msg_ != nullptr);
+    _impl_.msg_->Clear();
+  }
+  _impl_.tick_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsgList_UserMessages_usermsg_t::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_tick(&has_bits);
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CSVCMsg_UserMessage msg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_msg(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsgList_UserMessages_usermsg_t::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsgList_UserMessages.usermsg_t)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 tick = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_tick(), target);
+  }
+
+  // optional .CSVCMsg_UserMessage msg = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::msg(this),
+        _Internal::msg(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsgList_UserMessages.usermsg_t)
+  return target;
+}
+
+size_t CSVCMsgList_UserMessages_usermsg_t::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsgList_UserMessages.usermsg_t)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .CSVCMsg_UserMessage msg = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_);
+    }
+
+    // optional int32 tick = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_tick());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsgList_UserMessages_usermsg_t::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsgList_UserMessages_usermsg_t::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsgList_UserMessages_usermsg_t::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsgList_UserMessages_usermsg_t::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsgList_UserMessages_usermsg_t*>(&to_msg);
+  auto& from = static_cast<const CSVCMsgList_UserMessages_usermsg_t&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsgList_UserMessages.usermsg_t)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_msg()->::CSVCMsg_UserMessage::MergeFrom(
+          from._internal_msg());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tick_ = from._impl_.tick_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsgList_UserMessages_usermsg_t::CopyFrom(const CSVCMsgList_UserMessages_usermsg_t& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsgList_UserMessages.usermsg_t)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsgList_UserMessages_usermsg_t::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsgList_UserMessages_usermsg_t::InternalSwap(CSVCMsgList_UserMessages_usermsg_t* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSVCMsgList_UserMessages_usermsg_t, _impl_.tick_)
+      + sizeof(CSVCMsgList_UserMessages_usermsg_t::_impl_.tick_)
+      - PROTOBUF_FIELD_OFFSET(CSVCMsgList_UserMessages_usermsg_t, _impl_.msg_)>(
+          reinterpret_cast<char*>(&_impl_.msg_),
+          reinterpret_cast<char*>(&other->_impl_.msg_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsgList_UserMessages_usermsg_t::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[18]);
+}
+
+// ===================================================================
+
+class CSVCMsgList_UserMessages::_Internal {
+ public:
+};
+
+CSVCMsgList_UserMessages::CSVCMsgList_UserMessages(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CSVCMsgList_UserMessages)
+}
+CSVCMsgList_UserMessages::CSVCMsgList_UserMessages(const CSVCMsgList_UserMessages& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CSVCMsgList_UserMessages* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.usermsgs_){from._impl_.usermsgs_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CSVCMsgList_UserMessages)
+}
+
+inline void CSVCMsgList_UserMessages::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.usermsgs_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CSVCMsgList_UserMessages::~CSVCMsgList_UserMessages() {
+  // @@protoc_insertion_point(destructor:CSVCMsgList_UserMessages)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CSVCMsgList_UserMessages::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.usermsgs_.~RepeatedPtrField();
+}
+
+void CSVCMsgList_UserMessages::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CSVCMsgList_UserMessages::Clear() {
+// @@protoc_insertion_point(message_clear_start:CSVCMsgList_UserMessages)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.usermsgs_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CSVCMsgList_UserMessages::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .CSVCMsgList_UserMessages.usermsg_t usermsgs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_usermsgs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CSVCMsgList_UserMessages::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CSVCMsgList_UserMessages)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsgList_UserMessages.usermsg_t usermsgs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_usermsgs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_usermsgs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CSVCMsgList_UserMessages)
+  return target;
+}
+
+size_t CSVCMsgList_UserMessages::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CSVCMsgList_UserMessages)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CSVCMsgList_UserMessages.usermsg_t usermsgs = 1;
+  total_size += 1UL * this->_internal_usermsgs_size();
+  for (const auto& msg : this->_impl_.usermsgs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSVCMsgList_UserMessages::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CSVCMsgList_UserMessages::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSVCMsgList_UserMessages::GetClassData() const { return &_class_data_; }
+
+
+void CSVCMsgList_UserMessages::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSVCMsgList_UserMessages*>(&to_msg);
+  auto& from = static_cast<const CSVCMsgList_UserMessages&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CSVCMsgList_UserMessages)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.usermsgs_.MergeFrom(from._impl_.usermsgs_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CSVCMsgList_UserMessages::CopyFrom(const CSVCMsgList_UserMessages& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CSVCMsgList_UserMessages)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CSVCMsgList_UserMessages::IsInitialized() const {
+  return true;
+}
+
+void CSVCMsgList_UserMessages::InternalSwap(CSVCMsgList_UserMessages* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.usermsgs_.InternalSwap(&other->_impl_.usermsgs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSVCMsgList_UserMessages::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_networkbasetypes_2eproto_getter, &descriptor_table_networkbasetypes_2eproto_once,
+      file_level_metadata_networkbasetypes_2eproto[19]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::CMsgVector*
+Arena::CreateMaybeMessage< ::CMsgVector >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgVector >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgVector2D*
+Arena::CreateMaybeMessage< ::CMsgVector2D >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgVector2D >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsgQAngle*
+Arena::CreateMaybeMessage< ::CMsgQAngle >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsgQAngle >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsg_CVars_CVar*
+Arena::CreateMaybeMessage< ::CMsg_CVars_CVar >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsg_CVars_CVar >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CMsg_CVars*
+Arena::CreateMaybeMessage< ::CMsg_CVars >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CMsg_CVars >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNETMsg_NOP*
+Arena::CreateMaybeMessage< ::CNETMsg_NOP >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNETMsg_NOP >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNETMsg_SplitScreenUser*
+Arena::CreateMaybeMessage< ::CNETMsg_SplitScreenUser >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNETMsg_SplitScreenUser >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNETMsg_Disconnect*
+Arena::CreateMaybeMessage< ::CNETMsg_Disconnect >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNETMsg_Disconnect >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNETMsg_File*
+Arena::CreateMaybeMessage< ::CNETMsg_File >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNETMsg_File >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNETMsg_Tick*
+Arena::CreateMaybeMessage< ::CNETMsg_Tick >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNETMsg_Tick >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNETMsg_StringCmd*
+Arena::CreateMaybeMessage< ::CNETMsg_StringCmd >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNETMsg_StringCmd >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNETMsg_SetConVar*
+Arena::CreateMaybeMessage< ::CNETMsg_SetConVar >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNETMsg_SetConVar >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CNETMsg_SignonState*
+Arena::CreateMaybeMessage< ::CNETMsg_SignonState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CNETMsg_SignonState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_GameEvent_key_t*
+Arena::CreateMaybeMessage< ::CSVCMsg_GameEvent_key_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_GameEvent_key_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_GameEvent*
+Arena::CreateMaybeMessage< ::CSVCMsg_GameEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_GameEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsgList_GameEvents_event_t*
+Arena::CreateMaybeMessage< ::CSVCMsgList_GameEvents_event_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsgList_GameEvents_event_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsgList_GameEvents*
+Arena::CreateMaybeMessage< ::CSVCMsgList_GameEvents >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsgList_GameEvents >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsg_UserMessage*
+Arena::CreateMaybeMessage< ::CSVCMsg_UserMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsg_UserMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsgList_UserMessages_usermsg_t*
+Arena::CreateMaybeMessage< ::CSVCMsgList_UserMessages_usermsg_t >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsgList_UserMessages_usermsg_t >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CSVCMsgList_UserMessages*
+Arena::CreateMaybeMessage< ::CSVCMsgList_UserMessages >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CSVCMsgList_UserMessages >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
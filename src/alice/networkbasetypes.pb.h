@@ -0,0 +1,5978 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: networkbasetypes.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_networkbasetypes_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_networkbasetypes_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "network_connection.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_networkbasetypes_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_networkbasetypes_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_networkbasetypes_2eproto;
+class CMsgQAngle;
+struct CMsgQAngleDefaultTypeInternal;
+extern CMsgQAngleDefaultTypeInternal _CMsgQAngle_default_instance_;
+class CMsgVector;
+struct CMsgVectorDefaultTypeInternal;
+extern CMsgVectorDefaultTypeInternal _CMsgVector_default_instance_;
+class CMsgVector2D;
+struct CMsgVector2DDefaultTypeInternal;
+extern CMsgVector2DDefaultTypeInternal _CMsgVector2D_default_instance_;
+class CMsg_CVars;
+struct CMsg_CVarsDefaultTypeInternal;
+extern CMsg_CVarsDefaultTypeInternal _CMsg_CVars_default_instance_;
+class CMsg_CVars_CVar;
+struct CMsg_CVars_CVarDefaultTypeInternal;
+extern CMsg_CVars_CVarDefaultTypeInternal _CMsg_CVars_CVar_default_instance_;
+class CNETMsg_Disconnect;
+struct CNETMsg_DisconnectDefaultTypeInternal;
+extern CNETMsg_DisconnectDefaultTypeInternal _CNETMsg_Disconnect_default_instance_;
+class CNETMsg_File;
+struct CNETMsg_FileDefaultTypeInternal;
+extern CNETMsg_FileDefaultTypeInternal _CNETMsg_File_default_instance_;
+class CNETMsg_NOP;
+struct CNETMsg_NOPDefaultTypeInternal;
+extern CNETMsg_NOPDefaultTypeInternal _CNETMsg_NOP_default_instance_;
+class CNETMsg_SetConVar;
+struct CNETMsg_SetConVarDefaultTypeInternal;
+extern CNETMsg_SetConVarDefaultTypeInternal _CNETMsg_SetConVar_default_instance_;
+class CNETMsg_SignonState;
+struct CNETMsg_SignonStateDefaultTypeInternal;
+extern CNETMsg_SignonStateDefaultTypeInternal _CNETMsg_SignonState_default_instance_;
+class CNETMsg_SplitScreenUser;
+struct CNETMsg_SplitScreenUserDefaultTypeInternal;
+extern CNETMsg_SplitScreenUserDefaultTypeInternal _CNETMsg_SplitScreenUser_default_instance_;
+class CNETMsg_StringCmd;
+struct CNETMsg_StringCmdDefaultTypeInternal;
+extern CNETMsg_StringCmdDefaultTypeInternal _CNETMsg_StringCmd_default_instance_;
+class CNETMsg_Tick;
+struct CNETMsg_TickDefaultTypeInternal;
+extern CNETMsg_TickDefaultTypeInternal _CNETMsg_Tick_default_instance_;
+class CSVCMsgList_GameEvents;
+struct CSVCMsgList_GameEventsDefaultTypeInternal;
+extern CSVCMsgList_GameEventsDefaultTypeInternal _CSVCMsgList_GameEvents_default_instance_;
+class CSVCMsgList_GameEvents_event_t;
+struct CSVCMsgList_GameEvents_event_tDefaultTypeInternal;
+extern CSVCMsgList_GameEvents_event_tDefaultTypeInternal _CSVCMsgList_GameEvents_event_t_default_instance_;
+class CSVCMsgList_UserMessages;
+struct CSVCMsgList_UserMessagesDefaultTypeInternal;
+extern CSVCMsgList_UserMessagesDefaultTypeInternal _CSVCMsgList_UserMessages_default_instance_;
+class CSVCMsgList_UserMessages_usermsg_t;
+struct CSVCMsgList_UserMessages_usermsg_tDefaultTypeInternal;
+extern CSVCMsgList_UserMessages_usermsg_tDefaultTypeInternal _CSVCMsgList_UserMessages_usermsg_t_default_instance_;
+class CSVCMsg_GameEvent;
+struct CSVCMsg_GameEventDefaultTypeInternal;
+extern CSVCMsg_GameEventDefaultTypeInternal _CSVCMsg_GameEvent_default_instance_;
+class CSVCMsg_GameEvent_key_t;
+struct CSVCMsg_GameEvent_key_tDefaultTypeInternal;
+extern CSVCMsg_GameEvent_key_tDefaultTypeInternal _CSVCMsg_GameEvent_key_t_default_instance_;
+class CSVCMsg_UserMessage;
+struct CSVCMsg_UserMessageDefaultTypeInternal;
+extern CSVCMsg_UserMessageDefaultTypeInternal _CSVCMsg_UserMessage_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::CMsgQAngle* Arena::CreateMaybeMessage<::CMsgQAngle>(Arena*);
+template<> ::CMsgVector* Arena::CreateMaybeMessage<::CMsgVector>(Arena*);
+template<> ::CMsgVector2D* Arena::CreateMaybeMessage<::CMsgVector2D>(Arena*);
+template<> ::CMsg_CVars* Arena::CreateMaybeMessage<::CMsg_CVars>(Arena*);
+template<> ::CMsg_CVars_CVar* Arena::CreateMaybeMessage<::CMsg_CVars_CVar>(Arena*);
+template<> ::CNETMsg_Disconnect* Arena::CreateMaybeMessage<::CNETMsg_Disconnect>(Arena*);
+template<> ::CNETMsg_File* Arena::CreateMaybeMessage<::CNETMsg_File>(Arena*);
+template<> ::CNETMsg_NOP* Arena::CreateMaybeMessage<::CNETMsg_NOP>(Arena*);
+template<> ::CNETMsg_SetConVar* Arena::CreateMaybeMessage<::CNETMsg_SetConVar>(Arena*);
+template<> ::CNETMsg_SignonState* Arena::CreateMaybeMessage<::CNETMsg_SignonState>(Arena*);
+template<> ::CNETMsg_SplitScreenUser* Arena::CreateMaybeMessage<::CNETMsg_SplitScreenUser>(Arena*);
+template<> ::CNETMsg_StringCmd* Arena::CreateMaybeMessage<::CNETMsg_StringCmd>(Arena*);
+template<> ::CNETMsg_Tick* Arena::CreateMaybeMessage<::CNETMsg_Tick>(Arena*);
+template<> ::CSVCMsgList_GameEvents* Arena::CreateMaybeMessage<::CSVCMsgList_GameEvents>(Arena*);
+template<> ::CSVCMsgList_GameEvents_event_t* Arena::CreateMaybeMessage<::CSVCMsgList_GameEvents_event_t>(Arena*);
+template<> ::CSVCMsgList_UserMessages* Arena::CreateMaybeMessage<::CSVCMsgList_UserMessages>(Arena*);
+template<> ::CSVCMsgList_UserMessages_usermsg_t* Arena::CreateMaybeMessage<::CSVCMsgList_UserMessages_usermsg_t>(Arena*);
+template<> ::CSVCMsg_GameEvent* Arena::CreateMaybeMessage<::CSVCMsg_GameEvent>(Arena*);
+template<> ::CSVCMsg_GameEvent_key_t* Arena::CreateMaybeMessage<::CSVCMsg_GameEvent_key_t>(Arena*);
+template<> ::CSVCMsg_UserMessage* Arena::CreateMaybeMessage<::CSVCMsg_UserMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+enum SIGNONSTATE : int {
+  SIGNONSTATE_NONE = 0,
+  SIGNONSTATE_CHALLENGE = 1,
+  SIGNONSTATE_CONNECTED = 2,
+  SIGNONSTATE_NEW = 3,
+  SIGNONSTATE_PRESPAWN = 4,
+  SIGNONSTATE_SPAWN = 5,
+  SIGNONSTATE_FULL = 6,
+  SIGNONSTATE_CHANGELEVEL = 7
+};
+bool SIGNONSTATE_IsValid(int value);
+constexpr SIGNONSTATE SIGNONSTATE_MIN = SIGNONSTATE_NONE;
+constexpr SIGNONSTATE SIGNONSTATE_MAX = SIGNONSTATE_CHANGELEVEL;
+constexpr int SIGNONSTATE_ARRAYSIZE = SIGNONSTATE_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SIGNONSTATE_descriptor();
+template<typename T>
+inline const std::string& SIGNONSTATE_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SIGNONSTATE>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SIGNONSTATE_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SIGNONSTATE_descriptor(), enum_t_value);
+}
+inline bool SIGNONSTATE_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SIGNONSTATE* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SIGNONSTATE>(
+    SIGNONSTATE_descriptor(), name, value);
+}
+enum NET_Messages : int {
+  net_NOP = 0,
+  net_Disconnect = 1,
+  net_File = 2,
+  net_SplitScreenUser = 3,
+  net_Tick = 4,
+  net_StringCmd = 5,
+  net_SetConVar = 6,
+  net_SignonState = 7
+};
+bool NET_Messages_IsValid(int value);
+constexpr NET_Messages NET_Messages_MIN = net_NOP;
+constexpr NET_Messages NET_Messages_MAX = net_SignonState;
+constexpr int NET_Messages_ARRAYSIZE = NET_Messages_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NET_Messages_descriptor();
+template<typename T>
+inline const std::string& NET_Messages_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, NET_Messages>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function NET_Messages_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    NET_Messages_descriptor(), enum_t_value);
+}
+inline bool NET_Messages_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, NET_Messages* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<NET_Messages>(
+    NET_Messages_descriptor(), name, value);
+}
+// ===================================================================
+
+class CMsgVector final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgVector) */ {
+ public:
+  inline CMsgVector() : CMsgVector(nullptr) {}
+  ~CMsgVector() override;
+  explicit PROTOBUF_CONSTEXPR CMsgVector(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgVector(const CMsgVector& from);
+  CMsgVector(CMsgVector&& from) noexcept
+    : CMsgVector() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgVector& operator=(const CMsgVector& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgVector& operator=(CMsgVector&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgVector& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgVector* internal_default_instance() {
+    return reinterpret_cast<const CMsgVector*>(
+               &_CMsgVector_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CMsgVector& a, CMsgVector& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgVector* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgVector* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgVector* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgVector>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgVector& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgVector& from) {
+    CMsgVector::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgVector* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgVector";
+  }
+  protected:
+  explicit CMsgVector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kZFieldNumber = 3,
+  };
+  // optional float x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  float x() const;
+  void set_x(float value);
+  private:
+  float _internal_x() const;
+  void _internal_set_x(float value);
+  public:
+
+  // optional float y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  float y() const;
+  void set_y(float value);
+  private:
+  float _internal_y() const;
+  void _internal_set_y(float value);
+  public:
+
+  // optional float z = 3;
+  bool has_z() const;
+  private:
+  bool _internal_has_z() const;
+  public:
+  void clear_z();
+  float z() const;
+  void set_z(float value);
+  private:
+  float _internal_z() const;
+  void _internal_set_z(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgVector)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float x_;
+    float y_;
+    float z_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgVector2D final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgVector2D) */ {
+ public:
+  inline CMsgVector2D() : CMsgVector2D(nullptr) {}
+  ~CMsgVector2D() override;
+  explicit PROTOBUF_CONSTEXPR CMsgVector2D(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgVector2D(const CMsgVector2D& from);
+  CMsgVector2D(CMsgVector2D&& from) noexcept
+    : CMsgVector2D() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgVector2D& operator=(const CMsgVector2D& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgVector2D& operator=(CMsgVector2D&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgVector2D& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgVector2D* internal_default_instance() {
+    return reinterpret_cast<const CMsgVector2D*>(
+               &_CMsgVector2D_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(CMsgVector2D& a, CMsgVector2D& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgVector2D* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgVector2D* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgVector2D* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgVector2D>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgVector2D& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgVector2D& from) {
+    CMsgVector2D::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgVector2D* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgVector2D";
+  }
+  protected:
+  explicit CMsgVector2D(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+  };
+  // optional float x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  float x() const;
+  void set_x(float value);
+  private:
+  float _internal_x() const;
+  void _internal_set_x(float value);
+  public:
+
+  // optional float y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  float y() const;
+  void set_y(float value);
+  private:
+  float _internal_y() const;
+  void _internal_set_y(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgVector2D)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float x_;
+    float y_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsgQAngle final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsgQAngle) */ {
+ public:
+  inline CMsgQAngle() : CMsgQAngle(nullptr) {}
+  ~CMsgQAngle() override;
+  explicit PROTOBUF_CONSTEXPR CMsgQAngle(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsgQAngle(const CMsgQAngle& from);
+  CMsgQAngle(CMsgQAngle&& from) noexcept
+    : CMsgQAngle() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsgQAngle& operator=(const CMsgQAngle& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsgQAngle& operator=(CMsgQAngle&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsgQAngle& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsgQAngle* internal_default_instance() {
+    return reinterpret_cast<const CMsgQAngle*>(
+               &_CMsgQAngle_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CMsgQAngle& a, CMsgQAngle& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsgQAngle* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsgQAngle* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsgQAngle* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsgQAngle>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsgQAngle& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsgQAngle& from) {
+    CMsgQAngle::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsgQAngle* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsgQAngle";
+  }
+  protected:
+  explicit CMsgQAngle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kZFieldNumber = 3,
+  };
+  // optional float x = 1;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  float x() const;
+  void set_x(float value);
+  private:
+  float _internal_x() const;
+  void _internal_set_x(float value);
+  public:
+
+  // optional float y = 2;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  float y() const;
+  void set_y(float value);
+  private:
+  float _internal_y() const;
+  void _internal_set_y(float value);
+  public:
+
+  // optional float z = 3;
+  bool has_z() const;
+  private:
+  bool _internal_has_z() const;
+  public:
+  void clear_z();
+  float z() const;
+  void set_z(float value);
+  private:
+  float _internal_z() const;
+  void _internal_set_z(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsgQAngle)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float x_;
+    float y_;
+    float z_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsg_CVars_CVar final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsg_CVars.CVar) */ {
+ public:
+  inline CMsg_CVars_CVar() : CMsg_CVars_CVar(nullptr) {}
+  ~CMsg_CVars_CVar() override;
+  explicit PROTOBUF_CONSTEXPR CMsg_CVars_CVar(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsg_CVars_CVar(const CMsg_CVars_CVar& from);
+  CMsg_CVars_CVar(CMsg_CVars_CVar&& from) noexcept
+    : CMsg_CVars_CVar() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsg_CVars_CVar& operator=(const CMsg_CVars_CVar& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsg_CVars_CVar& operator=(CMsg_CVars_CVar&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsg_CVars_CVar& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsg_CVars_CVar* internal_default_instance() {
+    return reinterpret_cast<const CMsg_CVars_CVar*>(
+               &_CMsg_CVars_CVar_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CMsg_CVars_CVar& a, CMsg_CVars_CVar& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsg_CVars_CVar* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsg_CVars_CVar* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsg_CVars_CVar* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsg_CVars_CVar>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsg_CVars_CVar& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsg_CVars_CVar& from) {
+    CMsg_CVars_CVar::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsg_CVars_CVar* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsg_CVars.CVar";
+  }
+  protected:
+  explicit CMsg_CVars_CVar(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:CMsg_CVars.CVar)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CMsg_CVars final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CMsg_CVars) */ {
+ public:
+  inline CMsg_CVars() : CMsg_CVars(nullptr) {}
+  ~CMsg_CVars() override;
+  explicit PROTOBUF_CONSTEXPR CMsg_CVars(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CMsg_CVars(const CMsg_CVars& from);
+  CMsg_CVars(CMsg_CVars&& from) noexcept
+    : CMsg_CVars() {
+    *this = ::std::move(from);
+  }
+
+  inline CMsg_CVars& operator=(const CMsg_CVars& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CMsg_CVars& operator=(CMsg_CVars&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CMsg_CVars& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CMsg_CVars* internal_default_instance() {
+    return reinterpret_cast<const CMsg_CVars*>(
+               &_CMsg_CVars_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CMsg_CVars& a, CMsg_CVars& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CMsg_CVars* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CMsg_CVars* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CMsg_CVars* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CMsg_CVars>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CMsg_CVars& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CMsg_CVars& from) {
+    CMsg_CVars::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CMsg_CVars* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CMsg_CVars";
+  }
+  protected:
+  explicit CMsg_CVars(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CMsg_CVars_CVar CVar;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCvarsFieldNumber = 1,
+  };
+  // repeated .CMsg_CVars.CVar cvars = 1;
+  int cvars_size() const;
+  private:
+  int _internal_cvars_size() const;
+  public:
+  void clear_cvars();
+  ::CMsg_CVars_CVar* mutable_cvars(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsg_CVars_CVar >*
+      mutable_cvars();
+  private:
+  const ::CMsg_CVars_CVar& _internal_cvars(int index) const;
+  ::CMsg_CVars_CVar* _internal_add_cvars();
+  public:
+  const ::CMsg_CVars_CVar& cvars(int index) const;
+  ::CMsg_CVars_CVar* add_cvars();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsg_CVars_CVar >&
+      cvars() const;
+
+  // @@protoc_insertion_point(class_scope:CMsg_CVars)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsg_CVars_CVar > cvars_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CNETMsg_NOP final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:CNETMsg_NOP) */ {
+ public:
+  inline CNETMsg_NOP() : CNETMsg_NOP(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CNETMsg_NOP(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CNETMsg_NOP(const CNETMsg_NOP& from);
+  CNETMsg_NOP(CNETMsg_NOP&& from) noexcept
+    : CNETMsg_NOP() {
+    *this = ::std::move(from);
+  }
+
+  inline CNETMsg_NOP& operator=(const CNETMsg_NOP& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CNETMsg_NOP& operator=(CNETMsg_NOP&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CNETMsg_NOP& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CNETMsg_NOP* internal_default_instance() {
+    return reinterpret_cast<const CNETMsg_NOP*>(
+               &_CNETMsg_NOP_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(CNETMsg_NOP& a, CNETMsg_NOP& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CNETMsg_NOP* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CNETMsg_NOP* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CNETMsg_NOP* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CNETMsg_NOP>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CNETMsg_NOP& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CNETMsg_NOP& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CNETMsg_NOP";
+  }
+  protected:
+  explicit CNETMsg_NOP(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:CNETMsg_NOP)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CNETMsg_SplitScreenUser final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CNETMsg_SplitScreenUser) */ {
+ public:
+  inline CNETMsg_SplitScreenUser() : CNETMsg_SplitScreenUser(nullptr) {}
+  ~CNETMsg_SplitScreenUser() override;
+  explicit PROTOBUF_CONSTEXPR CNETMsg_SplitScreenUser(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CNETMsg_SplitScreenUser(const CNETMsg_SplitScreenUser& from);
+  CNETMsg_SplitScreenUser(CNETMsg_SplitScreenUser&& from) noexcept
+    : CNETMsg_SplitScreenUser() {
+    *this = ::std::move(from);
+  }
+
+  inline CNETMsg_SplitScreenUser& operator=(const CNETMsg_SplitScreenUser& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CNETMsg_SplitScreenUser& operator=(CNETMsg_SplitScreenUser&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CNETMsg_SplitScreenUser& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CNETMsg_SplitScreenUser* internal_default_instance() {
+    return reinterpret_cast<const CNETMsg_SplitScreenUser*>(
+               &_CNETMsg_SplitScreenUser_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(CNETMsg_SplitScreenUser& a, CNETMsg_SplitScreenUser& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CNETMsg_SplitScreenUser* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CNETMsg_SplitScreenUser* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CNETMsg_SplitScreenUser* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CNETMsg_SplitScreenUser>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CNETMsg_SplitScreenUser& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CNETMsg_SplitScreenUser& from) {
+    CNETMsg_SplitScreenUser::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CNETMsg_SplitScreenUser* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CNETMsg_SplitScreenUser";
+  }
+  protected:
+  explicit CNETMsg_SplitScreenUser(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSlotFieldNumber = 1,
+  };
+  // optional int32 slot = 1;
+  bool has_slot() const;
+  private:
+  bool _internal_has_slot() const;
+  public:
+  void clear_slot();
+  int32_t slot() const;
+  void set_slot(int32_t value);
+  private:
+  int32_t _internal_slot() const;
+  void _internal_set_slot(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CNETMsg_SplitScreenUser)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t slot_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CNETMsg_Disconnect final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CNETMsg_Disconnect) */ {
+ public:
+  inline CNETMsg_Disconnect() : CNETMsg_Disconnect(nullptr) {}
+  ~CNETMsg_Disconnect() override;
+  explicit PROTOBUF_CONSTEXPR CNETMsg_Disconnect(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CNETMsg_Disconnect(const CNETMsg_Disconnect& from);
+  CNETMsg_Disconnect(CNETMsg_Disconnect&& from) noexcept
+    : CNETMsg_Disconnect() {
+    *this = ::std::move(from);
+  }
+
+  inline CNETMsg_Disconnect& operator=(const CNETMsg_Disconnect& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CNETMsg_Disconnect& operator=(CNETMsg_Disconnect&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CNETMsg_Disconnect& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CNETMsg_Disconnect* internal_default_instance() {
+    return reinterpret_cast<const CNETMsg_Disconnect*>(
+               &_CNETMsg_Disconnect_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(CNETMsg_Disconnect& a, CNETMsg_Disconnect& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CNETMsg_Disconnect* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CNETMsg_Disconnect* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CNETMsg_Disconnect* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CNETMsg_Disconnect>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CNETMsg_Disconnect& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CNETMsg_Disconnect& from) {
+    CNETMsg_Disconnect::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CNETMsg_Disconnect* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CNETMsg_Disconnect";
+  }
+  protected:
+  explicit CNETMsg_Disconnect(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReasonFieldNumber = 2,
+  };
+  // optional .ENetworkDisconnectionReason reason = 2 [default = NETWORK_DISCONNECT_INVALID];
+  bool has_reason() const;
+  private:
+  bool _internal_has_reason() const;
+  public:
+  void clear_reason();
+  ::ENetworkDisconnectionReason reason() const;
+  void set_reason(::ENetworkDisconnectionReason value);
+  private:
+  ::ENetworkDisconnectionReason _internal_reason() const;
+  void _internal_set_reason(::ENetworkDisconnectionReason value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CNETMsg_Disconnect)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int reason_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CNETMsg_File final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CNETMsg_File) */ {
+ public:
+  inline CNETMsg_File() : CNETMsg_File(nullptr) {}
+  ~CNETMsg_File() override;
+  explicit PROTOBUF_CONSTEXPR CNETMsg_File(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CNETMsg_File(const CNETMsg_File& from);
+  CNETMsg_File(CNETMsg_File&& from) noexcept
+    : CNETMsg_File() {
+    *this = ::std::move(from);
+  }
+
+  inline CNETMsg_File& operator=(const CNETMsg_File& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CNETMsg_File& operator=(CNETMsg_File&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CNETMsg_File& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CNETMsg_File* internal_default_instance() {
+    return reinterpret_cast<const CNETMsg_File*>(
+               &_CNETMsg_File_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(CNETMsg_File& a, CNETMsg_File& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CNETMsg_File* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CNETMsg_File* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CNETMsg_File* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CNETMsg_File>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CNETMsg_File& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CNETMsg_File& from) {
+    CNETMsg_File::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CNETMsg_File* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CNETMsg_File";
+  }
+  protected:
+  explicit CNETMsg_File(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 2,
+    kTransferIdFieldNumber = 1,
+    kIsReplayDemoFileFieldNumber = 3,
+    kDenyFieldNumber = 4,
+    kIsFileRequestedFieldNumber = 5,
+  };
+  // optional string file_name = 2;
+  bool has_file_name() const;
+  private:
+  bool _internal_has_file_name() const;
+  public:
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // optional int32 transfer_id = 1;
+  bool has_transfer_id() const;
+  private:
+  bool _internal_has_transfer_id() const;
+  public:
+  void clear_transfer_id();
+  int32_t transfer_id() const;
+  void set_transfer_id(int32_t value);
+  private:
+  int32_t _internal_transfer_id() const;
+  void _internal_set_transfer_id(int32_t value);
+  public:
+
+  // optional bool is_replay_demo_file = 3;
+  bool has_is_replay_demo_file() const;
+  private:
+  bool _internal_has_is_replay_demo_file() const;
+  public:
+  void clear_is_replay_demo_file();
+  bool is_replay_demo_file() const;
+  void set_is_replay_demo_file(bool value);
+  private:
+  bool _internal_is_replay_demo_file() const;
+  void _internal_set_is_replay_demo_file(bool value);
+  public:
+
+  // optional bool deny = 4;
+  bool has_deny() const;
+  private:
+  bool _internal_has_deny() const;
+  public:
+  void clear_deny();
+  bool deny() const;
+  void set_deny(bool value);
+  private:
+  bool _internal_deny() const;
+  void _internal_set_deny(bool value);
+  public:
+
+  // optional bool is_file_requested = 5;
+  bool has_is_file_requested() const;
+  private:
+  bool _internal_has_is_file_requested() const;
+  public:
+  void clear_is_file_requested();
+  bool is_file_requested() const;
+  void set_is_file_requested(bool value);
+  private:
+  bool _internal_is_file_requested() const;
+  void _internal_set_is_file_requested(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CNETMsg_File)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    int32_t transfer_id_;
+    bool is_replay_demo_file_;
+    bool deny_;
+    bool is_file_requested_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CNETMsg_Tick final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CNETMsg_Tick) */ {
+ public:
+  inline CNETMsg_Tick() : CNETMsg_Tick(nullptr) {}
+  ~CNETMsg_Tick() override;
+  explicit PROTOBUF_CONSTEXPR CNETMsg_Tick(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CNETMsg_Tick(const CNETMsg_Tick& from);
+  CNETMsg_Tick(CNETMsg_Tick&& from) noexcept
+    : CNETMsg_Tick() {
+    *this = ::std::move(from);
+  }
+
+  inline CNETMsg_Tick& operator=(const CNETMsg_Tick& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CNETMsg_Tick& operator=(CNETMsg_Tick&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CNETMsg_Tick& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CNETMsg_Tick* internal_default_instance() {
+    return reinterpret_cast<const CNETMsg_Tick*>(
+               &_CNETMsg_Tick_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(CNETMsg_Tick& a, CNETMsg_Tick& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CNETMsg_Tick* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CNETMsg_Tick* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CNETMsg_Tick* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CNETMsg_Tick>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CNETMsg_Tick& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CNETMsg_Tick& from) {
+    CNETMsg_Tick::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CNETMsg_Tick* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CNETMsg_Tick";
+  }
+  protected:
+  explicit CNETMsg_Tick(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTickFieldNumber = 1,
+    kHostComputationtimeFieldNumber = 4,
+    kHostComputationtimeStdDeviationFieldNumber = 5,
+    kHostFramestarttimeStdDeviationFieldNumber = 6,
+  };
+  // optional uint32 tick = 1;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  uint32_t tick() const;
+  void set_tick(uint32_t value);
+  private:
+  uint32_t _internal_tick() const;
+  void _internal_set_tick(uint32_t value);
+  public:
+
+  // optional uint32 host_computationtime = 4;
+  bool has_host_computationtime() const;
+  private:
+  bool _internal_has_host_computationtime() const;
+  public:
+  void clear_host_computationtime();
+  uint32_t host_computationtime() const;
+  void set_host_computationtime(uint32_t value);
+  private:
+  uint32_t _internal_host_computationtime() const;
+  void _internal_set_host_computationtime(uint32_t value);
+  public:
+
+  // optional uint32 host_computationtime_std_deviation = 5;
+  bool has_host_computationtime_std_deviation() const;
+  private:
+  bool _internal_has_host_computationtime_std_deviation() const;
+  public:
+  void clear_host_computationtime_std_deviation();
+  uint32_t host_computationtime_std_deviation() const;
+  void set_host_computationtime_std_deviation(uint32_t value);
+  private:
+  uint32_t _internal_host_computationtime_std_deviation() const;
+  void _internal_set_host_computationtime_std_deviation(uint32_t value);
+  public:
+
+  // optional uint32 host_framestarttime_std_deviation = 6;
+  bool has_host_framestarttime_std_deviation() const;
+  private:
+  bool _internal_has_host_framestarttime_std_deviation() const;
+  public:
+  void clear_host_framestarttime_std_deviation();
+  uint32_t host_framestarttime_std_deviation() const;
+  void set_host_framestarttime_std_deviation(uint32_t value);
+  private:
+  uint32_t _internal_host_framestarttime_std_deviation() const;
+  void _internal_set_host_framestarttime_std_deviation(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CNETMsg_Tick)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t tick_;
+    uint32_t host_computationtime_;
+    uint32_t host_computationtime_std_deviation_;
+    uint32_t host_framestarttime_std_deviation_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CNETMsg_StringCmd final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CNETMsg_StringCmd) */ {
+ public:
+  inline CNETMsg_StringCmd() : CNETMsg_StringCmd(nullptr) {}
+  ~CNETMsg_StringCmd() override;
+  explicit PROTOBUF_CONSTEXPR CNETMsg_StringCmd(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CNETMsg_StringCmd(const CNETMsg_StringCmd& from);
+  CNETMsg_StringCmd(CNETMsg_StringCmd&& from) noexcept
+    : CNETMsg_StringCmd() {
+    *this = ::std::move(from);
+  }
+
+  inline CNETMsg_StringCmd& operator=(const CNETMsg_StringCmd& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CNETMsg_StringCmd& operator=(CNETMsg_StringCmd&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CNETMsg_StringCmd& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CNETMsg_StringCmd* internal_default_instance() {
+    return reinterpret_cast<const CNETMsg_StringCmd*>(
+               &_CNETMsg_StringCmd_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(CNETMsg_StringCmd& a, CNETMsg_StringCmd& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CNETMsg_StringCmd* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CNETMsg_StringCmd* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CNETMsg_StringCmd* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CNETMsg_StringCmd>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CNETMsg_StringCmd& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CNETMsg_StringCmd& from) {
+    CNETMsg_StringCmd::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CNETMsg_StringCmd* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CNETMsg_StringCmd";
+  }
+  protected:
+  explicit CNETMsg_StringCmd(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommandFieldNumber = 1,
+  };
+  // optional string command = 1;
+  bool has_command() const;
+  private:
+  bool _internal_has_command() const;
+  public:
+  void clear_command();
+  const std::string& command() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_command();
+  PROTOBUF_NODISCARD std::string* release_command();
+  void set_allocated_command(std::string* command);
+  private:
+  const std::string& _internal_command() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
+  std::string* _internal_mutable_command();
+  public:
+
+  // @@protoc_insertion_point(class_scope:CNETMsg_StringCmd)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CNETMsg_SetConVar final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CNETMsg_SetConVar) */ {
+ public:
+  inline CNETMsg_SetConVar() : CNETMsg_SetConVar(nullptr) {}
+  ~CNETMsg_SetConVar() override;
+  explicit PROTOBUF_CONSTEXPR CNETMsg_SetConVar(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CNETMsg_SetConVar(const CNETMsg_SetConVar& from);
+  CNETMsg_SetConVar(CNETMsg_SetConVar&& from) noexcept
+    : CNETMsg_SetConVar() {
+    *this = ::std::move(from);
+  }
+
+  inline CNETMsg_SetConVar& operator=(const CNETMsg_SetConVar& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CNETMsg_SetConVar& operator=(CNETMsg_SetConVar&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CNETMsg_SetConVar& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CNETMsg_SetConVar* internal_default_instance() {
+    return reinterpret_cast<const CNETMsg_SetConVar*>(
+               &_CNETMsg_SetConVar_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(CNETMsg_SetConVar& a, CNETMsg_SetConVar& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CNETMsg_SetConVar* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CNETMsg_SetConVar* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CNETMsg_SetConVar* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CNETMsg_SetConVar>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CNETMsg_SetConVar& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CNETMsg_SetConVar& from) {
+    CNETMsg_SetConVar::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CNETMsg_SetConVar* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CNETMsg_SetConVar";
+  }
+  protected:
+  explicit CNETMsg_SetConVar(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConvarsFieldNumber = 1,
+  };
+  // optional .CMsg_CVars convars = 1;
+  bool has_convars() const;
+  private:
+  bool _internal_has_convars() const;
+  public:
+  void clear_convars();
+  const ::CMsg_CVars& convars() const;
+  PROTOBUF_NODISCARD ::CMsg_CVars* release_convars();
+  ::CMsg_CVars* mutable_convars();
+  void set_allocated_convars(::CMsg_CVars* convars);
+  private:
+  const ::CMsg_CVars& _internal_convars() const;
+  ::CMsg_CVars* _internal_mutable_convars();
+  public:
+  void unsafe_arena_set_allocated_convars(
+      ::CMsg_CVars* convars);
+  ::CMsg_CVars* unsafe_arena_release_convars();
+
+  // @@protoc_insertion_point(class_scope:CNETMsg_SetConVar)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CMsg_CVars* convars_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CNETMsg_SignonState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CNETMsg_SignonState) */ {
+ public:
+  inline CNETMsg_SignonState() : CNETMsg_SignonState(nullptr) {}
+  ~CNETMsg_SignonState() override;
+  explicit PROTOBUF_CONSTEXPR CNETMsg_SignonState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CNETMsg_SignonState(const CNETMsg_SignonState& from);
+  CNETMsg_SignonState(CNETMsg_SignonState&& from) noexcept
+    : CNETMsg_SignonState() {
+    *this = ::std::move(from);
+  }
+
+  inline CNETMsg_SignonState& operator=(const CNETMsg_SignonState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CNETMsg_SignonState& operator=(CNETMsg_SignonState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CNETMsg_SignonState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CNETMsg_SignonState* internal_default_instance() {
+    return reinterpret_cast<const CNETMsg_SignonState*>(
+               &_CNETMsg_SignonState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(CNETMsg_SignonState& a, CNETMsg_SignonState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CNETMsg_SignonState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CNETMsg_SignonState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CNETMsg_SignonState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CNETMsg_SignonState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CNETMsg_SignonState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CNETMsg_SignonState& from) {
+    CNETMsg_SignonState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CNETMsg_SignonState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CNETMsg_SignonState";
+  }
+  protected:
+  explicit CNETMsg_SignonState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPlayersNetworkidsFieldNumber = 4,
+    kMapNameFieldNumber = 5,
+    kSignonStateFieldNumber = 1,
+    kSpawnCountFieldNumber = 2,
+    kNumServerPlayersFieldNumber = 3,
+  };
+  // repeated string players_networkids = 4;
+  int players_networkids_size() const;
+  private:
+  int _internal_players_networkids_size() const;
+  public:
+  void clear_players_networkids();
+  const std::string& players_networkids(int index) const;
+  std::string* mutable_players_networkids(int index);
+  void set_players_networkids(int index, const std::string& value);
+  void set_players_networkids(int index, std::string&& value);
+  void set_players_networkids(int index, const char* value);
+  void set_players_networkids(int index, const char* value, size_t size);
+  std::string* add_players_networkids();
+  void add_players_networkids(const std::string& value);
+  void add_players_networkids(std::string&& value);
+  void add_players_networkids(const char* value);
+  void add_players_networkids(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& players_networkids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_players_networkids();
+  private:
+  const std::string& _internal_players_networkids(int index) const;
+  std::string* _internal_add_players_networkids();
+  public:
+
+  // optional string map_name = 5;
+  bool has_map_name() const;
+  private:
+  bool _internal_has_map_name() const;
+  public:
+  void clear_map_name();
+  const std::string& map_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_map_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_map_name();
+  PROTOBUF_NODISCARD std::string* release_map_name();
+  void set_allocated_map_name(std::string* map_name);
+  private:
+  const std::string& _internal_map_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_map_name(const std::string& value);
+  std::string* _internal_mutable_map_name();
+  public:
+
+  // optional uint32 signon_state = 1;
+  bool has_signon_state() const;
+  private:
+  bool _internal_has_signon_state() const;
+  public:
+  void clear_signon_state();
+  uint32_t signon_state() const;
+  void set_signon_state(uint32_t value);
+  private:
+  uint32_t _internal_signon_state() const;
+  void _internal_set_signon_state(uint32_t value);
+  public:
+
+  // optional uint32 spawn_count = 2;
+  bool has_spawn_count() const;
+  private:
+  bool _internal_has_spawn_count() const;
+  public:
+  void clear_spawn_count();
+  uint32_t spawn_count() const;
+  void set_spawn_count(uint32_t value);
+  private:
+  uint32_t _internal_spawn_count() const;
+  void _internal_set_spawn_count(uint32_t value);
+  public:
+
+  // optional uint32 num_server_players = 3;
+  bool has_num_server_players() const;
+  private:
+  bool _internal_has_num_server_players() const;
+  public:
+  void clear_num_server_players();
+  uint32_t num_server_players() const;
+  void set_num_server_players(uint32_t value);
+  private:
+  uint32_t _internal_num_server_players() const;
+  void _internal_set_num_server_players(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CNETMsg_SignonState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> players_networkids_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr map_name_;
+    uint32_t signon_state_;
+    uint32_t spawn_count_;
+    uint32_t num_server_players_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_GameEvent_key_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_GameEvent.key_t) */ {
+ public:
+  inline CSVCMsg_GameEvent_key_t() : CSVCMsg_GameEvent_key_t(nullptr) {}
+  ~CSVCMsg_GameEvent_key_t() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_GameEvent_key_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_GameEvent_key_t(const CSVCMsg_GameEvent_key_t& from);
+  CSVCMsg_GameEvent_key_t(CSVCMsg_GameEvent_key_t&& from) noexcept
+    : CSVCMsg_GameEvent_key_t() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_GameEvent_key_t& operator=(const CSVCMsg_GameEvent_key_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_GameEvent_key_t& operator=(CSVCMsg_GameEvent_key_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_GameEvent_key_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_GameEvent_key_t* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_GameEvent_key_t*>(
+               &_CSVCMsg_GameEvent_key_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(CSVCMsg_GameEvent_key_t& a, CSVCMsg_GameEvent_key_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_GameEvent_key_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_GameEvent_key_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_GameEvent_key_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_GameEvent_key_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_GameEvent_key_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_GameEvent_key_t& from) {
+    CSVCMsg_GameEvent_key_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_GameEvent_key_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_GameEvent.key_t";
+  }
+  protected:
+  explicit CSVCMsg_GameEvent_key_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValStringFieldNumber = 2,
+    kTypeFieldNumber = 1,
+    kValFloatFieldNumber = 3,
+    kValLongFieldNumber = 4,
+    kValShortFieldNumber = 5,
+    kValByteFieldNumber = 6,
+    kValBoolFieldNumber = 7,
+    kValUint64FieldNumber = 8,
+  };
+  // optional string val_string = 2;
+  bool has_val_string() const;
+  private:
+  bool _internal_has_val_string() const;
+  public:
+  void clear_val_string();
+  const std::string& val_string() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_val_string(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_val_string();
+  PROTOBUF_NODISCARD std::string* release_val_string();
+  void set_allocated_val_string(std::string* val_string);
+  private:
+  const std::string& _internal_val_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_val_string(const std::string& value);
+  std::string* _internal_mutable_val_string();
+  public:
+
+  // optional int32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // optional float val_float = 3;
+  bool has_val_float() const;
+  private:
+  bool _internal_has_val_float() const;
+  public:
+  void clear_val_float();
+  float val_float() const;
+  void set_val_float(float value);
+  private:
+  float _internal_val_float() const;
+  void _internal_set_val_float(float value);
+  public:
+
+  // optional int32 val_long = 4;
+  bool has_val_long() const;
+  private:
+  bool _internal_has_val_long() const;
+  public:
+  void clear_val_long();
+  int32_t val_long() const;
+  void set_val_long(int32_t value);
+  private:
+  int32_t _internal_val_long() const;
+  void _internal_set_val_long(int32_t value);
+  public:
+
+  // optional int32 val_short = 5;
+  bool has_val_short() const;
+  private:
+  bool _internal_has_val_short() const;
+  public:
+  void clear_val_short();
+  int32_t val_short() const;
+  void set_val_short(int32_t value);
+  private:
+  int32_t _internal_val_short() const;
+  void _internal_set_val_short(int32_t value);
+  public:
+
+  // optional int32 val_byte = 6;
+  bool has_val_byte() const;
+  private:
+  bool _internal_has_val_byte() const;
+  public:
+  void clear_val_byte();
+  int32_t val_byte() const;
+  void set_val_byte(int32_t value);
+  private:
+  int32_t _internal_val_byte() const;
+  void _internal_set_val_byte(int32_t value);
+  public:
+
+  // optional bool val_bool = 7;
+  bool has_val_bool() const;
+  private:
+  bool _internal_has_val_bool() const;
+  public:
+  void clear_val_bool();
+  bool val_bool() const;
+  void set_val_bool(bool value);
+  private:
+  bool _internal_val_bool() const;
+  void _internal_set_val_bool(bool value);
+  public:
+
+  // optional uint64 val_uint64 = 8;
+  bool has_val_uint64() const;
+  private:
+  bool _internal_has_val_uint64() const;
+  public:
+  void clear_val_uint64();
+  uint64_t val_uint64() const;
+  void set_val_uint64(uint64_t value);
+  private:
+  uint64_t _internal_val_uint64() const;
+  void _internal_set_val_uint64(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_GameEvent.key_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr val_string_;
+    int32_t type_;
+    float val_float_;
+    int32_t val_long_;
+    int32_t val_short_;
+    int32_t val_byte_;
+    bool val_bool_;
+    uint64_t val_uint64_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_GameEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_GameEvent) */ {
+ public:
+  inline CSVCMsg_GameEvent() : CSVCMsg_GameEvent(nullptr) {}
+  ~CSVCMsg_GameEvent() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_GameEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_GameEvent(const CSVCMsg_GameEvent& from);
+  CSVCMsg_GameEvent(CSVCMsg_GameEvent&& from) noexcept
+    : CSVCMsg_GameEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_GameEvent& operator=(const CSVCMsg_GameEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_GameEvent& operator=(CSVCMsg_GameEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_GameEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_GameEvent* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_GameEvent*>(
+               &_CSVCMsg_GameEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(CSVCMsg_GameEvent& a, CSVCMsg_GameEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_GameEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_GameEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_GameEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_GameEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_GameEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_GameEvent& from) {
+    CSVCMsg_GameEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_GameEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_GameEvent";
+  }
+  protected:
+  explicit CSVCMsg_GameEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CSVCMsg_GameEvent_key_t key_t;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 3,
+    kEventNameFieldNumber = 1,
+    kEventidFieldNumber = 2,
+  };
+  // repeated .CSVCMsg_GameEvent.key_t keys = 3;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  ::CSVCMsg_GameEvent_key_t* mutable_keys(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEvent_key_t >*
+      mutable_keys();
+  private:
+  const ::CSVCMsg_GameEvent_key_t& _internal_keys(int index) const;
+  ::CSVCMsg_GameEvent_key_t* _internal_add_keys();
+  public:
+  const ::CSVCMsg_GameEvent_key_t& keys(int index) const;
+  ::CSVCMsg_GameEvent_key_t* add_keys();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEvent_key_t >&
+      keys() const;
+
+  // optional string event_name = 1;
+  bool has_event_name() const;
+  private:
+  bool _internal_has_event_name() const;
+  public:
+  void clear_event_name();
+  const std::string& event_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_event_name();
+  PROTOBUF_NODISCARD std::string* release_event_name();
+  void set_allocated_event_name(std::string* event_name);
+  private:
+  const std::string& _internal_event_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_name(const std::string& value);
+  std::string* _internal_mutable_event_name();
+  public:
+
+  // optional int32 eventid = 2;
+  bool has_eventid() const;
+  private:
+  bool _internal_has_eventid() const;
+  public:
+  void clear_eventid();
+  int32_t eventid() const;
+  void set_eventid(int32_t value);
+  private:
+  int32_t _internal_eventid() const;
+  void _internal_set_eventid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_GameEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEvent_key_t > keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_name_;
+    int32_t eventid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsgList_GameEvents_event_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsgList_GameEvents.event_t) */ {
+ public:
+  inline CSVCMsgList_GameEvents_event_t() : CSVCMsgList_GameEvents_event_t(nullptr) {}
+  ~CSVCMsgList_GameEvents_event_t() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsgList_GameEvents_event_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsgList_GameEvents_event_t(const CSVCMsgList_GameEvents_event_t& from);
+  CSVCMsgList_GameEvents_event_t(CSVCMsgList_GameEvents_event_t&& from) noexcept
+    : CSVCMsgList_GameEvents_event_t() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsgList_GameEvents_event_t& operator=(const CSVCMsgList_GameEvents_event_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsgList_GameEvents_event_t& operator=(CSVCMsgList_GameEvents_event_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsgList_GameEvents_event_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsgList_GameEvents_event_t* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsgList_GameEvents_event_t*>(
+               &_CSVCMsgList_GameEvents_event_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(CSVCMsgList_GameEvents_event_t& a, CSVCMsgList_GameEvents_event_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsgList_GameEvents_event_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsgList_GameEvents_event_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsgList_GameEvents_event_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsgList_GameEvents_event_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsgList_GameEvents_event_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsgList_GameEvents_event_t& from) {
+    CSVCMsgList_GameEvents_event_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsgList_GameEvents_event_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsgList_GameEvents.event_t";
+  }
+  protected:
+  explicit CSVCMsgList_GameEvents_event_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventFieldNumber = 2,
+    kTickFieldNumber = 1,
+  };
+  // optional .CSVCMsg_GameEvent event = 2;
+  bool has_event() const;
+  private:
+  bool _internal_has_event() const;
+  public:
+  void clear_event();
+  const ::CSVCMsg_GameEvent& event() const;
+  PROTOBUF_NODISCARD ::CSVCMsg_GameEvent* release_event();
+  ::CSVCMsg_GameEvent* mutable_event();
+  void set_allocated_event(::CSVCMsg_GameEvent* event);
+  private:
+  const ::CSVCMsg_GameEvent& _internal_event() const;
+  ::CSVCMsg_GameEvent* _internal_mutable_event();
+  public:
+  void unsafe_arena_set_allocated_event(
+      ::CSVCMsg_GameEvent* event);
+  ::CSVCMsg_GameEvent* unsafe_arena_release_event();
+
+  // optional int32 tick = 1;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  int32_t tick() const;
+  void set_tick(int32_t value);
+  private:
+  int32_t _internal_tick() const;
+  void _internal_set_tick(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsgList_GameEvents.event_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CSVCMsg_GameEvent* event_;
+    int32_t tick_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsgList_GameEvents final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsgList_GameEvents) */ {
+ public:
+  inline CSVCMsgList_GameEvents() : CSVCMsgList_GameEvents(nullptr) {}
+  ~CSVCMsgList_GameEvents() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsgList_GameEvents(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsgList_GameEvents(const CSVCMsgList_GameEvents& from);
+  CSVCMsgList_GameEvents(CSVCMsgList_GameEvents&& from) noexcept
+    : CSVCMsgList_GameEvents() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsgList_GameEvents& operator=(const CSVCMsgList_GameEvents& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsgList_GameEvents& operator=(CSVCMsgList_GameEvents&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsgList_GameEvents& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsgList_GameEvents* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsgList_GameEvents*>(
+               &_CSVCMsgList_GameEvents_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(CSVCMsgList_GameEvents& a, CSVCMsgList_GameEvents& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsgList_GameEvents* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsgList_GameEvents* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsgList_GameEvents* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsgList_GameEvents>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsgList_GameEvents& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsgList_GameEvents& from) {
+    CSVCMsgList_GameEvents::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsgList_GameEvents* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsgList_GameEvents";
+  }
+  protected:
+  explicit CSVCMsgList_GameEvents(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CSVCMsgList_GameEvents_event_t event_t;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 1,
+  };
+  // repeated .CSVCMsgList_GameEvents.event_t events = 1;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::CSVCMsgList_GameEvents_event_t* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_GameEvents_event_t >*
+      mutable_events();
+  private:
+  const ::CSVCMsgList_GameEvents_event_t& _internal_events(int index) const;
+  ::CSVCMsgList_GameEvents_event_t* _internal_add_events();
+  public:
+  const ::CSVCMsgList_GameEvents_event_t& events(int index) const;
+  ::CSVCMsgList_GameEvents_event_t* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_GameEvents_event_t >&
+      events() const;
+
+  // @@protoc_insertion_point(class_scope:CSVCMsgList_GameEvents)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_GameEvents_event_t > events_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsg_UserMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsg_UserMessage) */ {
+ public:
+  inline CSVCMsg_UserMessage() : CSVCMsg_UserMessage(nullptr) {}
+  ~CSVCMsg_UserMessage() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsg_UserMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsg_UserMessage(const CSVCMsg_UserMessage& from);
+  CSVCMsg_UserMessage(CSVCMsg_UserMessage&& from) noexcept
+    : CSVCMsg_UserMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsg_UserMessage& operator=(const CSVCMsg_UserMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsg_UserMessage& operator=(CSVCMsg_UserMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsg_UserMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsg_UserMessage* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsg_UserMessage*>(
+               &_CSVCMsg_UserMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(CSVCMsg_UserMessage& a, CSVCMsg_UserMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsg_UserMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsg_UserMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsg_UserMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsg_UserMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsg_UserMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsg_UserMessage& from) {
+    CSVCMsg_UserMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsg_UserMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsg_UserMessage";
+  }
+  protected:
+  explicit CSVCMsg_UserMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgDataFieldNumber = 2,
+    kMsgTypeFieldNumber = 1,
+  };
+  // optional bytes msg_data = 2;
+  bool has_msg_data() const;
+  private:
+  bool _internal_has_msg_data() const;
+  public:
+  void clear_msg_data();
+  const std::string& msg_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg_data();
+  PROTOBUF_NODISCARD std::string* release_msg_data();
+  void set_allocated_msg_data(std::string* msg_data);
+  private:
+  const std::string& _internal_msg_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg_data(const std::string& value);
+  std::string* _internal_mutable_msg_data();
+  public:
+
+  // optional int32 msg_type = 1;
+  bool has_msg_type() const;
+  private:
+  bool _internal_has_msg_type() const;
+  public:
+  void clear_msg_type();
+  int32_t msg_type() const;
+  void set_msg_type(int32_t value);
+  private:
+  int32_t _internal_msg_type() const;
+  void _internal_set_msg_type(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsg_UserMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_data_;
+    int32_t msg_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsgList_UserMessages_usermsg_t final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsgList_UserMessages.usermsg_t) */ {
+ public:
+  inline CSVCMsgList_UserMessages_usermsg_t() : CSVCMsgList_UserMessages_usermsg_t(nullptr) {}
+  ~CSVCMsgList_UserMessages_usermsg_t() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsgList_UserMessages_usermsg_t(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsgList_UserMessages_usermsg_t(const CSVCMsgList_UserMessages_usermsg_t& from);
+  CSVCMsgList_UserMessages_usermsg_t(CSVCMsgList_UserMessages_usermsg_t&& from) noexcept
+    : CSVCMsgList_UserMessages_usermsg_t() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsgList_UserMessages_usermsg_t& operator=(const CSVCMsgList_UserMessages_usermsg_t& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsgList_UserMessages_usermsg_t& operator=(CSVCMsgList_UserMessages_usermsg_t&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsgList_UserMessages_usermsg_t& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsgList_UserMessages_usermsg_t* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsgList_UserMessages_usermsg_t*>(
+               &_CSVCMsgList_UserMessages_usermsg_t_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(CSVCMsgList_UserMessages_usermsg_t& a, CSVCMsgList_UserMessages_usermsg_t& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsgList_UserMessages_usermsg_t* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsgList_UserMessages_usermsg_t* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsgList_UserMessages_usermsg_t* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsgList_UserMessages_usermsg_t>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsgList_UserMessages_usermsg_t& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsgList_UserMessages_usermsg_t& from) {
+    CSVCMsgList_UserMessages_usermsg_t::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsgList_UserMessages_usermsg_t* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsgList_UserMessages.usermsg_t";
+  }
+  protected:
+  explicit CSVCMsgList_UserMessages_usermsg_t(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgFieldNumber = 2,
+    kTickFieldNumber = 1,
+  };
+  // optional .CSVCMsg_UserMessage msg = 2;
+  bool has_msg() const;
+  private:
+  bool _internal_has_msg() const;
+  public:
+  void clear_msg();
+  const ::CSVCMsg_UserMessage& msg() const;
+  PROTOBUF_NODISCARD ::CSVCMsg_UserMessage* release_msg();
+  ::CSVCMsg_UserMessage* mutable_msg();
+  void set_allocated_msg(::CSVCMsg_UserMessage* msg);
+  private:
+  const ::CSVCMsg_UserMessage& _internal_msg() const;
+  ::CSVCMsg_UserMessage* _internal_mutable_msg();
+  public:
+  void unsafe_arena_set_allocated_msg(
+      ::CSVCMsg_UserMessage* msg);
+  ::CSVCMsg_UserMessage* unsafe_arena_release_msg();
+
+  // optional int32 tick = 1;
+  bool has_tick() const;
+  private:
+  bool _internal_has_tick() const;
+  public:
+  void clear_tick();
+  int32_t tick() const;
+  void set_tick(int32_t value);
+  private:
+  int32_t _internal_tick() const;
+  void _internal_set_tick(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CSVCMsgList_UserMessages.usermsg_t)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CSVCMsg_UserMessage* msg_;
+    int32_t tick_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSVCMsgList_UserMessages final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CSVCMsgList_UserMessages) */ {
+ public:
+  inline CSVCMsgList_UserMessages() : CSVCMsgList_UserMessages(nullptr) {}
+  ~CSVCMsgList_UserMessages() override;
+  explicit PROTOBUF_CONSTEXPR CSVCMsgList_UserMessages(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSVCMsgList_UserMessages(const CSVCMsgList_UserMessages& from);
+  CSVCMsgList_UserMessages(CSVCMsgList_UserMessages&& from) noexcept
+    : CSVCMsgList_UserMessages() {
+    *this = ::std::move(from);
+  }
+
+  inline CSVCMsgList_UserMessages& operator=(const CSVCMsgList_UserMessages& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSVCMsgList_UserMessages& operator=(CSVCMsgList_UserMessages&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSVCMsgList_UserMessages& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSVCMsgList_UserMessages* internal_default_instance() {
+    return reinterpret_cast<const CSVCMsgList_UserMessages*>(
+               &_CSVCMsgList_UserMessages_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(CSVCMsgList_UserMessages& a, CSVCMsgList_UserMessages& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSVCMsgList_UserMessages* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSVCMsgList_UserMessages* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSVCMsgList_UserMessages* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSVCMsgList_UserMessages>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSVCMsgList_UserMessages& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSVCMsgList_UserMessages& from) {
+    CSVCMsgList_UserMessages::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSVCMsgList_UserMessages* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CSVCMsgList_UserMessages";
+  }
+  protected:
+  explicit CSVCMsgList_UserMessages(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CSVCMsgList_UserMessages_usermsg_t usermsg_t;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsermsgsFieldNumber = 1,
+  };
+  // repeated .CSVCMsgList_UserMessages.usermsg_t usermsgs = 1;
+  int usermsgs_size() const;
+  private:
+  int _internal_usermsgs_size() const;
+  public:
+  void clear_usermsgs();
+  ::CSVCMsgList_UserMessages_usermsg_t* mutable_usermsgs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_UserMessages_usermsg_t >*
+      mutable_usermsgs();
+  private:
+  const ::CSVCMsgList_UserMessages_usermsg_t& _internal_usermsgs(int index) const;
+  ::CSVCMsgList_UserMessages_usermsg_t* _internal_add_usermsgs();
+  public:
+  const ::CSVCMsgList_UserMessages_usermsg_t& usermsgs(int index) const;
+  ::CSVCMsgList_UserMessages_usermsg_t* add_usermsgs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_UserMessages_usermsg_t >&
+      usermsgs() const;
+
+  // @@protoc_insertion_point(class_scope:CSVCMsgList_UserMessages)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_UserMessages_usermsg_t > usermsgs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_networkbasetypes_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CMsgVector
+
+// optional float x = 1;
+inline bool CMsgVector::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgVector::has_x() const {
+  return _internal_has_x();
+}
+inline void CMsgVector::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float CMsgVector::_internal_x() const {
+  return _impl_.x_;
+}
+inline float CMsgVector::x() const {
+  // @@protoc_insertion_point(field_get:CMsgVector.x)
+  return _internal_x();
+}
+inline void CMsgVector::_internal_set_x(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void CMsgVector::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:CMsgVector.x)
+}
+
+// optional float y = 2;
+inline bool CMsgVector::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgVector::has_y() const {
+  return _internal_has_y();
+}
+inline void CMsgVector::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float CMsgVector::_internal_y() const {
+  return _impl_.y_;
+}
+inline float CMsgVector::y() const {
+  // @@protoc_insertion_point(field_get:CMsgVector.y)
+  return _internal_y();
+}
+inline void CMsgVector::_internal_set_y(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void CMsgVector::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:CMsgVector.y)
+}
+
+// optional float z = 3;
+inline bool CMsgVector::_internal_has_z() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgVector::has_z() const {
+  return _internal_has_z();
+}
+inline void CMsgVector::clear_z() {
+  _impl_.z_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CMsgVector::_internal_z() const {
+  return _impl_.z_;
+}
+inline float CMsgVector::z() const {
+  // @@protoc_insertion_point(field_get:CMsgVector.z)
+  return _internal_z();
+}
+inline void CMsgVector::_internal_set_z(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.z_ = value;
+}
+inline void CMsgVector::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:CMsgVector.z)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgVector2D
+
+// optional float x = 1;
+inline bool CMsgVector2D::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgVector2D::has_x() const {
+  return _internal_has_x();
+}
+inline void CMsgVector2D::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float CMsgVector2D::_internal_x() const {
+  return _impl_.x_;
+}
+inline float CMsgVector2D::x() const {
+  // @@protoc_insertion_point(field_get:CMsgVector2D.x)
+  return _internal_x();
+}
+inline void CMsgVector2D::_internal_set_x(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void CMsgVector2D::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:CMsgVector2D.x)
+}
+
+// optional float y = 2;
+inline bool CMsgVector2D::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgVector2D::has_y() const {
+  return _internal_has_y();
+}
+inline void CMsgVector2D::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float CMsgVector2D::_internal_y() const {
+  return _impl_.y_;
+}
+inline float CMsgVector2D::y() const {
+  // @@protoc_insertion_point(field_get:CMsgVector2D.y)
+  return _internal_y();
+}
+inline void CMsgVector2D::_internal_set_y(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void CMsgVector2D::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:CMsgVector2D.y)
+}
+
+// -------------------------------------------------------------------
+
+// CMsgQAngle
+
+// optional float x = 1;
+inline bool CMsgQAngle::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsgQAngle::has_x() const {
+  return _internal_has_x();
+}
+inline void CMsgQAngle::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float CMsgQAngle::_internal_x() const {
+  return _impl_.x_;
+}
+inline float CMsgQAngle::x() const {
+  // @@protoc_insertion_point(field_get:CMsgQAngle.x)
+  return _internal_x();
+}
+inline void CMsgQAngle::_internal_set_x(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void CMsgQAngle::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:CMsgQAngle.x)
+}
+
+// optional float y = 2;
+inline bool CMsgQAngle::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsgQAngle::has_y() const {
+  return _internal_has_y();
+}
+inline void CMsgQAngle::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float CMsgQAngle::_internal_y() const {
+  return _impl_.y_;
+}
+inline float CMsgQAngle::y() const {
+  // @@protoc_insertion_point(field_get:CMsgQAngle.y)
+  return _internal_y();
+}
+inline void CMsgQAngle::_internal_set_y(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void CMsgQAngle::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:CMsgQAngle.y)
+}
+
+// optional float z = 3;
+inline bool CMsgQAngle::_internal_has_z() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CMsgQAngle::has_z() const {
+  return _internal_has_z();
+}
+inline void CMsgQAngle::clear_z() {
+  _impl_.z_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CMsgQAngle::_internal_z() const {
+  return _impl_.z_;
+}
+inline float CMsgQAngle::z() const {
+  // @@protoc_insertion_point(field_get:CMsgQAngle.z)
+  return _internal_z();
+}
+inline void CMsgQAngle::_internal_set_z(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.z_ = value;
+}
+inline void CMsgQAngle::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:CMsgQAngle.z)
+}
+
+// -------------------------------------------------------------------
+
+// CMsg_CVars_CVar
+
+// optional string name = 1;
+inline bool CMsg_CVars_CVar::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CMsg_CVars_CVar::has_name() const {
+  return _internal_has_name();
+}
+inline void CMsg_CVars_CVar::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CMsg_CVars_CVar::name() const {
+  // @@protoc_insertion_point(field_get:CMsg_CVars.CVar.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CMsg_CVars_CVar::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CMsg_CVars.CVar.name)
+}
+inline std::string* CMsg_CVars_CVar::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:CMsg_CVars.CVar.name)
+  return _s;
+}
+inline const std::string& CMsg_CVars_CVar::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CMsg_CVars_CVar::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CMsg_CVars_CVar::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CMsg_CVars_CVar::release_name() {
+  // @@protoc_insertion_point(field_release:CMsg_CVars.CVar.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CMsg_CVars_CVar::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CMsg_CVars.CVar.name)
+}
+
+// optional string value = 2;
+inline bool CMsg_CVars_CVar::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CMsg_CVars_CVar::has_value() const {
+  return _internal_has_value();
+}
+inline void CMsg_CVars_CVar::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CMsg_CVars_CVar::value() const {
+  // @@protoc_insertion_point(field_get:CMsg_CVars.CVar.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CMsg_CVars_CVar::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CMsg_CVars.CVar.value)
+}
+inline std::string* CMsg_CVars_CVar::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:CMsg_CVars.CVar.value)
+  return _s;
+}
+inline const std::string& CMsg_CVars_CVar::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CMsg_CVars_CVar::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CMsg_CVars_CVar::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CMsg_CVars_CVar::release_value() {
+  // @@protoc_insertion_point(field_release:CMsg_CVars.CVar.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CMsg_CVars_CVar::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CMsg_CVars.CVar.value)
+}
+
+// -------------------------------------------------------------------
+
+// CMsg_CVars
+
+// repeated .CMsg_CVars.CVar cvars = 1;
+inline int CMsg_CVars::_internal_cvars_size() const {
+  return _impl_.cvars_.size();
+}
+inline int CMsg_CVars::cvars_size() const {
+  return _internal_cvars_size();
+}
+inline void CMsg_CVars::clear_cvars() {
+  _impl_.cvars_.Clear();
+}
+inline ::CMsg_CVars_CVar* CMsg_CVars::mutable_cvars(int index) {
+  // @@protoc_insertion_point(field_mutable:CMsg_CVars.cvars)
+  return _impl_.cvars_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsg_CVars_CVar >*
+CMsg_CVars::mutable_cvars() {
+  // @@protoc_insertion_point(field_mutable_list:CMsg_CVars.cvars)
+  return &_impl_.cvars_;
+}
+inline const ::CMsg_CVars_CVar& CMsg_CVars::_internal_cvars(int index) const {
+  return _impl_.cvars_.Get(index);
+}
+inline const ::CMsg_CVars_CVar& CMsg_CVars::cvars(int index) const {
+  // @@protoc_insertion_point(field_get:CMsg_CVars.cvars)
+  return _internal_cvars(index);
+}
+inline ::CMsg_CVars_CVar* CMsg_CVars::_internal_add_cvars() {
+  return _impl_.cvars_.Add();
+}
+inline ::CMsg_CVars_CVar* CMsg_CVars::add_cvars() {
+  ::CMsg_CVars_CVar* _add = _internal_add_cvars();
+  // @@protoc_insertion_point(field_add:CMsg_CVars.cvars)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CMsg_CVars_CVar >&
+CMsg_CVars::cvars() const {
+  // @@protoc_insertion_point(field_list:CMsg_CVars.cvars)
+  return _impl_.cvars_;
+}
+
+// -------------------------------------------------------------------
+
+// CNETMsg_NOP
+
+// -------------------------------------------------------------------
+
+// CNETMsg_SplitScreenUser
+
+// optional int32 slot = 1;
+inline bool CNETMsg_SplitScreenUser::_internal_has_slot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CNETMsg_SplitScreenUser::has_slot() const {
+  return _internal_has_slot();
+}
+inline void CNETMsg_SplitScreenUser::clear_slot() {
+  _impl_.slot_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CNETMsg_SplitScreenUser::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline int32_t CNETMsg_SplitScreenUser::slot() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_SplitScreenUser.slot)
+  return _internal_slot();
+}
+inline void CNETMsg_SplitScreenUser::_internal_set_slot(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.slot_ = value;
+}
+inline void CNETMsg_SplitScreenUser::set_slot(int32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_SplitScreenUser.slot)
+}
+
+// -------------------------------------------------------------------
+
+// CNETMsg_Disconnect
+
+// optional .ENetworkDisconnectionReason reason = 2 [default = NETWORK_DISCONNECT_INVALID];
+inline bool CNETMsg_Disconnect::_internal_has_reason() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CNETMsg_Disconnect::has_reason() const {
+  return _internal_has_reason();
+}
+inline void CNETMsg_Disconnect::clear_reason() {
+  _impl_.reason_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::ENetworkDisconnectionReason CNETMsg_Disconnect::_internal_reason() const {
+  return static_cast< ::ENetworkDisconnectionReason >(_impl_.reason_);
+}
+inline ::ENetworkDisconnectionReason CNETMsg_Disconnect::reason() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_Disconnect.reason)
+  return _internal_reason();
+}
+inline void CNETMsg_Disconnect::_internal_set_reason(::ENetworkDisconnectionReason value) {
+  assert(::ENetworkDisconnectionReason_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reason_ = value;
+}
+inline void CNETMsg_Disconnect::set_reason(::ENetworkDisconnectionReason value) {
+  _internal_set_reason(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_Disconnect.reason)
+}
+
+// -------------------------------------------------------------------
+
+// CNETMsg_File
+
+// optional int32 transfer_id = 1;
+inline bool CNETMsg_File::_internal_has_transfer_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CNETMsg_File::has_transfer_id() const {
+  return _internal_has_transfer_id();
+}
+inline void CNETMsg_File::clear_transfer_id() {
+  _impl_.transfer_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CNETMsg_File::_internal_transfer_id() const {
+  return _impl_.transfer_id_;
+}
+inline int32_t CNETMsg_File::transfer_id() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_File.transfer_id)
+  return _internal_transfer_id();
+}
+inline void CNETMsg_File::_internal_set_transfer_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.transfer_id_ = value;
+}
+inline void CNETMsg_File::set_transfer_id(int32_t value) {
+  _internal_set_transfer_id(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_File.transfer_id)
+}
+
+// optional string file_name = 2;
+inline bool CNETMsg_File::_internal_has_file_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CNETMsg_File::has_file_name() const {
+  return _internal_has_file_name();
+}
+inline void CNETMsg_File::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CNETMsg_File::file_name() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_File.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CNETMsg_File::set_file_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CNETMsg_File.file_name)
+}
+inline std::string* CNETMsg_File::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:CNETMsg_File.file_name)
+  return _s;
+}
+inline const std::string& CNETMsg_File::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void CNETMsg_File::_internal_set_file_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CNETMsg_File::_internal_mutable_file_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CNETMsg_File::release_file_name() {
+  // @@protoc_insertion_point(field_release:CNETMsg_File.file_name)
+  if (!_internal_has_file_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.file_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CNETMsg_File::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CNETMsg_File.file_name)
+}
+
+// optional bool is_replay_demo_file = 3;
+inline bool CNETMsg_File::_internal_has_is_replay_demo_file() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CNETMsg_File::has_is_replay_demo_file() const {
+  return _internal_has_is_replay_demo_file();
+}
+inline void CNETMsg_File::clear_is_replay_demo_file() {
+  _impl_.is_replay_demo_file_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CNETMsg_File::_internal_is_replay_demo_file() const {
+  return _impl_.is_replay_demo_file_;
+}
+inline bool CNETMsg_File::is_replay_demo_file() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_File.is_replay_demo_file)
+  return _internal_is_replay_demo_file();
+}
+inline void CNETMsg_File::_internal_set_is_replay_demo_file(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.is_replay_demo_file_ = value;
+}
+inline void CNETMsg_File::set_is_replay_demo_file(bool value) {
+  _internal_set_is_replay_demo_file(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_File.is_replay_demo_file)
+}
+
+// optional bool deny = 4;
+inline bool CNETMsg_File::_internal_has_deny() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CNETMsg_File::has_deny() const {
+  return _internal_has_deny();
+}
+inline void CNETMsg_File::clear_deny() {
+  _impl_.deny_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool CNETMsg_File::_internal_deny() const {
+  return _impl_.deny_;
+}
+inline bool CNETMsg_File::deny() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_File.deny)
+  return _internal_deny();
+}
+inline void CNETMsg_File::_internal_set_deny(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.deny_ = value;
+}
+inline void CNETMsg_File::set_deny(bool value) {
+  _internal_set_deny(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_File.deny)
+}
+
+// optional bool is_file_requested = 5;
+inline bool CNETMsg_File::_internal_has_is_file_requested() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CNETMsg_File::has_is_file_requested() const {
+  return _internal_has_is_file_requested();
+}
+inline void CNETMsg_File::clear_is_file_requested() {
+  _impl_.is_file_requested_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool CNETMsg_File::_internal_is_file_requested() const {
+  return _impl_.is_file_requested_;
+}
+inline bool CNETMsg_File::is_file_requested() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_File.is_file_requested)
+  return _internal_is_file_requested();
+}
+inline void CNETMsg_File::_internal_set_is_file_requested(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.is_file_requested_ = value;
+}
+inline void CNETMsg_File::set_is_file_requested(bool value) {
+  _internal_set_is_file_requested(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_File.is_file_requested)
+}
+
+// -------------------------------------------------------------------
+
+// CNETMsg_Tick
+
+// optional uint32 tick = 1;
+inline bool CNETMsg_Tick::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CNETMsg_Tick::has_tick() const {
+  return _internal_has_tick();
+}
+inline void CNETMsg_Tick::clear_tick() {
+  _impl_.tick_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CNETMsg_Tick::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline uint32_t CNETMsg_Tick::tick() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_Tick.tick)
+  return _internal_tick();
+}
+inline void CNETMsg_Tick::_internal_set_tick(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.tick_ = value;
+}
+inline void CNETMsg_Tick::set_tick(uint32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_Tick.tick)
+}
+
+// optional uint32 host_computationtime = 4;
+inline bool CNETMsg_Tick::_internal_has_host_computationtime() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CNETMsg_Tick::has_host_computationtime() const {
+  return _internal_has_host_computationtime();
+}
+inline void CNETMsg_Tick::clear_host_computationtime() {
+  _impl_.host_computationtime_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CNETMsg_Tick::_internal_host_computationtime() const {
+  return _impl_.host_computationtime_;
+}
+inline uint32_t CNETMsg_Tick::host_computationtime() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_Tick.host_computationtime)
+  return _internal_host_computationtime();
+}
+inline void CNETMsg_Tick::_internal_set_host_computationtime(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.host_computationtime_ = value;
+}
+inline void CNETMsg_Tick::set_host_computationtime(uint32_t value) {
+  _internal_set_host_computationtime(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_Tick.host_computationtime)
+}
+
+// optional uint32 host_computationtime_std_deviation = 5;
+inline bool CNETMsg_Tick::_internal_has_host_computationtime_std_deviation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CNETMsg_Tick::has_host_computationtime_std_deviation() const {
+  return _internal_has_host_computationtime_std_deviation();
+}
+inline void CNETMsg_Tick::clear_host_computationtime_std_deviation() {
+  _impl_.host_computationtime_std_deviation_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CNETMsg_Tick::_internal_host_computationtime_std_deviation() const {
+  return _impl_.host_computationtime_std_deviation_;
+}
+inline uint32_t CNETMsg_Tick::host_computationtime_std_deviation() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_Tick.host_computationtime_std_deviation)
+  return _internal_host_computationtime_std_deviation();
+}
+inline void CNETMsg_Tick::_internal_set_host_computationtime_std_deviation(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.host_computationtime_std_deviation_ = value;
+}
+inline void CNETMsg_Tick::set_host_computationtime_std_deviation(uint32_t value) {
+  _internal_set_host_computationtime_std_deviation(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_Tick.host_computationtime_std_deviation)
+}
+
+// optional uint32 host_framestarttime_std_deviation = 6;
+inline bool CNETMsg_Tick::_internal_has_host_framestarttime_std_deviation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CNETMsg_Tick::has_host_framestarttime_std_deviation() const {
+  return _internal_has_host_framestarttime_std_deviation();
+}
+inline void CNETMsg_Tick::clear_host_framestarttime_std_deviation() {
+  _impl_.host_framestarttime_std_deviation_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CNETMsg_Tick::_internal_host_framestarttime_std_deviation() const {
+  return _impl_.host_framestarttime_std_deviation_;
+}
+inline uint32_t CNETMsg_Tick::host_framestarttime_std_deviation() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_Tick.host_framestarttime_std_deviation)
+  return _internal_host_framestarttime_std_deviation();
+}
+inline void CNETMsg_Tick::_internal_set_host_framestarttime_std_deviation(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.host_framestarttime_std_deviation_ = value;
+}
+inline void CNETMsg_Tick::set_host_framestarttime_std_deviation(uint32_t value) {
+  _internal_set_host_framestarttime_std_deviation(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_Tick.host_framestarttime_std_deviation)
+}
+
+// -------------------------------------------------------------------
+
+// CNETMsg_StringCmd
+
+// optional string command = 1;
+inline bool CNETMsg_StringCmd::_internal_has_command() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CNETMsg_StringCmd::has_command() const {
+  return _internal_has_command();
+}
+inline void CNETMsg_StringCmd::clear_command() {
+  _impl_.command_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CNETMsg_StringCmd::command() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_StringCmd.command)
+  return _internal_command();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CNETMsg_StringCmd::set_command(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.command_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CNETMsg_StringCmd.command)
+}
+inline std::string* CNETMsg_StringCmd::mutable_command() {
+  std::string* _s = _internal_mutable_command();
+  // @@protoc_insertion_point(field_mutable:CNETMsg_StringCmd.command)
+  return _s;
+}
+inline const std::string& CNETMsg_StringCmd::_internal_command() const {
+  return _impl_.command_.Get();
+}
+inline void CNETMsg_StringCmd::_internal_set_command(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.command_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CNETMsg_StringCmd::_internal_mutable_command() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.command_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CNETMsg_StringCmd::release_command() {
+  // @@protoc_insertion_point(field_release:CNETMsg_StringCmd.command)
+  if (!_internal_has_command()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.command_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CNETMsg_StringCmd::set_allocated_command(std::string* command) {
+  if (command != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CNETMsg_StringCmd.command)
+}
+
+// -------------------------------------------------------------------
+
+// CNETMsg_SetConVar
+
+// optional .CMsg_CVars convars = 1;
+inline bool CNETMsg_SetConVar::_internal_has_convars() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.convars_ != nullptr);
+  return value;
+}
+inline bool CNETMsg_SetConVar::has_convars() const {
+  return _internal_has_convars();
+}
+inline void CNETMsg_SetConVar::clear_convars() {
+  if (_impl_.convars_ != nullptr) _impl_.convars_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CMsg_CVars& CNETMsg_SetConVar::_internal_convars() const {
+  const ::CMsg_CVars* p = _impl_.convars_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsg_CVars&>(
+      ::_CMsg_CVars_default_instance_);
+}
+inline const ::CMsg_CVars& CNETMsg_SetConVar::convars() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_SetConVar.convars)
+  return _internal_convars();
+}
+inline void CNETMsg_SetConVar::unsafe_arena_set_allocated_convars(
+    ::CMsg_CVars* convars) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.convars_);
+  }
+  _impl_.convars_ = convars;
+  if (convars) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CNETMsg_SetConVar.convars)
+}
+inline ::CMsg_CVars* CNETMsg_SetConVar::release_convars() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsg_CVars* temp = _impl_.convars_;
+  _impl_.convars_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsg_CVars* CNETMsg_SetConVar::unsafe_arena_release_convars() {
+  // @@protoc_insertion_point(field_release:CNETMsg_SetConVar.convars)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsg_CVars* temp = _impl_.convars_;
+  _impl_.convars_ = nullptr;
+  return temp;
+}
+inline ::CMsg_CVars* CNETMsg_SetConVar::_internal_mutable_convars() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.convars_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsg_CVars>(GetArenaForAllocation());
+    _impl_.convars_ = p;
+  }
+  return _impl_.convars_;
+}
+inline ::CMsg_CVars* CNETMsg_SetConVar::mutable_convars() {
+  ::CMsg_CVars* _msg = _internal_mutable_convars();
+  // @@protoc_insertion_point(field_mutable:CNETMsg_SetConVar.convars)
+  return _msg;
+}
+inline void CNETMsg_SetConVar::set_allocated_convars(::CMsg_CVars* convars) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.convars_;
+  }
+  if (convars) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(convars);
+    if (message_arena != submessage_arena) {
+      convars = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, convars, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.convars_ = convars;
+  // @@protoc_insertion_point(field_set_allocated:CNETMsg_SetConVar.convars)
+}
+
+// -------------------------------------------------------------------
+
+// CNETMsg_SignonState
+
+// optional uint32 signon_state = 1;
+inline bool CNETMsg_SignonState::_internal_has_signon_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CNETMsg_SignonState::has_signon_state() const {
+  return _internal_has_signon_state();
+}
+inline void CNETMsg_SignonState::clear_signon_state() {
+  _impl_.signon_state_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CNETMsg_SignonState::_internal_signon_state() const {
+  return _impl_.signon_state_;
+}
+inline uint32_t CNETMsg_SignonState::signon_state() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_SignonState.signon_state)
+  return _internal_signon_state();
+}
+inline void CNETMsg_SignonState::_internal_set_signon_state(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.signon_state_ = value;
+}
+inline void CNETMsg_SignonState::set_signon_state(uint32_t value) {
+  _internal_set_signon_state(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_SignonState.signon_state)
+}
+
+// optional uint32 spawn_count = 2;
+inline bool CNETMsg_SignonState::_internal_has_spawn_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CNETMsg_SignonState::has_spawn_count() const {
+  return _internal_has_spawn_count();
+}
+inline void CNETMsg_SignonState::clear_spawn_count() {
+  _impl_.spawn_count_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CNETMsg_SignonState::_internal_spawn_count() const {
+  return _impl_.spawn_count_;
+}
+inline uint32_t CNETMsg_SignonState::spawn_count() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_SignonState.spawn_count)
+  return _internal_spawn_count();
+}
+inline void CNETMsg_SignonState::_internal_set_spawn_count(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.spawn_count_ = value;
+}
+inline void CNETMsg_SignonState::set_spawn_count(uint32_t value) {
+  _internal_set_spawn_count(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_SignonState.spawn_count)
+}
+
+// optional uint32 num_server_players = 3;
+inline bool CNETMsg_SignonState::_internal_has_num_server_players() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CNETMsg_SignonState::has_num_server_players() const {
+  return _internal_has_num_server_players();
+}
+inline void CNETMsg_SignonState::clear_num_server_players() {
+  _impl_.num_server_players_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CNETMsg_SignonState::_internal_num_server_players() const {
+  return _impl_.num_server_players_;
+}
+inline uint32_t CNETMsg_SignonState::num_server_players() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_SignonState.num_server_players)
+  return _internal_num_server_players();
+}
+inline void CNETMsg_SignonState::_internal_set_num_server_players(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.num_server_players_ = value;
+}
+inline void CNETMsg_SignonState::set_num_server_players(uint32_t value) {
+  _internal_set_num_server_players(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_SignonState.num_server_players)
+}
+
+// repeated string players_networkids = 4;
+inline int CNETMsg_SignonState::_internal_players_networkids_size() const {
+  return _impl_.players_networkids_.size();
+}
+inline int CNETMsg_SignonState::players_networkids_size() const {
+  return _internal_players_networkids_size();
+}
+inline void CNETMsg_SignonState::clear_players_networkids() {
+  _impl_.players_networkids_.Clear();
+}
+inline std::string* CNETMsg_SignonState::add_players_networkids() {
+  std::string* _s = _internal_add_players_networkids();
+  // @@protoc_insertion_point(field_add_mutable:CNETMsg_SignonState.players_networkids)
+  return _s;
+}
+inline const std::string& CNETMsg_SignonState::_internal_players_networkids(int index) const {
+  return _impl_.players_networkids_.Get(index);
+}
+inline const std::string& CNETMsg_SignonState::players_networkids(int index) const {
+  // @@protoc_insertion_point(field_get:CNETMsg_SignonState.players_networkids)
+  return _internal_players_networkids(index);
+}
+inline std::string* CNETMsg_SignonState::mutable_players_networkids(int index) {
+  // @@protoc_insertion_point(field_mutable:CNETMsg_SignonState.players_networkids)
+  return _impl_.players_networkids_.Mutable(index);
+}
+inline void CNETMsg_SignonState::set_players_networkids(int index, const std::string& value) {
+  _impl_.players_networkids_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:CNETMsg_SignonState.players_networkids)
+}
+inline void CNETMsg_SignonState::set_players_networkids(int index, std::string&& value) {
+  _impl_.players_networkids_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:CNETMsg_SignonState.players_networkids)
+}
+inline void CNETMsg_SignonState::set_players_networkids(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.players_networkids_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:CNETMsg_SignonState.players_networkids)
+}
+inline void CNETMsg_SignonState::set_players_networkids(int index, const char* value, size_t size) {
+  _impl_.players_networkids_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:CNETMsg_SignonState.players_networkids)
+}
+inline std::string* CNETMsg_SignonState::_internal_add_players_networkids() {
+  return _impl_.players_networkids_.Add();
+}
+inline void CNETMsg_SignonState::add_players_networkids(const std::string& value) {
+  _impl_.players_networkids_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:CNETMsg_SignonState.players_networkids)
+}
+inline void CNETMsg_SignonState::add_players_networkids(std::string&& value) {
+  _impl_.players_networkids_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:CNETMsg_SignonState.players_networkids)
+}
+inline void CNETMsg_SignonState::add_players_networkids(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.players_networkids_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:CNETMsg_SignonState.players_networkids)
+}
+inline void CNETMsg_SignonState::add_players_networkids(const char* value, size_t size) {
+  _impl_.players_networkids_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:CNETMsg_SignonState.players_networkids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CNETMsg_SignonState::players_networkids() const {
+  // @@protoc_insertion_point(field_list:CNETMsg_SignonState.players_networkids)
+  return _impl_.players_networkids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CNETMsg_SignonState::mutable_players_networkids() {
+  // @@protoc_insertion_point(field_mutable_list:CNETMsg_SignonState.players_networkids)
+  return &_impl_.players_networkids_;
+}
+
+// optional string map_name = 5;
+inline bool CNETMsg_SignonState::_internal_has_map_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CNETMsg_SignonState::has_map_name() const {
+  return _internal_has_map_name();
+}
+inline void CNETMsg_SignonState::clear_map_name() {
+  _impl_.map_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CNETMsg_SignonState::map_name() const {
+  // @@protoc_insertion_point(field_get:CNETMsg_SignonState.map_name)
+  return _internal_map_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CNETMsg_SignonState::set_map_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.map_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CNETMsg_SignonState.map_name)
+}
+inline std::string* CNETMsg_SignonState::mutable_map_name() {
+  std::string* _s = _internal_mutable_map_name();
+  // @@protoc_insertion_point(field_mutable:CNETMsg_SignonState.map_name)
+  return _s;
+}
+inline const std::string& CNETMsg_SignonState::_internal_map_name() const {
+  return _impl_.map_name_.Get();
+}
+inline void CNETMsg_SignonState::_internal_set_map_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.map_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CNETMsg_SignonState::_internal_mutable_map_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.map_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CNETMsg_SignonState::release_map_name() {
+  // @@protoc_insertion_point(field_release:CNETMsg_SignonState.map_name)
+  if (!_internal_has_map_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.map_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.map_name_.IsDefault()) {
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CNETMsg_SignonState::set_allocated_map_name(std::string* map_name) {
+  if (map_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.map_name_.SetAllocated(map_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.map_name_.IsDefault()) {
+    _impl_.map_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CNETMsg_SignonState.map_name)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_GameEvent_key_t
+
+// optional int32 type = 1;
+inline bool CSVCMsg_GameEvent_key_t::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent_key_t::has_type() const {
+  return _internal_has_type();
+}
+inline void CSVCMsg_GameEvent_key_t::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_GameEvent_key_t::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t CSVCMsg_GameEvent_key_t::type() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.key_t.type)
+  return _internal_type();
+}
+inline void CSVCMsg_GameEvent_key_t::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void CSVCMsg_GameEvent_key_t::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.key_t.type)
+}
+
+// optional string val_string = 2;
+inline bool CSVCMsg_GameEvent_key_t::_internal_has_val_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent_key_t::has_val_string() const {
+  return _internal_has_val_string();
+}
+inline void CSVCMsg_GameEvent_key_t::clear_val_string() {
+  _impl_.val_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_GameEvent_key_t::val_string() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.key_t.val_string)
+  return _internal_val_string();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_GameEvent_key_t::set_val_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.val_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.key_t.val_string)
+}
+inline std::string* CSVCMsg_GameEvent_key_t::mutable_val_string() {
+  std::string* _s = _internal_mutable_val_string();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_GameEvent.key_t.val_string)
+  return _s;
+}
+inline const std::string& CSVCMsg_GameEvent_key_t::_internal_val_string() const {
+  return _impl_.val_string_.Get();
+}
+inline void CSVCMsg_GameEvent_key_t::_internal_set_val_string(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.val_string_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GameEvent_key_t::_internal_mutable_val_string() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.val_string_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GameEvent_key_t::release_val_string() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_GameEvent.key_t.val_string)
+  if (!_internal_has_val_string()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.val_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.val_string_.IsDefault()) {
+    _impl_.val_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_GameEvent_key_t::set_allocated_val_string(std::string* val_string) {
+  if (val_string != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.val_string_.SetAllocated(val_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.val_string_.IsDefault()) {
+    _impl_.val_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_GameEvent.key_t.val_string)
+}
+
+// optional float val_float = 3;
+inline bool CSVCMsg_GameEvent_key_t::_internal_has_val_float() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent_key_t::has_val_float() const {
+  return _internal_has_val_float();
+}
+inline void CSVCMsg_GameEvent_key_t::clear_val_float() {
+  _impl_.val_float_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CSVCMsg_GameEvent_key_t::_internal_val_float() const {
+  return _impl_.val_float_;
+}
+inline float CSVCMsg_GameEvent_key_t::val_float() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.key_t.val_float)
+  return _internal_val_float();
+}
+inline void CSVCMsg_GameEvent_key_t::_internal_set_val_float(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.val_float_ = value;
+}
+inline void CSVCMsg_GameEvent_key_t::set_val_float(float value) {
+  _internal_set_val_float(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.key_t.val_float)
+}
+
+// optional int32 val_long = 4;
+inline bool CSVCMsg_GameEvent_key_t::_internal_has_val_long() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent_key_t::has_val_long() const {
+  return _internal_has_val_long();
+}
+inline void CSVCMsg_GameEvent_key_t::clear_val_long() {
+  _impl_.val_long_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CSVCMsg_GameEvent_key_t::_internal_val_long() const {
+  return _impl_.val_long_;
+}
+inline int32_t CSVCMsg_GameEvent_key_t::val_long() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.key_t.val_long)
+  return _internal_val_long();
+}
+inline void CSVCMsg_GameEvent_key_t::_internal_set_val_long(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.val_long_ = value;
+}
+inline void CSVCMsg_GameEvent_key_t::set_val_long(int32_t value) {
+  _internal_set_val_long(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.key_t.val_long)
+}
+
+// optional int32 val_short = 5;
+inline bool CSVCMsg_GameEvent_key_t::_internal_has_val_short() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent_key_t::has_val_short() const {
+  return _internal_has_val_short();
+}
+inline void CSVCMsg_GameEvent_key_t::clear_val_short() {
+  _impl_.val_short_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t CSVCMsg_GameEvent_key_t::_internal_val_short() const {
+  return _impl_.val_short_;
+}
+inline int32_t CSVCMsg_GameEvent_key_t::val_short() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.key_t.val_short)
+  return _internal_val_short();
+}
+inline void CSVCMsg_GameEvent_key_t::_internal_set_val_short(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.val_short_ = value;
+}
+inline void CSVCMsg_GameEvent_key_t::set_val_short(int32_t value) {
+  _internal_set_val_short(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.key_t.val_short)
+}
+
+// optional int32 val_byte = 6;
+inline bool CSVCMsg_GameEvent_key_t::_internal_has_val_byte() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent_key_t::has_val_byte() const {
+  return _internal_has_val_byte();
+}
+inline void CSVCMsg_GameEvent_key_t::clear_val_byte() {
+  _impl_.val_byte_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline int32_t CSVCMsg_GameEvent_key_t::_internal_val_byte() const {
+  return _impl_.val_byte_;
+}
+inline int32_t CSVCMsg_GameEvent_key_t::val_byte() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.key_t.val_byte)
+  return _internal_val_byte();
+}
+inline void CSVCMsg_GameEvent_key_t::_internal_set_val_byte(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.val_byte_ = value;
+}
+inline void CSVCMsg_GameEvent_key_t::set_val_byte(int32_t value) {
+  _internal_set_val_byte(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.key_t.val_byte)
+}
+
+// optional bool val_bool = 7;
+inline bool CSVCMsg_GameEvent_key_t::_internal_has_val_bool() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent_key_t::has_val_bool() const {
+  return _internal_has_val_bool();
+}
+inline void CSVCMsg_GameEvent_key_t::clear_val_bool() {
+  _impl_.val_bool_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool CSVCMsg_GameEvent_key_t::_internal_val_bool() const {
+  return _impl_.val_bool_;
+}
+inline bool CSVCMsg_GameEvent_key_t::val_bool() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.key_t.val_bool)
+  return _internal_val_bool();
+}
+inline void CSVCMsg_GameEvent_key_t::_internal_set_val_bool(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.val_bool_ = value;
+}
+inline void CSVCMsg_GameEvent_key_t::set_val_bool(bool value) {
+  _internal_set_val_bool(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.key_t.val_bool)
+}
+
+// optional uint64 val_uint64 = 8;
+inline bool CSVCMsg_GameEvent_key_t::_internal_has_val_uint64() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent_key_t::has_val_uint64() const {
+  return _internal_has_val_uint64();
+}
+inline void CSVCMsg_GameEvent_key_t::clear_val_uint64() {
+  _impl_.val_uint64_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t CSVCMsg_GameEvent_key_t::_internal_val_uint64() const {
+  return _impl_.val_uint64_;
+}
+inline uint64_t CSVCMsg_GameEvent_key_t::val_uint64() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.key_t.val_uint64)
+  return _internal_val_uint64();
+}
+inline void CSVCMsg_GameEvent_key_t::_internal_set_val_uint64(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.val_uint64_ = value;
+}
+inline void CSVCMsg_GameEvent_key_t::set_val_uint64(uint64_t value) {
+  _internal_set_val_uint64(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.key_t.val_uint64)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_GameEvent
+
+// optional string event_name = 1;
+inline bool CSVCMsg_GameEvent::_internal_has_event_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent::has_event_name() const {
+  return _internal_has_event_name();
+}
+inline void CSVCMsg_GameEvent::clear_event_name() {
+  _impl_.event_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_GameEvent::event_name() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.event_name)
+  return _internal_event_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_GameEvent::set_event_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.event_name)
+}
+inline std::string* CSVCMsg_GameEvent::mutable_event_name() {
+  std::string* _s = _internal_mutable_event_name();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_GameEvent.event_name)
+  return _s;
+}
+inline const std::string& CSVCMsg_GameEvent::_internal_event_name() const {
+  return _impl_.event_name_.Get();
+}
+inline void CSVCMsg_GameEvent::_internal_set_event_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GameEvent::_internal_mutable_event_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_GameEvent::release_event_name() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_GameEvent.event_name)
+  if (!_internal_has_event_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_name_.IsDefault()) {
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_GameEvent::set_allocated_event_name(std::string* event_name) {
+  if (event_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_name_.SetAllocated(event_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_name_.IsDefault()) {
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_GameEvent.event_name)
+}
+
+// optional int32 eventid = 2;
+inline bool CSVCMsg_GameEvent::_internal_has_eventid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_GameEvent::has_eventid() const {
+  return _internal_has_eventid();
+}
+inline void CSVCMsg_GameEvent::clear_eventid() {
+  _impl_.eventid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_GameEvent::_internal_eventid() const {
+  return _impl_.eventid_;
+}
+inline int32_t CSVCMsg_GameEvent::eventid() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.eventid)
+  return _internal_eventid();
+}
+inline void CSVCMsg_GameEvent::_internal_set_eventid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.eventid_ = value;
+}
+inline void CSVCMsg_GameEvent::set_eventid(int32_t value) {
+  _internal_set_eventid(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_GameEvent.eventid)
+}
+
+// repeated .CSVCMsg_GameEvent.key_t keys = 3;
+inline int CSVCMsg_GameEvent::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int CSVCMsg_GameEvent::keys_size() const {
+  return _internal_keys_size();
+}
+inline void CSVCMsg_GameEvent::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline ::CSVCMsg_GameEvent_key_t* CSVCMsg_GameEvent::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_GameEvent.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEvent_key_t >*
+CSVCMsg_GameEvent::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:CSVCMsg_GameEvent.keys)
+  return &_impl_.keys_;
+}
+inline const ::CSVCMsg_GameEvent_key_t& CSVCMsg_GameEvent::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const ::CSVCMsg_GameEvent_key_t& CSVCMsg_GameEvent::keys(int index) const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_GameEvent.keys)
+  return _internal_keys(index);
+}
+inline ::CSVCMsg_GameEvent_key_t* CSVCMsg_GameEvent::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline ::CSVCMsg_GameEvent_key_t* CSVCMsg_GameEvent::add_keys() {
+  ::CSVCMsg_GameEvent_key_t* _add = _internal_add_keys();
+  // @@protoc_insertion_point(field_add:CSVCMsg_GameEvent.keys)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsg_GameEvent_key_t >&
+CSVCMsg_GameEvent::keys() const {
+  // @@protoc_insertion_point(field_list:CSVCMsg_GameEvent.keys)
+  return _impl_.keys_;
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsgList_GameEvents_event_t
+
+// optional int32 tick = 1;
+inline bool CSVCMsgList_GameEvents_event_t::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsgList_GameEvents_event_t::has_tick() const {
+  return _internal_has_tick();
+}
+inline void CSVCMsgList_GameEvents_event_t::clear_tick() {
+  _impl_.tick_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsgList_GameEvents_event_t::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline int32_t CSVCMsgList_GameEvents_event_t::tick() const {
+  // @@protoc_insertion_point(field_get:CSVCMsgList_GameEvents.event_t.tick)
+  return _internal_tick();
+}
+inline void CSVCMsgList_GameEvents_event_t::_internal_set_tick(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tick_ = value;
+}
+inline void CSVCMsgList_GameEvents_event_t::set_tick(int32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:CSVCMsgList_GameEvents.event_t.tick)
+}
+
+// optional .CSVCMsg_GameEvent event = 2;
+inline bool CSVCMsgList_GameEvents_event_t::_internal_has_event() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.event_ != nullptr);
+  return value;
+}
+inline bool CSVCMsgList_GameEvents_event_t::has_event() const {
+  return _internal_has_event();
+}
+inline void CSVCMsgList_GameEvents_event_t::clear_event() {
+  if (_impl_.event_ != nullptr) _impl_.event_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CSVCMsg_GameEvent& CSVCMsgList_GameEvents_event_t::_internal_event() const {
+  const ::CSVCMsg_GameEvent* p = _impl_.event_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CSVCMsg_GameEvent&>(
+      ::_CSVCMsg_GameEvent_default_instance_);
+}
+inline const ::CSVCMsg_GameEvent& CSVCMsgList_GameEvents_event_t::event() const {
+  // @@protoc_insertion_point(field_get:CSVCMsgList_GameEvents.event_t.event)
+  return _internal_event();
+}
+inline void CSVCMsgList_GameEvents_event_t::unsafe_arena_set_allocated_event(
+    ::CSVCMsg_GameEvent* event) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.event_);
+  }
+  _impl_.event_ = event;
+  if (event) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CSVCMsgList_GameEvents.event_t.event)
+}
+inline ::CSVCMsg_GameEvent* CSVCMsgList_GameEvents_event_t::release_event() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CSVCMsg_GameEvent* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CSVCMsg_GameEvent* CSVCMsgList_GameEvents_event_t::unsafe_arena_release_event() {
+  // @@protoc_insertion_point(field_release:CSVCMsgList_GameEvents.event_t.event)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CSVCMsg_GameEvent* temp = _impl_.event_;
+  _impl_.event_ = nullptr;
+  return temp;
+}
+inline ::CSVCMsg_GameEvent* CSVCMsgList_GameEvents_event_t::_internal_mutable_event() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.event_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CSVCMsg_GameEvent>(GetArenaForAllocation());
+    _impl_.event_ = p;
+  }
+  return _impl_.event_;
+}
+inline ::CSVCMsg_GameEvent* CSVCMsgList_GameEvents_event_t::mutable_event() {
+  ::CSVCMsg_GameEvent* _msg = _internal_mutable_event();
+  // @@protoc_insertion_point(field_mutable:CSVCMsgList_GameEvents.event_t.event)
+  return _msg;
+}
+inline void CSVCMsgList_GameEvents_event_t::set_allocated_event(::CSVCMsg_GameEvent* event) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.event_;
+  }
+  if (event) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(event);
+    if (message_arena != submessage_arena) {
+      event = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, event, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_ = event;
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsgList_GameEvents.event_t.event)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsgList_GameEvents
+
+// repeated .CSVCMsgList_GameEvents.event_t events = 1;
+inline int CSVCMsgList_GameEvents::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int CSVCMsgList_GameEvents::events_size() const {
+  return _internal_events_size();
+}
+inline void CSVCMsgList_GameEvents::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::CSVCMsgList_GameEvents_event_t* CSVCMsgList_GameEvents::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:CSVCMsgList_GameEvents.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_GameEvents_event_t >*
+CSVCMsgList_GameEvents::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:CSVCMsgList_GameEvents.events)
+  return &_impl_.events_;
+}
+inline const ::CSVCMsgList_GameEvents_event_t& CSVCMsgList_GameEvents::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::CSVCMsgList_GameEvents_event_t& CSVCMsgList_GameEvents::events(int index) const {
+  // @@protoc_insertion_point(field_get:CSVCMsgList_GameEvents.events)
+  return _internal_events(index);
+}
+inline ::CSVCMsgList_GameEvents_event_t* CSVCMsgList_GameEvents::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::CSVCMsgList_GameEvents_event_t* CSVCMsgList_GameEvents::add_events() {
+  ::CSVCMsgList_GameEvents_event_t* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:CSVCMsgList_GameEvents.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_GameEvents_event_t >&
+CSVCMsgList_GameEvents::events() const {
+  // @@protoc_insertion_point(field_list:CSVCMsgList_GameEvents.events)
+  return _impl_.events_;
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsg_UserMessage
+
+// optional int32 msg_type = 1;
+inline bool CSVCMsg_UserMessage::_internal_has_msg_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsg_UserMessage::has_msg_type() const {
+  return _internal_has_msg_type();
+}
+inline void CSVCMsg_UserMessage::clear_msg_type() {
+  _impl_.msg_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsg_UserMessage::_internal_msg_type() const {
+  return _impl_.msg_type_;
+}
+inline int32_t CSVCMsg_UserMessage::msg_type() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_UserMessage.msg_type)
+  return _internal_msg_type();
+}
+inline void CSVCMsg_UserMessage::_internal_set_msg_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.msg_type_ = value;
+}
+inline void CSVCMsg_UserMessage::set_msg_type(int32_t value) {
+  _internal_set_msg_type(value);
+  // @@protoc_insertion_point(field_set:CSVCMsg_UserMessage.msg_type)
+}
+
+// optional bytes msg_data = 2;
+inline bool CSVCMsg_UserMessage::_internal_has_msg_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSVCMsg_UserMessage::has_msg_data() const {
+  return _internal_has_msg_data();
+}
+inline void CSVCMsg_UserMessage::clear_msg_data() {
+  _impl_.msg_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSVCMsg_UserMessage::msg_data() const {
+  // @@protoc_insertion_point(field_get:CSVCMsg_UserMessage.msg_data)
+  return _internal_msg_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSVCMsg_UserMessage::set_msg_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.msg_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CSVCMsg_UserMessage.msg_data)
+}
+inline std::string* CSVCMsg_UserMessage::mutable_msg_data() {
+  std::string* _s = _internal_mutable_msg_data();
+  // @@protoc_insertion_point(field_mutable:CSVCMsg_UserMessage.msg_data)
+  return _s;
+}
+inline const std::string& CSVCMsg_UserMessage::_internal_msg_data() const {
+  return _impl_.msg_data_.Get();
+}
+inline void CSVCMsg_UserMessage::_internal_set_msg_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.msg_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_UserMessage::_internal_mutable_msg_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.msg_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSVCMsg_UserMessage::release_msg_data() {
+  // @@protoc_insertion_point(field_release:CSVCMsg_UserMessage.msg_data)
+  if (!_internal_has_msg_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.msg_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_data_.IsDefault()) {
+    _impl_.msg_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSVCMsg_UserMessage::set_allocated_msg_data(std::string* msg_data) {
+  if (msg_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.msg_data_.SetAllocated(msg_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_data_.IsDefault()) {
+    _impl_.msg_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsg_UserMessage.msg_data)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsgList_UserMessages_usermsg_t
+
+// optional int32 tick = 1;
+inline bool CSVCMsgList_UserMessages_usermsg_t::_internal_has_tick() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSVCMsgList_UserMessages_usermsg_t::has_tick() const {
+  return _internal_has_tick();
+}
+inline void CSVCMsgList_UserMessages_usermsg_t::clear_tick() {
+  _impl_.tick_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSVCMsgList_UserMessages_usermsg_t::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline int32_t CSVCMsgList_UserMessages_usermsg_t::tick() const {
+  // @@protoc_insertion_point(field_get:CSVCMsgList_UserMessages.usermsg_t.tick)
+  return _internal_tick();
+}
+inline void CSVCMsgList_UserMessages_usermsg_t::_internal_set_tick(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tick_ = value;
+}
+inline void CSVCMsgList_UserMessages_usermsg_t::set_tick(int32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:CSVCMsgList_UserMessages.usermsg_t.tick)
+}
+
+// optional .CSVCMsg_UserMessage msg = 2;
+inline bool CSVCMsgList_UserMessages_usermsg_t::_internal_has_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.msg_ != nullptr);
+  return value;
+}
+inline bool CSVCMsgList_UserMessages_usermsg_t::has_msg() const {
+  return _internal_has_msg();
+}
+inline void CSVCMsgList_UserMessages_usermsg_t::clear_msg() {
+  if (_impl_.msg_ != nullptr) _impl_.msg_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CSVCMsg_UserMessage& CSVCMsgList_UserMessages_usermsg_t::_internal_msg() const {
+  const ::CSVCMsg_UserMessage* p = _impl_.msg_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CSVCMsg_UserMessage&>(
+      ::_CSVCMsg_UserMessage_default_instance_);
+}
+inline const ::CSVCMsg_UserMessage& CSVCMsgList_UserMessages_usermsg_t::msg() const {
+  // @@protoc_insertion_point(field_get:CSVCMsgList_UserMessages.usermsg_t.msg)
+  return _internal_msg();
+}
+inline void CSVCMsgList_UserMessages_usermsg_t::unsafe_arena_set_allocated_msg(
+    ::CSVCMsg_UserMessage* msg) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.msg_);
+  }
+  _impl_.msg_ = msg;
+  if (msg) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CSVCMsgList_UserMessages.usermsg_t.msg)
+}
+inline ::CSVCMsg_UserMessage* CSVCMsgList_UserMessages_usermsg_t::release_msg() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CSVCMsg_UserMessage* temp = _impl_.msg_;
+  _impl_.msg_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CSVCMsg_UserMessage* CSVCMsgList_UserMessages_usermsg_t::unsafe_arena_release_msg() {
+  // @@protoc_insertion_point(field_release:CSVCMsgList_UserMessages.usermsg_t.msg)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CSVCMsg_UserMessage* temp = _impl_.msg_;
+  _impl_.msg_ = nullptr;
+  return temp;
+}
+inline ::CSVCMsg_UserMessage* CSVCMsgList_UserMessages_usermsg_t::_internal_mutable_msg() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.msg_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CSVCMsg_UserMessage>(GetArenaForAllocation());
+    _impl_.msg_ = p;
+  }
+  return _impl_.msg_;
+}
+inline ::CSVCMsg_UserMessage* CSVCMsgList_UserMessages_usermsg_t::mutable_msg() {
+  ::CSVCMsg_UserMessage* _msg = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:CSVCMsgList_UserMessages.usermsg_t.msg)
+  return _msg;
+}
+inline void CSVCMsgList_UserMessages_usermsg_t::set_allocated_msg(::CSVCMsg_UserMessage* msg) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.msg_;
+  }
+  if (msg) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(msg);
+    if (message_arena != submessage_arena) {
+      msg = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, msg, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.msg_ = msg;
+  // @@protoc_insertion_point(field_set_allocated:CSVCMsgList_UserMessages.usermsg_t.msg)
+}
+
+// -------------------------------------------------------------------
+
+// CSVCMsgList_UserMessages
+
+// repeated .CSVCMsgList_UserMessages.usermsg_t usermsgs = 1;
+inline int CSVCMsgList_UserMessages::_internal_usermsgs_size() const {
+  return _impl_.usermsgs_.size();
+}
+inline int CSVCMsgList_UserMessages::usermsgs_size() const {
+  return _internal_usermsgs_size();
+}
+inline void CSVCMsgList_UserMessages::clear_usermsgs() {
+  _impl_.usermsgs_.Clear();
+}
+inline ::CSVCMsgList_UserMessages_usermsg_t* CSVCMsgList_UserMessages::mutable_usermsgs(int index) {
+  // @@protoc_insertion_point(field_mutable:CSVCMsgList_UserMessages.usermsgs)
+  return _impl_.usermsgs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_UserMessages_usermsg_t >*
+CSVCMsgList_UserMessages::mutable_usermsgs() {
+  // @@protoc_insertion_point(field_mutable_list:CSVCMsgList_UserMessages.usermsgs)
+  return &_impl_.usermsgs_;
+}
+inline const ::CSVCMsgList_UserMessages_usermsg_t& CSVCMsgList_UserMessages::_internal_usermsgs(int index) const {
+  return _impl_.usermsgs_.Get(index);
+}
+inline const ::CSVCMsgList_UserMessages_usermsg_t& CSVCMsgList_UserMessages::usermsgs(int index) const {
+  // @@protoc_insertion_point(field_get:CSVCMsgList_UserMessages.usermsgs)
+  return _internal_usermsgs(index);
+}
+inline ::CSVCMsgList_UserMessages_usermsg_t* CSVCMsgList_UserMessages::_internal_add_usermsgs() {
+  return _impl_.usermsgs_.Add();
+}
+inline ::CSVCMsgList_UserMessages_usermsg_t* CSVCMsgList_UserMessages::add_usermsgs() {
+  ::CSVCMsgList_UserMessages_usermsg_t* _add = _internal_add_usermsgs();
+  // @@protoc_insertion_point(field_add:CSVCMsgList_UserMessages.usermsgs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CSVCMsgList_UserMessages_usermsg_t >&
+CSVCMsgList_UserMessages::usermsgs() const {
+  // @@protoc_insertion_point(field_list:CSVCMsgList_UserMessages.usermsgs)
+  return _impl_.usermsgs_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::SIGNONSTATE> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::SIGNONSTATE>() {
+  return ::SIGNONSTATE_descriptor();
+}
+template <> struct is_proto_enum< ::NET_Messages> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::NET_Messages>() {
+  return ::NET_Messages_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_networkbasetypes_2eproto
@@ -20,19 +20,102 @@
  *    limitations under the License.
  */
 
+#include <algorithm>
+
 #include <alice/demo.pb.h>
 #include <alice/netmessages.pb.h>
 #include <alice/usermessages.pb.h>
 #include <alice/dota_usermessages.pb.h>
 
 #include <alice/bitstream.hpp>
+#include <alice/message_registry.hpp>
 #include <alice/parser.hpp>
 
 #include "event.hpp"
 
 namespace dota {
-    parser::parser(const settings s, dem_stream *stream) : set(s), stream(stream), tick(0), msgs(0), sendtableId(-1),
-        stringtableId(-1), delta(nullptr)
+    void packet_entities::read(const char* data, uint32_t size) {
+        max_entries = 0;
+        updated_entries = 0;
+        is_delta = false;
+        entity_data = nullptr;
+        entity_size = 0;
+
+        const char* end = data + size;
+
+        // reads a varint, making sure it doesn't overflow the message
+        auto varint = [&]() -> uint64_t {
+            uint64_t result = 0;
+            for (uint32_t shift = 0; shift < 64; shift += 7) {
+                if (data == end)
+                    BOOST_THROW_EXCEPTION((handlerParserError()
+                        << EArgT<1, uint32_t>::info(svc_PacketEntities)
+                    ));
+
+                const uint8_t b = *data++;
+                result |= static_cast<uint64_t>(b & 0x7F) << shift;
+
+                if (!(b & 0x80))
+                    return result;
+            }
+
+            BOOST_THROW_EXCEPTION((handlerParserError()
+                << EArgT<1, uint32_t>::info(svc_PacketEntities)
+            ));
+            return result; // just to fix compiler warnings
+        };
+
+        // skips n bytes
+        auto skip = [&](uint64_t n) {
+            if (n > static_cast<uint64_t>(end - data))
+                BOOST_THROW_EXCEPTION((handlerParserError()
+                    << EArgT<1, uint32_t>::info(svc_PacketEntities)
+                ));
+
+            data += n;
+        };
+
+        while (data != end) {
+            const uint64_t key = varint();
+
+            switch (key) {
+                case (1 << 3) | 0: // max_entries
+                    max_entries = static_cast<int32_t>(varint());
+                    break;
+                case (2 << 3) | 0: // updated_entries
+                    updated_entries = static_cast<int32_t>(varint());
+                    break;
+                case (3 << 3) | 0: // is_delta
+                    is_delta = varint() != 0;
+                    break;
+                case (7 << 3) | 2: { // entity_data
+                    const uint64_t n = varint();
+                    entity_data = data;
+                    skip(n);
+                    entity_size = n;
+                } break;
+                default:
+                    // fields we don't need, skip them based on the wire type
+                    switch (key & 7) {
+                        case 0: varint();     break;
+                        case 1: skip(8);      break;
+                        case 2: skip(varint()); break;
+                        case 5: skip(4);      break;
+                        default:
+                            BOOST_THROW_EXCEPTION((handlerParserError()
+                                << EArgT<1, uint32_t>::info(svc_PacketEntities)
+                            ));
+                    }
+                    break;
+            }
+        }
+    }
+
+    parser::parser(const settings s, dem_stream *stream) : set(s), stream(stream), tick(0), msgs(0), skipRevision(0),
+        skipEntities(s.skip_entities), skipUnsubscribed(s.skip_unsubscribed_entities), sendtableId(-1),
+        stringtableId(-1), delta(nullptr), batching(false), batch(), statsEnabled(false), stats(), parseTimer(0), statsNested(0),
+        statsNestedParse(0), statsJson(nullptr), statsWritten(false), coalesce(false),
+        columnStorage(false)
     {
         handlerRegisterCallback((&handler), msgDem, DEM_Packet,       parser, handlePacket)
         handlerRegisterCallback((&handler), msgDem, DEM_SignonPacket, parser, handlePacket)
@@ -72,6 +155,15 @@ namespace dota {
 
         // Get unique / non-unique IDs for all messages
         registerTypes();
+
+        // Skip everything we don't need, only uncompress what is parsed
+        updateSkipped();
+        stream->setLazy(true);
+
+        #if DOTA_ARENA
+        // messages belonging to a packet are released together
+        handler.setArena(&arena);
+        #endif // DOTA_ARENA
     }
 
     parser::~parser() {
@@ -91,6 +183,7 @@ namespace dota {
     void parser::open(std::string path) {
         file = path;
         stream->open(path);
+        statsWritten = false;
 
         // let handlers know we begin to parse
         handler.forward<msgStatus>(REPLAY_START, REPLAY_START, 0);
@@ -101,53 +194,84 @@ namespace dota {
     }
 
     void parser::read() {
+        // Subscriptions changed, check which messages we need
+        if (handler.getRevision() != skipRevision)
+            updateSkipped();
+
         // Read a single message
         //
-        // If forward_dem is set, packages not handled by the parser are skipped because no
-        // one would get them anyway.
-        // This increases the read performance by about 20% for the DEM part.
-        demMessage_t msg = stream->read(!set.forward_dem);
+        // Message types no one is interested in are seeked past by the stream without being
+        // read or uncompressed and are returned without data.
+        demMessage_t msg = stream->read(true);
         ++msgs;
 
+        // last ticks are 0ed
+        const uint32_t next = msg.tick > 0 ? msg.tick : tick;
+
+        // all events of the previous tick are known, forward them while tick still points at it
+        if ((!batch.events.empty() || !coalesced.empty()) && batch.tick != next)
+            flushBatch();
+
         // update current tick
-        if (msg.tick > 0) // last ticks are 0ed
-            tick = msg.tick;
+        tick = next;
+        batch.tick = tick;
 
         // Forward messages via the handler or handle them internaly
-        if (set.forward_dem) {
-            handler.forward<msgDem>(msg.type, std::move(msg), msg.tick);
+        if (msg.msg == nullptr) {
+            // skipped by the stream, nothing to forward
         } else {
-            #ifndef _MSC_VER
-            switch (msg.type) {
-                case DEM_ClassInfo: {
-                    if (set.parse_entities) {
-                        auto cb = handler.retrieve<msgDem::id>(msg.type, std::move(msg), msg.tick);
-                        handleClasses(&cb);
-                        cb.free();
-                    }
-                } break;
-                case DEM_SignonPacket:
-                case DEM_Packet: {
-                    auto cb = handler.retrieve<msgDem::id>(msg.type, std::move(msg), msg.tick);
-                    handlePacket(&cb);
-                    cb.free();
-                } break;
-                case DEM_SendTables: {
-                    if (set.parse_entities) {
-                        auto cb = handler.retrieve<msgDem::id>(msg.type, std::move(msg), msg.tick);
-                        handleSendTables(&cb);
-                        cb.free();
+            // statistics account for the uncompressed size
+            if (statsEnabled)
+                msg.decompress();
+
+            const uint32_t type = msg.type;
+            const uint64_t bytes = msg.size;
+            const uint64_t compressed = msg.compressedSize;
+
+            measure(stats.dem, type, bytes, compressed, [&]() {
+                if (set.forward_dem) {
+                    handler.forward<msgDem>(msg.type, std::move(msg), msg.tick);
+                } else {
+                    #ifndef _MSC_VER
+                    switch (msg.type) {
+                        case DEM_ClassInfo: {
+                            if (set.parse_entities) {
+                                auto cb = handler.retrieve<msgDem::id>(msg.type, std::move(msg), msg.tick);
+                                handleClasses(&cb);
+                                cb.free();
+                            }
+                        } break;
+                        case DEM_SignonPacket:
+                        case DEM_Packet: {
+                            auto cb = handler.retrieve<msgDem::id>(msg.type, std::move(msg), msg.tick);
+                            handlePacket(&cb);
+                            cb.free();
+                        } break;
+                        case DEM_SendTables: {
+                            if (set.parse_entities) {
+                                auto cb = handler.retrieve<msgDem::id>(msg.type, std::move(msg), msg.tick);
+                                handleSendTables(&cb);
+                                cb.free();
+                            }
+                        } break;
                     }
-                } break;
-            }
-            #else // _MSC_VER
-                handler.forward<msgDem>(msg.type, std::move(msg), msg.tick);
-            #endif // _MSC_VER
+                    #else // _MSC_VER
+                        handler.forward<msgDem>(msg.type, std::move(msg), msg.tick);
+                    #endif // _MSC_VER
+                }
+            });
         }
 
+        #if DOTA_ARENA
+        // release all messages created for this one in bulk, batched ones are kept until the tick is done
+        if (batch.events.empty())
+            arena.Reset();
+        #endif // DOTA_ARENA
+
         if (!stream->good()) {
             D_( std::cout << "[parser] Reached end of replay " << D_FILE << " " << __LINE__ << std::endl;, 1 )
-            handler.forward<msgStatus>(REPLAY_FINISH, REPLAY_FINISH, tick);
+            flushBatch();
+            finish();
         }
     }
 
@@ -159,24 +283,232 @@ namespace dota {
 
         // let handlers know we are done
         D_( std::cout << "[parser] Reached end of replay " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+        flushBatch();
+        finish();
+    }
+
+    void parser::enableStats(std::ostream* json) {
+        statsEnabled = true;
+        statsJson = json;
+        handler.setParseTimer(&parseTimer);
+    }
+
+    void parser::finish() {
+        if (statsJson && !statsWritten) {
+            *statsJson << stats.toJson() << std::endl;
+            statsWritten = true;
+        }
+
         handler.forward<msgStatus>(REPLAY_FINISH, REPLAY_FINISH, tick);
     }
 
+    void parser::updateSkipped() {
+        // Net messages are only read if someone is interested in them
+        const bool net = set.parse_entities || set.parse_stringtables || set.parse_events || set.forward_user
+            || set.forward_net || set.forward_net_internal;
+
+        uint32_t mask = 0;
+        for (uint32_t t = 0; t < DEM_Max; ++t) {
+            bool needed = false;
+
+            switch (t) {
+                case DEM_Packet:
+                case DEM_SignonPacket:
+                    // handlePacket is always registered, everything else has been added by the user
+                    needed = net || (set.forward_dem && handler.countCallbacks<msgDem>(t) > 1);
+                    break;
+                case DEM_ClassInfo:
+                case DEM_SendTables:
+                    needed = set.parse_entities || (set.forward_dem && handler.hasCallback<msgDem>(t));
+                    break;
+                default:
+                    needed = set.forward_dem && handler.hasCallback<msgDem>(t);
+                    break;
+            }
+
+            if (!needed)
+                mask |= (1 << t);
+        }
+
+        D_( std::cout << "[parser] Skipping message types " << std::hex << mask << std::dec << " " << D_FILE << " " << __LINE__ << std::endl;, 1 )
+
+        stream->setSkipped(mask);
+        skipRevision = handler.getRevision();
+
+        // entity subscriptions might have changed
+        updateSkippedClasses();
+
+        // collect events for tick subscribers
+        batching = handler.hasCallback<msgTick>(0);
+    }
+
+    void parser::flushBatch() {
+        // deferred entities are part of the batch
+        flushEntities();
+
+        if (batch.events.empty())
+            return;
+
+        handler.forward<msgTick>(0, &batch, batch.tick);
+
+        // return heap allocated messages to their pool
+        for (auto &e : batch.events) {
+            if (e.release != nullptr)
+                e.release->push_back(e.msg);
+        }
+
+        batch.events.clear();
+        batch.fields.clear();
+
+        #if DOTA_ARENA
+        arena.Reset();
+        #endif // DOTA_ARENA
+    }
+
+    void parser::collectEntity(entity &ent) {
+        batch.events.push_back(tick_event{
+            msgEntity::id, ent.getClassId(), nullptr, nullptr, ent.getId(), ent.getState(), 0, 0
+        });
+    }
+
+    void parser::setCoalesceEntities(bool enable) {
+        // pending notifications are forwarded as usual
+        if (!enable)
+            flushEntities();
+
+        coalesce = enable;
+
+        if (coalesce && coalescedState.empty()) {
+            coalescedState.resize(DOTA_MAX_ENTITIES, entity::state_default);
+            coalescedFields.resize(DOTA_MAX_ENTITIES);
+        }
+    }
+
+    void parser::notifyEntity(entity &ent) {
+        if (!coalesce) {
+            if (batching)
+                collectEntity(ent);
+
+            handler.forward<msgEntity>(ent.getClassId(), &ent, 0);
+            return;
+        }
+
+        const uint32_t id = ent.getId();
+
+        // keep the first state, a created entity stays created when updated in the same tick
+        if (coalescedState[id] == entity::state_default) {
+            coalescedState[id] = ent.getState();
+            coalesced.push_back(id);
+        }
+
+        if (set.track_entities) {
+            std::vector<uint32_t> &fields = coalescedFields[id];
+            fields.insert(fields.end(), delta->entity_fields.begin(), delta->entity_fields.end());
+        }
+    }
+
+    void parser::flushEntity(uint32_t id) {
+        if (coalescedState.empty() || coalescedState[id] == entity::state_default)
+            return;
+
+        entity &ent = entities[id];
+        ent.setState(coalescedState[id]);
+        coalescedState[id] = entity::state_default;
+
+        if (batching)
+            collectEntity(ent);
+
+        handler.forward<msgEntity>(ent.getClassId(), &ent, 0);
+
+        if (set.track_entities) {
+            std::vector<uint32_t> &fields = coalescedFields[id];
+            std::sort(fields.begin(), fields.end());
+            fields.erase(std::unique(fields.begin(), fields.end()), fields.end());
+
+            delta->entity_id = id;
+            delta->entity_fields.swap(fields);
+
+            if (batching)
+                collectDelta(ent);
+
+            handler.forward<msgEntityDelta>(ent.getClassId(), delta, 0);
+
+            // keeps the capacity for the next tick
+            delta->entity_fields.swap(fields);
+            fields.clear();
+        }
+    }
+
+    void parser::flushEntities() {
+        for (uint32_t id : coalesced) {
+            flushEntity(id);
+        }
+
+        coalesced.clear();
+    }
+
+    void parser::setSkipEntities(std::set<uint32_t> classes) {
+        skipEntities = std::move(classes);
+        updateSkippedClasses();
+    }
+
+    void parser::setEntitySkipped(uint32_t classId, bool skip) {
+        if (skip) {
+            skipEntities.insert(classId);
+        } else {
+            skipEntities.erase(classId);
+        }
+
+        updateSkippedClasses();
+    }
+
+    void parser::setSkipUnsubscribedEntities(bool skip) {
+        skipUnsubscribed = skip;
+        updateSkippedClasses();
+    }
+
+    void parser::updateSkippedClasses() {
+        skippedClasses.assign(clist.size(), false);
+
+        for (uint32_t i = 0; i < skippedClasses.size(); ++i) {
+            skippedClasses[i] = isClassSkipped(i);
+        }
+    }
+
+    void parser::collectDelta(entity &ent) {
+        const uint32_t begin = batch.fields.size();
+        batch.fields.insert(batch.fields.end(), delta->entity_fields.begin(), delta->entity_fields.end());
+
+        batch.events.push_back(tick_event{
+            msgEntityDelta::id, ent.getClassId(), nullptr, nullptr, delta->entity_id, ent.getState(),
+            begin, static_cast<uint32_t>(batch.fields.size())
+        });
+    }
+
     void parser::skipTo(uint32_t second) {
-        uint32_t min = second/60;
-        int32_t sec = second%60;
+        const uint32_t target = second * DOTA_TICKRATE;
 
         // make sure we have a valid state before skipping ahead / back
         while (tick < 30) {
             read();
         }
 
+        // events collected so far belong to the old position
+        flushBatch();
+
         // clear all entities
         entities.clear();
         entities.resize(DOTA_MAX_ENTITIES);
 
-        // skip to the fullpacket
-        stream->move(min);
+        for (auto &table : columns) {
+            if (table)
+                table->clear();
+        }
+
+        std::fill(columnRows.begin(), columnRows.end(), -1);
+
+        // skip to the last fullpacket before the target
+        stream->moveTick(target);
 
         // get the next full package in the stram
         demMessage_t msg;
@@ -186,6 +518,7 @@ namespace dota {
 
         // parse it
         CDemoFullPacket p;
+        msg.decompress();
         p.ParseFromArray(msg.msg, msg.size);
 
         for (auto &tbl : p.string_table().tables()) {
@@ -202,12 +535,22 @@ namespace dota {
             }
         }
 
+        clearBaselines();
+
+        tick = msg.tick;
+        batch.tick = tick;
+
         // forward packets
         const std::string &data = p.packet().data();
         forwardMessageContainer<msgNet>(data.c_str(), data.size(), msg.tick);
 
-        // asume 1 tick 2 / secs
-        for (; sec > 0; sec -= 2) {
+        #if DOTA_ARENA
+        if (batch.events.empty())
+            arena.Reset();
+        #endif // DOTA_ARENA
+
+        // read up to the target
+        while (tick < target && good()) {
             read();
         }
     }
@@ -315,6 +658,7 @@ namespace dota {
         }
 
         flattenSendtables();
+        updateSkippedClasses();
         handler.forward<msgStatus>(REPLAY_FLATTABLES, REPLAY_FLATTABLES, msg->tick);
     }
 
@@ -340,7 +684,12 @@ namespace dota {
         uint32_t type = static_cast<uint32_t>(m->msg_type());
 
         // forward as user message
-        handler.forward<msgUser>(type, demMessage_t{0, msg->tick, type, data.c_str(), data.size()}, msg->tick);
+        measure(stats.user, type, data.size(), 0, [&]() {
+            if (batching)
+                collect<msgUser>(type, demMessage_t{0, msg->tick, type, data.c_str(), data.size()});
+            else
+                handler.forward<msgUser>(type, demMessage_t{0, msg->tick, type, data.c_str(), data.size()}, msg->tick);
+        });
     }
 
     void parser::handleServerInfo(handlerCbType(msgNet) msg) {
@@ -381,6 +730,9 @@ namespace dota {
         // add table to table list
         D_( std::cout << "[parser] Creating stringtable " << m->name() << " " << D_FILE << " " << __LINE__ << std::endl;, 1 )
         stringtables.insert(stringtableMap::entry_type{m->name(), tableid, stringtable(m)});
+
+        if (m->name() == BASELINETABLE)
+            clearBaselines();
     }
 
     void parser::handleUpdateStringtable(handlerCbType(msgNet) msg) {
@@ -393,6 +745,9 @@ namespace dota {
 
         D_( std::cout << "[parser] Updating stringtable " << it->value.getName() << " " << D_FILE << " " << __LINE__ << std::endl;, 3 )
         it->value.update(m);
+
+        if (it->value.getName() == BASELINETABLE)
+            clearBaselines();
     }
 
     void parser::handleEventList(handlerCbType(msgNet) msg) {
@@ -419,20 +774,36 @@ namespace dota {
         // get classid
         uint32_t eId = e.getClassId();
 
+        // precomputed whenever subscriptions or the skip settings change
+        if (eId < skippedClasses.size())
+            return skippedClasses[eId];
+
+        return isClassSkipped(eId);
+    }
+
+    bool parser::isClassSkipped(uint32_t eId) {
         // check if the entity is skipped because there is no handler
-        bool skipU = (set.skip_unsubscribed_entities && !handler.hasCallback<msgEntity>(eId));
+        bool skipU = (skipUnsubscribed && !handler.hasCallback<msgEntity>(eId));
         if (skipU) return true;
 
         // check to skip if entity is in the ignore set
-        bool skipE = set.skip_entities.empty() ? false : set.skip_entities.count(eId);
+        bool skipE = skipEntities.empty() ? false : skipEntities.count(eId);
         if (skipE) return true;
 
         return false;
     }
 
     void parser::handleEntity(handlerCbType(msgNet) msg) {
-        CSVCMsg_PacketEntities* e = msg->get<CSVCMsg_PacketEntities>(); // get entity
-        bitstream stream(e->entity_data()); // bistream from the entity data
+        CSVCMsg_PacketEntities* m = msg->get<CSVCMsg_PacketEntities>();
+        const std::string &data = m->entity_data();
+
+        handleEntity(packet_entities{
+            m->max_entries(), m->updated_entries(), m->is_delta(), data.c_str(), static_cast<uint32_t>(data.size())
+        });
+    }
+
+    void parser::handleEntity(const packet_entities &e) {
+        bitstream stream(e.entity_data, e.entity_size); // bistream from the entity data
 
         uint32_t eId = -1;          // Entity ID
         entity::state_type eType;   // Entity update Type (create, update, delete)
@@ -444,7 +815,7 @@ namespace dota {
 
         const stringtable &baseline = it->value;
 
-        for (int32_t i = 0; i < e->updated_entries(); ++i) {
+        for (int32_t i = 0; i < e.updated_entries; ++i) {
             // read update type and id from header
             entity::readHeader(eId, stream, eType);
 
@@ -466,6 +837,10 @@ namespace dota {
                     const entity_list::value_type &eClass = clist.get(classId);
                     const flatsendtable &f = getFlattable(classId);
 
+                    // pending notifications and the column row belong to the previous entity
+                    flushEntity(eId);
+                    releaseColumnRow(eId);
+
                     if (!ent.isInitialized()) {
                         // create the entity
                         entities[eId] = entity(eId, eClass, f);
@@ -477,14 +852,19 @@ namespace dota {
 
                     if (isSkipped(ent)) {
                         ent.skip(stream);
+                    } else if (columnStorage) {
+                        // read updates from baseline and current data into the class columns
+                        createColumnRow(ent, baseline);
+                        columns[classId]->update(columnRows[eId], stream, delta);
+
+                        notifyEntity(ent);
                     } else {
                         // read updates from baseline and current data
-                        bitstream baselineStream(baseline.get(std::to_string(classId)));
-                        ent.updateFromBitstream(baselineStream);
+                        applyBaseline(ent, baseline);
                         ent.updateFromBitstream(stream, delta);
 
                         // forward to handler
-                        handler.forward<msgEntity>(ent.getClassId(), &ent, 0);
+                        notifyEntity(ent);
                     }
                 } break;
                 // entity is being updated
@@ -493,9 +873,17 @@ namespace dota {
                         if (isSkipped(ent)) {
                             ent.skip(stream);
                         } else {
-                            ent.updateFromBitstream(stream, delta);
+                            const uint32_t row = getColumnRow(eId);
+
+                            if (row != (uint32_t)-1) {
+                                columns[ent.getClassId()]->update(row, stream, delta);
+                            } else {
+                                ent.updateFromBitstream(stream, delta);
+                            }
+
                             ent.setState(entity::state_updated);
-                            handler.forward<msgEntity>(ent.getClassId(), &ent, 0);
+
+                            notifyEntity(ent);
                         }
                     } else {
                         BOOST_THROW_EXCEPTION( aliceInvalidId()
@@ -506,11 +894,18 @@ namespace dota {
                 // entity is being deleted
                 case entity::state_deleted: {
                     if (ent.isInitialized()) {
+                        flushEntity(eId);
+
                         if (!isSkipped(ent)) {
                             ent.setState(entity::state_deleted);
+
+                            if (batching)
+                                collectEntity(ent);
+
                             handler.forward<msgEntity>(ent.getClassId(), &ent, 0);
                         }
 
+                        releaseColumnRow(eId);
                         entities.at(eId) = entity();
                     } else {
                         BOOST_THROW_EXCEPTION( aliceInvalidId()
@@ -523,33 +918,138 @@ namespace dota {
                     break;
             }
 
-            // forward entity delta?
-            if (set.track_entities) {
+            // forward entity delta? deferred together with the entity when coalescing
+            if (set.track_entities && !coalesce) {
                 if (ent.isInitialized()) {
                     delta->entity_id = eId;
+
+                    if (batching)
+                        collectDelta(ent);
+
                     handler.forward<msgEntityDelta>(ent.getClassId(), delta, 0);
                 }
             }
         }
 
         // all entities in list are marked as removed
-        if (e->is_delta()) {
+        if (e.is_delta) {
             while (stream.read(1)) {
                 eId = stream.read(11);
 
                 entity& ent = entities[eId];
                 if (ent.isInitialized()) {
+                    flushEntity(eId);
+
                     if (!isSkipped(ent)) {
                         ent.setState(entity::state_deleted);
+
+                        if (batching)
+                            collectEntity(ent);
+
                         handler.forward<msgEntity>(ent.getClassId(), &ent, 0);
                     }
 
+                    releaseColumnRow(eId);
                     entities[eId] = entity();
                 }
             }
         }
     }
 
+    const entity::map_type& parser::getBaseline(entity &ent, const stringtable &baseline) {
+        const uint32_t classId = ent.getClassId();
+        if (baselines.size() <= classId) {
+            baselines.resize(classId + 1);
+            baselineFields.resize(classId + 1);
+        }
+
+        entity::map_type &props = baselines[classId];
+
+        if (props.empty()) {
+            D_( std::cout << "[parser] Decoding baseline for class " << classId << " " << D_FILE << " " << __LINE__ << std::endl;, 3 )
+
+            // decode into an empty entity, the delta tells us which fields the baseline sets
+            entity decoded(ent.getId(), *ent.getClass(), *ent.getRecvTable());
+            entity_delta fields;
+
+            bitstream baselineStream(baseline.get(std::to_string(classId)));
+            decoded.updateFromBitstream(baselineStream, &fields);
+
+            props = std::move(decoded.getProperties());
+            baselineFields[classId] = std::move(fields.entity_fields);
+        }
+
+        return props;
+    }
+
+    void parser::applyBaseline(entity &ent, const stringtable &baseline) {
+        const entity::map_type &props = getBaseline(ent, baseline);
+        const uint32_t classId = ent.getClassId();
+        entity::map_type &properties = ent.getProperties();
+
+        if (properties.size() != props.size()) {
+            properties = props;
+            return;
+        }
+
+        // only overwrite what the baseline sets, an overwritten entity keeps the rest
+        for (auto &it : baselineFields[classId]) {
+            properties[it] = props[it];
+        }
+    }
+
+    void parser::createColumnRow(entity &ent, const stringtable &baseline) {
+        const uint32_t classId = ent.getClassId();
+        if (columns.size() <= classId)
+            columns.resize(classId + 1);
+
+        if (!columns[classId])
+            columns[classId].reset(new column_table(*ent.getRecvTable()));
+
+        column_table &table = *columns[classId];
+        const uint32_t row = table.allocate(ent.getId());
+        columnRows[ent.getId()] = row;
+
+        const entity::map_type &props = getBaseline(ent, baseline);
+        for (auto &it : baselineFields[classId]) {
+            table.set(row, it, props[it]);
+        }
+    }
+
+    void parser::releaseColumnRow(uint32_t id) {
+        if (columnRows.empty() || columnRows[id] == (uint32_t)-1)
+            return;
+
+        columns[entities[id].getClassId()]->release(columnRows[id]);
+        columnRows[id] = -1;
+    }
+
+    void parser::setColumnStorage(bool enable) {
+        columnStorage = enable;
+
+        if (columnStorage && columnRows.empty())
+            columnRows.resize(DOTA_MAX_ENTITIES, -1);
+    }
+
+    column_table* parser::getColumns(uint32_t classId) {
+        if (classId >= columns.size())
+            return nullptr;
+
+        return columns[classId].get();
+    }
+
+    uint32_t parser::getColumnRow(uint32_t entityId) {
+        if (entityId >= columnRows.size())
+            return -1;
+
+        return columnRows[entityId];
+    }
+
+    void parser::clearBaselines() {
+        baselines.clear();
+        baselineFields.clear();
+    }
+
     void parser::flattenSendtables() {
         // Tieing dependend properties
         for (auto it = sendtables.beginIndex(); it != sendtables.endIndex(); ++it) {
@@ -601,8 +1101,26 @@ namespace dota {
             }
 
             // insert stuff into flat table
-            flattables.push_back(flatsendtable{table.key, std::move(props)});
+            flatsendtable flat{table.key, std::move(props), {}, {}};
+
+            // compile decoders so entities don't need to resolve flags when reading
+            flat.plan.reserve(flat.properties.size());
+            for (auto &p : flat.properties) {
+                flat.plan.push_back(decode_op::compile(p.prop));
+            }
+
+            // name index used by all entities of this class
+            for (uint32_t i = 0; i < flat.properties.size(); ++i) {
+                flat.index[flat.properties[i].name] = i;
+            }
+
+            flattables.push_back(std::move(flat));
         }
+
+        // decoded baselines and column tables point into the old flattables
+        clearBaselines();
+        columns.clear();
+        std::fill(columnRows.begin(), columnRows.end(), -1);
     }
 
     void parser::buildExcludeList(const sendtable &tbl, std::set<std::string> &excludes) {
@@ -672,165 +1190,13 @@ namespace dota {
     void parser::registerTypes() {
         D_( std::cout << "[parser] Registering packet types " << D_FILE << " " << __LINE__ << std::endl;, 1 )
 
-        #define regDem( _type ) handlerRegisterObject((&handler), msgDem, DEM_ ## _type, CDemo ## _type)
-        #define regNet( _type ) handlerRegisterObject((&handler), msgNet, net_ ## _type, CNETMsg_ ## _type)
-        #define regSvc( _type ) handlerRegisterObject((&handler), msgNet, svc_ ## _type, CSVCMsg_ ## _type)
-        #define regUsr( _type ) handlerRegisterObject((&handler), msgUser, UM_ ## _type, CUserMsg_ ## _type)
-        #define regUsrDota( _type ) handlerRegisterObject((&handler), msgUser, DOTA_UM_ ## _type, CDOTAUserMsg_ ## _type)
-
-        regDem( FileHeader )                                         // 1
-        regDem( FileInfo )                                           // 2
-        regDem( SyncTick )                                           // 3
-        regDem( SendTables )                                         // 4
-        regDem( ClassInfo )                                          // 5
-        regDem( StringTables )                                       // 6
-        regDem( Packet )                                             // 7
-        handlerRegisterObject((&handler), msgDem, DEM_SignonPacket, CDemoPacket) // 8
-        regDem( ConsoleCmd )                                         // 9
-        regDem( CustomData )                                         // 10
-        regDem( CustomDataCallbacks )                                // 11
-        regDem( UserCmd )                                            // 12
-        regDem( FullPacket )                                         // 13
-        regDem( SaveGame )                                           // 14
-
-        regNet( NOP )               // 0
-        regNet( Disconnect )        // 1
-        regNet( File )              // 2
-        regNet( SplitScreenUser )   // 3
-        regNet( Tick )              // 4
-        regNet( StringCmd )         // 5
-        regNet( SetConVar )         // 6
-        regNet( SignonState )       // 7
-        regSvc( ServerInfo )        // 8
-        regSvc( SendTable )         // 9
-        regSvc( ClassInfo )         // 10
-        regSvc( SetPause )          // 11
-        regSvc( CreateStringTable ) // 12
-        regSvc( UpdateStringTable ) // 13
-        regSvc( VoiceInit )         // 14
-        regSvc( VoiceData )         // 15
-        regSvc( Print )             // 16
-        regSvc( Sounds )            // 17
-        regSvc( SetView )           // 18
-        regSvc( FixAngle )          // 19
-        regSvc( CrosshairAngle )    // 20
-        regSvc( BSPDecal )          // 21
-        regSvc( SplitScreen )       // 22
-        regSvc( UserMessage )       // 23
-        regSvc( GameEvent )         // 25
-        regSvc( PacketEntities )    // 26
-        regSvc( TempEntities )      // 27
-        regSvc( Prefetch )          // 28
-        regSvc( Menu )              // 29
-        regSvc( GameEventList )     // 30
-        regSvc( GetCvarValue )      // 31
-        regSvc( PacketReliable )    // 32
-        regSvc( FullFrameSplit )    // 33
-
-        regUsr( AchievementEvent )  // 1
-        regUsr( CloseCaption )      // 2
-        regUsr( CurrentTimescale )  // 4
-        regUsr( DesiredTimescale )  // 5
-        regUsr( Fade )              // 6
-        regUsr( GameTitle )         // 7
-        regUsr( Geiger )            // 8
-        regUsr( HintText )          // 9
-        regUsr( HudMsg )            // 10
-        regUsr( HudText )           // 11
-        regUsr( KeyHintText )       // 12
-        regUsr( MessageText )       // 13
-        regUsr( RequestState )      // 14
-        regUsr( ResetHUD )          // 15
-        regUsr( Rumble )            // 16
-        regUsr( SayText )           // 17
-        regUsr( SayText2 )          // 18
-        regUsr( SayTextChannel )    // 19
-        regUsr( Shake )             // 20
-        regUsr( ShakeDir )          // 21
-        regUsr( StatsCrawlMsg )     // 22
-        regUsr( StatsSkipState )    // 23
-        regUsr( TextMsg )           // 24
-        regUsr( Tilt )              // 25
-        regUsr( Train )             // 26
-        regUsr( VGUIMenu )          // 27
-        regUsr( VoiceMask )         // 28
-        regUsr( VoiceSubtitle )     // 29
-        regUsr( SendAudio )         // 30
-        regUsr( CameraTransition )  // 31
-
-        //regUsrDota( AddUnitToSelection )      // 64
-        regUsrDota( AIDebugLine )               // 65
-        regUsrDota( ChatEvent )                 // 66
-        regUsrDota( CombatHeroPositions )       // 67
-        //regUsrDota( CombatLogData )             // 68
-        regUsrDota( CombatLogShowDeath )        // 70
-        regUsrDota( CreateLinearProjectile )    // 71
-        regUsrDota( DestroyLinearProjectile )   // 72
-        regUsrDota( DodgeTrackingProjectiles )  // 73
-        regUsrDota( GlobalLightColor )          // 74
-        regUsrDota( GlobalLightDirection )      // 75
-        regUsrDota( InvalidCommand )            // 76
-        regUsrDota( LocationPing )              // 77
-        regUsrDota( MapLine )                   // 78
-        regUsrDota( MiniKillCamInfo )           // 79
-        regUsrDota( MinimapDebugPoint )         // 80
-        regUsrDota( MinimapEvent )              // 81
-        regUsrDota( NevermoreRequiem )          // 82
-        regUsrDota( OverheadEvent )             // 83
-        regUsrDota( SetNextAutobuyItem )        // 84
-        regUsrDota( SharedCooldown )            // 85
-        regUsrDota( SpectatorPlayerClick )      // 86
-        regUsrDota( TutorialTipInfo )           // 87
-        regUsrDota( UnitEvent )                 // 88
-        regUsrDota( ParticleManager )           // 89
-        regUsrDota( BotChat )                   // 90
-        regUsrDota( HudError )                  // 91
-        regUsrDota( ItemPurchased )             // 92
-        regUsrDota( Ping )                      // 93
-        regUsrDota( ItemFound )                 // 94
-        //regUsrDota( CharacterSpeakConcept )   // 95
-        regUsrDota( SwapVerify )                // 96
-        regUsrDota( WorldLine )                 // 97
-        //regUsrDota( TournamentDrop )            // 98
-        regUsrDota( ItemAlert )                 // 99
-        regUsrDota( HalloweenDrops )            // 100
-        regUsrDota( ChatWheel )                 // 101
-        regUsrDota( ReceivedXmasGift )          // 102
-        regUsrDota( UpdateSharedContent )       // 103
-        regUsrDota( TutorialRequestExp )        // 104
-        regUsrDota( TutorialPingMinimap )       // 105
-        handlerRegisterObject((&handler), msgUser, DOTA_UM_GamerulesStateChanged, CDOTA_UM_GamerulesStateChanged) // 106
-        regUsrDota( ShowSurvey )                // 107
-        regUsrDota( TutorialFade )              // 108
-        regUsrDota( AddQuestLogEntry )          // 109
-        regUsrDota( SendStatPopup )             // 110
-        regUsrDota( TutorialFinish )            // 111
-        regUsrDota( SendRoshanPopup )           // 112
-        regUsrDota( SendGenericToolTip )        // 113
-        regUsrDota( SendFinalGold )             // 114
-        regUsrDota( CustomMsg )                 // 115
-        regUsrDota( CoachHUDPing )              // 116
-        regUsrDota( ClientLoadGridNav )         // 117
-        regUsrDota( AbilityPing )               // 118
-        regUsrDota( ShowGenericPopup )          // 119
-        regUsrDota( VoteStart )                 // 120
-        regUsrDota( VoteUpdate )                // 121
-        regUsrDota( VoteEnd )                   // 122
-        regUsrDota( BoosterState )              // 123
-        regUsrDota( WillPurchaseAlert )         // 124
-        regUsrDota( TutorialMinimapPosition )   // 125
-        regUsrDota( PlayerMMR )                 // 126
-        regUsrDota( AbilitySteal )              // 127
-        regUsrDota( CourierKilledAlert )        // 128
-        regUsrDota( EnemyItemAlert )            // 129
-        regUsrDota( StatsMatchDetails )         // 130
-        regUsrDota( MiniTaunt )                 // 131
-        regUsrDota( BuyBackStateAlert )         // 132
-
-        #undef regDem
-        #undef regNet
-        #undef regSvc
-        #undef regUsr
-        #undef regUsrDota
+        #define regMsg( _type, _id, _object ) handlerRegisterObject((&handler), _type, _id, _object)
+
+        DOTA_MESSAGES( regMsg )
+
+        // shares its type with DEM_Packet
+        handlerRegisterObject((&handler), msgDem, DEM_SignonPacket, CDemoPacket)
+
+        #undef regMsg
     }
 }
\ No newline at end of file
@@ -23,8 +23,16 @@
 #ifndef _ALICE_PARSER_HPP_
 #define _ALICE_PARSER_HPP_
 
+/// Number of ticks per second of replay time
+#define DOTA_TICKRATE 30
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <set>
 #include <string>
 
+#include <alice/columns.hpp>
 #include <alice/dem.hpp>
 #include <alice/entity.hpp>
 #include <alice/event.hpp>
@@ -33,6 +41,8 @@
 #include <alice/sendtable.hpp>
 #include <alice/stringtable.hpp>
 #include <alice/settings.hpp>
+#include <alice/stats.hpp>
+#include <alice/tick_batch.hpp>
 
 namespace dota {
     /// @defgroup EXCEPTIONS Exceptions
@@ -54,6 +64,27 @@ namespace dota {
     /// @defgroup CORE Core
     /// @{
 
+    /**
+     * Fields of a CSVCMsg_PacketEntities message required to update entities.
+     *
+     * Read directly from the wire format, entity_data points into the message.
+     */
+    struct packet_entities {
+        /** Maximum number of entries */
+        int32_t max_entries;
+        /** Number of entities updated */
+        int32_t updated_entries;
+        /** Whether this is a delta update */
+        bool is_delta;
+        /** Start of the entity bitstream */
+        const char* entity_data;
+        /** Size of the entity bitstream in bytes */
+        uint32_t entity_size;
+
+        /** Reads the fields from the wire format, unknown fields are skipped */
+        void read(const char* data, uint32_t size);
+    };
+
     class parser {
         public:
              /** Type for a map of stringtables. */
@@ -83,7 +114,7 @@ namespace dota {
             /** Parse and handle all messages in the replay */
             void handle();
 
-            /** Skip to the desired second in the replay */
+            /** Skip to the desired second in the replay, counted from tick 0 */
             void skipTo(uint32_t second);
 
             /** Returns pointer to handler, pointer is tied to lifetime of this object */
@@ -122,6 +153,61 @@ namespace dota {
             uint32_t getMsgCount() {
                 return msgs;
             }
+
+            /**
+             * Collect parse statistics per message type.
+             *
+             * If json is set, the statistics are written to it when the replay is finished.
+             */
+            void enableStats(std::ostream* json = nullptr);
+
+            /** Returns the statistics collected so far */
+            const parse_stats& getStats() {
+                return stats;
+            }
+
+            /**
+             * Defer entity notifications to the end of the tick.
+             *
+             * Each entity created or updated during a tick is forwarded once, with the state it had
+             * when it was first touched. Deltas contain the union of all fields updated during the
+             * tick. Deletions are forwarded right away.
+             */
+            void setCoalesceEntities(bool enable);
+
+            /**
+             * Replaces the entity classes to always skip.
+             *
+             * Takes effect with the next entity update. Entities of a class that was skipped
+             * before are incomplete until they are created again.
+             */
+            void setSkipEntities(std::set<uint32_t> classes);
+
+            /** Adds or removes a single entity class from the classes to always skip */
+            void setEntitySkipped(uint32_t classId, bool skip);
+
+            /** Sets whether entity classes without subscribers are skipped */
+            void setSkipUnsubscribedEntities(bool skip);
+
+            /** Returns the entity classes currently skipped regardless of subscriptions */
+            const std::set<uint32_t>& getSkipEntities() {
+                return skipEntities;
+            }
+
+            /**
+             * Stores the properties of entities created from now on in a column table per class.
+             *
+             * Entities forwarded to subscribers don't contain any properties in this case, their
+             * values are read through getColumns() and getColumnRow(). Existing entities keep their
+             * storage until they are created again.
+             */
+            void setColumnStorage(bool enable);
+
+            /** Returns the column table of a class, nullptr if none of its entities has been stored in columns */
+            column_table* getColumns(uint32_t classId);
+
+            /** Returns the row of an entity in the column table of its class, -1 if it isn't stored in columns */
+            uint32_t getColumnRow(uint32_t entityId);
         private:
             /** Settings for this parser, cannot be changed */
             settings set;
@@ -133,6 +219,14 @@ namespace dota {
             uint32_t tick;
             /** Number of messages parsed */
             uint32_t msgs;
+            /** Handler revision the skipped message types have been computed for */
+            uint32_t skipRevision;
+            /** Entity classes to always skip, initialized from the settings */
+            std::set<uint32_t> skipEntities;
+            /** Whether entity classes without subscribers are skipped, initialized from the settings */
+            bool skipUnsubscribed;
+            /** Whether an entity class is skipped, indexed by class id */
+            std::vector<bool> skippedClasses;
 
             /** File opened */
             std::string file;
@@ -158,6 +252,158 @@ namespace dota {
             /** Contains last entity delta */
             entity_delta* delta;
 
+            #if DOTA_ARENA
+            /**
+             * Arena for all messages created while handling a single top-level message.
+             *
+             * Reset after each message, objects passed to callbacks are only valid for
+             * the duration of the callback.
+             */
+            google::protobuf::Arena arena;
+            #endif // DOTA_ARENA
+
+            /** Whether events are collected into batches */
+            bool batching;
+            /** Events of the current tick */
+            tick_batch batch;
+
+            /** Whether statistics are collected */
+            bool statsEnabled;
+            /** Statistics per message type */
+            parse_stats stats;
+            /** Nanoseconds spent parsing, incremented by the handler */
+            uint64_t parseTimer;
+            /** Total time of messages nested in the one currently measured */
+            uint64_t statsNested;
+            /** Parse time of messages nested in the one currently measured */
+            uint64_t statsNestedParse;
+            /** Stream to write the statistics to once finished */
+            std::ostream* statsJson;
+            /** Whether the statistics have been written already */
+            bool statsWritten;
+
+            /** Whether entity notifications are deferred to the end of the tick */
+            bool coalesce;
+            /** Entities with deferred notifications in the order they were first touched */
+            std::vector<uint32_t> coalesced;
+            /** State to forward per entity, state_default if nothing is pending */
+            std::vector<entity::state_type> coalescedState;
+            /** Fields updated this tick per entity */
+            std::vector<std::vector<uint32_t>> coalescedFields;
+
+            /**
+             * Decoded instancebaseline per class id, empty if it hasn't been decoded yet.
+             *
+             * Cleared whenever the baseline table changes. Changing it directly through
+             * getStringtables() requires a call to clearBaselines().
+             */
+            std::vector<entity::map_type> baselines;
+            /** Fields set by the baseline per class id */
+            std::vector<std::vector<uint32_t>> baselineFields;
+
+            /** Whether entities created from now on are stored in columns */
+            bool columnStorage;
+            /** Column tables per class id, created on first use */
+            std::vector<std::unique_ptr<column_table>> columns;
+            /** Row in the column table of its class per entity id, -1 if not stored in columns */
+            std::vector<uint32_t> columnRows;
+
+            /** Tells the stream to skip all message types no one is interested in */
+            void updateSkipped();
+
+            /** Recomputes which entity classes are skipped */
+            void updateSkippedClasses();
+
+            /** Checks whether an entity class is skipped without looking at the precomputed list */
+            bool isClassSkipped(uint32_t classId);
+
+            /** Writes the statistics if requested and lets handlers know the replay is finished */
+            void finish();
+
+            /** Runs f, accounting its time and size to the given message type if statistics are enabled */
+            template <typename F>
+            void measure(std::vector<message_stats> &list, uint32_t type, uint64_t bytes, uint64_t compressed, F&& f) {
+                if (!statsEnabled) {
+                    f();
+                    return;
+                }
+
+                // time of nested messages is subtracted, they are accounted for themselves
+                const uint64_t outerNested = statsNested;
+                const uint64_t outerNestedParse = statsNestedParse;
+                statsNested = 0;
+                statsNestedParse = 0;
+
+                const uint64_t parseStart = parseTimer;
+                const auto start = std::chrono::steady_clock::now();
+
+                f();
+
+                const uint64_t total = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+                const uint64_t parse = parseTimer - parseStart;
+
+                const uint64_t ownParse = parse > statsNestedParse ? parse - statsNestedParse : 0;
+                const uint64_t own = total > statsNested ? total - statsNested : 0;
+
+                message_stats &s = parse_stats::at(list, type);
+                ++s.count;
+                s.bytes += bytes;
+                s.compressed += compressed;
+                s.parse += ownParse;
+                s.callback += own > ownParse ? own - ownParse : 0;
+
+                statsNested = outerNested + total;
+                statsNestedParse = outerNestedParse + parse;
+            }
+
+            /** Forwards the current batch to its subscribers and clears it */
+            void flushBatch();
+
+            /** Adds an entity event to the current batch */
+            void collectEntity(entity &ent);
+
+            /** Forwards an entity or defers it to the end of the tick when coalescing */
+            void notifyEntity(entity &ent);
+
+            /** Forwards the deferred notification of an entity if there is one */
+            void flushEntity(uint32_t id);
+
+            /** Forwards all deferred entity notifications */
+            void flushEntities();
+
+            /** Adds a delta event to the current batch */
+            void collectDelta(entity &ent);
+
+            /** Parses a message, adds it to the current batch and forwards the same object to subscribers */
+            template <typename Type>
+            void collect(uint32_t id, demMessage_t &&data) {
+                const uint32_t at = data.tick;
+
+                #ifndef _MSC_VER
+                google::protobuf::Message* msg = nullptr;
+
+                try {
+                    auto o = handler.retrieve<Type::id>(id, demMessage_t(data), at);
+                    batch.events.push_back(tick_event{
+                        Type::id, id, o.msg, o.ownsPointer ? o.pool : nullptr, 0, entity::state_default, 0, 0
+                    });
+
+                    // released in flushBatch
+                    o.ownsPointer = false;
+                    msg = o.msg;
+                } catch (handlerNoConversionAvailable &e) {
+                    // unknown message type, there is nothing to parse it into
+                    handler.forward<Type>(id, std::move(data), at);
+                    return;
+                }
+
+                handler.forwardParsed<Type>(id, msg, at);
+                #else
+                handler.forward<Type>(id, std::move(data), at);
+                #endif // _MSC_VER
+            }
+
             /** Reads a varint from a string */
             uint32_t readVarInt(const char* data, uint32_t& count);
 
@@ -195,96 +441,117 @@ namespace dota {
                     data = data+mSize;
                     size -= mSize;
 
-                    // Take care of Net messages
-                    if (std::is_same<Type, msgNet>{}) {
-                        // Forward all net messages without exception, implies forward_net
-                        if (set.forward_net_internal) {
+                    // Handle the message, measuring it if requested
+                    measure(std::is_same<Type, msgNet>{} ? stats.net : stats.user, mType, mSize, 0, [&]() {
+                        handleContainerMessage<Type>(mType, mMsg, mSize, tick);
+                    });
+                }
+            }
+
+            /** Handles / forwards a single message from a container */
+            template <typename Type>
+            void handleContainerMessage(uint32_t mType, const char* mMsg, uint32_t mSize, uint32_t tick) {
+                // Take care of Net messages
+                if (std::is_same<Type, msgNet>{}) {
+                    // Forward all net messages without exception, implies forward_net
+                    if (set.forward_net_internal) {
+                        if (batching)
+                            collect<msgNet>(mType, demMessage_t{0, tick, mType, mMsg, mSize});
+                        else
                             handler.forward<msgNet>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
-                            continue;
-                        }
-
-                        // Parse internal messages
-                        #ifndef _MSC_VER
-                        switch (mType) {
-                            case svc_PacketEntities: {
-                                if (set.parse_entities) {
-                                    auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
-                                    handleEntity(&e);
-                                    e.free();
-                                }
-                                continue;
-                            } break;
-                            case svc_ServerInfo: {
-                                if (set.parse_entities) {
-                                    auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
-                                    handleServerInfo(&e);
-                                    e.free();
-                                }
-                                continue;
-                            } break;
-                            case svc_SendTable: {
-                                if (set.parse_entities) {
-                                    auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
-                                    handleSendTable(&e);
-                                    e.free();
-                                }
-                                continue;
-                            } break;
-                            case svc_CreateStringTable: {
-                                if (set.parse_stringtables) {
-                                    auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
-                                    handleCreateStringtable(&e);
-                                    e.free();
-                                }
-                                continue;
-                            } break;
-                            case svc_UpdateStringTable: {
-                                if (set.parse_stringtables) {
-                                    auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
-                                    handleUpdateStringtable(&e);
-                                    e.free();
-                                }
-                                continue;
-                            } break;
-                            case svc_GameEventList: {
-                                if (set.parse_events) {
-                                    auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
-                                    handleEventList(&e);
-                                    e.free();
-                                }
-                            } break;
-                            case svc_UserMessage: {
-                                if (set.forward_user) {
-                                    auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
-                                    handleUserMessage(&e);
-                                    e.free();
-                                }
-                                continue;
-                            } break;
-                        }
-                        #else // _MSC_VER
-                        switch (mType) {
-                            case svc_PacketEntities:
-                            case svc_ServerInfo:
-                            case svc_SendTable:
-                            case svc_CreateStringTable:
-                            case svc_UpdateStringTable:
-                            case svc_UserMessage:
-                            case svc_GameEventList:
-                                handler.forward<msgNet>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
-                                continue;
-                            default:
-                                break;
-                        }
-                        #endif // _MSC_VER
-
-                        // Forward remaining?
-                        if (set.forward_net)
+                        return;
+                    }
+
+                    // Parse internal messages
+                    #ifndef _MSC_VER
+                    switch (mType) {
+                        case svc_PacketEntities: {
+                            if (set.parse_entities) {
+                                // read the fields we need in place, the message is never materialized
+                                packet_entities e;
+                                e.read(mMsg, mSize);
+                                handleEntity(e);
+                            }
+                            return;
+                        } break;
+                        case svc_ServerInfo: {
+                            if (set.parse_entities) {
+                                auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
+                                handleServerInfo(&e);
+                                e.free();
+                            }
+                            return;
+                        } break;
+                        case svc_SendTable: {
+                            if (set.parse_entities) {
+                                auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
+                                handleSendTable(&e);
+                                e.free();
+                            }
+                            return;
+                        } break;
+                        case svc_CreateStringTable: {
+                            if (set.parse_stringtables) {
+                                auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
+                                handleCreateStringtable(&e);
+                                e.free();
+                            }
+                            return;
+                        } break;
+                        case svc_UpdateStringTable: {
+                            if (set.parse_stringtables) {
+                                auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
+                                handleUpdateStringtable(&e);
+                                e.free();
+                            }
+                            return;
+                        } break;
+                        case svc_GameEventList: {
+                            if (set.parse_events) {
+                                auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
+                                handleEventList(&e);
+                                e.free();
+                            }
+                        } break;
+                        case svc_UserMessage: {
+                            if (set.forward_user) {
+                                auto e = handler.retrieve<msgNet::id>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
+                                handleUserMessage(&e);
+                                e.free();
+                            }
+                            return;
+                        } break;
+                    }
+                    #else // _MSC_VER
+                    switch (mType) {
+                        case svc_PacketEntities:
+                        case svc_ServerInfo:
+                        case svc_SendTable:
+                        case svc_CreateStringTable:
+                        case svc_UpdateStringTable:
+                        case svc_UserMessage:
+                        case svc_GameEventList:
+                            handler.forward<msgNet>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
+                            return;
+                        default:
+                            break;
+                    }
+                    #endif // _MSC_VER
+
+                    // Forward remaining?
+                    if (set.forward_net) {
+                        if (batching)
+                            collect<msgNet>(mType, demMessage_t{0, tick, mType, mMsg, mSize});
+                        else
                             handler.forward<msgNet>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
                     }
+                }
 
-                    // Take care of User messages
-                    if (std::is_same<Type, msgUser>{} && set.forward_user)
+                // Take care of User messages
+                if (std::is_same<Type, msgUser>{} && set.forward_user) {
+                    if (batching)
+                        collect<msgUser>(mType, demMessage_t{0, tick, mType, mMsg, mSize});
+                    else
                         handler.forward<msgUser>(mType, demMessage_t{0, tick, mType, mMsg, mSize}, tick);
                 }
             }
@@ -322,6 +589,24 @@ namespace dota {
             /** Handles entity updates */
             void handleEntity(handlerCbType(msgNet) msg);
 
+            /** Handles entity updates */
+            void handleEntity(const packet_entities &e);
+
+            /** Returns the decoded baseline of an entity's class, decodes and caches it on first use */
+            const entity::map_type& getBaseline(entity &ent, const stringtable &baseline);
+
+            /** Sets the baseline properties of a created entity */
+            void applyBaseline(entity &ent, const stringtable &baseline);
+
+            /** Allocates a row for a created entity and sets its baseline properties in it */
+            void createColumnRow(entity &ent, const stringtable &baseline);
+
+            /** Frees the column row of an entity if it has one */
+            void releaseColumnRow(uint32_t id);
+
+            /** Drops all decoded baselines */
+            void clearBaselines();
+
             /** Walk through each sendprop table's hierarchy and flatten it */
             void flattenSendtables();
 
@@ -110,7 +110,7 @@ namespace dota {
 
         // Read a standard float
         const uint32_t dividend = stream.read(pr->getBits());
-        const uint32_t divisor = (1 << pr->getBits()) - 1;
+        const uint32_t divisor = (uint32_t)((1ull << pr->getBits()) - 1);
 
         const float f = ((float) dividend) / divisor;
         const float range = pr->getHighVal() - pr->getLowVal();
@@ -435,4 +435,309 @@ namespace dota {
                 break;
         }
     }
+
+    /** Returns how a float with the given flags is encoded */
+    decode_code compileFloat(const uint32_t flags) {
+        if (flags & SPROP_COORD)
+            return decode_coord;
+
+        if (flags & SPROP_COORD_MP)
+            return decode_coord_mp;
+
+        if (flags & SPROP_NOSCALE)
+            return decode_noscale;
+
+        if (flags & SPROP_NORMAL)
+            return decode_normal;
+
+        if (flags & SPROP_CELL_COORD || flags & SPROP_CELL_COORD_INTEGRAL || flags & SPROP_CELL_COORD_LOWPRECISION)
+            return decode_cell_coord;
+
+        return decode_float;
+    }
+
+    decode_op decode_op::compile(sendprop* p) {
+        const uint32_t flags = p->getFlags();
+
+        decode_op op;
+        op.code = decode_invalid;
+        op.component = compileFloat(flags);
+        op.bits = p->getBits();
+        op.divisor = 0;
+        op.low = p->getLowVal();
+        op.range = p->getHighVal() - p->getLowVal();
+        op.prop = p;
+
+        // only plain floats are scaled, integers may have 64 bits
+        const bool isFloat = p->getType() == sendprop::T_Float || p->getType() == sendprop::T_Vector
+            || p->getType() == sendprop::T_VectorXY;
+
+        if (isFloat && op.component == decode_float)
+            op.divisor = (uint32_t)((1ull << op.bits) - 1);
+
+        if (op.component == decode_coord_mp) {
+            op.integral = flags & SPROP_COORD_MP_INTEGRAL;
+            op.lowPrecision = flags & SPROP_COORD_MP_LOWPRECISION;
+        } else {
+            op.integral = flags & SPROP_CELL_COORD_INTEGRAL;
+            op.lowPrecision = flags & SPROP_CELL_COORD_LOWPRECISION;
+        }
+
+        switch (p->getType()) {
+            case sendprop::T_Int:
+                if (flags & SPROP_ENCODED_AGAINST_TICKCOUNT)
+                    op.code = (flags & SPROP_UNSIGNED) ? decode_varuint : decode_varint;
+                else
+                    op.code = (flags & SPROP_UNSIGNED) ? decode_uint : decode_int;
+                break;
+            case sendprop::T_Float:
+                op.code = op.component;
+                break;
+            case sendprop::T_Vector:
+                op.code = (flags & SPROP_NORMAL) ? decode_vector_normal : decode_vector;
+                break;
+            case sendprop::T_VectorXY:
+                op.code = decode_vector_xy;
+                break;
+            case sendprop::T_String:
+                op.code = decode_string;
+                break;
+            case sendprop::T_Array:
+                op.code = decode_array;
+                break;
+            case sendprop::T_Int64:
+                if (flags & SPROP_ENCODED_AGAINST_TICKCOUNT)
+                    op.code = (flags & SPROP_UNSIGNED) ? decode_varuint64 : decode_varint64;
+                else
+                    op.code = decode_int64;
+                break;
+            default:
+                break;
+        }
+
+        return op;
+    }
+
+    /** Reads a float encoded as code from the bitstream */
+    inline float readFloat(bitstream &stream, const decode_op &op, const decode_code code) {
+        switch (code) {
+            case decode_coord:
+                return stream.nReadCoord();
+            case decode_coord_mp:
+                return stream.nReadCoordMp(op.integral, op.lowPrecision);
+            case decode_noscale: {
+                uint32_t v = stream.read(32);
+                float f;
+                memcpy(&f, &v, 4);
+                return f;
+            }
+            case decode_normal:
+                return stream.nReadNormal();
+            case decode_cell_coord:
+                return stream.nReadCellCoord(op.bits, op.integral, op.lowPrecision);
+            default: {
+                const uint32_t dividend = stream.read(op.bits);
+                const float f = ((float) dividend) / op.divisor;
+                return f * op.range + op.low;
+            }
+        }
+    }
+
+    /** Skips a float encoded as code */
+    inline void skipFloat(bitstream &stream, const decode_op &op, const decode_code code) {
+        switch (code) {
+            case decode_coord:
+                stream.nSkipCoord();
+                break;
+            case decode_coord_mp:
+                stream.nSkipCoordMp(op.integral, op.lowPrecision);
+                break;
+            case decode_noscale:
+                stream.seekForward(32);
+                break;
+            case decode_normal:
+                stream.nSkipNormal();
+                break;
+            case decode_cell_coord:
+                stream.nSkipCellCoord(op.bits, op.integral, op.lowPrecision);
+                break;
+            default:
+                stream.seekForward(op.bits);
+                break;
+        }
+    }
+
+    IntProperty decode_op::readInt(bitstream &stream) const {
+        if (code == decode_varint)
+            return stream.nReadVarSInt32();
+
+        return stream.nReadSInt(bits);
+    }
+
+    UIntProperty decode_op::readUInt(bitstream &stream) const {
+        if (code == decode_varuint)
+            return stream.nReadVarUInt32();
+
+        return stream.nReadUInt(bits);
+    }
+
+    FloatProperty decode_op::readFloat(bitstream &stream) const {
+        return dota::readFloat(stream, *this, code);
+    }
+
+    VectorProperty decode_op::readVector(bitstream &stream) const {
+        VectorProperty vec;
+        vec[0] = dota::readFloat(stream, *this, component);
+        vec[1] = dota::readFloat(stream, *this, component);
+
+        if (code == decode_vector) {
+            vec[2] = dota::readFloat(stream, *this, component);
+            return vec;
+        }
+
+        // only x and y are networked for normals
+        const bool sign = stream.read(1);
+        const float f = vec[0] * vec[0] + vec[1] * vec[1];
+        vec[2] = f < 0 ? 0 : sqrt(1 - f);
+
+        if (sign)
+            vec[2] *= -1;
+
+        return vec;
+    }
+
+    VectorXYProperty decode_op::readVectorXY(bitstream &stream) const {
+        VectorXYProperty vec;
+        vec[0] = dota::readFloat(stream, *this, component);
+        vec[1] = dota::readFloat(stream, *this, component);
+        return vec;
+    }
+
+    Int64Property decode_op::readInt64(bitstream &stream) const {
+        if (code == decode_varint64)
+            return stream.nReadVarSInt64();
+
+        bool negate = false;
+        std::size_t sbits = bits - 32; // extra bits above 32
+
+        if (!(SPROP_UNSIGNED & prop->getFlags())) {
+            --sbits;
+            negate = stream.read(1);
+        }
+
+        const int64_t a = stream.read(32);
+        const int64_t b = stream.read(sbits);
+        const int64_t val = (b << 32) | a;
+
+        return negate ? -val : val;
+    }
+
+    UInt64Property decode_op::readUInt64(bitstream &stream) const {
+        return stream.nReadVarUInt64();
+    }
+
+    void property::update(bitstream &stream, const decode_op &op) {
+        switch (op.code) {
+            case decode_int:
+            case decode_varint:
+                set(op.readInt(stream));
+                break;
+            case decode_uint:
+            case decode_varuint:
+                set(op.readUInt(stream));
+                break;
+            case decode_coord:
+            case decode_coord_mp:
+            case decode_noscale:
+            case decode_normal:
+            case decode_cell_coord:
+            case decode_float:
+                set(op.readFloat(stream));
+                break;
+            case decode_vector:
+            case decode_vector_normal:
+                set(op.readVector(stream));
+                break;
+            case decode_vector_xy:
+                set(op.readVectorXY(stream));
+                break;
+            case decode_string: {
+                char str[PROPERTY_MAX_STRING_LENGTH + 1];
+                uint32_t length = readString(str, stream);
+                set(std::string(str, length));
+            } break;
+            case decode_array: {
+                std::vector<property> vec;
+                readArray(vec, stream, op.prop);
+                set(std::move(vec));
+            } break;
+            case decode_int64:
+            case decode_varint64:
+                set(op.readInt64(stream));
+                break;
+            case decode_varuint64:
+                set(op.readUInt64(stream));
+                break;
+            default:
+                BOOST_THROW_EXCEPTION( propertyInvalidType()
+                    << (EArgT<1, uint32_t>::info(op.prop->getType()))
+                );
+                break;
+        }
+    }
+
+    property property::create(bitstream &stream, const decode_op &op) {
+        property p(op.prop);
+        p.update(stream, op);
+        return p;
+    }
+
+    void property::skip(bitstream& stream, const decode_op &op) {
+        switch (op.code) {
+            case decode_int:
+            case decode_uint:
+            case decode_int64:
+                stream.seekForward(op.bits);
+                break;
+            case decode_varint:
+            case decode_varuint:
+            case decode_varint64:
+            case decode_varuint64:
+                stream.nSkipVarInt();
+                break;
+            case decode_coord:
+            case decode_coord_mp:
+            case decode_noscale:
+            case decode_normal:
+            case decode_cell_coord:
+            case decode_float:
+                skipFloat(stream, op, op.code);
+                break;
+            case decode_vector:
+                skipFloat(stream, op, op.component);
+                skipFloat(stream, op, op.component);
+                skipFloat(stream, op, op.component);
+                break;
+            case decode_vector_normal:
+                skipFloat(stream, op, op.component);
+                skipFloat(stream, op, op.component);
+                stream.seekForward(1);
+                break;
+            case decode_vector_xy:
+                skipFloat(stream, op, op.component);
+                skipFloat(stream, op, op.component);
+                break;
+            case decode_string:
+                skipString(stream);
+                break;
+            case decode_array:
+                skipArray(stream, op.prop);
+                break;
+            default:
+                BOOST_THROW_EXCEPTION( propertyInvalidType()
+                    << (EArgT<1, uint32_t>::info(op.prop->getType()))
+                );
+                break;
+        }
+    }
 }
@@ -116,6 +116,80 @@ namespace dota {
     /** Underlying type for a 64 bit Int Property */
     typedef uint64_t UInt64Property;
 
+    /** Encoding of a property, resolved from the type and flags of its sendprop */
+    enum decode_code : uint8_t {
+        decode_invalid = 0, // not readable, e.g. a datatable
+        decode_int,         // signed integer
+        decode_uint,        // unsigned integer
+        decode_varint,      // signed variable length integer
+        decode_varuint,     // unsigned variable length integer
+        decode_coord,       // float coordinate
+        decode_coord_mp,    // float coordinate for multiplayer games
+        decode_noscale,     // raw float
+        decode_normal,      // normalized float
+        decode_cell_coord,  // cell coordinate
+        decode_float,       // float scaled into the low / high range
+        decode_vector,      // 3D vector
+        decode_vector_normal, // 3D normal, only x and y are networked
+        decode_vector_xy,   // 2D vector
+        decode_string,      // string
+        decode_array,       // array
+        decode_int64,       // 64 bit integer
+        decode_varint64,    // signed 64 bit variable length integer
+        decode_varuint64    // unsigned 64 bit variable length integer
+    };
+
+    /**
+     * Decoder for a single property, everything required to read it is resolved up front.
+     *
+     * Each flattable has a decode_op per property so the type and flags of a sendprop don't
+     * need to be looked at again each time it's read.
+     */
+    struct decode_op {
+        /** How to read the property */
+        decode_code code;
+        /** How to read each component of a vector */
+        decode_code component;
+        /** Whether coordinates are integral */
+        bool integral;
+        /** Whether coordinates are low precision */
+        bool lowPrecision;
+        /** Number of bits */
+        uint32_t bits;
+        /** Divisor for scaled floats */
+        uint32_t divisor;
+        /** Low value for scaled floats */
+        float low;
+        /** Range for scaled floats */
+        float range;
+        /** Sendprop this decoder has been compiled from */
+        sendprop* prop;
+
+        /** Compiles the decoder for a sendprop */
+        static decode_op compile(sendprop* p);
+
+        /** Reads a signed integer, code has to be decode_int or decode_varint */
+        IntProperty readInt(bitstream &stream) const;
+
+        /** Reads an unsigned integer, code has to be decode_uint or decode_varuint */
+        UIntProperty readUInt(bitstream &stream) const;
+
+        /** Reads a float, code has to be one of the float encodings */
+        FloatProperty readFloat(bitstream &stream) const;
+
+        /** Reads a 3D vector, code has to be decode_vector or decode_vector_normal */
+        VectorProperty readVector(bitstream &stream) const;
+
+        /** Reads a 2D vector, code has to be decode_vector_xy */
+        VectorXYProperty readVectorXY(bitstream &stream) const;
+
+        /** Reads a signed 64 bit integer, code has to be decode_int64 or decode_varint64 */
+        Int64Property readInt64(bitstream &stream) const;
+
+        /** Reads an unsigned 64 bit integer, code has to be decode_varuint64 */
+        UInt64Property readUInt64(bitstream &stream) const;
+    };
+
     /**
      * This is the actual property, consisting of it's data and definition.
      *
@@ -146,7 +220,7 @@ namespace dota {
             > value_type;
 
             /** Empty constructor */
-            property() : name(nullptr), init(false) {}
+            property() : type(sendprop::T_Int), prop(nullptr), name(nullptr), init(false) {}
 
             /** Returns whether this property has been initialized */
             bool isInitialized() {
@@ -214,14 +288,28 @@ namespace dota {
                 return prop;
             }
 
+            /** Sets hierarchial name */
+            void setName(const std::string* name) {
+                this->name = name;
+            }
+
             /** Updates this property from a bitstream */
             void update(bitstream& stream);
 
+            /** Updates this property from a bitstream using a compiled decoder */
+            void update(bitstream& stream, const decode_op& op);
+
             /** Creates property from bitstream and corresponding sendprop definition */
             static property create(bitstream& stream, sendprop* prop);
 
+            /** Creates property from bitstream using a compiled decoder */
+            static property create(bitstream& stream, const decode_op& op);
+
             /** Skips property contents in the bitstream */
             static void skip(bitstream& stream, sendprop* prop);
+
+            /** Skips property contents in the bitstream using a compiled decoder */
+            static void skip(bitstream& stream, const decode_op& op);
         protected:
             /** Type for this paticular property */
             type_t type;
@@ -238,11 +326,6 @@ namespace dota {
             property(sendprop* p) : type(p->getType()), prop(p), init(true) {
 
             }
-
-            /** Set hierarchial name */
-            void setName(const std::string* name) {
-                this->name = name;
-            }
     };
 
     namespace detail {
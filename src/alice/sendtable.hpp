@@ -25,10 +25,14 @@
 #define _DOTA_SENDTABLE_HPP_
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <boost/functional/hash.hpp>
+
 #include <alice/multiindex.hpp>
 #include <alice/exception.hpp>
+#include <alice/property.hpp>
 #include <alice/sendprop.hpp>
 
 namespace dota {
@@ -65,6 +69,10 @@ namespace dota {
         std::string name;
         /** Correct network property order and their corresponding hierarchy name */
         std::vector<dt_hiera> properties;
+        /** Compiled decoder for each property, same order as properties */
+        std::vector<decode_op> plan;
+        /** Index of each property by its hierarchial name, shared by all entities of the class */
+        std::unordered_map<std::string, uint32_t, boost::hash<std::string>> index;
     };
 
     /**
@@ -0,0 +1,106 @@
+/**
+ * @file stats.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <sstream>
+
+#include <alice/demo.pb.h>
+#include <alice/netmessages.pb.h>
+#include <alice/networkbasetypes.pb.h>
+#include <alice/usermessages.pb.h>
+#include <alice/dota_usermessages.pb.h>
+
+#include <alice/stats.hpp>
+
+namespace dota {
+    namespace {
+        /** Returns the enum name of a demo message */
+        std::string demName(uint32_t type) {
+            if (EDemoCommands_IsValid(type))
+                return EDemoCommands_Name(static_cast<EDemoCommands>(type));
+
+            return std::to_string(type);
+        }
+
+        /** Returns the enum name of a net message */
+        std::string netName(uint32_t type) {
+            if (NET_Messages_IsValid(type))
+                return NET_Messages_Name(static_cast<NET_Messages>(type));
+
+            if (SVC_Messages_IsValid(type))
+                return SVC_Messages_Name(static_cast<SVC_Messages>(type));
+
+            return std::to_string(type);
+        }
+
+        /** Returns the enum name of a user message */
+        std::string userName(uint32_t type) {
+            if (EBaseUserMessages_IsValid(type))
+                return EBaseUserMessages_Name(static_cast<EBaseUserMessages>(type));
+
+            if (EDotaUserMessages_IsValid(type))
+                return EDotaUserMessages_Name(static_cast<EDotaUserMessages>(type));
+
+            return std::to_string(type);
+        }
+
+        /** Writes all types of a list that occurred as a JSON array */
+        void writeList(std::ostream &out, const std::vector<message_stats> &list, std::string (*name)(uint32_t)) {
+            out << "[";
+
+            bool first = true;
+            for (uint32_t i = 0; i < list.size(); ++i) {
+                const message_stats &s = list[i];
+                if (s.count == 0)
+                    continue;
+
+                if (!first)
+                    out << ",";
+
+                first = false;
+                out << "{\"type\":" << i
+                    << ",\"name\":\"" << name(i) << "\""
+                    << ",\"count\":" << s.count
+                    << ",\"bytes\":" << s.bytes
+                    << ",\"compressed\":" << s.compressed
+                    << ",\"parse_ns\":" << s.parse
+                    << ",\"callback_ns\":" << s.callback
+                    << "}";
+            }
+
+            out << "]";
+        }
+    }
+
+    std::string parse_stats::toJson() const {
+        std::stringstream out;
+
+        out << "{\"dem\":";
+        writeList(out, dem, demName);
+        out << ",\"net\":";
+        writeList(out, net, netName);
+        out << ",\"user\":";
+        writeList(out, user, userName);
+        out << "}";
+
+        return out.str();
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file stats.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef _DOTA_STATS_HPP_
+#define _DOTA_STATS_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dota {
+    /// @defgroup CORE Core
+    /// @{
+
+    /** Counters for a single message type */
+    struct message_stats {
+        /** Number of messages */
+        uint64_t count;
+        /** Payload bytes, after uncompressing */
+        uint64_t bytes;
+        /** Bytes before uncompressing, only counted for compressed messages */
+        uint64_t compressed;
+        /** Nanoseconds spent parsing protobuf messages */
+        uint64_t parse;
+        /** Nanoseconds spent in callbacks and internal handling, excluding nested messages */
+        uint64_t callback;
+    };
+
+    /**
+     * Parse statistics per message type.
+     *
+     * Each list is indexed by the message type. Time spent on messages contained in another one
+     * (e.g. net messages in a DEM_Packet) is only counted for the contained message.
+     */
+    struct parse_stats {
+        /** Top-level demo messages */
+        std::vector<message_stats> dem;
+        /** Net messages */
+        std::vector<message_stats> net;
+        /** User messages */
+        std::vector<message_stats> user;
+
+        /** Returns the counters for type in list, growing it if necessary */
+        static message_stats& at(std::vector<message_stats> &list, uint32_t type) {
+            if (list.size() <= type)
+                list.resize(type + 1, message_stats{0, 0, 0, 0, 0});
+
+            return list[type];
+        }
+
+        /** Resets all counters */
+        void clear() {
+            dem.clear();
+            net.clear();
+            user.clear();
+        }
+
+        /** Returns all types that occurred as JSON */
+        std::string toJson() const;
+    };
+
+    /// @}
+}
+
+#endif // _DOTA_STATS_HPP_
@@ -0,0 +1,87 @@
+/**
+ * @file tick_batch.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#ifndef _DOTA_TICK_BATCH_HPP_
+#define _DOTA_TICK_BATCH_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <alice/entity.hpp>
+
+namespace google {
+    namespace protobuf {
+        // forward declaration
+        class Message;
+    }
+}
+
+namespace dota {
+    /// @defgroup CORE Core
+    /// @{
+
+    /** A single message or entity change collected for a tick */
+    struct tick_event {
+        /** Handler type of the event, one of msgNet::id, msgUser::id, msgEntity::id or msgEntityDelta::id */
+        uint32_t type;
+        /** Message type for messages, class id for entities */
+        uint32_t id;
+        /** Parsed message, nullptr for entity events */
+        google::protobuf::Message* msg;
+        /** Pool to return msg to once the tick has been dispatched, nullptr if not owned */
+        std::vector<google::protobuf::Message*>* release;
+        /** Id of the entity in the entity list */
+        uint32_t entity_id;
+        /** State of the entity when the event happened */
+        entity::state_type state;
+        /** Start of the updated fields in tick_batch::fields for delta events */
+        uint32_t fields_begin;
+        /** End of the updated fields in tick_batch::fields for delta events */
+        uint32_t fields_end;
+
+        /** Casts message into the specified type and returns it. */
+        template <typename T>
+        T* get() const {
+            return static_cast<T*>(msg);
+        }
+    };
+
+    /**
+     * All events of a single tick in the order they happened.
+     *
+     * Batches are dispatched to msgTick subscribers once the parser moves on to the next tick.
+     * Messages are valid until the callback returns. Entities can be looked up with entity_id and
+     * reflect their state at the end of the tick.
+     */
+    struct tick_batch {
+        /** Tick the events belong to */
+        uint32_t tick;
+        /** Events in order */
+        std::vector<tick_event> events;
+        /** Updated fields of all delta events, contiguous */
+        std::vector<uint32_t> fields;
+    };
+
+    /// @}
+}
+
+#endif // _DOTA_TICK_BATCH_HPP_
@@ -0,0 +1,8984 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: usermessages.proto
+
+#include "usermessages.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR CUserMsg_AchievementEvent::CUserMsg_AchievementEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.achievement_)*/0u} {}
+struct CUserMsg_AchievementEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_AchievementEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_AchievementEventDefaultTypeInternal() {}
+  union {
+    CUserMsg_AchievementEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_AchievementEventDefaultTypeInternal _CUserMsg_AchievementEvent_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_CloseCaption::CUserMsg_CloseCaption(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.hash_)*/0u
+  , /*decltype(_impl_.duration_)*/0
+  , /*decltype(_impl_.from_player_)*/false
+  , /*decltype(_impl_.ent_index_)*/0} {}
+struct CUserMsg_CloseCaptionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_CloseCaptionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_CloseCaptionDefaultTypeInternal() {}
+  union {
+    CUserMsg_CloseCaption _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_CloseCaptionDefaultTypeInternal _CUserMsg_CloseCaption_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_CurrentTimescale::CUserMsg_CurrentTimescale(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.current_)*/0} {}
+struct CUserMsg_CurrentTimescaleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_CurrentTimescaleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_CurrentTimescaleDefaultTypeInternal() {}
+  union {
+    CUserMsg_CurrentTimescale _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_CurrentTimescaleDefaultTypeInternal _CUserMsg_CurrentTimescale_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_DesiredTimescale::CUserMsg_DesiredTimescale(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.desired_)*/0
+  , /*decltype(_impl_.duration_)*/0
+  , /*decltype(_impl_.interpolator_)*/0u
+  , /*decltype(_impl_.start_blend_time_)*/0} {}
+struct CUserMsg_DesiredTimescaleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_DesiredTimescaleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_DesiredTimescaleDefaultTypeInternal() {}
+  union {
+    CUserMsg_DesiredTimescale _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_DesiredTimescaleDefaultTypeInternal _CUserMsg_DesiredTimescale_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_Fade::CUserMsg_Fade(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.duration_)*/0u
+  , /*decltype(_impl_.hold_time_)*/0u
+  , /*decltype(_impl_.flags_)*/0u
+  , /*decltype(_impl_.color_)*/0u} {}
+struct CUserMsg_FadeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_FadeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_FadeDefaultTypeInternal() {}
+  union {
+    CUserMsg_Fade _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_FadeDefaultTypeInternal _CUserMsg_Fade_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_Shake::CUserMsg_Shake(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.command_)*/0u
+  , /*decltype(_impl_.amplitude_)*/0
+  , /*decltype(_impl_.frequency_)*/0
+  , /*decltype(_impl_.duration_)*/0} {}
+struct CUserMsg_ShakeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_ShakeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_ShakeDefaultTypeInternal() {}
+  union {
+    CUserMsg_Shake _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_ShakeDefaultTypeInternal _CUserMsg_Shake_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_ShakeDir::CUserMsg_ShakeDir(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.shake_)*/nullptr
+  , /*decltype(_impl_.direction_)*/nullptr} {}
+struct CUserMsg_ShakeDirDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_ShakeDirDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_ShakeDirDefaultTypeInternal() {}
+  union {
+    CUserMsg_ShakeDir _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_ShakeDirDefaultTypeInternal _CUserMsg_ShakeDir_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_Tilt::CUserMsg_Tilt(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.angle_)*/nullptr
+  , /*decltype(_impl_.command_)*/0u
+  , /*decltype(_impl_.ease_in_out_)*/false
+  , /*decltype(_impl_.duration_)*/0
+  , /*decltype(_impl_.time_)*/0} {}
+struct CUserMsg_TiltDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_TiltDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_TiltDefaultTypeInternal() {}
+  union {
+    CUserMsg_Tilt _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_TiltDefaultTypeInternal _CUserMsg_Tilt_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_SayText::CUserMsg_SayText(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.client_)*/0u
+  , /*decltype(_impl_.chat_)*/false} {}
+struct CUserMsg_SayTextDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_SayTextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_SayTextDefaultTypeInternal() {}
+  union {
+    CUserMsg_SayText _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_SayTextDefaultTypeInternal _CUserMsg_SayText_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_SayText2::CUserMsg_SayText2(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.format_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.location_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.client_)*/0u
+  , /*decltype(_impl_.chat_)*/false} {}
+struct CUserMsg_SayText2DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_SayText2DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_SayText2DefaultTypeInternal() {}
+  union {
+    CUserMsg_SayText2 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_SayText2DefaultTypeInternal _CUserMsg_SayText2_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_HudMsg::CUserMsg_HudMsg(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.channel_)*/0u
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.color1_)*/0u
+  , /*decltype(_impl_.color2_)*/0u
+  , /*decltype(_impl_.effect_)*/0u
+  , /*decltype(_impl_.fade_in_time_)*/0
+  , /*decltype(_impl_.fade_out_time_)*/0
+  , /*decltype(_impl_.hold_time_)*/0
+  , /*decltype(_impl_.fx_time_)*/0} {}
+struct CUserMsg_HudMsgDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_HudMsgDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_HudMsgDefaultTypeInternal() {}
+  union {
+    CUserMsg_HudMsg _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_HudMsgDefaultTypeInternal _CUserMsg_HudMsg_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_HudText::CUserMsg_HudText(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CUserMsg_HudTextDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_HudTextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_HudTextDefaultTypeInternal() {}
+  union {
+    CUserMsg_HudText _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_HudTextDefaultTypeInternal _CUserMsg_HudText_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_TextMsg::CUserMsg_TextMsg(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.param_)*/{}
+  , /*decltype(_impl_.dest_)*/0u} {}
+struct CUserMsg_TextMsgDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_TextMsgDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_TextMsgDefaultTypeInternal() {}
+  union {
+    CUserMsg_TextMsg _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_TextMsgDefaultTypeInternal _CUserMsg_TextMsg_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_GameTitle::CUserMsg_GameTitle(
+    ::_pbi::ConstantInitialized) {}
+struct CUserMsg_GameTitleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_GameTitleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_GameTitleDefaultTypeInternal() {}
+  union {
+    CUserMsg_GameTitle _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_GameTitleDefaultTypeInternal _CUserMsg_GameTitle_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_ResetHUD::CUserMsg_ResetHUD(
+    ::_pbi::ConstantInitialized) {}
+struct CUserMsg_ResetHUDDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_ResetHUDDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_ResetHUDDefaultTypeInternal() {}
+  union {
+    CUserMsg_ResetHUD _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_ResetHUDDefaultTypeInternal _CUserMsg_ResetHUD_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_SendAudio::CUserMsg_SendAudio(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stop_)*/false} {}
+struct CUserMsg_SendAudioDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_SendAudioDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_SendAudioDefaultTypeInternal() {}
+  union {
+    CUserMsg_SendAudio _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_SendAudioDefaultTypeInternal _CUserMsg_SendAudio_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_VoiceMask::CUserMsg_VoiceMask(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.audible_players_mask_)*/{}
+  , /*decltype(_impl_.player_mod_enabled_)*/false} {}
+struct CUserMsg_VoiceMaskDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_VoiceMaskDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_VoiceMaskDefaultTypeInternal() {}
+  union {
+    CUserMsg_VoiceMask _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_VoiceMaskDefaultTypeInternal _CUserMsg_VoiceMask_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_RequestState::CUserMsg_RequestState(
+    ::_pbi::ConstantInitialized) {}
+struct CUserMsg_RequestStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_RequestStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_RequestStateDefaultTypeInternal() {}
+  union {
+    CUserMsg_RequestState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_RequestStateDefaultTypeInternal _CUserMsg_RequestState_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_HintText::CUserMsg_HintText(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CUserMsg_HintTextDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_HintTextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_HintTextDefaultTypeInternal() {}
+  union {
+    CUserMsg_HintText _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_HintTextDefaultTypeInternal _CUserMsg_HintText_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_KeyHintText::CUserMsg_KeyHintText(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CUserMsg_KeyHintTextDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_KeyHintTextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_KeyHintTextDefaultTypeInternal() {}
+  union {
+    CUserMsg_KeyHintText _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_KeyHintTextDefaultTypeInternal _CUserMsg_KeyHintText_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_StatsCrawlMsg::CUserMsg_StatsCrawlMsg(
+    ::_pbi::ConstantInitialized) {}
+struct CUserMsg_StatsCrawlMsgDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_StatsCrawlMsgDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_StatsCrawlMsgDefaultTypeInternal() {}
+  union {
+    CUserMsg_StatsCrawlMsg _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_StatsCrawlMsgDefaultTypeInternal _CUserMsg_StatsCrawlMsg_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_StatsSkipState::CUserMsg_StatsSkipState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.num_skips_)*/0
+  , /*decltype(_impl_.num_players_)*/0} {}
+struct CUserMsg_StatsSkipStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_StatsSkipStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_StatsSkipStateDefaultTypeInternal() {}
+  union {
+    CUserMsg_StatsSkipState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_StatsSkipStateDefaultTypeInternal _CUserMsg_StatsSkipState_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_VoiceSubtitle::CUserMsg_VoiceSubtitle(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ent_index_)*/0
+  , /*decltype(_impl_.menu_)*/0
+  , /*decltype(_impl_.item_)*/0} {}
+struct CUserMsg_VoiceSubtitleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_VoiceSubtitleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_VoiceSubtitleDefaultTypeInternal() {}
+  union {
+    CUserMsg_VoiceSubtitle _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_VoiceSubtitleDefaultTypeInternal _CUserMsg_VoiceSubtitle_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_VGUIMenu_Keys::CUserMsg_VGUIMenu_Keys(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CUserMsg_VGUIMenu_KeysDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_VGUIMenu_KeysDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_VGUIMenu_KeysDefaultTypeInternal() {}
+  union {
+    CUserMsg_VGUIMenu_Keys _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_VGUIMenu_KeysDefaultTypeInternal _CUserMsg_VGUIMenu_Keys_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_VGUIMenu::CUserMsg_VGUIMenu(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.show_)*/false} {}
+struct CUserMsg_VGUIMenuDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_VGUIMenuDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_VGUIMenuDefaultTypeInternal() {}
+  union {
+    CUserMsg_VGUIMenu _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_VGUIMenuDefaultTypeInternal _CUserMsg_VGUIMenu_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_Geiger::CUserMsg_Geiger(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.range_)*/0} {}
+struct CUserMsg_GeigerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_GeigerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_GeigerDefaultTypeInternal() {}
+  union {
+    CUserMsg_Geiger _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_GeigerDefaultTypeInternal _CUserMsg_Geiger_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_Rumble::CUserMsg_Rumble(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.index_)*/0
+  , /*decltype(_impl_.data_)*/0
+  , /*decltype(_impl_.flags_)*/0} {}
+struct CUserMsg_RumbleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_RumbleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_RumbleDefaultTypeInternal() {}
+  union {
+    CUserMsg_Rumble _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_RumbleDefaultTypeInternal _CUserMsg_Rumble_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_Train::CUserMsg_Train(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.train_)*/0} {}
+struct CUserMsg_TrainDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_TrainDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_TrainDefaultTypeInternal() {}
+  union {
+    CUserMsg_Train _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_TrainDefaultTypeInternal _CUserMsg_Train_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_SayTextChannel::CUserMsg_SayTextChannel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.player_)*/0
+  , /*decltype(_impl_.channel_)*/0} {}
+struct CUserMsg_SayTextChannelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_SayTextChannelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_SayTextChannelDefaultTypeInternal() {}
+  union {
+    CUserMsg_SayTextChannel _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_SayTextChannelDefaultTypeInternal _CUserMsg_SayTextChannel_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_MessageText::CUserMsg_MessageText(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.color_)*/0u} {}
+struct CUserMsg_MessageTextDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_MessageTextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_MessageTextDefaultTypeInternal() {}
+  union {
+    CUserMsg_MessageText _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_MessageTextDefaultTypeInternal _CUserMsg_MessageText_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_CameraTransition_Transition_DataDriven::CUserMsg_CameraTransition_Transition_DataDriven(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.filename_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.attach_ent_index_)*/0} {}
+struct CUserMsg_CameraTransition_Transition_DataDrivenDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_CameraTransition_Transition_DataDrivenDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_CameraTransition_Transition_DataDrivenDefaultTypeInternal() {}
+  union {
+    CUserMsg_CameraTransition_Transition_DataDriven _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_CameraTransition_Transition_DataDrivenDefaultTypeInternal _CUserMsg_CameraTransition_Transition_DataDriven_default_instance_;
+PROTOBUF_CONSTEXPR CUserMsg_CameraTransition::CUserMsg_CameraTransition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.params_data_driven_)*/nullptr
+  , /*decltype(_impl_.camera_type_)*/0u
+  , /*decltype(_impl_.duration_)*/0} {}
+struct CUserMsg_CameraTransitionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CUserMsg_CameraTransitionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CUserMsg_CameraTransitionDefaultTypeInternal() {}
+  union {
+    CUserMsg_CameraTransition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CUserMsg_CameraTransitionDefaultTypeInternal _CUserMsg_CameraTransition_default_instance_;
+static ::_pb::Metadata file_level_metadata_usermessages_2eproto[32];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_usermessages_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_usermessages_2eproto = nullptr;
+
+const uint32_t TableStruct_usermessages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_AchievementEvent, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_AchievementEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_AchievementEvent, _impl_.achievement_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CloseCaption, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CloseCaption, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CloseCaption, _impl_.hash_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CloseCaption, _impl_.duration_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CloseCaption, _impl_.from_player_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CloseCaption, _impl_.ent_index_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CurrentTimescale, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CurrentTimescale, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CurrentTimescale, _impl_.current_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_DesiredTimescale, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_DesiredTimescale, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_DesiredTimescale, _impl_.desired_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_DesiredTimescale, _impl_.duration_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_DesiredTimescale, _impl_.interpolator_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_DesiredTimescale, _impl_.start_blend_time_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Fade, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Fade, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Fade, _impl_.duration_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Fade, _impl_.hold_time_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Fade, _impl_.flags_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Fade, _impl_.color_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Shake, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Shake, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Shake, _impl_.command_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Shake, _impl_.amplitude_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Shake, _impl_.frequency_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Shake, _impl_.duration_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_ShakeDir, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_ShakeDir, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_ShakeDir, _impl_.shake_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_ShakeDir, _impl_.direction_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Tilt, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Tilt, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Tilt, _impl_.command_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Tilt, _impl_.ease_in_out_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Tilt, _impl_.angle_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Tilt, _impl_.duration_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Tilt, _impl_.time_),
+  1,
+  2,
+  0,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText, _impl_.client_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText, _impl_.chat_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText2, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText2, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText2, _impl_.client_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText2, _impl_.chat_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText2, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText2, _impl_.prefix_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText2, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayText2, _impl_.location_),
+  4,
+  5,
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.channel_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.color1_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.color2_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.effect_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.fade_in_time_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.fade_out_time_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.hold_time_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.fx_time_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudMsg, _impl_.message_),
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudText, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudText, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HudText, _impl_.message_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_TextMsg, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_TextMsg, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_TextMsg, _impl_.dest_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_TextMsg, _impl_.param_),
+  0,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_GameTitle, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_ResetHUD, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SendAudio, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SendAudio, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SendAudio, _impl_.stop_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SendAudio, _impl_.name_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VoiceMask, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VoiceMask, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VoiceMask, _impl_.audible_players_mask_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VoiceMask, _impl_.player_mod_enabled_),
+  ~0u,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_RequestState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HintText, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HintText, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_HintText, _impl_.message_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_KeyHintText, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_KeyHintText, _impl_.messages_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_StatsCrawlMsg, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_StatsSkipState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_StatsSkipState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_StatsSkipState, _impl_.num_skips_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_StatsSkipState, _impl_.num_players_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VoiceSubtitle, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VoiceSubtitle, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VoiceSubtitle, _impl_.ent_index_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VoiceSubtitle, _impl_.menu_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VoiceSubtitle, _impl_.item_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VGUIMenu_Keys, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VGUIMenu_Keys, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VGUIMenu_Keys, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VGUIMenu_Keys, _impl_.value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VGUIMenu, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VGUIMenu, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VGUIMenu, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VGUIMenu, _impl_.show_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_VGUIMenu, _impl_.keys_),
+  0,
+  1,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Geiger, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Geiger, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Geiger, _impl_.range_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Rumble, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Rumble, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Rumble, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Rumble, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Rumble, _impl_.flags_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Train, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Train, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_Train, _impl_.train_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayTextChannel, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayTextChannel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayTextChannel, _impl_.player_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayTextChannel, _impl_.channel_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_SayTextChannel, _impl_.text_),
+  1,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_MessageText, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_MessageText, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_MessageText, _impl_.color_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_MessageText, _impl_.text_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CameraTransition_Transition_DataDriven, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CameraTransition_Transition_DataDriven, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CameraTransition_Transition_DataDriven, _impl_.filename_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CameraTransition_Transition_DataDriven, _impl_.attach_ent_index_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CameraTransition, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CameraTransition, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CameraTransition, _impl_.camera_type_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CameraTransition, _impl_.duration_),
+  PROTOBUF_FIELD_OFFSET(::CUserMsg_CameraTransition, _impl_.params_data_driven_),
+  1,
+  2,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 7, -1, sizeof(::CUserMsg_AchievementEvent)},
+  { 8, 18, -1, sizeof(::CUserMsg_CloseCaption)},
+  { 22, 29, -1, sizeof(::CUserMsg_CurrentTimescale)},
+  { 30, 40, -1, sizeof(::CUserMsg_DesiredTimescale)},
+  { 44, 54, -1, sizeof(::CUserMsg_Fade)},
+  { 58, 68, -1, sizeof(::CUserMsg_Shake)},
+  { 72, 80, -1, sizeof(::CUserMsg_ShakeDir)},
+  { 82, 93, -1, sizeof(::CUserMsg_Tilt)},
+  { 98, 107, -1, sizeof(::CUserMsg_SayText)},
+  { 110, 122, -1, sizeof(::CUserMsg_SayText2)},
+  { 128, 145, -1, sizeof(::CUserMsg_HudMsg)},
+  { 156, 163, -1, sizeof(::CUserMsg_HudText)},
+  { 164, 172, -1, sizeof(::CUserMsg_TextMsg)},
+  { 174, -1, -1, sizeof(::CUserMsg_GameTitle)},
+  { 180, -1, -1, sizeof(::CUserMsg_ResetHUD)},
+  { 186, 194, -1, sizeof(::CUserMsg_SendAudio)},
+  { 196, 204, -1, sizeof(::CUserMsg_VoiceMask)},
+  { 206, -1, -1, sizeof(::CUserMsg_RequestState)},
+  { 212, 219, -1, sizeof(::CUserMsg_HintText)},
+  { 220, -1, -1, sizeof(::CUserMsg_KeyHintText)},
+  { 227, -1, -1, sizeof(::CUserMsg_StatsCrawlMsg)},
+  { 233, 241, -1, sizeof(::CUserMsg_StatsSkipState)},
+  { 243, 252, -1, sizeof(::CUserMsg_VoiceSubtitle)},
+  { 255, 263, -1, sizeof(::CUserMsg_VGUIMenu_Keys)},
+  { 265, 274, -1, sizeof(::CUserMsg_VGUIMenu)},
+  { 277, 284, -1, sizeof(::CUserMsg_Geiger)},
+  { 285, 294, -1, sizeof(::CUserMsg_Rumble)},
+  { 297, 304, -1, sizeof(::CUserMsg_Train)},
+  { 305, 314, -1, sizeof(::CUserMsg_SayTextChannel)},
+  { 317, 325, -1, sizeof(::CUserMsg_MessageText)},
+  { 327, 335, -1, sizeof(::CUserMsg_CameraTransition_Transition_DataDriven)},
+  { 337, 346, -1, sizeof(::CUserMsg_CameraTransition)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_CUserMsg_AchievementEvent_default_instance_._instance,
+  &::_CUserMsg_CloseCaption_default_instance_._instance,
+  &::_CUserMsg_CurrentTimescale_default_instance_._instance,
+  &::_CUserMsg_DesiredTimescale_default_instance_._instance,
+  &::_CUserMsg_Fade_default_instance_._instance,
+  &::_CUserMsg_Shake_default_instance_._instance,
+  &::_CUserMsg_ShakeDir_default_instance_._instance,
+  &::_CUserMsg_Tilt_default_instance_._instance,
+  &::_CUserMsg_SayText_default_instance_._instance,
+  &::_CUserMsg_SayText2_default_instance_._instance,
+  &::_CUserMsg_HudMsg_default_instance_._instance,
+  &::_CUserMsg_HudText_default_instance_._instance,
+  &::_CUserMsg_TextMsg_default_instance_._instance,
+  &::_CUserMsg_GameTitle_default_instance_._instance,
+  &::_CUserMsg_ResetHUD_default_instance_._instance,
+  &::_CUserMsg_SendAudio_default_instance_._instance,
+  &::_CUserMsg_VoiceMask_default_instance_._instance,
+  &::_CUserMsg_RequestState_default_instance_._instance,
+  &::_CUserMsg_HintText_default_instance_._instance,
+  &::_CUserMsg_KeyHintText_default_instance_._instance,
+  &::_CUserMsg_StatsCrawlMsg_default_instance_._instance,
+  &::_CUserMsg_StatsSkipState_default_instance_._instance,
+  &::_CUserMsg_VoiceSubtitle_default_instance_._instance,
+  &::_CUserMsg_VGUIMenu_Keys_default_instance_._instance,
+  &::_CUserMsg_VGUIMenu_default_instance_._instance,
+  &::_CUserMsg_Geiger_default_instance_._instance,
+  &::_CUserMsg_Rumble_default_instance_._instance,
+  &::_CUserMsg_Train_default_instance_._instance,
+  &::_CUserMsg_SayTextChannel_default_instance_._instance,
+  &::_CUserMsg_MessageText_default_instance_._instance,
+  &::_CUserMsg_CameraTransition_Transition_DataDriven_default_instance_._instance,
+  &::_CUserMsg_CameraTransition_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_usermessages_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022usermessages.proto\032\026networkbasetypes.p"
+  "roto\"0\n\031CUserMsg_AchievementEvent\022\023\n\013ach"
+  "ievement\030\001 \001(\r\"_\n\025CUserMsg_CloseCaption\022"
+  "\014\n\004hash\030\001 \001(\007\022\020\n\010duration\030\002 \001(\002\022\023\n\013from_"
+  "player\030\003 \001(\010\022\021\n\tent_index\030\004 \001(\005\",\n\031CUser"
+  "Msg_CurrentTimescale\022\017\n\007current\030\001 \001(\002\"n\n"
+  "\031CUserMsg_DesiredTimescale\022\017\n\007desired\030\001 "
+  "\001(\002\022\020\n\010duration\030\002 \001(\002\022\024\n\014interpolator\030\003 "
+  "\001(\r\022\030\n\020start_blend_time\030\004 \001(\002\"R\n\rCUserMs"
+  "g_Fade\022\020\n\010duration\030\001 \001(\r\022\021\n\thold_time\030\002 "
+  "\001(\r\022\r\n\005flags\030\003 \001(\r\022\r\n\005color\030\004 \001(\007\"Y\n\016CUs"
+  "erMsg_Shake\022\017\n\007command\030\001 \001(\r\022\021\n\tamplitud"
+  "e\030\002 \001(\002\022\021\n\tfrequency\030\003 \001(\002\022\020\n\010duration\030\004"
+  " \001(\002\"S\n\021CUserMsg_ShakeDir\022\036\n\005shake\030\001 \001(\013"
+  "2\017.CUserMsg_Shake\022\036\n\tdirection\030\002 \001(\0132\013.C"
+  "MsgVector\"q\n\rCUserMsg_Tilt\022\017\n\007command\030\001 "
+  "\001(\r\022\023\n\013ease_in_out\030\002 \001(\010\022\032\n\005angle\030\003 \001(\0132"
+  "\013.CMsgVector\022\020\n\010duration\030\004 \001(\002\022\014\n\004time\030\005"
+  " \001(\002\">\n\020CUserMsg_SayText\022\016\n\006client\030\001 \001(\r"
+  "\022\014\n\004text\030\002 \001(\t\022\014\n\004chat\030\003 \001(\010\"q\n\021CUserMsg"
+  "_SayText2\022\016\n\006client\030\001 \001(\r\022\014\n\004chat\030\002 \001(\010\022"
+  "\016\n\006format\030\003 \001(\t\022\016\n\006prefix\030\004 \001(\t\022\014\n\004text\030"
+  "\005 \001(\t\022\020\n\010location\030\006 \001(\t\"\312\001\n\017CUserMsg_Hud"
+  "Msg\022\017\n\007channel\030\001 \001(\r\022\t\n\001x\030\002 \001(\002\022\t\n\001y\030\003 \001"
+  "(\002\022\016\n\006color1\030\004 \001(\r\022\016\n\006color2\030\005 \001(\r\022\016\n\006ef"
+  "fect\030\006 \001(\r\022\024\n\014fade_in_time\030\007 \001(\002\022\025\n\rfade"
+  "_out_time\030\010 \001(\002\022\021\n\thold_time\030\t \001(\002\022\017\n\007fx"
+  "_time\030\n \001(\002\022\017\n\007message\030\013 \001(\t\"#\n\020CUserMsg"
+  "_HudText\022\017\n\007message\030\001 \001(\t\"/\n\020CUserMsg_Te"
+  "xtMsg\022\014\n\004dest\030\001 \001(\r\022\r\n\005param\030\002 \003(\t\"\024\n\022CU"
+  "serMsg_GameTitle\"\023\n\021CUserMsg_ResetHUD\"0\n"
+  "\022CUserMsg_SendAudio\022\014\n\004stop\030\002 \001(\010\022\014\n\004nam"
+  "e\030\003 \001(\t\"N\n\022CUserMsg_VoiceMask\022\034\n\024audible"
+  "_players_mask\030\001 \003(\005\022\032\n\022player_mod_enable"
+  "d\030\002 \001(\010\"\027\n\025CUserMsg_RequestState\"$\n\021CUse"
+  "rMsg_HintText\022\017\n\007message\030\001 \001(\t\"(\n\024CUserM"
+  "sg_KeyHintText\022\020\n\010messages\030\001 \003(\t\"\030\n\026CUse"
+  "rMsg_StatsCrawlMsg\"A\n\027CUserMsg_StatsSkip"
+  "State\022\021\n\tnum_skips\030\001 \001(\005\022\023\n\013num_players\030"
+  "\002 \001(\005\"G\n\026CUserMsg_VoiceSubtitle\022\021\n\tent_i"
+  "ndex\030\001 \001(\005\022\014\n\004menu\030\002 \001(\005\022\014\n\004item\030\003 \001(\005\"{"
+  "\n\021CUserMsg_VGUIMenu\022\014\n\004name\030\001 \001(\t\022\014\n\004sho"
+  "w\030\002 \001(\010\022%\n\004keys\030\003 \003(\0132\027.CUserMsg_VGUIMen"
+  "u.Keys\032#\n\004Keys\022\014\n\004name\030\001 \001(\t\022\r\n\005value\030\002 "
+  "\001(\t\" \n\017CUserMsg_Geiger\022\r\n\005range\030\001 \001(\005\"=\n"
+  "\017CUserMsg_Rumble\022\r\n\005index\030\001 \001(\005\022\014\n\004data\030"
+  "\002 \001(\005\022\r\n\005flags\030\003 \001(\005\"\037\n\016CUserMsg_Train\022\r"
+  "\n\005train\030\001 \001(\005\"H\n\027CUserMsg_SayTextChannel"
+  "\022\016\n\006player\030\001 \001(\005\022\017\n\007channel\030\002 \001(\005\022\014\n\004tex"
+  "t\030\003 \001(\t\"3\n\024CUserMsg_MessageText\022\r\n\005color"
+  "\030\001 \001(\r\022\014\n\004text\030\002 \001(\t\"\325\001\n\031CUserMsg_Camera"
+  "Transition\022\023\n\013camera_type\030\001 \001(\r\022\020\n\010durat"
+  "ion\030\002 \001(\002\022L\n\022params_data_driven\030\003 \001(\01320."
+  "CUserMsg_CameraTransition.Transition_Dat"
+  "aDriven\032C\n\025Transition_DataDriven\022\020\n\010file"
+  "name\030\001 \001(\t\022\030\n\020attach_ent_index\030\002 \001(\005*\355\004\n"
+  "\021EBaseUserMessages\022\027\n\023UM_AchievementEven"
+  "t\020\001\022\023\n\017UM_CloseCaption\020\002\022\031\n\025UM_CloseCapt"
+  "ionDirect\020\003\022\027\n\023UM_CurrentTimescale\020\004\022\027\n\023"
+  "UM_DesiredTimescale\020\005\022\013\n\007UM_Fade\020\006\022\020\n\014UM"
+  "_GameTitle\020\007\022\r\n\tUM_Geiger\020\010\022\017\n\013UM_HintTe"
+  "xt\020\t\022\r\n\tUM_HudMsg\020\n\022\016\n\nUM_HudText\020\013\022\022\n\016U"
+  "M_KeyHintText\020\014\022\022\n\016UM_MessageText\020\r\022\023\n\017U"
+  "M_RequestState\020\016\022\017\n\013UM_ResetHUD\020\017\022\r\n\tUM_"
+  "Rumble\020\020\022\016\n\nUM_SayText\020\021\022\017\n\013UM_SayText2\020"
+  "\022\022\025\n\021UM_SayTextChannel\020\023\022\014\n\010UM_Shake\020\024\022\017"
+  "\n\013UM_ShakeDir\020\025\022\024\n\020UM_StatsCrawlMsg\020\026\022\025\n"
+  "\021UM_StatsSkipState\020\027\022\016\n\nUM_TextMsg\020\030\022\013\n\007"
+  "UM_Tilt\020\031\022\014\n\010UM_Train\020\032\022\017\n\013UM_VGUIMenu\020\033"
+  "\022\020\n\014UM_VoiceMask\020\034\022\024\n\020UM_VoiceSubtitle\020\035"
+  "\022\020\n\014UM_SendAudio\020\036\022\027\n\023UM_CameraTransitio"
+  "n\020\037\022\017\n\013UM_MAX_BASE\020\?B\005H\001\200\001\000"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_usermessages_2eproto_deps[1] = {
+  &::descriptor_table_networkbasetypes_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_usermessages_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_usermessages_2eproto = {
+    false, false, 2867, descriptor_table_protodef_usermessages_2eproto,
+    "usermessages.proto",
+    &descriptor_table_usermessages_2eproto_once, descriptor_table_usermessages_2eproto_deps, 1, 32,
+    schemas, file_default_instances, TableStruct_usermessages_2eproto::offsets,
+    file_level_metadata_usermessages_2eproto, file_level_enum_descriptors_usermessages_2eproto,
+    file_level_service_descriptors_usermessages_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_usermessages_2eproto_getter() {
+  return &descriptor_table_usermessages_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_usermessages_2eproto(&descriptor_table_usermessages_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EBaseUserMessages_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_usermessages_2eproto);
+  return file_level_enum_descriptors_usermessages_2eproto[0];
+}
+bool EBaseUserMessages_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+    case 30:
+    case 31:
+    case 63:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class CUserMsg_AchievementEvent::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_AchievementEvent>()._impl_._has_bits_);
+  static void set_has_achievement(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_AchievementEvent::CUserMsg_AchievementEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_AchievementEvent)
+}
+CUserMsg_AchievementEvent::CUserMsg_AchievementEvent(const CUserMsg_AchievementEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_AchievementEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.achievement_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.achievement_ = from._impl_.achievement_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_AchievementEvent)
+}
+
+inline void CUserMsg_AchievementEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.achievement_){0u}
+  };
+}
+
+CUserMsg_AchievementEvent::~CUserMsg_AchievementEvent() {
+  // @@protoc_insertion_point(destructor:CUserMsg_AchievementEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_AchievementEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_AchievementEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_AchievementEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_AchievementEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.achievement_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_AchievementEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 achievement = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_achievement(&has_bits);
+          _impl_.achievement_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_AchievementEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_AchievementEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 achievement = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_achievement(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_AchievementEvent)
+  return target;
+}
+
+size_t CUserMsg_AchievementEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_AchievementEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint32 achievement = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_achievement());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_AchievementEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_AchievementEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_AchievementEvent::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_AchievementEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_AchievementEvent*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_AchievementEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_AchievementEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_achievement()) {
+    _this->_internal_set_achievement(from._internal_achievement());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_AchievementEvent::CopyFrom(const CUserMsg_AchievementEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_AchievementEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_AchievementEvent::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_AchievementEvent::InternalSwap(CUserMsg_AchievementEvent* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.achievement_, other->_impl_.achievement_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_AchievementEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[0]);
+}
+
+// ===================================================================
+
+class CUserMsg_CloseCaption::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_CloseCaption>()._impl_._has_bits_);
+  static void set_has_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_duration(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_from_player(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ent_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+CUserMsg_CloseCaption::CUserMsg_CloseCaption(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_CloseCaption)
+}
+CUserMsg_CloseCaption::CUserMsg_CloseCaption(const CUserMsg_CloseCaption& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_CloseCaption* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hash_){}
+    , decltype(_impl_.duration_){}
+    , decltype(_impl_.from_player_){}
+    , decltype(_impl_.ent_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.hash_, &from._impl_.hash_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ent_index_) -
+    reinterpret_cast<char*>(&_impl_.hash_)) + sizeof(_impl_.ent_index_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_CloseCaption)
+}
+
+inline void CUserMsg_CloseCaption::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hash_){0u}
+    , decltype(_impl_.duration_){0}
+    , decltype(_impl_.from_player_){false}
+    , decltype(_impl_.ent_index_){0}
+  };
+}
+
+CUserMsg_CloseCaption::~CUserMsg_CloseCaption() {
+  // @@protoc_insertion_point(destructor:CUserMsg_CloseCaption)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_CloseCaption::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_CloseCaption::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_CloseCaption::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_CloseCaption)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.hash_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.ent_index_) -
+        reinterpret_cast<char*>(&_impl_.hash_)) + sizeof(_impl_.ent_index_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_CloseCaption::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed32 hash = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_hash(&has_bits);
+          _impl_.hash_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float duration = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_duration(&has_bits);
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool from_player = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_from_player(&has_bits);
+          _impl_.from_player_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 ent_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_ent_index(&has_bits);
+          _impl_.ent_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_CloseCaption::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_CloseCaption)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional fixed32 hash = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(1, this->_internal_hash(), target);
+  }
+
+  // optional float duration = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_duration(), target);
+  }
+
+  // optional bool from_player = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_from_player(), target);
+  }
+
+  // optional int32 ent_index = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_ent_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_CloseCaption)
+  return target;
+}
+
+size_t CUserMsg_CloseCaption::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_CloseCaption)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional fixed32 hash = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float duration = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional bool from_player = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 ent_index = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_ent_index());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_CloseCaption::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_CloseCaption::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_CloseCaption::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_CloseCaption::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_CloseCaption*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_CloseCaption&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_CloseCaption)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.hash_ = from._impl_.hash_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.duration_ = from._impl_.duration_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.from_player_ = from._impl_.from_player_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.ent_index_ = from._impl_.ent_index_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_CloseCaption::CopyFrom(const CUserMsg_CloseCaption& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_CloseCaption)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_CloseCaption::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_CloseCaption::InternalSwap(CUserMsg_CloseCaption* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_CloseCaption, _impl_.ent_index_)
+      + sizeof(CUserMsg_CloseCaption::_impl_.ent_index_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_CloseCaption, _impl_.hash_)>(
+          reinterpret_cast<char*>(&_impl_.hash_),
+          reinterpret_cast<char*>(&other->_impl_.hash_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_CloseCaption::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[1]);
+}
+
+// ===================================================================
+
+class CUserMsg_CurrentTimescale::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_CurrentTimescale>()._impl_._has_bits_);
+  static void set_has_current(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_CurrentTimescale::CUserMsg_CurrentTimescale(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_CurrentTimescale)
+}
+CUserMsg_CurrentTimescale::CUserMsg_CurrentTimescale(const CUserMsg_CurrentTimescale& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_CurrentTimescale* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.current_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.current_ = from._impl_.current_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_CurrentTimescale)
+}
+
+inline void CUserMsg_CurrentTimescale::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.current_){0}
+  };
+}
+
+CUserMsg_CurrentTimescale::~CUserMsg_CurrentTimescale() {
+  // @@protoc_insertion_point(destructor:CUserMsg_CurrentTimescale)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_CurrentTimescale::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_CurrentTimescale::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_CurrentTimescale::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_CurrentTimescale)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.current_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_CurrentTimescale::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float current = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_current(&has_bits);
+          _impl_.current_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_CurrentTimescale::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_CurrentTimescale)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float current = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_current(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_CurrentTimescale)
+  return target;
+}
+
+size_t CUserMsg_CurrentTimescale::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_CurrentTimescale)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional float current = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_CurrentTimescale::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_CurrentTimescale::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_CurrentTimescale::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_CurrentTimescale::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_CurrentTimescale*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_CurrentTimescale&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_CurrentTimescale)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_current()) {
+    _this->_internal_set_current(from._internal_current());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_CurrentTimescale::CopyFrom(const CUserMsg_CurrentTimescale& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_CurrentTimescale)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_CurrentTimescale::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_CurrentTimescale::InternalSwap(CUserMsg_CurrentTimescale* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.current_, other->_impl_.current_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_CurrentTimescale::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[2]);
+}
+
+// ===================================================================
+
+class CUserMsg_DesiredTimescale::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_DesiredTimescale>()._impl_._has_bits_);
+  static void set_has_desired(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_duration(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_interpolator(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_start_blend_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+CUserMsg_DesiredTimescale::CUserMsg_DesiredTimescale(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_DesiredTimescale)
+}
+CUserMsg_DesiredTimescale::CUserMsg_DesiredTimescale(const CUserMsg_DesiredTimescale& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_DesiredTimescale* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.desired_){}
+    , decltype(_impl_.duration_){}
+    , decltype(_impl_.interpolator_){}
+    , decltype(_impl_.start_blend_time_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.desired_, &from._impl_.desired_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.start_blend_time_) -
+    reinterpret_cast<char*>(&_impl_.desired_)) + sizeof(_impl_.start_blend_time_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_DesiredTimescale)
+}
+
+inline void CUserMsg_DesiredTimescale::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.desired_){0}
+    , decltype(_impl_.duration_){0}
+    , decltype(_impl_.interpolator_){0u}
+    , decltype(_impl_.start_blend_time_){0}
+  };
+}
+
+CUserMsg_DesiredTimescale::~CUserMsg_DesiredTimescale() {
+  // @@protoc_insertion_point(destructor:CUserMsg_DesiredTimescale)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_DesiredTimescale::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_DesiredTimescale::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_DesiredTimescale::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_DesiredTimescale)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.desired_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.start_blend_time_) -
+        reinterpret_cast<char*>(&_impl_.desired_)) + sizeof(_impl_.start_blend_time_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_DesiredTimescale::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional float desired = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_desired(&has_bits);
+          _impl_.desired_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float duration = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_duration(&has_bits);
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 interpolator = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_interpolator(&has_bits);
+          _impl_.interpolator_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float start_blend_time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_start_blend_time(&has_bits);
+          _impl_.start_blend_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_DesiredTimescale::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_DesiredTimescale)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional float desired = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_desired(), target);
+  }
+
+  // optional float duration = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_duration(), target);
+  }
+
+  // optional uint32 interpolator = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_interpolator(), target);
+  }
+
+  // optional float start_blend_time = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_start_blend_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_DesiredTimescale)
+  return target;
+}
+
+size_t CUserMsg_DesiredTimescale::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_DesiredTimescale)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional float desired = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float duration = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 interpolator = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_interpolator());
+    }
+
+    // optional float start_blend_time = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_DesiredTimescale::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_DesiredTimescale::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_DesiredTimescale::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_DesiredTimescale::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_DesiredTimescale*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_DesiredTimescale&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_DesiredTimescale)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.desired_ = from._impl_.desired_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.duration_ = from._impl_.duration_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.interpolator_ = from._impl_.interpolator_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.start_blend_time_ = from._impl_.start_blend_time_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_DesiredTimescale::CopyFrom(const CUserMsg_DesiredTimescale& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_DesiredTimescale)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_DesiredTimescale::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_DesiredTimescale::InternalSwap(CUserMsg_DesiredTimescale* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_DesiredTimescale, _impl_.start_blend_time_)
+      + sizeof(CUserMsg_DesiredTimescale::_impl_.start_blend_time_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_DesiredTimescale, _impl_.desired_)>(
+          reinterpret_cast<char*>(&_impl_.desired_),
+          reinterpret_cast<char*>(&other->_impl_.desired_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_DesiredTimescale::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[3]);
+}
+
+// ===================================================================
+
+class CUserMsg_Fade::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_Fade>()._impl_._has_bits_);
+  static void set_has_duration(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_hold_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_flags(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+CUserMsg_Fade::CUserMsg_Fade(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_Fade)
+}
+CUserMsg_Fade::CUserMsg_Fade(const CUserMsg_Fade& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_Fade* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.duration_){}
+    , decltype(_impl_.hold_time_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.duration_, &from._impl_.duration_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.color_) -
+    reinterpret_cast<char*>(&_impl_.duration_)) + sizeof(_impl_.color_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_Fade)
+}
+
+inline void CUserMsg_Fade::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.duration_){0u}
+    , decltype(_impl_.hold_time_){0u}
+    , decltype(_impl_.flags_){0u}
+    , decltype(_impl_.color_){0u}
+  };
+}
+
+CUserMsg_Fade::~CUserMsg_Fade() {
+  // @@protoc_insertion_point(destructor:CUserMsg_Fade)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_Fade::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_Fade::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_Fade::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_Fade)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.duration_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.color_) -
+        reinterpret_cast<char*>(&_impl_.duration_)) + sizeof(_impl_.color_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_Fade::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 duration = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_duration(&has_bits);
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 hold_time = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_hold_time(&has_bits);
+          _impl_.hold_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 flags = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_flags(&has_bits);
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 color = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_color(&has_bits);
+          _impl_.color_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_Fade::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_Fade)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 duration = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_duration(), target);
+  }
+
+  // optional uint32 hold_time = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_hold_time(), target);
+  }
+
+  // optional uint32 flags = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_flags(), target);
+  }
+
+  // optional fixed32 color = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(4, this->_internal_color(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_Fade)
+  return target;
+}
+
+size_t CUserMsg_Fade::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_Fade)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional uint32 duration = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_duration());
+    }
+
+    // optional uint32 hold_time = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hold_time());
+    }
+
+    // optional uint32 flags = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_flags());
+    }
+
+    // optional fixed32 color = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_Fade::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_Fade::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_Fade::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_Fade::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_Fade*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_Fade&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_Fade)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.duration_ = from._impl_.duration_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.hold_time_ = from._impl_.hold_time_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.flags_ = from._impl_.flags_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.color_ = from._impl_.color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_Fade::CopyFrom(const CUserMsg_Fade& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_Fade)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_Fade::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_Fade::InternalSwap(CUserMsg_Fade* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_Fade, _impl_.color_)
+      + sizeof(CUserMsg_Fade::_impl_.color_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_Fade, _impl_.duration_)>(
+          reinterpret_cast<char*>(&_impl_.duration_),
+          reinterpret_cast<char*>(&other->_impl_.duration_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_Fade::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[4]);
+}
+
+// ===================================================================
+
+class CUserMsg_Shake::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_Shake>()._impl_._has_bits_);
+  static void set_has_command(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_amplitude(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_frequency(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_duration(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+CUserMsg_Shake::CUserMsg_Shake(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_Shake)
+}
+CUserMsg_Shake::CUserMsg_Shake(const CUserMsg_Shake& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_Shake* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.command_){}
+    , decltype(_impl_.amplitude_){}
+    , decltype(_impl_.frequency_){}
+    , decltype(_impl_.duration_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.command_, &from._impl_.command_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.duration_) -
+    reinterpret_cast<char*>(&_impl_.command_)) + sizeof(_impl_.duration_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_Shake)
+}
+
+inline void CUserMsg_Shake::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.command_){0u}
+    , decltype(_impl_.amplitude_){0}
+    , decltype(_impl_.frequency_){0}
+    , decltype(_impl_.duration_){0}
+  };
+}
+
+CUserMsg_Shake::~CUserMsg_Shake() {
+  // @@protoc_insertion_point(destructor:CUserMsg_Shake)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_Shake::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_Shake::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_Shake::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_Shake)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.command_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.duration_) -
+        reinterpret_cast<char*>(&_impl_.command_)) + sizeof(_impl_.duration_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_Shake::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 command = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_command(&has_bits);
+          _impl_.command_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float amplitude = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_amplitude(&has_bits);
+          _impl_.amplitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float frequency = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_frequency(&has_bits);
+          _impl_.frequency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float duration = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_duration(&has_bits);
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_Shake::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_Shake)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 command = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_command(), target);
+  }
+
+  // optional float amplitude = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_amplitude(), target);
+  }
+
+  // optional float frequency = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_frequency(), target);
+  }
+
+  // optional float duration = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_duration(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_Shake)
+  return target;
+}
+
+size_t CUserMsg_Shake::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_Shake)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional uint32 command = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_command());
+    }
+
+    // optional float amplitude = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float frequency = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float duration = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_Shake::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_Shake::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_Shake::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_Shake::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_Shake*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_Shake&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_Shake)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.command_ = from._impl_.command_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.amplitude_ = from._impl_.amplitude_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.frequency_ = from._impl_.frequency_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.duration_ = from._impl_.duration_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_Shake::CopyFrom(const CUserMsg_Shake& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_Shake)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_Shake::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_Shake::InternalSwap(CUserMsg_Shake* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_Shake, _impl_.duration_)
+      + sizeof(CUserMsg_Shake::_impl_.duration_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_Shake, _impl_.command_)>(
+          reinterpret_cast<char*>(&_impl_.command_),
+          reinterpret_cast<char*>(&other->_impl_.command_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_Shake::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[5]);
+}
+
+// ===================================================================
+
+class CUserMsg_ShakeDir::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_ShakeDir>()._impl_._has_bits_);
+  static const ::CUserMsg_Shake& shake(const CUserMsg_ShakeDir* msg);
+  static void set_has_shake(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::CMsgVector& direction(const CUserMsg_ShakeDir* msg);
+  static void set_has_direction(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::CUserMsg_Shake&
+CUserMsg_ShakeDir::_Internal::shake(const CUserMsg_ShakeDir* msg) {
+  return *msg->_impl_.shake_;
+}
+const ::CMsgVector&
+CUserMsg_ShakeDir::_Internal::direction(const CUserMsg_ShakeDir* msg) {
+  return *msg->_impl_.direction_;
+}
+void CUserMsg_ShakeDir::clear_direction() {
+  if (_impl_.direction_ != nullptr) _impl_.direction_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+CUserMsg_ShakeDir::CUserMsg_ShakeDir(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_ShakeDir)
+}
+CUserMsg_ShakeDir::CUserMsg_ShakeDir(const CUserMsg_ShakeDir& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_ShakeDir* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shake_){nullptr}
+    , decltype(_impl_.direction_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_shake()) {
+    _this->_impl_.shake_ = new ::CUserMsg_Shake(*from._impl_.shake_);
+  }
+  if (from._internal_has_direction()) {
+    _this->_impl_.direction_ = new ::CMsgVector(*from._impl_.direction_);
+  }
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_ShakeDir)
+}
+
+inline void CUserMsg_ShakeDir::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.shake_){nullptr}
+    , decltype(_impl_.direction_){nullptr}
+  };
+}
+
+CUserMsg_ShakeDir::~CUserMsg_ShakeDir() {
+  // @@protoc_insertion_point(destructor:CUserMsg_ShakeDir)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_ShakeDir::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.shake_;
+  if (this != internal_default_instance()) delete _impl_.direction_;
+}
+
+void CUserMsg_ShakeDir::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_ShakeDir::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_ShakeDir)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.shake_ != nullptr);
+      _impl_.shake_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.direction_ != nullptr);
+      _impl_.direction_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_ShakeDir::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .CUserMsg_Shake shake = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shake(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CMsgVector direction = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_direction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_ShakeDir::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_ShakeDir)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .CUserMsg_Shake shake = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::shake(this),
+        _Internal::shake(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .CMsgVector direction = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::direction(this),
+        _Internal::direction(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_ShakeDir)
+  return target;
+}
+
+size_t CUserMsg_ShakeDir::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_ShakeDir)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .CUserMsg_Shake shake = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.shake_);
+    }
+
+    // optional .CMsgVector direction = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.direction_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_ShakeDir::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_ShakeDir::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_ShakeDir::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_ShakeDir::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_ShakeDir*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_ShakeDir&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_ShakeDir)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_shake()->::CUserMsg_Shake::MergeFrom(
+          from._internal_shake());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_direction()->::CMsgVector::MergeFrom(
+          from._internal_direction());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_ShakeDir::CopyFrom(const CUserMsg_ShakeDir& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_ShakeDir)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_ShakeDir::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_ShakeDir::InternalSwap(CUserMsg_ShakeDir* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_ShakeDir, _impl_.direction_)
+      + sizeof(CUserMsg_ShakeDir::_impl_.direction_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_ShakeDir, _impl_.shake_)>(
+          reinterpret_cast<char*>(&_impl_.shake_),
+          reinterpret_cast<char*>(&other->_impl_.shake_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_ShakeDir::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[6]);
+}
+
+// ===================================================================
+
+class CUserMsg_Tilt::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_Tilt>()._impl_._has_bits_);
+  static void set_has_command(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_ease_in_out(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::CMsgVector& angle(const CUserMsg_Tilt* msg);
+  static void set_has_angle(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_duration(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::CMsgVector&
+CUserMsg_Tilt::_Internal::angle(const CUserMsg_Tilt* msg) {
+  return *msg->_impl_.angle_;
+}
+void CUserMsg_Tilt::clear_angle() {
+  if (_impl_.angle_ != nullptr) _impl_.angle_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+CUserMsg_Tilt::CUserMsg_Tilt(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_Tilt)
+}
+CUserMsg_Tilt::CUserMsg_Tilt(const CUserMsg_Tilt& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_Tilt* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.angle_){nullptr}
+    , decltype(_impl_.command_){}
+    , decltype(_impl_.ease_in_out_){}
+    , decltype(_impl_.duration_){}
+    , decltype(_impl_.time_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_angle()) {
+    _this->_impl_.angle_ = new ::CMsgVector(*from._impl_.angle_);
+  }
+  ::memcpy(&_impl_.command_, &from._impl_.command_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.time_) -
+    reinterpret_cast<char*>(&_impl_.command_)) + sizeof(_impl_.time_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_Tilt)
+}
+
+inline void CUserMsg_Tilt::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.angle_){nullptr}
+    , decltype(_impl_.command_){0u}
+    , decltype(_impl_.ease_in_out_){false}
+    , decltype(_impl_.duration_){0}
+    , decltype(_impl_.time_){0}
+  };
+}
+
+CUserMsg_Tilt::~CUserMsg_Tilt() {
+  // @@protoc_insertion_point(destructor:CUserMsg_Tilt)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_Tilt::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.angle_;
+}
+
+void CUserMsg_Tilt::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_Tilt::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_Tilt)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.angle_ != nullptr);
+    _impl_.angle_->Clear();
+  }
+  if (cached_has_bits & 0x0000001eu) {
+    ::memset(&_impl_.command_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.time_) -
+        reinterpret_cast<char*>(&_impl_.command_)) + sizeof(_impl_.time_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_Tilt::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 command = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_command(&has_bits);
+          _impl_.command_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool ease_in_out = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_ease_in_out(&has_bits);
+          _impl_.ease_in_out_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CMsgVector angle = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_angle(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float duration = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_duration(&has_bits);
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float time = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_time(&has_bits);
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_Tilt::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_Tilt)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 command = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_command(), target);
+  }
+
+  // optional bool ease_in_out = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_ease_in_out(), target);
+  }
+
+  // optional .CMsgVector angle = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::angle(this),
+        _Internal::angle(this).GetCachedSize(), target, stream);
+  }
+
+  // optional float duration = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_duration(), target);
+  }
+
+  // optional float time = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_Tilt)
+  return target;
+}
+
+size_t CUserMsg_Tilt::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_Tilt)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .CMsgVector angle = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.angle_);
+    }
+
+    // optional uint32 command = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_command());
+    }
+
+    // optional bool ease_in_out = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional float duration = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float time = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_Tilt::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_Tilt::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_Tilt::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_Tilt::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_Tilt*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_Tilt&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_Tilt)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_angle()->::CMsgVector::MergeFrom(
+          from._internal_angle());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.command_ = from._impl_.command_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.ease_in_out_ = from._impl_.ease_in_out_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.duration_ = from._impl_.duration_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.time_ = from._impl_.time_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_Tilt::CopyFrom(const CUserMsg_Tilt& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_Tilt)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_Tilt::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_Tilt::InternalSwap(CUserMsg_Tilt* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_Tilt, _impl_.time_)
+      + sizeof(CUserMsg_Tilt::_impl_.time_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_Tilt, _impl_.angle_)>(
+          reinterpret_cast<char*>(&_impl_.angle_),
+          reinterpret_cast<char*>(&other->_impl_.angle_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_Tilt::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[7]);
+}
+
+// ===================================================================
+
+class CUserMsg_SayText::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_SayText>()._impl_._has_bits_);
+  static void set_has_client(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_chat(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CUserMsg_SayText::CUserMsg_SayText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_SayText)
+}
+CUserMsg_SayText::CUserMsg_SayText(const CUserMsg_SayText& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_SayText* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.client_){}
+    , decltype(_impl_.chat_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.client_, &from._impl_.client_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.chat_) -
+    reinterpret_cast<char*>(&_impl_.client_)) + sizeof(_impl_.chat_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_SayText)
+}
+
+inline void CUserMsg_SayText::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.client_){0u}
+    , decltype(_impl_.chat_){false}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_SayText::~CUserMsg_SayText() {
+  // @@protoc_insertion_point(destructor:CUserMsg_SayText)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_SayText::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
+}
+
+void CUserMsg_SayText::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_SayText::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_SayText)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.text_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.client_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.chat_) -
+        reinterpret_cast<char*>(&_impl_.client_)) + sizeof(_impl_.chat_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_SayText::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 client = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_client(&has_bits);
+          _impl_.client_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string text = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_SayText.text");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool chat = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_chat(&has_bits);
+          _impl_.chat_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_SayText::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_SayText)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 client = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_client(), target);
+  }
+
+  // optional string text = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_SayText.text");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_text(), target);
+  }
+
+  // optional bool chat = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_chat(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_SayText)
+  return target;
+}
+
+size_t CUserMsg_SayText::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_SayText)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string text = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_text());
+    }
+
+    // optional uint32 client = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client());
+    }
+
+    // optional bool chat = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_SayText::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_SayText::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_SayText::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_SayText::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_SayText*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_SayText&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_SayText)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_text(from._internal_text());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.client_ = from._impl_.client_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.chat_ = from._impl_.chat_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_SayText::CopyFrom(const CUserMsg_SayText& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_SayText)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_SayText::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_SayText::InternalSwap(CUserMsg_SayText* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_SayText, _impl_.chat_)
+      + sizeof(CUserMsg_SayText::_impl_.chat_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_SayText, _impl_.client_)>(
+          reinterpret_cast<char*>(&_impl_.client_),
+          reinterpret_cast<char*>(&other->_impl_.client_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_SayText::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[8]);
+}
+
+// ===================================================================
+
+class CUserMsg_SayText2::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_SayText2>()._impl_._has_bits_);
+  static void set_has_client(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_chat(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_format(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_location(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+CUserMsg_SayText2::CUserMsg_SayText2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_SayText2)
+}
+CUserMsg_SayText2::CUserMsg_SayText2(const CUserMsg_SayText2& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_SayText2* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.location_){}
+    , decltype(_impl_.client_){}
+    , decltype(_impl_.chat_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_format()) {
+    _this->_impl_.format_.Set(from._internal_format(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_prefix()) {
+    _this->_impl_.prefix_.Set(from._internal_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.location_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.location_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_location()) {
+    _this->_impl_.location_.Set(from._internal_location(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.client_, &from._impl_.client_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.chat_) -
+    reinterpret_cast<char*>(&_impl_.client_)) + sizeof(_impl_.chat_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_SayText2)
+}
+
+inline void CUserMsg_SayText2::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.format_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.location_){}
+    , decltype(_impl_.client_){0u}
+    , decltype(_impl_.chat_){false}
+  };
+  _impl_.format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.location_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.location_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_SayText2::~CUserMsg_SayText2() {
+  // @@protoc_insertion_point(destructor:CUserMsg_SayText2)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_SayText2::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.format_.Destroy();
+  _impl_.prefix_.Destroy();
+  _impl_.text_.Destroy();
+  _impl_.location_.Destroy();
+}
+
+void CUserMsg_SayText2::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_SayText2::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_SayText2)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.format_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.prefix_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.text_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.location_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x00000030u) {
+    ::memset(&_impl_.client_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.chat_) -
+        reinterpret_cast<char*>(&_impl_.client_)) + sizeof(_impl_.chat_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_SayText2::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 client = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_client(&has_bits);
+          _impl_.client_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool chat = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_chat(&has_bits);
+          _impl_.chat_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string format = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_format();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_SayText2.format");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string prefix = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_SayText2.prefix");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string text = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_SayText2.text");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string location = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_location();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_SayText2.location");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_SayText2::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_SayText2)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 client = 1;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_client(), target);
+  }
+
+  // optional bool chat = 2;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_chat(), target);
+  }
+
+  // optional string format = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_format().data(), static_cast<int>(this->_internal_format().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_SayText2.format");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_format(), target);
+  }
+
+  // optional string prefix = 4;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_prefix().data(), static_cast<int>(this->_internal_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_SayText2.prefix");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_prefix(), target);
+  }
+
+  // optional string text = 5;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_SayText2.text");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_text(), target);
+  }
+
+  // optional string location = 6;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_location().data(), static_cast<int>(this->_internal_location().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_SayText2.location");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_location(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_SayText2)
+  return target;
+}
+
+size_t CUserMsg_SayText2::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_SayText2)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string format = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_format());
+    }
+
+    // optional string prefix = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_prefix());
+    }
+
+    // optional string text = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_text());
+    }
+
+    // optional string location = 6;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_location());
+    }
+
+    // optional uint32 client = 1;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_client());
+    }
+
+    // optional bool chat = 2;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_SayText2::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_SayText2::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_SayText2::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_SayText2::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_SayText2*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_SayText2&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_SayText2)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_format(from._internal_format());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_prefix(from._internal_prefix());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_text(from._internal_text());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_location(from._internal_location());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.client_ = from._impl_.client_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.chat_ = from._impl_.chat_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_SayText2::CopyFrom(const CUserMsg_SayText2& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_SayText2)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_SayText2::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_SayText2::InternalSwap(CUserMsg_SayText2* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.format_, lhs_arena,
+      &other->_impl_.format_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prefix_, lhs_arena,
+      &other->_impl_.prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.location_, lhs_arena,
+      &other->_impl_.location_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_SayText2, _impl_.chat_)
+      + sizeof(CUserMsg_SayText2::_impl_.chat_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_SayText2, _impl_.client_)>(
+          reinterpret_cast<char*>(&_impl_.client_),
+          reinterpret_cast<char*>(&other->_impl_.client_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_SayText2::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[9]);
+}
+
+// ===================================================================
+
+class CUserMsg_HudMsg::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_HudMsg>()._impl_._has_bits_);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_color1(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_color2(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_effect(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_fade_in_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_fade_out_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_hold_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_fx_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_HudMsg::CUserMsg_HudMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_HudMsg)
+}
+CUserMsg_HudMsg::CUserMsg_HudMsg(const CUserMsg_HudMsg& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_HudMsg* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.color1_){}
+    , decltype(_impl_.color2_){}
+    , decltype(_impl_.effect_){}
+    , decltype(_impl_.fade_in_time_){}
+    , decltype(_impl_.fade_out_time_){}
+    , decltype(_impl_.hold_time_){}
+    , decltype(_impl_.fx_time_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.channel_, &from._impl_.channel_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.fx_time_) -
+    reinterpret_cast<char*>(&_impl_.channel_)) + sizeof(_impl_.fx_time_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_HudMsg)
+}
+
+inline void CUserMsg_HudMsg::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.channel_){0u}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.color1_){0u}
+    , decltype(_impl_.color2_){0u}
+    , decltype(_impl_.effect_){0u}
+    , decltype(_impl_.fade_in_time_){0}
+    , decltype(_impl_.fade_out_time_){0}
+    , decltype(_impl_.hold_time_){0}
+    , decltype(_impl_.fx_time_){0}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_HudMsg::~CUserMsg_HudMsg() {
+  // @@protoc_insertion_point(destructor:CUserMsg_HudMsg)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_HudMsg::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+}
+
+void CUserMsg_HudMsg::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_HudMsg::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_HudMsg)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.message_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.channel_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.fade_in_time_) -
+        reinterpret_cast<char*>(&_impl_.channel_)) + sizeof(_impl_.fade_in_time_));
+  }
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.fade_out_time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.fx_time_) -
+        reinterpret_cast<char*>(&_impl_.fade_out_time_)) + sizeof(_impl_.fx_time_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_HudMsg::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 channel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_channel(&has_bits);
+          _impl_.channel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float x = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float y = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 color1 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_color1(&has_bits);
+          _impl_.color1_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 color2 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_color2(&has_bits);
+          _impl_.color2_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 effect = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_effect(&has_bits);
+          _impl_.effect_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float fade_in_time = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_fade_in_time(&has_bits);
+          _impl_.fade_in_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float fade_out_time = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_fade_out_time(&has_bits);
+          _impl_.fade_out_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float hold_time = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_hold_time(&has_bits);
+          _impl_.hold_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float fx_time = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _Internal::set_has_fx_time(&has_bits);
+          _impl_.fx_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string message = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_HudMsg.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_HudMsg::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_HudMsg)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 channel = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_channel(), target);
+  }
+
+  // optional float x = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_x(), target);
+  }
+
+  // optional float y = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_y(), target);
+  }
+
+  // optional uint32 color1 = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_color1(), target);
+  }
+
+  // optional uint32 color2 = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_color2(), target);
+  }
+
+  // optional uint32 effect = 6;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_effect(), target);
+  }
+
+  // optional float fade_in_time = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_fade_in_time(), target);
+  }
+
+  // optional float fade_out_time = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_fade_out_time(), target);
+  }
+
+  // optional float hold_time = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_hold_time(), target);
+  }
+
+  // optional float fx_time = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(10, this->_internal_fx_time(), target);
+  }
+
+  // optional string message = 11;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_HudMsg.message");
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_HudMsg)
+  return target;
+}
+
+size_t CUserMsg_HudMsg::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_HudMsg)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string message = 11;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_message());
+    }
+
+    // optional uint32 channel = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_channel());
+    }
+
+    // optional float x = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float y = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 color1 = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_color1());
+    }
+
+    // optional uint32 color2 = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_color2());
+    }
+
+    // optional uint32 effect = 6;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_effect());
+    }
+
+    // optional float fade_in_time = 7;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  if (cached_has_bits & 0x00000700u) {
+    // optional float fade_out_time = 8;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float hold_time = 9;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float fx_time = 10;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_HudMsg::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_HudMsg::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_HudMsg::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_HudMsg::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_HudMsg*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_HudMsg&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_HudMsg)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_message(from._internal_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.channel_ = from._impl_.channel_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.color1_ = from._impl_.color1_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.color2_ = from._impl_.color2_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.effect_ = from._impl_.effect_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.fade_in_time_ = from._impl_.fade_in_time_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.fade_out_time_ = from._impl_.fade_out_time_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.hold_time_ = from._impl_.hold_time_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.fx_time_ = from._impl_.fx_time_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_HudMsg::CopyFrom(const CUserMsg_HudMsg& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_HudMsg)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_HudMsg::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_HudMsg::InternalSwap(CUserMsg_HudMsg* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_HudMsg, _impl_.fx_time_)
+      + sizeof(CUserMsg_HudMsg::_impl_.fx_time_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_HudMsg, _impl_.channel_)>(
+          reinterpret_cast<char*>(&_impl_.channel_),
+          reinterpret_cast<char*>(&other->_impl_.channel_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_HudMsg::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[10]);
+}
+
+// ===================================================================
+
+class CUserMsg_HudText::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_HudText>()._impl_._has_bits_);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_HudText::CUserMsg_HudText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_HudText)
+}
+CUserMsg_HudText::CUserMsg_HudText(const CUserMsg_HudText& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_HudText* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_HudText)
+}
+
+inline void CUserMsg_HudText::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_HudText::~CUserMsg_HudText() {
+  // @@protoc_insertion_point(destructor:CUserMsg_HudText)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_HudText::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+}
+
+void CUserMsg_HudText::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_HudText::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_HudText)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.message_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_HudText::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_HudText.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_HudText::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_HudText)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_HudText.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_HudText)
+  return target;
+}
+
+size_t CUserMsg_HudText::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_HudText)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string message = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_HudText::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_HudText::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_HudText::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_HudText::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_HudText*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_HudText&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_HudText)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_message()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_HudText::CopyFrom(const CUserMsg_HudText& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_HudText)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_HudText::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_HudText::InternalSwap(CUserMsg_HudText* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_HudText::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[11]);
+}
+
+// ===================================================================
+
+class CUserMsg_TextMsg::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_TextMsg>()._impl_._has_bits_);
+  static void set_has_dest(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_TextMsg::CUserMsg_TextMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_TextMsg)
+}
+CUserMsg_TextMsg::CUserMsg_TextMsg(const CUserMsg_TextMsg& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_TextMsg* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.param_){from._impl_.param_}
+    , decltype(_impl_.dest_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.dest_ = from._impl_.dest_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_TextMsg)
+}
+
+inline void CUserMsg_TextMsg::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.param_){arena}
+    , decltype(_impl_.dest_){0u}
+  };
+}
+
+CUserMsg_TextMsg::~CUserMsg_TextMsg() {
+  // @@protoc_insertion_point(destructor:CUserMsg_TextMsg)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_TextMsg::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.param_.~RepeatedPtrField();
+}
+
+void CUserMsg_TextMsg::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_TextMsg::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_TextMsg)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.param_.Clear();
+  _impl_.dest_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_TextMsg::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 dest = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_dest(&has_bits);
+          _impl_.dest_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string param = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_param();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "CUserMsg_TextMsg.param");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_TextMsg::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_TextMsg)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 dest = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_dest(), target);
+  }
+
+  // repeated string param = 2;
+  for (int i = 0, n = this->_internal_param_size(); i < n; i++) {
+    const auto& s = this->_internal_param(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_TextMsg.param");
+    target = stream->WriteString(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_TextMsg)
+  return target;
+}
+
+size_t CUserMsg_TextMsg::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_TextMsg)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string param = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.param_.size());
+  for (int i = 0, n = _impl_.param_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.param_.Get(i));
+  }
+
+  // optional uint32 dest = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dest());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_TextMsg::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_TextMsg::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_TextMsg::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_TextMsg::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_TextMsg*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_TextMsg&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_TextMsg)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.param_.MergeFrom(from._impl_.param_);
+  if (from._internal_has_dest()) {
+    _this->_internal_set_dest(from._internal_dest());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_TextMsg::CopyFrom(const CUserMsg_TextMsg& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_TextMsg)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_TextMsg::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_TextMsg::InternalSwap(CUserMsg_TextMsg* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.param_.InternalSwap(&other->_impl_.param_);
+  swap(_impl_.dest_, other->_impl_.dest_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_TextMsg::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[12]);
+}
+
+// ===================================================================
+
+class CUserMsg_GameTitle::_Internal {
+ public:
+};
+
+CUserMsg_GameTitle::CUserMsg_GameTitle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_GameTitle)
+}
+CUserMsg_GameTitle::CUserMsg_GameTitle(const CUserMsg_GameTitle& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CUserMsg_GameTitle* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_GameTitle)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_GameTitle::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_GameTitle::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_GameTitle::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[13]);
+}
+
+// ===================================================================
+
+class CUserMsg_ResetHUD::_Internal {
+ public:
+};
+
+CUserMsg_ResetHUD::CUserMsg_ResetHUD(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_ResetHUD)
+}
+CUserMsg_ResetHUD::CUserMsg_ResetHUD(const CUserMsg_ResetHUD& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CUserMsg_ResetHUD* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_ResetHUD)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_ResetHUD::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_ResetHUD::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_ResetHUD::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[14]);
+}
+
+// ===================================================================
+
+class CUserMsg_SendAudio::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_SendAudio>()._impl_._has_bits_);
+  static void set_has_stop(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_SendAudio::CUserMsg_SendAudio(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_SendAudio)
+}
+CUserMsg_SendAudio::CUserMsg_SendAudio(const CUserMsg_SendAudio& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_SendAudio* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.stop_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.stop_ = from._impl_.stop_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_SendAudio)
+}
+
+inline void CUserMsg_SendAudio::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.stop_){false}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_SendAudio::~CUserMsg_SendAudio() {
+  // @@protoc_insertion_point(destructor:CUserMsg_SendAudio)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_SendAudio::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void CUserMsg_SendAudio::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_SendAudio::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_SendAudio)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.stop_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_SendAudio::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool stop = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_stop(&has_bits);
+          _impl_.stop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_SendAudio.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_SendAudio::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_SendAudio)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool stop = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_stop(), target);
+  }
+
+  // optional string name = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_SendAudio.name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_SendAudio)
+  return target;
+}
+
+size_t CUserMsg_SendAudio::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_SendAudio)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional bool stop = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_SendAudio::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_SendAudio::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_SendAudio::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_SendAudio::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_SendAudio*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_SendAudio&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_SendAudio)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.stop_ = from._impl_.stop_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_SendAudio::CopyFrom(const CUserMsg_SendAudio& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_SendAudio)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_SendAudio::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_SendAudio::InternalSwap(CUserMsg_SendAudio* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.stop_, other->_impl_.stop_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_SendAudio::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[15]);
+}
+
+// ===================================================================
+
+class CUserMsg_VoiceMask::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_VoiceMask>()._impl_._has_bits_);
+  static void set_has_player_mod_enabled(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_VoiceMask::CUserMsg_VoiceMask(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_VoiceMask)
+}
+CUserMsg_VoiceMask::CUserMsg_VoiceMask(const CUserMsg_VoiceMask& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_VoiceMask* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.audible_players_mask_){from._impl_.audible_players_mask_}
+    , decltype(_impl_.player_mod_enabled_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.player_mod_enabled_ = from._impl_.player_mod_enabled_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_VoiceMask)
+}
+
+inline void CUserMsg_VoiceMask::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.audible_players_mask_){arena}
+    , decltype(_impl_.player_mod_enabled_){false}
+  };
+}
+
+CUserMsg_VoiceMask::~CUserMsg_VoiceMask() {
+  // @@protoc_insertion_point(destructor:CUserMsg_VoiceMask)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_VoiceMask::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.audible_players_mask_.~RepeatedField();
+}
+
+void CUserMsg_VoiceMask::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_VoiceMask::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_VoiceMask)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.audible_players_mask_.Clear();
+  _impl_.player_mod_enabled_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_VoiceMask::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 audible_players_mask = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_audible_players_mask(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_audible_players_mask(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool player_mod_enabled = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_player_mod_enabled(&has_bits);
+          _impl_.player_mod_enabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_VoiceMask::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_VoiceMask)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 audible_players_mask = 1;
+  for (int i = 0, n = this->_internal_audible_players_mask_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_audible_players_mask(i), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool player_mod_enabled = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_player_mod_enabled(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_VoiceMask)
+  return target;
+}
+
+size_t CUserMsg_VoiceMask::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_VoiceMask)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 audible_players_mask = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.audible_players_mask_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_audible_players_mask_size());
+    total_size += data_size;
+  }
+
+  // optional bool player_mod_enabled = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_VoiceMask::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_VoiceMask::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_VoiceMask::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_VoiceMask::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_VoiceMask*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_VoiceMask&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_VoiceMask)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.audible_players_mask_.MergeFrom(from._impl_.audible_players_mask_);
+  if (from._internal_has_player_mod_enabled()) {
+    _this->_internal_set_player_mod_enabled(from._internal_player_mod_enabled());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_VoiceMask::CopyFrom(const CUserMsg_VoiceMask& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_VoiceMask)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_VoiceMask::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_VoiceMask::InternalSwap(CUserMsg_VoiceMask* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.audible_players_mask_.InternalSwap(&other->_impl_.audible_players_mask_);
+  swap(_impl_.player_mod_enabled_, other->_impl_.player_mod_enabled_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_VoiceMask::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[16]);
+}
+
+// ===================================================================
+
+class CUserMsg_RequestState::_Internal {
+ public:
+};
+
+CUserMsg_RequestState::CUserMsg_RequestState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_RequestState)
+}
+CUserMsg_RequestState::CUserMsg_RequestState(const CUserMsg_RequestState& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CUserMsg_RequestState* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_RequestState)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_RequestState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_RequestState::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_RequestState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[17]);
+}
+
+// ===================================================================
+
+class CUserMsg_HintText::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_HintText>()._impl_._has_bits_);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_HintText::CUserMsg_HintText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_HintText)
+}
+CUserMsg_HintText::CUserMsg_HintText(const CUserMsg_HintText& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_HintText* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_message()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_HintText)
+}
+
+inline void CUserMsg_HintText::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.message_){}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_HintText::~CUserMsg_HintText() {
+  // @@protoc_insertion_point(destructor:CUserMsg_HintText)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_HintText::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+}
+
+void CUserMsg_HintText::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_HintText::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_HintText)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.message_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_HintText::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_HintText.message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_HintText::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_HintText)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string message = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_HintText.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_HintText)
+  return target;
+}
+
+size_t CUserMsg_HintText::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_HintText)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string message = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_HintText::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_HintText::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_HintText::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_HintText::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_HintText*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_HintText&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_HintText)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_message()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_HintText::CopyFrom(const CUserMsg_HintText& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_HintText)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_HintText::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_HintText::InternalSwap(CUserMsg_HintText* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_HintText::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[18]);
+}
+
+// ===================================================================
+
+class CUserMsg_KeyHintText::_Internal {
+ public:
+};
+
+CUserMsg_KeyHintText::CUserMsg_KeyHintText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_KeyHintText)
+}
+CUserMsg_KeyHintText::CUserMsg_KeyHintText(const CUserMsg_KeyHintText& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_KeyHintText* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_KeyHintText)
+}
+
+inline void CUserMsg_KeyHintText::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CUserMsg_KeyHintText::~CUserMsg_KeyHintText() {
+  // @@protoc_insertion_point(destructor:CUserMsg_KeyHintText)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_KeyHintText::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+}
+
+void CUserMsg_KeyHintText::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_KeyHintText::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_KeyHintText)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_KeyHintText::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string messages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_messages();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "CUserMsg_KeyHintText.messages");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_KeyHintText::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_KeyHintText)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string messages = 1;
+  for (int i = 0, n = this->_internal_messages_size(); i < n; i++) {
+    const auto& s = this->_internal_messages(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_KeyHintText.messages");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_KeyHintText)
+  return target;
+}
+
+size_t CUserMsg_KeyHintText::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_KeyHintText)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string messages = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.messages_.size());
+  for (int i = 0, n = _impl_.messages_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.messages_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_KeyHintText::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_KeyHintText::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_KeyHintText::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_KeyHintText::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_KeyHintText*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_KeyHintText&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_KeyHintText)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_KeyHintText::CopyFrom(const CUserMsg_KeyHintText& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_KeyHintText)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_KeyHintText::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_KeyHintText::InternalSwap(CUserMsg_KeyHintText* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_KeyHintText::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[19]);
+}
+
+// ===================================================================
+
+class CUserMsg_StatsCrawlMsg::_Internal {
+ public:
+};
+
+CUserMsg_StatsCrawlMsg::CUserMsg_StatsCrawlMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_StatsCrawlMsg)
+}
+CUserMsg_StatsCrawlMsg::CUserMsg_StatsCrawlMsg(const CUserMsg_StatsCrawlMsg& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CUserMsg_StatsCrawlMsg* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_StatsCrawlMsg)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_StatsCrawlMsg::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_StatsCrawlMsg::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_StatsCrawlMsg::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[20]);
+}
+
+// ===================================================================
+
+class CUserMsg_StatsSkipState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_StatsSkipState>()._impl_._has_bits_);
+  static void set_has_num_skips(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_num_players(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CUserMsg_StatsSkipState::CUserMsg_StatsSkipState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_StatsSkipState)
+}
+CUserMsg_StatsSkipState::CUserMsg_StatsSkipState(const CUserMsg_StatsSkipState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_StatsSkipState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_skips_){}
+    , decltype(_impl_.num_players_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.num_skips_, &from._impl_.num_skips_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_players_) -
+    reinterpret_cast<char*>(&_impl_.num_skips_)) + sizeof(_impl_.num_players_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_StatsSkipState)
+}
+
+inline void CUserMsg_StatsSkipState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_skips_){0}
+    , decltype(_impl_.num_players_){0}
+  };
+}
+
+CUserMsg_StatsSkipState::~CUserMsg_StatsSkipState() {
+  // @@protoc_insertion_point(destructor:CUserMsg_StatsSkipState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_StatsSkipState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_StatsSkipState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_StatsSkipState::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_StatsSkipState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.num_skips_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_players_) -
+        reinterpret_cast<char*>(&_impl_.num_skips_)) + sizeof(_impl_.num_players_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_StatsSkipState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 num_skips = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_skips(&has_bits);
+          _impl_.num_skips_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_players = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_players(&has_bits);
+          _impl_.num_players_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_StatsSkipState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_StatsSkipState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 num_skips = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_num_skips(), target);
+  }
+
+  // optional int32 num_players = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_num_players(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_StatsSkipState)
+  return target;
+}
+
+size_t CUserMsg_StatsSkipState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_StatsSkipState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 num_skips = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_skips());
+    }
+
+    // optional int32 num_players = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_players());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_StatsSkipState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_StatsSkipState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_StatsSkipState::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_StatsSkipState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_StatsSkipState*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_StatsSkipState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_StatsSkipState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.num_skips_ = from._impl_.num_skips_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.num_players_ = from._impl_.num_players_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_StatsSkipState::CopyFrom(const CUserMsg_StatsSkipState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_StatsSkipState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_StatsSkipState::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_StatsSkipState::InternalSwap(CUserMsg_StatsSkipState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_StatsSkipState, _impl_.num_players_)
+      + sizeof(CUserMsg_StatsSkipState::_impl_.num_players_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_StatsSkipState, _impl_.num_skips_)>(
+          reinterpret_cast<char*>(&_impl_.num_skips_),
+          reinterpret_cast<char*>(&other->_impl_.num_skips_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_StatsSkipState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[21]);
+}
+
+// ===================================================================
+
+class CUserMsg_VoiceSubtitle::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_VoiceSubtitle>()._impl_._has_bits_);
+  static void set_has_ent_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_menu(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_item(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CUserMsg_VoiceSubtitle::CUserMsg_VoiceSubtitle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_VoiceSubtitle)
+}
+CUserMsg_VoiceSubtitle::CUserMsg_VoiceSubtitle(const CUserMsg_VoiceSubtitle& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_VoiceSubtitle* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ent_index_){}
+    , decltype(_impl_.menu_){}
+    , decltype(_impl_.item_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ent_index_, &from._impl_.ent_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.item_) -
+    reinterpret_cast<char*>(&_impl_.ent_index_)) + sizeof(_impl_.item_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_VoiceSubtitle)
+}
+
+inline void CUserMsg_VoiceSubtitle::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ent_index_){0}
+    , decltype(_impl_.menu_){0}
+    , decltype(_impl_.item_){0}
+  };
+}
+
+CUserMsg_VoiceSubtitle::~CUserMsg_VoiceSubtitle() {
+  // @@protoc_insertion_point(destructor:CUserMsg_VoiceSubtitle)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_VoiceSubtitle::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_VoiceSubtitle::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_VoiceSubtitle::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_VoiceSubtitle)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.ent_index_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.item_) -
+        reinterpret_cast<char*>(&_impl_.ent_index_)) + sizeof(_impl_.item_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_VoiceSubtitle::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 ent_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_ent_index(&has_bits);
+          _impl_.ent_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 menu = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_menu(&has_bits);
+          _impl_.menu_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 item = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_item(&has_bits);
+          _impl_.item_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_VoiceSubtitle::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_VoiceSubtitle)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 ent_index = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_ent_index(), target);
+  }
+
+  // optional int32 menu = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_menu(), target);
+  }
+
+  // optional int32 item = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_item(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_VoiceSubtitle)
+  return target;
+}
+
+size_t CUserMsg_VoiceSubtitle::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_VoiceSubtitle)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 ent_index = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_ent_index());
+    }
+
+    // optional int32 menu = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_menu());
+    }
+
+    // optional int32 item = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_item());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_VoiceSubtitle::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_VoiceSubtitle::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_VoiceSubtitle::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_VoiceSubtitle::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_VoiceSubtitle*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_VoiceSubtitle&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_VoiceSubtitle)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.ent_index_ = from._impl_.ent_index_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.menu_ = from._impl_.menu_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.item_ = from._impl_.item_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_VoiceSubtitle::CopyFrom(const CUserMsg_VoiceSubtitle& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_VoiceSubtitle)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_VoiceSubtitle::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_VoiceSubtitle::InternalSwap(CUserMsg_VoiceSubtitle* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_VoiceSubtitle, _impl_.item_)
+      + sizeof(CUserMsg_VoiceSubtitle::_impl_.item_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_VoiceSubtitle, _impl_.ent_index_)>(
+          reinterpret_cast<char*>(&_impl_.ent_index_),
+          reinterpret_cast<char*>(&other->_impl_.ent_index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_VoiceSubtitle::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[22]);
+}
+
+// ===================================================================
+
+class CUserMsg_VGUIMenu_Keys::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_VGUIMenu_Keys>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CUserMsg_VGUIMenu_Keys::CUserMsg_VGUIMenu_Keys(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_VGUIMenu.Keys)
+}
+CUserMsg_VGUIMenu_Keys::CUserMsg_VGUIMenu_Keys(const CUserMsg_VGUIMenu_Keys& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_VGUIMenu_Keys* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_VGUIMenu.Keys)
+}
+
+inline void CUserMsg_VGUIMenu_Keys::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_VGUIMenu_Keys::~CUserMsg_VGUIMenu_Keys() {
+  // @@protoc_insertion_point(destructor:CUserMsg_VGUIMenu.Keys)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_VGUIMenu_Keys::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void CUserMsg_VGUIMenu_Keys::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_VGUIMenu_Keys::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_VGUIMenu.Keys)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_VGUIMenu_Keys::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_VGUIMenu.Keys.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_VGUIMenu.Keys.value");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_VGUIMenu_Keys::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_VGUIMenu.Keys)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_VGUIMenu.Keys.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string value = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_VGUIMenu.Keys.value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_VGUIMenu.Keys)
+  return target;
+}
+
+size_t CUserMsg_VGUIMenu_Keys::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_VGUIMenu.Keys)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string value = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_value());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_VGUIMenu_Keys::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_VGUIMenu_Keys::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_VGUIMenu_Keys::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_VGUIMenu_Keys::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_VGUIMenu_Keys*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_VGUIMenu_Keys&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_VGUIMenu.Keys)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_VGUIMenu_Keys::CopyFrom(const CUserMsg_VGUIMenu_Keys& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_VGUIMenu.Keys)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_VGUIMenu_Keys::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_VGUIMenu_Keys::InternalSwap(CUserMsg_VGUIMenu_Keys* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_VGUIMenu_Keys::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[23]);
+}
+
+// ===================================================================
+
+class CUserMsg_VGUIMenu::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_VGUIMenu>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_show(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CUserMsg_VGUIMenu::CUserMsg_VGUIMenu(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_VGUIMenu)
+}
+CUserMsg_VGUIMenu::CUserMsg_VGUIMenu(const CUserMsg_VGUIMenu& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_VGUIMenu* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.show_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.show_ = from._impl_.show_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_VGUIMenu)
+}
+
+inline void CUserMsg_VGUIMenu::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.show_){false}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_VGUIMenu::~CUserMsg_VGUIMenu() {
+  // @@protoc_insertion_point(destructor:CUserMsg_VGUIMenu)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_VGUIMenu::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void CUserMsg_VGUIMenu::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_VGUIMenu::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_VGUIMenu)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_.show_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_VGUIMenu::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_VGUIMenu.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool show = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_show(&has_bits);
+          _impl_.show_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .CUserMsg_VGUIMenu.Keys keys = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_keys(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_VGUIMenu::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_VGUIMenu)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_VGUIMenu.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional bool show = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_show(), target);
+  }
+
+  // repeated .CUserMsg_VGUIMenu.Keys keys = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_keys_size()); i < n; i++) {
+    const auto& repfield = this->_internal_keys(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_VGUIMenu)
+  return target;
+}
+
+size_t CUserMsg_VGUIMenu::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_VGUIMenu)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .CUserMsg_VGUIMenu.Keys keys = 3;
+  total_size += 1UL * this->_internal_keys_size();
+  for (const auto& msg : this->_impl_.keys_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional bool show = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_VGUIMenu::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_VGUIMenu::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_VGUIMenu::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_VGUIMenu::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_VGUIMenu*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_VGUIMenu&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_VGUIMenu)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.show_ = from._impl_.show_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_VGUIMenu::CopyFrom(const CUserMsg_VGUIMenu& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_VGUIMenu)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_VGUIMenu::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_VGUIMenu::InternalSwap(CUserMsg_VGUIMenu* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.show_, other->_impl_.show_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_VGUIMenu::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[24]);
+}
+
+// ===================================================================
+
+class CUserMsg_Geiger::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_Geiger>()._impl_._has_bits_);
+  static void set_has_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_Geiger::CUserMsg_Geiger(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_Geiger)
+}
+CUserMsg_Geiger::CUserMsg_Geiger(const CUserMsg_Geiger& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_Geiger* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.range_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.range_ = from._impl_.range_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_Geiger)
+}
+
+inline void CUserMsg_Geiger::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.range_){0}
+  };
+}
+
+CUserMsg_Geiger::~CUserMsg_Geiger() {
+  // @@protoc_insertion_point(destructor:CUserMsg_Geiger)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_Geiger::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_Geiger::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_Geiger::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_Geiger)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.range_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_Geiger::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 range = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_range(&has_bits);
+          _impl_.range_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_Geiger::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_Geiger)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 range = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_range(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_Geiger)
+  return target;
+}
+
+size_t CUserMsg_Geiger::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_Geiger)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 range = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_range());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_Geiger::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_Geiger::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_Geiger::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_Geiger::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_Geiger*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_Geiger&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_Geiger)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_range()) {
+    _this->_internal_set_range(from._internal_range());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_Geiger::CopyFrom(const CUserMsg_Geiger& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_Geiger)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_Geiger::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_Geiger::InternalSwap(CUserMsg_Geiger* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.range_, other->_impl_.range_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_Geiger::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[25]);
+}
+
+// ===================================================================
+
+class CUserMsg_Rumble::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_Rumble>()._impl_._has_bits_);
+  static void set_has_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_flags(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CUserMsg_Rumble::CUserMsg_Rumble(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_Rumble)
+}
+CUserMsg_Rumble::CUserMsg_Rumble(const CUserMsg_Rumble& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_Rumble* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.flags_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.index_, &from._impl_.index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.flags_) -
+    reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.flags_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_Rumble)
+}
+
+inline void CUserMsg_Rumble::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.index_){0}
+    , decltype(_impl_.data_){0}
+    , decltype(_impl_.flags_){0}
+  };
+}
+
+CUserMsg_Rumble::~CUserMsg_Rumble() {
+  // @@protoc_insertion_point(destructor:CUserMsg_Rumble)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_Rumble::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_Rumble::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_Rumble::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_Rumble)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.index_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.flags_) -
+        reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.flags_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_Rumble::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_index(&has_bits);
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_data(&has_bits);
+          _impl_.data_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 flags = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_flags(&has_bits);
+          _impl_.flags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_Rumble::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_Rumble)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 index = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_index(), target);
+  }
+
+  // optional int32 data = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_data(), target);
+  }
+
+  // optional int32 flags = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_flags(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_Rumble)
+  return target;
+}
+
+size_t CUserMsg_Rumble::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_Rumble)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional int32 index = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
+    }
+
+    // optional int32 data = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_data());
+    }
+
+    // optional int32 flags = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_flags());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_Rumble::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_Rumble::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_Rumble::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_Rumble::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_Rumble*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_Rumble&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_Rumble)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.index_ = from._impl_.index_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.data_ = from._impl_.data_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.flags_ = from._impl_.flags_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_Rumble::CopyFrom(const CUserMsg_Rumble& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_Rumble)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_Rumble::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_Rumble::InternalSwap(CUserMsg_Rumble* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_Rumble, _impl_.flags_)
+      + sizeof(CUserMsg_Rumble::_impl_.flags_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_Rumble, _impl_.index_)>(
+          reinterpret_cast<char*>(&_impl_.index_),
+          reinterpret_cast<char*>(&other->_impl_.index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_Rumble::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[26]);
+}
+
+// ===================================================================
+
+class CUserMsg_Train::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_Train>()._impl_._has_bits_);
+  static void set_has_train(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_Train::CUserMsg_Train(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_Train)
+}
+CUserMsg_Train::CUserMsg_Train(const CUserMsg_Train& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_Train* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.train_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.train_ = from._impl_.train_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_Train)
+}
+
+inline void CUserMsg_Train::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.train_){0}
+  };
+}
+
+CUserMsg_Train::~CUserMsg_Train() {
+  // @@protoc_insertion_point(destructor:CUserMsg_Train)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_Train::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CUserMsg_Train::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_Train::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_Train)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.train_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_Train::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 train = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_train(&has_bits);
+          _impl_.train_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_Train::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_Train)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 train = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_train(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_Train)
+  return target;
+}
+
+size_t CUserMsg_Train::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_Train)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 train = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_train());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_Train::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_Train::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_Train::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_Train::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_Train*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_Train&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_Train)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_train()) {
+    _this->_internal_set_train(from._internal_train());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_Train::CopyFrom(const CUserMsg_Train& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_Train)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_Train::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_Train::InternalSwap(CUserMsg_Train* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.train_, other->_impl_.train_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_Train::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[27]);
+}
+
+// ===================================================================
+
+class CUserMsg_SayTextChannel::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_SayTextChannel>()._impl_._has_bits_);
+  static void set_has_player(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_SayTextChannel::CUserMsg_SayTextChannel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_SayTextChannel)
+}
+CUserMsg_SayTextChannel::CUserMsg_SayTextChannel(const CUserMsg_SayTextChannel& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_SayTextChannel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.player_){}
+    , decltype(_impl_.channel_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.player_, &from._impl_.player_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.channel_) -
+    reinterpret_cast<char*>(&_impl_.player_)) + sizeof(_impl_.channel_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_SayTextChannel)
+}
+
+inline void CUserMsg_SayTextChannel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.player_){0}
+    , decltype(_impl_.channel_){0}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_SayTextChannel::~CUserMsg_SayTextChannel() {
+  // @@protoc_insertion_point(destructor:CUserMsg_SayTextChannel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_SayTextChannel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
+}
+
+void CUserMsg_SayTextChannel::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_SayTextChannel::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_SayTextChannel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.text_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.player_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.channel_) -
+        reinterpret_cast<char*>(&_impl_.player_)) + sizeof(_impl_.channel_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_SayTextChannel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 player = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_player(&has_bits);
+          _impl_.player_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 channel = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_channel(&has_bits);
+          _impl_.channel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string text = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_SayTextChannel.text");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_SayTextChannel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_SayTextChannel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 player = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_player(), target);
+  }
+
+  // optional int32 channel = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_channel(), target);
+  }
+
+  // optional string text = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_SayTextChannel.text");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_SayTextChannel)
+  return target;
+}
+
+size_t CUserMsg_SayTextChannel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_SayTextChannel)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string text = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_text());
+    }
+
+    // optional int32 player = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_player());
+    }
+
+    // optional int32 channel = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_channel());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_SayTextChannel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_SayTextChannel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_SayTextChannel::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_SayTextChannel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_SayTextChannel*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_SayTextChannel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_SayTextChannel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_text(from._internal_text());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.player_ = from._impl_.player_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.channel_ = from._impl_.channel_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_SayTextChannel::CopyFrom(const CUserMsg_SayTextChannel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_SayTextChannel)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_SayTextChannel::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_SayTextChannel::InternalSwap(CUserMsg_SayTextChannel* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_SayTextChannel, _impl_.channel_)
+      + sizeof(CUserMsg_SayTextChannel::_impl_.channel_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_SayTextChannel, _impl_.player_)>(
+          reinterpret_cast<char*>(&_impl_.player_),
+          reinterpret_cast<char*>(&other->_impl_.player_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_SayTextChannel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[28]);
+}
+
+// ===================================================================
+
+class CUserMsg_MessageText::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_MessageText>()._impl_._has_bits_);
+  static void set_has_color(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+CUserMsg_MessageText::CUserMsg_MessageText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_MessageText)
+}
+CUserMsg_MessageText::CUserMsg_MessageText(const CUserMsg_MessageText& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_MessageText* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.color_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.color_ = from._impl_.color_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_MessageText)
+}
+
+inline void CUserMsg_MessageText::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.color_){0u}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_MessageText::~CUserMsg_MessageText() {
+  // @@protoc_insertion_point(destructor:CUserMsg_MessageText)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_MessageText::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
+}
+
+void CUserMsg_MessageText::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_MessageText::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_MessageText)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.text_.ClearNonDefaultToEmpty();
+  }
+  _impl_.color_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_MessageText::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 color = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_color(&has_bits);
+          _impl_.color_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string text = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_MessageText.text");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_MessageText::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_MessageText)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 color = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_color(), target);
+  }
+
+  // optional string text = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_MessageText.text");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_MessageText)
+  return target;
+}
+
+size_t CUserMsg_MessageText::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_MessageText)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string text = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_text());
+    }
+
+    // optional uint32 color = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_color());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_MessageText::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_MessageText::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_MessageText::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_MessageText::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_MessageText*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_MessageText&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_MessageText)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_text(from._internal_text());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.color_ = from._impl_.color_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_MessageText::CopyFrom(const CUserMsg_MessageText& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_MessageText)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_MessageText::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_MessageText::InternalSwap(CUserMsg_MessageText* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  swap(_impl_.color_, other->_impl_.color_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_MessageText::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[29]);
+}
+
+// ===================================================================
+
+class CUserMsg_CameraTransition_Transition_DataDriven::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_CameraTransition_Transition_DataDriven>()._impl_._has_bits_);
+  static void set_has_filename(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_attach_ent_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CUserMsg_CameraTransition_Transition_DataDriven::CUserMsg_CameraTransition_Transition_DataDriven(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_CameraTransition.Transition_DataDriven)
+}
+CUserMsg_CameraTransition_Transition_DataDriven::CUserMsg_CameraTransition_Transition_DataDriven(const CUserMsg_CameraTransition_Transition_DataDriven& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_CameraTransition_Transition_DataDriven* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.filename_){}
+    , decltype(_impl_.attach_ent_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.filename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_filename()) {
+    _this->_impl_.filename_.Set(from._internal_filename(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.attach_ent_index_ = from._impl_.attach_ent_index_;
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_CameraTransition.Transition_DataDriven)
+}
+
+inline void CUserMsg_CameraTransition_Transition_DataDriven::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.filename_){}
+    , decltype(_impl_.attach_ent_index_){0}
+  };
+  _impl_.filename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CUserMsg_CameraTransition_Transition_DataDriven::~CUserMsg_CameraTransition_Transition_DataDriven() {
+  // @@protoc_insertion_point(destructor:CUserMsg_CameraTransition.Transition_DataDriven)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_CameraTransition_Transition_DataDriven::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.filename_.Destroy();
+}
+
+void CUserMsg_CameraTransition_Transition_DataDriven::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_CameraTransition_Transition_DataDriven::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_CameraTransition.Transition_DataDriven)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.filename_.ClearNonDefaultToEmpty();
+  }
+  _impl_.attach_ent_index_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_CameraTransition_Transition_DataDriven::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string filename = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_filename();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "CUserMsg_CameraTransition.Transition_DataDriven.filename");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 attach_ent_index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_attach_ent_index(&has_bits);
+          _impl_.attach_ent_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_CameraTransition_Transition_DataDriven::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_CameraTransition.Transition_DataDriven)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string filename = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_filename().data(), static_cast<int>(this->_internal_filename().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "CUserMsg_CameraTransition.Transition_DataDriven.filename");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_filename(), target);
+  }
+
+  // optional int32 attach_ent_index = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_attach_ent_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_CameraTransition.Transition_DataDriven)
+  return target;
+}
+
+size_t CUserMsg_CameraTransition_Transition_DataDriven::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_CameraTransition.Transition_DataDriven)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string filename = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_filename());
+    }
+
+    // optional int32 attach_ent_index = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_attach_ent_index());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_CameraTransition_Transition_DataDriven::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_CameraTransition_Transition_DataDriven::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_CameraTransition_Transition_DataDriven::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_CameraTransition_Transition_DataDriven::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_CameraTransition_Transition_DataDriven*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_CameraTransition_Transition_DataDriven&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_CameraTransition.Transition_DataDriven)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_filename(from._internal_filename());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.attach_ent_index_ = from._impl_.attach_ent_index_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_CameraTransition_Transition_DataDriven::CopyFrom(const CUserMsg_CameraTransition_Transition_DataDriven& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_CameraTransition.Transition_DataDriven)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_CameraTransition_Transition_DataDriven::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_CameraTransition_Transition_DataDriven::InternalSwap(CUserMsg_CameraTransition_Transition_DataDriven* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.filename_, lhs_arena,
+      &other->_impl_.filename_, rhs_arena
+  );
+  swap(_impl_.attach_ent_index_, other->_impl_.attach_ent_index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_CameraTransition_Transition_DataDriven::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[30]);
+}
+
+// ===================================================================
+
+class CUserMsg_CameraTransition::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CUserMsg_CameraTransition>()._impl_._has_bits_);
+  static void set_has_camera_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_duration(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::CUserMsg_CameraTransition_Transition_DataDriven& params_data_driven(const CUserMsg_CameraTransition* msg);
+  static void set_has_params_data_driven(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::CUserMsg_CameraTransition_Transition_DataDriven&
+CUserMsg_CameraTransition::_Internal::params_data_driven(const CUserMsg_CameraTransition* msg) {
+  return *msg->_impl_.params_data_driven_;
+}
+CUserMsg_CameraTransition::CUserMsg_CameraTransition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:CUserMsg_CameraTransition)
+}
+CUserMsg_CameraTransition::CUserMsg_CameraTransition(const CUserMsg_CameraTransition& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CUserMsg_CameraTransition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.params_data_driven_){nullptr}
+    , decltype(_impl_.camera_type_){}
+    , decltype(_impl_.duration_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_params_data_driven()) {
+    _this->_impl_.params_data_driven_ = new ::CUserMsg_CameraTransition_Transition_DataDriven(*from._impl_.params_data_driven_);
+  }
+  ::memcpy(&_impl_.camera_type_, &from._impl_.camera_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.duration_) -
+    reinterpret_cast<char*>(&_impl_.camera_type_)) + sizeof(_impl_.duration_));
+  // @@protoc_insertion_point(copy_constructor:CUserMsg_CameraTransition)
+}
+
+inline void CUserMsg_CameraTransition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.params_data_driven_){nullptr}
+    , decltype(_impl_.camera_type_){0u}
+    , decltype(_impl_.duration_){0}
+  };
+}
+
+CUserMsg_CameraTransition::~CUserMsg_CameraTransition() {
+  // @@protoc_insertion_point(destructor:CUserMsg_CameraTransition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CUserMsg_CameraTransition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.params_data_driven_;
+}
+
+void CUserMsg_CameraTransition::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CUserMsg_CameraTransition::Clear() {
+// @@protoc_insertion_point(message_clear_start:CUserMsg_CameraTransition)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.params_data_driven_ != nullptr);
+    _impl_.params_data_driven_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.camera_type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.duration_) -
+        reinterpret_cast<char*>(&_impl_.camera_type_)) + sizeof(_impl_.duration_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CUserMsg_CameraTransition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 camera_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_camera_type(&has_bits);
+          _impl_.camera_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float duration = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_duration(&has_bits);
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .CUserMsg_CameraTransition.Transition_DataDriven params_data_driven = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_params_data_driven(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CUserMsg_CameraTransition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:CUserMsg_CameraTransition)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 camera_type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_camera_type(), target);
+  }
+
+  // optional float duration = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_duration(), target);
+  }
+
+  // optional .CUserMsg_CameraTransition.Transition_DataDriven params_data_driven = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::params_data_driven(this),
+        _Internal::params_data_driven(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CUserMsg_CameraTransition)
+  return target;
+}
+
+size_t CUserMsg_CameraTransition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CUserMsg_CameraTransition)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .CUserMsg_CameraTransition.Transition_DataDriven params_data_driven = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.params_data_driven_);
+    }
+
+    // optional uint32 camera_type = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_camera_type());
+    }
+
+    // optional float duration = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CUserMsg_CameraTransition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CUserMsg_CameraTransition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CUserMsg_CameraTransition::GetClassData() const { return &_class_data_; }
+
+
+void CUserMsg_CameraTransition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CUserMsg_CameraTransition*>(&to_msg);
+  auto& from = static_cast<const CUserMsg_CameraTransition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CUserMsg_CameraTransition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_params_data_driven()->::CUserMsg_CameraTransition_Transition_DataDriven::MergeFrom(
+          from._internal_params_data_driven());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.camera_type_ = from._impl_.camera_type_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.duration_ = from._impl_.duration_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CUserMsg_CameraTransition::CopyFrom(const CUserMsg_CameraTransition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CUserMsg_CameraTransition)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CUserMsg_CameraTransition::IsInitialized() const {
+  return true;
+}
+
+void CUserMsg_CameraTransition::InternalSwap(CUserMsg_CameraTransition* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CUserMsg_CameraTransition, _impl_.duration_)
+      + sizeof(CUserMsg_CameraTransition::_impl_.duration_)
+      - PROTOBUF_FIELD_OFFSET(CUserMsg_CameraTransition, _impl_.params_data_driven_)>(
+          reinterpret_cast<char*>(&_impl_.params_data_driven_),
+          reinterpret_cast<char*>(&other->_impl_.params_data_driven_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CUserMsg_CameraTransition::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_usermessages_2eproto_getter, &descriptor_table_usermessages_2eproto_once,
+      file_level_metadata_usermessages_2eproto[31]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::CUserMsg_AchievementEvent*
+Arena::CreateMaybeMessage< ::CUserMsg_AchievementEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_AchievementEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_CloseCaption*
+Arena::CreateMaybeMessage< ::CUserMsg_CloseCaption >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_CloseCaption >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_CurrentTimescale*
+Arena::CreateMaybeMessage< ::CUserMsg_CurrentTimescale >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_CurrentTimescale >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_DesiredTimescale*
+Arena::CreateMaybeMessage< ::CUserMsg_DesiredTimescale >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_DesiredTimescale >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_Fade*
+Arena::CreateMaybeMessage< ::CUserMsg_Fade >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_Fade >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_Shake*
+Arena::CreateMaybeMessage< ::CUserMsg_Shake >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_Shake >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_ShakeDir*
+Arena::CreateMaybeMessage< ::CUserMsg_ShakeDir >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_ShakeDir >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_Tilt*
+Arena::CreateMaybeMessage< ::CUserMsg_Tilt >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_Tilt >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_SayText*
+Arena::CreateMaybeMessage< ::CUserMsg_SayText >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_SayText >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_SayText2*
+Arena::CreateMaybeMessage< ::CUserMsg_SayText2 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_SayText2 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_HudMsg*
+Arena::CreateMaybeMessage< ::CUserMsg_HudMsg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_HudMsg >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_HudText*
+Arena::CreateMaybeMessage< ::CUserMsg_HudText >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_HudText >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_TextMsg*
+Arena::CreateMaybeMessage< ::CUserMsg_TextMsg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_TextMsg >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_GameTitle*
+Arena::CreateMaybeMessage< ::CUserMsg_GameTitle >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_GameTitle >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_ResetHUD*
+Arena::CreateMaybeMessage< ::CUserMsg_ResetHUD >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_ResetHUD >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_SendAudio*
+Arena::CreateMaybeMessage< ::CUserMsg_SendAudio >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_SendAudio >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_VoiceMask*
+Arena::CreateMaybeMessage< ::CUserMsg_VoiceMask >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_VoiceMask >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_RequestState*
+Arena::CreateMaybeMessage< ::CUserMsg_RequestState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_RequestState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_HintText*
+Arena::CreateMaybeMessage< ::CUserMsg_HintText >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_HintText >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_KeyHintText*
+Arena::CreateMaybeMessage< ::CUserMsg_KeyHintText >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_KeyHintText >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_StatsCrawlMsg*
+Arena::CreateMaybeMessage< ::CUserMsg_StatsCrawlMsg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_StatsCrawlMsg >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_StatsSkipState*
+Arena::CreateMaybeMessage< ::CUserMsg_StatsSkipState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_StatsSkipState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_VoiceSubtitle*
+Arena::CreateMaybeMessage< ::CUserMsg_VoiceSubtitle >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_VoiceSubtitle >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_VGUIMenu_Keys*
+Arena::CreateMaybeMessage< ::CUserMsg_VGUIMenu_Keys >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_VGUIMenu_Keys >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_VGUIMenu*
+Arena::CreateMaybeMessage< ::CUserMsg_VGUIMenu >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_VGUIMenu >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_Geiger*
+Arena::CreateMaybeMessage< ::CUserMsg_Geiger >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_Geiger >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_Rumble*
+Arena::CreateMaybeMessage< ::CUserMsg_Rumble >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_Rumble >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_Train*
+Arena::CreateMaybeMessage< ::CUserMsg_Train >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_Train >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_SayTextChannel*
+Arena::CreateMaybeMessage< ::CUserMsg_SayTextChannel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_SayTextChannel >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_MessageText*
+Arena::CreateMaybeMessage< ::CUserMsg_MessageText >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_MessageText >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_CameraTransition_Transition_DataDriven*
+Arena::CreateMaybeMessage< ::CUserMsg_CameraTransition_Transition_DataDriven >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_CameraTransition_Transition_DataDriven >(arena);
+}
+template<> PROTOBUF_NOINLINE ::CUserMsg_CameraTransition*
+Arena::CreateMaybeMessage< ::CUserMsg_CameraTransition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::CUserMsg_CameraTransition >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,9509 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: usermessages.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_usermessages_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_usermessages_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "networkbasetypes.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_usermessages_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_usermessages_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_usermessages_2eproto;
+class CUserMsg_AchievementEvent;
+struct CUserMsg_AchievementEventDefaultTypeInternal;
+extern CUserMsg_AchievementEventDefaultTypeInternal _CUserMsg_AchievementEvent_default_instance_;
+class CUserMsg_CameraTransition;
+struct CUserMsg_CameraTransitionDefaultTypeInternal;
+extern CUserMsg_CameraTransitionDefaultTypeInternal _CUserMsg_CameraTransition_default_instance_;
+class CUserMsg_CameraTransition_Transition_DataDriven;
+struct CUserMsg_CameraTransition_Transition_DataDrivenDefaultTypeInternal;
+extern CUserMsg_CameraTransition_Transition_DataDrivenDefaultTypeInternal _CUserMsg_CameraTransition_Transition_DataDriven_default_instance_;
+class CUserMsg_CloseCaption;
+struct CUserMsg_CloseCaptionDefaultTypeInternal;
+extern CUserMsg_CloseCaptionDefaultTypeInternal _CUserMsg_CloseCaption_default_instance_;
+class CUserMsg_CurrentTimescale;
+struct CUserMsg_CurrentTimescaleDefaultTypeInternal;
+extern CUserMsg_CurrentTimescaleDefaultTypeInternal _CUserMsg_CurrentTimescale_default_instance_;
+class CUserMsg_DesiredTimescale;
+struct CUserMsg_DesiredTimescaleDefaultTypeInternal;
+extern CUserMsg_DesiredTimescaleDefaultTypeInternal _CUserMsg_DesiredTimescale_default_instance_;
+class CUserMsg_Fade;
+struct CUserMsg_FadeDefaultTypeInternal;
+extern CUserMsg_FadeDefaultTypeInternal _CUserMsg_Fade_default_instance_;
+class CUserMsg_GameTitle;
+struct CUserMsg_GameTitleDefaultTypeInternal;
+extern CUserMsg_GameTitleDefaultTypeInternal _CUserMsg_GameTitle_default_instance_;
+class CUserMsg_Geiger;
+struct CUserMsg_GeigerDefaultTypeInternal;
+extern CUserMsg_GeigerDefaultTypeInternal _CUserMsg_Geiger_default_instance_;
+class CUserMsg_HintText;
+struct CUserMsg_HintTextDefaultTypeInternal;
+extern CUserMsg_HintTextDefaultTypeInternal _CUserMsg_HintText_default_instance_;
+class CUserMsg_HudMsg;
+struct CUserMsg_HudMsgDefaultTypeInternal;
+extern CUserMsg_HudMsgDefaultTypeInternal _CUserMsg_HudMsg_default_instance_;
+class CUserMsg_HudText;
+struct CUserMsg_HudTextDefaultTypeInternal;
+extern CUserMsg_HudTextDefaultTypeInternal _CUserMsg_HudText_default_instance_;
+class CUserMsg_KeyHintText;
+struct CUserMsg_KeyHintTextDefaultTypeInternal;
+extern CUserMsg_KeyHintTextDefaultTypeInternal _CUserMsg_KeyHintText_default_instance_;
+class CUserMsg_MessageText;
+struct CUserMsg_MessageTextDefaultTypeInternal;
+extern CUserMsg_MessageTextDefaultTypeInternal _CUserMsg_MessageText_default_instance_;
+class CUserMsg_RequestState;
+struct CUserMsg_RequestStateDefaultTypeInternal;
+extern CUserMsg_RequestStateDefaultTypeInternal _CUserMsg_RequestState_default_instance_;
+class CUserMsg_ResetHUD;
+struct CUserMsg_ResetHUDDefaultTypeInternal;
+extern CUserMsg_ResetHUDDefaultTypeInternal _CUserMsg_ResetHUD_default_instance_;
+class CUserMsg_Rumble;
+struct CUserMsg_RumbleDefaultTypeInternal;
+extern CUserMsg_RumbleDefaultTypeInternal _CUserMsg_Rumble_default_instance_;
+class CUserMsg_SayText;
+struct CUserMsg_SayTextDefaultTypeInternal;
+extern CUserMsg_SayTextDefaultTypeInternal _CUserMsg_SayText_default_instance_;
+class CUserMsg_SayText2;
+struct CUserMsg_SayText2DefaultTypeInternal;
+extern CUserMsg_SayText2DefaultTypeInternal _CUserMsg_SayText2_default_instance_;
+class CUserMsg_SayTextChannel;
+struct CUserMsg_SayTextChannelDefaultTypeInternal;
+extern CUserMsg_SayTextChannelDefaultTypeInternal _CUserMsg_SayTextChannel_default_instance_;
+class CUserMsg_SendAudio;
+struct CUserMsg_SendAudioDefaultTypeInternal;
+extern CUserMsg_SendAudioDefaultTypeInternal _CUserMsg_SendAudio_default_instance_;
+class CUserMsg_Shake;
+struct CUserMsg_ShakeDefaultTypeInternal;
+extern CUserMsg_ShakeDefaultTypeInternal _CUserMsg_Shake_default_instance_;
+class CUserMsg_ShakeDir;
+struct CUserMsg_ShakeDirDefaultTypeInternal;
+extern CUserMsg_ShakeDirDefaultTypeInternal _CUserMsg_ShakeDir_default_instance_;
+class CUserMsg_StatsCrawlMsg;
+struct CUserMsg_StatsCrawlMsgDefaultTypeInternal;
+extern CUserMsg_StatsCrawlMsgDefaultTypeInternal _CUserMsg_StatsCrawlMsg_default_instance_;
+class CUserMsg_StatsSkipState;
+struct CUserMsg_StatsSkipStateDefaultTypeInternal;
+extern CUserMsg_StatsSkipStateDefaultTypeInternal _CUserMsg_StatsSkipState_default_instance_;
+class CUserMsg_TextMsg;
+struct CUserMsg_TextMsgDefaultTypeInternal;
+extern CUserMsg_TextMsgDefaultTypeInternal _CUserMsg_TextMsg_default_instance_;
+class CUserMsg_Tilt;
+struct CUserMsg_TiltDefaultTypeInternal;
+extern CUserMsg_TiltDefaultTypeInternal _CUserMsg_Tilt_default_instance_;
+class CUserMsg_Train;
+struct CUserMsg_TrainDefaultTypeInternal;
+extern CUserMsg_TrainDefaultTypeInternal _CUserMsg_Train_default_instance_;
+class CUserMsg_VGUIMenu;
+struct CUserMsg_VGUIMenuDefaultTypeInternal;
+extern CUserMsg_VGUIMenuDefaultTypeInternal _CUserMsg_VGUIMenu_default_instance_;
+class CUserMsg_VGUIMenu_Keys;
+struct CUserMsg_VGUIMenu_KeysDefaultTypeInternal;
+extern CUserMsg_VGUIMenu_KeysDefaultTypeInternal _CUserMsg_VGUIMenu_Keys_default_instance_;
+class CUserMsg_VoiceMask;
+struct CUserMsg_VoiceMaskDefaultTypeInternal;
+extern CUserMsg_VoiceMaskDefaultTypeInternal _CUserMsg_VoiceMask_default_instance_;
+class CUserMsg_VoiceSubtitle;
+struct CUserMsg_VoiceSubtitleDefaultTypeInternal;
+extern CUserMsg_VoiceSubtitleDefaultTypeInternal _CUserMsg_VoiceSubtitle_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::CUserMsg_AchievementEvent* Arena::CreateMaybeMessage<::CUserMsg_AchievementEvent>(Arena*);
+template<> ::CUserMsg_CameraTransition* Arena::CreateMaybeMessage<::CUserMsg_CameraTransition>(Arena*);
+template<> ::CUserMsg_CameraTransition_Transition_DataDriven* Arena::CreateMaybeMessage<::CUserMsg_CameraTransition_Transition_DataDriven>(Arena*);
+template<> ::CUserMsg_CloseCaption* Arena::CreateMaybeMessage<::CUserMsg_CloseCaption>(Arena*);
+template<> ::CUserMsg_CurrentTimescale* Arena::CreateMaybeMessage<::CUserMsg_CurrentTimescale>(Arena*);
+template<> ::CUserMsg_DesiredTimescale* Arena::CreateMaybeMessage<::CUserMsg_DesiredTimescale>(Arena*);
+template<> ::CUserMsg_Fade* Arena::CreateMaybeMessage<::CUserMsg_Fade>(Arena*);
+template<> ::CUserMsg_GameTitle* Arena::CreateMaybeMessage<::CUserMsg_GameTitle>(Arena*);
+template<> ::CUserMsg_Geiger* Arena::CreateMaybeMessage<::CUserMsg_Geiger>(Arena*);
+template<> ::CUserMsg_HintText* Arena::CreateMaybeMessage<::CUserMsg_HintText>(Arena*);
+template<> ::CUserMsg_HudMsg* Arena::CreateMaybeMessage<::CUserMsg_HudMsg>(Arena*);
+template<> ::CUserMsg_HudText* Arena::CreateMaybeMessage<::CUserMsg_HudText>(Arena*);
+template<> ::CUserMsg_KeyHintText* Arena::CreateMaybeMessage<::CUserMsg_KeyHintText>(Arena*);
+template<> ::CUserMsg_MessageText* Arena::CreateMaybeMessage<::CUserMsg_MessageText>(Arena*);
+template<> ::CUserMsg_RequestState* Arena::CreateMaybeMessage<::CUserMsg_RequestState>(Arena*);
+template<> ::CUserMsg_ResetHUD* Arena::CreateMaybeMessage<::CUserMsg_ResetHUD>(Arena*);
+template<> ::CUserMsg_Rumble* Arena::CreateMaybeMessage<::CUserMsg_Rumble>(Arena*);
+template<> ::CUserMsg_SayText* Arena::CreateMaybeMessage<::CUserMsg_SayText>(Arena*);
+template<> ::CUserMsg_SayText2* Arena::CreateMaybeMessage<::CUserMsg_SayText2>(Arena*);
+template<> ::CUserMsg_SayTextChannel* Arena::CreateMaybeMessage<::CUserMsg_SayTextChannel>(Arena*);
+template<> ::CUserMsg_SendAudio* Arena::CreateMaybeMessage<::CUserMsg_SendAudio>(Arena*);
+template<> ::CUserMsg_Shake* Arena::CreateMaybeMessage<::CUserMsg_Shake>(Arena*);
+template<> ::CUserMsg_ShakeDir* Arena::CreateMaybeMessage<::CUserMsg_ShakeDir>(Arena*);
+template<> ::CUserMsg_StatsCrawlMsg* Arena::CreateMaybeMessage<::CUserMsg_StatsCrawlMsg>(Arena*);
+template<> ::CUserMsg_StatsSkipState* Arena::CreateMaybeMessage<::CUserMsg_StatsSkipState>(Arena*);
+template<> ::CUserMsg_TextMsg* Arena::CreateMaybeMessage<::CUserMsg_TextMsg>(Arena*);
+template<> ::CUserMsg_Tilt* Arena::CreateMaybeMessage<::CUserMsg_Tilt>(Arena*);
+template<> ::CUserMsg_Train* Arena::CreateMaybeMessage<::CUserMsg_Train>(Arena*);
+template<> ::CUserMsg_VGUIMenu* Arena::CreateMaybeMessage<::CUserMsg_VGUIMenu>(Arena*);
+template<> ::CUserMsg_VGUIMenu_Keys* Arena::CreateMaybeMessage<::CUserMsg_VGUIMenu_Keys>(Arena*);
+template<> ::CUserMsg_VoiceMask* Arena::CreateMaybeMessage<::CUserMsg_VoiceMask>(Arena*);
+template<> ::CUserMsg_VoiceSubtitle* Arena::CreateMaybeMessage<::CUserMsg_VoiceSubtitle>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+enum EBaseUserMessages : int {
+  UM_AchievementEvent = 1,
+  UM_CloseCaption = 2,
+  UM_CloseCaptionDirect = 3,
+  UM_CurrentTimescale = 4,
+  UM_DesiredTimescale = 5,
+  UM_Fade = 6,
+  UM_GameTitle = 7,
+  UM_Geiger = 8,
+  UM_HintText = 9,
+  UM_HudMsg = 10,
+  UM_HudText = 11,
+  UM_KeyHintText = 12,
+  UM_MessageText = 13,
+  UM_RequestState = 14,
+  UM_ResetHUD = 15,
+  UM_Rumble = 16,
+  UM_SayText = 17,
+  UM_SayText2 = 18,
+  UM_SayTextChannel = 19,
+  UM_Shake = 20,
+  UM_ShakeDir = 21,
+  UM_StatsCrawlMsg = 22,
+  UM_StatsSkipState = 23,
+  UM_TextMsg = 24,
+  UM_Tilt = 25,
+  UM_Train = 26,
+  UM_VGUIMenu = 27,
+  UM_VoiceMask = 28,
+  UM_VoiceSubtitle = 29,
+  UM_SendAudio = 30,
+  UM_CameraTransition = 31,
+  UM_MAX_BASE = 63
+};
+bool EBaseUserMessages_IsValid(int value);
+constexpr EBaseUserMessages EBaseUserMessages_MIN = UM_AchievementEvent;
+constexpr EBaseUserMessages EBaseUserMessages_MAX = UM_MAX_BASE;
+constexpr int EBaseUserMessages_ARRAYSIZE = EBaseUserMessages_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EBaseUserMessages_descriptor();
+template<typename T>
+inline const std::string& EBaseUserMessages_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, EBaseUserMessages>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function EBaseUserMessages_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    EBaseUserMessages_descriptor(), enum_t_value);
+}
+inline bool EBaseUserMessages_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EBaseUserMessages* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<EBaseUserMessages>(
+    EBaseUserMessages_descriptor(), name, value);
+}
+// ===================================================================
+
+class CUserMsg_AchievementEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_AchievementEvent) */ {
+ public:
+  inline CUserMsg_AchievementEvent() : CUserMsg_AchievementEvent(nullptr) {}
+  ~CUserMsg_AchievementEvent() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_AchievementEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_AchievementEvent(const CUserMsg_AchievementEvent& from);
+  CUserMsg_AchievementEvent(CUserMsg_AchievementEvent&& from) noexcept
+    : CUserMsg_AchievementEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_AchievementEvent& operator=(const CUserMsg_AchievementEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_AchievementEvent& operator=(CUserMsg_AchievementEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_AchievementEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_AchievementEvent* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_AchievementEvent*>(
+               &_CUserMsg_AchievementEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CUserMsg_AchievementEvent& a, CUserMsg_AchievementEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_AchievementEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_AchievementEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_AchievementEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_AchievementEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_AchievementEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_AchievementEvent& from) {
+    CUserMsg_AchievementEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_AchievementEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_AchievementEvent";
+  }
+  protected:
+  explicit CUserMsg_AchievementEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAchievementFieldNumber = 1,
+  };
+  // optional uint32 achievement = 1;
+  bool has_achievement() const;
+  private:
+  bool _internal_has_achievement() const;
+  public:
+  void clear_achievement();
+  uint32_t achievement() const;
+  void set_achievement(uint32_t value);
+  private:
+  uint32_t _internal_achievement() const;
+  void _internal_set_achievement(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_AchievementEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t achievement_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_CloseCaption final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_CloseCaption) */ {
+ public:
+  inline CUserMsg_CloseCaption() : CUserMsg_CloseCaption(nullptr) {}
+  ~CUserMsg_CloseCaption() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_CloseCaption(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_CloseCaption(const CUserMsg_CloseCaption& from);
+  CUserMsg_CloseCaption(CUserMsg_CloseCaption&& from) noexcept
+    : CUserMsg_CloseCaption() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_CloseCaption& operator=(const CUserMsg_CloseCaption& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_CloseCaption& operator=(CUserMsg_CloseCaption&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_CloseCaption& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_CloseCaption* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_CloseCaption*>(
+               &_CUserMsg_CloseCaption_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(CUserMsg_CloseCaption& a, CUserMsg_CloseCaption& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_CloseCaption* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_CloseCaption* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_CloseCaption* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_CloseCaption>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_CloseCaption& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_CloseCaption& from) {
+    CUserMsg_CloseCaption::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_CloseCaption* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_CloseCaption";
+  }
+  protected:
+  explicit CUserMsg_CloseCaption(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHashFieldNumber = 1,
+    kDurationFieldNumber = 2,
+    kFromPlayerFieldNumber = 3,
+    kEntIndexFieldNumber = 4,
+  };
+  // optional fixed32 hash = 1;
+  bool has_hash() const;
+  private:
+  bool _internal_has_hash() const;
+  public:
+  void clear_hash();
+  uint32_t hash() const;
+  void set_hash(uint32_t value);
+  private:
+  uint32_t _internal_hash() const;
+  void _internal_set_hash(uint32_t value);
+  public:
+
+  // optional float duration = 2;
+  bool has_duration() const;
+  private:
+  bool _internal_has_duration() const;
+  public:
+  void clear_duration();
+  float duration() const;
+  void set_duration(float value);
+  private:
+  float _internal_duration() const;
+  void _internal_set_duration(float value);
+  public:
+
+  // optional bool from_player = 3;
+  bool has_from_player() const;
+  private:
+  bool _internal_has_from_player() const;
+  public:
+  void clear_from_player();
+  bool from_player() const;
+  void set_from_player(bool value);
+  private:
+  bool _internal_from_player() const;
+  void _internal_set_from_player(bool value);
+  public:
+
+  // optional int32 ent_index = 4;
+  bool has_ent_index() const;
+  private:
+  bool _internal_has_ent_index() const;
+  public:
+  void clear_ent_index();
+  int32_t ent_index() const;
+  void set_ent_index(int32_t value);
+  private:
+  int32_t _internal_ent_index() const;
+  void _internal_set_ent_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_CloseCaption)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t hash_;
+    float duration_;
+    bool from_player_;
+    int32_t ent_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_CurrentTimescale final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_CurrentTimescale) */ {
+ public:
+  inline CUserMsg_CurrentTimescale() : CUserMsg_CurrentTimescale(nullptr) {}
+  ~CUserMsg_CurrentTimescale() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_CurrentTimescale(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_CurrentTimescale(const CUserMsg_CurrentTimescale& from);
+  CUserMsg_CurrentTimescale(CUserMsg_CurrentTimescale&& from) noexcept
+    : CUserMsg_CurrentTimescale() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_CurrentTimescale& operator=(const CUserMsg_CurrentTimescale& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_CurrentTimescale& operator=(CUserMsg_CurrentTimescale&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_CurrentTimescale& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_CurrentTimescale* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_CurrentTimescale*>(
+               &_CUserMsg_CurrentTimescale_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(CUserMsg_CurrentTimescale& a, CUserMsg_CurrentTimescale& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_CurrentTimescale* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_CurrentTimescale* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_CurrentTimescale* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_CurrentTimescale>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_CurrentTimescale& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_CurrentTimescale& from) {
+    CUserMsg_CurrentTimescale::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_CurrentTimescale* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_CurrentTimescale";
+  }
+  protected:
+  explicit CUserMsg_CurrentTimescale(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCurrentFieldNumber = 1,
+  };
+  // optional float current = 1;
+  bool has_current() const;
+  private:
+  bool _internal_has_current() const;
+  public:
+  void clear_current();
+  float current() const;
+  void set_current(float value);
+  private:
+  float _internal_current() const;
+  void _internal_set_current(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_CurrentTimescale)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float current_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_DesiredTimescale final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_DesiredTimescale) */ {
+ public:
+  inline CUserMsg_DesiredTimescale() : CUserMsg_DesiredTimescale(nullptr) {}
+  ~CUserMsg_DesiredTimescale() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_DesiredTimescale(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_DesiredTimescale(const CUserMsg_DesiredTimescale& from);
+  CUserMsg_DesiredTimescale(CUserMsg_DesiredTimescale&& from) noexcept
+    : CUserMsg_DesiredTimescale() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_DesiredTimescale& operator=(const CUserMsg_DesiredTimescale& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_DesiredTimescale& operator=(CUserMsg_DesiredTimescale&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_DesiredTimescale& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_DesiredTimescale* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_DesiredTimescale*>(
+               &_CUserMsg_DesiredTimescale_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CUserMsg_DesiredTimescale& a, CUserMsg_DesiredTimescale& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_DesiredTimescale* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_DesiredTimescale* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_DesiredTimescale* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_DesiredTimescale>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_DesiredTimescale& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_DesiredTimescale& from) {
+    CUserMsg_DesiredTimescale::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_DesiredTimescale* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_DesiredTimescale";
+  }
+  protected:
+  explicit CUserMsg_DesiredTimescale(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDesiredFieldNumber = 1,
+    kDurationFieldNumber = 2,
+    kInterpolatorFieldNumber = 3,
+    kStartBlendTimeFieldNumber = 4,
+  };
+  // optional float desired = 1;
+  bool has_desired() const;
+  private:
+  bool _internal_has_desired() const;
+  public:
+  void clear_desired();
+  float desired() const;
+  void set_desired(float value);
+  private:
+  float _internal_desired() const;
+  void _internal_set_desired(float value);
+  public:
+
+  // optional float duration = 2;
+  bool has_duration() const;
+  private:
+  bool _internal_has_duration() const;
+  public:
+  void clear_duration();
+  float duration() const;
+  void set_duration(float value);
+  private:
+  float _internal_duration() const;
+  void _internal_set_duration(float value);
+  public:
+
+  // optional uint32 interpolator = 3;
+  bool has_interpolator() const;
+  private:
+  bool _internal_has_interpolator() const;
+  public:
+  void clear_interpolator();
+  uint32_t interpolator() const;
+  void set_interpolator(uint32_t value);
+  private:
+  uint32_t _internal_interpolator() const;
+  void _internal_set_interpolator(uint32_t value);
+  public:
+
+  // optional float start_blend_time = 4;
+  bool has_start_blend_time() const;
+  private:
+  bool _internal_has_start_blend_time() const;
+  public:
+  void clear_start_blend_time();
+  float start_blend_time() const;
+  void set_start_blend_time(float value);
+  private:
+  float _internal_start_blend_time() const;
+  void _internal_set_start_blend_time(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_DesiredTimescale)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float desired_;
+    float duration_;
+    uint32_t interpolator_;
+    float start_blend_time_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_Fade final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_Fade) */ {
+ public:
+  inline CUserMsg_Fade() : CUserMsg_Fade(nullptr) {}
+  ~CUserMsg_Fade() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_Fade(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_Fade(const CUserMsg_Fade& from);
+  CUserMsg_Fade(CUserMsg_Fade&& from) noexcept
+    : CUserMsg_Fade() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_Fade& operator=(const CUserMsg_Fade& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_Fade& operator=(CUserMsg_Fade&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_Fade& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_Fade* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_Fade*>(
+               &_CUserMsg_Fade_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(CUserMsg_Fade& a, CUserMsg_Fade& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_Fade* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_Fade* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_Fade* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_Fade>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_Fade& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_Fade& from) {
+    CUserMsg_Fade::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_Fade* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_Fade";
+  }
+  protected:
+  explicit CUserMsg_Fade(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDurationFieldNumber = 1,
+    kHoldTimeFieldNumber = 2,
+    kFlagsFieldNumber = 3,
+    kColorFieldNumber = 4,
+  };
+  // optional uint32 duration = 1;
+  bool has_duration() const;
+  private:
+  bool _internal_has_duration() const;
+  public:
+  void clear_duration();
+  uint32_t duration() const;
+  void set_duration(uint32_t value);
+  private:
+  uint32_t _internal_duration() const;
+  void _internal_set_duration(uint32_t value);
+  public:
+
+  // optional uint32 hold_time = 2;
+  bool has_hold_time() const;
+  private:
+  bool _internal_has_hold_time() const;
+  public:
+  void clear_hold_time();
+  uint32_t hold_time() const;
+  void set_hold_time(uint32_t value);
+  private:
+  uint32_t _internal_hold_time() const;
+  void _internal_set_hold_time(uint32_t value);
+  public:
+
+  // optional uint32 flags = 3;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  uint32_t flags() const;
+  void set_flags(uint32_t value);
+  private:
+  uint32_t _internal_flags() const;
+  void _internal_set_flags(uint32_t value);
+  public:
+
+  // optional fixed32 color = 4;
+  bool has_color() const;
+  private:
+  bool _internal_has_color() const;
+  public:
+  void clear_color();
+  uint32_t color() const;
+  void set_color(uint32_t value);
+  private:
+  uint32_t _internal_color() const;
+  void _internal_set_color(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_Fade)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t duration_;
+    uint32_t hold_time_;
+    uint32_t flags_;
+    uint32_t color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_Shake final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_Shake) */ {
+ public:
+  inline CUserMsg_Shake() : CUserMsg_Shake(nullptr) {}
+  ~CUserMsg_Shake() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_Shake(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_Shake(const CUserMsg_Shake& from);
+  CUserMsg_Shake(CUserMsg_Shake&& from) noexcept
+    : CUserMsg_Shake() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_Shake& operator=(const CUserMsg_Shake& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_Shake& operator=(CUserMsg_Shake&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_Shake& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_Shake* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_Shake*>(
+               &_CUserMsg_Shake_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(CUserMsg_Shake& a, CUserMsg_Shake& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_Shake* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_Shake* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_Shake* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_Shake>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_Shake& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_Shake& from) {
+    CUserMsg_Shake::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_Shake* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_Shake";
+  }
+  protected:
+  explicit CUserMsg_Shake(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCommandFieldNumber = 1,
+    kAmplitudeFieldNumber = 2,
+    kFrequencyFieldNumber = 3,
+    kDurationFieldNumber = 4,
+  };
+  // optional uint32 command = 1;
+  bool has_command() const;
+  private:
+  bool _internal_has_command() const;
+  public:
+  void clear_command();
+  uint32_t command() const;
+  void set_command(uint32_t value);
+  private:
+  uint32_t _internal_command() const;
+  void _internal_set_command(uint32_t value);
+  public:
+
+  // optional float amplitude = 2;
+  bool has_amplitude() const;
+  private:
+  bool _internal_has_amplitude() const;
+  public:
+  void clear_amplitude();
+  float amplitude() const;
+  void set_amplitude(float value);
+  private:
+  float _internal_amplitude() const;
+  void _internal_set_amplitude(float value);
+  public:
+
+  // optional float frequency = 3;
+  bool has_frequency() const;
+  private:
+  bool _internal_has_frequency() const;
+  public:
+  void clear_frequency();
+  float frequency() const;
+  void set_frequency(float value);
+  private:
+  float _internal_frequency() const;
+  void _internal_set_frequency(float value);
+  public:
+
+  // optional float duration = 4;
+  bool has_duration() const;
+  private:
+  bool _internal_has_duration() const;
+  public:
+  void clear_duration();
+  float duration() const;
+  void set_duration(float value);
+  private:
+  float _internal_duration() const;
+  void _internal_set_duration(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_Shake)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t command_;
+    float amplitude_;
+    float frequency_;
+    float duration_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_ShakeDir final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_ShakeDir) */ {
+ public:
+  inline CUserMsg_ShakeDir() : CUserMsg_ShakeDir(nullptr) {}
+  ~CUserMsg_ShakeDir() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_ShakeDir(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_ShakeDir(const CUserMsg_ShakeDir& from);
+  CUserMsg_ShakeDir(CUserMsg_ShakeDir&& from) noexcept
+    : CUserMsg_ShakeDir() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_ShakeDir& operator=(const CUserMsg_ShakeDir& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_ShakeDir& operator=(CUserMsg_ShakeDir&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_ShakeDir& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_ShakeDir* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_ShakeDir*>(
+               &_CUserMsg_ShakeDir_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(CUserMsg_ShakeDir& a, CUserMsg_ShakeDir& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_ShakeDir* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_ShakeDir* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_ShakeDir* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_ShakeDir>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_ShakeDir& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_ShakeDir& from) {
+    CUserMsg_ShakeDir::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_ShakeDir* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_ShakeDir";
+  }
+  protected:
+  explicit CUserMsg_ShakeDir(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShakeFieldNumber = 1,
+    kDirectionFieldNumber = 2,
+  };
+  // optional .CUserMsg_Shake shake = 1;
+  bool has_shake() const;
+  private:
+  bool _internal_has_shake() const;
+  public:
+  void clear_shake();
+  const ::CUserMsg_Shake& shake() const;
+  PROTOBUF_NODISCARD ::CUserMsg_Shake* release_shake();
+  ::CUserMsg_Shake* mutable_shake();
+  void set_allocated_shake(::CUserMsg_Shake* shake);
+  private:
+  const ::CUserMsg_Shake& _internal_shake() const;
+  ::CUserMsg_Shake* _internal_mutable_shake();
+  public:
+  void unsafe_arena_set_allocated_shake(
+      ::CUserMsg_Shake* shake);
+  ::CUserMsg_Shake* unsafe_arena_release_shake();
+
+  // optional .CMsgVector direction = 2;
+  bool has_direction() const;
+  private:
+  bool _internal_has_direction() const;
+  public:
+  void clear_direction();
+  const ::CMsgVector& direction() const;
+  PROTOBUF_NODISCARD ::CMsgVector* release_direction();
+  ::CMsgVector* mutable_direction();
+  void set_allocated_direction(::CMsgVector* direction);
+  private:
+  const ::CMsgVector& _internal_direction() const;
+  ::CMsgVector* _internal_mutable_direction();
+  public:
+  void unsafe_arena_set_allocated_direction(
+      ::CMsgVector* direction);
+  ::CMsgVector* unsafe_arena_release_direction();
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_ShakeDir)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CUserMsg_Shake* shake_;
+    ::CMsgVector* direction_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_Tilt final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_Tilt) */ {
+ public:
+  inline CUserMsg_Tilt() : CUserMsg_Tilt(nullptr) {}
+  ~CUserMsg_Tilt() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_Tilt(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_Tilt(const CUserMsg_Tilt& from);
+  CUserMsg_Tilt(CUserMsg_Tilt&& from) noexcept
+    : CUserMsg_Tilt() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_Tilt& operator=(const CUserMsg_Tilt& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_Tilt& operator=(CUserMsg_Tilt&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_Tilt& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_Tilt* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_Tilt*>(
+               &_CUserMsg_Tilt_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(CUserMsg_Tilt& a, CUserMsg_Tilt& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_Tilt* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_Tilt* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_Tilt* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_Tilt>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_Tilt& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_Tilt& from) {
+    CUserMsg_Tilt::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_Tilt* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_Tilt";
+  }
+  protected:
+  explicit CUserMsg_Tilt(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAngleFieldNumber = 3,
+    kCommandFieldNumber = 1,
+    kEaseInOutFieldNumber = 2,
+    kDurationFieldNumber = 4,
+    kTimeFieldNumber = 5,
+  };
+  // optional .CMsgVector angle = 3;
+  bool has_angle() const;
+  private:
+  bool _internal_has_angle() const;
+  public:
+  void clear_angle();
+  const ::CMsgVector& angle() const;
+  PROTOBUF_NODISCARD ::CMsgVector* release_angle();
+  ::CMsgVector* mutable_angle();
+  void set_allocated_angle(::CMsgVector* angle);
+  private:
+  const ::CMsgVector& _internal_angle() const;
+  ::CMsgVector* _internal_mutable_angle();
+  public:
+  void unsafe_arena_set_allocated_angle(
+      ::CMsgVector* angle);
+  ::CMsgVector* unsafe_arena_release_angle();
+
+  // optional uint32 command = 1;
+  bool has_command() const;
+  private:
+  bool _internal_has_command() const;
+  public:
+  void clear_command();
+  uint32_t command() const;
+  void set_command(uint32_t value);
+  private:
+  uint32_t _internal_command() const;
+  void _internal_set_command(uint32_t value);
+  public:
+
+  // optional bool ease_in_out = 2;
+  bool has_ease_in_out() const;
+  private:
+  bool _internal_has_ease_in_out() const;
+  public:
+  void clear_ease_in_out();
+  bool ease_in_out() const;
+  void set_ease_in_out(bool value);
+  private:
+  bool _internal_ease_in_out() const;
+  void _internal_set_ease_in_out(bool value);
+  public:
+
+  // optional float duration = 4;
+  bool has_duration() const;
+  private:
+  bool _internal_has_duration() const;
+  public:
+  void clear_duration();
+  float duration() const;
+  void set_duration(float value);
+  private:
+  float _internal_duration() const;
+  void _internal_set_duration(float value);
+  public:
+
+  // optional float time = 5;
+  bool has_time() const;
+  private:
+  bool _internal_has_time() const;
+  public:
+  void clear_time();
+  float time() const;
+  void set_time(float value);
+  private:
+  float _internal_time() const;
+  void _internal_set_time(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_Tilt)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CMsgVector* angle_;
+    uint32_t command_;
+    bool ease_in_out_;
+    float duration_;
+    float time_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_SayText final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_SayText) */ {
+ public:
+  inline CUserMsg_SayText() : CUserMsg_SayText(nullptr) {}
+  ~CUserMsg_SayText() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_SayText(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_SayText(const CUserMsg_SayText& from);
+  CUserMsg_SayText(CUserMsg_SayText&& from) noexcept
+    : CUserMsg_SayText() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_SayText& operator=(const CUserMsg_SayText& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_SayText& operator=(CUserMsg_SayText&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_SayText& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_SayText* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_SayText*>(
+               &_CUserMsg_SayText_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(CUserMsg_SayText& a, CUserMsg_SayText& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_SayText* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_SayText* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_SayText* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_SayText>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_SayText& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_SayText& from) {
+    CUserMsg_SayText::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_SayText* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_SayText";
+  }
+  protected:
+  explicit CUserMsg_SayText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTextFieldNumber = 2,
+    kClientFieldNumber = 1,
+    kChatFieldNumber = 3,
+  };
+  // optional string text = 2;
+  bool has_text() const;
+  private:
+  bool _internal_has_text() const;
+  public:
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // optional uint32 client = 1;
+  bool has_client() const;
+  private:
+  bool _internal_has_client() const;
+  public:
+  void clear_client();
+  uint32_t client() const;
+  void set_client(uint32_t value);
+  private:
+  uint32_t _internal_client() const;
+  void _internal_set_client(uint32_t value);
+  public:
+
+  // optional bool chat = 3;
+  bool has_chat() const;
+  private:
+  bool _internal_has_chat() const;
+  public:
+  void clear_chat();
+  bool chat() const;
+  void set_chat(bool value);
+  private:
+  bool _internal_chat() const;
+  void _internal_set_chat(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_SayText)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    uint32_t client_;
+    bool chat_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_SayText2 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_SayText2) */ {
+ public:
+  inline CUserMsg_SayText2() : CUserMsg_SayText2(nullptr) {}
+  ~CUserMsg_SayText2() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_SayText2(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_SayText2(const CUserMsg_SayText2& from);
+  CUserMsg_SayText2(CUserMsg_SayText2&& from) noexcept
+    : CUserMsg_SayText2() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_SayText2& operator=(const CUserMsg_SayText2& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_SayText2& operator=(CUserMsg_SayText2&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_SayText2& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_SayText2* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_SayText2*>(
+               &_CUserMsg_SayText2_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(CUserMsg_SayText2& a, CUserMsg_SayText2& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_SayText2* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_SayText2* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_SayText2* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_SayText2>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_SayText2& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_SayText2& from) {
+    CUserMsg_SayText2::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_SayText2* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_SayText2";
+  }
+  protected:
+  explicit CUserMsg_SayText2(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFormatFieldNumber = 3,
+    kPrefixFieldNumber = 4,
+    kTextFieldNumber = 5,
+    kLocationFieldNumber = 6,
+    kClientFieldNumber = 1,
+    kChatFieldNumber = 2,
+  };
+  // optional string format = 3;
+  bool has_format() const;
+  private:
+  bool _internal_has_format() const;
+  public:
+  void clear_format();
+  const std::string& format() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_format(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_format();
+  PROTOBUF_NODISCARD std::string* release_format();
+  void set_allocated_format(std::string* format);
+  private:
+  const std::string& _internal_format() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_format(const std::string& value);
+  std::string* _internal_mutable_format();
+  public:
+
+  // optional string prefix = 4;
+  bool has_prefix() const;
+  private:
+  bool _internal_has_prefix() const;
+  public:
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
+  private:
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
+  public:
+
+  // optional string text = 5;
+  bool has_text() const;
+  private:
+  bool _internal_has_text() const;
+  public:
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // optional string location = 6;
+  bool has_location() const;
+  private:
+  bool _internal_has_location() const;
+  public:
+  void clear_location();
+  const std::string& location() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_location(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_location();
+  PROTOBUF_NODISCARD std::string* release_location();
+  void set_allocated_location(std::string* location);
+  private:
+  const std::string& _internal_location() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_location(const std::string& value);
+  std::string* _internal_mutable_location();
+  public:
+
+  // optional uint32 client = 1;
+  bool has_client() const;
+  private:
+  bool _internal_has_client() const;
+  public:
+  void clear_client();
+  uint32_t client() const;
+  void set_client(uint32_t value);
+  private:
+  uint32_t _internal_client() const;
+  void _internal_set_client(uint32_t value);
+  public:
+
+  // optional bool chat = 2;
+  bool has_chat() const;
+  private:
+  bool _internal_has_chat() const;
+  public:
+  void clear_chat();
+  bool chat() const;
+  void set_chat(bool value);
+  private:
+  bool _internal_chat() const;
+  void _internal_set_chat(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_SayText2)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr format_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr location_;
+    uint32_t client_;
+    bool chat_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_HudMsg final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_HudMsg) */ {
+ public:
+  inline CUserMsg_HudMsg() : CUserMsg_HudMsg(nullptr) {}
+  ~CUserMsg_HudMsg() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_HudMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_HudMsg(const CUserMsg_HudMsg& from);
+  CUserMsg_HudMsg(CUserMsg_HudMsg&& from) noexcept
+    : CUserMsg_HudMsg() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_HudMsg& operator=(const CUserMsg_HudMsg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_HudMsg& operator=(CUserMsg_HudMsg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_HudMsg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_HudMsg* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_HudMsg*>(
+               &_CUserMsg_HudMsg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(CUserMsg_HudMsg& a, CUserMsg_HudMsg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_HudMsg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_HudMsg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_HudMsg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_HudMsg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_HudMsg& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_HudMsg& from) {
+    CUserMsg_HudMsg::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_HudMsg* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_HudMsg";
+  }
+  protected:
+  explicit CUserMsg_HudMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 11,
+    kChannelFieldNumber = 1,
+    kXFieldNumber = 2,
+    kYFieldNumber = 3,
+    kColor1FieldNumber = 4,
+    kColor2FieldNumber = 5,
+    kEffectFieldNumber = 6,
+    kFadeInTimeFieldNumber = 7,
+    kFadeOutTimeFieldNumber = 8,
+    kHoldTimeFieldNumber = 9,
+    kFxTimeFieldNumber = 10,
+  };
+  // optional string message = 11;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // optional uint32 channel = 1;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  uint32_t channel() const;
+  void set_channel(uint32_t value);
+  private:
+  uint32_t _internal_channel() const;
+  void _internal_set_channel(uint32_t value);
+  public:
+
+  // optional float x = 2;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  float x() const;
+  void set_x(float value);
+  private:
+  float _internal_x() const;
+  void _internal_set_x(float value);
+  public:
+
+  // optional float y = 3;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  float y() const;
+  void set_y(float value);
+  private:
+  float _internal_y() const;
+  void _internal_set_y(float value);
+  public:
+
+  // optional uint32 color1 = 4;
+  bool has_color1() const;
+  private:
+  bool _internal_has_color1() const;
+  public:
+  void clear_color1();
+  uint32_t color1() const;
+  void set_color1(uint32_t value);
+  private:
+  uint32_t _internal_color1() const;
+  void _internal_set_color1(uint32_t value);
+  public:
+
+  // optional uint32 color2 = 5;
+  bool has_color2() const;
+  private:
+  bool _internal_has_color2() const;
+  public:
+  void clear_color2();
+  uint32_t color2() const;
+  void set_color2(uint32_t value);
+  private:
+  uint32_t _internal_color2() const;
+  void _internal_set_color2(uint32_t value);
+  public:
+
+  // optional uint32 effect = 6;
+  bool has_effect() const;
+  private:
+  bool _internal_has_effect() const;
+  public:
+  void clear_effect();
+  uint32_t effect() const;
+  void set_effect(uint32_t value);
+  private:
+  uint32_t _internal_effect() const;
+  void _internal_set_effect(uint32_t value);
+  public:
+
+  // optional float fade_in_time = 7;
+  bool has_fade_in_time() const;
+  private:
+  bool _internal_has_fade_in_time() const;
+  public:
+  void clear_fade_in_time();
+  float fade_in_time() const;
+  void set_fade_in_time(float value);
+  private:
+  float _internal_fade_in_time() const;
+  void _internal_set_fade_in_time(float value);
+  public:
+
+  // optional float fade_out_time = 8;
+  bool has_fade_out_time() const;
+  private:
+  bool _internal_has_fade_out_time() const;
+  public:
+  void clear_fade_out_time();
+  float fade_out_time() const;
+  void set_fade_out_time(float value);
+  private:
+  float _internal_fade_out_time() const;
+  void _internal_set_fade_out_time(float value);
+  public:
+
+  // optional float hold_time = 9;
+  bool has_hold_time() const;
+  private:
+  bool _internal_has_hold_time() const;
+  public:
+  void clear_hold_time();
+  float hold_time() const;
+  void set_hold_time(float value);
+  private:
+  float _internal_hold_time() const;
+  void _internal_set_hold_time(float value);
+  public:
+
+  // optional float fx_time = 10;
+  bool has_fx_time() const;
+  private:
+  bool _internal_has_fx_time() const;
+  public:
+  void clear_fx_time();
+  float fx_time() const;
+  void set_fx_time(float value);
+  private:
+  float _internal_fx_time() const;
+  void _internal_set_fx_time(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_HudMsg)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    uint32_t channel_;
+    float x_;
+    float y_;
+    uint32_t color1_;
+    uint32_t color2_;
+    uint32_t effect_;
+    float fade_in_time_;
+    float fade_out_time_;
+    float hold_time_;
+    float fx_time_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_HudText final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_HudText) */ {
+ public:
+  inline CUserMsg_HudText() : CUserMsg_HudText(nullptr) {}
+  ~CUserMsg_HudText() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_HudText(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_HudText(const CUserMsg_HudText& from);
+  CUserMsg_HudText(CUserMsg_HudText&& from) noexcept
+    : CUserMsg_HudText() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_HudText& operator=(const CUserMsg_HudText& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_HudText& operator=(CUserMsg_HudText&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_HudText& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_HudText* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_HudText*>(
+               &_CUserMsg_HudText_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(CUserMsg_HudText& a, CUserMsg_HudText& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_HudText* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_HudText* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_HudText* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_HudText>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_HudText& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_HudText& from) {
+    CUserMsg_HudText::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_HudText* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_HudText";
+  }
+  protected:
+  explicit CUserMsg_HudText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+  };
+  // optional string message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_HudText)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_TextMsg final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_TextMsg) */ {
+ public:
+  inline CUserMsg_TextMsg() : CUserMsg_TextMsg(nullptr) {}
+  ~CUserMsg_TextMsg() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_TextMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_TextMsg(const CUserMsg_TextMsg& from);
+  CUserMsg_TextMsg(CUserMsg_TextMsg&& from) noexcept
+    : CUserMsg_TextMsg() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_TextMsg& operator=(const CUserMsg_TextMsg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_TextMsg& operator=(CUserMsg_TextMsg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_TextMsg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_TextMsg* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_TextMsg*>(
+               &_CUserMsg_TextMsg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(CUserMsg_TextMsg& a, CUserMsg_TextMsg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_TextMsg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_TextMsg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_TextMsg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_TextMsg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_TextMsg& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_TextMsg& from) {
+    CUserMsg_TextMsg::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_TextMsg* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_TextMsg";
+  }
+  protected:
+  explicit CUserMsg_TextMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParamFieldNumber = 2,
+    kDestFieldNumber = 1,
+  };
+  // repeated string param = 2;
+  int param_size() const;
+  private:
+  int _internal_param_size() const;
+  public:
+  void clear_param();
+  const std::string& param(int index) const;
+  std::string* mutable_param(int index);
+  void set_param(int index, const std::string& value);
+  void set_param(int index, std::string&& value);
+  void set_param(int index, const char* value);
+  void set_param(int index, const char* value, size_t size);
+  std::string* add_param();
+  void add_param(const std::string& value);
+  void add_param(std::string&& value);
+  void add_param(const char* value);
+  void add_param(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& param() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_param();
+  private:
+  const std::string& _internal_param(int index) const;
+  std::string* _internal_add_param();
+  public:
+
+  // optional uint32 dest = 1;
+  bool has_dest() const;
+  private:
+  bool _internal_has_dest() const;
+  public:
+  void clear_dest();
+  uint32_t dest() const;
+  void set_dest(uint32_t value);
+  private:
+  uint32_t _internal_dest() const;
+  void _internal_set_dest(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_TextMsg)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> param_;
+    uint32_t dest_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_GameTitle final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:CUserMsg_GameTitle) */ {
+ public:
+  inline CUserMsg_GameTitle() : CUserMsg_GameTitle(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CUserMsg_GameTitle(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_GameTitle(const CUserMsg_GameTitle& from);
+  CUserMsg_GameTitle(CUserMsg_GameTitle&& from) noexcept
+    : CUserMsg_GameTitle() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_GameTitle& operator=(const CUserMsg_GameTitle& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_GameTitle& operator=(CUserMsg_GameTitle&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_GameTitle& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_GameTitle* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_GameTitle*>(
+               &_CUserMsg_GameTitle_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(CUserMsg_GameTitle& a, CUserMsg_GameTitle& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_GameTitle* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_GameTitle* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_GameTitle* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_GameTitle>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CUserMsg_GameTitle& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CUserMsg_GameTitle& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_GameTitle";
+  }
+  protected:
+  explicit CUserMsg_GameTitle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_GameTitle)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_ResetHUD final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:CUserMsg_ResetHUD) */ {
+ public:
+  inline CUserMsg_ResetHUD() : CUserMsg_ResetHUD(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CUserMsg_ResetHUD(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_ResetHUD(const CUserMsg_ResetHUD& from);
+  CUserMsg_ResetHUD(CUserMsg_ResetHUD&& from) noexcept
+    : CUserMsg_ResetHUD() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_ResetHUD& operator=(const CUserMsg_ResetHUD& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_ResetHUD& operator=(CUserMsg_ResetHUD&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_ResetHUD& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_ResetHUD* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_ResetHUD*>(
+               &_CUserMsg_ResetHUD_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(CUserMsg_ResetHUD& a, CUserMsg_ResetHUD& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_ResetHUD* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_ResetHUD* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_ResetHUD* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_ResetHUD>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CUserMsg_ResetHUD& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CUserMsg_ResetHUD& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_ResetHUD";
+  }
+  protected:
+  explicit CUserMsg_ResetHUD(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_ResetHUD)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_SendAudio final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_SendAudio) */ {
+ public:
+  inline CUserMsg_SendAudio() : CUserMsg_SendAudio(nullptr) {}
+  ~CUserMsg_SendAudio() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_SendAudio(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_SendAudio(const CUserMsg_SendAudio& from);
+  CUserMsg_SendAudio(CUserMsg_SendAudio&& from) noexcept
+    : CUserMsg_SendAudio() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_SendAudio& operator=(const CUserMsg_SendAudio& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_SendAudio& operator=(CUserMsg_SendAudio&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_SendAudio& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_SendAudio* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_SendAudio*>(
+               &_CUserMsg_SendAudio_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(CUserMsg_SendAudio& a, CUserMsg_SendAudio& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_SendAudio* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_SendAudio* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_SendAudio* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_SendAudio>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_SendAudio& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_SendAudio& from) {
+    CUserMsg_SendAudio::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_SendAudio* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_SendAudio";
+  }
+  protected:
+  explicit CUserMsg_SendAudio(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 3,
+    kStopFieldNumber = 2,
+  };
+  // optional string name = 3;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional bool stop = 2;
+  bool has_stop() const;
+  private:
+  bool _internal_has_stop() const;
+  public:
+  void clear_stop();
+  bool stop() const;
+  void set_stop(bool value);
+  private:
+  bool _internal_stop() const;
+  void _internal_set_stop(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_SendAudio)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    bool stop_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_VoiceMask final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_VoiceMask) */ {
+ public:
+  inline CUserMsg_VoiceMask() : CUserMsg_VoiceMask(nullptr) {}
+  ~CUserMsg_VoiceMask() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_VoiceMask(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_VoiceMask(const CUserMsg_VoiceMask& from);
+  CUserMsg_VoiceMask(CUserMsg_VoiceMask&& from) noexcept
+    : CUserMsg_VoiceMask() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_VoiceMask& operator=(const CUserMsg_VoiceMask& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_VoiceMask& operator=(CUserMsg_VoiceMask&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_VoiceMask& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_VoiceMask* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_VoiceMask*>(
+               &_CUserMsg_VoiceMask_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(CUserMsg_VoiceMask& a, CUserMsg_VoiceMask& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_VoiceMask* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_VoiceMask* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_VoiceMask* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_VoiceMask>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_VoiceMask& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_VoiceMask& from) {
+    CUserMsg_VoiceMask::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_VoiceMask* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_VoiceMask";
+  }
+  protected:
+  explicit CUserMsg_VoiceMask(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAudiblePlayersMaskFieldNumber = 1,
+    kPlayerModEnabledFieldNumber = 2,
+  };
+  // repeated int32 audible_players_mask = 1;
+  int audible_players_mask_size() const;
+  private:
+  int _internal_audible_players_mask_size() const;
+  public:
+  void clear_audible_players_mask();
+  private:
+  int32_t _internal_audible_players_mask(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_audible_players_mask() const;
+  void _internal_add_audible_players_mask(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_audible_players_mask();
+  public:
+  int32_t audible_players_mask(int index) const;
+  void set_audible_players_mask(int index, int32_t value);
+  void add_audible_players_mask(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      audible_players_mask() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_audible_players_mask();
+
+  // optional bool player_mod_enabled = 2;
+  bool has_player_mod_enabled() const;
+  private:
+  bool _internal_has_player_mod_enabled() const;
+  public:
+  void clear_player_mod_enabled();
+  bool player_mod_enabled() const;
+  void set_player_mod_enabled(bool value);
+  private:
+  bool _internal_player_mod_enabled() const;
+  void _internal_set_player_mod_enabled(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_VoiceMask)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > audible_players_mask_;
+    bool player_mod_enabled_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_RequestState final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:CUserMsg_RequestState) */ {
+ public:
+  inline CUserMsg_RequestState() : CUserMsg_RequestState(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CUserMsg_RequestState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_RequestState(const CUserMsg_RequestState& from);
+  CUserMsg_RequestState(CUserMsg_RequestState&& from) noexcept
+    : CUserMsg_RequestState() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_RequestState& operator=(const CUserMsg_RequestState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_RequestState& operator=(CUserMsg_RequestState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_RequestState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_RequestState* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_RequestState*>(
+               &_CUserMsg_RequestState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(CUserMsg_RequestState& a, CUserMsg_RequestState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_RequestState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_RequestState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_RequestState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_RequestState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CUserMsg_RequestState& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CUserMsg_RequestState& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_RequestState";
+  }
+  protected:
+  explicit CUserMsg_RequestState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_RequestState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_HintText final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_HintText) */ {
+ public:
+  inline CUserMsg_HintText() : CUserMsg_HintText(nullptr) {}
+  ~CUserMsg_HintText() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_HintText(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_HintText(const CUserMsg_HintText& from);
+  CUserMsg_HintText(CUserMsg_HintText&& from) noexcept
+    : CUserMsg_HintText() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_HintText& operator=(const CUserMsg_HintText& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_HintText& operator=(CUserMsg_HintText&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_HintText& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_HintText* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_HintText*>(
+               &_CUserMsg_HintText_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(CUserMsg_HintText& a, CUserMsg_HintText& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_HintText* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_HintText* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_HintText* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_HintText>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_HintText& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_HintText& from) {
+    CUserMsg_HintText::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_HintText* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_HintText";
+  }
+  protected:
+  explicit CUserMsg_HintText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 1,
+  };
+  // optional string message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_HintText)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_KeyHintText final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_KeyHintText) */ {
+ public:
+  inline CUserMsg_KeyHintText() : CUserMsg_KeyHintText(nullptr) {}
+  ~CUserMsg_KeyHintText() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_KeyHintText(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_KeyHintText(const CUserMsg_KeyHintText& from);
+  CUserMsg_KeyHintText(CUserMsg_KeyHintText&& from) noexcept
+    : CUserMsg_KeyHintText() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_KeyHintText& operator=(const CUserMsg_KeyHintText& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_KeyHintText& operator=(CUserMsg_KeyHintText&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_KeyHintText& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_KeyHintText* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_KeyHintText*>(
+               &_CUserMsg_KeyHintText_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(CUserMsg_KeyHintText& a, CUserMsg_KeyHintText& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_KeyHintText* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_KeyHintText* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_KeyHintText* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_KeyHintText>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_KeyHintText& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_KeyHintText& from) {
+    CUserMsg_KeyHintText::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_KeyHintText* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_KeyHintText";
+  }
+  protected:
+  explicit CUserMsg_KeyHintText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated string messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  const std::string& messages(int index) const;
+  std::string* mutable_messages(int index);
+  void set_messages(int index, const std::string& value);
+  void set_messages(int index, std::string&& value);
+  void set_messages(int index, const char* value);
+  void set_messages(int index, const char* value, size_t size);
+  std::string* add_messages();
+  void add_messages(const std::string& value);
+  void add_messages(std::string&& value);
+  void add_messages(const char* value);
+  void add_messages(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& messages() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_messages();
+  private:
+  const std::string& _internal_messages(int index) const;
+  std::string* _internal_add_messages();
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_KeyHintText)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_StatsCrawlMsg final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:CUserMsg_StatsCrawlMsg) */ {
+ public:
+  inline CUserMsg_StatsCrawlMsg() : CUserMsg_StatsCrawlMsg(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR CUserMsg_StatsCrawlMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_StatsCrawlMsg(const CUserMsg_StatsCrawlMsg& from);
+  CUserMsg_StatsCrawlMsg(CUserMsg_StatsCrawlMsg&& from) noexcept
+    : CUserMsg_StatsCrawlMsg() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_StatsCrawlMsg& operator=(const CUserMsg_StatsCrawlMsg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_StatsCrawlMsg& operator=(CUserMsg_StatsCrawlMsg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_StatsCrawlMsg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_StatsCrawlMsg* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_StatsCrawlMsg*>(
+               &_CUserMsg_StatsCrawlMsg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(CUserMsg_StatsCrawlMsg& a, CUserMsg_StatsCrawlMsg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_StatsCrawlMsg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_StatsCrawlMsg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_StatsCrawlMsg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_StatsCrawlMsg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const CUserMsg_StatsCrawlMsg& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const CUserMsg_StatsCrawlMsg& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_StatsCrawlMsg";
+  }
+  protected:
+  explicit CUserMsg_StatsCrawlMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_StatsCrawlMsg)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_StatsSkipState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_StatsSkipState) */ {
+ public:
+  inline CUserMsg_StatsSkipState() : CUserMsg_StatsSkipState(nullptr) {}
+  ~CUserMsg_StatsSkipState() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_StatsSkipState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_StatsSkipState(const CUserMsg_StatsSkipState& from);
+  CUserMsg_StatsSkipState(CUserMsg_StatsSkipState&& from) noexcept
+    : CUserMsg_StatsSkipState() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_StatsSkipState& operator=(const CUserMsg_StatsSkipState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_StatsSkipState& operator=(CUserMsg_StatsSkipState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_StatsSkipState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_StatsSkipState* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_StatsSkipState*>(
+               &_CUserMsg_StatsSkipState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(CUserMsg_StatsSkipState& a, CUserMsg_StatsSkipState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_StatsSkipState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_StatsSkipState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_StatsSkipState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_StatsSkipState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_StatsSkipState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_StatsSkipState& from) {
+    CUserMsg_StatsSkipState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_StatsSkipState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_StatsSkipState";
+  }
+  protected:
+  explicit CUserMsg_StatsSkipState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumSkipsFieldNumber = 1,
+    kNumPlayersFieldNumber = 2,
+  };
+  // optional int32 num_skips = 1;
+  bool has_num_skips() const;
+  private:
+  bool _internal_has_num_skips() const;
+  public:
+  void clear_num_skips();
+  int32_t num_skips() const;
+  void set_num_skips(int32_t value);
+  private:
+  int32_t _internal_num_skips() const;
+  void _internal_set_num_skips(int32_t value);
+  public:
+
+  // optional int32 num_players = 2;
+  bool has_num_players() const;
+  private:
+  bool _internal_has_num_players() const;
+  public:
+  void clear_num_players();
+  int32_t num_players() const;
+  void set_num_players(int32_t value);
+  private:
+  int32_t _internal_num_players() const;
+  void _internal_set_num_players(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_StatsSkipState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t num_skips_;
+    int32_t num_players_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_VoiceSubtitle final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_VoiceSubtitle) */ {
+ public:
+  inline CUserMsg_VoiceSubtitle() : CUserMsg_VoiceSubtitle(nullptr) {}
+  ~CUserMsg_VoiceSubtitle() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_VoiceSubtitle(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_VoiceSubtitle(const CUserMsg_VoiceSubtitle& from);
+  CUserMsg_VoiceSubtitle(CUserMsg_VoiceSubtitle&& from) noexcept
+    : CUserMsg_VoiceSubtitle() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_VoiceSubtitle& operator=(const CUserMsg_VoiceSubtitle& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_VoiceSubtitle& operator=(CUserMsg_VoiceSubtitle&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_VoiceSubtitle& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_VoiceSubtitle* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_VoiceSubtitle*>(
+               &_CUserMsg_VoiceSubtitle_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(CUserMsg_VoiceSubtitle& a, CUserMsg_VoiceSubtitle& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_VoiceSubtitle* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_VoiceSubtitle* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_VoiceSubtitle* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_VoiceSubtitle>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_VoiceSubtitle& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_VoiceSubtitle& from) {
+    CUserMsg_VoiceSubtitle::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_VoiceSubtitle* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_VoiceSubtitle";
+  }
+  protected:
+  explicit CUserMsg_VoiceSubtitle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntIndexFieldNumber = 1,
+    kMenuFieldNumber = 2,
+    kItemFieldNumber = 3,
+  };
+  // optional int32 ent_index = 1;
+  bool has_ent_index() const;
+  private:
+  bool _internal_has_ent_index() const;
+  public:
+  void clear_ent_index();
+  int32_t ent_index() const;
+  void set_ent_index(int32_t value);
+  private:
+  int32_t _internal_ent_index() const;
+  void _internal_set_ent_index(int32_t value);
+  public:
+
+  // optional int32 menu = 2;
+  bool has_menu() const;
+  private:
+  bool _internal_has_menu() const;
+  public:
+  void clear_menu();
+  int32_t menu() const;
+  void set_menu(int32_t value);
+  private:
+  int32_t _internal_menu() const;
+  void _internal_set_menu(int32_t value);
+  public:
+
+  // optional int32 item = 3;
+  bool has_item() const;
+  private:
+  bool _internal_has_item() const;
+  public:
+  void clear_item();
+  int32_t item() const;
+  void set_item(int32_t value);
+  private:
+  int32_t _internal_item() const;
+  void _internal_set_item(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_VoiceSubtitle)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t ent_index_;
+    int32_t menu_;
+    int32_t item_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_VGUIMenu_Keys final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_VGUIMenu.Keys) */ {
+ public:
+  inline CUserMsg_VGUIMenu_Keys() : CUserMsg_VGUIMenu_Keys(nullptr) {}
+  ~CUserMsg_VGUIMenu_Keys() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_VGUIMenu_Keys(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_VGUIMenu_Keys(const CUserMsg_VGUIMenu_Keys& from);
+  CUserMsg_VGUIMenu_Keys(CUserMsg_VGUIMenu_Keys&& from) noexcept
+    : CUserMsg_VGUIMenu_Keys() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_VGUIMenu_Keys& operator=(const CUserMsg_VGUIMenu_Keys& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_VGUIMenu_Keys& operator=(CUserMsg_VGUIMenu_Keys&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_VGUIMenu_Keys& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_VGUIMenu_Keys* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_VGUIMenu_Keys*>(
+               &_CUserMsg_VGUIMenu_Keys_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(CUserMsg_VGUIMenu_Keys& a, CUserMsg_VGUIMenu_Keys& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_VGUIMenu_Keys* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_VGUIMenu_Keys* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_VGUIMenu_Keys* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_VGUIMenu_Keys>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_VGUIMenu_Keys& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_VGUIMenu_Keys& from) {
+    CUserMsg_VGUIMenu_Keys::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_VGUIMenu_Keys* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_VGUIMenu.Keys";
+  }
+  protected:
+  explicit CUserMsg_VGUIMenu_Keys(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_VGUIMenu.Keys)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_VGUIMenu final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_VGUIMenu) */ {
+ public:
+  inline CUserMsg_VGUIMenu() : CUserMsg_VGUIMenu(nullptr) {}
+  ~CUserMsg_VGUIMenu() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_VGUIMenu(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_VGUIMenu(const CUserMsg_VGUIMenu& from);
+  CUserMsg_VGUIMenu(CUserMsg_VGUIMenu&& from) noexcept
+    : CUserMsg_VGUIMenu() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_VGUIMenu& operator=(const CUserMsg_VGUIMenu& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_VGUIMenu& operator=(CUserMsg_VGUIMenu&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_VGUIMenu& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_VGUIMenu* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_VGUIMenu*>(
+               &_CUserMsg_VGUIMenu_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(CUserMsg_VGUIMenu& a, CUserMsg_VGUIMenu& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_VGUIMenu* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_VGUIMenu* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_VGUIMenu* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_VGUIMenu>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_VGUIMenu& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_VGUIMenu& from) {
+    CUserMsg_VGUIMenu::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_VGUIMenu* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_VGUIMenu";
+  }
+  protected:
+  explicit CUserMsg_VGUIMenu(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CUserMsg_VGUIMenu_Keys Keys;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 3,
+    kNameFieldNumber = 1,
+    kShowFieldNumber = 2,
+  };
+  // repeated .CUserMsg_VGUIMenu.Keys keys = 3;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  ::CUserMsg_VGUIMenu_Keys* mutable_keys(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CUserMsg_VGUIMenu_Keys >*
+      mutable_keys();
+  private:
+  const ::CUserMsg_VGUIMenu_Keys& _internal_keys(int index) const;
+  ::CUserMsg_VGUIMenu_Keys* _internal_add_keys();
+  public:
+  const ::CUserMsg_VGUIMenu_Keys& keys(int index) const;
+  ::CUserMsg_VGUIMenu_Keys* add_keys();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CUserMsg_VGUIMenu_Keys >&
+      keys() const;
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional bool show = 2;
+  bool has_show() const;
+  private:
+  bool _internal_has_show() const;
+  public:
+  void clear_show();
+  bool show() const;
+  void set_show(bool value);
+  private:
+  bool _internal_show() const;
+  void _internal_set_show(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_VGUIMenu)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CUserMsg_VGUIMenu_Keys > keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    bool show_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_Geiger final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_Geiger) */ {
+ public:
+  inline CUserMsg_Geiger() : CUserMsg_Geiger(nullptr) {}
+  ~CUserMsg_Geiger() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_Geiger(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_Geiger(const CUserMsg_Geiger& from);
+  CUserMsg_Geiger(CUserMsg_Geiger&& from) noexcept
+    : CUserMsg_Geiger() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_Geiger& operator=(const CUserMsg_Geiger& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_Geiger& operator=(CUserMsg_Geiger&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_Geiger& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_Geiger* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_Geiger*>(
+               &_CUserMsg_Geiger_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(CUserMsg_Geiger& a, CUserMsg_Geiger& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_Geiger* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_Geiger* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_Geiger* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_Geiger>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_Geiger& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_Geiger& from) {
+    CUserMsg_Geiger::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_Geiger* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_Geiger";
+  }
+  protected:
+  explicit CUserMsg_Geiger(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRangeFieldNumber = 1,
+  };
+  // optional int32 range = 1;
+  bool has_range() const;
+  private:
+  bool _internal_has_range() const;
+  public:
+  void clear_range();
+  int32_t range() const;
+  void set_range(int32_t value);
+  private:
+  int32_t _internal_range() const;
+  void _internal_set_range(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_Geiger)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t range_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_Rumble final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_Rumble) */ {
+ public:
+  inline CUserMsg_Rumble() : CUserMsg_Rumble(nullptr) {}
+  ~CUserMsg_Rumble() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_Rumble(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_Rumble(const CUserMsg_Rumble& from);
+  CUserMsg_Rumble(CUserMsg_Rumble&& from) noexcept
+    : CUserMsg_Rumble() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_Rumble& operator=(const CUserMsg_Rumble& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_Rumble& operator=(CUserMsg_Rumble&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_Rumble& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_Rumble* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_Rumble*>(
+               &_CUserMsg_Rumble_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(CUserMsg_Rumble& a, CUserMsg_Rumble& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_Rumble* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_Rumble* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_Rumble* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_Rumble>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_Rumble& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_Rumble& from) {
+    CUserMsg_Rumble::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_Rumble* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_Rumble";
+  }
+  protected:
+  explicit CUserMsg_Rumble(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIndexFieldNumber = 1,
+    kDataFieldNumber = 2,
+    kFlagsFieldNumber = 3,
+  };
+  // optional int32 index = 1;
+  bool has_index() const;
+  private:
+  bool _internal_has_index() const;
+  public:
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
+  private:
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
+  public:
+
+  // optional int32 data = 2;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  int32_t data() const;
+  void set_data(int32_t value);
+  private:
+  int32_t _internal_data() const;
+  void _internal_set_data(int32_t value);
+  public:
+
+  // optional int32 flags = 3;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  int32_t flags() const;
+  void set_flags(int32_t value);
+  private:
+  int32_t _internal_flags() const;
+  void _internal_set_flags(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_Rumble)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t index_;
+    int32_t data_;
+    int32_t flags_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_Train final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_Train) */ {
+ public:
+  inline CUserMsg_Train() : CUserMsg_Train(nullptr) {}
+  ~CUserMsg_Train() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_Train(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_Train(const CUserMsg_Train& from);
+  CUserMsg_Train(CUserMsg_Train&& from) noexcept
+    : CUserMsg_Train() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_Train& operator=(const CUserMsg_Train& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_Train& operator=(CUserMsg_Train&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_Train& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_Train* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_Train*>(
+               &_CUserMsg_Train_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(CUserMsg_Train& a, CUserMsg_Train& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_Train* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_Train* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_Train* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_Train>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_Train& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_Train& from) {
+    CUserMsg_Train::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_Train* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_Train";
+  }
+  protected:
+  explicit CUserMsg_Train(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTrainFieldNumber = 1,
+  };
+  // optional int32 train = 1;
+  bool has_train() const;
+  private:
+  bool _internal_has_train() const;
+  public:
+  void clear_train();
+  int32_t train() const;
+  void set_train(int32_t value);
+  private:
+  int32_t _internal_train() const;
+  void _internal_set_train(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_Train)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t train_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_SayTextChannel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_SayTextChannel) */ {
+ public:
+  inline CUserMsg_SayTextChannel() : CUserMsg_SayTextChannel(nullptr) {}
+  ~CUserMsg_SayTextChannel() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_SayTextChannel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_SayTextChannel(const CUserMsg_SayTextChannel& from);
+  CUserMsg_SayTextChannel(CUserMsg_SayTextChannel&& from) noexcept
+    : CUserMsg_SayTextChannel() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_SayTextChannel& operator=(const CUserMsg_SayTextChannel& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_SayTextChannel& operator=(CUserMsg_SayTextChannel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_SayTextChannel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_SayTextChannel* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_SayTextChannel*>(
+               &_CUserMsg_SayTextChannel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(CUserMsg_SayTextChannel& a, CUserMsg_SayTextChannel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_SayTextChannel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_SayTextChannel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_SayTextChannel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_SayTextChannel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_SayTextChannel& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_SayTextChannel& from) {
+    CUserMsg_SayTextChannel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_SayTextChannel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_SayTextChannel";
+  }
+  protected:
+  explicit CUserMsg_SayTextChannel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTextFieldNumber = 3,
+    kPlayerFieldNumber = 1,
+    kChannelFieldNumber = 2,
+  };
+  // optional string text = 3;
+  bool has_text() const;
+  private:
+  bool _internal_has_text() const;
+  public:
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // optional int32 player = 1;
+  bool has_player() const;
+  private:
+  bool _internal_has_player() const;
+  public:
+  void clear_player();
+  int32_t player() const;
+  void set_player(int32_t value);
+  private:
+  int32_t _internal_player() const;
+  void _internal_set_player(int32_t value);
+  public:
+
+  // optional int32 channel = 2;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  int32_t channel() const;
+  void set_channel(int32_t value);
+  private:
+  int32_t _internal_channel() const;
+  void _internal_set_channel(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_SayTextChannel)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    int32_t player_;
+    int32_t channel_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_MessageText final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_MessageText) */ {
+ public:
+  inline CUserMsg_MessageText() : CUserMsg_MessageText(nullptr) {}
+  ~CUserMsg_MessageText() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_MessageText(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_MessageText(const CUserMsg_MessageText& from);
+  CUserMsg_MessageText(CUserMsg_MessageText&& from) noexcept
+    : CUserMsg_MessageText() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_MessageText& operator=(const CUserMsg_MessageText& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_MessageText& operator=(CUserMsg_MessageText&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_MessageText& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_MessageText* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_MessageText*>(
+               &_CUserMsg_MessageText_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(CUserMsg_MessageText& a, CUserMsg_MessageText& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_MessageText* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_MessageText* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_MessageText* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_MessageText>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_MessageText& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_MessageText& from) {
+    CUserMsg_MessageText::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_MessageText* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_MessageText";
+  }
+  protected:
+  explicit CUserMsg_MessageText(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTextFieldNumber = 2,
+    kColorFieldNumber = 1,
+  };
+  // optional string text = 2;
+  bool has_text() const;
+  private:
+  bool _internal_has_text() const;
+  public:
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // optional uint32 color = 1;
+  bool has_color() const;
+  private:
+  bool _internal_has_color() const;
+  public:
+  void clear_color();
+  uint32_t color() const;
+  void set_color(uint32_t value);
+  private:
+  uint32_t _internal_color() const;
+  void _internal_set_color(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_MessageText)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    uint32_t color_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_CameraTransition_Transition_DataDriven final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_CameraTransition.Transition_DataDriven) */ {
+ public:
+  inline CUserMsg_CameraTransition_Transition_DataDriven() : CUserMsg_CameraTransition_Transition_DataDriven(nullptr) {}
+  ~CUserMsg_CameraTransition_Transition_DataDriven() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_CameraTransition_Transition_DataDriven(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_CameraTransition_Transition_DataDriven(const CUserMsg_CameraTransition_Transition_DataDriven& from);
+  CUserMsg_CameraTransition_Transition_DataDriven(CUserMsg_CameraTransition_Transition_DataDriven&& from) noexcept
+    : CUserMsg_CameraTransition_Transition_DataDriven() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_CameraTransition_Transition_DataDriven& operator=(const CUserMsg_CameraTransition_Transition_DataDriven& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_CameraTransition_Transition_DataDriven& operator=(CUserMsg_CameraTransition_Transition_DataDriven&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_CameraTransition_Transition_DataDriven& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_CameraTransition_Transition_DataDriven* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_CameraTransition_Transition_DataDriven*>(
+               &_CUserMsg_CameraTransition_Transition_DataDriven_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(CUserMsg_CameraTransition_Transition_DataDriven& a, CUserMsg_CameraTransition_Transition_DataDriven& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_CameraTransition_Transition_DataDriven* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_CameraTransition_Transition_DataDriven* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_CameraTransition_Transition_DataDriven* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_CameraTransition_Transition_DataDriven>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_CameraTransition_Transition_DataDriven& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_CameraTransition_Transition_DataDriven& from) {
+    CUserMsg_CameraTransition_Transition_DataDriven::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_CameraTransition_Transition_DataDriven* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_CameraTransition.Transition_DataDriven";
+  }
+  protected:
+  explicit CUserMsg_CameraTransition_Transition_DataDriven(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFilenameFieldNumber = 1,
+    kAttachEntIndexFieldNumber = 2,
+  };
+  // optional string filename = 1;
+  bool has_filename() const;
+  private:
+  bool _internal_has_filename() const;
+  public:
+  void clear_filename();
+  const std::string& filename() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_filename(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_filename();
+  PROTOBUF_NODISCARD std::string* release_filename();
+  void set_allocated_filename(std::string* filename);
+  private:
+  const std::string& _internal_filename() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_filename(const std::string& value);
+  std::string* _internal_mutable_filename();
+  public:
+
+  // optional int32 attach_ent_index = 2;
+  bool has_attach_ent_index() const;
+  private:
+  bool _internal_has_attach_ent_index() const;
+  public:
+  void clear_attach_ent_index();
+  int32_t attach_ent_index() const;
+  void set_attach_ent_index(int32_t value);
+  private:
+  int32_t _internal_attach_ent_index() const;
+  void _internal_set_attach_ent_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_CameraTransition.Transition_DataDriven)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filename_;
+    int32_t attach_ent_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CUserMsg_CameraTransition final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:CUserMsg_CameraTransition) */ {
+ public:
+  inline CUserMsg_CameraTransition() : CUserMsg_CameraTransition(nullptr) {}
+  ~CUserMsg_CameraTransition() override;
+  explicit PROTOBUF_CONSTEXPR CUserMsg_CameraTransition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CUserMsg_CameraTransition(const CUserMsg_CameraTransition& from);
+  CUserMsg_CameraTransition(CUserMsg_CameraTransition&& from) noexcept
+    : CUserMsg_CameraTransition() {
+    *this = ::std::move(from);
+  }
+
+  inline CUserMsg_CameraTransition& operator=(const CUserMsg_CameraTransition& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CUserMsg_CameraTransition& operator=(CUserMsg_CameraTransition&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CUserMsg_CameraTransition& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CUserMsg_CameraTransition* internal_default_instance() {
+    return reinterpret_cast<const CUserMsg_CameraTransition*>(
+               &_CUserMsg_CameraTransition_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(CUserMsg_CameraTransition& a, CUserMsg_CameraTransition& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CUserMsg_CameraTransition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CUserMsg_CameraTransition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CUserMsg_CameraTransition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CUserMsg_CameraTransition>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CUserMsg_CameraTransition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CUserMsg_CameraTransition& from) {
+    CUserMsg_CameraTransition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CUserMsg_CameraTransition* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "CUserMsg_CameraTransition";
+  }
+  protected:
+  explicit CUserMsg_CameraTransition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef CUserMsg_CameraTransition_Transition_DataDriven Transition_DataDriven;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParamsDataDrivenFieldNumber = 3,
+    kCameraTypeFieldNumber = 1,
+    kDurationFieldNumber = 2,
+  };
+  // optional .CUserMsg_CameraTransition.Transition_DataDriven params_data_driven = 3;
+  bool has_params_data_driven() const;
+  private:
+  bool _internal_has_params_data_driven() const;
+  public:
+  void clear_params_data_driven();
+  const ::CUserMsg_CameraTransition_Transition_DataDriven& params_data_driven() const;
+  PROTOBUF_NODISCARD ::CUserMsg_CameraTransition_Transition_DataDriven* release_params_data_driven();
+  ::CUserMsg_CameraTransition_Transition_DataDriven* mutable_params_data_driven();
+  void set_allocated_params_data_driven(::CUserMsg_CameraTransition_Transition_DataDriven* params_data_driven);
+  private:
+  const ::CUserMsg_CameraTransition_Transition_DataDriven& _internal_params_data_driven() const;
+  ::CUserMsg_CameraTransition_Transition_DataDriven* _internal_mutable_params_data_driven();
+  public:
+  void unsafe_arena_set_allocated_params_data_driven(
+      ::CUserMsg_CameraTransition_Transition_DataDriven* params_data_driven);
+  ::CUserMsg_CameraTransition_Transition_DataDriven* unsafe_arena_release_params_data_driven();
+
+  // optional uint32 camera_type = 1;
+  bool has_camera_type() const;
+  private:
+  bool _internal_has_camera_type() const;
+  public:
+  void clear_camera_type();
+  uint32_t camera_type() const;
+  void set_camera_type(uint32_t value);
+  private:
+  uint32_t _internal_camera_type() const;
+  void _internal_set_camera_type(uint32_t value);
+  public:
+
+  // optional float duration = 2;
+  bool has_duration() const;
+  private:
+  bool _internal_has_duration() const;
+  public:
+  void clear_duration();
+  float duration() const;
+  void set_duration(float value);
+  private:
+  float _internal_duration() const;
+  void _internal_set_duration(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:CUserMsg_CameraTransition)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::CUserMsg_CameraTransition_Transition_DataDriven* params_data_driven_;
+    uint32_t camera_type_;
+    float duration_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_usermessages_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CUserMsg_AchievementEvent
+
+// optional uint32 achievement = 1;
+inline bool CUserMsg_AchievementEvent::_internal_has_achievement() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_AchievementEvent::has_achievement() const {
+  return _internal_has_achievement();
+}
+inline void CUserMsg_AchievementEvent::clear_achievement() {
+  _impl_.achievement_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CUserMsg_AchievementEvent::_internal_achievement() const {
+  return _impl_.achievement_;
+}
+inline uint32_t CUserMsg_AchievementEvent::achievement() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_AchievementEvent.achievement)
+  return _internal_achievement();
+}
+inline void CUserMsg_AchievementEvent::_internal_set_achievement(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.achievement_ = value;
+}
+inline void CUserMsg_AchievementEvent::set_achievement(uint32_t value) {
+  _internal_set_achievement(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_AchievementEvent.achievement)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_CloseCaption
+
+// optional fixed32 hash = 1;
+inline bool CUserMsg_CloseCaption::_internal_has_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_CloseCaption::has_hash() const {
+  return _internal_has_hash();
+}
+inline void CUserMsg_CloseCaption::clear_hash() {
+  _impl_.hash_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CUserMsg_CloseCaption::_internal_hash() const {
+  return _impl_.hash_;
+}
+inline uint32_t CUserMsg_CloseCaption::hash() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CloseCaption.hash)
+  return _internal_hash();
+}
+inline void CUserMsg_CloseCaption::_internal_set_hash(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.hash_ = value;
+}
+inline void CUserMsg_CloseCaption::set_hash(uint32_t value) {
+  _internal_set_hash(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_CloseCaption.hash)
+}
+
+// optional float duration = 2;
+inline bool CUserMsg_CloseCaption::_internal_has_duration() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_CloseCaption::has_duration() const {
+  return _internal_has_duration();
+}
+inline void CUserMsg_CloseCaption::clear_duration() {
+  _impl_.duration_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float CUserMsg_CloseCaption::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline float CUserMsg_CloseCaption::duration() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CloseCaption.duration)
+  return _internal_duration();
+}
+inline void CUserMsg_CloseCaption::_internal_set_duration(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.duration_ = value;
+}
+inline void CUserMsg_CloseCaption::set_duration(float value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_CloseCaption.duration)
+}
+
+// optional bool from_player = 3;
+inline bool CUserMsg_CloseCaption::_internal_has_from_player() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_CloseCaption::has_from_player() const {
+  return _internal_has_from_player();
+}
+inline void CUserMsg_CloseCaption::clear_from_player() {
+  _impl_.from_player_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CUserMsg_CloseCaption::_internal_from_player() const {
+  return _impl_.from_player_;
+}
+inline bool CUserMsg_CloseCaption::from_player() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CloseCaption.from_player)
+  return _internal_from_player();
+}
+inline void CUserMsg_CloseCaption::_internal_set_from_player(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.from_player_ = value;
+}
+inline void CUserMsg_CloseCaption::set_from_player(bool value) {
+  _internal_set_from_player(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_CloseCaption.from_player)
+}
+
+// optional int32 ent_index = 4;
+inline bool CUserMsg_CloseCaption::_internal_has_ent_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CUserMsg_CloseCaption::has_ent_index() const {
+  return _internal_has_ent_index();
+}
+inline void CUserMsg_CloseCaption::clear_ent_index() {
+  _impl_.ent_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t CUserMsg_CloseCaption::_internal_ent_index() const {
+  return _impl_.ent_index_;
+}
+inline int32_t CUserMsg_CloseCaption::ent_index() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CloseCaption.ent_index)
+  return _internal_ent_index();
+}
+inline void CUserMsg_CloseCaption::_internal_set_ent_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.ent_index_ = value;
+}
+inline void CUserMsg_CloseCaption::set_ent_index(int32_t value) {
+  _internal_set_ent_index(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_CloseCaption.ent_index)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_CurrentTimescale
+
+// optional float current = 1;
+inline bool CUserMsg_CurrentTimescale::_internal_has_current() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_CurrentTimescale::has_current() const {
+  return _internal_has_current();
+}
+inline void CUserMsg_CurrentTimescale::clear_current() {
+  _impl_.current_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float CUserMsg_CurrentTimescale::_internal_current() const {
+  return _impl_.current_;
+}
+inline float CUserMsg_CurrentTimescale::current() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CurrentTimescale.current)
+  return _internal_current();
+}
+inline void CUserMsg_CurrentTimescale::_internal_set_current(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.current_ = value;
+}
+inline void CUserMsg_CurrentTimescale::set_current(float value) {
+  _internal_set_current(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_CurrentTimescale.current)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_DesiredTimescale
+
+// optional float desired = 1;
+inline bool CUserMsg_DesiredTimescale::_internal_has_desired() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_DesiredTimescale::has_desired() const {
+  return _internal_has_desired();
+}
+inline void CUserMsg_DesiredTimescale::clear_desired() {
+  _impl_.desired_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float CUserMsg_DesiredTimescale::_internal_desired() const {
+  return _impl_.desired_;
+}
+inline float CUserMsg_DesiredTimescale::desired() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_DesiredTimescale.desired)
+  return _internal_desired();
+}
+inline void CUserMsg_DesiredTimescale::_internal_set_desired(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.desired_ = value;
+}
+inline void CUserMsg_DesiredTimescale::set_desired(float value) {
+  _internal_set_desired(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_DesiredTimescale.desired)
+}
+
+// optional float duration = 2;
+inline bool CUserMsg_DesiredTimescale::_internal_has_duration() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_DesiredTimescale::has_duration() const {
+  return _internal_has_duration();
+}
+inline void CUserMsg_DesiredTimescale::clear_duration() {
+  _impl_.duration_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float CUserMsg_DesiredTimescale::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline float CUserMsg_DesiredTimescale::duration() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_DesiredTimescale.duration)
+  return _internal_duration();
+}
+inline void CUserMsg_DesiredTimescale::_internal_set_duration(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.duration_ = value;
+}
+inline void CUserMsg_DesiredTimescale::set_duration(float value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_DesiredTimescale.duration)
+}
+
+// optional uint32 interpolator = 3;
+inline bool CUserMsg_DesiredTimescale::_internal_has_interpolator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_DesiredTimescale::has_interpolator() const {
+  return _internal_has_interpolator();
+}
+inline void CUserMsg_DesiredTimescale::clear_interpolator() {
+  _impl_.interpolator_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CUserMsg_DesiredTimescale::_internal_interpolator() const {
+  return _impl_.interpolator_;
+}
+inline uint32_t CUserMsg_DesiredTimescale::interpolator() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_DesiredTimescale.interpolator)
+  return _internal_interpolator();
+}
+inline void CUserMsg_DesiredTimescale::_internal_set_interpolator(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.interpolator_ = value;
+}
+inline void CUserMsg_DesiredTimescale::set_interpolator(uint32_t value) {
+  _internal_set_interpolator(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_DesiredTimescale.interpolator)
+}
+
+// optional float start_blend_time = 4;
+inline bool CUserMsg_DesiredTimescale::_internal_has_start_blend_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CUserMsg_DesiredTimescale::has_start_blend_time() const {
+  return _internal_has_start_blend_time();
+}
+inline void CUserMsg_DesiredTimescale::clear_start_blend_time() {
+  _impl_.start_blend_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float CUserMsg_DesiredTimescale::_internal_start_blend_time() const {
+  return _impl_.start_blend_time_;
+}
+inline float CUserMsg_DesiredTimescale::start_blend_time() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_DesiredTimescale.start_blend_time)
+  return _internal_start_blend_time();
+}
+inline void CUserMsg_DesiredTimescale::_internal_set_start_blend_time(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.start_blend_time_ = value;
+}
+inline void CUserMsg_DesiredTimescale::set_start_blend_time(float value) {
+  _internal_set_start_blend_time(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_DesiredTimescale.start_blend_time)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_Fade
+
+// optional uint32 duration = 1;
+inline bool CUserMsg_Fade::_internal_has_duration() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_Fade::has_duration() const {
+  return _internal_has_duration();
+}
+inline void CUserMsg_Fade::clear_duration() {
+  _impl_.duration_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CUserMsg_Fade::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline uint32_t CUserMsg_Fade::duration() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Fade.duration)
+  return _internal_duration();
+}
+inline void CUserMsg_Fade::_internal_set_duration(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.duration_ = value;
+}
+inline void CUserMsg_Fade::set_duration(uint32_t value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Fade.duration)
+}
+
+// optional uint32 hold_time = 2;
+inline bool CUserMsg_Fade::_internal_has_hold_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_Fade::has_hold_time() const {
+  return _internal_has_hold_time();
+}
+inline void CUserMsg_Fade::clear_hold_time() {
+  _impl_.hold_time_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CUserMsg_Fade::_internal_hold_time() const {
+  return _impl_.hold_time_;
+}
+inline uint32_t CUserMsg_Fade::hold_time() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Fade.hold_time)
+  return _internal_hold_time();
+}
+inline void CUserMsg_Fade::_internal_set_hold_time(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.hold_time_ = value;
+}
+inline void CUserMsg_Fade::set_hold_time(uint32_t value) {
+  _internal_set_hold_time(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Fade.hold_time)
+}
+
+// optional uint32 flags = 3;
+inline bool CUserMsg_Fade::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_Fade::has_flags() const {
+  return _internal_has_flags();
+}
+inline void CUserMsg_Fade::clear_flags() {
+  _impl_.flags_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CUserMsg_Fade::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline uint32_t CUserMsg_Fade::flags() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Fade.flags)
+  return _internal_flags();
+}
+inline void CUserMsg_Fade::_internal_set_flags(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.flags_ = value;
+}
+inline void CUserMsg_Fade::set_flags(uint32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Fade.flags)
+}
+
+// optional fixed32 color = 4;
+inline bool CUserMsg_Fade::_internal_has_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CUserMsg_Fade::has_color() const {
+  return _internal_has_color();
+}
+inline void CUserMsg_Fade::clear_color() {
+  _impl_.color_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CUserMsg_Fade::_internal_color() const {
+  return _impl_.color_;
+}
+inline uint32_t CUserMsg_Fade::color() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Fade.color)
+  return _internal_color();
+}
+inline void CUserMsg_Fade::_internal_set_color(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.color_ = value;
+}
+inline void CUserMsg_Fade::set_color(uint32_t value) {
+  _internal_set_color(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Fade.color)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_Shake
+
+// optional uint32 command = 1;
+inline bool CUserMsg_Shake::_internal_has_command() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_Shake::has_command() const {
+  return _internal_has_command();
+}
+inline void CUserMsg_Shake::clear_command() {
+  _impl_.command_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CUserMsg_Shake::_internal_command() const {
+  return _impl_.command_;
+}
+inline uint32_t CUserMsg_Shake::command() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Shake.command)
+  return _internal_command();
+}
+inline void CUserMsg_Shake::_internal_set_command(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.command_ = value;
+}
+inline void CUserMsg_Shake::set_command(uint32_t value) {
+  _internal_set_command(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Shake.command)
+}
+
+// optional float amplitude = 2;
+inline bool CUserMsg_Shake::_internal_has_amplitude() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_Shake::has_amplitude() const {
+  return _internal_has_amplitude();
+}
+inline void CUserMsg_Shake::clear_amplitude() {
+  _impl_.amplitude_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float CUserMsg_Shake::_internal_amplitude() const {
+  return _impl_.amplitude_;
+}
+inline float CUserMsg_Shake::amplitude() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Shake.amplitude)
+  return _internal_amplitude();
+}
+inline void CUserMsg_Shake::_internal_set_amplitude(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.amplitude_ = value;
+}
+inline void CUserMsg_Shake::set_amplitude(float value) {
+  _internal_set_amplitude(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Shake.amplitude)
+}
+
+// optional float frequency = 3;
+inline bool CUserMsg_Shake::_internal_has_frequency() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_Shake::has_frequency() const {
+  return _internal_has_frequency();
+}
+inline void CUserMsg_Shake::clear_frequency() {
+  _impl_.frequency_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CUserMsg_Shake::_internal_frequency() const {
+  return _impl_.frequency_;
+}
+inline float CUserMsg_Shake::frequency() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Shake.frequency)
+  return _internal_frequency();
+}
+inline void CUserMsg_Shake::_internal_set_frequency(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.frequency_ = value;
+}
+inline void CUserMsg_Shake::set_frequency(float value) {
+  _internal_set_frequency(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Shake.frequency)
+}
+
+// optional float duration = 4;
+inline bool CUserMsg_Shake::_internal_has_duration() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CUserMsg_Shake::has_duration() const {
+  return _internal_has_duration();
+}
+inline void CUserMsg_Shake::clear_duration() {
+  _impl_.duration_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float CUserMsg_Shake::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline float CUserMsg_Shake::duration() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Shake.duration)
+  return _internal_duration();
+}
+inline void CUserMsg_Shake::_internal_set_duration(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.duration_ = value;
+}
+inline void CUserMsg_Shake::set_duration(float value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Shake.duration)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_ShakeDir
+
+// optional .CUserMsg_Shake shake = 1;
+inline bool CUserMsg_ShakeDir::_internal_has_shake() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.shake_ != nullptr);
+  return value;
+}
+inline bool CUserMsg_ShakeDir::has_shake() const {
+  return _internal_has_shake();
+}
+inline void CUserMsg_ShakeDir::clear_shake() {
+  if (_impl_.shake_ != nullptr) _impl_.shake_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CUserMsg_Shake& CUserMsg_ShakeDir::_internal_shake() const {
+  const ::CUserMsg_Shake* p = _impl_.shake_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CUserMsg_Shake&>(
+      ::_CUserMsg_Shake_default_instance_);
+}
+inline const ::CUserMsg_Shake& CUserMsg_ShakeDir::shake() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_ShakeDir.shake)
+  return _internal_shake();
+}
+inline void CUserMsg_ShakeDir::unsafe_arena_set_allocated_shake(
+    ::CUserMsg_Shake* shake) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.shake_);
+  }
+  _impl_.shake_ = shake;
+  if (shake) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CUserMsg_ShakeDir.shake)
+}
+inline ::CUserMsg_Shake* CUserMsg_ShakeDir::release_shake() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CUserMsg_Shake* temp = _impl_.shake_;
+  _impl_.shake_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CUserMsg_Shake* CUserMsg_ShakeDir::unsafe_arena_release_shake() {
+  // @@protoc_insertion_point(field_release:CUserMsg_ShakeDir.shake)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CUserMsg_Shake* temp = _impl_.shake_;
+  _impl_.shake_ = nullptr;
+  return temp;
+}
+inline ::CUserMsg_Shake* CUserMsg_ShakeDir::_internal_mutable_shake() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.shake_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CUserMsg_Shake>(GetArenaForAllocation());
+    _impl_.shake_ = p;
+  }
+  return _impl_.shake_;
+}
+inline ::CUserMsg_Shake* CUserMsg_ShakeDir::mutable_shake() {
+  ::CUserMsg_Shake* _msg = _internal_mutable_shake();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_ShakeDir.shake)
+  return _msg;
+}
+inline void CUserMsg_ShakeDir::set_allocated_shake(::CUserMsg_Shake* shake) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.shake_;
+  }
+  if (shake) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(shake);
+    if (message_arena != submessage_arena) {
+      shake = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, shake, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.shake_ = shake;
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_ShakeDir.shake)
+}
+
+// optional .CMsgVector direction = 2;
+inline bool CUserMsg_ShakeDir::_internal_has_direction() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.direction_ != nullptr);
+  return value;
+}
+inline bool CUserMsg_ShakeDir::has_direction() const {
+  return _internal_has_direction();
+}
+inline const ::CMsgVector& CUserMsg_ShakeDir::_internal_direction() const {
+  const ::CMsgVector* p = _impl_.direction_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgVector&>(
+      ::_CMsgVector_default_instance_);
+}
+inline const ::CMsgVector& CUserMsg_ShakeDir::direction() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_ShakeDir.direction)
+  return _internal_direction();
+}
+inline void CUserMsg_ShakeDir::unsafe_arena_set_allocated_direction(
+    ::CMsgVector* direction) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.direction_);
+  }
+  _impl_.direction_ = direction;
+  if (direction) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CUserMsg_ShakeDir.direction)
+}
+inline ::CMsgVector* CUserMsg_ShakeDir::release_direction() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::CMsgVector* temp = _impl_.direction_;
+  _impl_.direction_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgVector* CUserMsg_ShakeDir::unsafe_arena_release_direction() {
+  // @@protoc_insertion_point(field_release:CUserMsg_ShakeDir.direction)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::CMsgVector* temp = _impl_.direction_;
+  _impl_.direction_ = nullptr;
+  return temp;
+}
+inline ::CMsgVector* CUserMsg_ShakeDir::_internal_mutable_direction() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.direction_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgVector>(GetArenaForAllocation());
+    _impl_.direction_ = p;
+  }
+  return _impl_.direction_;
+}
+inline ::CMsgVector* CUserMsg_ShakeDir::mutable_direction() {
+  ::CMsgVector* _msg = _internal_mutable_direction();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_ShakeDir.direction)
+  return _msg;
+}
+inline void CUserMsg_ShakeDir::set_allocated_direction(::CMsgVector* direction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.direction_);
+  }
+  if (direction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(direction));
+    if (message_arena != submessage_arena) {
+      direction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, direction, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.direction_ = direction;
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_ShakeDir.direction)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_Tilt
+
+// optional uint32 command = 1;
+inline bool CUserMsg_Tilt::_internal_has_command() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_Tilt::has_command() const {
+  return _internal_has_command();
+}
+inline void CUserMsg_Tilt::clear_command() {
+  _impl_.command_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CUserMsg_Tilt::_internal_command() const {
+  return _impl_.command_;
+}
+inline uint32_t CUserMsg_Tilt::command() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Tilt.command)
+  return _internal_command();
+}
+inline void CUserMsg_Tilt::_internal_set_command(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.command_ = value;
+}
+inline void CUserMsg_Tilt::set_command(uint32_t value) {
+  _internal_set_command(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Tilt.command)
+}
+
+// optional bool ease_in_out = 2;
+inline bool CUserMsg_Tilt::_internal_has_ease_in_out() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_Tilt::has_ease_in_out() const {
+  return _internal_has_ease_in_out();
+}
+inline void CUserMsg_Tilt::clear_ease_in_out() {
+  _impl_.ease_in_out_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CUserMsg_Tilt::_internal_ease_in_out() const {
+  return _impl_.ease_in_out_;
+}
+inline bool CUserMsg_Tilt::ease_in_out() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Tilt.ease_in_out)
+  return _internal_ease_in_out();
+}
+inline void CUserMsg_Tilt::_internal_set_ease_in_out(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.ease_in_out_ = value;
+}
+inline void CUserMsg_Tilt::set_ease_in_out(bool value) {
+  _internal_set_ease_in_out(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Tilt.ease_in_out)
+}
+
+// optional .CMsgVector angle = 3;
+inline bool CUserMsg_Tilt::_internal_has_angle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.angle_ != nullptr);
+  return value;
+}
+inline bool CUserMsg_Tilt::has_angle() const {
+  return _internal_has_angle();
+}
+inline const ::CMsgVector& CUserMsg_Tilt::_internal_angle() const {
+  const ::CMsgVector* p = _impl_.angle_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CMsgVector&>(
+      ::_CMsgVector_default_instance_);
+}
+inline const ::CMsgVector& CUserMsg_Tilt::angle() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Tilt.angle)
+  return _internal_angle();
+}
+inline void CUserMsg_Tilt::unsafe_arena_set_allocated_angle(
+    ::CMsgVector* angle) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.angle_);
+  }
+  _impl_.angle_ = angle;
+  if (angle) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CUserMsg_Tilt.angle)
+}
+inline ::CMsgVector* CUserMsg_Tilt::release_angle() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgVector* temp = _impl_.angle_;
+  _impl_.angle_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CMsgVector* CUserMsg_Tilt::unsafe_arena_release_angle() {
+  // @@protoc_insertion_point(field_release:CUserMsg_Tilt.angle)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CMsgVector* temp = _impl_.angle_;
+  _impl_.angle_ = nullptr;
+  return temp;
+}
+inline ::CMsgVector* CUserMsg_Tilt::_internal_mutable_angle() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.angle_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CMsgVector>(GetArenaForAllocation());
+    _impl_.angle_ = p;
+  }
+  return _impl_.angle_;
+}
+inline ::CMsgVector* CUserMsg_Tilt::mutable_angle() {
+  ::CMsgVector* _msg = _internal_mutable_angle();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_Tilt.angle)
+  return _msg;
+}
+inline void CUserMsg_Tilt::set_allocated_angle(::CMsgVector* angle) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.angle_);
+  }
+  if (angle) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(angle));
+    if (message_arena != submessage_arena) {
+      angle = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, angle, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.angle_ = angle;
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_Tilt.angle)
+}
+
+// optional float duration = 4;
+inline bool CUserMsg_Tilt::_internal_has_duration() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CUserMsg_Tilt::has_duration() const {
+  return _internal_has_duration();
+}
+inline void CUserMsg_Tilt::clear_duration() {
+  _impl_.duration_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float CUserMsg_Tilt::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline float CUserMsg_Tilt::duration() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Tilt.duration)
+  return _internal_duration();
+}
+inline void CUserMsg_Tilt::_internal_set_duration(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.duration_ = value;
+}
+inline void CUserMsg_Tilt::set_duration(float value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Tilt.duration)
+}
+
+// optional float time = 5;
+inline bool CUserMsg_Tilt::_internal_has_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CUserMsg_Tilt::has_time() const {
+  return _internal_has_time();
+}
+inline void CUserMsg_Tilt::clear_time() {
+  _impl_.time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline float CUserMsg_Tilt::_internal_time() const {
+  return _impl_.time_;
+}
+inline float CUserMsg_Tilt::time() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Tilt.time)
+  return _internal_time();
+}
+inline void CUserMsg_Tilt::_internal_set_time(float value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.time_ = value;
+}
+inline void CUserMsg_Tilt::set_time(float value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Tilt.time)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_SayText
+
+// optional uint32 client = 1;
+inline bool CUserMsg_SayText::_internal_has_client() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayText::has_client() const {
+  return _internal_has_client();
+}
+inline void CUserMsg_SayText::clear_client() {
+  _impl_.client_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CUserMsg_SayText::_internal_client() const {
+  return _impl_.client_;
+}
+inline uint32_t CUserMsg_SayText::client() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayText.client)
+  return _internal_client();
+}
+inline void CUserMsg_SayText::_internal_set_client(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.client_ = value;
+}
+inline void CUserMsg_SayText::set_client(uint32_t value) {
+  _internal_set_client(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_SayText.client)
+}
+
+// optional string text = 2;
+inline bool CUserMsg_SayText::_internal_has_text() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayText::has_text() const {
+  return _internal_has_text();
+}
+inline void CUserMsg_SayText::clear_text() {
+  _impl_.text_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_SayText::text() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayText.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_SayText::set_text(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_SayText.text)
+}
+inline std::string* CUserMsg_SayText::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_SayText.text)
+  return _s;
+}
+inline const std::string& CUserMsg_SayText::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void CUserMsg_SayText::_internal_set_text(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText::_internal_mutable_text() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText::release_text() {
+  // @@protoc_insertion_point(field_release:CUserMsg_SayText.text)
+  if (!_internal_has_text()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.text_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_SayText::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_SayText.text)
+}
+
+// optional bool chat = 3;
+inline bool CUserMsg_SayText::_internal_has_chat() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayText::has_chat() const {
+  return _internal_has_chat();
+}
+inline void CUserMsg_SayText::clear_chat() {
+  _impl_.chat_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CUserMsg_SayText::_internal_chat() const {
+  return _impl_.chat_;
+}
+inline bool CUserMsg_SayText::chat() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayText.chat)
+  return _internal_chat();
+}
+inline void CUserMsg_SayText::_internal_set_chat(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.chat_ = value;
+}
+inline void CUserMsg_SayText::set_chat(bool value) {
+  _internal_set_chat(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_SayText.chat)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_SayText2
+
+// optional uint32 client = 1;
+inline bool CUserMsg_SayText2::_internal_has_client() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayText2::has_client() const {
+  return _internal_has_client();
+}
+inline void CUserMsg_SayText2::clear_client() {
+  _impl_.client_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t CUserMsg_SayText2::_internal_client() const {
+  return _impl_.client_;
+}
+inline uint32_t CUserMsg_SayText2::client() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayText2.client)
+  return _internal_client();
+}
+inline void CUserMsg_SayText2::_internal_set_client(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.client_ = value;
+}
+inline void CUserMsg_SayText2::set_client(uint32_t value) {
+  _internal_set_client(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_SayText2.client)
+}
+
+// optional bool chat = 2;
+inline bool CUserMsg_SayText2::_internal_has_chat() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayText2::has_chat() const {
+  return _internal_has_chat();
+}
+inline void CUserMsg_SayText2::clear_chat() {
+  _impl_.chat_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool CUserMsg_SayText2::_internal_chat() const {
+  return _impl_.chat_;
+}
+inline bool CUserMsg_SayText2::chat() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayText2.chat)
+  return _internal_chat();
+}
+inline void CUserMsg_SayText2::_internal_set_chat(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.chat_ = value;
+}
+inline void CUserMsg_SayText2::set_chat(bool value) {
+  _internal_set_chat(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_SayText2.chat)
+}
+
+// optional string format = 3;
+inline bool CUserMsg_SayText2::_internal_has_format() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayText2::has_format() const {
+  return _internal_has_format();
+}
+inline void CUserMsg_SayText2::clear_format() {
+  _impl_.format_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_SayText2::format() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayText2.format)
+  return _internal_format();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_SayText2::set_format(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.format_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_SayText2.format)
+}
+inline std::string* CUserMsg_SayText2::mutable_format() {
+  std::string* _s = _internal_mutable_format();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_SayText2.format)
+  return _s;
+}
+inline const std::string& CUserMsg_SayText2::_internal_format() const {
+  return _impl_.format_.Get();
+}
+inline void CUserMsg_SayText2::_internal_set_format(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.format_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText2::_internal_mutable_format() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.format_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText2::release_format() {
+  // @@protoc_insertion_point(field_release:CUserMsg_SayText2.format)
+  if (!_internal_has_format()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.format_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.format_.IsDefault()) {
+    _impl_.format_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_SayText2::set_allocated_format(std::string* format) {
+  if (format != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.format_.SetAllocated(format, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.format_.IsDefault()) {
+    _impl_.format_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_SayText2.format)
+}
+
+// optional string prefix = 4;
+inline bool CUserMsg_SayText2::_internal_has_prefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayText2::has_prefix() const {
+  return _internal_has_prefix();
+}
+inline void CUserMsg_SayText2::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CUserMsg_SayText2::prefix() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayText2.prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_SayText2::set_prefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_SayText2.prefix)
+}
+inline std::string* CUserMsg_SayText2::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_SayText2.prefix)
+  return _s;
+}
+inline const std::string& CUserMsg_SayText2::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void CUserMsg_SayText2::_internal_set_prefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText2::_internal_mutable_prefix() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText2::release_prefix() {
+  // @@protoc_insertion_point(field_release:CUserMsg_SayText2.prefix)
+  if (!_internal_has_prefix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.prefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_SayText2::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_SayText2.prefix)
+}
+
+// optional string text = 5;
+inline bool CUserMsg_SayText2::_internal_has_text() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayText2::has_text() const {
+  return _internal_has_text();
+}
+inline void CUserMsg_SayText2::clear_text() {
+  _impl_.text_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CUserMsg_SayText2::text() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayText2.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_SayText2::set_text(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_SayText2.text)
+}
+inline std::string* CUserMsg_SayText2::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_SayText2.text)
+  return _s;
+}
+inline const std::string& CUserMsg_SayText2::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void CUserMsg_SayText2::_internal_set_text(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText2::_internal_mutable_text() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText2::release_text() {
+  // @@protoc_insertion_point(field_release:CUserMsg_SayText2.text)
+  if (!_internal_has_text()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.text_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_SayText2::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_SayText2.text)
+}
+
+// optional string location = 6;
+inline bool CUserMsg_SayText2::_internal_has_location() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayText2::has_location() const {
+  return _internal_has_location();
+}
+inline void CUserMsg_SayText2::clear_location() {
+  _impl_.location_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& CUserMsg_SayText2::location() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayText2.location)
+  return _internal_location();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_SayText2::set_location(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.location_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_SayText2.location)
+}
+inline std::string* CUserMsg_SayText2::mutable_location() {
+  std::string* _s = _internal_mutable_location();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_SayText2.location)
+  return _s;
+}
+inline const std::string& CUserMsg_SayText2::_internal_location() const {
+  return _impl_.location_.Get();
+}
+inline void CUserMsg_SayText2::_internal_set_location(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.location_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText2::_internal_mutable_location() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.location_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayText2::release_location() {
+  // @@protoc_insertion_point(field_release:CUserMsg_SayText2.location)
+  if (!_internal_has_location()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.location_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.location_.IsDefault()) {
+    _impl_.location_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_SayText2::set_allocated_location(std::string* location) {
+  if (location != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.location_.SetAllocated(location, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.location_.IsDefault()) {
+    _impl_.location_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_SayText2.location)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_HudMsg
+
+// optional uint32 channel = 1;
+inline bool CUserMsg_HudMsg::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_channel() const {
+  return _internal_has_channel();
+}
+inline void CUserMsg_HudMsg::clear_channel() {
+  _impl_.channel_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CUserMsg_HudMsg::_internal_channel() const {
+  return _impl_.channel_;
+}
+inline uint32_t CUserMsg_HudMsg::channel() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.channel)
+  return _internal_channel();
+}
+inline void CUserMsg_HudMsg::_internal_set_channel(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.channel_ = value;
+}
+inline void CUserMsg_HudMsg::set_channel(uint32_t value) {
+  _internal_set_channel(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.channel)
+}
+
+// optional float x = 2;
+inline bool CUserMsg_HudMsg::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_x() const {
+  return _internal_has_x();
+}
+inline void CUserMsg_HudMsg::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CUserMsg_HudMsg::_internal_x() const {
+  return _impl_.x_;
+}
+inline float CUserMsg_HudMsg::x() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.x)
+  return _internal_x();
+}
+inline void CUserMsg_HudMsg::_internal_set_x(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.x_ = value;
+}
+inline void CUserMsg_HudMsg::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.x)
+}
+
+// optional float y = 3;
+inline bool CUserMsg_HudMsg::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_y() const {
+  return _internal_has_y();
+}
+inline void CUserMsg_HudMsg::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float CUserMsg_HudMsg::_internal_y() const {
+  return _impl_.y_;
+}
+inline float CUserMsg_HudMsg::y() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.y)
+  return _internal_y();
+}
+inline void CUserMsg_HudMsg::_internal_set_y(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.y_ = value;
+}
+inline void CUserMsg_HudMsg::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.y)
+}
+
+// optional uint32 color1 = 4;
+inline bool CUserMsg_HudMsg::_internal_has_color1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_color1() const {
+  return _internal_has_color1();
+}
+inline void CUserMsg_HudMsg::clear_color1() {
+  _impl_.color1_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t CUserMsg_HudMsg::_internal_color1() const {
+  return _impl_.color1_;
+}
+inline uint32_t CUserMsg_HudMsg::color1() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.color1)
+  return _internal_color1();
+}
+inline void CUserMsg_HudMsg::_internal_set_color1(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.color1_ = value;
+}
+inline void CUserMsg_HudMsg::set_color1(uint32_t value) {
+  _internal_set_color1(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.color1)
+}
+
+// optional uint32 color2 = 5;
+inline bool CUserMsg_HudMsg::_internal_has_color2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_color2() const {
+  return _internal_has_color2();
+}
+inline void CUserMsg_HudMsg::clear_color2() {
+  _impl_.color2_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t CUserMsg_HudMsg::_internal_color2() const {
+  return _impl_.color2_;
+}
+inline uint32_t CUserMsg_HudMsg::color2() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.color2)
+  return _internal_color2();
+}
+inline void CUserMsg_HudMsg::_internal_set_color2(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.color2_ = value;
+}
+inline void CUserMsg_HudMsg::set_color2(uint32_t value) {
+  _internal_set_color2(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.color2)
+}
+
+// optional uint32 effect = 6;
+inline bool CUserMsg_HudMsg::_internal_has_effect() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_effect() const {
+  return _internal_has_effect();
+}
+inline void CUserMsg_HudMsg::clear_effect() {
+  _impl_.effect_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t CUserMsg_HudMsg::_internal_effect() const {
+  return _impl_.effect_;
+}
+inline uint32_t CUserMsg_HudMsg::effect() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.effect)
+  return _internal_effect();
+}
+inline void CUserMsg_HudMsg::_internal_set_effect(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.effect_ = value;
+}
+inline void CUserMsg_HudMsg::set_effect(uint32_t value) {
+  _internal_set_effect(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.effect)
+}
+
+// optional float fade_in_time = 7;
+inline bool CUserMsg_HudMsg::_internal_has_fade_in_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_fade_in_time() const {
+  return _internal_has_fade_in_time();
+}
+inline void CUserMsg_HudMsg::clear_fade_in_time() {
+  _impl_.fade_in_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline float CUserMsg_HudMsg::_internal_fade_in_time() const {
+  return _impl_.fade_in_time_;
+}
+inline float CUserMsg_HudMsg::fade_in_time() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.fade_in_time)
+  return _internal_fade_in_time();
+}
+inline void CUserMsg_HudMsg::_internal_set_fade_in_time(float value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.fade_in_time_ = value;
+}
+inline void CUserMsg_HudMsg::set_fade_in_time(float value) {
+  _internal_set_fade_in_time(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.fade_in_time)
+}
+
+// optional float fade_out_time = 8;
+inline bool CUserMsg_HudMsg::_internal_has_fade_out_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_fade_out_time() const {
+  return _internal_has_fade_out_time();
+}
+inline void CUserMsg_HudMsg::clear_fade_out_time() {
+  _impl_.fade_out_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline float CUserMsg_HudMsg::_internal_fade_out_time() const {
+  return _impl_.fade_out_time_;
+}
+inline float CUserMsg_HudMsg::fade_out_time() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.fade_out_time)
+  return _internal_fade_out_time();
+}
+inline void CUserMsg_HudMsg::_internal_set_fade_out_time(float value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.fade_out_time_ = value;
+}
+inline void CUserMsg_HudMsg::set_fade_out_time(float value) {
+  _internal_set_fade_out_time(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.fade_out_time)
+}
+
+// optional float hold_time = 9;
+inline bool CUserMsg_HudMsg::_internal_has_hold_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_hold_time() const {
+  return _internal_has_hold_time();
+}
+inline void CUserMsg_HudMsg::clear_hold_time() {
+  _impl_.hold_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline float CUserMsg_HudMsg::_internal_hold_time() const {
+  return _impl_.hold_time_;
+}
+inline float CUserMsg_HudMsg::hold_time() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.hold_time)
+  return _internal_hold_time();
+}
+inline void CUserMsg_HudMsg::_internal_set_hold_time(float value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.hold_time_ = value;
+}
+inline void CUserMsg_HudMsg::set_hold_time(float value) {
+  _internal_set_hold_time(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.hold_time)
+}
+
+// optional float fx_time = 10;
+inline bool CUserMsg_HudMsg::_internal_has_fx_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_fx_time() const {
+  return _internal_has_fx_time();
+}
+inline void CUserMsg_HudMsg::clear_fx_time() {
+  _impl_.fx_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline float CUserMsg_HudMsg::_internal_fx_time() const {
+  return _impl_.fx_time_;
+}
+inline float CUserMsg_HudMsg::fx_time() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.fx_time)
+  return _internal_fx_time();
+}
+inline void CUserMsg_HudMsg::_internal_set_fx_time(float value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.fx_time_ = value;
+}
+inline void CUserMsg_HudMsg::set_fx_time(float value) {
+  _internal_set_fx_time(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.fx_time)
+}
+
+// optional string message = 11;
+inline bool CUserMsg_HudMsg::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudMsg::has_message() const {
+  return _internal_has_message();
+}
+inline void CUserMsg_HudMsg::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_HudMsg::message() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudMsg.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_HudMsg::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_HudMsg.message)
+}
+inline std::string* CUserMsg_HudMsg::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_HudMsg.message)
+  return _s;
+}
+inline const std::string& CUserMsg_HudMsg::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void CUserMsg_HudMsg::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_HudMsg::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_HudMsg::release_message() {
+  // @@protoc_insertion_point(field_release:CUserMsg_HudMsg.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_HudMsg::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_HudMsg.message)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_HudText
+
+// optional string message = 1;
+inline bool CUserMsg_HudText::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_HudText::has_message() const {
+  return _internal_has_message();
+}
+inline void CUserMsg_HudText::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_HudText::message() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HudText.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_HudText::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_HudText.message)
+}
+inline std::string* CUserMsg_HudText::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_HudText.message)
+  return _s;
+}
+inline const std::string& CUserMsg_HudText::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void CUserMsg_HudText::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_HudText::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_HudText::release_message() {
+  // @@protoc_insertion_point(field_release:CUserMsg_HudText.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_HudText::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_HudText.message)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_TextMsg
+
+// optional uint32 dest = 1;
+inline bool CUserMsg_TextMsg::_internal_has_dest() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_TextMsg::has_dest() const {
+  return _internal_has_dest();
+}
+inline void CUserMsg_TextMsg::clear_dest() {
+  _impl_.dest_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CUserMsg_TextMsg::_internal_dest() const {
+  return _impl_.dest_;
+}
+inline uint32_t CUserMsg_TextMsg::dest() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_TextMsg.dest)
+  return _internal_dest();
+}
+inline void CUserMsg_TextMsg::_internal_set_dest(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.dest_ = value;
+}
+inline void CUserMsg_TextMsg::set_dest(uint32_t value) {
+  _internal_set_dest(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_TextMsg.dest)
+}
+
+// repeated string param = 2;
+inline int CUserMsg_TextMsg::_internal_param_size() const {
+  return _impl_.param_.size();
+}
+inline int CUserMsg_TextMsg::param_size() const {
+  return _internal_param_size();
+}
+inline void CUserMsg_TextMsg::clear_param() {
+  _impl_.param_.Clear();
+}
+inline std::string* CUserMsg_TextMsg::add_param() {
+  std::string* _s = _internal_add_param();
+  // @@protoc_insertion_point(field_add_mutable:CUserMsg_TextMsg.param)
+  return _s;
+}
+inline const std::string& CUserMsg_TextMsg::_internal_param(int index) const {
+  return _impl_.param_.Get(index);
+}
+inline const std::string& CUserMsg_TextMsg::param(int index) const {
+  // @@protoc_insertion_point(field_get:CUserMsg_TextMsg.param)
+  return _internal_param(index);
+}
+inline std::string* CUserMsg_TextMsg::mutable_param(int index) {
+  // @@protoc_insertion_point(field_mutable:CUserMsg_TextMsg.param)
+  return _impl_.param_.Mutable(index);
+}
+inline void CUserMsg_TextMsg::set_param(int index, const std::string& value) {
+  _impl_.param_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_TextMsg.param)
+}
+inline void CUserMsg_TextMsg::set_param(int index, std::string&& value) {
+  _impl_.param_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:CUserMsg_TextMsg.param)
+}
+inline void CUserMsg_TextMsg::set_param(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.param_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:CUserMsg_TextMsg.param)
+}
+inline void CUserMsg_TextMsg::set_param(int index, const char* value, size_t size) {
+  _impl_.param_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:CUserMsg_TextMsg.param)
+}
+inline std::string* CUserMsg_TextMsg::_internal_add_param() {
+  return _impl_.param_.Add();
+}
+inline void CUserMsg_TextMsg::add_param(const std::string& value) {
+  _impl_.param_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:CUserMsg_TextMsg.param)
+}
+inline void CUserMsg_TextMsg::add_param(std::string&& value) {
+  _impl_.param_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:CUserMsg_TextMsg.param)
+}
+inline void CUserMsg_TextMsg::add_param(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.param_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:CUserMsg_TextMsg.param)
+}
+inline void CUserMsg_TextMsg::add_param(const char* value, size_t size) {
+  _impl_.param_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:CUserMsg_TextMsg.param)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CUserMsg_TextMsg::param() const {
+  // @@protoc_insertion_point(field_list:CUserMsg_TextMsg.param)
+  return _impl_.param_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CUserMsg_TextMsg::mutable_param() {
+  // @@protoc_insertion_point(field_mutable_list:CUserMsg_TextMsg.param)
+  return &_impl_.param_;
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_GameTitle
+
+// -------------------------------------------------------------------
+
+// CUserMsg_ResetHUD
+
+// -------------------------------------------------------------------
+
+// CUserMsg_SendAudio
+
+// optional bool stop = 2;
+inline bool CUserMsg_SendAudio::_internal_has_stop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_SendAudio::has_stop() const {
+  return _internal_has_stop();
+}
+inline void CUserMsg_SendAudio::clear_stop() {
+  _impl_.stop_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool CUserMsg_SendAudio::_internal_stop() const {
+  return _impl_.stop_;
+}
+inline bool CUserMsg_SendAudio::stop() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SendAudio.stop)
+  return _internal_stop();
+}
+inline void CUserMsg_SendAudio::_internal_set_stop(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.stop_ = value;
+}
+inline void CUserMsg_SendAudio::set_stop(bool value) {
+  _internal_set_stop(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_SendAudio.stop)
+}
+
+// optional string name = 3;
+inline bool CUserMsg_SendAudio::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_SendAudio::has_name() const {
+  return _internal_has_name();
+}
+inline void CUserMsg_SendAudio::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_SendAudio::name() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SendAudio.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_SendAudio::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_SendAudio.name)
+}
+inline std::string* CUserMsg_SendAudio::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_SendAudio.name)
+  return _s;
+}
+inline const std::string& CUserMsg_SendAudio::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CUserMsg_SendAudio::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SendAudio::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SendAudio::release_name() {
+  // @@protoc_insertion_point(field_release:CUserMsg_SendAudio.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_SendAudio::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_SendAudio.name)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_VoiceMask
+
+// repeated int32 audible_players_mask = 1;
+inline int CUserMsg_VoiceMask::_internal_audible_players_mask_size() const {
+  return _impl_.audible_players_mask_.size();
+}
+inline int CUserMsg_VoiceMask::audible_players_mask_size() const {
+  return _internal_audible_players_mask_size();
+}
+inline void CUserMsg_VoiceMask::clear_audible_players_mask() {
+  _impl_.audible_players_mask_.Clear();
+}
+inline int32_t CUserMsg_VoiceMask::_internal_audible_players_mask(int index) const {
+  return _impl_.audible_players_mask_.Get(index);
+}
+inline int32_t CUserMsg_VoiceMask::audible_players_mask(int index) const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VoiceMask.audible_players_mask)
+  return _internal_audible_players_mask(index);
+}
+inline void CUserMsg_VoiceMask::set_audible_players_mask(int index, int32_t value) {
+  _impl_.audible_players_mask_.Set(index, value);
+  // @@protoc_insertion_point(field_set:CUserMsg_VoiceMask.audible_players_mask)
+}
+inline void CUserMsg_VoiceMask::_internal_add_audible_players_mask(int32_t value) {
+  _impl_.audible_players_mask_.Add(value);
+}
+inline void CUserMsg_VoiceMask::add_audible_players_mask(int32_t value) {
+  _internal_add_audible_players_mask(value);
+  // @@protoc_insertion_point(field_add:CUserMsg_VoiceMask.audible_players_mask)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CUserMsg_VoiceMask::_internal_audible_players_mask() const {
+  return _impl_.audible_players_mask_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CUserMsg_VoiceMask::audible_players_mask() const {
+  // @@protoc_insertion_point(field_list:CUserMsg_VoiceMask.audible_players_mask)
+  return _internal_audible_players_mask();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CUserMsg_VoiceMask::_internal_mutable_audible_players_mask() {
+  return &_impl_.audible_players_mask_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CUserMsg_VoiceMask::mutable_audible_players_mask() {
+  // @@protoc_insertion_point(field_mutable_list:CUserMsg_VoiceMask.audible_players_mask)
+  return _internal_mutable_audible_players_mask();
+}
+
+// optional bool player_mod_enabled = 2;
+inline bool CUserMsg_VoiceMask::_internal_has_player_mod_enabled() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_VoiceMask::has_player_mod_enabled() const {
+  return _internal_has_player_mod_enabled();
+}
+inline void CUserMsg_VoiceMask::clear_player_mod_enabled() {
+  _impl_.player_mod_enabled_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool CUserMsg_VoiceMask::_internal_player_mod_enabled() const {
+  return _impl_.player_mod_enabled_;
+}
+inline bool CUserMsg_VoiceMask::player_mod_enabled() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VoiceMask.player_mod_enabled)
+  return _internal_player_mod_enabled();
+}
+inline void CUserMsg_VoiceMask::_internal_set_player_mod_enabled(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.player_mod_enabled_ = value;
+}
+inline void CUserMsg_VoiceMask::set_player_mod_enabled(bool value) {
+  _internal_set_player_mod_enabled(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_VoiceMask.player_mod_enabled)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_RequestState
+
+// -------------------------------------------------------------------
+
+// CUserMsg_HintText
+
+// optional string message = 1;
+inline bool CUserMsg_HintText::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_HintText::has_message() const {
+  return _internal_has_message();
+}
+inline void CUserMsg_HintText::clear_message() {
+  _impl_.message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_HintText::message() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_HintText.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_HintText::set_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_HintText.message)
+}
+inline std::string* CUserMsg_HintText::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_HintText.message)
+  return _s;
+}
+inline const std::string& CUserMsg_HintText::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void CUserMsg_HintText::_internal_set_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_HintText::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_HintText::release_message() {
+  // @@protoc_insertion_point(field_release:CUserMsg_HintText.message)
+  if (!_internal_has_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_HintText::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_HintText.message)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_KeyHintText
+
+// repeated string messages = 1;
+inline int CUserMsg_KeyHintText::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int CUserMsg_KeyHintText::messages_size() const {
+  return _internal_messages_size();
+}
+inline void CUserMsg_KeyHintText::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline std::string* CUserMsg_KeyHintText::add_messages() {
+  std::string* _s = _internal_add_messages();
+  // @@protoc_insertion_point(field_add_mutable:CUserMsg_KeyHintText.messages)
+  return _s;
+}
+inline const std::string& CUserMsg_KeyHintText::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const std::string& CUserMsg_KeyHintText::messages(int index) const {
+  // @@protoc_insertion_point(field_get:CUserMsg_KeyHintText.messages)
+  return _internal_messages(index);
+}
+inline std::string* CUserMsg_KeyHintText::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:CUserMsg_KeyHintText.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline void CUserMsg_KeyHintText::set_messages(int index, const std::string& value) {
+  _impl_.messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_KeyHintText.messages)
+}
+inline void CUserMsg_KeyHintText::set_messages(int index, std::string&& value) {
+  _impl_.messages_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:CUserMsg_KeyHintText.messages)
+}
+inline void CUserMsg_KeyHintText::set_messages(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:CUserMsg_KeyHintText.messages)
+}
+inline void CUserMsg_KeyHintText::set_messages(int index, const char* value, size_t size) {
+  _impl_.messages_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:CUserMsg_KeyHintText.messages)
+}
+inline std::string* CUserMsg_KeyHintText::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline void CUserMsg_KeyHintText::add_messages(const std::string& value) {
+  _impl_.messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:CUserMsg_KeyHintText.messages)
+}
+inline void CUserMsg_KeyHintText::add_messages(std::string&& value) {
+  _impl_.messages_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:CUserMsg_KeyHintText.messages)
+}
+inline void CUserMsg_KeyHintText::add_messages(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:CUserMsg_KeyHintText.messages)
+}
+inline void CUserMsg_KeyHintText::add_messages(const char* value, size_t size) {
+  _impl_.messages_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:CUserMsg_KeyHintText.messages)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CUserMsg_KeyHintText::messages() const {
+  // @@protoc_insertion_point(field_list:CUserMsg_KeyHintText.messages)
+  return _impl_.messages_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CUserMsg_KeyHintText::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:CUserMsg_KeyHintText.messages)
+  return &_impl_.messages_;
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_StatsCrawlMsg
+
+// -------------------------------------------------------------------
+
+// CUserMsg_StatsSkipState
+
+// optional int32 num_skips = 1;
+inline bool CUserMsg_StatsSkipState::_internal_has_num_skips() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_StatsSkipState::has_num_skips() const {
+  return _internal_has_num_skips();
+}
+inline void CUserMsg_StatsSkipState::clear_num_skips() {
+  _impl_.num_skips_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CUserMsg_StatsSkipState::_internal_num_skips() const {
+  return _impl_.num_skips_;
+}
+inline int32_t CUserMsg_StatsSkipState::num_skips() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_StatsSkipState.num_skips)
+  return _internal_num_skips();
+}
+inline void CUserMsg_StatsSkipState::_internal_set_num_skips(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.num_skips_ = value;
+}
+inline void CUserMsg_StatsSkipState::set_num_skips(int32_t value) {
+  _internal_set_num_skips(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_StatsSkipState.num_skips)
+}
+
+// optional int32 num_players = 2;
+inline bool CUserMsg_StatsSkipState::_internal_has_num_players() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_StatsSkipState::has_num_players() const {
+  return _internal_has_num_players();
+}
+inline void CUserMsg_StatsSkipState::clear_num_players() {
+  _impl_.num_players_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CUserMsg_StatsSkipState::_internal_num_players() const {
+  return _impl_.num_players_;
+}
+inline int32_t CUserMsg_StatsSkipState::num_players() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_StatsSkipState.num_players)
+  return _internal_num_players();
+}
+inline void CUserMsg_StatsSkipState::_internal_set_num_players(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_players_ = value;
+}
+inline void CUserMsg_StatsSkipState::set_num_players(int32_t value) {
+  _internal_set_num_players(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_StatsSkipState.num_players)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_VoiceSubtitle
+
+// optional int32 ent_index = 1;
+inline bool CUserMsg_VoiceSubtitle::_internal_has_ent_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_VoiceSubtitle::has_ent_index() const {
+  return _internal_has_ent_index();
+}
+inline void CUserMsg_VoiceSubtitle::clear_ent_index() {
+  _impl_.ent_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CUserMsg_VoiceSubtitle::_internal_ent_index() const {
+  return _impl_.ent_index_;
+}
+inline int32_t CUserMsg_VoiceSubtitle::ent_index() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VoiceSubtitle.ent_index)
+  return _internal_ent_index();
+}
+inline void CUserMsg_VoiceSubtitle::_internal_set_ent_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ent_index_ = value;
+}
+inline void CUserMsg_VoiceSubtitle::set_ent_index(int32_t value) {
+  _internal_set_ent_index(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_VoiceSubtitle.ent_index)
+}
+
+// optional int32 menu = 2;
+inline bool CUserMsg_VoiceSubtitle::_internal_has_menu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_VoiceSubtitle::has_menu() const {
+  return _internal_has_menu();
+}
+inline void CUserMsg_VoiceSubtitle::clear_menu() {
+  _impl_.menu_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CUserMsg_VoiceSubtitle::_internal_menu() const {
+  return _impl_.menu_;
+}
+inline int32_t CUserMsg_VoiceSubtitle::menu() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VoiceSubtitle.menu)
+  return _internal_menu();
+}
+inline void CUserMsg_VoiceSubtitle::_internal_set_menu(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.menu_ = value;
+}
+inline void CUserMsg_VoiceSubtitle::set_menu(int32_t value) {
+  _internal_set_menu(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_VoiceSubtitle.menu)
+}
+
+// optional int32 item = 3;
+inline bool CUserMsg_VoiceSubtitle::_internal_has_item() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_VoiceSubtitle::has_item() const {
+  return _internal_has_item();
+}
+inline void CUserMsg_VoiceSubtitle::clear_item() {
+  _impl_.item_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CUserMsg_VoiceSubtitle::_internal_item() const {
+  return _impl_.item_;
+}
+inline int32_t CUserMsg_VoiceSubtitle::item() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VoiceSubtitle.item)
+  return _internal_item();
+}
+inline void CUserMsg_VoiceSubtitle::_internal_set_item(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.item_ = value;
+}
+inline void CUserMsg_VoiceSubtitle::set_item(int32_t value) {
+  _internal_set_item(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_VoiceSubtitle.item)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_VGUIMenu_Keys
+
+// optional string name = 1;
+inline bool CUserMsg_VGUIMenu_Keys::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_VGUIMenu_Keys::has_name() const {
+  return _internal_has_name();
+}
+inline void CUserMsg_VGUIMenu_Keys::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_VGUIMenu_Keys::name() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VGUIMenu.Keys.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_VGUIMenu_Keys::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_VGUIMenu.Keys.name)
+}
+inline std::string* CUserMsg_VGUIMenu_Keys::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_VGUIMenu.Keys.name)
+  return _s;
+}
+inline const std::string& CUserMsg_VGUIMenu_Keys::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CUserMsg_VGUIMenu_Keys::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_VGUIMenu_Keys::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_VGUIMenu_Keys::release_name() {
+  // @@protoc_insertion_point(field_release:CUserMsg_VGUIMenu.Keys.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_VGUIMenu_Keys::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_VGUIMenu.Keys.name)
+}
+
+// optional string value = 2;
+inline bool CUserMsg_VGUIMenu_Keys::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_VGUIMenu_Keys::has_value() const {
+  return _internal_has_value();
+}
+inline void CUserMsg_VGUIMenu_Keys::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CUserMsg_VGUIMenu_Keys::value() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VGUIMenu.Keys.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_VGUIMenu_Keys::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_VGUIMenu.Keys.value)
+}
+inline std::string* CUserMsg_VGUIMenu_Keys::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_VGUIMenu.Keys.value)
+  return _s;
+}
+inline const std::string& CUserMsg_VGUIMenu_Keys::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CUserMsg_VGUIMenu_Keys::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_VGUIMenu_Keys::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_VGUIMenu_Keys::release_value() {
+  // @@protoc_insertion_point(field_release:CUserMsg_VGUIMenu.Keys.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_VGUIMenu_Keys::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_VGUIMenu.Keys.value)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_VGUIMenu
+
+// optional string name = 1;
+inline bool CUserMsg_VGUIMenu::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_VGUIMenu::has_name() const {
+  return _internal_has_name();
+}
+inline void CUserMsg_VGUIMenu::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_VGUIMenu::name() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VGUIMenu.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_VGUIMenu::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_VGUIMenu.name)
+}
+inline std::string* CUserMsg_VGUIMenu::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_VGUIMenu.name)
+  return _s;
+}
+inline const std::string& CUserMsg_VGUIMenu::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CUserMsg_VGUIMenu::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_VGUIMenu::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_VGUIMenu::release_name() {
+  // @@protoc_insertion_point(field_release:CUserMsg_VGUIMenu.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_VGUIMenu::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_VGUIMenu.name)
+}
+
+// optional bool show = 2;
+inline bool CUserMsg_VGUIMenu::_internal_has_show() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_VGUIMenu::has_show() const {
+  return _internal_has_show();
+}
+inline void CUserMsg_VGUIMenu::clear_show() {
+  _impl_.show_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool CUserMsg_VGUIMenu::_internal_show() const {
+  return _impl_.show_;
+}
+inline bool CUserMsg_VGUIMenu::show() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VGUIMenu.show)
+  return _internal_show();
+}
+inline void CUserMsg_VGUIMenu::_internal_set_show(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.show_ = value;
+}
+inline void CUserMsg_VGUIMenu::set_show(bool value) {
+  _internal_set_show(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_VGUIMenu.show)
+}
+
+// repeated .CUserMsg_VGUIMenu.Keys keys = 3;
+inline int CUserMsg_VGUIMenu::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int CUserMsg_VGUIMenu::keys_size() const {
+  return _internal_keys_size();
+}
+inline void CUserMsg_VGUIMenu::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline ::CUserMsg_VGUIMenu_Keys* CUserMsg_VGUIMenu::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:CUserMsg_VGUIMenu.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CUserMsg_VGUIMenu_Keys >*
+CUserMsg_VGUIMenu::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:CUserMsg_VGUIMenu.keys)
+  return &_impl_.keys_;
+}
+inline const ::CUserMsg_VGUIMenu_Keys& CUserMsg_VGUIMenu::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const ::CUserMsg_VGUIMenu_Keys& CUserMsg_VGUIMenu::keys(int index) const {
+  // @@protoc_insertion_point(field_get:CUserMsg_VGUIMenu.keys)
+  return _internal_keys(index);
+}
+inline ::CUserMsg_VGUIMenu_Keys* CUserMsg_VGUIMenu::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline ::CUserMsg_VGUIMenu_Keys* CUserMsg_VGUIMenu::add_keys() {
+  ::CUserMsg_VGUIMenu_Keys* _add = _internal_add_keys();
+  // @@protoc_insertion_point(field_add:CUserMsg_VGUIMenu.keys)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::CUserMsg_VGUIMenu_Keys >&
+CUserMsg_VGUIMenu::keys() const {
+  // @@protoc_insertion_point(field_list:CUserMsg_VGUIMenu.keys)
+  return _impl_.keys_;
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_Geiger
+
+// optional int32 range = 1;
+inline bool CUserMsg_Geiger::_internal_has_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_Geiger::has_range() const {
+  return _internal_has_range();
+}
+inline void CUserMsg_Geiger::clear_range() {
+  _impl_.range_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CUserMsg_Geiger::_internal_range() const {
+  return _impl_.range_;
+}
+inline int32_t CUserMsg_Geiger::range() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Geiger.range)
+  return _internal_range();
+}
+inline void CUserMsg_Geiger::_internal_set_range(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.range_ = value;
+}
+inline void CUserMsg_Geiger::set_range(int32_t value) {
+  _internal_set_range(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Geiger.range)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_Rumble
+
+// optional int32 index = 1;
+inline bool CUserMsg_Rumble::_internal_has_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_Rumble::has_index() const {
+  return _internal_has_index();
+}
+inline void CUserMsg_Rumble::clear_index() {
+  _impl_.index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CUserMsg_Rumble::_internal_index() const {
+  return _impl_.index_;
+}
+inline int32_t CUserMsg_Rumble::index() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Rumble.index)
+  return _internal_index();
+}
+inline void CUserMsg_Rumble::_internal_set_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.index_ = value;
+}
+inline void CUserMsg_Rumble::set_index(int32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Rumble.index)
+}
+
+// optional int32 data = 2;
+inline bool CUserMsg_Rumble::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_Rumble::has_data() const {
+  return _internal_has_data();
+}
+inline void CUserMsg_Rumble::clear_data() {
+  _impl_.data_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CUserMsg_Rumble::_internal_data() const {
+  return _impl_.data_;
+}
+inline int32_t CUserMsg_Rumble::data() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Rumble.data)
+  return _internal_data();
+}
+inline void CUserMsg_Rumble::_internal_set_data(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.data_ = value;
+}
+inline void CUserMsg_Rumble::set_data(int32_t value) {
+  _internal_set_data(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Rumble.data)
+}
+
+// optional int32 flags = 3;
+inline bool CUserMsg_Rumble::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_Rumble::has_flags() const {
+  return _internal_has_flags();
+}
+inline void CUserMsg_Rumble::clear_flags() {
+  _impl_.flags_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CUserMsg_Rumble::_internal_flags() const {
+  return _impl_.flags_;
+}
+inline int32_t CUserMsg_Rumble::flags() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Rumble.flags)
+  return _internal_flags();
+}
+inline void CUserMsg_Rumble::_internal_set_flags(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.flags_ = value;
+}
+inline void CUserMsg_Rumble::set_flags(int32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Rumble.flags)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_Train
+
+// optional int32 train = 1;
+inline bool CUserMsg_Train::_internal_has_train() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_Train::has_train() const {
+  return _internal_has_train();
+}
+inline void CUserMsg_Train::clear_train() {
+  _impl_.train_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CUserMsg_Train::_internal_train() const {
+  return _impl_.train_;
+}
+inline int32_t CUserMsg_Train::train() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_Train.train)
+  return _internal_train();
+}
+inline void CUserMsg_Train::_internal_set_train(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.train_ = value;
+}
+inline void CUserMsg_Train::set_train(int32_t value) {
+  _internal_set_train(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_Train.train)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_SayTextChannel
+
+// optional int32 player = 1;
+inline bool CUserMsg_SayTextChannel::_internal_has_player() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayTextChannel::has_player() const {
+  return _internal_has_player();
+}
+inline void CUserMsg_SayTextChannel::clear_player() {
+  _impl_.player_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CUserMsg_SayTextChannel::_internal_player() const {
+  return _impl_.player_;
+}
+inline int32_t CUserMsg_SayTextChannel::player() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayTextChannel.player)
+  return _internal_player();
+}
+inline void CUserMsg_SayTextChannel::_internal_set_player(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.player_ = value;
+}
+inline void CUserMsg_SayTextChannel::set_player(int32_t value) {
+  _internal_set_player(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_SayTextChannel.player)
+}
+
+// optional int32 channel = 2;
+inline bool CUserMsg_SayTextChannel::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayTextChannel::has_channel() const {
+  return _internal_has_channel();
+}
+inline void CUserMsg_SayTextChannel::clear_channel() {
+  _impl_.channel_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CUserMsg_SayTextChannel::_internal_channel() const {
+  return _impl_.channel_;
+}
+inline int32_t CUserMsg_SayTextChannel::channel() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayTextChannel.channel)
+  return _internal_channel();
+}
+inline void CUserMsg_SayTextChannel::_internal_set_channel(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.channel_ = value;
+}
+inline void CUserMsg_SayTextChannel::set_channel(int32_t value) {
+  _internal_set_channel(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_SayTextChannel.channel)
+}
+
+// optional string text = 3;
+inline bool CUserMsg_SayTextChannel::_internal_has_text() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_SayTextChannel::has_text() const {
+  return _internal_has_text();
+}
+inline void CUserMsg_SayTextChannel::clear_text() {
+  _impl_.text_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_SayTextChannel::text() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_SayTextChannel.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_SayTextChannel::set_text(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_SayTextChannel.text)
+}
+inline std::string* CUserMsg_SayTextChannel::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_SayTextChannel.text)
+  return _s;
+}
+inline const std::string& CUserMsg_SayTextChannel::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void CUserMsg_SayTextChannel::_internal_set_text(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayTextChannel::_internal_mutable_text() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_SayTextChannel::release_text() {
+  // @@protoc_insertion_point(field_release:CUserMsg_SayTextChannel.text)
+  if (!_internal_has_text()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.text_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_SayTextChannel::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_SayTextChannel.text)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_MessageText
+
+// optional uint32 color = 1;
+inline bool CUserMsg_MessageText::_internal_has_color() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_MessageText::has_color() const {
+  return _internal_has_color();
+}
+inline void CUserMsg_MessageText::clear_color() {
+  _impl_.color_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CUserMsg_MessageText::_internal_color() const {
+  return _impl_.color_;
+}
+inline uint32_t CUserMsg_MessageText::color() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_MessageText.color)
+  return _internal_color();
+}
+inline void CUserMsg_MessageText::_internal_set_color(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.color_ = value;
+}
+inline void CUserMsg_MessageText::set_color(uint32_t value) {
+  _internal_set_color(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_MessageText.color)
+}
+
+// optional string text = 2;
+inline bool CUserMsg_MessageText::_internal_has_text() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_MessageText::has_text() const {
+  return _internal_has_text();
+}
+inline void CUserMsg_MessageText::clear_text() {
+  _impl_.text_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_MessageText::text() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_MessageText.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_MessageText::set_text(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_MessageText.text)
+}
+inline std::string* CUserMsg_MessageText::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_MessageText.text)
+  return _s;
+}
+inline const std::string& CUserMsg_MessageText::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void CUserMsg_MessageText::_internal_set_text(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_MessageText::_internal_mutable_text() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_MessageText::release_text() {
+  // @@protoc_insertion_point(field_release:CUserMsg_MessageText.text)
+  if (!_internal_has_text()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.text_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_MessageText::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_MessageText.text)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_CameraTransition_Transition_DataDriven
+
+// optional string filename = 1;
+inline bool CUserMsg_CameraTransition_Transition_DataDriven::_internal_has_filename() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CUserMsg_CameraTransition_Transition_DataDriven::has_filename() const {
+  return _internal_has_filename();
+}
+inline void CUserMsg_CameraTransition_Transition_DataDriven::clear_filename() {
+  _impl_.filename_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CUserMsg_CameraTransition_Transition_DataDriven::filename() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CameraTransition.Transition_DataDriven.filename)
+  return _internal_filename();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CUserMsg_CameraTransition_Transition_DataDriven::set_filename(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.filename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:CUserMsg_CameraTransition.Transition_DataDriven.filename)
+}
+inline std::string* CUserMsg_CameraTransition_Transition_DataDriven::mutable_filename() {
+  std::string* _s = _internal_mutable_filename();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_CameraTransition.Transition_DataDriven.filename)
+  return _s;
+}
+inline const std::string& CUserMsg_CameraTransition_Transition_DataDriven::_internal_filename() const {
+  return _impl_.filename_.Get();
+}
+inline void CUserMsg_CameraTransition_Transition_DataDriven::_internal_set_filename(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.filename_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CUserMsg_CameraTransition_Transition_DataDriven::_internal_mutable_filename() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.filename_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CUserMsg_CameraTransition_Transition_DataDriven::release_filename() {
+  // @@protoc_insertion_point(field_release:CUserMsg_CameraTransition.Transition_DataDriven.filename)
+  if (!_internal_has_filename()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.filename_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filename_.IsDefault()) {
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CUserMsg_CameraTransition_Transition_DataDriven::set_allocated_filename(std::string* filename) {
+  if (filename != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.filename_.SetAllocated(filename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filename_.IsDefault()) {
+    _impl_.filename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_CameraTransition.Transition_DataDriven.filename)
+}
+
+// optional int32 attach_ent_index = 2;
+inline bool CUserMsg_CameraTransition_Transition_DataDriven::_internal_has_attach_ent_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_CameraTransition_Transition_DataDriven::has_attach_ent_index() const {
+  return _internal_has_attach_ent_index();
+}
+inline void CUserMsg_CameraTransition_Transition_DataDriven::clear_attach_ent_index() {
+  _impl_.attach_ent_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CUserMsg_CameraTransition_Transition_DataDriven::_internal_attach_ent_index() const {
+  return _impl_.attach_ent_index_;
+}
+inline int32_t CUserMsg_CameraTransition_Transition_DataDriven::attach_ent_index() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CameraTransition.Transition_DataDriven.attach_ent_index)
+  return _internal_attach_ent_index();
+}
+inline void CUserMsg_CameraTransition_Transition_DataDriven::_internal_set_attach_ent_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.attach_ent_index_ = value;
+}
+inline void CUserMsg_CameraTransition_Transition_DataDriven::set_attach_ent_index(int32_t value) {
+  _internal_set_attach_ent_index(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_CameraTransition.Transition_DataDriven.attach_ent_index)
+}
+
+// -------------------------------------------------------------------
+
+// CUserMsg_CameraTransition
+
+// optional uint32 camera_type = 1;
+inline bool CUserMsg_CameraTransition::_internal_has_camera_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CUserMsg_CameraTransition::has_camera_type() const {
+  return _internal_has_camera_type();
+}
+inline void CUserMsg_CameraTransition::clear_camera_type() {
+  _impl_.camera_type_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CUserMsg_CameraTransition::_internal_camera_type() const {
+  return _impl_.camera_type_;
+}
+inline uint32_t CUserMsg_CameraTransition::camera_type() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CameraTransition.camera_type)
+  return _internal_camera_type();
+}
+inline void CUserMsg_CameraTransition::_internal_set_camera_type(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.camera_type_ = value;
+}
+inline void CUserMsg_CameraTransition::set_camera_type(uint32_t value) {
+  _internal_set_camera_type(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_CameraTransition.camera_type)
+}
+
+// optional float duration = 2;
+inline bool CUserMsg_CameraTransition::_internal_has_duration() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CUserMsg_CameraTransition::has_duration() const {
+  return _internal_has_duration();
+}
+inline void CUserMsg_CameraTransition::clear_duration() {
+  _impl_.duration_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CUserMsg_CameraTransition::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline float CUserMsg_CameraTransition::duration() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CameraTransition.duration)
+  return _internal_duration();
+}
+inline void CUserMsg_CameraTransition::_internal_set_duration(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.duration_ = value;
+}
+inline void CUserMsg_CameraTransition::set_duration(float value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:CUserMsg_CameraTransition.duration)
+}
+
+// optional .CUserMsg_CameraTransition.Transition_DataDriven params_data_driven = 3;
+inline bool CUserMsg_CameraTransition::_internal_has_params_data_driven() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.params_data_driven_ != nullptr);
+  return value;
+}
+inline bool CUserMsg_CameraTransition::has_params_data_driven() const {
+  return _internal_has_params_data_driven();
+}
+inline void CUserMsg_CameraTransition::clear_params_data_driven() {
+  if (_impl_.params_data_driven_ != nullptr) _impl_.params_data_driven_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::CUserMsg_CameraTransition_Transition_DataDriven& CUserMsg_CameraTransition::_internal_params_data_driven() const {
+  const ::CUserMsg_CameraTransition_Transition_DataDriven* p = _impl_.params_data_driven_;
+  return p != nullptr ? *p : reinterpret_cast<const ::CUserMsg_CameraTransition_Transition_DataDriven&>(
+      ::_CUserMsg_CameraTransition_Transition_DataDriven_default_instance_);
+}
+inline const ::CUserMsg_CameraTransition_Transition_DataDriven& CUserMsg_CameraTransition::params_data_driven() const {
+  // @@protoc_insertion_point(field_get:CUserMsg_CameraTransition.params_data_driven)
+  return _internal_params_data_driven();
+}
+inline void CUserMsg_CameraTransition::unsafe_arena_set_allocated_params_data_driven(
+    ::CUserMsg_CameraTransition_Transition_DataDriven* params_data_driven) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.params_data_driven_);
+  }
+  _impl_.params_data_driven_ = params_data_driven;
+  if (params_data_driven) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CUserMsg_CameraTransition.params_data_driven)
+}
+inline ::CUserMsg_CameraTransition_Transition_DataDriven* CUserMsg_CameraTransition::release_params_data_driven() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CUserMsg_CameraTransition_Transition_DataDriven* temp = _impl_.params_data_driven_;
+  _impl_.params_data_driven_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::CUserMsg_CameraTransition_Transition_DataDriven* CUserMsg_CameraTransition::unsafe_arena_release_params_data_driven() {
+  // @@protoc_insertion_point(field_release:CUserMsg_CameraTransition.params_data_driven)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::CUserMsg_CameraTransition_Transition_DataDriven* temp = _impl_.params_data_driven_;
+  _impl_.params_data_driven_ = nullptr;
+  return temp;
+}
+inline ::CUserMsg_CameraTransition_Transition_DataDriven* CUserMsg_CameraTransition::_internal_mutable_params_data_driven() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.params_data_driven_ == nullptr) {
+    auto* p = CreateMaybeMessage<::CUserMsg_CameraTransition_Transition_DataDriven>(GetArenaForAllocation());
+    _impl_.params_data_driven_ = p;
+  }
+  return _impl_.params_data_driven_;
+}
+inline ::CUserMsg_CameraTransition_Transition_DataDriven* CUserMsg_CameraTransition::mutable_params_data_driven() {
+  ::CUserMsg_CameraTransition_Transition_DataDriven* _msg = _internal_mutable_params_data_driven();
+  // @@protoc_insertion_point(field_mutable:CUserMsg_CameraTransition.params_data_driven)
+  return _msg;
+}
+inline void CUserMsg_CameraTransition::set_allocated_params_data_driven(::CUserMsg_CameraTransition_Transition_DataDriven* params_data_driven) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.params_data_driven_;
+  }
+  if (params_data_driven) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(params_data_driven);
+    if (message_arena != submessage_arena) {
+      params_data_driven = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, params_data_driven, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.params_data_driven_ = params_data_driven;
+  // @@protoc_insertion_point(field_set_allocated:CUserMsg_CameraTransition.params_data_driven)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::EBaseUserMessages> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::EBaseUserMessages>() {
+  return ::EBaseUserMessages_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_usermessages_2eproto
@@ -0,0 +1,263 @@
+/**
+ * @file test/async.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Async
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <alice/async.hpp>
+
+using namespace dota;
+
+/** Waits until f returns true, fails after a few seconds */
+template <typename F>
+void waitFor(F f) {
+    for (uint32_t i = 0; i < 5000 && !f(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    BOOST_REQUIRE( f() );
+}
+
+BOOST_AUTO_TEST_CASE( RingCapacity )
+{
+    spsc_ring<int> r1(1);
+    spsc_ring<int> r5(5);
+    spsc_ring<int> r8(8);
+
+    BOOST_REQUIRE_EQUAL( r1.capacity(), 1 );
+    BOOST_REQUIRE_EQUAL( r5.capacity(), 8 );
+    BOOST_REQUIRE_EQUAL( r8.capacity(), 8 );
+}
+
+BOOST_AUTO_TEST_CASE( RingFull )
+{
+    spsc_ring<std::unique_ptr<int>> r(4);
+
+    for (int i = 0; i < 4; ++i) {
+        BOOST_REQUIRE( r.push(std::unique_ptr<int>(new int(i))) );
+    }
+
+    // rejected values are left untouched
+    std::unique_ptr<int> v(new int(4));
+    BOOST_REQUIRE( !r.push(std::move(v)) );
+    BOOST_REQUIRE( v && *v == 4 );
+    BOOST_REQUIRE_EQUAL( r.size(), 4 );
+
+    std::unique_ptr<int> out;
+    for (int i = 0; i < 4; ++i) {
+        BOOST_REQUIRE( r.pop(out) );
+        BOOST_REQUIRE_EQUAL( *out, i );
+    }
+
+    BOOST_REQUIRE( !r.pop(out) );
+    BOOST_REQUIRE_EQUAL( r.size(), 0 );
+}
+
+BOOST_AUTO_TEST_CASE( RingWraparound )
+{
+    spsc_ring<int> r(4);
+    int next = 0;
+    int expected = 0;
+
+    // positions pass the capacity many times, with the ring at different fill levels
+    for (int round = 0; round < 1000; ++round) {
+        const int n = 1 + round % 4;
+
+        for (int i = 0; i < n; ++i) {
+            BOOST_REQUIRE( r.push(next++) );
+        }
+
+        for (int i = 0; i < n; ++i) {
+            int v;
+            BOOST_REQUIRE( r.pop(v) );
+            BOOST_REQUIRE_EQUAL( v, expected++ );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( RingThreads )
+{
+    const int count = 1000000;
+    spsc_ring<int> r(16);
+    bool ordered = true;
+
+    std::thread consumer([&]() {
+        int expected = 0;
+        int v;
+
+        while (expected < count) {
+            if (!r.pop(v)) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (v != expected++)
+                ordered = false;
+        }
+    });
+
+    for (int i = 0; i < count; ++i) {
+        int v = i;
+        while (!r.push(std::move(v))) {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+
+    BOOST_REQUIRE( ordered );
+    BOOST_REQUIRE_EQUAL( r.size(), 0 );
+}
+
+BOOST_AUTO_TEST_CASE( ConsumerBlock )
+{
+    handler_t h;
+    std::atomic<bool> release(false);
+    std::atomic<bool> published(false);
+    std::vector<uint32_t> seen;
+
+    async_consumer c(&h, [&](async_event &e) {
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+
+        seen.push_back(e.status);
+    }, 4, async_consumer::overflow_block);
+
+    c.subscribe<msgStatus>(0);
+
+    // the ring fills up and the producer has to wait for the consumer
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < 100; ++i) {
+            h.forward<msgStatus>(0, i, i);
+        }
+
+        published.store(true);
+    });
+
+    waitFor([&]() { return c.getPending() == 4; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    BOOST_REQUIRE( !published.load() );
+
+    release.store(true);
+    producer.join();
+    c.stop();
+
+    BOOST_REQUIRE_EQUAL( c.getDropped(), 0 );
+    BOOST_REQUIRE_EQUAL( seen.size(), 100 );
+
+    for (uint32_t i = 0; i < seen.size(); ++i) {
+        BOOST_REQUIRE_EQUAL( seen[i], i );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( ConsumerDrop )
+{
+    handler_t h;
+    std::atomic<bool> release(false);
+    std::atomic<bool> started(false);
+    std::vector<uint32_t> seen;
+
+    async_consumer c(&h, [&](async_event &e) {
+        started.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+
+        seen.push_back(e.status);
+    }, 4, async_consumer::overflow_drop);
+
+    c.subscribe<msgStatus>(0);
+
+    // the first event is being consumed, four fit into the ring, the rest is dropped
+    h.forward<msgStatus>(0, 0u, 0);
+    waitFor([&]() { return started.load(); });
+
+    for (uint32_t i = 1; i < 100; ++i) {
+        h.forward<msgStatus>(0, i, i);
+    }
+
+    BOOST_REQUIRE_EQUAL( c.getDropped(), 95 );
+
+    release.store(true);
+    c.stop();
+
+    BOOST_REQUIRE_EQUAL( seen.size(), 5 );
+
+    for (uint32_t i = 0; i < seen.size(); ++i) {
+        BOOST_REQUIRE_EQUAL( seen[i], i );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( ConsumerDrain )
+{
+    handler_t h;
+    uint32_t consumed = 0;
+
+    {
+        async_consumer c(&h, [&](async_event &e) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            ++consumed;
+        }, 1024);
+
+        c.subscribe<msgStatus>(0);
+
+        for (uint32_t i = 0; i < 500; ++i) {
+            h.forward<msgStatus>(0, i, i);
+        }
+
+        // everything published is consumed before stop returns
+        c.stop();
+        BOOST_REQUIRE_EQUAL( consumed, 500 );
+        BOOST_REQUIRE_EQUAL( c.getPending(), 0 );
+
+        // stopping twice does nothing
+        c.stop();
+    }
+
+    BOOST_REQUIRE_EQUAL( consumed, 500 );
+
+    // the destructor drains as well
+    consumed = 0;
+
+    {
+        async_consumer c(&h, [&](async_event &e) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            ++consumed;
+        }, 1024);
+
+        c.subscribe<msgStatus>(0);
+
+        for (uint32_t i = 0; i < 500; ++i) {
+            h.forward<msgStatus>(0, i, i);
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL( consumed, 500 );
+}
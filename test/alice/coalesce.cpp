@@ -0,0 +1,323 @@
+/**
+ * @file test/coalesce.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Coalesce
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <alice/demo.pb.h>
+#include <alice/netmessages.pb.h>
+#include <alice/dem_stream_file.hpp>
+#include <alice/parser.hpp>
+
+#include "replay.hpp"
+
+using namespace dota;
+
+/** Writes bits in the order bitstream reads them */
+struct bit_writer {
+    std::string data;
+    uint32_t size = 0;
+
+    /** Writes the lowest n bits of v */
+    void put(uint64_t v, uint32_t n) {
+        for (uint32_t i = 0; i < n; ++i, ++size) {
+            if (size % 8 == 0)
+                data.push_back(0);
+
+            if ((v >> i) & 1)
+                data[size / 8] |= 1 << (size % 8);
+        }
+    }
+
+    /** Writes a variable length integer */
+    void putVarInt(uint64_t v) {
+        do {
+            put((v & 0x7F) | (v > 0x7F ? 0x80 : 0), 8);
+            v >>= 7;
+        } while (v);
+    }
+
+    /** Writes fields followed by their 8 bit values */
+    void putFields(const std::vector<std::pair<int32_t, uint32_t>> &fields) {
+        int32_t last = -1;
+
+        for (auto &f : fields) {
+            if (f.first == last + 1) {
+                put(1, 1);
+            } else {
+                put(0, 1);
+                putVarInt(f.first - last - 1);
+            }
+
+            last = f.first;
+        }
+
+        put(0, 1);
+        putVarInt(0x3FFF);
+
+        for (auto &f : fields) {
+            put(f.second, 8);
+        }
+    }
+};
+
+/** Appends a net message to a message container */
+template <typename T>
+void container(std::string &out, uint32_t type, const T &msg) {
+    const std::string data = msg.SerializeAsString();
+
+    testWriteVarInt(out, type);
+    testWriteVarInt(out, data.size());
+    out += data;
+}
+
+/** Returns a packet containing the net message */
+template <typename T>
+std::string packet(uint32_t type, const T &msg) {
+    std::string data;
+    container(data, type, msg);
+
+    CDemoPacket p;
+    p.set_data(data);
+    return p.SerializeAsString();
+}
+
+/** Returns a packet updating entity 1 once per field list */
+std::string updates(const std::vector<std::vector<std::pair<int32_t, uint32_t>>> &lists) {
+    std::string data;
+
+    for (auto &fields : lists) {
+        bit_writer b;
+        b.put(1, 6); // entity 1
+        b.put(0, 2); // update
+        b.putFields(fields);
+
+        CSVCMsg_PacketEntities e;
+        e.set_max_entries(10);
+        e.set_updated_entries(1);
+        e.set_is_delta(true);
+        e.set_entity_data(b.data + std::string(1, '\0')); // no deletions
+
+        container(data, svc_PacketEntities, e);
+    }
+
+    CDemoPacket p;
+    p.set_data(data);
+    return p.SerializeAsString();
+}
+
+/**
+ * Returns a replay with a single class of three 8 bit properties.
+ *
+ * Entity 1 is created on tick 10, updated three times on tick 20 and once more on tick 30.
+ */
+std::string replay() {
+    std::vector<test_message> msgs;
+
+    // class count
+    CSVCMsg_ServerInfo info;
+    info.set_max_classes(2);
+    msgs.push_back(test_message{DEM_SignonPacket, 0, packet(svc_ServerInfo, info)});
+
+    // sendtable
+    CSVCMsg_SendTable table;
+    table.set_net_table_name("DT_Test");
+    table.set_needs_decoder(true);
+
+    for (const char *name : {"a", "b", "c"}) {
+        CSVCMsg_SendTable::sendprop_t *p = table.add_props();
+        p->set_type(sendprop::T_Int);
+        p->set_var_name(name);
+        p->set_flags(SPROP_UNSIGNED);
+        p->set_num_bits(8);
+    }
+
+    std::string tables;
+    container(tables, svc_SendTable, table);
+
+    CDemoSendTables send;
+    send.set_data(tables);
+    msgs.push_back(test_message{DEM_SendTables, 0, send.SerializeAsString()});
+
+    // classes
+    CDemoClassInfo classes;
+    CDemoClassInfo::class_t *c = classes.add_classes();
+    c->set_class_id(0);
+    c->set_network_name("Test");
+    c->set_table_name("DT_Test");
+    msgs.push_back(test_message{DEM_ClassInfo, 0, classes.SerializeAsString()});
+
+    // baseline setting a to 1
+    bit_writer value;
+    value.putFields({{0, 1}});
+
+    bit_writer baseline;
+    baseline.put(0, 1);   // not full
+    baseline.put(1, 1);   // increment
+    baseline.put(1, 1);   // has name
+    baseline.put(0, 1);   // no substring
+    baseline.put('0', 8); // key
+    baseline.put(0, 8);
+    baseline.put(1, 1);   // has value
+    baseline.put(value.data.size(), 14);
+
+    for (char ch : value.data) {
+        baseline.put(static_cast<uint8_t>(ch), 8);
+    }
+
+    CSVCMsg_CreateStringTable stringtable;
+    stringtable.set_name("instancebaseline");
+    stringtable.set_max_entries(16);
+    stringtable.set_num_entries(1);
+    stringtable.set_user_data_size_bits(0);
+    stringtable.set_string_data(baseline.data);
+    msgs.push_back(test_message{DEM_SignonPacket, 0, packet(svc_CreateStringTable, stringtable)});
+
+    // creation
+    bit_writer create;
+    create.put(1, 6);  // entity 1
+    create.put(2, 2);  // create
+    create.put(0, 1);  // class
+    create.put(0, 10); // serial
+    create.putFields({{1, 2}});
+
+    CSVCMsg_PacketEntities entities;
+    entities.set_max_entries(10);
+    entities.set_updated_entries(1);
+    entities.set_is_delta(false);
+    entities.set_entity_data(create.data);
+    msgs.push_back(test_message{DEM_Packet, 10, packet(svc_PacketEntities, entities)});
+
+    // updates, the last value of each field wins
+    msgs.push_back(test_message{DEM_Packet, 20, updates({{{0, 3}, {2, 4}}, {{2, 5}}})});
+    msgs.push_back(test_message{DEM_Packet, 20, updates({{{1, 6}, {2, 7}}})});
+    msgs.push_back(test_message{DEM_Packet, 30, updates({{{0, 8}}})});
+
+    msgs.push_back(test_message{DEM_Stop, 31, ""});
+    msgs.push_back(test_message{DEM_FileInfo, 31, ""});
+    return testReplay(msgs);
+}
+
+/** A single entity notification */
+struct notification {
+    uint32_t tick;
+    entity::state_type state;
+    uint32_t a, b, c;
+};
+
+/** Records all entity notifications */
+struct recorder {
+    parser &p;
+    std::vector<notification> entities;
+    std::vector<std::pair<uint32_t, std::vector<uint32_t>>> deltas;
+
+    recorder(parser &p) : p(p) {
+        handlerRegisterCallback(p.getHandler(), msgEntity, 0, recorder, onEntity)
+        handlerRegisterCallback(p.getHandler(), msgEntityDelta, 0, recorder, onDelta)
+    }
+
+    void onEntity(handlerCbType(msgEntity) msg) {
+        entity *e = msg->msg;
+        entities.push_back(notification{
+            p.getTick(), e->getState(), e->prop<uint32_t>(".a", 0), e->prop<uint32_t>(".b", 0), e->prop<uint32_t>(".c", 0)
+        });
+    }
+
+    void onDelta(handlerCbType(msgEntityDelta) msg) {
+        deltas.push_back({p.getTick(), msg->msg->entity_fields});
+    }
+};
+
+/** Parses the test replay with or without coalescing */
+struct parsed {
+    std::string path;
+    parser p;
+    recorder r;
+
+    parsed(bool coalesce) : path("alice-test-coalesce.dem"),
+        p(settings{false, false, false, false, true, {}, true, true, true, true, {}, false}, new dem_stream_file), r(p)
+    {
+        testWriteFile(path, replay());
+
+        p.setCoalesceEntities(coalesce);
+        p.open(path);
+        p.handle();
+    }
+
+    ~parsed() {
+        std::remove(path.c_str());
+    }
+};
+
+BOOST_AUTO_TEST_CASE( Coalesced )
+{
+    parsed t(true);
+    const std::vector<notification> &e = t.r.entities;
+    const std::vector<std::pair<uint32_t, std::vector<uint32_t>>> &d = t.r.deltas;
+
+    // one notification per tick, forwarded before the tick advances
+    BOOST_REQUIRE_EQUAL( e.size(), 3 );
+
+    BOOST_REQUIRE_EQUAL( e[0].tick, 10 );
+    BOOST_REQUIRE_EQUAL( e[0].state, entity::state_created );
+    BOOST_REQUIRE_EQUAL( e[0].a, 1 );
+    BOOST_REQUIRE_EQUAL( e[0].b, 2 );
+
+    BOOST_REQUIRE_EQUAL( e[1].tick, 20 );
+    BOOST_REQUIRE_EQUAL( e[1].state, entity::state_updated );
+    BOOST_REQUIRE_EQUAL( e[1].a, 3 );
+    BOOST_REQUIRE_EQUAL( e[1].b, 6 );
+    BOOST_REQUIRE_EQUAL( e[1].c, 7 );
+
+    BOOST_REQUIRE_EQUAL( e[2].tick, 30 );
+    BOOST_REQUIRE_EQUAL( e[2].a, 8 );
+
+    // the delta holds the sorted union of all fields touched in the tick
+    BOOST_REQUIRE_EQUAL( d.size(), 3 );
+    BOOST_REQUIRE_EQUAL( d[1].first, 20 );
+    BOOST_REQUIRE( d[1].second == std::vector<uint32_t>({0, 1, 2}) );
+    BOOST_REQUIRE( d[2].second == std::vector<uint32_t>({0}) );
+}
+
+BOOST_AUTO_TEST_CASE( Uncoalesced )
+{
+    parsed t(false);
+    const std::vector<notification> &e = t.r.entities;
+    const std::vector<std::pair<uint32_t, std::vector<uint32_t>>> &d = t.r.deltas;
+
+    // every update is forwarded as it is read
+    BOOST_REQUIRE_EQUAL( e.size(), 5 );
+    BOOST_REQUIRE_EQUAL( d.size(), 5 );
+
+    BOOST_REQUIRE_EQUAL( e[1].tick, 20 );
+    BOOST_REQUIRE_EQUAL( e[1].c, 4 );
+    BOOST_REQUIRE_EQUAL( e[2].c, 5 );
+    BOOST_REQUIRE_EQUAL( e[3].tick, 20 );
+    BOOST_REQUIRE( d[1].second == std::vector<uint32_t>({0, 2}) );
+}
@@ -0,0 +1,368 @@
+/**
+ * @file test/columns.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Columns
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <alice/bitstream.hpp>
+#include <alice/columns.hpp>
+#include <alice/netmessages.pb.h>
+
+using namespace dota;
+
+/** Writes bits in the order bitstream reads them */
+struct bit_writer {
+    std::string data;
+    uint32_t size = 0;
+
+    /** Writes the lowest n bits of v */
+    void put(uint64_t v, uint32_t n) {
+        for (uint32_t i = 0; i < n; ++i, ++size) {
+            if (size % 8 == 0)
+                data.push_back(0);
+
+            if ((v >> i) & 1)
+                data[size / 8] |= 1 << (size % 8);
+        }
+    }
+
+    /** Writes a variable length integer */
+    void putVarInt(uint64_t v) {
+        do {
+            put((v & 0x7F) | (v > 0x7F ? 0x80 : 0), 8);
+            v >>= 7;
+        } while (v);
+    }
+
+    /** Writes a field id following the previous one */
+    void putField(int32_t &last, int32_t field) {
+        if (field == last + 1) {
+            put(1, 1);
+        } else {
+            put(0, 1);
+            putVarInt(field - last - 1);
+        }
+
+        last = field;
+    }
+
+    /** Writes the end of the field list */
+    void putEnd() {
+        put(0, 1);
+        putVarInt(0x3FFF);
+    }
+};
+
+/** Entity created outside of the parser */
+struct test_entity : public entity {
+    test_entity(const entity_description &cls, const flatsendtable &flat) : entity(1, cls, flat) {}
+
+    using entity::updateFromBitstream;
+};
+
+/** A class with a field for each column type */
+struct test_class {
+    std::vector<std::unique_ptr<sendprop>> props;
+    sendprop element;
+    flatsendtable flat;
+    entity_description cls;
+
+    test_class() : element(definition(sendprop::T_Int, SPROP_UNSIGNED, 5), "element"), cls{1, "Test", "DT_Test"} {
+        add(sendprop::T_Int, 0, 12);                                            // 0 int
+        add(sendprop::T_Int, SPROP_UNSIGNED, 10);                               // 1 uint
+        add(sendprop::T_Int, SPROP_ENCODED_AGAINST_TICKCOUNT, 32);              // 2 varint
+        add(sendprop::T_Float, 0, 10, 0.0f, 100.0f);                            // 3 scaled float
+        add(sendprop::T_Float, SPROP_NOSCALE, 32);                              // 4 noscale float
+        add(sendprop::T_Vector, 0, 8, 0.0f, 50.0f);                             // 5 vector
+        add(sendprop::T_Vector, SPROP_NORMAL, 0);                               // 6 normal
+        add(sendprop::T_VectorXY, SPROP_NOSCALE, 32);                           // 7 vectorxy
+        add(sendprop::T_Int64, 0, 48);                                          // 8 int64
+        add(sendprop::T_Int64, SPROP_UNSIGNED | SPROP_ENCODED_AGAINST_TICKCOUNT, 64); // 9 uint64
+        add(sendprop::T_String, 0, 0);                                          // 10 string
+        add(sendprop::T_Array, 0, 0, 0.0f, 0.0f, 7);                            // 11 array
+        props.back()->setArrayType(&element);
+    }
+
+    /** Returns a sendprop definition */
+    static CSVCMsg_SendTable::sendprop_t definition(sendprop::type t, uint32_t flags, uint32_t bits,
+        float low = 0.0f, float high = 1.0f, uint32_t elements = 0)
+    {
+        CSVCMsg_SendTable::sendprop_t p;
+        p.set_type(t);
+        p.set_flags(flags);
+        p.set_num_bits(bits);
+        p.set_low_value(low);
+        p.set_high_value(high);
+        p.set_num_elements(elements);
+        return p;
+    }
+
+    /** Adds a field */
+    void add(sendprop::type t, uint32_t flags, uint32_t bits, float low = 0.0f, float high = 1.0f, uint32_t elements = 0) {
+        props.emplace_back(new sendprop(definition(t, flags, bits, low, high, elements), "DT_Test"));
+
+        const std::string name = "f" + std::to_string(flat.properties.size());
+        flat.index[name] = flat.properties.size();
+        flat.properties.push_back(dt_hiera{props.back().get(), name});
+        flat.plan.push_back(decode_op::compile(props.back().get()));
+    }
+};
+
+/** Writes the value of a field, seed varies the value */
+void writeValue(bit_writer &w, uint32_t field, uint32_t seed) {
+    switch (field) {
+        case 0:  w.put(0x800 | seed, 12); break;                 // negative
+        case 1:  w.put(0x200 + seed, 10); break;
+        case 2:  w.putVarInt(300 + seed); break;
+        case 3:  w.put(0x155 + seed, 10); break;
+        case 4:  w.put(0x3FC00000 + seed, 32); break;            // 1.5f and above
+        case 5:  w.put(0x102030 + seed, 24); break;
+        case 6:  w.put(0x123 + seed, 12); w.put(0x456, 12); w.put(1, 1); break;
+        case 7:  w.put(0x40490FDB, 32); w.put(0xC0000000 + seed, 32); break;
+        case 8:  w.put(0xABCDEF012345ULL + seed, 48); break;     // sign bit set
+        case 9:  w.putVarInt(0x1234567890ULL + seed); break;
+        case 10: {
+            const std::string s = "value " + std::to_string(seed);
+            w.put(s.size(), 9);
+            for (char c : s) w.put(c, 8);
+        } break;
+        case 11: {
+            w.put(3, 3);
+            for (uint32_t i = 0; i < 3; ++i) w.put(seed + i, 5);
+        } break;
+    }
+}
+
+/** Writes the given fields */
+std::string writeFields(const std::vector<int32_t> &fields, uint32_t seed) {
+    bit_writer w;
+    int32_t last = -1;
+
+    for (auto f : fields) {
+        w.putField(last, f);
+    }
+
+    w.putEnd();
+
+    for (auto f : fields) {
+        writeValue(w, f, seed);
+    }
+
+    return w.data;
+}
+
+/** Checks that a row holds the values of the entity */
+void requireRow(column_table &t, uint32_t row, entity &e) {
+    for (uint32_t f = 0; f < t.fields(); ++f) {
+        property &p = *e.find(f);
+        BOOST_REQUIRE( p.isInitialized() );
+
+        switch (t.getColumn(f).type) {
+            case column_int:
+                BOOST_REQUIRE_EQUAL( t.get<IntProperty>(row, f), p.as<IntProperty>() );
+                break;
+            case column_uint:
+                BOOST_REQUIRE_EQUAL( t.get<UIntProperty>(row, f), p.as<UIntProperty>() );
+                break;
+            case column_float:
+                BOOST_REQUIRE( std::memcmp(&t.get<FloatProperty>(row, f), &p.as<FloatProperty>(), sizeof(FloatProperty)) == 0 );
+                break;
+            case column_vector:
+                BOOST_REQUIRE( std::memcmp(t.get<VectorProperty>(row, f).data(), p.as<VectorProperty>().data(), sizeof(VectorProperty)) == 0 );
+                break;
+            case column_vectorxy:
+                BOOST_REQUIRE( std::memcmp(t.get<VectorXYProperty>(row, f).data(), p.as<VectorXYProperty>().data(), sizeof(VectorXYProperty)) == 0 );
+                break;
+            case column_int64:
+                BOOST_REQUIRE_EQUAL( t.get<Int64Property>(row, f), p.as<Int64Property>() );
+                break;
+            case column_uint64:
+                BOOST_REQUIRE_EQUAL( t.get<UInt64Property>(row, f), p.as<UInt64Property>() );
+                break;
+            case column_side: {
+                property &s = t.get<property>(row, f);
+                BOOST_REQUIRE_EQUAL( s.getName(), p.getName() );
+
+                if (p.getType() == sendprop::T_String) {
+                    BOOST_REQUIRE_EQUAL( s.as<StringProperty>(), p.as<StringProperty>() );
+                } else {
+                    ArrayProperty a = s.as<ArrayProperty>();
+                    ArrayProperty b = p.as<ArrayProperty>();
+
+                    BOOST_REQUIRE_EQUAL( a.size(), b.size() );
+                    for (std::size_t i = 0; i < a.size(); ++i) {
+                        BOOST_REQUIRE_EQUAL( a[i].as<UIntProperty>(), b[i].as<UIntProperty>() );
+                    }
+                }
+            } break;
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Layout )
+{
+    test_class c;
+    column_table t(c.flat);
+
+    const column_type expected[] = {
+        column_int, column_uint, column_int, column_float, column_float, column_vector, column_vector,
+        column_vectorxy, column_int64, column_uint64, column_side, column_side
+    };
+
+    BOOST_REQUIRE_EQUAL( t.fields(), 12 );
+    for (uint32_t f = 0; f < t.fields(); ++f) {
+        BOOST_REQUIRE_EQUAL( t.getColumn(f).type, expected[f] );
+    }
+
+    // the second field of a type goes into the second column
+    BOOST_REQUIRE_EQUAL( t.getColumn(2).column, 1 );
+    BOOST_REQUIRE_EQUAL( t.getColumn(4).column, 1 );
+    BOOST_REQUIRE_EQUAL( t.getColumn(11).column, 1 );
+}
+
+BOOST_AUTO_TEST_CASE( Update )
+{
+    test_class c;
+    column_table t(c.flat);
+    test_entity e(c.cls, c.flat);
+
+    const uint32_t row = t.allocate(e.getId());
+
+    // baseline sets all fields
+    {
+        const std::string data = writeFields({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}, 1);
+        bitstream b1(data), b2(data);
+        entity_delta d1, d2;
+
+        t.update(row, b1, &d1);
+        e.updateFromBitstream(b2, &d2);
+
+        BOOST_REQUIRE_EQUAL( b1.position(), b2.position() );
+        BOOST_REQUIRE( d1.entity_fields == d2.entity_fields );
+        requireRow(t, row, e);
+    }
+
+    // delta updates some of them
+    {
+        const std::string data = writeFields({1, 3, 6, 9, 10, 11}, 7);
+        bitstream b1(data), b2(data);
+        entity_delta d1, d2;
+
+        t.update(row, b1, &d1);
+        e.updateFromBitstream(b2, &d2);
+
+        BOOST_REQUIRE_EQUAL( b1.position(), b2.position() );
+        BOOST_REQUIRE( d1.entity_fields == d2.entity_fields );
+        BOOST_REQUIRE_EQUAL( d1.entity_fields.size(), 6 );
+        requireRow(t, row, e);
+    }
+
+    // baseline values decoded as properties end up in the same place
+    {
+        column_table copy(c.flat);
+        const uint32_t r = copy.allocate(e.getId());
+
+        for (uint32_t f = 0; f < copy.fields(); ++f) {
+            copy.set(r, f, *e.find(f));
+        }
+
+        requireRow(copy, r, e);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Reuse )
+{
+    test_class c;
+    column_table t(c.flat);
+
+    const uint32_t first = t.allocate(1);
+    const uint32_t second = t.allocate(2);
+    BOOST_REQUIRE_EQUAL( t.size(), 2 );
+
+    const std::string data = writeFields({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}, 3);
+    bitstream b(data);
+    t.update(first, b);
+
+    t.release(first);
+    BOOST_REQUIRE_EQUAL( t.getEntityId(first), (uint32_t)-1 );
+
+    // the row is handed out again with the values of the previous entity reset
+    const uint32_t row = t.allocate(5);
+    BOOST_REQUIRE_EQUAL( row, first );
+    BOOST_REQUIRE_EQUAL( t.size(), 2 );
+    BOOST_REQUIRE_EQUAL( t.getEntityId(row), 5 );
+    BOOST_REQUIRE_EQUAL( t.getEntityId(second), 2 );
+
+    BOOST_REQUIRE_EQUAL( t.get<IntProperty>(row, 0), 0 );
+    BOOST_REQUIRE_EQUAL( t.get<UIntProperty>(row, 1), 0 );
+    BOOST_REQUIRE_EQUAL( t.get<IntProperty>(row, 2), 0 );
+    BOOST_REQUIRE_EQUAL( t.get<FloatProperty>(row, 3), 0.0f );
+    BOOST_REQUIRE( t.get<VectorProperty>(row, 5) == VectorProperty() );
+    BOOST_REQUIRE( t.get<VectorXYProperty>(row, 7) == VectorXYProperty() );
+    BOOST_REQUIRE_EQUAL( t.get<Int64Property>(row, 8), 0 );
+    BOOST_REQUIRE_EQUAL( t.get<UInt64Property>(row, 9), 0 );
+    BOOST_REQUIRE( !t.get<property>(row, 10).isInitialized() );
+    BOOST_REQUIRE( !t.get<property>(row, 11).isInitialized() );
+
+    // a delta only sets what it contains
+    const std::string delta = writeFields({1, 10}, 4);
+    bitstream d(delta);
+    t.update(row, d);
+
+    BOOST_REQUIRE_EQUAL( t.get<UIntProperty>(row, 1), 0x204 );
+    BOOST_REQUIRE_EQUAL( t.get<property>(row, 10).as<StringProperty>(), "value 4" );
+    BOOST_REQUIRE_EQUAL( t.get<IntProperty>(row, 0), 0 );
+    BOOST_REQUIRE( !t.get<property>(row, 11).isInitialized() );
+}
+
+BOOST_AUTO_TEST_CASE( Access )
+{
+    test_class c;
+    column_table t(c.flat);
+    const uint32_t row = t.allocate(1);
+
+    BOOST_REQUIRE_THROW( t.get<FloatProperty>(row, 0), columnBadCast );
+    BOOST_REQUIRE_THROW( t.column<IntProperty>(c.flat.properties.size()), columnUnkownIndex );
+    BOOST_REQUIRE_THROW( t.get<IntProperty>(row + 1, 0), columnUnkownIndex );
+
+    // fields not in the table
+    bit_writer w;
+    int32_t last = -1;
+    w.putField(last, 20);
+    w.putEnd();
+
+    bitstream b(w.data);
+    BOOST_REQUIRE_THROW( t.update(row, b), entityUnkownSendprop );
+
+    BOOST_REQUIRE_EQUAL( t.column<IntProperty>(0).size(), 1 );
+    t.clear();
+    BOOST_REQUIRE_EQUAL( t.size(), 0 );
+    BOOST_REQUIRE_EQUAL( t.column<IntProperty>(0).size(), 0 );
+}
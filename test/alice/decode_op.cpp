@@ -0,0 +1,289 @@
+/**
+ * @file test/decode_op.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE DecodeOp
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <alice/bitstream.hpp>
+#include <alice/netmessages.pb.h>
+#include <alice/property.hpp>
+#include <alice/sendprop.hpp>
+
+using namespace dota;
+
+/** Flags of all float encodings */
+const std::vector<uint32_t> floatFlags {
+    0,
+    SPROP_COORD,
+    SPROP_NOSCALE,
+    SPROP_NORMAL,
+    SPROP_COORD_MP,
+    SPROP_COORD_MP | SPROP_COORD_MP_INTEGRAL,
+    SPROP_COORD_MP | SPROP_COORD_MP_LOWPRECISION,
+    SPROP_CELL_COORD,
+    SPROP_CELL_COORD_INTEGRAL,
+    SPROP_CELL_COORD_LOWPRECISION
+};
+
+/** Flags of all integer encodings */
+const std::vector<uint32_t> intFlags {
+    0,
+    SPROP_UNSIGNED,
+    SPROP_ENCODED_AGAINST_TICKCOUNT,
+    SPROP_ENCODED_AGAINST_TICKCOUNT | SPROP_UNSIGNED
+};
+
+/** Returns a sendprop definition */
+CSVCMsg_SendTable::sendprop_t definition(sendprop::type t, uint32_t flags, uint32_t bits,
+    float low = 0.0f, float high = 1.0f, uint32_t elements = 0)
+{
+    CSVCMsg_SendTable::sendprop_t p;
+    p.set_type(t);
+    p.set_flags(flags);
+    p.set_num_bits(bits);
+    p.set_low_value(low);
+    p.set_high_value(high);
+    p.set_num_elements(elements);
+    return p;
+}
+
+/** Returns the bitstreams every definition is decoded from */
+std::vector<std::string> bitstreams() {
+    std::vector<std::string> ret {
+        std::string(64, '\x00'),
+        std::string(64, '\xFF'),
+        std::string(64, '\xA5'),
+        std::string(64, '\x5A')
+    };
+
+    // deterministic noise
+    uint32_t state = 12345;
+    for (uint32_t i = 0; i < 16; ++i) {
+        std::string s(64, '\0');
+        for (auto &c : s) {
+            state = state * 1103515245 + 12345;
+            c = static_cast<char>(state >> 16);
+        }
+
+        ret.push_back(s);
+    }
+
+    return ret;
+}
+
+/** Checks that two properties hold the same value, floats are compared bitwise */
+void requireSame(property &a, property &b) {
+    BOOST_REQUIRE_EQUAL( a.getType(), b.getType() );
+
+    switch (a.getType()) {
+        case sendprop::T_Int:
+        case sendprop::T_Int64:
+            // also compares whether the value is signed
+            BOOST_REQUIRE_EQUAL( a.asString(), b.asString() );
+            break;
+        case sendprop::T_Float:
+            BOOST_REQUIRE( std::memcmp(&a.as<FloatProperty>(), &b.as<FloatProperty>(), sizeof(FloatProperty)) == 0 );
+            break;
+        case sendprop::T_Vector:
+            BOOST_REQUIRE( std::memcmp(a.as<VectorProperty>().data(), b.as<VectorProperty>().data(), sizeof(VectorProperty)) == 0 );
+            break;
+        case sendprop::T_VectorXY:
+            BOOST_REQUIRE( std::memcmp(a.as<VectorXYProperty>().data(), b.as<VectorXYProperty>().data(), sizeof(VectorXYProperty)) == 0 );
+            break;
+        case sendprop::T_String:
+            BOOST_REQUIRE( a.as<StringProperty>() == b.as<StringProperty>() );
+            break;
+        case sendprop::T_Array: {
+            ArrayProperty ea = a.as<ArrayProperty>();
+            ArrayProperty eb = b.as<ArrayProperty>();
+
+            BOOST_REQUIRE_EQUAL( ea.size(), eb.size() );
+            for (std::size_t i = 0; i < ea.size(); ++i) {
+                requireSame(ea[i], eb[i]);
+            }
+        } break;
+        default:
+            BOOST_FAIL( "Unexpected property type" );
+    }
+}
+
+/**
+ * Decodes each bitstream with the sendprop and with its compiled decoder.
+ *
+ * Values, the number of bits read and the number of bits skipped have to match. Updating a
+ * property in place has to yield the same value as creating it. Data that can't be read or
+ * skipped, e.g. strings that are too long, has to throw in both cases.
+ */
+void requireMatch(sendprop &p) {
+    const decode_op op = decode_op::compile(&p);
+    uint32_t decoded = 0;
+
+    for (auto &data : bitstreams()) {
+        bitstream legacy(data), compiled(data), updated(data), skipLegacy(data), skipCompiled(data);
+        property a, b;
+
+        try {
+            a = property::create(legacy, &p);
+        } catch (boost::exception &e) {
+            BOOST_REQUIRE_THROW( property::create(compiled, op), boost::exception );
+            continue;
+        }
+
+        b = property::create(compiled, op);
+        requireSame(a, b);
+        BOOST_REQUIRE_EQUAL( legacy.position(), compiled.position() );
+
+        property c = a;
+        c.update(updated, op);
+        requireSame(a, c);
+        BOOST_REQUIRE_EQUAL( legacy.position(), updated.position() );
+
+        // skipping a varint doesn't stop after the maximum length and may overflow
+        try {
+            property::skip(skipLegacy, &p);
+        } catch (boost::exception &e) {
+            BOOST_REQUIRE_THROW( property::skip(skipCompiled, op), boost::exception );
+            continue;
+        }
+
+        property::skip(skipCompiled, op);
+        BOOST_REQUIRE_EQUAL( skipLegacy.position(), skipCompiled.position() );
+
+        ++decoded;
+    }
+
+    BOOST_REQUIRE( decoded > 0 );
+}
+
+BOOST_AUTO_TEST_CASE( Int )
+{
+    for (auto flags : intFlags) {
+        for (uint32_t bits : {1, 7, 8, 17, 31, 32}) {
+            sendprop p(definition(sendprop::T_Int, flags, bits), "int");
+            requireMatch(p);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Float )
+{
+    for (auto flags : floatFlags) {
+        for (uint32_t bits : {1, 8, 11, 20, 32}) {
+            sendprop p(definition(sendprop::T_Float, flags, bits, -100.0f, 250.0f), "float");
+            requireMatch(p);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Vector )
+{
+    std::vector<uint32_t> flags = floatFlags;
+    flags.push_back(SPROP_NORMAL | SPROP_COORD);
+
+    for (auto f : flags) {
+        sendprop v(definition(sendprop::T_Vector, f, 12, -4096.0f, 4096.0f), "vector");
+        requireMatch(v);
+
+        sendprop xy(definition(sendprop::T_VectorXY, f, 12, -4096.0f, 4096.0f), "vectorxy");
+        requireMatch(xy);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Int64 )
+{
+    for (auto flags : intFlags) {
+        for (uint32_t bits : {33, 48, 64}) {
+            sendprop p(definition(sendprop::T_Int64, flags, bits), "int64");
+            requireMatch(p);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( String )
+{
+    sendprop p(definition(sendprop::T_String, 0, 0), "string");
+    requireMatch(p);
+}
+
+BOOST_AUTO_TEST_CASE( Array )
+{
+    for (auto flags : floatFlags) {
+        sendprop element(definition(sendprop::T_Float, flags, 10, 0.0f, 100.0f), "element");
+        sendprop p(definition(sendprop::T_Array, 0, 0, 0.0f, 0.0f, 5), "array");
+        p.setArrayType(&element);
+        requireMatch(p);
+    }
+
+    for (auto flags : intFlags) {
+        sendprop element(definition(sendprop::T_Int, flags, 6), "element");
+        sendprop p(definition(sendprop::T_Array, 0, 0, 0.0f, 0.0f, 12), "array");
+        p.setArrayType(&element);
+        requireMatch(p);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( KnownValues )
+{
+    // bitstreams are read starting with the least significant bit
+    const std::string bytes("\xAB\xFF\x96\x01\x00\x00\xC0\x3F", 8);
+
+    {
+        sendprop p(definition(sendprop::T_Int, SPROP_UNSIGNED, 8), "uint");
+        bitstream b(bytes);
+        BOOST_REQUIRE_EQUAL( property::create(b, decode_op::compile(&p)).as<UIntProperty>(), 0xAB );
+    }
+
+    {
+        sendprop p(definition(sendprop::T_Int, 0, 8), "int");
+        bitstream b(bytes.substr(1));
+        BOOST_REQUIRE_EQUAL( property::create(b, decode_op::compile(&p)).as<IntProperty>(), -1 );
+    }
+
+    {
+        sendprop p(definition(sendprop::T_Int, SPROP_UNSIGNED | SPROP_ENCODED_AGAINST_TICKCOUNT, 32), "varuint");
+        bitstream b(bytes.substr(2));
+        BOOST_REQUIRE_EQUAL( property::create(b, decode_op::compile(&p)).as<UIntProperty>(), 150 );
+    }
+
+    {
+        sendprop p(definition(sendprop::T_Float, SPROP_NOSCALE, 32), "noscale");
+        bitstream b(bytes.substr(4));
+        BOOST_REQUIRE_EQUAL( property::create(b, decode_op::compile(&p)).as<FloatProperty>(), 1.5f );
+    }
+
+    {
+        // all bits set is the high value, none the low value
+        sendprop p(definition(sendprop::T_Float, 0, 8, 10.0f, 40.0f), "scaled");
+        bitstream high(bytes.substr(1));
+        bitstream low(bytes.substr(4));
+
+        BOOST_REQUIRE_EQUAL( property::create(high, decode_op::compile(&p)).as<FloatProperty>(), 40.0f );
+        BOOST_REQUIRE_EQUAL( property::create(low, decode_op::compile(&p)).as<FloatProperty>(), 10.0f );
+    }
+}
@@ -0,0 +1,227 @@
+/**
+ * @file test/dem_index.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE DemIndex
+
+#include <cstdio>
+#include <sstream>
+
+#include <boost/test/unit_test.hpp>
+#include <alice/dem_index.hpp>
+#include <alice/dem_stream_file.hpp>
+#include <alice/dem_stream_memory.hpp>
+
+#include "replay.hpp"
+
+using namespace dota;
+
+/** Keeps indices in memory and counts how often they are used */
+class memory_store : public dem_index_store {
+    public:
+        uint32_t loads = 0;
+        uint32_t saves = 0;
+        std::string data;
+
+        virtual bool load(const std::string &replay, dem_index &index) {
+            ++loads;
+            std::istringstream in(data);
+            return index.deserialize(in);
+        }
+
+        virtual void save(const std::string &replay, const dem_index &index) {
+            ++saves;
+            std::ostringstream out;
+            index.serialize(out);
+            data = out.str();
+        }
+};
+
+/** Returns a small index */
+dem_index testIndex() {
+    dem_index idx;
+    idx.size = 123456;
+    idx.fullpackets = {12, 500, 1000};
+    idx.ticks = {{0, 12}, {30, 100}, {60, 480}, {90, 700}, {120, 1200}};
+    return idx;
+}
+
+/** Returns the serialized index */
+std::string serialize(const dem_index &idx) {
+    std::ostringstream out;
+    idx.serialize(out);
+    return out.str();
+}
+
+BOOST_AUTO_TEST_CASE( RoundTrip )
+{
+    const dem_index idx = testIndex();
+
+    dem_index read;
+    std::istringstream in(serialize(idx));
+
+    BOOST_REQUIRE( read.deserialize(in) );
+    BOOST_REQUIRE_EQUAL( read.size, idx.size );
+    BOOST_REQUIRE( read.fullpackets == idx.fullpackets );
+    BOOST_REQUIRE( read.ticks == idx.ticks );
+}
+
+BOOST_AUTO_TEST_CASE( Truncated )
+{
+    const std::string data = serialize(testIndex());
+
+    for (std::size_t len = 0; len < data.size(); ++len) {
+        dem_index read = testIndex();
+        std::istringstream in(data.substr(0, len));
+
+        BOOST_REQUIRE( !read.deserialize(in) );
+        BOOST_REQUIRE( read.empty() && read.ticks.empty() && read.size == 0 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Invalid )
+{
+    const std::string data = serialize(testIndex());
+
+    // wrong magic
+    {
+        std::string d = data;
+        d[0] = 'X';
+
+        dem_index read;
+        std::istringstream in(d);
+        BOOST_REQUIRE( !read.deserialize(in) );
+    }
+
+    // wrong version
+    {
+        std::string d = data;
+        const uint32_t version = DOTA_INDEX_VERSION + 1;
+        d.replace(4, sizeof(version), (const char*) &version, sizeof(version));
+
+        dem_index read;
+        std::istringstream in(d);
+        BOOST_REQUIRE( !read.deserialize(in) );
+        BOOST_REQUIRE( read.empty() );
+    }
+
+    // corrupt fullpacket count, fails at the end of the data instead of allocating
+    {
+        std::string d = data;
+        const uint32_t count = 0xFFFFFFFF;
+        d.replace(16, sizeof(count), (const char*) &count, sizeof(count));
+
+        dem_index read;
+        std::istringstream in(d);
+        BOOST_REQUIRE( !read.deserialize(in) );
+        BOOST_REQUIRE( read.empty() );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Lookup )
+{
+    const dem_index idx = testIndex();
+
+    BOOST_REQUIRE_EQUAL( idx.position(0), 12 );
+    BOOST_REQUIRE_EQUAL( idx.position(59), 100 );
+    BOOST_REQUIRE_EQUAL( idx.position(60), 480 );
+    BOOST_REQUIRE_EQUAL( idx.position(1000), 1200 );
+
+    BOOST_REQUIRE_EQUAL( idx.fullpacket(0), 0 );
+    BOOST_REQUIRE_EQUAL( idx.fullpacket(60), 0 );
+    BOOST_REQUIRE_EQUAL( idx.fullpacket(90), 1 );
+    BOOST_REQUIRE_EQUAL( idx.fullpacket(1000), 2 );
+}
+
+BOOST_AUTO_TEST_CASE( Store )
+{
+    const std::string path = "alice-test-replay-index.dem";
+    const std::string replay = testReplay(testMessages());
+    testWriteFile(path, replay);
+
+    memory_store store;
+
+    // generated by the first move and saved
+    {
+        dem_stream_file s;
+        s.setIndexStore(&store);
+        s.open(path);
+
+        BOOST_REQUIRE( s.getIndex().empty() );
+        s.move(1);
+
+        BOOST_REQUIRE_EQUAL( store.saves, 1 );
+        BOOST_REQUIRE_EQUAL( s.getIndex().size, replay.size() );
+        BOOST_REQUIRE_EQUAL( s.getIndex().fullpackets.size(), 4 );
+    }
+
+    // loaded on open by the same and other streams
+    {
+        dem_stream_memory s;
+        s.setIndexStore(&store);
+        s.open(path);
+
+        BOOST_REQUIRE( !s.getIndex().empty() );
+        s.move(1);
+
+        BOOST_REQUIRE_EQUAL( store.saves, 1 );
+    }
+
+    // discarded when the size doesn't match
+    testWriteFile(path, replay + "x");
+
+    {
+        dem_stream_file s;
+        s.setIndexStore(&store);
+        s.open(path);
+
+        BOOST_REQUIRE( s.getIndex().empty() );
+    }
+
+    std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE( MoveTick )
+{
+    const std::string path = "alice-test-replay-tick.dem";
+    testWriteFile(path, testReplay(testMessages()));
+
+    dem_stream_file s;
+    s.open(path);
+
+    // index is generated by the first call
+    s.moveTick(250);
+
+    demMessage_t msg = s.read();
+    BOOST_REQUIRE_EQUAL( msg.type, 13 );
+    BOOST_REQUIRE_EQUAL( msg.tick, 200 );
+
+    // backwards, before the first fullpacket
+    s.moveTick(50);
+
+    msg = s.read();
+    BOOST_REQUIRE_EQUAL( msg.type, 7 );
+    BOOST_REQUIRE_EQUAL( msg.tick, 1 );
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,208 @@
+/**
+ * @file test/dem_stream_compressed.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE DemStreamCompressed
+
+#include <boost/test/unit_test.hpp>
+#include <alice/config.hpp>
+
+#if DOTA_DECOMPRESS
+
+#include <cstdio>
+#include <sstream>
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#if DOTA_BZIP2
+#include <boost/iostreams/filter/bzip2.hpp>
+#endif // DOTA_BZIP2
+
+#if DOTA_GZIP
+#include <boost/iostreams/filter/gzip.hpp>
+#endif // DOTA_GZIP
+
+#if DOTA_XZ
+#include <boost/iostreams/filter/lzma.hpp>
+#endif // DOTA_XZ
+
+#include <alice/dem_stream_compressed.hpp>
+
+#include "replay.hpp"
+
+using namespace dota;
+
+/** Compresses data with the given filter */
+template <typename Compressor>
+std::string compress(const std::string &data, Compressor c) {
+    std::ostringstream out;
+    std::istringstream in(data);
+
+    boost::iostreams::filtering_ostream chain;
+    chain.push(c);
+    chain.push(out);
+    boost::iostreams::copy(in, chain);
+
+    return out.str();
+}
+
+/** Writes the synthetic replay in the given format, returns the path */
+std::string fixture(const std::string &format) {
+    const std::string path = "alice-test-replay-" + format + ".dem";
+    const std::string plain = testReplay(testMessages());
+
+    if (format == "plain")
+        testWriteFile(path, plain);
+    #if DOTA_BZIP2
+    else if (format == "bzip2")
+        testWriteFile(path, compress(plain, boost::iostreams::bzip2_compressor()));
+    #endif // DOTA_BZIP2
+    #if DOTA_GZIP
+    else if (format == "gzip")
+        testWriteFile(path, compress(plain, boost::iostreams::gzip_compressor()));
+    #endif // DOTA_GZIP
+    #if DOTA_XZ
+    else if (format == "xz")
+        testWriteFile(path, compress(plain, boost::iostreams::lzma_compressor()));
+    #endif // DOTA_XZ
+
+    return path;
+}
+
+/** Returns all formats a fixture can be generated for */
+std::vector<std::string> formats() {
+    return {
+        "plain",
+        #if DOTA_BZIP2
+        "bzip2",
+        #endif // DOTA_BZIP2
+        #if DOTA_GZIP
+        "gzip",
+        #endif // DOTA_GZIP
+        #if DOTA_XZ
+        "xz",
+        #endif // DOTA_XZ
+    };
+}
+
+/** Checks that the next message read from the stream matches m */
+void requireMessage(dem_stream &s, const test_message &m) {
+    BOOST_REQUIRE( s.good() );
+
+    demMessage_t msg = s.read();
+    BOOST_REQUIRE( !msg.compressed );
+    BOOST_REQUIRE_EQUAL( msg.type, m.type );
+    BOOST_REQUIRE_EQUAL( msg.tick, m.tick );
+    BOOST_REQUIRE_EQUAL( std::string(msg.msg, msg.size), m.data );
+}
+
+BOOST_AUTO_TEST_CASE( Detection )
+{
+    const std::vector<test_message> msgs = testMessages();
+
+    for (auto &format : formats()) {
+        const std::string path = fixture(format);
+
+        dem_stream_compressed s;
+        s.open(path);
+        BOOST_REQUIRE_EQUAL( s.getFormat(), format );
+
+        for (auto &m : msgs) {
+            requireMessage(s, m);
+        }
+
+        BOOST_REQUIRE( !s.good() );
+        std::remove(path.c_str());
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Restricted )
+{
+    for (auto &format : formats()) {
+        const std::string path = fixture(format);
+
+        // only accept the format itself
+        for (auto &other : formats()) {
+            dem_stream_compressed s(other);
+
+            if (other == format) {
+                s.open(path);
+                BOOST_REQUIRE_EQUAL( s.getFormat(), format );
+            } else {
+                BOOST_REQUIRE_THROW( s.open(path), demUnknownCompression );
+            }
+        }
+
+        std::remove(path.c_str());
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Move )
+{
+    const std::vector<test_message> msgs = testMessages();
+
+    // index of the message each minute starts at, minute 0 is the first message
+    std::vector<std::size_t> minutes{0};
+    for (std::size_t i = 0; i < msgs.size(); ++i) {
+        if (msgs[i].type == 13)
+            minutes.push_back(i);
+    }
+
+    for (auto &format : formats()) {
+        const std::string path = fixture(format);
+
+        dem_stream_compressed s;
+        s.open(path);
+
+        // forward, generates the index on the way
+        s.move(2);
+        BOOST_REQUIRE_EQUAL( s.getIndex().fullpackets.size(), minutes.size() );
+        requireMessage(s, msgs[minutes[2]]);
+        requireMessage(s, msgs[minutes[2]+1]);
+
+        // backward, the stream has to be reopened
+        s.move(1);
+        requireMessage(s, msgs[minutes[1]]);
+
+        s.move(0);
+        for (auto &m : msgs) {
+            requireMessage(s, m);
+        }
+
+        // past the end, stops at the last fullpacket
+        s.move(100);
+        requireMessage(s, msgs[minutes.back()]);
+
+        std::remove(path.c_str());
+    }
+}
+
+#else
+
+BOOST_AUTO_TEST_CASE( Disabled )
+{
+    BOOST_TEST_MESSAGE( "Alice has been built without decompression support" );
+}
+
+#endif // DOTA_DECOMPRESS
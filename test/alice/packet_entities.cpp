@@ -0,0 +1,163 @@
+/**
+ * @file test/packet_entities.cpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE PacketEntities
+
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+#include <google/protobuf/unknown_field_set.h>
+
+#include <alice/netmessages.pb.h>
+#include <alice/parser.hpp>
+
+using namespace dota;
+
+/** Returns a message with every field set */
+CSVCMsg_PacketEntities full() {
+    CSVCMsg_PacketEntities m;
+    m.set_max_entries(2048);
+    m.set_updated_entries(17);
+    m.set_is_delta(true);
+    m.set_update_baseline(true);
+    m.set_baseline(1);
+    m.set_delta_from(12345);
+    m.set_entity_data(std::string("\x01\x00\xFF\x80 entity bits", 16));
+    m.set_pending_full_frame(true);
+    return m;
+}
+
+/** Checks that the fields read match the message */
+void requireEqual(const packet_entities &e, const CSVCMsg_PacketEntities &m) {
+    BOOST_REQUIRE_EQUAL( e.max_entries, m.max_entries() );
+    BOOST_REQUIRE_EQUAL( e.updated_entries, m.updated_entries() );
+    BOOST_REQUIRE_EQUAL( e.is_delta, m.is_delta() );
+    BOOST_REQUIRE_EQUAL( e.entity_size, m.entity_data().size() );
+
+    if (m.has_entity_data())
+        BOOST_REQUIRE( std::string(e.entity_data, e.entity_size) == m.entity_data() );
+}
+
+/** Serializes m and reads it back */
+packet_entities roundTrip(const CSVCMsg_PacketEntities &m) {
+    std::string data;
+    BOOST_REQUIRE( m.SerializeToString(&data) );
+
+    packet_entities e;
+    e.read(data.data(), data.size());
+    requireEqual(e, m);
+
+    return e;
+}
+
+BOOST_AUTO_TEST_CASE( Fields )
+{
+    // all fields
+    roundTrip(full());
+
+    // empty message
+    packet_entities e = roundTrip(CSVCMsg_PacketEntities());
+    BOOST_REQUIRE( e.entity_data == nullptr );
+
+    // negative values are encoded as 10 byte varints
+    CSVCMsg_PacketEntities m = full();
+    m.set_max_entries(-1);
+    m.set_updated_entries(-2147483647);
+    roundTrip(m);
+
+    // empty entity data
+    m.set_entity_data("");
+    roundTrip(m);
+}
+
+BOOST_AUTO_TEST_CASE( EntityData )
+{
+    CSVCMsg_PacketEntities m = full();
+    m.set_entity_data(std::string(1000, '\xAB'));
+
+    std::string data;
+    m.SerializeToString(&data);
+
+    // points into the message instead of copying it
+    packet_entities e;
+    e.read(data.data(), data.size());
+
+    BOOST_REQUIRE( e.entity_data >= data.data() && e.entity_data + e.entity_size <= data.data() + data.size() );
+    BOOST_REQUIRE_EQUAL( e.entity_size, 1000 );
+}
+
+BOOST_AUTO_TEST_CASE( UnknownFields )
+{
+    CSVCMsg_PacketEntities m = full();
+
+    // one field for each wire type that can be skipped
+    google::protobuf::UnknownFieldSet* u = m.mutable_unknown_fields();
+    u->AddVarint(100, 0xFFFFFFFFFFFFULL);
+    u->AddFixed64(101, 0x0123456789ABCDEFULL);
+    u->AddLengthDelimited(102, std::string(300, 'x'));
+    u->AddFixed32(103, 0xDEADBEEF);
+    u->AddVarint(20000, 1);
+
+    roundTrip(m);
+}
+
+BOOST_AUTO_TEST_CASE( Truncated )
+{
+    CSVCMsg_PacketEntities m = full();
+    m.mutable_unknown_fields()->AddFixed64(101, 1);
+    m.mutable_unknown_fields()->AddFixed32(103, 1);
+
+    std::string data;
+    m.SerializeToString(&data);
+
+    // prefixes ending on a field boundary are valid messages, all others have to throw
+    for (std::size_t len = 0; len < data.size(); ++len) {
+        CSVCMsg_PacketEntities ref;
+        packet_entities e;
+
+        if (ref.ParseFromArray(data.data(), len)) {
+            e.read(data.data(), len);
+            requireEqual(e, ref);
+        } else {
+            BOOST_REQUIRE_THROW( e.read(data.data(), len), handlerParserError );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( Invalid )
+{
+    packet_entities e;
+
+    // varint longer than 10 bytes
+    const std::string overlong(11, '\x80');
+    BOOST_REQUIRE_THROW( e.read(overlong.data(), overlong.size()), handlerParserError );
+
+    // group wire type
+    const std::string group("\x63", 1); // field 12, start group
+    BOOST_REQUIRE_THROW( e.read(group.data(), group.size()), handlerParserError );
+
+    // length exceeding the message
+    const std::string length("\x3A\x05" "abc", 5); // field 7, 5 bytes
+    BOOST_REQUIRE_THROW( e.read(length.data(), length.size()), handlerParserError );
+}
@@ -0,0 +1,93 @@
+/**
+ * @file test/replay.hpp
+ * @author Robin Dietrich <me (at) invokr (dot) org>
+ * @version 1.0
+ *
+ * @par License
+ *    Alice Replay Parser
+ *    Copyright 2014 Robin Dietrich
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ *
+ */
+
+#ifndef _DOTA_TEST_REPLAY_HPP_
+#define _DOTA_TEST_REPLAY_HPP_
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+
+#include <alice/dem.hpp>
+
+/** A message in a synthetic replay */
+struct test_message {
+    uint32_t type;
+    uint32_t tick;
+    std::string data;
+};
+
+/**
+ * Returns the messages of a small synthetic replay.
+ *
+ * Contains a packet for each tick, a fullpacket every 100 ticks and the stop message followed
+ * by the file info. None of the messages are snappy compressed.
+ */
+inline std::vector<test_message> testMessages() {
+    std::vector<test_message> msgs;
+
+    for (uint32_t tick = 1; tick < 400; ++tick) {
+        msgs.push_back(test_message{7, tick, "packet " + std::to_string(tick) + std::string(tick % 50, 'x')});
+
+        if (tick % 100 == 0)
+            msgs.push_back(test_message{13, tick, "fullpacket " + std::to_string(tick)});
+    }
+
+    msgs.push_back(test_message{0, 400, ""});
+    msgs.push_back(test_message{2, 400, "fileinfo"});
+    return msgs;
+}
+
+/** Appends a varint32 (protobuf serialization format) */
+inline void testWriteVarInt(std::string &out, uint32_t v) {
+    while (v >= 0x80) {
+        out += (char) ((v & 0x7F) | 0x80);
+        v >>= 7;
+    }
+
+    out += (char) v;
+}
+
+/** Serializes messages to the dem format */
+inline std::string testReplay(const std::vector<test_message> &msgs) {
+    std::string out(DOTA_DEMHEADERID, sizeof(DOTA_DEMHEADERID));
+    out.append(4, '\0'); // offset of the fileinfo, unused
+
+    for (auto &m : msgs) {
+        testWriteVarInt(out, m.type);
+        testWriteVarInt(out, m.tick);
+        testWriteVarInt(out, m.data.size());
+        out += m.data;
+    }
+
+    return out;
+}
+
+/** Writes data to path */
+inline void testWriteFile(const std::string &path, const std::string &data) {
+    std::ofstream f(path.c_str(), std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+    f.write(data.data(), data.size());
+}
+
+#endif // _DOTA_TEST_REPLAY_HPP_